@@ -0,0 +1,92 @@
+// Include Files
+//==============
+
+#include "cSkeleton.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Animation::cSkeleton::Initialize(const int32_t* const i_parentIndices, const sJointPose* const i_bindPose, const size_t i_jointCount)
+{
+    auto result = Results::success;
+
+    EAE6320_ASSERT((i_parentIndices && i_bindPose) || (i_jointCount == 0));
+
+    for (size_t i = 0; i < i_jointCount; i++)
+    {
+        if ((i_parentIndices[i] < -1) || (i_parentIndices[i] >= static_cast<int32_t>(i)))
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF(false, "Invalid skeleton hierarchy");
+            Logging::OutputError("Joint %zu of a skeleton has the invalid parent %d (parents must come before their children)", i, i_parentIndices[i]);
+            goto OnExit;
+        }
+    }
+
+    m_parentIndices.assign(i_parentIndices, i_parentIndices + i_jointCount);
+    m_bindPose.assign(i_bindPose, i_bindPose + i_jointCount);
+
+    // The bind transforms are inverted once now
+    // so that evaluating a pose never has to
+    m_transforms_modelToBoundJoint.resize(i_jointCount);
+    CalculateModelTransforms(i_bindPose, m_transforms_modelToBoundJoint.data());
+    for (auto& transform : m_transforms_modelToBoundJoint)
+    {
+        // Joints can only be rotated and translated,
+        // and so the same cheap inverse that is used for cameras can be used
+        transform = Math::cMatrixTransformation::CreateWorldToCameraTransform(transform);
+    }
+
+OnExit:
+
+    if (!result)
+    {
+        CleanUp();
+    }
+
+    return result;
+}
+
+void eae6320::Animation::cSkeleton::CleanUp()
+{
+    m_parentIndices.clear();
+    m_bindPose.clear();
+    m_transforms_modelToBoundJoint.clear();
+}
+
+// Pose Evaluation
+//----------------
+
+void eae6320::Animation::cSkeleton::CalculateModelTransforms(const sJointPose* const i_pose, Math::cMatrixTransformation* const o_transforms_jointToModel) const
+{
+    const auto jointCount = m_parentIndices.size();
+    EAE6320_ASSERT((i_pose && o_transforms_jointToModel) || (jointCount == 0));
+    // Every parent comes before its children,
+    // and so a parent's transform is always ready by the time that it is needed
+    for (size_t i = 0; i < jointCount; i++)
+    {
+        const Math::cMatrixTransformation transform_jointToParent(i_pose[i].rotation, i_pose[i].translation);
+        const auto parentIndex = m_parentIndices[i];
+        o_transforms_jointToModel[i] = (parentIndex >= 0) ?
+            Math::cMatrixTransformation::ConcatenateAffine(o_transforms_jointToModel[parentIndex], transform_jointToParent) :
+            transform_jointToParent;
+    }
+}
+
+void eae6320::Animation::cSkeleton::CalculateSkinningTransforms(const sJointPose* const i_pose, Math::cMatrixTransformation* const o_transforms_skinning) const
+{
+    // The model transforms are calculated in place
+    // and then each one is combined with the inverse of its bind transform
+    CalculateModelTransforms(i_pose, o_transforms_skinning);
+    const auto jointCount = m_parentIndices.size();
+    for (size_t i = 0; i < jointCount; i++)
+    {
+        o_transforms_skinning[i] = Math::cMatrixTransformation::ConcatenateAffine(o_transforms_skinning[i], m_transforms_modelToBoundJoint[i]);
+    }
+}
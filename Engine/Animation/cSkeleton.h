@@ -0,0 +1,86 @@
+/*
+A skeleton is the hierarchy of joints that a skinned mesh is bound to
+
+A pose of the skeleton is the rotation and translation of every joint relative to its parent.
+The skeleton evaluates a pose into the transforms that are used to skin the mesh's vertices
+(i.e. the transforms that move a vertex from where it was bound to where the joints currently are).
+*/
+
+#ifndef EAE6320_ANIMATION_CSKELETON_H
+#define EAE6320_ANIMATION_CSKELETON_H
+
+// Include Files
+//==============
+
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Results/Results.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Animation
+    {
+        // The pose of a single joint relative to its parent
+        struct sJointPose
+        {
+            Math::cQuaternion rotation;
+            Math::sVector translation;
+        };
+
+        class cSkeleton
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // Every parent index must be less than the index of the joint itself
+            // (i.e. parents must come before their children), and root joints use -1
+            cResult Initialize(const int32_t* const i_parentIndices, const sJointPose* const i_bindPose, const size_t i_jointCount);
+            void CleanUp();
+
+            // Access
+            //-------
+
+            size_t GetJointCount() const { return m_parentIndices.size(); }
+            int32_t GetParentIndex(const size_t i_jointIndex) const { return m_parentIndices[i_jointIndex]; }
+            // The bind pose is a valid pose for the skeleton
+            // and can be used as the starting point for a new one
+            const std::vector<sJointPose>& GetBindPose() const { return m_bindPose; }
+
+            // Pose Evaluation
+            //----------------
+
+            // Calculates the transform from each joint's space to the space of the whole model.
+            // The pose and output must both have GetJointCount() elements
+            void CalculateModelTransforms(const sJointPose* const i_pose, Math::cMatrixTransformation* const o_transforms_jointToModel) const;
+            // Calculates the transform that moves a vertex in the bind pose to where it is in the given pose
+            // (this is what skinning blends between).
+            // The pose and output must both have GetJointCount() elements
+            void CalculateSkinningTransforms(const sJointPose* const i_pose, Math::cMatrixTransformation* const o_transforms_skinning) const;
+
+            // Data
+            //=====
+
+        private:
+
+            std::vector<int32_t> m_parentIndices;
+            std::vector<sJointPose> m_bindPose;
+            // The transform from the space of the model to each joint's space when the mesh was bound
+            std::vector<Math::cMatrixTransformation> m_transforms_modelToBoundJoint;
+        };
+    }
+}
+
+#endif    // EAE6320_ANIMATION_CSKELETON_H
@@ -0,0 +1,293 @@
+// Include Files
+//==============
+
+#include "../cbApplication.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Graphics/Graphics.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Time/Time.h>
+#include <Engine/UserOutput/UserOutput.h>
+#include <Engine/UserSettings/UserSettings.h>
+#include <signal.h>
+#include <vector>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // The render loop runs on the main thread but the application calls Exit() from the application loop thread
+    std::atomic<bool> s_shouldRenderLoopExit(false);
+    std::atomic<int> s_exitCode(EXIT_SUCCESS);
+
+    // This is set by a signal handler when e.g. the user presses Ctrl+C or a test script kills the process,
+    // and the application then exits normally (and still reports its frame times)
+    volatile std::sig_atomic_t s_terminationSignal = 0;
+    struct sigaction s_previousInterruptAction;
+    struct sigaction s_previousTerminationAction;
+    bool s_wereSignalHandlersInstalled = false;
+
+    // Zero means that frames are rendered until the application exits
+    uint32_t s_frameCountToRender = 0;
+    // The number of ticks between the end of one rendered frame and the end of the next
+    std::vector<uint64_t> s_tickCounts_perFrame;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    void OnTerminationSignalReceived(const int i_signal);
+    void OutputFrameTimeStatistics();
+}
+
+// Interface
+//==========
+
+// Access
+//-------
+
+eae6320::cResult eae6320::Application::cbApplication::GetCurrentResolution(uint16_t& o_width, uint16_t& o_height) const
+{
+    if ((m_resolutionWidth != 0) && (m_resolutionHeight != 0))
+    {
+        o_width = m_resolutionWidth;
+        o_height = m_resolutionHeight;
+        return Results::success;
+    }
+    else
+    {
+        return Results::Failure;
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Application::cbApplication::cbApplication()
+    :
+    m_exitCode(EXIT_SUCCESS)
+{
+
+}
+
+// Implementation
+//===============
+
+// Run
+//----
+
+eae6320::cResult eae6320::Application::cbApplication::RenderFramesWhileWaitingForApplicationToExit(int& o_exitCode)
+{
+    // There are no operating system messages to handle,
+    // and so frames are rendered as fast as the application loop submits them
+    // until the application exits, a termination signal is received, or the requested number of frames has been rendered
+    auto tickCount_previousFrame = Time::GetCurrentSystemTimeTickCount();
+    while (!s_shouldRenderLoopExit && (s_terminationSignal == 0))
+    {
+        Graphics::RenderFrame();
+        {
+            const auto tickCount_currentFrame = Time::GetCurrentSystemTimeTickCount();
+            s_tickCounts_perFrame.push_back(tickCount_currentFrame - tickCount_previousFrame);
+            tickCount_previousFrame = tickCount_currentFrame;
+        }
+        if ((s_frameCountToRender > 0) && (s_tickCounts_perFrame.size() >= s_frameCountToRender))
+        {
+            Logging::OutputMessage("The requested %u frames have been rendered", s_frameCountToRender);
+            break;
+        }
+    }
+    if (s_terminationSignal != 0)
+    {
+        Logging::OutputMessage("The application received the signal %i and will exit", static_cast<int>(s_terminationSignal));
+    }
+
+    // If the application didn't exit itself (i.e. if the render loop decided to stop)
+    // the application loop thread is told to exit when the application is cleaned up
+    o_exitCode = s_shouldRenderLoopExit ? s_exitCode.load() : EXIT_SUCCESS;
+
+    OutputFrameTimeStatistics();
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::ExitPlatformSpecific(const int i_exitCode)
+{
+    // The render loop will stop after the frame that it is currently rendering
+    // (the application loop always submits one more frame after calling Exit(),
+    // and so the render thread can't be left waiting forever)
+    m_exitCode = i_exitCode;
+    s_exitCode = i_exitCode;
+    s_shouldRenderLoopExit = true;
+
+    return Results::success;
+}
+
+bool eae6320::Application::cbApplication::IsInBackground() const
+{
+    // A headless application has no window to be hidden
+    // (and its frame rate shouldn't drop while it is being measured)
+    return false;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::GetDisplayRefreshRate(double&) const
+{
+    // A headless application has no display
+    return Results::Failure;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Application::cbApplication::InitializeBase(const sEntryPointParameters&)
+{
+    cResult result = Results::success;
+
+    s_shouldRenderLoopExit = false;
+    s_exitCode = EXIT_SUCCESS;
+    s_terminationSignal = 0;
+
+    // Assign the resolution
+    // (there is no window, but the resolution is still used e.g. for the camera's aspect ratio)
+    {
+        // Get the application's default
+        GetDefaultInitialResolution(m_resolutionWidth, m_resolutionHeight);
+        // Override with the user's desired resolution
+        UserSettings::GetDesiredInitialResolutionWidth(m_resolutionWidth);
+        UserSettings::GetDesiredInitialResolutionHeight(m_resolutionHeight);
+    }
+    // Find out how many frames to render
+    {
+        s_frameCountToRender = 0;
+        UserSettings::GetFrameCountToRender(s_frameCountToRender);
+        // Reserving the memory up front keeps the render loop from allocating while it is being timed
+        constexpr uint32_t defaultFrameCountToReserve = 60 * 60 * 10;
+        s_tickCounts_perFrame.clear();
+        s_tickCounts_perFrame.reserve((s_frameCountToRender > 0) ? s_frameCountToRender : defaultFrameCountToReserve);
+    }
+    // Exit normally when the process is interrupted or terminated
+    {
+        struct sigaction terminationAction{};
+        terminationAction.sa_handler = OnTerminationSignalReceived;
+        sigemptyset(&terminationAction.sa_mask);
+        if ((sigaction(SIGINT, &terminationAction, &s_previousInterruptAction) == 0)
+            && (sigaction(SIGTERM, &terminationAction, &s_previousTerminationAction) == 0))
+        {
+            s_wereSignalHandlersInstalled = true;
+        }
+        else
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF(false, "Couldn't install the termination signal handlers");
+            Logging::OutputError("The signal handlers to exit the application when it is interrupted or terminated couldn't be installed");
+            goto OnExit;
+        }
+    }
+
+    Logging::OutputMessage("The headless application will render at %ux%u", m_resolutionWidth, m_resolutionHeight);
+
+OnExit:
+
+    return result;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::PopulateGraphicsInitializationParameters(Graphics::sInitializationParameters& o_initializationParameters) const
+{
+    o_initializationParameters.resolutionWidth = m_resolutionWidth;
+    o_initializationParameters.resolutionHeight = m_resolutionHeight;
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::PopulateUserOutputInitializationParameters(UserOutput::sInitializationParameters&) const
+{
+    // User output is written to the standard output
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::CleanUpBase()
+{
+    auto result = Results::success;
+
+    // Signal Handlers
+    if (s_wereSignalHandlersInstalled)
+    {
+        if ((sigaction(SIGINT, &s_previousInterruptAction, nullptr) != 0)
+            || (sigaction(SIGTERM, &s_previousTerminationAction, nullptr) != 0))
+        {
+            EAE6320_ASSERT(false);
+            Logging::OutputError("The previous signal handlers couldn't be restored");
+            result = Results::Failure;
+        }
+        s_wereSignalHandlersInstalled = false;
+    }
+    // Frame Times
+    {
+        s_tickCounts_perFrame.clear();
+        s_tickCounts_perFrame.shrink_to_fit();
+    }
+
+    return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void OnTerminationSignalReceived(const int i_signal)
+    {
+        // Only async-signal-safe things can happen here,
+        // and so the render loop is just told to stop
+        s_terminationSignal = i_signal;
+    }
+
+    void OutputFrameTimeStatistics()
+    {
+        const auto frameCount = s_tickCounts_perFrame.size();
+        if (frameCount == 0)
+        {
+            eae6320::Logging::OutputMessage("No frames were rendered");
+            return;
+        }
+
+        auto tickCounts_sorted = s_tickCounts_perFrame;
+        std::sort(tickCounts_sorted.begin(), tickCounts_sorted.end());
+        uint64_t tickCount_total = 0;
+        for (const auto tickCount : tickCounts_sorted)
+        {
+            tickCount_total += tickCount;
+        }
+        // The nearest-rank percentile is used so that every reported time is one that was actually measured
+        const auto GetPercentile_inMilliseconds = [&tickCounts_sorted, frameCount](const double i_percentile)
+        {
+            const auto rank = static_cast<size_t>(std::ceil(i_percentile * frameCount));
+            const auto index = std::min(std::max(rank, size_t(1)), frameCount) - 1;
+            return eae6320::Time::ConvertTicksToSeconds(tickCounts_sorted[index]) * 1000.0;
+        };
+        const auto totalSecondCount = eae6320::Time::ConvertTicksToSeconds(tickCount_total);
+        const auto minimum_inMilliseconds = eae6320::Time::ConvertTicksToSeconds(tickCounts_sorted.front()) * 1000.0;
+        const auto mean_inMilliseconds = (totalSecondCount * 1000.0) / frameCount;
+        const auto median_inMilliseconds = GetPercentile_inMilliseconds(0.5);
+        const auto percentile95_inMilliseconds = GetPercentile_inMilliseconds(0.95);
+        const auto percentile99_inMilliseconds = GetPercentile_inMilliseconds(0.99);
+        const auto maximum_inMilliseconds = eae6320::Time::ConvertTicksToSeconds(tickCounts_sorted.back()) * 1000.0;
+        const auto framesPerSecond = (totalSecondCount > 0.0) ? (frameCount / totalSecondCount) : 0.0;
+
+        constexpr auto* const format = "Frame times over %u frames (%.2f seconds, %.1f frames per second):"
+            " min %.3f ms, mean %.3f ms, median %.3f ms, 95th %.3f ms, 99th %.3f ms, max %.3f ms";
+        const auto frameCount_asUnsigned = static_cast<unsigned int>(frameCount);
+        eae6320::Logging::OutputMessage(format, frameCount_asUnsigned, totalSecondCount, framesPerSecond,
+            minimum_inMilliseconds, mean_inMilliseconds, median_inMilliseconds,
+            percentile95_inMilliseconds, percentile99_inMilliseconds, maximum_inMilliseconds);
+        eae6320::UserOutput::Print(format, frameCount_asUnsigned, totalSecondCount, framesPerSecond,
+            minimum_inMilliseconds, mean_inMilliseconds, median_inMilliseconds,
+            percentile95_inMilliseconds, percentile99_inMilliseconds, maximum_inMilliseconds);
+    }
+}
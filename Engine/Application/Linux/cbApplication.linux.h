@@ -0,0 +1,34 @@
+/*
+    This file contains platform-specific class declarations for the application
+
+    There is no window on Linux:
+    The application is headless and is meant for benchmarking and soak tests
+    (it should be built with EAE6320_PLATFORM_NULL as the graphics platform)
+*/
+
+#ifndef EAE6320_APPLICATION_CBAPPLICATION_LINUX_H
+#define EAE6320_APPLICATION_CBAPPLICATION_LINUX_H
+
+    // Data
+    //=====
+
+private:
+
+    int m_exitCode = 0;
+
+    uint16_t m_resolutionWidth = 0;
+    uint16_t m_resolutionHeight = 0;
+
+    // Inheritable Implementation
+    //===========================
+
+private:
+
+    // Configuration
+    //--------------
+
+    // Your application can override the following configuration functions
+
+    virtual const char* GetExecutableDirectory() const = 0;
+
+#endif    // EAE6320_APPLICATION_CBAPPLICATION_LINUX_H
@@ -154,6 +154,46 @@ eae6320::cResult eae6320::Application::cbApplication::ExitPlatformSpecific(const
     return Results::success;
 }
 
+bool eae6320::Application::cbApplication::IsInBackground() const
+{
+    // The focus is tracked from WM_ACTIVATE messages,
+    // but a minimized window can still be active
+    return !UserInput::g_isWindowInFocus || (IsIconic(m_mainWindow) != FALSE);
+}
+
+eae6320::cResult eae6320::Application::cbApplication::GetDisplayRefreshRate(double& o_refreshRate_perSecond) const
+{
+    EAE6320_ASSERT(m_mainWindow);
+    // Get the monitor that most of the window is on
+    MONITORINFOEXA monitorInfo{};
+    {
+        const auto monitor = MonitorFromWindow(m_mainWindow, MONITOR_DEFAULTTOPRIMARY);
+        monitorInfo.cbSize = sizeof(monitorInfo);
+        if (GetMonitorInfoA(monitor, &monitorInfo) == FALSE)
+        {
+            const auto windowsErrorMessage = Windows::GetLastSystemError();
+            Logging::OutputError("Windows failed to get the window's monitor information: %s", windowsErrorMessage.c_str());
+            return Results::Failure;
+        }
+    }
+    // Get its current display settings
+    DEVMODEA displaySettings{};
+    displaySettings.dmSize = sizeof(displaySettings);
+    if (EnumDisplaySettingsA(monitorInfo.szDevice, ENUM_CURRENT_SETTINGS, &displaySettings) == FALSE)
+    {
+        Logging::OutputError("Windows failed to get the display settings of the monitor \"%s\"", monitorInfo.szDevice);
+        return Results::Failure;
+    }
+    // Values of 0 and 1 mean that the display uses its hardware's default refresh rate,
+    // which Windows doesn't report
+    if (displaySettings.dmDisplayFrequency <= 1)
+    {
+        return Results::Failure;
+    }
+    o_refreshRate_perSecond = static_cast<double>(displaySettings.dmDisplayFrequency);
+    return Results::success;
+}
+
 LRESULT CALLBACK eae6320::Application::cbApplication::OnMessageReceivedFromWindows(const HWND i_window, const UINT i_message, const WPARAM i_wParam, const LPARAM i_lParam)
 {
     // DispatchMessage() will send messages that the main window receives to this function.
@@ -0,0 +1,323 @@
+// Include Files
+//==============
+
+#include "cFramePipeline.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Time/Time.h>
+
+// Interface
+//==========
+
+// Run
+//----
+
+uint64_t eae6320::Application::cFramePipeline::WaitUntilNextFrameCanStart()
+{
+    EAE6320_ASSERTF(!m_isNextFrameReady, "The next frame must be started before waiting for another one");
+    const auto frameIndex = m_frameCount_started;
+    // The next frame replaces the frame that started maxFrameCountInFlight frames before it
+    auto& frame = GetFrame(frameIndex);
+    if (frame.hasStarted)
+    {
+        Concurrency::Jobs::WaitForCounter(frame.counter);
+#ifdef EAE6320_ASSERTS_ARE_ENABLED
+        for (size_t i = 0; i < m_stages.size(); ++i)
+        {
+            EAE6320_ASSERTF(frame.stageRuns[i].hasFinished, "The frame stage \"%s\" of frame %llu didn't finish",
+                m_stages[i].description.name, static_cast<unsigned long long>(frame.index));
+        }
+#endif
+    }
+    m_isNextFrameReady = true;
+    return frameIndex;
+}
+
+void eae6320::Application::cFramePipeline::StartNextFrame()
+{
+    EAE6320_ASSERTF(m_isNextFrameReady, "WaitUntilNextFrameCanStart() must be called before the next frame starts");
+    const auto frameIndex = m_frameCount_started;
+    auto& frame = GetFrame(frameIndex);
+    const auto* const previousFrame = (frameIndex > 0) ? &GetFrame(frameIndex - 1) : nullptr;
+    // Find the stages that don't have to wait for anything
+    sStageRun* stageRunsToStart[maxStageCount];
+    unsigned int stageRunCount_toStart = 0;
+    {
+        Concurrency::cMutex::cScopeLock lock(m_mutex);
+        frame.index = frameIndex;
+        frame.tickCount_start = Time::GetCurrentSystemTimeTickCount();
+        frame.hasStarted = true;
+        const auto stageCount = static_cast<tFrameStageId>(m_stages.size());
+        for (tFrameStageId id = 0; id < stageCount; ++id)
+        {
+            auto& stageRun = frame.stageRuns[id];
+            stageRun.pipeline = this;
+            stageRun.frame = &frame;
+            stageRun.stageId = id;
+            stageRun.hasFinished = false;
+            stageRun.remainingDependencyCount = m_stages[id].dependencyCount;
+            if (m_stages[id].description.waitsForSignal)
+            {
+                ++stageRun.remainingDependencyCount;
+            }
+            // Stages of the previous frame that have already finished don't have to be waited for
+            // (the ones that haven't will count down this stage's dependencies when they finish)
+            if (previousFrame)
+            {
+                for (tFrameStageId id_previousFrame = 0; id_previousFrame < stageCount; ++id_previousFrame)
+                {
+                    if (((m_stages[id_previousFrame].dependentStages_nextFrame & GetStageBit(id)) != 0)
+                        && !previousFrame->stageRuns[id_previousFrame].hasFinished)
+                    {
+                        ++stageRun.remainingDependencyCount;
+                    }
+                }
+            }
+            if (stageRun.remainingDependencyCount == 0)
+            {
+                stageRunsToStart[stageRunCount_toStart++] = &stageRun;
+            }
+        }
+        ++m_frameCount_started;
+    }
+    m_isNextFrameReady = false;
+    // The jobs are run after the lock has been released
+    // because a job could run on this thread immediately
+    for (unsigned int i = 0; i < stageRunCount_toStart; ++i)
+    {
+        Concurrency::Jobs::Run(RunStage, stageRunsToStart[i], &frame.counter);
+    }
+}
+
+void eae6320::Application::cFramePipeline::SignalStage(const uint64_t i_frameIndex, const tFrameStageId i_id)
+{
+    sStageRun* stageRunToStart = nullptr;
+    {
+        Concurrency::cMutex::cScopeLock lock(m_mutex);
+        EAE6320_ASSERTF(i_id < m_stages.size(), "Invalid frame stage ID");
+        EAE6320_ASSERTF(m_stages[i_id].description.waitsForSignal, "The frame stage \"%s\" doesn't wait for a signal",
+            m_stages[i_id].description.name);
+        auto& frame = GetFrame(i_frameIndex);
+        EAE6320_ASSERTF(frame.hasStarted && (frame.index == i_frameIndex), "Frame %llu hasn't started or has already finished",
+            static_cast<unsigned long long>(i_frameIndex));
+        auto& stageRun = frame.stageRuns[i_id];
+        EAE6320_ASSERT(stageRun.remainingDependencyCount > 0);
+        if (--stageRun.remainingDependencyCount == 0)
+        {
+            stageRunToStart = &stageRun;
+        }
+    }
+    // The job is run after the lock has been released
+    // because it could run on this thread immediately
+    if (stageRunToStart)
+    {
+        Concurrency::Jobs::Run(RunStage, stageRunToStart, &stageRunToStart->frame->counter);
+    }
+}
+
+void eae6320::Application::cFramePipeline::WaitForAllFrames()
+{
+    // The oldest frame is waited for first,
+    // because a frame's counter can only be trusted once the frame before it has finished
+    const auto frameCount_inFlight = std::min(m_frameCount_started, static_cast<uint64_t>(maxFrameCountInFlight));
+    for (auto frameIndex = m_frameCount_started - frameCount_inFlight; frameIndex < m_frameCount_started; ++frameIndex)
+    {
+        Concurrency::Jobs::WaitForCounter(GetFrame(frameIndex).counter);
+    }
+}
+
+// Access
+//-------
+
+eae6320::cResult eae6320::Application::cFramePipeline::AddStage(const sStageDescription& i_description, tFrameStageId& o_id)
+{
+    if (m_frameCount_started > 0)
+    {
+        EAE6320_ASSERTF(false, "Frame stages can't be added once frames have started");
+        Logging::OutputError("The frame stage \"%s\" can't be added because frames have already started", i_description.name);
+        return Results::Failure;
+    }
+    if (m_stages.size() >= maxStageCount)
+    {
+        EAE6320_ASSERTF(false, "Too many frame stages");
+        Logging::OutputError("The frame stage \"%s\" can't be added because there are already %u frame stages",
+            i_description.name, maxStageCount);
+        return Results::Failure;
+    }
+    if (!i_description.stageFunction)
+    {
+        EAE6320_ASSERTF(false, "A frame stage must have a stage function");
+        Logging::OutputError("The frame stage \"%s\" doesn't have a stage function", i_description.name);
+        return Results::Failure;
+    }
+    const auto id = static_cast<tFrameStageId>(m_stages.size());
+    // A stage can only depend on stages that already exist,
+    // which also means that there can't be a cycle of dependencies in a single frame
+    if (((i_description.stagesToFinishFirst >> id) != 0) || ((i_description.stagesToFinishFirst_previousFrame >> id) > 1))
+    {
+        EAE6320_ASSERTF(false, "A frame stage can only depend on stages that were added before it");
+        Logging::OutputError("The frame stage \"%s\" depends on frame stages that don't exist yet", i_description.name);
+        return Results::Failure;
+    }
+
+    sStage stage;
+    {
+        stage.description = i_description;
+        // Every stage depends on itself in the previous frame
+        stage.description.stagesToFinishFirst_previousFrame |= GetStageBit(id);
+        stage.dependentStages_nextFrame = GetStageBit(id);
+    }
+    for (tFrameStageId id_dependency = 0; id_dependency < id; ++id_dependency)
+    {
+        if ((i_description.stagesToFinishFirst & GetStageBit(id_dependency)) != 0)
+        {
+            m_stages[id_dependency].dependentStages |= GetStageBit(id);
+            ++stage.dependencyCount;
+        }
+        if ((i_description.stagesToFinishFirst_previousFrame & GetStageBit(id_dependency)) != 0)
+        {
+            m_stages[id_dependency].dependentStages_nextFrame |= GetStageBit(id);
+        }
+    }
+    m_stages.push_back(stage);
+    o_id = id;
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Application::cFramePipeline::AddDependencyOnPreviousFrame(const tFrameStageId i_id, const tFrameStageId i_id_toFinishFirst)
+{
+    if (m_frameCount_started > 0)
+    {
+        EAE6320_ASSERTF(false, "Frame stage dependencies can't be added once frames have started");
+        Logging::OutputError("A frame stage dependency can't be added because frames have already started");
+        return Results::Failure;
+    }
+    if ((i_id >= m_stages.size()) || (i_id_toFinishFirst >= m_stages.size()))
+    {
+        EAE6320_ASSERTF(false, "Invalid frame stage ID");
+        Logging::OutputError("A frame stage dependency can't be added between stages %u and %u because there are only %u stages",
+            i_id, i_id_toFinishFirst, static_cast<unsigned int>(m_stages.size()));
+        return Results::Failure;
+    }
+    // A dependency on the previous frame can't make a cycle
+    m_stages[i_id].description.stagesToFinishFirst_previousFrame |= GetStageBit(i_id_toFinishFirst);
+    m_stages[i_id_toFinishFirst].dependentStages_nextFrame |= GetStageBit(i_id);
+
+    return Results::success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Application::cFramePipeline::CleanUp()
+{
+    WaitForAllFrames();
+    if (m_frameCount_started > 0)
+    {
+        Logging::OutputMessage("The frame pipeline ran %llu frames", static_cast<unsigned long long>(m_frameCount_started));
+        for (const auto& stage : m_stages)
+        {
+            if (stage.runCount > 0)
+            {
+                constexpr double millisecondsPerSecond = 1000.0;
+                const auto runCount = static_cast<double>(stage.runCount);
+                Logging::OutputMessage("The frame stage \"%s\" took %.3f ms on average (%.3f ms at most)"
+                    " and started %.3f ms after its frame on average",
+                    stage.description.name,
+                    Time::ConvertTicksToSeconds(stage.tickCount_duration_total) * millisecondsPerSecond / runCount,
+                    Time::ConvertTicksToSeconds(stage.tickCount_duration_max) * millisecondsPerSecond,
+                    Time::ConvertTicksToSeconds(stage.tickCount_startDelay_total) * millisecondsPerSecond / runCount);
+            }
+        }
+    }
+    m_stages.clear();
+    for (auto& frame : m_frames)
+    {
+        frame.hasStarted = false;
+    }
+    m_frameCount_started = 0;
+    m_isNextFrameReady = false;
+    return Results::success;
+}
+
+eae6320::Application::cFramePipeline::~cFramePipeline()
+{
+    CleanUp();
+}
+
+// Implementation
+//===============
+
+unsigned int eae6320::Application::cFramePipeline::FinishStage(sStageRun& io_stageRun,
+    const uint64_t i_tickCount_start, const uint64_t i_tickCount_end, sStageRun** o_stageRunsToStart)
+{
+    Concurrency::cMutex::cScopeLock lock(m_mutex);
+
+    io_stageRun.hasFinished = true;
+    auto& stage = m_stages[io_stageRun.stageId];
+    auto& frame = *io_stageRun.frame;
+    // Update the statistics
+    {
+        const auto tickCount_duration = i_tickCount_end - i_tickCount_start;
+        ++stage.runCount;
+        stage.tickCount_duration_total += tickCount_duration;
+        stage.tickCount_duration_max = std::max(stage.tickCount_duration_max, tickCount_duration);
+        stage.tickCount_startDelay_total += i_tickCount_start - std::min(i_tickCount_start, frame.tickCount_start);
+    }
+    // Count down the dependencies of the stages that depend on this one
+    unsigned int stageRunCount_toStart = 0;
+    {
+        const auto stageCount = static_cast<tFrameStageId>(m_stages.size());
+        for (tFrameStageId id = 0; id < stageCount; ++id)
+        {
+            if ((stage.dependentStages & GetStageBit(id)) != 0)
+            {
+                auto& stageRun = frame.stageRuns[id];
+                EAE6320_ASSERT(stageRun.remainingDependencyCount > 0);
+                if (--stageRun.remainingDependencyCount == 0)
+                {
+                    o_stageRunsToStart[stageRunCount_toStart++] = &stageRun;
+                }
+            }
+        }
+        // If the next frame hasn't started yet it will see that this stage has finished when it does
+        auto& nextFrame = GetFrame(frame.index + 1);
+        if (nextFrame.hasStarted && (nextFrame.index == (frame.index + 1)))
+        {
+            for (tFrameStageId id = 0; id < stageCount; ++id)
+            {
+                if ((stage.dependentStages_nextFrame & GetStageBit(id)) != 0)
+                {
+                    auto& stageRun = nextFrame.stageRuns[id];
+                    EAE6320_ASSERT(stageRun.remainingDependencyCount > 0);
+                    if (--stageRun.remainingDependencyCount == 0)
+                    {
+                        o_stageRunsToStart[stageRunCount_toStart++] = &stageRun;
+                    }
+                }
+            }
+        }
+    }
+    return stageRunCount_toStart;
+}
+
+void eae6320::Application::cFramePipeline::RunStage(void* const io_stageRun)
+{
+    auto& stageRun = *static_cast<sStageRun*>(io_stageRun);
+    auto& pipeline = *stageRun.pipeline;
+    const auto& description = pipeline.m_stages[stageRun.stageId].description;
+    const auto tickCount_start = Time::GetCurrentSystemTimeTickCount();
+    description.stageFunction(description.userData, stageRun.frame->index);
+    const auto tickCount_end = Time::GetCurrentSystemTimeTickCount();
+    // The stages that this one made ready are run before this job finishes
+    // so that the counters of their frames can't reach zero in between
+    sStageRun* stageRunsToStart[maxStageCount * 2];
+    const auto stageRunCount_toStart = pipeline.FinishStage(stageRun, tickCount_start, tickCount_end, stageRunsToStart);
+    for (unsigned int i = 0; i < stageRunCount_toStart; ++i)
+    {
+        Concurrency::Jobs::Run(RunStage, stageRunsToStart[i], &stageRunsToStart[i]->frame->counter);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+    A frame pipeline splits the work of every frame into stages that run as jobs
+    (e.g. updating the simulation, preparing what will be rendered, and submitting it to the graphics system)
+
+    Every stage declares the data dependencies that it has:
+        * On stages of the same frame, which must finish before it starts
+        * On stages of the previous frame, which must also finish before it starts
+            (every stage implicitly depends on itself in the previous frame,
+            and so a stage never runs concurrently with itself)
+    A stage starts as soon as all of its dependencies have finished,
+    and so stages that don't depend on each other run in parallel.
+    More than one frame can be in flight at a time,
+    and so the stages of the next frame can start before the current frame has finished
+    if they don't depend on anything that hasn't finished yet
+    (for example, the next frame's simulation can be updated while the current frame is being submitted
+    if the submission doesn't read anything that the simulation writes).
+
+    A stage can also wait for something that isn't a stage
+    (e.g. for the operating system or another thread to be ready for it):
+    It doesn't start until SignalStage() has been called for its frame,
+    and so the thread that waits for that thing blocks instead of a job worker.
+
+    Rendering itself isn't a stage:
+    The render thread renders the previous frame's submitted data (see Graphics.h)
+    while the pipeline works on the following frames.
+
+    How long each stage takes is measured and logged when the pipeline is cleaned up.
+*/
+
+#ifndef EAE6320_APPLICATION_CFRAMEPIPELINE_H
+#define EAE6320_APPLICATION_CFRAMEPIPELINE_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Concurrency/cMutex.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Results/Results.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Application
+    {
+        using tFrameStageId = uint8_t;
+
+        class cFramePipeline
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // A stage function is given the user data from its stage's description
+            // and the index of the frame that it is running for
+            // (the index can be used to find data that is kept for each frame that is in flight;
+            // see maxFrameCountInFlight)
+            using fStageFunction = void (*)(void* const io_userData, const uint64_t i_frameIndex);
+
+            struct sStageDescription
+            {
+                // This is only used for logging
+                const char* name = "";
+                fStageFunction stageFunction = nullptr;
+                void* userData = nullptr;
+                // These stages of the same frame finish before this stage starts
+                // (there is one bit for every stage ID; see GetStageBit()).
+                // Only stages that have already been added can be depended on
+                uint32_t stagesToFinishFirst = 0;
+                // These stages of the previous frame finish before this stage starts
+                // (this stage's own bit doesn't need to be set).
+                // Dependencies on stages that are added later can be added with AddDependencyOnPreviousFrame()
+                uint32_t stagesToFinishFirst_previousFrame = 0;
+                // If this is true the stage also waits for SignalStage() to be called for its frame
+                bool waitsForSignal = false;
+            };
+
+            static constexpr unsigned int maxStageCount = 32;
+            // When a frame starts the frame that started this many frames before it must have finished
+            static constexpr unsigned int maxFrameCountInFlight = 2;
+            static constexpr uint32_t GetStageBit(const tFrameStageId i_id) { return 1u << i_id; }
+
+            // Run
+            //----
+
+            // This returns the index of the next frame
+            // once the frame that it replaces (i.e. the one that started maxFrameCountInFlight frames before it) has finished.
+            // Any data that is kept for each frame in flight can be written for the next frame after this returns
+            // (the calling thread runs jobs while it waits)
+            uint64_t WaitUntilNextFrameCanStart();
+            // This starts the frame whose index was returned by WaitUntilNextFrameCanStart()
+            // and returns without waiting for any of its stages to finish
+            void StartNextFrame();
+            // This lets a stage that waits for a signal start once its other dependencies have finished
+            // (see sStageDescription::waitsForSignal).
+            // It must be called exactly once for every frame that has started
+            // and before that frame is waited for
+            // (until it has been called the stage's frame can look like it has finished)
+            void SignalStage(const uint64_t i_frameIndex, const tFrameStageId i_id);
+            // This returns once every frame that has started has finished
+            void WaitForAllFrames();
+
+            // Access
+            //-------
+
+            // Stages can only be added before the first frame starts
+            cResult AddStage(const sStageDescription& i_description, tFrameStageId& o_id);
+            cResult AddDependencyOnPreviousFrame(const tFrameStageId i_id, const tFrameStageId i_id_toFinishFirst);
+            size_t GetStageCount() const { return m_stages.size(); }
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // This waits for every frame to finish,
+            // and then the time that each stage took is logged
+            cResult CleanUp();
+
+            ~cFramePipeline();
+
+            // Data
+            //=====
+
+        private:
+
+            struct sStage
+            {
+                sStageDescription description;
+                // The stages that depend on this one
+                uint32_t dependentStages = 0;
+                uint32_t dependentStages_nextFrame = 0;
+                unsigned int dependencyCount = 0;
+                // Statistics
+                uint64_t runCount = 0;
+                uint64_t tickCount_duration_total = 0;
+                uint64_t tickCount_duration_max = 0;
+                // How long after its frame started the stage started
+                uint64_t tickCount_startDelay_total = 0;
+            };
+            std::vector<sStage> m_stages;
+
+            struct sFrame;
+            struct sStageRun
+            {
+                cFramePipeline* pipeline = nullptr;
+                sFrame* frame = nullptr;
+                tFrameStageId stageId = 0;
+                // The stage starts when this reaches zero
+                unsigned int remainingDependencyCount = 0;
+                bool hasFinished = false;
+            };
+            struct sFrame
+            {
+                uint64_t index = 0;
+                uint64_t tickCount_start = 0;
+                // This is the number of stage jobs that have been run and haven't finished yet.
+                // Every stage that hasn't been run yet depends on one that has (or waits for a signal),
+                // and so once the previous frame has finished and every signal has been given
+                // this only reaches zero when the whole frame has
+                Concurrency::Jobs::cCounter counter;
+                sStageRun stageRuns[maxStageCount];
+                bool hasStarted = false;
+            };
+            sFrame m_frames[maxFrameCountInFlight];
+            uint64_t m_frameCount_started = 0;
+            bool m_isNextFrameReady = false;
+
+            // This protects the stage runs' dependency counts and the stages' statistics
+            Concurrency::cMutex m_mutex;
+
+            // Implementation
+            //===============
+
+        private:
+
+            sFrame& GetFrame(const uint64_t i_frameIndex) { return m_frames[i_frameIndex % maxFrameCountInFlight]; }
+            // Every stage run that this makes ready is added to the array, and the number of them is returned
+            unsigned int FinishStage(sStageRun& io_stageRun, const uint64_t i_tickCount_start, const uint64_t i_tickCount_end, sStageRun** o_stageRunsToStart);
+            static void RunStage(void* const io_stageRun);
+        };
+    }
+}
+
+#endif    // EAE6320_APPLICATION_CFRAMEPIPELINE_H
@@ -0,0 +1,191 @@
+// Include Files
+//==============
+
+#include "cTickScheduler.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Time/Time.h>
+
+// Interface
+//==========
+
+// Run
+//----
+
+void eae6320::Application::cTickScheduler::Tick(const uint64_t i_tickCount_systemTime_elapsed, const uint64_t i_tickCount_simulationTime_elapsed)
+{
+    // Decide how many times every group ticks this frame
+    for (auto& tickGroup : m_tickGroups)
+    {
+        const auto tickCount_elapsed = tickGroup.description.isScaledBySimulationRate ?
+            i_tickCount_simulationTime_elapsed : i_tickCount_systemTime_elapsed;
+        if (tickGroup.tickCount_period == 0)
+        {
+            // A group without a period ticks once every frame with all of the elapsed time
+            tickGroup.updateCount_thisFrame = 1;
+            tickGroup.secondCount_perUpdate_thisFrame = static_cast<float>(Time::ConvertTicksToSeconds(tickCount_elapsed));
+            continue;
+        }
+        tickGroup.tickCount_accumulated += tickCount_elapsed;
+        const auto updateCount_due = tickGroup.tickCount_accumulated / tickGroup.tickCount_period;
+        const auto updateCount_max = static_cast<uint64_t>(tickGroup.description.maxTickCount_perFrame);
+        const auto updateCount = std::min(updateCount_due, updateCount_max);
+        tickGroup.tickCount_accumulated -= updateCount * tickGroup.tickCount_period;
+        // If the group has fallen behind the catch-up policy decides what happens to the time that it couldn't tick
+        if (updateCount_due > updateCount_max)
+        {
+            const auto updateCount_excess = updateCount_due - updateCount_max;
+            const auto updateCount_toKeep = (tickGroup.description.catchUpPolicy == KeepExcessTime) ?
+                std::min(updateCount_excess, updateCount_max) : 0;
+            const auto updateCount_toDrop = updateCount_excess - updateCount_toKeep;
+            // The fraction of a period that hasn't elapsed yet is always kept
+            tickGroup.tickCount_accumulated -= updateCount_toDrop * tickGroup.tickCount_period;
+            tickGroup.droppedUpdateCount_total += updateCount_toDrop;
+        }
+        tickGroup.updateCount_thisFrame = static_cast<unsigned int>(updateCount);
+        tickGroup.secondCount_perUpdate_thisFrame = tickGroup.description.secondCount_perTick;
+    }
+    // Tick the groups one level at a time
+    // (all of the groups in a level are independent of each other and can tick in parallel,
+    // but they depend on groups in the previous levels)
+    for (unsigned int level = 0; level < m_levelCount; ++level)
+    {
+        sTickGroup* tickGroup_toRunOnThisThread = nullptr;
+        Concurrency::Jobs::cCounter counter;
+        for (auto& tickGroup : m_tickGroups)
+        {
+            if ((tickGroup.level == level) && (tickGroup.updateCount_thisFrame > 0))
+            {
+                // The calling thread ticks one group itself instead of waiting
+                if (tickGroup_toRunOnThisThread)
+                {
+                    Concurrency::Jobs::Run(TickGroup, tickGroup_toRunOnThisThread, &counter);
+                }
+                tickGroup_toRunOnThisThread = &tickGroup;
+            }
+        }
+        if (tickGroup_toRunOnThisThread)
+        {
+            TickGroup(tickGroup_toRunOnThisThread);
+        }
+        Concurrency::Jobs::WaitForCounter(counter);
+    }
+}
+
+// Access
+//-------
+
+eae6320::cResult eae6320::Application::cTickScheduler::AddTickGroup(const sTickGroupDescription& i_description, tTickGroupId& o_id)
+{
+    if (m_tickGroups.size() >= maxTickGroupCount)
+    {
+        EAE6320_ASSERTF(false, "Too many tick groups");
+        Logging::OutputError("The tick group \"%s\" can't be added because there are already %u tick groups",
+            i_description.name, maxTickGroupCount);
+        return Results::Failure;
+    }
+    if (!i_description.tickFunction)
+    {
+        EAE6320_ASSERTF(false, "A tick group must have a tick function");
+        Logging::OutputError("The tick group \"%s\" doesn't have a tick function", i_description.name);
+        return Results::Failure;
+    }
+    if (i_description.secondCount_perTick < 0.0f)
+    {
+        EAE6320_ASSERTF(false, "A tick period can't be negative");
+        Logging::OutputError("The tick group \"%s\" has a negative period (%f seconds)", i_description.name, i_description.secondCount_perTick);
+        return Results::Failure;
+    }
+    if ((i_description.secondCount_perTick > 0.0f) && (i_description.maxTickCount_perFrame == 0))
+    {
+        EAE6320_ASSERTF(false, "A tick group must be able to tick at least once per frame");
+        Logging::OutputError("The tick group \"%s\" can't tick even once per frame", i_description.name);
+        return Results::Failure;
+    }
+    const auto id = static_cast<tTickGroupId>(m_tickGroups.size());
+    // A group can only depend on groups that already exist,
+    // which also means that there can't be a cycle of dependencies
+    if ((i_description.groupsToTickFirst >> id) != 0)
+    {
+        EAE6320_ASSERTF(false, "A tick group can only depend on groups that were added before it");
+        Logging::OutputError("The tick group \"%s\" depends on tick groups that don't exist yet", i_description.name);
+        return Results::Failure;
+    }
+
+    sTickGroup tickGroup;
+    {
+        tickGroup.description = i_description;
+        tickGroup.tickCount_period = (i_description.secondCount_perTick > 0.0f) ?
+            Time::ConvertSecondsToTicks(i_description.secondCount_perTick) : 0;
+        for (tTickGroupId id_dependency = 0; id_dependency < id; ++id_dependency)
+        {
+            if ((i_description.groupsToTickFirst & GetTickGroupBit(id_dependency)) != 0)
+            {
+                tickGroup.level = std::max(tickGroup.level, m_tickGroups[id_dependency].level + 1);
+            }
+        }
+    }
+    m_tickGroups.push_back(tickGroup);
+    m_levelCount = std::max(m_levelCount, tickGroup.level + 1);
+    o_id = id;
+
+    if (tickGroup.tickCount_period > 0)
+    {
+        Logging::OutputMessage("Added the tick group \"%s\" at %.2f Hz", i_description.name, 1.0f / i_description.secondCount_perTick);
+    }
+    else
+    {
+        Logging::OutputMessage("Added the tick group \"%s\" to tick every frame", i_description.name);
+    }
+    return Results::success;
+}
+
+float eae6320::Application::cTickScheduler::GetSecondCountSinceLastTick(const tTickGroupId i_id) const
+{
+    EAE6320_ASSERT(i_id < m_tickGroups.size());
+    return static_cast<float>(Time::ConvertTicksToSeconds(m_tickGroups[i_id].tickCount_accumulated));
+}
+
+float eae6320::Application::cTickScheduler::GetSecondCountPerTick(const tTickGroupId i_id) const
+{
+    EAE6320_ASSERT(i_id < m_tickGroups.size());
+    return m_tickGroups[i_id].description.secondCount_perTick;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Application::cTickScheduler::CleanUp()
+{
+    for (const auto& tickGroup : m_tickGroups)
+    {
+        Logging::OutputMessage("The tick group \"%s\" ticked %llu times and dropped %llu ticks",
+            tickGroup.description.name, static_cast<unsigned long long>(tickGroup.updateCount_total),
+            static_cast<unsigned long long>(tickGroup.droppedUpdateCount_total));
+    }
+    m_tickGroups.clear();
+    m_levelCount = 0;
+    return Results::success;
+}
+
+eae6320::Application::cTickScheduler::~cTickScheduler()
+{
+    CleanUp();
+}
+
+// Implementation
+//===============
+
+void eae6320::Application::cTickScheduler::TickGroup(void* const io_tickGroup)
+{
+    auto& tickGroup = *static_cast<sTickGroup*>(io_tickGroup);
+    for (unsigned int i = 0; i < tickGroup.updateCount_thisFrame; ++i)
+    {
+        tickGroup.description.tickFunction(tickGroup.description.userData, tickGroup.secondCount_perUpdate_thisFrame);
+    }
+    tickGroup.updateCount_total += tickGroup.updateCount_thisFrame;
+    tickGroup.updateCount_thisFrame = 0;
+}
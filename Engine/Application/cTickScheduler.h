@@ -0,0 +1,138 @@
+/*
+    A tick scheduler updates groups of systems at their own fixed rates
+    (e.g. physics at 60 Hz, AI at 10 Hz, and cameras every frame),
+    independently of each other and of the application's simulation update rate
+
+    Every tick group has its own accumulator of time that has elapsed but hasn't been ticked yet,
+    and it ticks once for every whole period in the accumulator.
+    A group that has fallen behind only ticks a limited number of times in a single frame,
+    and its catch-up policy decides what happens to the rest of the time.
+
+    Groups that tick in the same frame are run as jobs in parallel
+    unless one has to tick before another (see sTickGroupDescription::groupsToTickFirst),
+    and so a group's tick function must not touch anything that a group it is independent of also touches.
+*/
+
+#ifndef EAE6320_APPLICATION_CTICKSCHEDULER_H
+#define EAE6320_APPLICATION_CTICKSCHEDULER_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+#include <Engine/Results/Results.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Application
+    {
+        using tTickGroupId = uint8_t;
+
+        class cTickScheduler
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // A tick function is given the user data from its group's description
+            // and the amount of time that the tick represents
+            using fTickFunction = void (*)(void* const io_userData, const float i_elapsedSecondCount_sinceLastTick);
+
+            enum eCatchUpPolicy : uint8_t
+            {
+                // Time that couldn't be ticked is thrown away
+                // (the group slows down instead of falling further behind)
+                DropExcessTime,
+                // Time that couldn't be ticked is ticked in the following frames
+                // (at most one more frame's worth of ticks is kept)
+                KeepExcessTime,
+            };
+
+            struct sTickGroupDescription
+            {
+                // This is only used for logging
+                const char* name = "";
+                fTickFunction tickFunction = nullptr;
+                void* userData = nullptr;
+                // Zero means that the group ticks once every frame with the time that elapsed since the previous frame
+                float secondCount_perTick = 0.0f;
+                // A group that has fallen behind ticks at most this many times in a single frame
+                uint8_t maxTickCount_perFrame = 4;
+                eCatchUpPolicy catchUpPolicy = DropExcessTime;
+                // If this is true the group's time is scaled by the simulation rate (and stops when it is zero).
+                // Otherwise it uses system time
+                bool isScaledBySimulationRate = true;
+                // When this group ticks in the same frame as any of these groups they finish ticking before it starts
+                // (there is one bit for every tick group ID; see GetTickGroupBit()).
+                // Only groups that have already been added can be depended on
+                uint32_t groupsToTickFirst = 0;
+            };
+
+            static constexpr unsigned int maxTickGroupCount = 32;
+            static constexpr uint32_t GetTickGroupBit(const tTickGroupId i_id) { return 1u << i_id; }
+
+            // Run
+            //----
+
+            // The application loop calls this every frame with the amounts of time that elapsed since the previous frame
+            void Tick(const uint64_t i_tickCount_systemTime_elapsed, const uint64_t i_tickCount_simulationTime_elapsed);
+
+            // Access
+            //-------
+
+            cResult AddTickGroup(const sTickGroupDescription& i_description, tTickGroupId& o_id);
+            // The time that has elapsed since the group's most recent tick
+            // (e.g. to interpolate or predict what it updates when rendering)
+            float GetSecondCountSinceLastTick(const tTickGroupId i_id) const;
+            float GetSecondCountPerTick(const tTickGroupId i_id) const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // How many times each group ticked and how many ticks it dropped are logged when the scheduler is cleaned up
+            cResult CleanUp();
+
+            ~cTickScheduler();
+
+            // Data
+            //=====
+
+        private:
+
+            struct sTickGroup
+            {
+                sTickGroupDescription description;
+                // The period in system time ticks (see Time.h).
+                // Zero means that the group ticks every frame
+                uint64_t tickCount_period = 0;
+                // The time that has elapsed but hasn't been ticked yet
+                uint64_t tickCount_accumulated = 0;
+                // A group only starts after every group that it depends on,
+                // and so groups of the same level can tick in parallel
+                unsigned int level = 0;
+                // How many times the group ticks in the current frame, and with how much time each
+                unsigned int updateCount_thisFrame = 0;
+                float secondCount_perUpdate_thisFrame = 0.0f;
+                // Statistics
+                uint64_t updateCount_total = 0;
+                uint64_t droppedUpdateCount_total = 0;
+            };
+            std::vector<sTickGroup> m_tickGroups;
+            unsigned int m_levelCount = 0;
+
+            // Implementation
+            //===============
+
+        private:
+
+            static void TickGroup(void* const io_tickGroup);
+        };
+    }
+}
+
+#endif    // EAE6320_APPLICATION_CTICKSCHEDULER_H
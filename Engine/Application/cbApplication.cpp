@@ -6,10 +6,14 @@
 #include <algorithm>
 #include <cstdlib>
 #include <Engine/Asserts/Asserts.h>
+#include <Engine/Benchmark/Benchmark.h>
+#include <Engine/Concurrency/Jobs.h>
 #include <Engine/Graphics/Graphics.h>
 #include <Engine/Logging/Logging.h>
 #include <Engine/Time/Time.h>
 #include <Engine/UserOutput/UserOutput.h>
+#include <Engine/UserSettings/UserSettings.h>
+#include <thread>
 
 // Interface
 //==========
@@ -99,12 +103,6 @@ void eae6320::Application::cbApplication::UpdateUntilExit()
     // This stores the number of ticks that have elapsed since the system has been running,
     // and it gets updated at the start of every iteration of the application loop
     m_tickCount_systemTime_current = Time::GetCurrentSystemTimeTickCount();
-    // Each update of the simulation is done with a fixed amount of time
-    const auto secondCount_perSimulationUpdate = GetSimulationUpdatePeriodInSeconds();
-    const auto tickCount_perSimulationUpdate = Time::ConvertSecondsToTicks(secondCount_perSimulationUpdate);
-    // Since a single update of the simulation only uses a fixed amount of time
-    // there will be "leftover" time (time that has passed but has not been used)
-    uint64_t tickCount_simulationTime_elapsedButNotYetSimulated = 0;
     // When the application is running normally all system time that passes is used to update the application.
     // There can be unusual situations, however, where a large amount of system time passes that the application should ignore.
     // One example is when you are debugging the application:
@@ -118,138 +116,206 @@ void eae6320::Application::cbApplication::UpdateUntilExit()
     }
     // This measures how much allowable system time has elapsed
     uint64_t tickCount_systemTime_elapsedAllowable = 0;
-    // It is important to keep rendering (and handling operating system messages)
-    // or the application will become unresponsive,
-    // and so even if the simulation is behind there is a maximum number of updates
-    // that will happen in a single loop iteration before a frame is rendered
-    constexpr unsigned int maxSimulationUpdateCountWithoutRendering = 5;
 
     // Loop until it is time for the application to exit
     while (!m_shouldApplicationLoopExit)
     {
-        // Calculate how much time has elapsed since the last loop
-        uint64_t tickCount_systemTime_elapsedSinceLastLoop;
-        uint64_t tickCount_toSimulate_elapsedSinceLastLoop;
+        // Wait until the next frame should start
+        // (this happens before the time and input are read so that they are as recent as possible when the frame is submitted)
+        {
+            m_framePacer.SetIsInBackground(IsInBackground());
+            m_framePacer.SetTickCountOfMostRecentBufferSwap(Graphics::GetTickCountOfMostRecentBufferSwap());
+            m_framePacer.WaitUntilNextFrame();
+        }
+        // Wait until the frame that the next one replaces has finished
+        // (this thread runs the stages of the frames that are in flight while it waits)
+        const auto frameIndex = m_framePipeline.WaitUntilNextFrameCanStart();
+        auto& frameData = m_frameData[frameIndex % cFramePipeline::maxFrameCountInFlight];
+        // Calculate how much time has elapsed since the last frame
         {
             // Update the current system time
-            // and use that to calculate how much time has elapsed since the last loop
+            // and use that to calculate how much time has elapsed since the last frame
             {
-                const auto tickCount_systemTime_previousLoop = m_tickCount_systemTime_current;
+                const auto tickCount_systemTime_previousFrame = m_tickCount_systemTime_current;
                 m_tickCount_systemTime_current = Time::GetCurrentSystemTimeTickCount();
-                tickCount_systemTime_elapsedSinceLastLoop = m_tickCount_systemTime_current - tickCount_systemTime_previousLoop;
+                auto tickCount_systemTime_elapsedSinceLastFrame = m_tickCount_systemTime_current - tickCount_systemTime_previousFrame;
                 // Only consider the allowable amount of elapsed system time
-                tickCount_systemTime_elapsedSinceLastLoop =
-                    std::min(tickCount_systemTime_elapsedSinceLastLoop, tickCount_systemTime_maxAllowablePerIteration);
-                tickCount_systemTime_elapsedAllowable += tickCount_systemTime_elapsedSinceLastLoop;
+                tickCount_systemTime_elapsedSinceLastFrame =
+                    std::min(tickCount_systemTime_elapsedSinceLastFrame, tickCount_systemTime_maxAllowablePerIteration);
+                tickCount_systemTime_elapsedAllowable += tickCount_systemTime_elapsedSinceLastFrame;
+                frameData.tickCount_systemTime_elapsedSinceLastFrame = tickCount_systemTime_elapsedSinceLastFrame;
+                frameData.tickCount_systemTime_elapsedAllowable = tickCount_systemTime_elapsedAllowable;
             }
             // Calculate the simulation time that has elapsed based on the simulation rate
-            tickCount_toSimulate_elapsedSinceLastLoop =
-                static_cast<uint64_t>(tickCount_systemTime_elapsedSinceLastLoop * static_cast<double>(m_simulationRate));
-        }
-        // Update any application state that isn't part of the simulation
-        {
-            UpdateBasedOnTime(static_cast<float>(Time::ConvertTicksToSeconds(tickCount_systemTime_elapsedSinceLastLoop)));
-            UpdateBasedOnInput();
-        }
-        // Update the simulation
-        {
-            // Add the time elapsed since the last frame to the amount of simulation time that has not been simulated yet
-            tickCount_simulationTime_elapsedButNotYetSimulated += tickCount_toSimulate_elapsedSinceLastLoop;
-            // Keep updating the simulation while more time has elapsed than the fixed amount used for a single update
-            // (note that the expected common behavior is to render faster than the simulation is updated,
-            // and so the amount of simulation updates per-iteration should most often be zero, should frequently be one,
-            // and should not be more than one unless something unexpected happens that causes a single iteration to take longer than expected)
-            unsigned int simulationUpdateCount_thisIteration = 0;
-            while ((tickCount_simulationTime_elapsedButNotYetSimulated >= tickCount_perSimulationUpdate)
-                // Regardless of how far the simulation is behind
-                // frames need to be rendered (and operating system messages handled)
-                // or the application will stop responding
-                && (simulationUpdateCount_thisIteration < maxSimulationUpdateCountWithoutRendering))
-            {
-                UpdateSimulationBasedOnTime(secondCount_perSimulationUpdate);
-                ++simulationUpdateCount_thisIteration;
-                m_tickCount_simulationTime_totalElapsed += tickCount_perSimulationUpdate;
-                tickCount_simulationTime_elapsedButNotYetSimulated -= tickCount_perSimulationUpdate;
-            }
-            // If a time-based simulation update happened
-            // then update simulation state based on input.
-            // This happens _after_ the elapsed time has been consumed,
-            // because rendering has already happened with predicted extrapolation based on time that had already passed.
-            // If simulation state were changed _before_ then it would invalidate frames that had already been rendered
-            // (so, for example, something that had moved in a previous frame would suddenly reset to a different position).
-            if (simulationUpdateCount_thisIteration > 0)
-            {
-                UpdateSimulationBasedOnInput();
-            }
+            frameData.tickCount_toSimulate_elapsedSinceLastFrame =
+                static_cast<uint64_t>(frameData.tickCount_systemTime_elapsedSinceLastFrame * static_cast<double>(m_simulationRate));
+        }
+        // Start the frame's stages
+        // (they are updated and submitted as jobs, and this thread goes on to the next frame without waiting for them)
+        m_framePipeline.StartNextFrame();
+        // The frame can't be submitted until the render thread is ready to accept new submitted data.
+        // This thread waits for that instead of the submission stage
+        // so that a job worker isn't blocked by the operating system while the frame's other stages could run
+        frameData.canBeSubmitted = WaitUntilFrameCanBeSubmitted();
+        m_framePipeline.SignalStage(frameIndex, m_frameStageId_submit);
+    }
+    // The application can't exit while any of its frames are still in flight
+    m_framePipeline.WaitForAllFrames();
+}
+
+void eae6320::Application::cbApplication::UpdateFrame(const uint64_t i_frameIndex)
+{
+    auto& frameData = m_frameData[i_frameIndex % cFramePipeline::maxFrameCountInFlight];
+    // Each update of the simulation is done with a fixed amount of time
+    const auto secondCount_perSimulationUpdate = GetSimulationUpdatePeriodInSeconds();
+    const auto tickCount_perSimulationUpdate = Time::ConvertSecondsToTicks(secondCount_perSimulationUpdate);
+    // It is important to keep rendering (and handling operating system messages)
+    // or the application will become unresponsive,
+    // and so even if the simulation is behind there is a maximum number of updates
+    // that will happen in a single frame before it is rendered
+    constexpr unsigned int maxSimulationUpdateCountWithoutRendering = 5;
+
+    // Update any application state that isn't part of the simulation
+    {
+        UpdateBasedOnTime(static_cast<float>(Time::ConvertTicksToSeconds(frameData.tickCount_systemTime_elapsedSinceLastFrame)));
+        UpdateBasedOnInput();
+    }
+    // Update the simulation
+    {
+        // Add the time elapsed since the last frame to the amount of simulation time that has not been simulated yet
+        m_tickCount_simulationTime_elapsedButNotYetSimulated += frameData.tickCount_toSimulate_elapsedSinceLastFrame;
+        // Keep updating the simulation while more time has elapsed than the fixed amount used for a single update
+        // (note that the expected common behavior is to render faster than the simulation is updated,
+        // and so the amount of simulation updates per-frame should most often be zero, should frequently be one,
+        // and should not be more than one unless something unexpected happens that causes a single frame to take longer than expected)
+        unsigned int simulationUpdateCount_thisFrame = 0;
+        while ((m_tickCount_simulationTime_elapsedButNotYetSimulated >= tickCount_perSimulationUpdate)
+            // Regardless of how far the simulation is behind
+            // frames need to be rendered (and operating system messages handled)
+            // or the application will stop responding
+            && (simulationUpdateCount_thisFrame < maxSimulationUpdateCountWithoutRendering))
+        {
+            UpdateSimulationBasedOnTime(secondCount_perSimulationUpdate);
+            ++simulationUpdateCount_thisFrame;
+            m_tickCount_simulationTime_totalElapsed += tickCount_perSimulationUpdate;
+            m_tickCount_simulationTime_elapsedButNotYetSimulated -= tickCount_perSimulationUpdate;
         }
-        // Submit data for the render thread to use to render a new frame
-        // after it has finished rendering the current frame with the previously-submitted data
+        // If a time-based simulation update happened
+        // then update simulation state based on input.
+        // This happens _after_ the elapsed time has been consumed,
+        // because rendering has already happened with predicted extrapolation based on time that had already passed.
+        // If simulation state were changed _before_ then it would invalidate frames that had already been rendered
+        // (so, for example, something that had moved in a previous frame would suddenly reset to a different position).
+        if (simulationUpdateCount_thisFrame > 0)
         {
-            // Wait until the render thread is ready to accept new submitted data
-            {
-                // Conceptually the wait is infinite
-                // but practically this doesn't work because the render thread could decide that the application should exit
-                // as a result of an operating system message.
-                // Instead there is a loop of waits
-                // so that there can be a period check of whether the application is supposed to exit.
-                cResult canGraphicsDataBeSubmittedForANewFrame;
-                do
-                {
-                    // The wait is long in terms of rendering
-                    // but short enough that any delay in exiting will (hopefully) not be noticeable to a human
-                    constexpr unsigned int timeToWait_inMilliseconds = 1000 / 4;
-                    canGraphicsDataBeSubmittedForANewFrame = Graphics::WaitUntilDataForANewFrameCanBeSubmitted(timeToWait_inMilliseconds);
-                } while ((canGraphicsDataBeSubmittedForANewFrame == Results::timeOut) && !m_shouldApplicationLoopExit);
-                // If graphics data can't be submitted for a new frame the application will exit
-                if (!canGraphicsDataBeSubmittedForANewFrame)
-                {
-                    if (m_shouldApplicationLoopExit)
-                    {
-                        // In this case graphics data can't be submitted because the application is supposed to exit,
-                        // and the application is behaving normally
-                    }
-                    else
-                    {
-                        // In this case the wait failed for an unexpected reason (i.e. something other than a timeout)
-                        EAE6320_ASSERT(false);
-                        Logging::OutputError("Failed to wait for graphics data for a new frame to be submittable");
-                        UserOutput::Print("Something unexpected went wrong and rendering can't continue (the application will now exit)");
-                    }
-                    return;
-                }
-            }
-            // Submit the data to be rendered
+            UpdateSimulationBasedOnInput();
+        }
+    }
+    // Update the tick groups
+    // (each one has its own rate and keeps track of its own time that has elapsed but hasn't been ticked yet)
+    m_tickScheduler.Tick(frameData.tickCount_systemTime_elapsedSinceLastFrame, frameData.tickCount_toSimulate_elapsedSinceLastFrame);
+    // Keep the times that the frame will be submitted with
+    // (the next frame's update could change them before this frame is submitted)
+    frameData.tickCount_simulationTime_elapsedButNotYetSimulated = m_tickCount_simulationTime_elapsedButNotYetSimulated;
+    frameData.tickCount_simulationTime_toRender = m_tickCount_simulationTime_totalElapsed + m_tickCount_simulationTime_elapsedButNotYetSimulated;
+}
+
+bool eae6320::Application::cbApplication::WaitUntilFrameCanBeSubmitted()
+{
+    // Conceptually the wait is infinite
+    // but practically this doesn't work because the render thread could decide that the application should exit
+    // as a result of an operating system message.
+    // Instead there is a loop of waits
+    // so that there can be a period check of whether the application is supposed to exit.
+    cResult canGraphicsDataBeSubmittedForANewFrame;
+    do
+    {
+        // The wait is long in terms of rendering
+        // but short enough that any delay in exiting will (hopefully) not be noticeable to a human
+        constexpr unsigned int timeToWait_inMilliseconds = 1000 / 4;
+        canGraphicsDataBeSubmittedForANewFrame = Graphics::WaitUntilDataForANewFrameCanBeSubmitted(timeToWait_inMilliseconds);
+    } while ((canGraphicsDataBeSubmittedForANewFrame == Results::timeOut) && !m_shouldApplicationLoopExit);
+    // If graphics data can't be submitted for a new frame the application will exit
+    if (!canGraphicsDataBeSubmittedForANewFrame)
+    {
+        if (m_shouldApplicationLoopExit)
+        {
+            // In this case graphics data can't be submitted because the application is supposed to exit,
+            // and the application is behaving normally
+        }
+        else
+        {
+            // In this case the wait failed for an unexpected reason (i.e. something other than a timeout)
+            EAE6320_ASSERT(false);
+            Logging::OutputError("Failed to wait for graphics data for a new frame to be submittable");
+            UserOutput::Print("Something unexpected went wrong and rendering can't continue (the application will now exit)");
+            m_shouldApplicationLoopExit = true;
+        }
+        return false;
+    }
+    return true;
+}
+
+void eae6320::Application::cbApplication::SubmitFrame(const uint64_t i_frameIndex)
+{
+    const auto& frameData = m_frameData[i_frameIndex % cFramePipeline::maxFrameCountInFlight];
+    // The application loop thread has already waited until the render thread is ready to accept new submitted data
+    // (if it can't the application is exiting and the frame isn't submitted)
+    if (!frameData.canBeSubmitted)
+    {
+        return;
+    }
+    m_frameIndex_beingSubmitted = i_frameIndex;
+    // Submit data for the render thread to use to render a new frame
+    // after it has finished rendering the current frame with the previously-submitted data
+    {
+        // Submit the data to be rendered
+        {
+            // Submit the application-specific data
+            const auto elapsedSecondCount_systemTime = static_cast<float>(Time::ConvertTicksToSeconds(frameData.tickCount_systemTime_elapsedAllowable));
             {
-                // Submit the application-specific data
-                const auto elapsedSecondCount_systemTime = static_cast<float>(Time::ConvertTicksToSeconds(tickCount_systemTime_elapsedAllowable));
-                {
-                    SubmitDataToBeRendered(elapsedSecondCount_systemTime,
-                        static_cast<float>(Time::ConvertTicksToSeconds(tickCount_simulationTime_elapsedButNotYetSimulated)));
-                }
-                // Submit the elapsed times
-                {
-                    float elapsedSecondCount_simulationTime;
-                    {
-                        const auto tickCount_simulationTime_toRender = m_tickCount_simulationTime_totalElapsed + tickCount_simulationTime_elapsedButNotYetSimulated;
-                        elapsedSecondCount_simulationTime = static_cast<float>(Time::ConvertTicksToSeconds(tickCount_simulationTime_toRender));
-                    }
-                    Graphics::SubmitElapsedTime(elapsedSecondCount_systemTime, elapsedSecondCount_simulationTime);
-                }
+                SubmitDataToBeRendered(elapsedSecondCount_systemTime,
+                    static_cast<float>(Time::ConvertTicksToSeconds(frameData.tickCount_simulationTime_elapsedButNotYetSimulated)));
             }
-            // Let the graphics system know that all of the data for this frame has been submitted
-            // (which means that it can start using it to render)
+            // Submit the elapsed times
             {
-                const auto result = Graphics::SignalThatAllDataForAFrameHasBeenSubmitted();
-                EAE6320_ASSERT(result);
+                const auto elapsedSecondCount_simulationTime = static_cast<float>(Time::ConvertTicksToSeconds(frameData.tickCount_simulationTime_toRender));
+                Graphics::SubmitElapsedTime(elapsedSecondCount_systemTime, elapsedSecondCount_simulationTime);
             }
         }
+        // Let the graphics system know that all of the data for this frame has been submitted
+        // (which means that it can start using it to render)
+        if (!Graphics::SignalThatAllDataForAFrameHasBeenSubmitted())
+        {
+            EAE6320_ASSERT(false);
+        }
     }
 }
 
+void eae6320::Application::cbApplication::EntryPointUpdateFrameStage(void* const io_application, const uint64_t i_frameIndex)
+{
+    auto *const application = static_cast<cbApplication*>(io_application);
+    EAE6320_ASSERT(application);
+    application->UpdateFrame(i_frameIndex);
+}
+
+void eae6320::Application::cbApplication::EntryPointSubmitFrameStage(void* const io_application, const uint64_t i_frameIndex)
+{
+    auto *const application = static_cast<cbApplication*>(io_application);
+    EAE6320_ASSERT(application);
+    application->SubmitFrame(i_frameIndex);
+}
+
 void eae6320::Application::cbApplication::EntryPointApplicationLoopThread(void* const io_application)
 {
     auto *const application = static_cast<cbApplication*>(io_application);
     EAE6320_ASSERT(application);
+    // The application loop thread runs most of the jobs and waits for them,
+    // and so it gets its own job deque
+    if (!Concurrency::Jobs::RegisterCurrentThread())
+    {
+        EAE6320_ASSERTF(false, "The application loop thread couldn't be registered with the job system");
+    }
     return application->UpdateUntilExit();
 }
 
@@ -282,18 +348,50 @@ eae6320::cResult eae6320::Application::cbApplication::InitializeAll(const sEntry
         EAE6320_ASSERT(false);
         goto OnExit;
     }
+    // Configure the frame pacer
+    // (the graphics system needs to know whether frames are aligned with vertical blanks)
+    if (!((result = InitializeFramePacer())))
+    {
+        EAE6320_ASSERT(false);
+        goto OnExit;
+    }
     // Initialize engine systems
     if (!((result = InitializeEngine())))
     {
         EAE6320_ASSERT(false);
         goto OnExit;
     }
+    // Add the frame stages that the derived application can add its own stages around
+    if (!((result = InitializeFramePipeline())))
+    {
+        EAE6320_ASSERT(false);
+        goto OnExit;
+    }
     // Initialize the derived application
     if (!((result = Initialize())))
     {
         EAE6320_ASSERT(false);
         goto OnExit;
     }
+    // Add the frame stages that depend on the derived application's stages
+    if (!((result = FinishInitializingFramePipeline())))
+    {
+        EAE6320_ASSERT(false);
+        goto OnExit;
+    }
+    // Run the benchmarks before the application loop starts so that nothing else is competing for the CPU
+    // (a benchmark failure is reported in the log but doesn't prevent the application from running)
+    {
+        auto shouldRunBenchmarks = false;
+        if (UserSettings::GetShouldRunBenchmarks(shouldRunBenchmarks) && shouldRunBenchmarks)
+        {
+            Benchmark::RunMathBenchmarks();
+            Benchmark::RunBroadphaseBenchmarks();
+            Benchmark::RunSpatialIndexBenchmarks();
+            Benchmark::RunSimulationBenchmarks();
+            Benchmark::RunJobSystemBenchmarks();
+        }
+    }
 
     // Start the application loop thread
     if (!((result = m_applicationLoopThread.Start(EntryPointApplicationLoopThread, this))))
@@ -312,6 +410,17 @@ eae6320::cResult eae6320::Application::cbApplication::InitializeEngine() const
 {
     cResult result;
 
+    // Jobs
+    {
+        // The render thread and the application loop thread both already use a logical processor
+        const auto logicalProcessorCount = std::thread::hardware_concurrency();
+        const auto workerThreadCount = (logicalProcessorCount > 2) ? (logicalProcessorCount - 2) : 1;
+        if (!((result = Concurrency::Jobs::Initialize(workerThreadCount))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
     // User Output
     {
         UserOutput::sInitializationParameters initializationParameters;
@@ -334,6 +443,7 @@ eae6320::cResult eae6320::Application::cbApplication::InitializeEngine() const
         Graphics::sInitializationParameters initializationParameters;
         if ((result = PopulateGraphicsInitializationParameters(initializationParameters)))
         {
+            initializationParameters.shouldWaitForVerticalBlank = m_framePacer.GetMode() == Time::cFramePacer::VerticalBlankAligned;
             if (!((result = Graphics::Initialize(initializationParameters))))
             {
                 EAE6320_ASSERT(false);
@@ -352,6 +462,115 @@ OnExit:
     return result;
 }
 
+eae6320::cResult eae6320::Application::cbApplication::InitializeFramePacer()
+{
+    cResult result;
+
+    if (!((result = m_framePacer.Initialize())))
+    {
+        EAE6320_ASSERT(false);
+        goto OnExit;
+    }
+    // Frame Rates
+    {
+        uint16_t targetFrameRate = 0;
+        UserSettings::GetTargetFrameRate(targetFrameRate);
+        if (!((result = m_framePacer.SetTargetFrameRate(targetFrameRate))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+        uint16_t backgroundFrameRate = 0;
+        UserSettings::GetBackgroundFrameRate(backgroundFrameRate);
+        if (!((result = m_framePacer.SetBackgroundFrameRate(backgroundFrameRate))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
+    // Vertical Blanks
+    {
+        auto shouldAlignFramesWithVerticalBlanks = false;
+        if (UserSettings::GetShouldAlignFramesWithVerticalBlanks(shouldAlignFramesWithVerticalBlanks) && shouldAlignFramesWithVerticalBlanks)
+        {
+            // If the refresh rate can't be found the frames are still paced at the target frame rate
+            double refreshRate_perSecond;
+            if (GetDisplayRefreshRate(refreshRate_perSecond))
+            {
+                if (!((result = m_framePacer.AlignWithVerticalBlanks(refreshRate_perSecond))))
+                {
+                    EAE6320_ASSERT(false);
+                    goto OnExit;
+                }
+                Logging::OutputMessage("Frames will be aligned with the vertical blanks of a %.2f Hz display", refreshRate_perSecond);
+            }
+            else
+            {
+                Logging::OutputMessage("Frames can't be aligned with vertical blanks because the display's refresh rate couldn't be found");
+            }
+        }
+    }
+
+OnExit:
+
+    return result;
+}
+
+eae6320::cResult eae6320::Application::cbApplication::InitializeFramePipeline()
+{
+    // The update stage runs the application's updates, its simulation, and its tick groups
+    cFramePipeline::sStageDescription description;
+    description.name = "Update";
+    description.stageFunction = EntryPointUpdateFrameStage;
+    description.userData = this;
+    return m_framePipeline.AddStage(description, m_frameStageId_update);
+}
+
+eae6320::cResult eae6320::Application::cbApplication::FinishInitializingFramePipeline()
+{
+    cResult result;
+
+    // The submission stage is the last stage of every frame,
+    // and so it depends on every other stage (including the ones that the derived application added)
+    {
+        cFramePipeline::sStageDescription description;
+        description.name = "Submit";
+        description.stageFunction = EntryPointSubmitFrameStage;
+        description.userData = this;
+        // The application loop thread signals the stage once the render thread is ready for the frame's data
+        description.waitsForSignal = true;
+        {
+            const auto stageCount = m_framePipeline.GetStageCount();
+            description.stagesToFinishFirst = (stageCount < cFramePipeline::maxStageCount) ?
+                (cFramePipeline::GetStageBit(static_cast<tFrameStageId>(stageCount)) - 1) : ~0u;
+        }
+        if (!((result = m_framePipeline.AddStage(description, m_frameStageId_submit))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
+    // Unless the derived application says otherwise
+    // the next frame isn't updated until the current frame has been submitted
+    // (the render thread still renders the previous frame while the next one is being updated)
+    if (!CanUpdateOverlapPreviousSubmission())
+    {
+        if (!((result = m_framePipeline.AddDependencyOnPreviousFrame(m_frameStageId_update, m_frameStageId_submit))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
+    else
+    {
+        Logging::OutputMessage("The next frame will be updated while the current frame is being submitted");
+    }
+
+OnExit:
+
+    return result;
+}
+
 eae6320::cResult eae6320::Application::cbApplication::CleanUpAll()
 {
     auto result = Results::success;
@@ -378,6 +597,45 @@ eae6320::cResult eae6320::Application::cbApplication::CleanUpAll()
             }
         }
     }
+    // Clean up the frame pacer
+    // (this is after the application loop has exited so that its statistics include every frame)
+    {
+        const auto localResult = m_framePacer.CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    // Clean up the frame pipeline
+    // (every frame has already finished, and so this only logs how long each stage took)
+    {
+        const auto localResult = m_framePipeline.CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    // Clean up the tick scheduler
+    // (this is before the derived application is cleaned up because tick groups can refer to its data)
+    {
+        const auto localResult = m_tickScheduler.CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
     // Clean up the derived application
     {
         const auto localResult = CleanUp();
@@ -470,6 +728,18 @@ eae6320::cResult eae6320::Application::cbApplication::CleanUpEngine()
             }
         }
     }
+    // Jobs
+    {
+        const auto localResult = Concurrency::Jobs::CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
 
     return result;
 }
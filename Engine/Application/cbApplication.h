@@ -14,6 +14,10 @@
 #include <cstdint>
 #include <Engine/Concurrency/cThread.h>
 #include <Engine/Results/Results.h>
+#include <Engine/Time/cFramePacer.h>
+
+#include "cFramePipeline.h"
+#include "cTickScheduler.h"
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
 #include <Engine/Windows/Includes.h>
@@ -48,6 +52,8 @@ namespace eae6320
         int Run(
 #if defined( EAE6320_PLATFORM_WINDOWS )
             const HINSTANCE i_thisInstanceOfTheApplication, const char* const i_commandLineArguments, const int i_initialWindowDisplayState
+#elif defined( EAE6320_PLATFORM_LINUX )
+            const int i_argumentCount, char** const i_arguments
 #endif
         )
         {
@@ -57,6 +63,8 @@ namespace eae6320
             {
 #if defined( EAE6320_PLATFORM_WINDOWS )
                 i_thisInstanceOfTheApplication, i_commandLineArguments, i_initialWindowDisplayState
+#elif defined( EAE6320_PLATFORM_LINUX )
+                i_argumentCount, i_arguments
 #endif
             };
             // Create an instance of the applciation
@@ -85,6 +93,11 @@ namespace eae6320
                 // The requested initial state of the window
                 // (e.g. minimized, maximized, etc.)
                 const int initialWindowDisplayState = SW_SHOWNORMAL;
+#elif defined( EAE6320_PLATFORM_LINUX )
+                // The arguments in the command to start the program
+                // (the first is the name of the program)
+                const int argumentCount = 0;
+                char** const arguments = nullptr;
 #endif
             };
 
@@ -94,6 +107,20 @@ namespace eae6320
             cResult GetCurrentResolution(uint16_t& o_width, uint16_t& o_height) const;
             void SetSimulationRate(const float i_simulationRate);
             uint64_t GetCurrentSystemTime()const { return m_tickCount_systemTime_current; }
+            // A derived application can add tick groups during its initialization
+            // to update systems at their own rates independently of the simulation update
+            cTickScheduler& GetTickScheduler() { return m_tickScheduler; }
+            const cTickScheduler& GetTickScheduler() const { return m_tickScheduler; }
+            // A derived application can add frame stages during its initialization
+            // (e.g. to prepare what will be rendered in parallel with other work).
+            // A stage that needs the simulation to have been updated should depend on the update stage,
+            // and the submission stage (which is added after the derived application has been initialized)
+            // depends on every stage that was added before it
+            cFramePipeline& GetFramePipeline() { return m_framePipeline; }
+            tFrameStageId GetUpdateFrameStageId() const { return m_frameStageId_update; }
+            // This is the index of the frame whose data is being submitted
+            // (SubmitDataToBeRendered() can use it to find data that one of the application's stages prepared for the frame)
+            uint64_t GetIndexOfFrameBeingSubmitted() const { return m_frameIndex_beingSubmitted; }
 
             // Run
             //------
@@ -137,6 +164,15 @@ namespace eae6320
             // and observe the change in responsiveness or simulation accuracy.
             virtual float GetSimulationUpdatePeriodInSeconds() const { return 1.0f / 15.0f; }
 
+            // Every frame is updated and then submitted to be rendered in separate stages of the frame pipeline.
+            // By default the next frame isn't updated until the current frame has been submitted,
+            // because SubmitDataToBeRendered() usually reads (and often writes) the same data that the updates write.
+            // An application whose submission doesn't touch anything that its updates do
+            // (e.g. because a stage of its own copies what will be rendered for each frame in flight;
+            // see GetIndexOfFrameBeingSubmitted())
+            // can return true so that the next frame is updated while the current frame is submitted.
+            virtual bool CanUpdateOverlapPreviousSubmission() const { return false; }
+
             // Run
             //----
 
@@ -227,6 +263,36 @@ namespace eae6320
             // The application loop thread checks this variable every iteration
             // so that it knows if the main thread requires it to exit
             bool m_shouldApplicationLoopExit = false;
+            // The application loop waits for this at the start of every iteration
+            // so that it doesn't run more frames than are needed
+            // (it is configured by the user settings)
+            Time::cFramePacer m_framePacer;
+            // Tick groups are ticked every frame (in the update stage) after the simulation has been updated
+            cTickScheduler m_tickScheduler;
+            // Every iteration of the application loop starts a frame in the pipeline,
+            // and the frame's stages run as jobs
+            // (the application loop thread helps run them while it waits for a frame to be able to start)
+            cFramePipeline m_framePipeline;
+            tFrameStageId m_frameStageId_update = 0;
+            tFrameStageId m_frameStageId_submit = 0;
+            uint64_t m_frameIndex_beingSubmitted = 0;
+            // The time data that is kept for each frame that is in flight
+            struct sFrameData
+            {
+                // These are calculated when the frame starts
+                uint64_t tickCount_systemTime_elapsedSinceLastFrame = 0;
+                uint64_t tickCount_toSimulate_elapsedSinceLastFrame = 0;
+                uint64_t tickCount_systemTime_elapsedAllowable = 0;
+                // These are calculated when the frame is updated and used when it is submitted
+                uint64_t tickCount_simulationTime_elapsedButNotYetSimulated = 0;
+                uint64_t tickCount_simulationTime_toRender = 0;
+                // This is set by the application loop thread once the render thread is ready for the frame's data
+                bool canBeSubmitted = false;
+            };
+            sFrameData m_frameData[cFramePipeline::maxFrameCountInFlight];
+            // Since a single update of the simulation only uses a fixed amount of time
+            // there will be "leftover" time (time that has passed but has not been used)
+            uint64_t m_tickCount_simulationTime_elapsedButNotYetSimulated = 0;
 
             // Implementation
             //===============
@@ -246,14 +312,33 @@ namespace eae6320
             void UpdateUntilExit();
             static void EntryPointApplicationLoopThread(void* const io_application);
 
+            // The stages of every frame
+            // (these are run as jobs by the frame pipeline)
+            void UpdateFrame(const uint64_t i_frameIndex);
+            void SubmitFrame(const uint64_t i_frameIndex);
+            // This is called from the application loop thread before a frame's submission stage can start.
+            // It returns false if graphics data can't be submitted (i.e. if the application is exiting)
+            bool WaitUntilFrameCanBeSubmitted();
+            static void EntryPointUpdateFrameStage(void* const io_application, const uint64_t i_frameIndex);
+            static void EntryPointSubmitFrameStage(void* const io_application, const uint64_t i_frameIndex);
+
             cResult ExitPlatformSpecific(const int i_exitCode);
 
+            // The frame rate is lowered while the application is in the background
+            // (e.g. when its window is minimized or doesn't have focus)
+            bool IsInBackground() const;
+            // This fails if the refresh rate can't be found (e.g. if there is no display)
+            cResult GetDisplayRefreshRate(double& o_refreshRate_perSecond) const;
+
             // Initialization / Clean Up
             //--------------------------
 
             cResult InitializeAll(const sEntryPointParameters& i_entryPointParameters);    // This initializes everything
             cResult InitializeBase(const sEntryPointParameters& i_entryPointParameters);    // This initializes just this base class
             cResult InitializeEngine() const;    // This initializes all of the engine systems
+            cResult InitializeFramePacer();    // This configures the frame pacer from the user settings
+            cResult InitializeFramePipeline();    // This adds the frame stages that the derived application's stages can depend on
+            cResult FinishInitializingFramePipeline();    // This adds the frame stages that depend on the derived application's stages
 
             cResult PopulateGraphicsInitializationParameters(Graphics::sInitializationParameters& o_initializationParameters) const;
             cResult PopulateUserOutputInitializationParameters(UserOutput::sInitializationParameters& o_initializationParameters) const;
@@ -265,6 +350,8 @@ namespace eae6320
             // #include the platform-specific class declarations
 #if defined( EAE6320_PLATFORM_WINDOWS )
 #include "Windows/cbApplication.win.h"
+#elif defined( EAE6320_PLATFORM_LINUX )
+#include "Linux/cbApplication.linux.h"
 #endif
         };
     }
@@ -0,0 +1,26 @@
+// Include Files
+//==============
+
+#include "../Asserts.h"
+
+#ifdef EAE6320_ASSERTS_ARE_ENABLED
+    #include <cstdio>
+#endif
+
+// Helper Function Definitions
+//============================
+
+#ifdef EAE6320_ASSERTS_ARE_ENABLED
+
+bool eae6320::Asserts::ShowMessageIfAssertionIsFalseAndReturnWhetherToBreakPlatformSpecific(
+    std::ostringstream& io_message, bool& io_shouldThisAssertBeIgnoredInTheFuture )
+{
+    // There is no message box to ask the user what to do,
+    // and so the message is printed and the program always breaks
+    // (which stops it if there isn't a debugger attached)
+    std::fprintf( stderr, "Assertion Failed! %s\n", io_message.str().c_str() );
+    std::fflush( stderr );
+    return true;
+}
+
+#endif    // EAE6320_ASSERTS_ARE_ENABLED
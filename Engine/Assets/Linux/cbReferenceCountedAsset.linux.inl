@@ -0,0 +1,41 @@
+#ifndef EAE6320_ASSETS_CBREFERENCECOUNTEDASSET_LINUX_INL
+#define EAE6320_ASSETS_CBREFERENCECOUNTEDASSET_LINUX_INL
+
+// Include Files
+//==============
+
+// #include "../cbReferenceCountedAsset.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Reference Counting
+//-------------------
+
+template <class tAsset>
+	inline void eae6320::Assets::cbReferenceCountedAsset<tAsset>::IncrementReferenceCount()
+{
+	EAE6320_ASSERT( m_referenceCount > 0 );
+	// Incrementing doesn't need to be ordered with anything else,
+	// it only needs to be atomic
+	__atomic_add_fetch( &m_referenceCount, 1, __ATOMIC_RELAXED );
+}
+
+template <class tAsset>
+	inline void eae6320::Assets::cbReferenceCountedAsset<tAsset>::DecrementReferenceCount()
+{
+	EAE6320_ASSERT( m_referenceCount > 0 );
+	// The returned decremented reference count will only be zero in exactly one thread
+	// (which means that the reference-counted asset will only be deleted once),
+	// and acquiring makes the other threads' writes to the asset visible before it is deleted
+	const auto newReferenceCount = __atomic_sub_fetch( &m_referenceCount, 1, __ATOMIC_ACQ_REL );
+	// If no more references are being held to this asset it is deleted
+	if ( newReferenceCount == 0 )
+	{
+		delete static_cast<tAsset*>( this );
+	}
+}
+
+#endif	// EAE6320_ASSETS_CBREFERENCECOUNTEDASSET_LINUX_INL
@@ -59,6 +59,26 @@ anywhere in the class.
             return newReferenceCount;    \
         }
 
+#elif defined( EAE6320_PLATFORM_LINUX )
+
+// The GCC/Clang atomic built-ins give the same guarantees as the "interlocked" functions above;
+// the decrement acquires and releases so that the thread that deletes the asset
+// sees every write that other threads made before they released their references
+
+#define EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS()    \
+        void IncrementReferenceCount()    \
+        {    \
+            EAE6320_ASSERT( ( m_referenceCount > 0 ) && ( m_referenceCount < std::numeric_limits<decltype( m_referenceCount )>::max() ) );    \
+            __atomic_add_fetch( &m_referenceCount, 1, __ATOMIC_RELAXED );    \
+        }    \
+        uint16_t DecrementReferenceCount()    \
+        {    \
+            EAE6320_ASSERT( m_referenceCount > 0 );    \
+            const auto newReferenceCount = __atomic_sub_fetch( &m_referenceCount, 1, __ATOMIC_ACQ_REL );    \
+            if ( newReferenceCount == 0 ) delete this;    \
+            return newReferenceCount;    \
+        }
+
 #else
 #error "No implementation exists for reference counting on this platform"
 #endif
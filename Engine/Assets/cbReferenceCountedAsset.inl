@@ -28,6 +28,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
 	#include "Windows/cbReferenceCountedAsset.win.inl"
+#elif defined( EAE6320_PLATFORM_LINUX )
+	#include "Linux/cbReferenceCountedAsset.linux.inl"
 #endif
 
 #endif	// EAE6320_ASSETS_CBREFERENCECOUNTEDASSET_INL
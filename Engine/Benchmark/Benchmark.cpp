@@ -0,0 +1,2438 @@
+// Include Files
+//==============
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Graphics/Skinning.h>
+#include <Engine/Graphics/VertexFormats.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/Functions.h>
+#include <Engine/Math/Half.h>
+#include <Engine/Math/QuaternionBatch.h>
+#include <Engine/Math/Simd.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Math/sVector4.h>
+#include <Engine/Math/TangentFrame.h>
+#include <Engine/Math/TransformBatch.h>
+#include <Engine/Physics/cDynamicAabbTree.h>
+#include <Engine/Physics/cSpatialHashGrid.h>
+#include <Engine/Physics/cSweepAndPrune.h>
+#include <Engine/Physics/cWorld.h>
+#include <Engine/Physics/Narrowphase.h>
+#include <Engine/Physics/sAabb.h>
+#include <Engine/Physics/sRigidBodyState.h>
+#include <Engine/Physics/sShape.h>
+#include <Engine/Time/Time.h>
+#include <Engine/Transform/sTransform.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // Every benchmark is timed for each of these element counts
+    // (the biggest one doesn't fit in the cache of most CPUs)
+    constexpr size_t s_elementCounts[] = { 64, 4096, 65536 };
+    // A small element count is repeated until at least this many elements have been calculated in each run
+    // so that the run takes much longer than the resolution of the timer
+    constexpr size_t s_minimumElementCountPerRun = 65536;
+    // Each benchmark is run this many times after a warm-up run and the fastest run is reported
+    // (the fastest run is the one that was disturbed the least by other threads and processes)
+    constexpr unsigned int s_runCount = 5;
+
+    // The accuracy checks use this many random inputs
+    constexpr size_t s_accuracySampleCount = 4096;
+
+    // A result of every run is added to this so that the optimizer can't remove the work being timed
+    volatile float s_sink = 0.0f;
+
+    // The broadphases are timed for each of these numbers of moving bodies
+    constexpr size_t s_broadphaseBodyCounts[] = { 1000, 10000, 50000, 200000 };
+    // Checking every pair of bodies is only timed for this many bodies
+    // (it is too slow for any of the bigger counts)
+    constexpr size_t s_maxBodyCountToTimeEveryPair = 1000;
+    // The broadphases are compared with every pair of bodies for this many bodies
+    // and compared with each other for bigger counts
+    constexpr size_t s_maxBodyCountToCheckEveryPair = 10000;
+    // The boxes are at most 1.5 units across, and so they all fit in cells this big
+    constexpr float s_spatialHashGridCellSize = 2.0f;
+
+    // The spatial index queries are timed for each of these numbers of objects
+    constexpr size_t s_spatialIndexObjectCounts[] = { 10000, 100000, 1000000 };
+    // Each kind of query is timed with this many different shapes
+    constexpr size_t s_spatialQueryCount = 256;
+    // A single query takes much longer than building or updating a single object,
+    // and so the queries are only repeated this many times in each run
+    // (otherwise the biggest scenes would take minutes to time)
+    constexpr size_t s_maxSpatialQueryRepetitionCount = 4;
+    // This many of the queries of each kind are compared with checking every object
+    constexpr size_t s_spatialQueryCountToCheck = 16;
+    // Checking every object is only timed for this many objects
+    constexpr size_t s_maxObjectCountToTimeEveryObject = 10000;
+    // The sizes of the query shapes
+    constexpr float s_spatialQueryHalfSize = 4.0f;
+    constexpr float s_spatialQueryRayLength = 32.0f;
+    constexpr float s_spatialQueryFarPlane = 32.0f;
+
+    // The contact checks use the same shape types in the same order as Physics::ShapeTypes
+    constexpr const char* s_contactShapeNames[] = { "sphere", "capsule", "box", "convex hull" };
+    constexpr size_t s_contactShapeCount = sizeof( s_contactShapeNames ) / sizeof( s_contactShapeNames[0] );
+    // Shapes that are touching are checked both when they overlap and when there is a small gap between them
+    // (which must still be within the margin)
+    constexpr float s_contactDepth = 0.01f;
+    constexpr float s_contactMargin = 0.02f;
+    constexpr float s_contactTolerance = 1.0e-3f;
+    // The bodies are simulated with the same period as the game's simulation updates
+    // for long enough to come to rest
+    constexpr float s_simulationSecondCountPerUpdate = 1.0f / 60.0f;
+    constexpr size_t s_restingUpdateCount = 300;
+    // A resting body must end up this close to where it should rest and be moving slower than this
+    constexpr float s_maxRestingDistance = 0.05f;
+    constexpr float s_maxRestingSpeed = 0.05f;
+    // The stack alternates between boxes and convex hulls
+    constexpr size_t s_stackBodyCount = 6;
+    // cWorld::Update() is timed with this many dynamic bodies for each broadphase
+    constexpr size_t s_worldBodyCount = 100000;
+
+    // The job system benchmarks are timed for each of these element counts
+    constexpr size_t s_jobElementCounts[] = { 4096, 65536, 1048576 };
+    // Each job of a parallel-for works on this many elements
+    constexpr size_t s_elementCountPerJob = 1024;
+    // The cost of running a job is measured by running this many empty jobs at once
+    constexpr size_t s_emptyJobCount = 4096;
+    // Each job of the fiber chain waits for the next one,
+    // and so this many jobs are parked on fibers at once
+    constexpr size_t s_fiberChainLength = 64;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // Input Data
+    //-----------
+
+    // The same seed is always used so that every run measures the same inputs
+    struct sInputs
+    {
+        std::vector<eae6320::Math::cMatrixTransformation> transforms_lhs, transforms_rhs;
+        std::vector<eae6320::Math::cQuaternion> orientations_lhs, orientations_rhs;
+        std::vector<eae6320::Math::sVector> positions, axes;
+        std::vector<float> angles;
+
+        // Constructs inputs for the biggest element count
+        sInputs( const size_t i_count );
+    };
+
+    std::mt19937& GetRandomNumberGenerator();
+    float GetRandomFloat( const float i_minimum, const float i_maximum );
+    eae6320::Math::sVector GetRandomDirection();
+    eae6320::Math::cQuaternion GetRandomOrientation();
+
+    // Timing
+    //-------
+
+    // Returns the seconds per element of the fastest run
+    // (the function is repeated until enough elements have been calculated, but never more than the maximum number of times)
+    template <typename tFunction>
+    double MeasureSecondsPerElement( const size_t i_elementCount, const tFunction& i_function,
+        const size_t i_maxRepetitionCount = std::numeric_limits<size_t>::max() );
+    void OutputTiming( const char* const i_name, const size_t i_elementCount, const double i_secondsPerElement );
+
+    void RunTimings( const sInputs& i_inputs, const size_t i_elementCount );
+
+    // Accuracy
+    //---------
+
+    // Keeps track of the worst error of many results
+    struct sError
+    {
+        double maxUlpCount = 0.0;
+
+        // The ULP is that of a float with the given magnitude
+        void Add( const float i_value, const double i_reference, const double i_magnitude );
+    };
+
+    // An error is output if the tolerance is exceeded
+    bool OutputAccuracy( const char* const i_name, const sError& i_error, const double i_toleranceInUlps );
+
+    // Counts the results that aren't bit-identical to their references
+    // (for results that must be exact rather than just within a tolerance)
+    struct sMismatches
+    {
+        size_t mismatchCount = 0;
+        size_t resultCount = 0;
+
+        // If NaNs are equivalent then any NaN matches any other NaN
+        // (otherwise their bits must also be identical)
+        void Add( const float* const i_values, const float* const i_references, const size_t i_count, const bool i_areNaNsEquivalent = false );
+        void Add( const uint16_t* const i_values, const uint16_t* const i_references, const size_t i_count );
+    };
+
+    // An error is output if any result was different
+    bool OutputExactness( const char* const i_name, const sMismatches& i_mismatches );
+
+    // Double-precision versions of the quaternion functions
+    struct sQuaternion_double
+    {
+        double w, x, y, z;
+
+        sQuaternion_double( const double i_w, const double i_x, const double i_y, const double i_z );
+        sQuaternion_double( const eae6320::Math::sQuaternionArrays& i_quaternions, const size_t i_index );
+    };
+    sQuaternion_double Multiply( const sQuaternion_double& i_lhs, const sQuaternion_double& i_rhs );
+    sQuaternion_double Normalize( const sQuaternion_double& i_quaternion );
+    sQuaternion_double Nlerp( const sQuaternion_double& i_from, const sQuaternion_double& i_to, const double i_t );
+    sQuaternion_double Slerp( const sQuaternion_double& i_from, const sQuaternion_double& i_to, const double i_t );
+    sQuaternion_double MakeFromAxisAngle( const double i_angleInRadians, const eae6320::Math::sVector& i_axis );
+    void AddErrors( const sQuaternion_double& i_reference, const eae6320::Math::sQuaternionArrays& i_results, const size_t i_index,
+        sError& io_error );
+
+    const float( &GetElements( const eae6320::Math::cMatrixTransformation& i_transform ) )[16];
+
+    // These calculate the exact results of the half conversions from the definition of the format
+    // (rather than by manipulating bits like the conversions do)
+    float MakeFloatFromHalf_reference( const uint16_t i_half );
+    // A float is truncated to the closest half whose magnitude isn't bigger,
+    // except that floats whose magnitude is bigger than the biggest half become infinity
+    float TruncateToHalf_reference( const float i_value );
+
+    bool CheckAccuracy( const sInputs& i_inputs );
+
+    // SIMD Exactness
+    //---------------
+
+    // These do the same operations in the same order as the scalar implementations of cMatrixTransformation
+    // (the results are stored in the same column-major order as GetElements())
+    void Multiply_scalar( const float( &i_lhs )[16], const float( &i_rhs )[16], float( &o_result )[16] );
+    void Multiply_scalar( const float( &i_lhs )[16], const eae6320::Math::sVector& i_rhs, float( &o_result )[3] );
+    void Multiply_scalar( const float( &i_lhs )[16], const eae6320::Math::sVector4& i_rhs, float( &o_result )[4] );
+    void ConcatenateAffine_scalar( const float( &i_nextTransform )[16], const float( &i_firstTransform )[16], float( &o_result )[16] );
+
+    // The batch functions are compared with calculating one element at a time
+    // (which always uses the code for the elements that are left over at the end of a SIMD register),
+    // and the batch quaternion functions that don't approximate anything are also compared with cQuaternion.
+    // CPU skinning is compared with Graphics::Skinning::SkinVertices_reference()
+    bool CheckSimdExactness( const sInputs& i_inputs );
+
+    // Broadphase
+    //-----------
+
+    // Boxes that move around inside of a cube and bounce off of its sides.
+    // The cube gets bigger with the number of boxes so that each box overlaps about the same number of others
+    struct sMovingBoxes
+    {
+        std::vector<eae6320::Math::sVector> centers, velocities, extents;
+        std::vector<eae6320::Physics::cbBroadphase::tProxyId> proxyIds;
+        eae6320::Physics::sAabbArrays bounds;
+        float halfSize;
+
+        sMovingBoxes( const size_t i_count );
+        void Move( const float i_secondCount );
+    };
+
+    // The reference that the broadphases are checked against
+    void FindEveryOverlappingPair( const eae6320::Physics::sAabbArrays& i_bounds,
+        std::vector<eae6320::Physics::cbBroadphase::sOverlappingPair>& o_pairs );
+
+    // Returns whether both broadphases found the same pairs
+    bool RunBroadphaseBenchmark( const size_t i_bodyCount );
+
+    // Spatial Index
+    //--------------
+
+    // Random shapes inside of the same cube as the boxes
+    struct sSpatialQueries
+    {
+        std::vector<eae6320::Physics::sAabb> boxes;
+        std::vector<eae6320::Math::sVector> sphereCenters;
+        std::vector<eae6320::Math::sVector> rayOrigins, rayDirections;
+        std::vector<eae6320::Math::cMatrixTransformation> transforms_worldToProjected;
+
+        sSpatialQueries( const float i_halfSize );
+    };
+
+    // Returns whether the spatial index found the same objects as checking every object
+    bool RunSpatialIndexBenchmark( const size_t i_objectCount );
+
+    // Simulation
+    //-----------
+
+    // Every shape is 1 unit tall when it is upright
+    // so that bodies can be placed on top of each other without knowing their shapes
+    struct sContactShapes
+    {
+        // The corners of a hexagonal prism
+        eae6320::Math::sVector hullPoints[12];
+        eae6320::Physics::sShape shapes[s_contactShapeCount];
+
+        sContactShapes();
+        // The convex hull references the points, and so the shapes can't be copied
+        sContactShapes( const sContactShapes& ) = delete;
+        sContactShapes& operator =( const sContactShapes& ) = delete;
+    };
+
+    // Returns whether every pair of shapes that touch has contacts with the right normal and depth
+    // (two flat faces must have four contacts and anything else must have one)
+    bool CheckContacts( const sContactShapes& i_shapes );
+    // Returns whether a dynamic body of every shape that falls onto a static body of every shape comes to rest on top of it
+    bool CheckRestingContacts( const sContactShapes& i_shapes );
+    // Returns whether a stack of dynamic bodies stays standing
+    bool CheckStack( const sContactShapes& i_shapes );
+    // Returns whether the worlds of every broadphase simulated exactly the same thing
+    bool RunWorldUpdateBenchmark( const sContactShapes& i_shapes );
+    // Returns whether a body is close to where it should rest and has stopped moving
+    // (an error is output if it isn't)
+    bool IsAtRest( const eae6320::Physics::cWorld& i_world, const eae6320::Physics::cWorld::tBodyId i_bodyId,
+        const eae6320::Math::sVector& i_restingPosition, float& o_distance );
+
+    // Job System
+    //-----------
+
+    // Returns whether the serial and parallel results were the same
+    bool RunParallelForBenchmark( const sInputs& i_inputs, const size_t i_elementCount );
+    // Returns whether every job ran after the jobs that it depended on
+    bool CheckJobDependencies();
+    // Returns whether every job of a chain of fibers got the result of the job that it waited for
+    bool RunFiberChainBenchmark();
+    struct sFiberChainLink
+    {
+        size_t remainingLength;
+        uint64_t sum;
+    };
+    void FiberChainJob( void* const io_link );
+    void EmptyJob( void* const io_userData );
+    void OutputSpeedUp( const char* const i_name, const size_t i_elementCount,
+        const double i_secondsPerElement_serial, const double i_secondsPerElement_parallel );
+}
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Benchmark::RunMathBenchmarks()
+{
+    Logging::OutputMessage( "Running the math benchmarks" );
+
+    const sInputs inputs( std::max( *std::max_element( std::begin( s_elementCounts ), std::end( s_elementCounts ) ),
+        s_accuracySampleCount ) );
+
+    for ( const auto elementCount : s_elementCounts )
+    {
+        RunTimings( inputs, elementCount );
+    }
+
+    const auto areAllWithinTolerance = CheckAccuracy( inputs );
+    const auto areAllIdenticalToScalar = CheckSimdExactness( inputs );
+    if ( areAllWithinTolerance && areAllIdenticalToScalar )
+    {
+        Logging::OutputMessage( "The math benchmarks finished and every result was within its tolerance and identical to the scalar results" );
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError( "The math benchmarks finished but some results weren't within their tolerance or identical to the scalar results" );
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Benchmark::RunBroadphaseBenchmarks()
+{
+    Logging::OutputMessage( "Running the broadphase benchmarks" );
+
+    auto areAllCorrect = true;
+    for ( const auto bodyCount : s_broadphaseBodyCounts )
+    {
+        areAllCorrect = RunBroadphaseBenchmark( bodyCount ) && areAllCorrect;
+    }
+
+    if ( areAllCorrect )
+    {
+        Logging::OutputMessage( "The broadphase benchmarks finished and every broadphase found the correct pairs" );
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError( "The broadphase benchmarks finished but some broadphases didn't find the correct pairs" );
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Benchmark::RunSpatialIndexBenchmarks()
+{
+    Logging::OutputMessage( "Running the spatial index benchmarks" );
+
+    auto areAllCorrect = true;
+    for ( const auto objectCount : s_spatialIndexObjectCounts )
+    {
+        areAllCorrect = RunSpatialIndexBenchmark( objectCount ) && areAllCorrect;
+    }
+
+    if ( areAllCorrect )
+    {
+        Logging::OutputMessage( "The spatial index benchmarks finished and every query found the correct objects" );
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError( "The spatial index benchmarks finished but some queries didn't find the correct objects" );
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Benchmark::RunSimulationBenchmarks()
+{
+    Logging::OutputMessage( "Running the simulation benchmarks" );
+
+    const sContactShapes shapes;
+    auto areAllCorrect = CheckContacts( shapes );
+    areAllCorrect = CheckRestingContacts( shapes ) && areAllCorrect;
+    areAllCorrect = CheckStack( shapes ) && areAllCorrect;
+    areAllCorrect = RunWorldUpdateBenchmark( shapes ) && areAllCorrect;
+
+    if ( areAllCorrect )
+    {
+        Logging::OutputMessage( "The simulation benchmarks finished and every body came to rest where it should"
+            " and every broadphase simulated the same thing" );
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError( "The simulation benchmarks finished but some contacts were wrong, some bodies didn't come to rest,"
+            " or some broadphases simulated something different" );
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Benchmark::RunJobSystemBenchmarks()
+{
+    Logging::OutputMessage( "Running the job system benchmarks with %u threads", Concurrency::Jobs::GetThreadCount() );
+
+    // The cost of running a job
+    {
+        OutputTiming( "Running an empty job", s_emptyJobCount, MeasureSecondsPerElement( s_emptyJobCount, []()
+        {
+            Concurrency::Jobs::cCounter counter;
+            for ( size_t i = 0; i < s_emptyJobCount; ++i )
+            {
+                Concurrency::Jobs::Run( EmptyJob, nullptr, &counter );
+            }
+            Concurrency::Jobs::WaitForCounter( counter );
+        } ) );
+    }
+
+    const sInputs inputs( *std::max_element( std::begin( s_jobElementCounts ), std::end( s_jobElementCounts ) ) );
+    auto areAllCorrect = true;
+    for ( const auto elementCount : s_jobElementCounts )
+    {
+        areAllCorrect = RunParallelForBenchmark( inputs, elementCount ) && areAllCorrect;
+    }
+    areAllCorrect = CheckJobDependencies() && areAllCorrect;
+    areAllCorrect = RunFiberChainBenchmark() && areAllCorrect;
+
+    if ( areAllCorrect )
+    {
+        Logging::OutputMessage( "The job system benchmarks finished and the parallel results matched the serial ones" );
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError( "The job system benchmarks finished but some parallel results didn't match the serial ones" );
+        return Results::Failure;
+    }
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    // Input Data
+    //-----------
+
+    sInputs::sInputs( const size_t i_count )
+    {
+        transforms_lhs.reserve( i_count );
+        transforms_rhs.reserve( i_count );
+        orientations_lhs.reserve( i_count );
+        orientations_rhs.reserve( i_count );
+        positions.reserve( i_count );
+        axes.reserve( i_count );
+        angles.reserve( i_count );
+        for ( size_t i = 0; i < i_count; ++i )
+        {
+            const eae6320::Math::sVector translation_lhs(
+                GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ) );
+            const eae6320::Math::sVector translation_rhs(
+                GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ) );
+            orientations_lhs.push_back( GetRandomOrientation() );
+            orientations_rhs.push_back( GetRandomOrientation() );
+            transforms_lhs.emplace_back( orientations_lhs.back(), translation_lhs );
+            transforms_rhs.emplace_back( orientations_rhs.back(), translation_rhs );
+            positions.emplace_back( GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ), GetRandomFloat( -100.0f, 100.0f ) );
+            axes.push_back( GetRandomDirection() );
+            angles.push_back( GetRandomFloat( -6.2831853f, 6.2831853f ) );
+        }
+    }
+
+    std::mt19937& GetRandomNumberGenerator()
+    {
+        static std::mt19937 randomNumberGenerator( 6320 );
+        return randomNumberGenerator;
+    }
+
+    float GetRandomFloat( const float i_minimum, const float i_maximum )
+    {
+        return std::uniform_real_distribution<float>( i_minimum, i_maximum )( GetRandomNumberGenerator() );
+    }
+
+    eae6320::Math::sVector GetRandomDirection()
+    {
+        // Points are chosen inside of a cube until one is inside of the unit sphere
+        // so that every direction is equally likely
+        while ( true )
+        {
+            const eae6320::Math::sVector point( GetRandomFloat( -1.0f, 1.0f ), GetRandomFloat( -1.0f, 1.0f ), GetRandomFloat( -1.0f, 1.0f ) );
+            const auto lengthSquared = Dot( point, point );
+            if ( ( lengthSquared > 1.0e-4f ) && ( lengthSquared <= 1.0f ) )
+            {
+                return point.GetNormalized();
+            }
+        }
+    }
+
+    eae6320::Math::cQuaternion GetRandomOrientation()
+    {
+        return eae6320::Math::cQuaternion( GetRandomFloat( -3.1415927f, 3.1415927f ), GetRandomDirection() );
+    }
+
+    // Timing
+    //-------
+
+    template <typename tFunction>
+    double MeasureSecondsPerElement( const size_t i_elementCount, const tFunction& i_function, const size_t i_maxRepetitionCount )
+    {
+        const auto repetitionCount = std::max<size_t>( std::min( s_minimumElementCountPerRun / i_elementCount, i_maxRepetitionCount ), 1 );
+        // The first run warms up the caches and isn't timed
+        i_function();
+        auto tickCount_fastest = std::numeric_limits<uint64_t>::max();
+        for ( unsigned int i = 0; i < s_runCount; ++i )
+        {
+            const auto tickCount_start = eae6320::Time::GetCurrentSystemTimeTickCount();
+            for ( size_t j = 0; j < repetitionCount; ++j )
+            {
+                i_function();
+            }
+            const auto tickCount_end = eae6320::Time::GetCurrentSystemTimeTickCount();
+            tickCount_fastest = std::min( tickCount_fastest, tickCount_end - tickCount_start );
+        }
+        return eae6320::Time::ConvertTicksToSeconds( tickCount_fastest ) / static_cast<double>( i_elementCount * repetitionCount );
+    }
+
+    void OutputTiming( const char* const i_name, const size_t i_elementCount, const double i_secondsPerElement )
+    {
+        eae6320::Logging::OutputMessage( "Benchmark: %-40s %7u elements: %9.2f ns/op %9.2f million ops/s",
+            i_name, static_cast<unsigned int>( i_elementCount ),
+            i_secondsPerElement * 1.0e9, ( i_secondsPerElement > 0.0 ) ? ( 1.0e-6 / i_secondsPerElement ) : 0.0 );
+    }
+
+    void RunTimings( const sInputs& i_inputs, const size_t i_elementCount )
+    {
+        EAE6320_ASSERT( i_elementCount <= i_inputs.positions.size() );
+
+        using namespace eae6320;
+
+        std::vector<Math::cMatrixTransformation> transforms( i_elementCount );
+        std::vector<Math::sVector> vectors( i_elementCount );
+        std::vector<Math::cQuaternion> orientations( i_elementCount );
+
+        // cMatrixTransformation
+        {
+            OutputTiming( "cMatrixTransformation * matrix", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    transforms[i] = i_inputs.transforms_lhs[i] * i_inputs.transforms_rhs[i];
+                }
+                s_sink = s_sink + transforms.back().GetTranslation().x;
+            } ) );
+            OutputTiming( "cMatrixTransformation::ConcatenateAffine", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    transforms[i] = Math::cMatrixTransformation::ConcatenateAffine( i_inputs.transforms_lhs[i], i_inputs.transforms_rhs[i] );
+                }
+                s_sink = s_sink + transforms.back().GetTranslation().x;
+            } ) );
+            OutputTiming( "cMatrixTransformation * sVector", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    vectors[i] = i_inputs.transforms_lhs[i] * i_inputs.positions[i];
+                }
+                s_sink = s_sink + vectors.back().x;
+            } ) );
+            OutputTiming( "CreateWorldToCameraTransform", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    transforms[i] = Math::cMatrixTransformation::CreateWorldToCameraTransform( i_inputs.transforms_lhs[i] );
+                }
+                s_sink = s_sink + transforms.back().GetTranslation().x;
+            } ) );
+        }
+        // cQuaternion
+        {
+            OutputTiming( "cQuaternion * quaternion", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    orientations[i] = i_inputs.orientations_lhs[i] * i_inputs.orientations_rhs[i];
+                }
+                s_sink = s_sink + Dot( orientations.back(), orientations.back() );
+            } ) );
+            OutputTiming( "cQuaternion::GetNormalized", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    orientations[i] = i_inputs.orientations_lhs[i].GetNormalized();
+                }
+                s_sink = s_sink + Dot( orientations.back(), orientations.back() );
+            } ) );
+            OutputTiming( "cQuaternion * sVector", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    vectors[i] = i_inputs.orientations_lhs[i] * i_inputs.positions[i];
+                }
+                s_sink = s_sink + vectors.back().x;
+            } ) );
+            OutputTiming( "cQuaternion( angle, axis )", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    orientations[i] = Math::cQuaternion( i_inputs.angles[i], i_inputs.axes[i] );
+                }
+                s_sink = s_sink + Dot( orientations.back(), orientations.back() );
+            } ) );
+            OutputTiming( "Slerp()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    orientations[i] = Slerp( i_inputs.orientations_lhs[i], i_inputs.orientations_rhs[i], 0.375f );
+                }
+                s_sink = s_sink + Dot( orientations.back(), orientations.back() );
+            } ) );
+        }
+        // Batches
+        {
+            Math::sTransformArrays transformArrays;
+            Math::sQuaternionArrays quaternions_lhs, quaternions_rhs, quaternions_results;
+            std::vector<float> axes_x, axes_y, axes_z;
+            transformArrays.Reserve( i_elementCount );
+            quaternions_lhs.Reserve( i_elementCount );
+            quaternions_rhs.Reserve( i_elementCount );
+            quaternions_results.Resize( i_elementCount );
+            for ( size_t i = 0; i < i_elementCount; ++i )
+            {
+                transformArrays.Append( i_inputs.positions[i], i_inputs.orientations_lhs[i] );
+                quaternions_lhs.Append( i_inputs.orientations_lhs[i] );
+                quaternions_rhs.Append( i_inputs.orientations_rhs[i] );
+                axes_x.push_back( i_inputs.axes[i].x );
+                axes_y.push_back( i_inputs.axes[i].y );
+                axes_z.push_back( i_inputs.axes[i].z );
+            }
+            std::vector<Math::cMatrixTransformation> transforms_localToProjected( i_elementCount );
+            const auto transform_worldToProjected =
+                Math::cMatrixTransformation::CreateCameraToProjectedTransformPerspective( 0.785398f, 1.0f, 0.1f, 1000.0f )
+                * Math::cMatrixTransformation::CreateWorldToCameraTransform( i_inputs.transforms_rhs[0] );
+
+            OutputTiming( "Batch CalculateTransforms()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Math::CalculateTransforms( transformArrays, 0, i_elementCount, transform_worldToProjected,
+                    transforms.data(), transforms_localToProjected.data(), sizeof( Math::cMatrixTransformation ) );
+                s_sink = s_sink + transforms_localToProjected.back().GetTranslation().x;
+            } ) );
+            OutputTiming( "Batch quaternion Multiply()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Math::Multiply( quaternions_lhs, quaternions_rhs, 0, i_elementCount, quaternions_results );
+                s_sink = s_sink + quaternions_results.w.back();
+            } ) );
+            OutputTiming( "Batch quaternion Normalize()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Math::Normalize( quaternions_results, 0, i_elementCount );
+                s_sink = s_sink + quaternions_results.w.back();
+            } ) );
+            OutputTiming( "Batch quaternion Slerp()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Math::Slerp( quaternions_lhs, quaternions_rhs, 0.375f, 0, i_elementCount, quaternions_results );
+                s_sink = s_sink + quaternions_results.w.back();
+            } ) );
+            OutputTiming( "Batch MakeFromAxisAngles()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Math::MakeFromAxisAngles( i_inputs.angles.data(), axes_x.data(), axes_y.data(), axes_z.data(),
+                    0, i_elementCount, quaternions_results );
+                s_sink = s_sink + quaternions_results.w.back();
+            } ) );
+        }
+        // Half
+        {
+            // Every element of a transform is converted
+            const auto floatCount = i_elementCount * 16;
+            const auto* const floats = &GetElements( i_inputs.transforms_lhs[0] )[0];
+            std::vector<uint16_t> halves( floatCount );
+            std::vector<float> floats_converted( floatCount );
+
+            OutputTiming( "MakeHalvesFromFloats()", floatCount, MeasureSecondsPerElement( floatCount, [&]()
+            {
+                Math::MakeHalvesFromFloats( floats, floatCount, halves.data() );
+                s_sink = s_sink + halves.back();
+            } ) );
+            OutputTiming( "MakeFloatsFromHalves()", floatCount, MeasureSecondsPerElement( floatCount, [&]()
+            {
+                Math::MakeFloatsFromHalves( halves.data(), floatCount, floats_converted.data() );
+                s_sink = s_sink + floats_converted.back();
+            } ) );
+        }
+        // Rigid Body Integration
+        {
+            std::vector<Transform::sTransform> rigidBodyTransforms;
+            std::vector<Physics::sRigidBodyState> rigidBodyStates( i_elementCount );
+            rigidBodyTransforms.reserve( i_elementCount );
+            for ( size_t i = 0; i < i_elementCount; ++i )
+            {
+                rigidBodyTransforms.emplace_back( i_inputs.positions[i], i_inputs.orientations_lhs[i] );
+                rigidBodyStates[i].velocity = i_inputs.axes[i] * 10.0f;
+                rigidBodyStates[i].angularVelocity_axis_local = i_inputs.axes[i];
+                rigidBodyStates[i].angularSpeed = i_inputs.angles[i];
+            }
+            constexpr auto secondCountToIntegrate = 1.0f / 60.0f;
+
+            OutputTiming( "sRigidBodyState::UpdatePosition()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    rigidBodyStates[i].UpdatePosition( secondCountToIntegrate, rigidBodyTransforms[i] );
+                }
+                s_sink = s_sink + rigidBodyTransforms.back().position.x;
+            } ) );
+            OutputTiming( "sRigidBodyState::UpdateOrientation()", i_elementCount, MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                for ( size_t i = 0; i < i_elementCount; ++i )
+                {
+                    rigidBodyStates[i].UpdateOrientation( secondCountToIntegrate, rigidBodyTransforms[i] );
+                }
+                s_sink = s_sink + rigidBodyTransforms.back().localAxes.forward.x;
+            } ) );
+        }
+    }
+
+    // Accuracy
+    //---------
+
+    void sError::Add( const float i_value, const double i_reference, const double i_magnitude )
+    {
+        int exponent;
+        std::frexp( std::max( std::abs( i_magnitude ), static_cast<double>( FLT_MIN ) ), &exponent );
+        // A float has 24 bits of precision, and frexp() returns a fraction in [0.5, 1)
+        const auto ulp = std::ldexp( 1.0, exponent - 24 );
+        auto ulpCount = std::abs( static_cast<double>( i_value ) - i_reference ) / ulp;
+        if ( std::isnan( ulpCount ) )
+        {
+            ulpCount = std::numeric_limits<double>::infinity();
+        }
+        maxUlpCount = std::max( maxUlpCount, ulpCount );
+    }
+
+    bool OutputAccuracy( const char* const i_name, const sError& i_error, const double i_toleranceInUlps )
+    {
+        if ( i_error.maxUlpCount <= i_toleranceInUlps )
+        {
+            eae6320::Logging::OutputMessage( "Accuracy: %-40s %9.2f ULPs (tolerance %.0f)",
+                i_name, i_error.maxUlpCount, i_toleranceInUlps );
+            return true;
+        }
+        else
+        {
+            EAE6320_ASSERTF( false, "The error of %s is bigger than its tolerance", i_name );
+            eae6320::Logging::OutputError( "Accuracy: %-40s %9.2f ULPs is bigger than the tolerance of %.0f",
+                i_name, i_error.maxUlpCount, i_toleranceInUlps );
+            return false;
+        }
+    }
+
+    void sMismatches::Add( const float* const i_values, const float* const i_references, const size_t i_count, const bool i_areNaNsEquivalent )
+    {
+        for ( size_t i = 0; i < i_count; ++i )
+        {
+            if ( i_areNaNsEquivalent && std::isnan( i_values[i] ) && std::isnan( i_references[i] ) )
+            {
+                continue;
+            }
+            // The bits are compared rather than the values so that e.g. -0 and +0 are different
+            if ( std::memcmp( &i_values[i], &i_references[i], sizeof( float ) ) != 0 )
+            {
+                ++mismatchCount;
+            }
+        }
+        resultCount += i_count;
+    }
+
+    void sMismatches::Add( const uint16_t* const i_values, const uint16_t* const i_references, const size_t i_count )
+    {
+        for ( size_t i = 0; i < i_count; ++i )
+        {
+            if ( i_values[i] != i_references[i] )
+            {
+                ++mismatchCount;
+            }
+        }
+        resultCount += i_count;
+    }
+
+    bool OutputExactness( const char* const i_name, const sMismatches& i_mismatches )
+    {
+        if ( i_mismatches.mismatchCount == 0 )
+        {
+            eae6320::Logging::OutputMessage( "Exactness: %-39s all %llu results are identical to their references",
+                i_name, static_cast<unsigned long long>( i_mismatches.resultCount ) );
+            return true;
+        }
+        else
+        {
+            EAE6320_ASSERTF( false, "The results of %s are different from their references", i_name );
+            eae6320::Logging::OutputError( "Exactness: %-39s %llu of %llu results are different from their references",
+                i_name, static_cast<unsigned long long>( i_mismatches.mismatchCount ),
+                static_cast<unsigned long long>( i_mismatches.resultCount ) );
+            return false;
+        }
+    }
+
+    sQuaternion_double::sQuaternion_double( const double i_w, const double i_x, const double i_y, const double i_z )
+        :
+        w( i_w ), x( i_x ), y( i_y ), z( i_z )
+    {
+
+    }
+
+    sQuaternion_double::sQuaternion_double( const eae6320::Math::sQuaternionArrays& i_quaternions, const size_t i_index )
+        :
+        w( i_quaternions.w[i_index] ), x( i_quaternions.x[i_index] ), y( i_quaternions.y[i_index] ), z( i_quaternions.z[i_index] )
+    {
+
+    }
+
+    sQuaternion_double Multiply( const sQuaternion_double& i_lhs, const sQuaternion_double& i_rhs )
+    {
+        return sQuaternion_double(
+            ( i_lhs.w * i_rhs.w ) - ( ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z ) ),
+            ( i_lhs.w * i_rhs.x ) + ( i_lhs.x * i_rhs.w ) + ( ( i_lhs.y * i_rhs.z ) - ( i_lhs.z * i_rhs.y ) ),
+            ( i_lhs.w * i_rhs.y ) + ( i_lhs.y * i_rhs.w ) + ( ( i_lhs.z * i_rhs.x ) - ( i_lhs.x * i_rhs.z ) ),
+            ( i_lhs.w * i_rhs.z ) + ( i_lhs.z * i_rhs.w ) + ( ( i_lhs.x * i_rhs.y ) - ( i_lhs.y * i_rhs.x ) ) );
+    }
+
+    sQuaternion_double Normalize( const sQuaternion_double& i_quaternion )
+    {
+        const auto length = std::sqrt( ( i_quaternion.w * i_quaternion.w ) + ( i_quaternion.x * i_quaternion.x )
+            + ( i_quaternion.y * i_quaternion.y ) + ( i_quaternion.z * i_quaternion.z ) );
+        return sQuaternion_double( i_quaternion.w / length, i_quaternion.x / length, i_quaternion.y / length, i_quaternion.z / length );
+    }
+
+    sQuaternion_double Nlerp( const sQuaternion_double& i_from, const sQuaternion_double& i_to, const double i_t )
+    {
+        const auto cosTheta = ( i_from.w * i_to.w ) + ( i_from.x * i_to.x ) + ( i_from.y * i_to.y ) + ( i_from.z * i_to.z );
+        const auto t_to = ( cosTheta < 0.0 ) ? -i_t : i_t;
+        const auto t_from = 1.0 - i_t;
+        return Normalize( sQuaternion_double(
+            ( i_from.w * t_from ) + ( i_to.w * t_to ), ( i_from.x * t_from ) + ( i_to.x * t_to ),
+            ( i_from.y * t_from ) + ( i_to.y * t_to ), ( i_from.z * t_from ) + ( i_to.z * t_to ) ) );
+    }
+
+    sQuaternion_double Slerp( const sQuaternion_double& i_from, const sQuaternion_double& i_to, const double i_t )
+    {
+        auto cosTheta = ( i_from.w * i_to.w ) + ( i_from.x * i_to.x ) + ( i_from.y * i_to.y ) + ( i_from.z * i_to.z );
+        const auto sign = ( cosTheta < 0.0 ) ? -1.0 : 1.0;
+        cosTheta = std::min( cosTheta * sign, 1.0 );
+        const auto theta = std::acos( cosTheta );
+        double t_from, t_to;
+        if ( theta > 1.0e-9 )
+        {
+            t_from = std::sin( ( 1.0 - i_t ) * theta ) / std::sin( theta );
+            t_to = std::sin( i_t * theta ) / std::sin( theta );
+        }
+        else
+        {
+            t_from = 1.0 - i_t;
+            t_to = i_t;
+        }
+        t_to *= sign;
+        return sQuaternion_double(
+            ( i_from.w * t_from ) + ( i_to.w * t_to ), ( i_from.x * t_from ) + ( i_to.x * t_to ),
+            ( i_from.y * t_from ) + ( i_to.y * t_to ), ( i_from.z * t_from ) + ( i_to.z * t_to ) );
+    }
+
+    sQuaternion_double MakeFromAxisAngle( const double i_angleInRadians, const eae6320::Math::sVector& i_axis )
+    {
+        const auto sin_theta_half = std::sin( i_angleInRadians * 0.5 );
+        return sQuaternion_double( std::cos( i_angleInRadians * 0.5 ),
+            i_axis.x * sin_theta_half, i_axis.y * sin_theta_half, i_axis.z * sin_theta_half );
+    }
+
+    void AddErrors( const sQuaternion_double& i_reference, const eae6320::Math::sQuaternionArrays& i_results, const size_t i_index,
+        sError& io_error )
+    {
+        // The quaternions are normalized, and so the error is measured relative to 1
+        io_error.Add( i_results.w[i_index], i_reference.w, 1.0 );
+        io_error.Add( i_results.x[i_index], i_reference.x, 1.0 );
+        io_error.Add( i_results.y[i_index], i_reference.y, 1.0 );
+        io_error.Add( i_results.z[i_index], i_reference.z, 1.0 );
+    }
+
+    const float( &GetElements( const eae6320::Math::cMatrixTransformation& i_transform ) )[16]
+    {
+        // cMatrixTransformation stores exactly 16 floats in column-major order
+        return reinterpret_cast<const float( & )[16]>( i_transform );
+    }
+
+    float MakeFloatFromHalf_reference( const uint16_t i_half )
+    {
+        const auto sign = ( i_half & 0x8000 ) != 0;
+        const auto exponent = ( i_half >> 10 ) & 0x1f;
+        const auto mantissa = i_half & 0x3ff;
+        if ( exponent == 0x1f )
+        {
+            // Infinities and NaNs keep their sign and mantissa bits
+            const auto bits = ( static_cast<uint32_t>( sign ) << 31 ) | 0x7f800000u | ( static_cast<uint32_t>( mantissa ) << 13 );
+            float value;
+            std::memcpy( &value, &bits, sizeof( value ) );
+            return value;
+        }
+        // A subnormal half is its mantissa times 2^-24,
+        // and a normal half has an implicit leading 1 and an exponent bias of 15
+        const auto magnitude = ( exponent == 0 ) ? std::ldexp( static_cast<double>( mantissa ), -24 )
+            : std::ldexp( static_cast<double>( mantissa | 0x400 ), exponent - 25 );
+        return static_cast<float>( sign ? -magnitude : magnitude );
+    }
+
+    float TruncateToHalf_reference( const float i_value )
+    {
+        if ( std::isnan( i_value ) )
+        {
+            return i_value;
+        }
+        constexpr auto biggestHalf = 65504.0;
+        const auto magnitude = std::abs( static_cast<double>( i_value ) );
+        if ( magnitude > biggestHalf )
+        {
+            return std::copysign( std::numeric_limits<float>::infinity(), i_value );
+        }
+        // A half has 11 bits of precision,
+        // except that its ULP never gets smaller than that of the smallest normal half (2^-24)
+        double ulp = std::ldexp( 1.0, -24 );
+        if ( magnitude >= std::ldexp( 1.0, -14 ) )
+        {
+            int exponent;
+            std::frexp( magnitude, &exponent );
+            ulp = std::ldexp( 1.0, exponent - 11 );
+        }
+        return static_cast<float>( std::copysign( std::floor( magnitude / ulp ) * ulp, static_cast<double>( i_value ) ) );
+    }
+
+    bool CheckAccuracy( const sInputs& i_inputs )
+    {
+        using namespace eae6320;
+
+        auto areAllWithinTolerance = true;
+        const auto sampleCount = s_accuracySampleCount;
+        EAE6320_ASSERT( sampleCount <= i_inputs.positions.size() );
+
+        // The quaternion results are stored in arrays so that the individual components can be compared
+        Math::sQuaternionArrays quaternions_lhs, quaternions_rhs, quaternions_results;
+        for ( size_t i = 0; i < sampleCount; ++i )
+        {
+            quaternions_lhs.Append( i_inputs.orientations_lhs[i] );
+            quaternions_rhs.Append( i_inputs.orientations_rhs[i] );
+        }
+        quaternions_results.Resize( sampleCount );
+
+        // cMatrixTransformation
+        {
+            sError error_multiplyMatrix, error_multiplyVector, error_worldToCamera;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                const auto& lhs = GetElements( i_inputs.transforms_lhs[i] );
+                const auto& rhs = GetElements( i_inputs.transforms_rhs[i] );
+                {
+                    const auto product = i_inputs.transforms_lhs[i] * i_inputs.transforms_rhs[i];
+                    const auto& result = GetElements( product );
+                    for ( size_t column = 0; column < 4; ++column )
+                    {
+                        for ( size_t row = 0; row < 4; ++row )
+                        {
+                            double reference = 0.0, magnitude = 0.0;
+                            for ( size_t k = 0; k < 4; ++k )
+                            {
+                                const auto term = static_cast<double>( lhs[( k * 4 ) + row] ) * rhs[( column * 4 ) + k];
+                                reference += term;
+                                magnitude += std::abs( term );
+                            }
+                            error_multiplyMatrix.Add( result[( column * 4 ) + row], reference, magnitude );
+                        }
+                    }
+                }
+                {
+                    const auto& position = i_inputs.positions[i];
+                    const auto result = i_inputs.transforms_lhs[i] * position;
+                    const float* const components[] = { &result.x, &result.y, &result.z };
+                    for ( size_t row = 0; row < 3; ++row )
+                    {
+                        const double terms[] = { static_cast<double>( lhs[row] ) * position.x,
+                            static_cast<double>( lhs[4 + row] ) * position.y, static_cast<double>( lhs[8 + row] ) * position.z,
+                            lhs[12 + row] };
+                        error_multiplyVector.Add( *components[row], terms[0] + terms[1] + terms[2] + terms[3],
+                            std::abs( terms[0] ) + std::abs( terms[1] ) + std::abs( terms[2] ) + std::abs( terms[3] ) );
+                    }
+                }
+                {
+                    // The inverse of a rotation is its transpose,
+                    // and the inverse translation is the negated translation rotated by the inverse
+                    const auto inverse = Math::cMatrixTransformation::CreateWorldToCameraTransform( i_inputs.transforms_lhs[i] );
+                    const auto& result = GetElements( inverse );
+                    for ( size_t column = 0; column < 3; ++column )
+                    {
+                        for ( size_t row = 0; row < 3; ++row )
+                        {
+                            error_worldToCamera.Add( result[( column * 4 ) + row], lhs[( row * 4 ) + column], 1.0 );
+                        }
+                        double reference = 0.0, magnitude = 0.0;
+                        for ( size_t k = 0; k < 3; ++k )
+                        {
+                            const auto term = static_cast<double>( lhs[12 + k] ) * lhs[( column * 4 ) + k];
+                            reference -= term;
+                            magnitude += std::abs( term );
+                        }
+                        error_worldToCamera.Add( result[12 + column], reference, magnitude );
+                    }
+                }
+            }
+            areAllWithinTolerance = OutputAccuracy( "cMatrixTransformation * matrix", error_multiplyMatrix, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "cMatrixTransformation * sVector", error_multiplyVector, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "CreateWorldToCameraTransform", error_worldToCamera, 2.0 ) && areAllWithinTolerance;
+        }
+        // cQuaternion
+        {
+            sError error_multiply, error_normalize, error_rotateVector, error_axisAngle, error_nlerp, error_slerp;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                const sQuaternion_double lhs( quaternions_lhs, i ), rhs( quaternions_rhs, i );
+                {
+                    quaternions_results.Set( i, i_inputs.orientations_lhs[i] * i_inputs.orientations_rhs[i] );
+                    AddErrors( Multiply( lhs, rhs ), quaternions_results, i, error_multiply );
+                }
+                {
+                    // The product isn't quite normalized, and so it is a good input to normalize
+                    const sQuaternion_double product( quaternions_results, i );
+                    quaternions_results.Set( i, quaternions_results.Get( i ).GetNormalized() );
+                    AddErrors( Normalize( product ), quaternions_results, i, error_normalize );
+                }
+                {
+                    const auto& vector = i_inputs.positions[i];
+                    const auto result = i_inputs.orientations_lhs[i] * vector;
+                    // v' = q * v * q^-1
+                    // (the float function assumes that the quaternion is normalized,
+                    // and so the tolerance includes the error of the random orientation's length)
+                    const auto rotated = Multiply( Multiply( lhs, sQuaternion_double( 0.0, vector.x, vector.y, vector.z ) ),
+                        sQuaternion_double( lhs.w, -lhs.x, -lhs.y, -lhs.z ) );
+                    const auto length = std::sqrt( static_cast<double>( Dot( vector, vector ) ) );
+                    error_rotateVector.Add( result.x, rotated.x, length );
+                    error_rotateVector.Add( result.y, rotated.y, length );
+                    error_rotateVector.Add( result.z, rotated.z, length );
+                }
+                {
+                    quaternions_results.Set( i, Math::cQuaternion( i_inputs.angles[i], i_inputs.axes[i] ) );
+                    AddErrors( MakeFromAxisAngle( i_inputs.angles[i], i_inputs.axes[i] ), quaternions_results, i, error_axisAngle );
+                }
+                {
+                    const auto t = static_cast<float>( i % 9 ) / 8.0f;
+                    quaternions_results.Set( i, Nlerp( i_inputs.orientations_lhs[i], i_inputs.orientations_rhs[i], t ) );
+                    AddErrors( Nlerp( lhs, rhs, t ), quaternions_results, i, error_nlerp );
+                }
+                {
+                    const auto t = static_cast<float>( i % 9 ) / 8.0f;
+                    quaternions_results.Set( i, Slerp( i_inputs.orientations_lhs[i], i_inputs.orientations_rhs[i], t ) );
+                    AddErrors( Slerp( lhs, rhs, t ), quaternions_results, i, error_slerp );
+                }
+            }
+            areAllWithinTolerance = OutputAccuracy( "cQuaternion * quaternion", error_multiply, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "cQuaternion::GetNormalized", error_normalize, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "cQuaternion * sVector", error_rotateVector, 8.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "cQuaternion( angle, axis )", error_axisAngle, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Nlerp()", error_nlerp, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Slerp()", error_slerp, 8.0 ) && areAllWithinTolerance;
+        }
+        // Batches
+        {
+            sError error_multiply, error_normalize, error_nlerp, error_slerp, error_axisAngle, error_axisAngle_big;
+            {
+                Math::Multiply( quaternions_lhs, quaternions_rhs, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( Multiply( sQuaternion_double( quaternions_lhs, i ), sQuaternion_double( quaternions_rhs, i ) ),
+                        quaternions_results, i, error_multiply );
+                }
+            }
+            {
+                // The products aren't quite normalized, and so they are good inputs to normalize
+                auto quaternions_normalized = quaternions_results;
+                Math::Normalize( quaternions_normalized, 0, sampleCount );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( Normalize( sQuaternion_double( quaternions_results, i ) ), quaternions_normalized, i, error_normalize );
+                }
+            }
+            {
+                constexpr auto t = 0.375f;
+                Math::Nlerp( quaternions_lhs, quaternions_rhs, t, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( Nlerp( sQuaternion_double( quaternions_lhs, i ), sQuaternion_double( quaternions_rhs, i ), t ),
+                        quaternions_results, i, error_nlerp );
+                }
+            }
+            {
+                constexpr auto t = 0.375f;
+                Math::Slerp( quaternions_lhs, quaternions_rhs, t, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( Slerp( sQuaternion_double( quaternions_lhs, i ), sQuaternion_double( quaternions_rhs, i ), t ),
+                        quaternions_results, i, error_slerp );
+                }
+            }
+            {
+                std::vector<float> axes_x, axes_y, axes_z;
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    axes_x.push_back( i_inputs.axes[i].x );
+                    axes_y.push_back( i_inputs.axes[i].y );
+                    axes_z.push_back( i_inputs.axes[i].z );
+                }
+                Math::MakeFromAxisAngles( i_inputs.angles.data(), axes_x.data(), axes_y.data(), axes_z.data(),
+                    0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( MakeFromAxisAngle( i_inputs.angles[i], i_inputs.axes[i] ), quaternions_results, i, error_axisAngle );
+                }
+                // The angles are also checked up to the few thousand radians that the batch function supports
+                // (reducing them to a single revolution is where the error of bigger angles comes from)
+                std::vector<float> angles_big( sampleCount );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    angles_big[i] = i_inputs.angles[i] * 320.0f;
+                }
+                Math::MakeFromAxisAngles( angles_big.data(), axes_x.data(), axes_y.data(), axes_z.data(),
+                    0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    AddErrors( MakeFromAxisAngle( angles_big[i], i_inputs.axes[i] ), quaternions_results, i, error_axisAngle_big );
+                }
+            }
+            areAllWithinTolerance = OutputAccuracy( "Batch quaternion Multiply()", error_multiply, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Batch quaternion Normalize()", error_normalize, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Batch quaternion Nlerp()", error_nlerp, 2.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Batch quaternion Slerp()", error_slerp, 8.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Batch MakeFromAxisAngles()", error_axisAngle, 4.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "Batch MakeFromAxisAngles() (big angles)", error_axisAngle_big, 4.0 ) && areAllWithinTolerance;
+        }
+        // Half
+        {
+            // Every half is converted to a float, and the floats are converted back
+            constexpr size_t halfCount = 0x10000;
+            std::vector<uint16_t> halves( halfCount ), halves_roundTrip( halfCount );
+            std::vector<float> floats_fromHalves( halfCount ), floats_reference( halfCount );
+            for ( size_t i = 0; i < halfCount; ++i )
+            {
+                halves[i] = static_cast<uint16_t>( i );
+                floats_fromHalves[i] = Math::MakeFloatFromHalf( halves[i] );
+                floats_reference[i] = MakeFloatFromHalf_reference( halves[i] );
+                halves_roundTrip[i] = Math::MakeHalfFromFloat( floats_fromHalves[i] );
+            }
+            // The floats that are converted to halves are the random samples,
+            // every half's value, and the float just inside of every half's value
+            // (which is the biggest float that must be truncated to the next half closer to zero).
+            // Every one of them must be truncated exactly
+            // (i.e. the error is always less than 1 ULP of a half and is always towards zero)
+            const auto* const floats_samples = &GetElements( i_inputs.transforms_lhs[0] )[0];
+            std::vector<float> floats( floats_samples, floats_samples + ( sampleCount * 16 ) );
+            for ( const auto value : floats_fromHalves )
+            {
+                floats.push_back( value );
+                if ( !std::isnan( value ) && ( value != 0.0f ) )
+                {
+                    floats.push_back( std::nextafter( value, 0.0f ) );
+                }
+            }
+            const auto floatCount = floats.size();
+            std::vector<uint16_t> halves_fromFloats( floatCount );
+            std::vector<float> floats_truncated( floatCount ), floats_truncated_reference( floatCount );
+            for ( size_t i = 0; i < floatCount; ++i )
+            {
+                halves_fromFloats[i] = Math::MakeHalfFromFloat( floats[i] );
+                floats_truncated[i] = Math::MakeFloatFromHalf( halves_fromFloats[i] );
+                floats_truncated_reference[i] = TruncateToHalf_reference( floats[i] );
+            }
+            // The array conversions must give exactly the same results as converting each value individually
+            // (except that a signaling NaN may become a quiet NaN; see Half.h)
+            std::vector<uint16_t> halves_array( floatCount );
+            std::vector<float> floats_array( halfCount );
+            Math::MakeHalvesFromFloats( floats.data(), floatCount, halves_array.data() );
+            Math::MakeFloatsFromHalves( halves.data(), halfCount, floats_array.data() );
+
+            sMismatches mismatches_toFloat, mismatches_roundTrip, mismatches_truncation, mismatches_array;
+            mismatches_toFloat.Add( floats_fromHalves.data(), floats_reference.data(), halfCount );
+            mismatches_roundTrip.Add( halves_roundTrip.data(), halves.data(), halfCount );
+            mismatches_truncation.Add( floats_truncated.data(), floats_truncated_reference.data(), floatCount, true );
+            mismatches_array.Add( halves_array.data(), halves_fromFloats.data(), floatCount );
+            mismatches_array.Add( floats_array.data(), floats_fromHalves.data(), halfCount, true );
+            areAllWithinTolerance = OutputExactness( "MakeFloatFromHalf() of every half", mismatches_toFloat ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputExactness( "Half round trip of every half", mismatches_roundTrip ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputExactness( "MakeHalfFromFloat() truncation", mismatches_truncation ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputExactness( "Half array conversion", mismatches_array ) && areAllWithinTolerance;
+        }
+        // Rigid Body Integration
+        {
+            // Integrating many steps shows how the error accumulates over time
+            constexpr auto stepCount = 60;
+            constexpr auto secondCountToIntegrate = 1.0f / 60.0f;
+            sError error_position, error_orientation;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                Transform::sTransform transform( i_inputs.positions[i], i_inputs.orientations_lhs[i] );
+                Physics::sRigidBodyState rigidBodyState;
+                rigidBodyState.velocity = i_inputs.axes[i] * 10.0f;
+                rigidBodyState.angularVelocity_axis_local = i_inputs.axes[i];
+                rigidBodyState.angularSpeed = i_inputs.angles[i];
+
+                const auto& position = i_inputs.positions[i];
+                double reference_position[] = { position.x, position.y, position.z };
+                auto reference_orientation = sQuaternion_double( quaternions_lhs, i );
+                const auto rotation = MakeFromAxisAngle(
+                    static_cast<double>( rigidBodyState.angularSpeed ) * secondCountToIntegrate, rigidBodyState.angularVelocity_axis_local );
+                for ( auto j = 0; j < stepCount; ++j )
+                {
+                    rigidBodyState.UpdatePosition( secondCountToIntegrate, transform );
+                    rigidBodyState.UpdateOrientation( secondCountToIntegrate, transform );
+                    reference_position[0] += static_cast<double>( rigidBodyState.velocity.x ) * secondCountToIntegrate;
+                    reference_position[1] += static_cast<double>( rigidBodyState.velocity.y ) * secondCountToIntegrate;
+                    reference_position[2] += static_cast<double>( rigidBodyState.velocity.z ) * secondCountToIntegrate;
+                    reference_orientation = Normalize( Multiply( reference_orientation, rotation ) );
+                }
+                const auto magnitude = std::abs( reference_position[0] ) + std::abs( reference_position[1] ) + std::abs( reference_position[2] );
+                error_position.Add( transform.position.x, reference_position[0], magnitude );
+                error_position.Add( transform.position.y, reference_position[1], magnitude );
+                error_position.Add( transform.position.z, reference_position[2], magnitude );
+                quaternions_results.Set( i, transform.orientation );
+                AddErrors( reference_orientation, quaternions_results, i, error_orientation );
+            }
+            areAllWithinTolerance = OutputAccuracy( "sRigidBodyState::UpdatePosition()", error_position, 64.0 ) && areAllWithinTolerance;
+            areAllWithinTolerance = OutputAccuracy( "sRigidBodyState::UpdateOrientation()", error_orientation, 64.0 ) && areAllWithinTolerance;
+        }
+
+        return areAllWithinTolerance;
+    }
+
+    // SIMD Exactness
+    //---------------
+
+    void Multiply_scalar( const float( &i_lhs )[16], const float( &i_rhs )[16], float( &o_result )[16] )
+    {
+        for ( size_t column = 0; column < 4; ++column )
+        {
+            const auto* const rhs = &i_rhs[column * 4];
+            for ( size_t row = 0; row < 4; ++row )
+            {
+                o_result[( column * 4 ) + row] = ( i_lhs[row] * rhs[0] ) + ( i_lhs[4 + row] * rhs[1] ) + ( i_lhs[8 + row] * rhs[2] )
+                    + ( i_lhs[12 + row] * rhs[3] );
+            }
+        }
+    }
+
+    void Multiply_scalar( const float( &i_lhs )[16], const eae6320::Math::sVector& i_rhs, float( &o_result )[3] )
+    {
+        for ( size_t row = 0; row < 3; ++row )
+        {
+            o_result[row] = ( i_lhs[row] * i_rhs.x ) + ( i_lhs[4 + row] * i_rhs.y ) + ( i_lhs[8 + row] * i_rhs.z ) + i_lhs[12 + row];
+        }
+    }
+
+    void Multiply_scalar( const float( &i_lhs )[16], const eae6320::Math::sVector4& i_rhs, float( &o_result )[4] )
+    {
+        for ( size_t row = 0; row < 4; ++row )
+        {
+            o_result[row] = ( i_lhs[row] * i_rhs.x ) + ( i_lhs[4 + row] * i_rhs.y ) + ( i_lhs[8 + row] * i_rhs.z )
+                + ( i_lhs[12 + row] * i_rhs.w );
+        }
+    }
+
+    void ConcatenateAffine_scalar( const float( &i_nextTransform )[16], const float( &i_firstTransform )[16], float( &o_result )[16] )
+    {
+        for ( size_t column = 0; column < 4; ++column )
+        {
+            const auto* const first = &i_firstTransform[column * 4];
+            for ( size_t row = 0; row < 3; ++row )
+            {
+                o_result[( column * 4 ) + row] = ( i_nextTransform[row] * first[0] ) + ( i_nextTransform[4 + row] * first[1] )
+                    + ( i_nextTransform[8 + row] * first[2] );
+            }
+            o_result[( column * 4 ) + 3] = 0.0f;
+        }
+        // The translation column also adds the next transform's translation
+        for ( size_t row = 0; row < 3; ++row )
+        {
+            o_result[12 + row] = o_result[12 + row] + i_nextTransform[12 + row];
+        }
+        o_result[15] = 1.0f;
+    }
+
+    bool CheckSimdExactness( const sInputs& i_inputs )
+    {
+        using namespace eae6320;
+
+#if defined( EAE6320_MATH_SIMD_SSE )
+        Logging::OutputMessage( "The math library was compiled with SSE, and its results are compared with the scalar code" );
+#elif defined( EAE6320_MATH_SIMD_NEON )
+        Logging::OutputMessage( "The math library was compiled with NEON, and its results are compared with the scalar code" );
+#else
+        Logging::OutputMessage( "The math library was compiled without SIMD, and its results are compared with the scalar code" );
+#endif
+
+        auto areAllIdentical = true;
+        const auto sampleCount = s_accuracySampleCount;
+        EAE6320_ASSERT( sampleCount <= i_inputs.positions.size() );
+
+        // cMatrixTransformation
+        {
+            sMismatches mismatches_multiplyMatrix, mismatches_multiplyVector, mismatches_multiplyVector4, mismatches_concatenateAffine;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                const auto& lhs = GetElements( i_inputs.transforms_lhs[i] );
+                const auto& rhs = GetElements( i_inputs.transforms_rhs[i] );
+                {
+                    float reference[16];
+                    Multiply_scalar( lhs, rhs, reference );
+                    mismatches_multiplyMatrix.Add( GetElements( i_inputs.transforms_lhs[i] * i_inputs.transforms_rhs[i] ), reference, 16 );
+                }
+                {
+                    const auto& position = i_inputs.positions[i];
+                    const auto result = i_inputs.transforms_lhs[i] * position;
+                    const float results[] = { result.x, result.y, result.z };
+                    float reference[3];
+                    Multiply_scalar( lhs, position, reference );
+                    mismatches_multiplyVector.Add( results, reference, 3 );
+                }
+                {
+                    const Math::sVector4 vector( i_inputs.axes[i], i_inputs.angles[i] );
+                    const auto result = i_inputs.transforms_lhs[i] * vector;
+                    float reference[4];
+                    Multiply_scalar( lhs, vector, reference );
+                    mismatches_multiplyVector4.Add( &result.x, reference, 4 );
+                }
+                {
+                    float reference[16];
+                    ConcatenateAffine_scalar( lhs, rhs, reference );
+                    mismatches_concatenateAffine.Add(
+                        GetElements( Math::cMatrixTransformation::ConcatenateAffine( i_inputs.transforms_lhs[i], i_inputs.transforms_rhs[i] ) ),
+                        reference, 16 );
+                }
+            }
+            areAllIdentical = OutputExactness( "cMatrixTransformation * matrix", mismatches_multiplyMatrix ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "cMatrixTransformation * sVector", mismatches_multiplyVector ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "cMatrixTransformation * sVector4", mismatches_multiplyVector4 ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "ConcatenateAffine()", mismatches_concatenateAffine ) && areAllIdentical;
+        }
+        // Batches
+        {
+            Math::sTransformArrays transformArrays;
+            Math::sQuaternionArrays quaternions_lhs, quaternions_rhs, quaternions_results, quaternions_results_scalar;
+            std::vector<float> axes_x, axes_y, axes_z;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                transformArrays.Append( i_inputs.positions[i], i_inputs.orientations_lhs[i] );
+                quaternions_lhs.Append( i_inputs.orientations_lhs[i] );
+                quaternions_rhs.Append( i_inputs.orientations_rhs[i] );
+                axes_x.push_back( i_inputs.axes[i].x );
+                axes_y.push_back( i_inputs.axes[i].y );
+                axes_z.push_back( i_inputs.axes[i].z );
+            }
+            quaternions_results.Resize( sampleCount );
+            quaternions_results_scalar.Resize( sampleCount );
+            const auto compareQuaternions = [&]( sMismatches& io_mismatches )
+            {
+                io_mismatches.Add( quaternions_results.w.data(), quaternions_results_scalar.w.data(), sampleCount );
+                io_mismatches.Add( quaternions_results.x.data(), quaternions_results_scalar.x.data(), sampleCount );
+                io_mismatches.Add( quaternions_results.y.data(), quaternions_results_scalar.y.data(), sampleCount );
+                io_mismatches.Add( quaternions_results.z.data(), quaternions_results_scalar.z.data(), sampleCount );
+            };
+
+            sMismatches mismatches_transforms, mismatches_multiply, mismatches_normalize, mismatches_nlerp, mismatches_slerp,
+                mismatches_axisAngle, mismatches_rotationTransforms;
+            {
+                const auto transform_worldToProjected =
+                    Math::cMatrixTransformation::CreateCameraToProjectedTransformPerspective( 0.785398f, 1.0f, 0.1f, 1000.0f )
+                    * Math::cMatrixTransformation::CreateWorldToCameraTransform( i_inputs.transforms_rhs[0] );
+                std::vector<Math::cMatrixTransformation> transforms_localToWorld( sampleCount ), transforms_localToProjected( sampleCount );
+                std::vector<Math::cMatrixTransformation> transforms_localToWorld_scalar( sampleCount ),
+                    transforms_localToProjected_scalar( sampleCount );
+                constexpr auto stride = sizeof( Math::cMatrixTransformation );
+                Math::CalculateTransforms( transformArrays, 0, sampleCount, transform_worldToProjected,
+                    transforms_localToWorld.data(), transforms_localToProjected.data(), stride );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::CalculateTransforms( transformArrays, i, 1, transform_worldToProjected,
+                        &transforms_localToWorld_scalar[i], &transforms_localToProjected_scalar[i], stride );
+                    mismatches_transforms.Add( GetElements( transforms_localToWorld[i] ), GetElements( transforms_localToWorld_scalar[i] ), 16 );
+                    mismatches_transforms.Add( GetElements( transforms_localToProjected[i] ),
+                        GetElements( transforms_localToProjected_scalar[i] ), 16 );
+                }
+            }
+            {
+                Math::Multiply( quaternions_lhs, quaternions_rhs, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::Multiply( quaternions_lhs, quaternions_rhs, i, 1, quaternions_results_scalar );
+                }
+                compareQuaternions( mismatches_multiply );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    quaternions_results_scalar.Set( i, i_inputs.orientations_lhs[i] * i_inputs.orientations_rhs[i] );
+                }
+                compareQuaternions( mismatches_multiply );
+            }
+            {
+                // The products aren't quite normalized, and so they are good inputs to normalize
+                const auto quaternions_products = quaternions_results;
+                Math::Normalize( quaternions_results, 0, sampleCount );
+                quaternions_results_scalar = quaternions_products;
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::Normalize( quaternions_results_scalar, i, 1 );
+                }
+                compareQuaternions( mismatches_normalize );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    quaternions_results_scalar.Set( i, quaternions_products.Get( i ).GetNormalized() );
+                }
+                compareQuaternions( mismatches_normalize );
+            }
+            {
+                constexpr auto t = 0.375f;
+                Math::Nlerp( quaternions_lhs, quaternions_rhs, t, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::Nlerp( quaternions_lhs, quaternions_rhs, t, i, 1, quaternions_results_scalar );
+                }
+                compareQuaternions( mismatches_nlerp );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    quaternions_results_scalar.Set( i, Nlerp( i_inputs.orientations_lhs[i], i_inputs.orientations_rhs[i], t ) );
+                }
+                compareQuaternions( mismatches_nlerp );
+            }
+            {
+                constexpr auto t = 0.375f;
+                Math::Slerp( quaternions_lhs, quaternions_rhs, t, 0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::Slerp( quaternions_lhs, quaternions_rhs, t, i, 1, quaternions_results_scalar );
+                }
+                compareQuaternions( mismatches_slerp );
+            }
+            {
+                Math::MakeFromAxisAngles( i_inputs.angles.data(), axes_x.data(), axes_y.data(), axes_z.data(),
+                    0, sampleCount, quaternions_results );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::MakeFromAxisAngles( i_inputs.angles.data(), axes_x.data(), axes_y.data(), axes_z.data(),
+                        i, 1, quaternions_results_scalar );
+                }
+                compareQuaternions( mismatches_axisAngle );
+            }
+            {
+                std::vector<Math::cMatrixTransformation> transforms( sampleCount ), transforms_scalar( sampleCount );
+                constexpr auto stride = sizeof( Math::cMatrixTransformation );
+                Math::CalculateRotationTransforms( quaternions_lhs, 0, sampleCount, transforms.data(), stride );
+                for ( size_t i = 0; i < sampleCount; ++i )
+                {
+                    Math::CalculateRotationTransforms( quaternions_lhs, i, 1, &transforms_scalar[i], stride );
+                    mismatches_rotationTransforms.Add( GetElements( transforms[i] ), GetElements( transforms_scalar[i] ), 16 );
+                    const Math::cMatrixTransformation transform_scalar( i_inputs.orientations_lhs[i], Math::sVector( 0.0f, 0.0f, 0.0f ) );
+                    mismatches_rotationTransforms.Add( GetElements( transforms[i] ), GetElements( transform_scalar ), 16 );
+                }
+            }
+            areAllIdentical = OutputExactness( "Batch CalculateTransforms()", mismatches_transforms ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch quaternion Multiply()", mismatches_multiply ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch quaternion Normalize()", mismatches_normalize ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch quaternion Nlerp()", mismatches_nlerp ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch quaternion Slerp()", mismatches_slerp ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch MakeFromAxisAngles()", mismatches_axisAngle ) && areAllIdentical;
+            areAllIdentical = OutputExactness( "Batch CalculateRotationTransforms()", mismatches_rotationTransforms ) && areAllIdentical;
+        }
+        // Skinning
+        {
+            // Every vertex is influenced by four random joints out of this many
+            // (each joint's transform is one of the input transforms)
+            constexpr size_t jointCount = 64;
+            EAE6320_ASSERT( jointCount <= sampleCount );
+            std::vector<Graphics::VertexFormats::sMesh> vertices_bind( sampleCount ), vertices_skinned( sampleCount ), vertices_reference( sampleCount );
+            std::vector<Graphics::VertexFormats::sSkinning> skinningData( sampleCount );
+            std::uniform_int_distribution<int> jointIndexDistribution( 0, static_cast<int>( jointCount - 1 ) );
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                auto& vertex = vertices_bind[i];
+                vertex.x = i_inputs.positions[i].x;
+                vertex.y = i_inputs.positions[i].y;
+                vertex.z = i_inputs.positions[i].z;
+                vertex.nx = i_inputs.axes[i].x;
+                vertex.ny = i_inputs.axes[i].y;
+                vertex.nz = i_inputs.axes[i].z;
+                {
+                    // Half of the bitangents are flipped so that both handednesses are checked
+                    const auto& transform = i_inputs.transforms_rhs[i];
+                    int16_t tangentFrame[4];
+                    Math::PackTangentFrame( transform.GetRightDirection(),
+                        ( ( i % 2 ) == 0 ) ? transform.GetUpDirection() : -transform.GetUpDirection(), transform.GetBackDirection(), tangentFrame );
+                    vertex.qx = tangentFrame[0];
+                    vertex.qy = tangentFrame[1];
+                    vertex.qz = tangentFrame[2];
+                    vertex.qw = tangentFrame[3];
+                }
+                // The weights add up to 255 like the ones that the mesh builder writes
+                auto& skinning = skinningData[i];
+                int remainingWeight = 255;
+                for ( size_t j = 0; j < 4; ++j )
+                {
+                    skinning.jointIndices[j] = static_cast<uint8_t>( jointIndexDistribution( GetRandomNumberGenerator() ) );
+                    const auto weight = ( j < 3 ) ?
+                        std::uniform_int_distribution<int>( 0, remainingWeight )( GetRandomNumberGenerator() ) : remainingWeight;
+                    skinning.jointWeights[j] = static_cast<uint8_t>( weight );
+                    remainingWeight -= weight;
+                }
+            }
+            // The vertices are split into two jobs that don't end on a chunk boundary
+            // so that the chunks of both jobs and the short last chunk of each are checked
+            const auto vertexCount_firstJob = ( sampleCount / 3 ) + 1;
+            Graphics::Skinning::sJob jobs[2];
+            for ( size_t i = 0; i < 2; ++i )
+            {
+                const auto firstVertex = ( i == 0 ) ? 0 : vertexCount_firstJob;
+                jobs[i].vertices_bind = vertices_bind.data() + firstVertex;
+                jobs[i].skinningData = skinningData.data() + firstVertex;
+                jobs[i].transforms_skinning = i_inputs.transforms_lhs.data();
+                jobs[i].vertices_skinned = vertices_skinned.data() + firstVertex;
+                jobs[i].vertexCount = ( i == 0 ) ? vertexCount_firstJob : ( sampleCount - vertexCount_firstJob );
+            }
+            Graphics::Skinning::SkinInParallel( jobs, 2 );
+            for ( auto& job : jobs )
+            {
+                job.vertices_skinned = vertices_reference.data() + ( job.vertices_bind - vertices_bind.data() );
+                Graphics::Skinning::SkinVertices_reference( job, 0, job.vertexCount );
+            }
+            sMismatches mismatches_skinning;
+            for ( size_t i = 0; i < sampleCount; ++i )
+            {
+                const auto& vertex = vertices_skinned[i];
+                const auto& reference = vertices_reference[i];
+                const float results[] = { vertex.x, vertex.y, vertex.z, vertex.nx, vertex.ny, vertex.nz };
+                const float references[] = { reference.x, reference.y, reference.z, reference.nx, reference.ny, reference.nz };
+                mismatches_skinning.Add( results, references, 6 );
+                const uint16_t tangentFrame[] = { static_cast<uint16_t>( vertex.qx ), static_cast<uint16_t>( vertex.qy ),
+                    static_cast<uint16_t>( vertex.qz ), static_cast<uint16_t>( vertex.qw ) };
+                const uint16_t tangentFrame_reference[] = { static_cast<uint16_t>( reference.qx ), static_cast<uint16_t>( reference.qy ),
+                    static_cast<uint16_t>( reference.qz ), static_cast<uint16_t>( reference.qw ) };
+                mismatches_skinning.Add( tangentFrame, tangentFrame_reference, 4 );
+            }
+            areAllIdentical = OutputExactness( "Skinning::SkinInParallel()", mismatches_skinning ) && areAllIdentical;
+        }
+
+        return areAllIdentical;
+    }
+
+    // Broadphase
+    //-----------
+
+    sMovingBoxes::sMovingBoxes( const size_t i_count )
+        :
+        // The boxes are about 1 unit across, and there are about 8 cubic units for each box
+        halfSize( std::cbrt( static_cast<float>( i_count ) ) )
+    {
+        centers.reserve( i_count );
+        velocities.reserve( i_count );
+        extents.reserve( i_count );
+        proxyIds.reserve( i_count );
+        bounds.Resize( i_count );
+        for ( size_t i = 0; i < i_count; ++i )
+        {
+            centers.emplace_back( GetRandomFloat( -halfSize, halfSize ), GetRandomFloat( -halfSize, halfSize ), GetRandomFloat( -halfSize, halfSize ) );
+            velocities.push_back( GetRandomDirection() * GetRandomFloat( 0.0f, 4.0f ) );
+            extents.emplace_back( GetRandomFloat( 0.25f, 0.75f ), GetRandomFloat( 0.25f, 0.75f ), GetRandomFloat( 0.25f, 0.75f ) );
+            proxyIds.push_back( static_cast<eae6320::Physics::cbBroadphase::tProxyId>( i ) );
+        }
+        Move( 0.0f );
+    }
+
+    void sMovingBoxes::Move( const float i_secondCount )
+    {
+        for ( size_t i = 0, count = centers.size(); i < count; ++i )
+        {
+            auto& center = centers[i];
+            auto& velocity = velocities[i];
+            center += velocity * i_secondCount;
+            const auto Bounce = [this]( float& io_position, float& io_velocity )
+            {
+                if ( std::abs( io_position ) > halfSize )
+                {
+                    io_position = std::max( -halfSize, std::min( io_position, halfSize ) );
+                    io_velocity = -io_velocity;
+                }
+            };
+            Bounce( center.x, velocity.x );
+            Bounce( center.y, velocity.y );
+            Bounce( center.z, velocity.z );
+            bounds.Set( i, eae6320::Physics::sAabb( center - extents[i], center + extents[i] ) );
+        }
+    }
+
+    void FindEveryOverlappingPair( const eae6320::Physics::sAabbArrays& i_bounds,
+        std::vector<eae6320::Physics::cbBroadphase::sOverlappingPair>& o_pairs )
+    {
+        o_pairs.clear();
+        for ( size_t i = 0, count = i_bounds.GetCount(); i < count; ++i )
+        {
+            const auto bounds_i = i_bounds.Get( i );
+            for ( auto j = i + 1; j < count; ++j )
+            {
+                if ( bounds_i.Overlaps( i_bounds.Get( j ) ) )
+                {
+                    using tProxyId = eae6320::Physics::cbBroadphase::tProxyId;
+                    o_pairs.push_back( { static_cast<tProxyId>( i ), static_cast<tProxyId>( j ) } );
+                }
+            }
+        }
+    }
+
+    bool RunBroadphaseBenchmark( const size_t i_bodyCount )
+    {
+        using namespace eae6320;
+
+        constexpr auto secondCountPerUpdate = 1.0f / 60.0f;
+        std::vector<Physics::cbBroadphase::sOverlappingPair> pairs;
+
+        // Every update moves the boxes and then finds the pairs
+        // (moving the boxes is included in the timing but is much cheaper than finding the pairs)
+        const auto TimeBroadphase = [i_bodyCount, &pairs]( const char* const i_name, Physics::cbBroadphase& io_broadphase, sMovingBoxes& io_boxes )
+        {
+            for ( size_t i = 0; i < i_bodyCount; ++i )
+            {
+                io_broadphase.AddProxy( io_boxes.proxyIds[i], io_boxes.bounds.Get( i ) );
+            }
+            OutputTiming( i_name, i_bodyCount, MeasureSecondsPerElement( i_bodyCount, [&]()
+            {
+                io_boxes.Move( secondCountPerUpdate );
+                io_broadphase.UpdateProxies( io_boxes.proxyIds.data(), io_boxes.bounds );
+                io_broadphase.FindOverlappingPairs( pairs );
+                s_sink = s_sink + static_cast<float>( pairs.size() );
+            } ) );
+        };
+
+        // Each broadphase moves its own copy of the same boxes
+        // (and because each timing calls the function the same number of times the boxes end up in the same places)
+        sMovingBoxes boxes_sweepAndPrune( i_bodyCount );
+        auto boxes_dynamicAabbTree = boxes_sweepAndPrune;
+        auto boxes_spatialHashGrid = boxes_sweepAndPrune;
+        Physics::cSweepAndPrune sweepAndPrune;
+        Physics::cDynamicAabbTree dynamicAabbTree;
+        Physics::cSpatialHashGrid spatialHashGrid( s_spatialHashGridCellSize );
+        TimeBroadphase( "cSweepAndPrune update", sweepAndPrune, boxes_sweepAndPrune );
+        TimeBroadphase( "cDynamicAabbTree update", dynamicAabbTree, boxes_dynamicAabbTree );
+        TimeBroadphase( "cSpatialHashGrid update", spatialHashGrid, boxes_spatialHashGrid );
+        if ( i_bodyCount <= s_maxBodyCountToTimeEveryPair )
+        {
+            auto boxes = boxes_sweepAndPrune;
+            OutputTiming( "Checking every pair", i_bodyCount, MeasureSecondsPerElement( i_bodyCount, [&]()
+            {
+                boxes.Move( secondCountPerUpdate );
+                FindEveryOverlappingPair( boxes.bounds, pairs );
+                s_sink = s_sink + static_cast<float>( pairs.size() );
+            } ) );
+        }
+
+        // The pairs that the broadphases found after all of the updates
+        // are compared with every pair that actually overlaps
+        // (or, if there are too many bodies to check every pair, with each other)
+        std::vector<Physics::cbBroadphase::sOverlappingPair> pairs_reference, pairs_sweepAndPrune, pairs_dynamicAabbTree, pairs_spatialHashGrid;
+        sweepAndPrune.FindOverlappingPairs( pairs_sweepAndPrune );
+        dynamicAabbTree.FindOverlappingPairs( pairs_dynamicAabbTree );
+        spatialHashGrid.FindOverlappingPairs( pairs_spatialHashGrid );
+        if ( i_bodyCount <= s_maxBodyCountToCheckEveryPair )
+        {
+            FindEveryOverlappingPair( boxes_sweepAndPrune.bounds, pairs_reference );
+        }
+        else
+        {
+            pairs_reference = pairs_sweepAndPrune;
+        }
+        Logging::OutputMessage( "Benchmark: %7u bodies have %u overlapping pairs (the dynamic AABB tree's height is %i)",
+            static_cast<unsigned int>( i_bodyCount ), static_cast<unsigned int>( pairs_reference.size() ), dynamicAabbTree.GetHeight() );
+
+        auto areCorrect = true;
+        if ( pairs_sweepAndPrune != pairs_reference )
+        {
+            Logging::OutputError( "cSweepAndPrune found %u pairs for %u bodies instead of %u",
+                static_cast<unsigned int>( pairs_sweepAndPrune.size() ), static_cast<unsigned int>( i_bodyCount ),
+                static_cast<unsigned int>( pairs_reference.size() ) );
+            areCorrect = false;
+        }
+        if ( pairs_dynamicAabbTree != pairs_reference )
+        {
+            Logging::OutputError( "cDynamicAabbTree found %u pairs for %u bodies instead of %u",
+                static_cast<unsigned int>( pairs_dynamicAabbTree.size() ), static_cast<unsigned int>( i_bodyCount ),
+                static_cast<unsigned int>( pairs_reference.size() ) );
+            areCorrect = false;
+        }
+        if ( pairs_spatialHashGrid != pairs_reference )
+        {
+            Logging::OutputError( "cSpatialHashGrid found %u pairs for %u bodies instead of %u",
+                static_cast<unsigned int>( pairs_spatialHashGrid.size() ), static_cast<unsigned int>( i_bodyCount ),
+                static_cast<unsigned int>( pairs_reference.size() ) );
+            areCorrect = false;
+        }
+        return areCorrect;
+    }
+
+    // Spatial Index
+    //--------------
+
+    sSpatialQueries::sSpatialQueries( const float i_halfSize )
+    {
+        using namespace eae6320;
+
+        const Math::sVector extents( s_spatialQueryHalfSize, s_spatialQueryHalfSize, s_spatialQueryHalfSize );
+        const auto transform_cameraToProjected = Math::cMatrixTransformation::CreateCameraToProjectedTransformPerspective(
+            Math::ConvertDegreesToRadians( 60.0f ), 16.0f / 9.0f, 0.1f, s_spatialQueryFarPlane );
+        boxes.reserve( s_spatialQueryCount );
+        sphereCenters.reserve( s_spatialQueryCount );
+        rayOrigins.reserve( s_spatialQueryCount );
+        rayDirections.reserve( s_spatialQueryCount );
+        transforms_worldToProjected.reserve( s_spatialQueryCount );
+        const auto GetRandomPosition = [i_halfSize]()
+        {
+            return Math::sVector( GetRandomFloat( -i_halfSize, i_halfSize ), GetRandomFloat( -i_halfSize, i_halfSize ), GetRandomFloat( -i_halfSize, i_halfSize ) );
+        };
+        for ( size_t i = 0; i < s_spatialQueryCount; ++i )
+        {
+            const auto boxCenter = GetRandomPosition();
+            boxes.emplace_back( boxCenter - extents, boxCenter + extents );
+            sphereCenters.push_back( GetRandomPosition() );
+            rayOrigins.push_back( GetRandomPosition() );
+            rayDirections.push_back( GetRandomDirection() );
+            // The camera's up direction can't be parallel to the direction that it is looking
+            const auto cameraPosition = GetRandomPosition();
+            auto lookDirection = GetRandomDirection();
+            if ( std::abs( lookDirection.y ) > 0.99f )
+            {
+                lookDirection = Math::sVector( 1.0f, 0.0f, 0.0f );
+            }
+            const auto transform_worldToCamera = Math::cMatrixTransformation::CreateWorldToCameraTransformLookAt(
+                cameraPosition, cameraPosition + lookDirection, Math::sVector( 0.0f, 1.0f, 0.0f ) );
+            transforms_worldToProjected.push_back( transform_cameraToProjected * transform_worldToCamera );
+        }
+    }
+
+    bool RunSpatialIndexBenchmark( const size_t i_objectCount )
+    {
+        using namespace eae6320;
+        using tProxyId = Physics::cbBroadphase::tProxyId;
+
+        constexpr auto secondCountPerUpdate = 1.0f / 60.0f;
+        sMovingBoxes boxes( i_objectCount );
+        const sSpatialQueries queries( boxes.halfSize );
+        Physics::cSpatialHashGrid spatialHashGrid( s_spatialHashGridCellSize );
+        std::vector<tProxyId> proxyIds;
+        std::vector<Physics::cSpatialHashGrid::sRayHit> rayHits;
+
+        // Building and updating
+        OutputTiming( "cSpatialHashGrid build", i_objectCount, MeasureSecondsPerElement( i_objectCount, [&]()
+        {
+            spatialHashGrid.Clear();
+            for ( size_t i = 0; i < i_objectCount; ++i )
+            {
+                spatialHashGrid.AddProxy( boxes.proxyIds[i], boxes.bounds.Get( i ) );
+            }
+        } ) );
+        OutputTiming( "cSpatialHashGrid move and update", i_objectCount, MeasureSecondsPerElement( i_objectCount, [&]()
+        {
+            boxes.Move( secondCountPerUpdate );
+            spatialHashGrid.UpdateProxies( boxes.proxyIds.data(), boxes.bounds );
+        } ) );
+        Logging::OutputMessage( "Benchmark: %7u objects are in %u cells",
+            static_cast<unsigned int>( i_objectCount ), static_cast<unsigned int>( spatialHashGrid.GetCellCount() ) );
+
+        // Queries
+        size_t resultCount = 0;
+        const auto TimeQueries = [&resultCount]( const char* const i_name, const auto& i_query )
+        {
+            resultCount = 0;
+            OutputTiming( i_name, s_spatialQueryCount, MeasureSecondsPerElement( s_spatialQueryCount, [&]()
+            {
+                for ( size_t i = 0; i < s_spatialQueryCount; ++i )
+                {
+                    resultCount += i_query( i );
+                }
+                s_sink = s_sink + static_cast<float>( resultCount );
+            }, s_maxSpatialQueryRepetitionCount ) );
+        };
+        TimeQueries( "cSpatialHashGrid::QueryAabb()", [&]( const size_t i_index )
+        {
+            spatialHashGrid.QueryAabb( queries.boxes[i_index], proxyIds );
+            return proxyIds.size();
+        } );
+        TimeQueries( "cSpatialHashGrid::QuerySphere()", [&]( const size_t i_index )
+        {
+            spatialHashGrid.QuerySphere( queries.sphereCenters[i_index], s_spatialQueryHalfSize, proxyIds );
+            return proxyIds.size();
+        } );
+        TimeQueries( "cSpatialHashGrid::QueryFrustum()", [&]( const size_t i_index )
+        {
+            spatialHashGrid.QueryFrustum( queries.transforms_worldToProjected[i_index], proxyIds );
+            return proxyIds.size();
+        } );
+        TimeQueries( "cSpatialHashGrid::Raycast()", [&]( const size_t i_index )
+        {
+            spatialHashGrid.Raycast( queries.rayOrigins[i_index], queries.rayDirections[i_index], s_spatialQueryRayLength, rayHits );
+            return rayHits.size();
+        } );
+
+        // The references check every object
+        const auto QueryAabb_reference = [&boxes]( const Physics::sAabb& i_bounds, std::vector<tProxyId>& o_proxyIds )
+        {
+            o_proxyIds.clear();
+            for ( size_t i = 0; i < boxes.bounds.GetCount(); ++i )
+            {
+                if ( boxes.bounds.Get( i ).Overlaps( i_bounds ) )
+                {
+                    o_proxyIds.push_back( boxes.proxyIds[i] );
+                }
+            }
+        };
+        const auto QuerySphere_reference = [&boxes]( const Math::sVector& i_center, const float i_radius, std::vector<tProxyId>& o_proxyIds )
+        {
+            o_proxyIds.clear();
+            for ( size_t i = 0; i < boxes.bounds.GetCount(); ++i )
+            {
+                const auto bounds = boxes.bounds.Get( i );
+                const Math::sVector closestPosition( std::max( bounds.minimum.x, std::min( i_center.x, bounds.maximum.x ) ),
+                    std::max( bounds.minimum.y, std::min( i_center.y, bounds.maximum.y ) ),
+                    std::max( bounds.minimum.z, std::min( i_center.z, bounds.maximum.z ) ) );
+                const auto offset = closestPosition - i_center;
+                if ( Dot( offset, offset ) <= ( i_radius * i_radius ) )
+                {
+                    o_proxyIds.push_back( boxes.proxyIds[i] );
+                }
+            }
+        };
+        const auto QueryFrustum_reference = [&boxes]( const Math::cMatrixTransformation& i_transform_worldToProjected, std::vector<tProxyId>& o_proxyIds )
+        {
+            o_proxyIds.clear();
+            Math::sVector4 planes[6];
+            i_transform_worldToProjected.GetClipSpacePlanes( planes );
+            Math::sVector corners[8];
+            const auto areCornersFinite = i_transform_worldToProjected.GetClipSpaceCorners( corners );
+            EAE6320_ASSERT( areCornersFinite );
+            Physics::sAabb frustumBounds( corners[0], corners[0] );
+            for ( const auto& corner : corners )
+            {
+                frustumBounds = Physics::Merge( frustumBounds, Physics::sAabb( corner, corner ) );
+            }
+            for ( size_t i = 0; i < boxes.bounds.GetCount(); ++i )
+            {
+                const auto bounds = boxes.bounds.Get( i );
+                auto isInside = areCornersFinite ? bounds.Overlaps( frustumBounds ) : true;
+                for ( const auto& plane : planes )
+                {
+                    const Math::sVector farthestCorner( ( plane.x >= 0.0f ) ? bounds.maximum.x : bounds.minimum.x,
+                        ( plane.y >= 0.0f ) ? bounds.maximum.y : bounds.minimum.y, ( plane.z >= 0.0f ) ? bounds.maximum.z : bounds.minimum.z );
+                    if ( ( ( ( plane.x * farthestCorner.x ) + ( plane.y * farthestCorner.y ) ) + ( plane.z * farthestCorner.z ) ) + plane.w < 0.0f )
+                    {
+                        isInside = false;
+                        break;
+                    }
+                }
+                if ( isInside )
+                {
+                    o_proxyIds.push_back( boxes.proxyIds[i] );
+                }
+            }
+        };
+        const auto Raycast_reference = [&boxes]( const Math::sVector& i_origin, const Math::sVector& i_direction, const float i_maxDistance,
+            std::vector<tProxyId>& o_proxyIds )
+        {
+            o_proxyIds.clear();
+            const float origin[] = { i_origin.x, i_origin.y, i_origin.z };
+            const float direction[] = { i_direction.x, i_direction.y, i_direction.z };
+            for ( size_t i = 0; i < boxes.bounds.GetCount(); ++i )
+            {
+                const auto bounds = boxes.bounds.Get( i );
+                const float minimum[] = { bounds.minimum.x, bounds.minimum.y, bounds.minimum.z };
+                const float maximum[] = { bounds.maximum.x, bounds.maximum.y, bounds.maximum.z };
+                auto entry = 0.0f;
+                auto exit = i_maxDistance;
+                for ( size_t j = 0; j < 3; ++j )
+                {
+                    const auto inverseDirection = 1.0f / direction[j];
+                    const auto distance_minimum = ( minimum[j] - origin[j] ) * inverseDirection;
+                    const auto distance_maximum = ( maximum[j] - origin[j] ) * inverseDirection;
+                    entry = std::max( entry, std::min( distance_minimum, distance_maximum ) );
+                    exit = std::min( exit, std::max( distance_minimum, distance_maximum ) );
+                }
+                if ( entry <= exit )
+                {
+                    o_proxyIds.push_back( boxes.proxyIds[i] );
+                }
+            }
+        };
+        if ( i_objectCount <= s_maxObjectCountToTimeEveryObject )
+        {
+            TimeQueries( "Checking every box", [&]( const size_t i_index )
+            {
+                QueryAabb_reference( queries.boxes[i_index], proxyIds );
+                return proxyIds.size();
+            } );
+            TimeQueries( "Checking every box against a frustum", [&]( const size_t i_index )
+            {
+                QueryFrustum_reference( queries.transforms_worldToProjected[i_index], proxyIds );
+                return proxyIds.size();
+            } );
+        }
+
+        // The first few queries of each kind are compared with the references
+        // (the order of the results doesn't matter)
+        auto areCorrect = true;
+        std::vector<tProxyId> proxyIds_reference;
+        const auto Compare = [&]( const char* const i_name, const size_t i_index )
+        {
+            std::sort( proxyIds.begin(), proxyIds.end() );
+            std::sort( proxyIds_reference.begin(), proxyIds_reference.end() );
+            if ( proxyIds != proxyIds_reference )
+            {
+                Logging::OutputError( "cSpatialHashGrid::%s() query %u found %u of %u objects instead of %u",
+                    i_name, static_cast<unsigned int>( i_index ), static_cast<unsigned int>( proxyIds.size() ),
+                    static_cast<unsigned int>( i_objectCount ), static_cast<unsigned int>( proxyIds_reference.size() ) );
+                areCorrect = false;
+            }
+        };
+        for ( size_t i = 0; i < s_spatialQueryCountToCheck; ++i )
+        {
+            spatialHashGrid.QueryAabb( queries.boxes[i], proxyIds );
+            QueryAabb_reference( queries.boxes[i], proxyIds_reference );
+            Compare( "QueryAabb", i );
+
+            spatialHashGrid.QuerySphere( queries.sphereCenters[i], s_spatialQueryHalfSize, proxyIds );
+            QuerySphere_reference( queries.sphereCenters[i], s_spatialQueryHalfSize, proxyIds_reference );
+            Compare( "QuerySphere", i );
+
+            spatialHashGrid.QueryFrustum( queries.transforms_worldToProjected[i], proxyIds );
+            QueryFrustum_reference( queries.transforms_worldToProjected[i], proxyIds_reference );
+            Compare( "QueryFrustum", i );
+
+            spatialHashGrid.Raycast( queries.rayOrigins[i], queries.rayDirections[i], s_spatialQueryRayLength, rayHits );
+            proxyIds.clear();
+            for ( size_t j = 0; j < rayHits.size(); ++j )
+            {
+                if ( ( j > 0 ) && ( rayHits[j].distance < rayHits[j - 1].distance ) )
+                {
+                    Logging::OutputError( "cSpatialHashGrid::Raycast() query %u didn't sort its hits", static_cast<unsigned int>( i ) );
+                    areCorrect = false;
+                }
+                proxyIds.push_back( rayHits[j].proxyId );
+            }
+            Raycast_reference( queries.rayOrigins[i], queries.rayDirections[i], s_spatialQueryRayLength, proxyIds_reference );
+            Compare( "Raycast", i );
+        }
+        return areCorrect;
+    }
+
+    // Simulation
+    //-----------
+
+    sContactShapes::sContactShapes()
+    {
+        using namespace eae6320;
+
+        constexpr auto radius = 0.6f;
+        for ( size_t i = 0; i < 6; ++i )
+        {
+            const auto angle = static_cast<float>( i ) * ( 6.2831853f / 6.0f );
+            hullPoints[i] = Math::sVector( radius * std::cos( angle ), 0.5f, radius * std::sin( angle ) );
+            hullPoints[i + 6] = Math::sVector( radius * std::cos( angle ), -0.5f, radius * std::sin( angle ) );
+        }
+        shapes[Physics::ShapeTypes::SPHERE] = Physics::sShape::CreateSphere( 0.5f );
+        shapes[Physics::ShapeTypes::CAPSULE] = Physics::sShape::CreateCapsule( 0.25f, 0.25f );
+        shapes[Physics::ShapeTypes::BOX] = Physics::sShape::CreateBox( Math::sVector( 0.6f, 0.5f, 0.4f ) );
+        shapes[Physics::ShapeTypes::CONVEX_HULL] = Physics::sShape::CreateConvexHull( hullPoints, 12 );
+    }
+
+    bool CheckContacts( const sContactShapes& i_shapes )
+    {
+        using namespace eae6320;
+
+        const auto IsFlat = []( const size_t i_shapeIndex )
+        {
+            return ( i_shapeIndex == Physics::ShapeTypes::BOX ) || ( i_shapeIndex == Physics::ShapeTypes::CONVEX_HULL );
+        };
+
+        // The upper shape is turned differently from the lower one
+        // so that the edges of flat faces cross
+        const Math::sVector position_lower( 0.3f, -2.0f, 1.0f );
+        const Math::cQuaternion orientation_lower( 0.2f, Math::sVector( 0.0f, 1.0f, 0.0f ) );
+        const Math::cQuaternion orientation_upper( 0.7f, Math::sVector( 0.0f, 1.0f, 0.0f ) );
+        const auto top_lower = position_lower.y + 0.5f;
+        auto areAllCorrect = true;
+        unsigned int pairCount = 0;
+        for ( size_t i = 0; i < s_contactShapeCount; ++i )
+        {
+            for ( size_t j = 0; j < s_contactShapeCount; ++j )
+            {
+                for ( const auto depth : { s_contactDepth, -s_contactDepth } )
+                {
+                    const auto position_upper = position_lower + Math::sVector( 0.0f, 1.0f - depth, 0.0f );
+                    Physics::Narrowphase::sContact contacts[Physics::Narrowphase::maxContactCount];
+                    const auto contactCount = Physics::Narrowphase::CalculateContacts( i_shapes.shapes[i], position_lower, orientation_lower,
+                        i_shapes.shapes[j], position_upper, orientation_upper, s_contactMargin, contacts );
+                    const auto expectedContactCount = ( IsFlat( i ) && IsFlat( j ) ) ? 4u : 1u;
+                    auto areCorrect = contactCount == expectedContactCount;
+                    for ( unsigned int k = 0; k < contactCount; ++k )
+                    {
+                        const auto& contact = contacts[k];
+                        areCorrect = areCorrect
+                            && ( contact.normal.y >= ( 1.0f - s_contactTolerance ) )
+                            && ( std::abs( contact.depth - depth ) <= s_contactTolerance )
+                            && ( std::abs( contact.pointOnA.y - top_lower ) <= s_contactTolerance )
+                            && ( std::abs( contact.pointOnB.y - ( top_lower - depth ) ) <= s_contactTolerance );
+                    }
+                    if ( !areCorrect )
+                    {
+                        Logging::OutputError( "A %s on a %s at a depth of %f had %u contacts (the first with a normal of (%f, %f, %f) and a depth of %f)"
+                            " instead of %u with a normal of (0, 1, 0) and a depth of %f",
+                            s_contactShapeNames[j], s_contactShapeNames[i], depth, contactCount,
+                            ( contactCount > 0 ) ? contacts[0].normal.x : 0.0f, ( contactCount > 0 ) ? contacts[0].normal.y : 0.0f,
+                            ( contactCount > 0 ) ? contacts[0].normal.z : 0.0f, ( contactCount > 0 ) ? contacts[0].depth : 0.0f,
+                            expectedContactCount, depth );
+                        areAllCorrect = false;
+                    }
+                    ++pairCount;
+                }
+            }
+        }
+        if ( areAllCorrect )
+        {
+            Logging::OutputMessage( "Contacts: all %u pairs of touching shapes had the right contacts", pairCount );
+        }
+        return areAllCorrect;
+    }
+
+    bool CheckRestingContacts( const sContactShapes& i_shapes )
+    {
+        using namespace eae6320;
+
+        // Every pair is far enough from the others to be its own island.
+        // The dynamic body starts a little above the static one and falls onto it,
+        // and it is turned so that the edges of flat faces cross
+        Physics::cWorld world;
+        world.SetGravity( Math::sVector( 0.0f, -10.0f, 0.0f ) );
+        Physics::cWorld::tBodyId bodyIds[s_contactShapeCount][s_contactShapeCount];
+        Math::sVector restingPositions[s_contactShapeCount][s_contactShapeCount];
+        for ( size_t i = 0; i < s_contactShapeCount; ++i )
+        {
+            for ( size_t j = 0; j < s_contactShapeCount; ++j )
+            {
+                const Math::sVector position_lower( static_cast<float>( j ) * 4.0f, 0.0f, static_cast<float>( i ) * 4.0f );
+                auto shape_lower = i_shapes.shapes[i];
+                shape_lower.density = 0.0f;
+                world.AddBody( position_lower, Math::cQuaternion(), Physics::sRigidBodyState(), shape_lower );
+                restingPositions[i][j] = position_lower + Math::sVector( 0.0f, 1.0f, 0.0f );
+                bodyIds[i][j] = world.AddBody( restingPositions[i][j] + Math::sVector( 0.0f, 0.1f, 0.0f ),
+                    Math::cQuaternion( 0.5f, Math::sVector( 0.0f, 1.0f, 0.0f ) ), Physics::sRigidBodyState(), i_shapes.shapes[j] );
+            }
+        }
+        for ( size_t i = 0; i < s_restingUpdateCount; ++i )
+        {
+            world.Update( s_simulationSecondCountPerUpdate );
+        }
+
+        auto areAllAtRest = true;
+        auto maxDistance = 0.0f;
+        for ( size_t i = 0; i < s_contactShapeCount; ++i )
+        {
+            for ( size_t j = 0; j < s_contactShapeCount; ++j )
+            {
+                float distance;
+                if ( !IsAtRest( world, bodyIds[i][j], restingPositions[i][j], distance ) )
+                {
+                    Logging::OutputError( "A %s that fell onto a %s didn't come to rest on top of it", s_contactShapeNames[j], s_contactShapeNames[i] );
+                    areAllAtRest = false;
+                }
+                maxDistance = std::max( distance, maxDistance );
+            }
+        }
+        if ( areAllAtRest )
+        {
+            Logging::OutputMessage( "Resting: a body of every shape came to rest on every other shape (at most %f units from where it should be)",
+                maxDistance );
+        }
+        return areAllAtRest;
+    }
+
+    bool CheckStack( const sContactShapes& i_shapes )
+    {
+        using namespace eae6320;
+
+        // Each body is turned a little more than the one under it
+        // so that the edges of their faces cross
+        Physics::cWorld world;
+        world.SetGravity( Math::sVector( 0.0f, -10.0f, 0.0f ) );
+        {
+            auto shape_ground = Physics::sShape::CreateBox( Math::sVector( 4.0f, 0.5f, 4.0f ) );
+            shape_ground.density = 0.0f;
+            world.AddBody( Math::sVector( 0.0f, -0.5f, 0.0f ), Math::cQuaternion(), Physics::sRigidBodyState(), shape_ground );
+        }
+        Physics::cWorld::tBodyId bodyIds[s_stackBodyCount];
+        Math::sVector restingPositions[s_stackBodyCount];
+        for ( size_t i = 0; i < s_stackBodyCount; ++i )
+        {
+            restingPositions[i] = Math::sVector( 0.0f, static_cast<float>( i ) + 0.5f, 0.0f );
+            bodyIds[i] = world.AddBody( restingPositions[i], Math::cQuaternion( static_cast<float>( i ) * 0.3f, Math::sVector( 0.0f, 1.0f, 0.0f ) ),
+                Physics::sRigidBodyState(), i_shapes.shapes[( ( i % 2 ) == 0 ) ? Physics::ShapeTypes::BOX : Physics::ShapeTypes::CONVEX_HULL] );
+        }
+        for ( size_t i = 0; i < s_restingUpdateCount; ++i )
+        {
+            world.Update( s_simulationSecondCountPerUpdate );
+        }
+
+        auto isStanding = true;
+        auto maxDistance = 0.0f;
+        for ( size_t i = 0; i < s_stackBodyCount; ++i )
+        {
+            float distance;
+            if ( !IsAtRest( world, bodyIds[i], restingPositions[i], distance ) )
+            {
+                Logging::OutputError( "Body %u of a stack of %u didn't stay where it was stacked",
+                    static_cast<unsigned int>( i ), static_cast<unsigned int>( s_stackBodyCount ) );
+                isStanding = false;
+            }
+            maxDistance = std::max( distance, maxDistance );
+        }
+        if ( isStanding )
+        {
+            Logging::OutputMessage( "Stacking: a stack of %u bodies stayed standing (every body is at most %f units from where it was stacked)",
+                static_cast<unsigned int>( s_stackBodyCount ), maxDistance );
+        }
+        return isStanding;
+    }
+
+    bool RunWorldUpdateBenchmark( const sContactShapes& i_shapes )
+    {
+        using namespace eae6320;
+
+        // The bodies start at random places inside of a cube with random velocities (like the broadphase benchmarks' boxes),
+        // and the cube gets bigger with the number of bodies so that there are about 64 cubic units for each body
+        // (most bodies aren't touching anything, and so the broadphase is a big part of each update).
+        // There is no gravity, and so the bodies keep bumping into each other.
+        // Every world gets the same bodies in the same order
+        const auto halfSize = 2.0f * std::cbrt( static_cast<float>( s_worldBodyCount ) );
+        std::vector<Math::sVector> positions, velocities;
+        std::vector<Math::cQuaternion> orientations;
+        positions.reserve( s_worldBodyCount );
+        velocities.reserve( s_worldBodyCount );
+        orientations.reserve( s_worldBodyCount );
+        for ( size_t i = 0; i < s_worldBodyCount; ++i )
+        {
+            positions.emplace_back( GetRandomFloat( -halfSize, halfSize ), GetRandomFloat( -halfSize, halfSize ), GetRandomFloat( -halfSize, halfSize ) );
+            velocities.push_back( GetRandomDirection() * GetRandomFloat( 0.0f, 4.0f ) );
+            orientations.push_back( GetRandomOrientation() );
+        }
+
+        const struct
+        {
+            const char* name;
+            Physics::BroadphaseTypes::eType type;
+        } broadphases[] =
+        {
+            { "cWorld::Update() with cSweepAndPrune", Physics::BroadphaseTypes::SWEEP_AND_PRUNE },
+            { "cWorld::Update() with cDynamicAabbTree", Physics::BroadphaseTypes::DYNAMIC_AABB_TREE },
+            { "cWorld::Update() with cSpatialHashGrid", Physics::BroadphaseTypes::SPATIAL_HASH_GRID },
+        };
+        Physics::cSnapshot snapshot_reference;
+        auto areAllSame = true;
+        for ( const auto& broadphase : broadphases )
+        {
+            Physics::cWorld world( broadphase.type );
+            world.Reserve( s_worldBodyCount );
+            for ( size_t i = 0; i < s_worldBodyCount; ++i )
+            {
+                Physics::sRigidBodyState rigidBodyState;
+                rigidBodyState.velocity = velocities[i];
+                world.AddBody( positions[i], orientations[i], rigidBodyState, i_shapes.shapes[i % s_contactShapeCount] );
+            }
+            const auto secondsPerBody = MeasureSecondsPerElement( s_worldBodyCount, [&world]()
+            {
+                world.Update( s_simulationSecondCountPerUpdate );
+            } );
+            OutputTiming( broadphase.name, s_worldBodyCount, secondsPerBody );
+            Logging::OutputMessage( "Benchmark: %-40s %.2f ms per update with %u threads (%u contact manifolds)",
+                broadphase.name, secondsPerBody * static_cast<double>( s_worldBodyCount ) * 1.0e3, Concurrency::Jobs::GetThreadCount(),
+                static_cast<unsigned int>( world.GetContactManifolds().size() ) );
+
+            // Every world was updated the same number of times,
+            // and the simulation doesn't depend on which broadphase found the pairs
+            Physics::cSnapshot snapshot;
+            world.SaveSnapshot( snapshot );
+            if ( &broadphase == broadphases )
+            {
+                snapshot_reference = snapshot;
+            }
+            else if ( ( snapshot.GetSize() != snapshot_reference.GetSize() )
+                || ( std::memcmp( snapshot.GetData(), snapshot_reference.GetData(), snapshot.GetSize() ) != 0 ) )
+            {
+                Logging::OutputError( "%s didn't simulate the same thing as %s", broadphase.name, broadphases[0].name );
+                areAllSame = false;
+            }
+        }
+        return areAllSame;
+    }
+
+    bool IsAtRest( const eae6320::Physics::cWorld& i_world, const eae6320::Physics::cWorld::tBodyId i_bodyId,
+        const eae6320::Math::sVector& i_restingPosition, float& o_distance )
+    {
+        o_distance = ( i_world.GetPosition( i_bodyId ) - i_restingPosition ).GetLength();
+        const auto speed = i_world.GetRigidBodyState( i_bodyId ).velocity.GetLength();
+        const auto isAtRest = ( o_distance <= s_maxRestingDistance ) && ( speed <= s_maxRestingSpeed );
+        if ( !isAtRest )
+        {
+            eae6320::Logging::OutputError( "A body ended up %f units from where it should rest and is moving %f units per second",
+                o_distance, speed );
+        }
+        return isAtRest;
+    }
+
+    // Job System
+    //-----------
+
+    bool RunParallelForBenchmark( const sInputs& i_inputs, const size_t i_elementCount )
+    {
+        EAE6320_ASSERT( i_elementCount <= i_inputs.positions.size() );
+
+        using namespace eae6320;
+
+        auto areCorrect = true;
+        const auto TimeSerialAndParallel = [i_elementCount, &areCorrect]( const char* const i_name, const auto& i_function, const auto& i_getResult )
+        {
+            const auto secondsPerElement_serial = MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                i_function( size_t( 0 ), i_elementCount );
+            } );
+            const auto result_serial = i_getResult();
+            const auto secondsPerElement_parallel = MeasureSecondsPerElement( i_elementCount, [&]()
+            {
+                Concurrency::Jobs::ParallelFor( 0, i_elementCount, s_elementCountPerJob, i_function );
+            } );
+            OutputSpeedUp( i_name, i_elementCount, secondsPerElement_serial, secondsPerElement_parallel );
+            // Every element is calculated by the same code either way,
+            // and so the results must be exactly the same
+            if ( i_getResult() != result_serial )
+            {
+                Logging::OutputError( "%s had different results in parallel for %u elements", i_name, static_cast<unsigned int>( i_elementCount ) );
+                areCorrect = false;
+            }
+        };
+
+        // Memory-bound work
+        {
+            std::vector<Math::sVector> vectors( i_elementCount );
+            TimeSerialAndParallel( "cQuaternion * sVector",
+                [&]( const size_t i_begin, const size_t i_end )
+                {
+                    for ( auto i = i_begin; i < i_end; ++i )
+                    {
+                        vectors[i] = i_inputs.orientations_lhs[i] * i_inputs.positions[i];
+                    }
+                },
+                [&]()
+                {
+                    std::vector<float> result;
+                    result.reserve( i_elementCount * 3 );
+                    for ( const auto& vector : vectors )
+                    {
+                        result.push_back( vector.x );
+                        result.push_back( vector.y );
+                        result.push_back( vector.z );
+                    }
+                    return result;
+                } );
+        }
+        // Compute-bound work
+        {
+            std::vector<Math::cQuaternion> orientations( i_elementCount );
+            TimeSerialAndParallel( "Slerp()",
+                [&]( const size_t i_begin, const size_t i_end )
+                {
+                    for ( auto i = i_begin; i < i_end; ++i )
+                    {
+                        orientations[i] = Slerp( i_inputs.orientations_lhs[i], i_inputs.orientations_rhs[i], 0.375f );
+                    }
+                },
+                [&]()
+                {
+                    // Two quaternions that differ in any component have different dot products with a random quaternion
+                    std::vector<float> result( i_elementCount );
+                    for ( size_t i = 0; i < i_elementCount; ++i )
+                    {
+                        result[i] = Dot( orientations[i], i_inputs.orientations_rhs[i] );
+                    }
+                    return result;
+                } );
+        }
+
+        return areCorrect;
+    }
+
+    bool CheckJobDependencies()
+    {
+        using namespace eae6320;
+
+        // Each job of the first stage fills in its own value,
+        // and each job of the second stage depends on all of them and adds them up
+        constexpr size_t stageJobCount = 64;
+        constexpr unsigned int repetitionCount = 100;
+        struct sStages
+        {
+            uint64_t values_first[stageJobCount];
+            uint64_t sums_second[stageJobCount];
+        };
+        struct sJobData
+        {
+            sStages* stages;
+            size_t index;
+        };
+        sStages stages;
+        sJobData jobData[stageJobCount];
+        for ( unsigned int i = 0; i < repetitionCount; ++i )
+        {
+            for ( size_t j = 0; j < stageJobCount; ++j )
+            {
+                stages.values_first[j] = 0;
+                stages.sums_second[j] = 0;
+                jobData[j] = { &stages, j };
+            }
+            Concurrency::Jobs::cCounter counter_first, counter_second;
+            for ( auto& data : jobData )
+            {
+                Concurrency::Jobs::Run( []( void* const io_data )
+                {
+                    const auto& data = *static_cast<sJobData*>( io_data );
+                    data.stages->values_first[data.index] = data.index + 1;
+                }, &data, &counter_first );
+            }
+            for ( auto& data : jobData )
+            {
+                Concurrency::Jobs::Run( []( void* const io_data )
+                {
+                    const auto& data = *static_cast<sJobData*>( io_data );
+                    uint64_t sum = 0;
+                    for ( const auto value : data.stages->values_first )
+                    {
+                        sum += value;
+                    }
+                    data.stages->sums_second[data.index] = sum;
+                }, &data, &counter_second, &counter_first );
+            }
+            Concurrency::Jobs::WaitForCounter( counter_second );
+            for ( const auto sum : stages.sums_second )
+            {
+                if ( sum != ( stageJobCount * ( stageJobCount + 1 ) ) / 2 )
+                {
+                    Logging::OutputError( "A job ran before the jobs that it depended on had finished" );
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool RunFiberChainBenchmark()
+    {
+        using namespace eae6320;
+
+        auto isCorrect = true;
+        OutputTiming( "Waiting for a job on a fiber", s_fiberChainLength, MeasureSecondsPerElement( s_fiberChainLength, [&isCorrect]()
+        {
+            sFiberChainLink link{ s_fiberChainLength, 0 };
+            Concurrency::Jobs::cCounter counter;
+            Concurrency::Jobs::RunOnFiber( FiberChainJob, &link, &counter );
+            Concurrency::Jobs::WaitForCounter( counter );
+            if ( link.sum != ( s_fiberChainLength * ( s_fiberChainLength + 1 ) ) / 2 )
+            {
+                isCorrect = false;
+            }
+        } ) );
+        if ( !isCorrect )
+        {
+            Logging::OutputError( "A job that waited on a fiber didn't get the result of the job that it waited for" );
+        }
+        return isCorrect;
+    }
+
+    void FiberChainJob( void* const io_link )
+    {
+        using namespace eae6320;
+
+        auto& link = *static_cast<sFiberChainLink*>( io_link );
+        if ( link.remainingLength > 0 )
+        {
+            sFiberChainLink nextLink{ link.remainingLength - 1, 0 };
+            Concurrency::Jobs::cCounter counter;
+            Concurrency::Jobs::RunOnFiber( FiberChainJob, &nextLink, &counter );
+            // This job's fiber is parked while it waits
+            // instead of its thread running the next job on top of this one
+            Concurrency::Jobs::WaitForCounter( counter );
+            link.sum = nextLink.sum + link.remainingLength;
+        }
+        else
+        {
+            link.sum = 0;
+        }
+    }
+
+    void EmptyJob( void* const )
+    {
+
+    }
+
+    void OutputSpeedUp( const char* const i_name, const size_t i_elementCount,
+        const double i_secondsPerElement_serial, const double i_secondsPerElement_parallel )
+    {
+        eae6320::Logging::OutputMessage( "Benchmark: %-40s %7u elements: %9.2f ns/op serial %9.2f ns/op parallel (%.2fx)",
+            i_name, static_cast<unsigned int>( i_elementCount ), i_secondsPerElement_serial * 1.0e9, i_secondsPerElement_parallel * 1.0e9,
+            ( i_secondsPerElement_parallel > 0.0 ) ? ( i_secondsPerElement_serial / i_secondsPerElement_parallel ) : 0.0 );
+    }
+}
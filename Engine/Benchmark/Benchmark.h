@@ -0,0 +1,76 @@
+/*
+    This file measures the speed and accuracy of the engine's math
+    (the Math, Transform, and Physics libraries)
+
+    Every benchmark is run for several different numbers of elements
+    so that the cost of each operation can be seen both when the data fits in the cache and when it doesn't.
+    The results are written to the log as nanoseconds per operation and millions of operations per second.
+
+    The accuracy checks compare the single-precision results with double-precision references
+    and report the worst error in ULPs ("units in the last place").
+    The error is measured relative to the magnitude of the values that were combined
+    (e.g. the largest term of a dot product)
+    so that the cancellation of terms that are almost equal isn't reported as a huge error.
+
+    The SIMD implementations are also checked to give bit-identical results to the scalar ones
+    (every result is compared with the scalar code that is used when EAE6320_MATH_DISABLE_SIMD is defined),
+    and the batch quaternion multiplication, normalization, nlerp, and rotation transforms
+    must also give exactly the same results as cQuaternion.
+    CPU skinning (which is split into chunks that are skinned in parallel) is checked the same way
+    against the scalar reference skinning.
+    The half conversions are checked exhaustively:
+    Every one of the 65536 halves must convert to exactly the right float and back to the same half,
+    and every float that is checked must be truncated to exactly the right half.
+
+    The broadphase benchmarks time finding the overlapping pairs of many moving bodies
+    and check that every broadphase finds exactly the pairs that overlap.
+
+    The spatial index benchmarks time building and updating a cSpatialHashGrid with scenes of 10 thousand to 1 million boxes
+    and time box, sphere, frustum, and ray queries in those scenes,
+    and they check the results of the queries against checking every box.
+
+    The simulation benchmarks check the contacts of every pair of shapes (spheres, capsules, boxes, and convex hulls)
+    and simulate a body of every shape falling onto a body of every shape and a small stack,
+    and they check that every body comes to rest where it should.
+    They also time cWorld::Update() with 100 thousand moving bodies for each broadphase
+    and check that every broadphase's world simulates exactly the same thing.
+
+    The job system benchmarks time the same work done serially and with Concurrency::Jobs::ParallelFor()
+    and check that both get exactly the same results,
+    and they also time how long it takes to run an empty job
+    and how long a job that runs on a fiber takes to wait for another one.
+
+    The benchmarks are run when the application starts if the user settings file requests it
+    (see UserSettings.h),
+    and they can also be run on their own by BenchmarkExe (see Tools/BenchmarkExe/EntryPoint.cpp)
+*/
+
+#ifndef EAE6320_BENCHMARK_H
+#define EAE6320_BENCHMARK_H
+
+// Include Files
+//==============
+
+#include <Engine/Results/Results.h>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Benchmark
+    {
+        // Time must be initialized before the benchmarks are run.
+        // A failure is returned if any error is bigger than its tolerance
+        // (the timings are always written to the log)
+        cResult RunMathBenchmarks();
+        cResult RunBroadphaseBenchmarks();
+        cResult RunSpatialIndexBenchmarks();
+        cResult RunSimulationBenchmarks();
+        // The job system should be initialized first
+        // (if it isn't then the parallel timings are the same as the serial ones)
+        cResult RunJobSystemBenchmarks();
+    }
+}
+
+#endif    // EAE6320_BENCHMARK_H
@@ -6,6 +6,7 @@
 
 #include <Engine/UserInput/UserInput.h>
 
+#include <cstddef>
 #include <vector>
 
 // Static Data Initialization
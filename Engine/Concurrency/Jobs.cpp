@@ -0,0 +1,860 @@
+// Include Files
+//==============
+
+#include "Jobs.h"
+
+#include "cEvent.h"
+#include "cFiber.h"
+#include "cMutex.h"
+#include "cThread.h"
+#include "cWorkStealingDeque.h"
+
+#include <deque>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Helper Class Declarations
+//==========================
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        namespace Jobs
+        {
+            struct sFiber;
+
+            struct sJob
+            {
+                fJobFunction function = nullptr;
+                void* userData = nullptr;
+                cCounter* counter = nullptr;
+                // The next job that is waiting for the same counter
+                sJob* nextDependentJob = nullptr;
+                // A job from a thread's pool can't be reused until it has run
+                std::atomic<bool> isInUse{ false };
+                // A job is allocated on the heap if its thread doesn't have a pool
+                // (or if every job in the pool is still in use)
+                bool isHeapAllocated = false;
+                // A job that should run on a fiber is given one when it is executed
+                bool shouldRunOnFiber = false;
+                // If this is set then the job resumes a parked fiber instead of calling a function
+                // (see sFiber::resumeJob)
+                sFiber* fiberToResume = nullptr;
+            };
+
+            // A fiber from the job system's pool
+            struct sFiber
+            {
+                cFiber fiber;
+                // The job that the fiber is running
+                sJob* job = nullptr;
+                // When the fiber waits for a counter this job is made to depend on it,
+                // and so the fiber is resumed by whichever thread runs this job after the counter reaches zero
+                sJob resumeJob;
+                sFiber* nextFreeFiber = nullptr;
+            };
+
+            // Increments the counter and then submits the job once the dependency has reached zero
+            void SubmitNewJob( sJob* const io_job, cCounter* const io_counter, cCounter* const io_dependency );
+            // Runs the job and then frees it
+            // (or switches to the fiber that runs it)
+            void ExecuteJob( sJob* const io_job );
+            // A counter's list of dependent jobs is set to this when the count reaches zero
+            sJob* GetReleasedDependentJobsMarker();
+        }
+    }
+}
+
+namespace
+{
+    // The state of a thread that the job system knows about
+    struct sThread
+    {
+        eae6320::Concurrency::cWorkStealingDeque<eae6320::Concurrency::Jobs::sJob*> deque;
+        // Jobs are taken from the pool in order and reused when the end is reached
+        std::unique_ptr<eae6320::Concurrency::Jobs::sJob[]> jobPool;
+        size_t nextJobIndex = 0;
+        // Thieves start at a different random thread every time
+        // so that they don't all steal from the same one
+        uint32_t randomState = 0;
+        eae6320::Concurrency::cThread thread;
+    };
+
+    // The state of any thread that runs jobs on fibers
+    struct sThreadFibers
+    {
+        // The thread itself, which the pool's fibers switch back to
+        eae6320::Concurrency::cFiber threadFiber;
+        bool isThreadFiberInitialized = false;
+        // The pool's fiber that the thread is running
+        // (or null if the thread is running on its own stack)
+        eae6320::Concurrency::Jobs::sFiber* currentFiber = nullptr;
+        // A fiber that switches back to its thread leaves one of these
+        // so that the thread can free or park the fiber after it has stopped running
+        // (a parked fiber could otherwise be resumed by another thread before it had stopped)
+        eae6320::Concurrency::Jobs::sFiber* fiberToFree = nullptr;
+        eae6320::Concurrency::Jobs::sFiber* fiberToPark = nullptr;
+        const eae6320::Concurrency::Jobs::cCounter* counterToWaitFor = nullptr;
+    };
+}
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // Each thread's pool should be big enough for all of the jobs that it has running at once
+    constexpr size_t s_jobPoolSize = 4096;
+    // Other threads (e.g. the application loop thread) can register to get their own deques
+    constexpr unsigned int s_maxRegisteredThreadCount = 4;
+    // An idle worker thread tries to find a job this many times before it sleeps
+    constexpr unsigned int s_idleSpinCount = 64;
+    // A sleeping worker thread wakes up this often to check whether it should exit
+    constexpr unsigned int s_sleepTime_inMilliseconds = 10;
+
+    // The worker threads come first and then the registered threads
+    std::vector<std::unique_ptr<sThread>> s_threads;
+    unsigned int s_workerThreadCount = 0;
+    std::atomic<unsigned int> s_registeredThreadCount( 0 );
+    bool s_isInitialized = false;
+
+    // The index in s_threads of the current thread
+    // (or invalid if the job system doesn't know about the thread).
+    // Code that can run on a fiber reads it with GetCurrentThreadIndex()
+    constexpr unsigned int s_invalidThreadIndex = ~0u;
+    thread_local unsigned int s_threadIndex = s_invalidThreadIndex;
+
+    // The jobs that are run by threads that the job system doesn't know about
+    std::deque<eae6320::Concurrency::Jobs::sJob*> s_sharedJobs;
+    eae6320::Concurrency::cMutex s_sharedJobsMutex;
+    std::atomic<size_t> s_sharedJobCount( 0 );
+
+    // Worker threads that can't find any jobs sleep until this is signaled
+    eae6320::Concurrency::cEvent s_whenJobsAreAvailable;
+    std::atomic<unsigned int> s_sleepingWorkerThreadCount( 0 );
+    std::atomic<bool> s_shouldWorkerThreadsExit( false );
+
+    // This is how many jobs can be running on fibers at once
+    // (including the ones that are parked)
+    constexpr size_t s_fiberCount = 128;
+    // A fiber's stack is small,
+    // and so a job that runs on a fiber shouldn't put big arrays on the stack
+    constexpr size_t s_fiberStackSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<eae6320::Concurrency::Jobs::sFiber>> s_fibers;
+    eae6320::Concurrency::Jobs::sFiber* s_firstFreeFiber = nullptr;
+    eae6320::Concurrency::cMutex s_freeFibersMutex;
+
+    thread_local sThreadFibers s_threadFibers;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    eae6320::Concurrency::Jobs::sJob* AllocateJob();
+    // The job is pushed to the current thread's deque (or the shared queue)
+    void Submit( eae6320::Concurrency::Jobs::sJob* const io_job );
+    // Returns null if there are no jobs
+    eae6320::Concurrency::Jobs::sJob* FindJob();
+    // The thread index is invalid if the job system doesn't know about the current thread
+    eae6320::Concurrency::Jobs::sJob* StealJob( const unsigned int i_threadIndex );
+    void WakeWorkerThread();
+    void EntryPointWorkerThread( void* const io_threadIndex );
+
+    // Thread-Local State
+    //-------------------
+
+    // A fiber can be resumed on a different thread than the one that it was running on,
+    // but a compiler could keep the address of a thread-local variable from before the fiber switched,
+    // and so code that can run on a fiber gets the thread's state from functions that can't be inlined
+#if defined( EAE6320_PLATFORM_WINDOWS )
+    __declspec( noinline )
+#else
+    __attribute__(( noinline ))
+#endif
+    unsigned int GetCurrentThreadIndex();
+#if defined( EAE6320_PLATFORM_WINDOWS )
+    __declspec( noinline )
+#else
+    __attribute__(( noinline ))
+#endif
+    sThreadFibers& GetCurrentThreadFibers();
+
+    // Fibers
+    //-------
+
+    // A thread is turned into a fiber the first time that it switches to one
+    bool PrepareThreadForFibers( sThreadFibers& io_threadFibers );
+    // Returns null if every fiber is in use
+    eae6320::Concurrency::Jobs::sFiber* AllocateFiber();
+    void FreeFiber( eae6320::Concurrency::Jobs::sFiber* const io_fiber );
+    void EntryPointFiber( void* const io_fiber );
+}
+
+// Interface
+//==========
+
+// Running
+//--------
+
+void eae6320::Concurrency::Jobs::Run( const fJobFunction i_function, void* const io_userData,
+    cCounter* const io_counter, cCounter* const io_dependency )
+{
+    EAE6320_ASSERT( i_function );
+    auto* const job = AllocateJob();
+    job->function = i_function;
+    job->userData = io_userData;
+    job->shouldRunOnFiber = false;
+    SubmitNewJob( job, io_counter, io_dependency );
+}
+
+void eae6320::Concurrency::Jobs::RunOnFiber( const fJobFunction i_function, void* const io_userData,
+    cCounter* const io_counter, cCounter* const io_dependency )
+{
+    EAE6320_ASSERT( i_function );
+    auto* const job = AllocateJob();
+    job->function = i_function;
+    job->userData = io_userData;
+    job->shouldRunOnFiber = true;
+    SubmitNewJob( job, io_counter, io_dependency );
+}
+
+void eae6320::Concurrency::Jobs::WaitForCounter( const cCounter& i_counter )
+{
+    // A job that is running on a fiber gives its thread back until the counter reaches zero
+    {
+        auto& threadFibers = GetCurrentThreadFibers();
+        if ( threadFibers.currentFiber )
+        {
+            if ( !i_counter.IsDone() )
+            {
+                // The thread parks the fiber after switching back to its own stack (see ExecuteJob())
+                auto* const fiber = threadFibers.currentFiber;
+                threadFibers.fiberToPark = fiber;
+                threadFibers.counterToWaitFor = &i_counter;
+                fiber->fiber.SwitchTo( threadFibers.threadFiber );
+                // The fiber could now be running on a different thread,
+                // and so the thread's state must not be used again in this function
+            }
+            EAE6320_ASSERT( i_counter.IsDone() );
+            return;
+        }
+    }
+    while ( !i_counter.IsDone() )
+    {
+        if ( auto* const job = FindJob() )
+        {
+            ExecuteJob( job );
+        }
+        else
+        {
+            // The remaining jobs are running on other threads
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Threads
+//--------
+
+unsigned int eae6320::Concurrency::Jobs::GetThreadCount()
+{
+    return s_workerThreadCount + 1;
+}
+
+unsigned int eae6320::Concurrency::Jobs::GetWorkerThreadCount()
+{
+    return s_workerThreadCount;
+}
+
+eae6320::cResult eae6320::Concurrency::Jobs::RegisterCurrentThread()
+{
+    if ( !s_isInitialized )
+    {
+        EAE6320_ASSERTF( false, "A thread can't be registered until the job system has been initialized" );
+        return Results::Failure;
+    }
+    if ( GetCurrentThreadIndex() != s_invalidThreadIndex )
+    {
+        return Results::success;
+    }
+    const auto registeredThreadIndex = s_registeredThreadCount.fetch_add( 1 );
+    if ( registeredThreadIndex >= s_maxRegisteredThreadCount )
+    {
+        s_registeredThreadCount.fetch_sub( 1 );
+        EAE6320_ASSERTF( false, "No more than %u threads can be registered with the job system", s_maxRegisteredThreadCount );
+        Logging::OutputError( "A thread couldn't be registered with the job system because %u threads already are", s_maxRegisteredThreadCount );
+        return Results::Failure;
+    }
+    s_threadIndex = s_workerThreadCount + registeredThreadIndex;
+    return Results::success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::Jobs::Initialize( const unsigned int i_workerThreadCount )
+{
+    auto result = Results::success;
+
+    if ( s_isInitialized )
+    {
+        EAE6320_ASSERTF( false, "The job system can't be initialized twice" );
+        return Results::Failure;
+    }
+
+    if ( i_workerThreadCount != ~0u )
+    {
+        s_workerThreadCount = i_workerThreadCount;
+    }
+    else
+    {
+        // The thread that initializes the job system is expected to run jobs too
+        const auto logicalProcessorCount = std::thread::hardware_concurrency();
+        s_workerThreadCount = ( logicalProcessorCount > 1 ) ? ( logicalProcessorCount - 1 ) : 0;
+    }
+
+    // Every thread's state is created now
+    // so that the threads can index into the vector without locking it
+    {
+        const auto threadCount = s_workerThreadCount + s_maxRegisteredThreadCount;
+        s_threads.reserve( threadCount );
+        for ( unsigned int i = 0; i < threadCount; ++i )
+        {
+            auto* const thread = new ( std::nothrow ) sThread;
+            if ( !thread )
+            {
+                result = Results::outOfMemory;
+                EAE6320_ASSERTF( false, "Couldn't allocate memory for the job system's threads" );
+                Logging::OutputError( "Failed to allocate memory for the job system's threads" );
+                goto OnExit;
+            }
+            s_threads.emplace_back( thread );
+            thread->jobPool.reset( new ( std::nothrow ) sJob[s_jobPoolSize] );
+            if ( !thread->jobPool )
+            {
+                result = Results::outOfMemory;
+                EAE6320_ASSERTF( false, "Couldn't allocate memory for the job system's job pools" );
+                Logging::OutputError( "Failed to allocate memory for the job system's job pools" );
+                goto OnExit;
+            }
+            thread->randomState = 2463534242u + ( i * 2654435761u );
+        }
+    }
+    // The fibers are all created now
+    // so that a job never has to wait for a fiber to be created
+    {
+        s_fibers.reserve( s_fiberCount );
+        for ( size_t i = 0; i < s_fiberCount; ++i )
+        {
+            std::unique_ptr<sFiber> fiber( new ( std::nothrow ) sFiber );
+            if ( !fiber )
+            {
+                result = Results::outOfMemory;
+                EAE6320_ASSERTF( false, "Couldn't allocate memory for the job system's fibers" );
+                Logging::OutputError( "Failed to allocate memory for the job system's fibers" );
+                goto OnExit;
+            }
+            if ( !( result = fiber->fiber.Initialize( EntryPointFiber, fiber.get(), s_fiberStackSize ) ) )
+            {
+                EAE6320_ASSERTF( false, "Couldn't initialize the job system's fibers" );
+                Logging::OutputError( "The job system's fiber %u couldn't be initialized", static_cast<unsigned int>( i ) );
+                goto OnExit;
+            }
+            fiber->resumeJob.fiberToResume = fiber.get();
+            fiber->nextFreeFiber = s_firstFreeFiber;
+            s_firstFreeFiber = fiber.get();
+            s_fibers.push_back( std::move( fiber ) );
+        }
+    }
+    if ( !( result = s_whenJobsAreAvailable.Initialize( EventType::RESET_AUTOMATICALLY_AFTER_BEING_SIGNALED ) ) )
+    {
+        EAE6320_ASSERTF( false, "Couldn't initialize the job system's event" );
+        goto OnExit;
+    }
+    s_shouldWorkerThreadsExit = false;
+    s_isInitialized = true;
+    // The calling thread is registered before the workers start so that it gets the first registered deque
+    if ( !( result = RegisterCurrentThread() ) )
+    {
+        goto OnExit;
+    }
+    for ( unsigned int i = 0; i < s_workerThreadCount; ++i )
+    {
+        // The index is passed as the user data rather than a pointer to it
+        if ( !( result = s_threads[i]->thread.Start( EntryPointWorkerThread, reinterpret_cast<void*>( static_cast<uintptr_t>( i ) ) ) ) )
+        {
+            EAE6320_ASSERTF( false, "Couldn't start a job system worker thread" );
+            Logging::OutputError( "The job system's worker thread %u couldn't be started", i );
+            // The threads that did start must be stopped
+            s_workerThreadCount = i;
+            goto OnExit;
+        }
+    }
+
+    Logging::OutputMessage( "Initialized the job system with %u worker threads and %u fibers",
+        s_workerThreadCount, static_cast<unsigned int>( s_fiberCount ) );
+
+OnExit:
+
+    if ( !result )
+    {
+        CleanUp();
+    }
+
+    return result;
+}
+
+bool eae6320::Concurrency::Jobs::IsInitialized()
+{
+    return s_isInitialized;
+}
+
+eae6320::cResult eae6320::Concurrency::Jobs::CleanUp()
+{
+    auto result = Results::success;
+
+    // Stop the worker threads
+    {
+        s_shouldWorkerThreadsExit = true;
+        for ( unsigned int i = 0; i < s_workerThreadCount; ++i )
+        {
+            WakeWorkerThread();
+        }
+        for ( unsigned int i = 0; i < s_workerThreadCount; ++i )
+        {
+            const auto localResult = WaitForThreadToStop( s_threads[i]->thread );
+            if ( !localResult )
+            {
+                EAE6320_ASSERTF( false, "Couldn't wait for a job system worker thread to exit" );
+                if ( result )
+                {
+                    result = localResult;
+                }
+            }
+        }
+    }
+    EAE6320_ASSERTF( s_sharedJobCount == 0, "The job system was cleaned up before every job had run" );
+    s_sharedJobs.clear();
+    s_sharedJobCount = 0;
+    s_threads.clear();
+    // Every fiber must be free
+    // (a fiber that is still running a job can't be cleaned up)
+    {
+        size_t freeFiberCount = 0;
+        for ( auto* fiber = s_firstFreeFiber; fiber; fiber = fiber->nextFreeFiber )
+        {
+            ++freeFiberCount;
+        }
+        EAE6320_ASSERTF( freeFiberCount == s_fibers.size(), "The job system was cleaned up while jobs were running on fibers" );
+        s_firstFreeFiber = nullptr;
+        s_fibers.clear();
+    }
+    {
+        const auto localResult = s_whenJobsAreAvailable.CleanUp();
+        if ( !localResult )
+        {
+            EAE6320_ASSERT( false );
+            if ( result )
+            {
+                result = localResult;
+            }
+        }
+    }
+    s_workerThreadCount = 0;
+    s_registeredThreadCount = 0;
+    // Only the calling thread's index can be reset
+    // (another registered thread must not use the job system again after it has been cleaned up)
+    s_threadIndex = s_invalidThreadIndex;
+    s_isInitialized = false;
+
+    return result;
+}
+
+eae6320::Concurrency::Jobs::cCounter::cCounter()
+    :
+    m_dependentJobs( GetReleasedDependentJobsMarker() )
+{
+
+}
+
+eae6320::Concurrency::Jobs::cCounter::~cCounter()
+{
+    EAE6320_ASSERTF( IsDone() && ( m_dependentJobs.load() == GetReleasedDependentJobsMarker() ),
+        "A job counter was destroyed before its jobs had run" );
+}
+
+// Implementation
+//===============
+
+void eae6320::Concurrency::Jobs::cCounter::Increment()
+{
+    // A counter that is reused starts with no dependent jobs
+    if ( m_count.fetch_add( 1, std::memory_order_relaxed ) == 0 )
+    {
+        m_dependentJobs.store( nullptr, std::memory_order_relaxed );
+    }
+}
+
+void eae6320::Concurrency::Jobs::cCounter::Decrement()
+{
+    auto count = m_count.load( std::memory_order_acquire );
+    while ( true )
+    {
+        EAE6320_ASSERT( count > 0 );
+        if ( count == 1 )
+        {
+            // This is the last job,
+            // and so the dependent jobs are taken before the count reaches zero
+            // because a waiting thread could destroy the counter as soon as it does
+            auto* dependentJobs = m_dependentJobs.exchange( GetReleasedDependentJobsMarker(), std::memory_order_acq_rel );
+            m_count.fetch_sub( 1, std::memory_order_release );
+            while ( dependentJobs )
+            {
+                auto* const job = dependentJobs;
+                dependentJobs = job->nextDependentJob;
+                job->nextDependentJob = nullptr;
+                Submit( job );
+            }
+            return;
+        }
+        if ( m_count.compare_exchange_weak( count, count - 1, std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+            return;
+        }
+    }
+}
+
+bool eae6320::Concurrency::Jobs::cCounter::AddDependentJob( sJob* const io_job )
+{
+    auto* dependentJobs = m_dependentJobs.load( std::memory_order_acquire );
+    do
+    {
+        if ( dependentJobs == GetReleasedDependentJobsMarker() )
+        {
+            return false;
+        }
+        io_job->nextDependentJob = dependentJobs;
+    } while ( !m_dependentJobs.compare_exchange_weak( dependentJobs, io_job, std::memory_order_acq_rel, std::memory_order_acquire ) );
+    return true;
+}
+
+void eae6320::Concurrency::Jobs::SubmitNewJob( sJob* const io_job, cCounter* const io_counter, cCounter* const io_dependency )
+{
+    // The counter is incremented before the job can run
+    // so that it can't reach zero until the job has finished
+    if ( io_counter )
+    {
+        io_counter->Increment();
+    }
+    io_job->counter = io_counter;
+    if ( !io_dependency || !io_dependency->AddDependentJob( io_job ) )
+    {
+        Submit( io_job );
+    }
+}
+
+void eae6320::Concurrency::Jobs::ExecuteJob( sJob* const io_job )
+{
+    // A job that runs on a fiber is switched to from the thread's own stack
+    // (a job that is already running on a fiber runs any jobs that it executes on the same fiber)
+    {
+        auto& threadFibers = GetCurrentThreadFibers();
+        if ( !threadFibers.currentFiber )
+        {
+            auto* fiber = io_job->fiberToResume;
+            if ( ( fiber || io_job->shouldRunOnFiber ) && PrepareThreadForFibers( threadFibers ) )
+            {
+                if ( !fiber )
+                {
+                    fiber = AllocateFiber();
+                    if ( fiber )
+                    {
+                        fiber->job = io_job;
+                    }
+                }
+                if ( fiber )
+                {
+                    threadFibers.currentFiber = fiber;
+                    threadFibers.threadFiber.SwitchTo( fiber->fiber );
+                    // The fiber has either finished its job or is waiting for a counter
+                    // (the thread's own stack never moves to a different thread,
+                    // and so the thread's state can still be used)
+                    threadFibers.currentFiber = nullptr;
+                    if ( threadFibers.fiberToFree )
+                    {
+                        FreeFiber( threadFibers.fiberToFree );
+                        threadFibers.fiberToFree = nullptr;
+                    }
+                    else if ( threadFibers.fiberToPark )
+                    {
+                        auto* const fiberToPark = threadFibers.fiberToPark;
+                        auto* const counter = const_cast<cCounter*>( threadFibers.counterToWaitFor );
+                        threadFibers.fiberToPark = nullptr;
+                        threadFibers.counterToWaitFor = nullptr;
+                        // If the counter reached zero while the fiber was switching back
+                        // then it can be resumed immediately
+                        if ( !counter->AddDependentJob( &fiberToPark->resumeJob ) )
+                        {
+                            Submit( &fiberToPark->resumeJob );
+                        }
+                    }
+                    return;
+                }
+            }
+            // If there are no free fibers the job runs on the thread's own stack
+            // (and it will run other jobs while it waits for counters)
+        }
+        EAE6320_ASSERTF( !io_job->fiberToResume, "A parked fiber can only be resumed from a thread's own stack (by a thread that can be turned into a fiber)" );
+    }
+    io_job->function( io_job->userData );
+    // The job is freed before the counter is decremented
+    // because a waiting thread could destroy the counter as soon as it reaches zero
+    auto* const counter = io_job->counter;
+    if ( io_job->isHeapAllocated )
+    {
+        delete io_job;
+    }
+    else
+    {
+        io_job->isInUse.store( false, std::memory_order_release );
+    }
+    if ( counter )
+    {
+        counter->Decrement();
+    }
+}
+
+eae6320::Concurrency::Jobs::sJob* eae6320::Concurrency::Jobs::GetReleasedDependentJobsMarker()
+{
+    // The marker is never run
+    static sJob s_marker;
+    return &s_marker;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    eae6320::Concurrency::Jobs::sJob* AllocateJob()
+    {
+        using namespace eae6320::Concurrency::Jobs;
+
+        const auto threadIndex = GetCurrentThreadIndex();
+        if ( threadIndex != s_invalidThreadIndex )
+        {
+            auto& thread = *s_threads[threadIndex];
+            auto& job = thread.jobPool[thread.nextJobIndex];
+            // Only this thread allocates from its pool,
+            // and so the job only needs to be checked once
+            if ( !job.isInUse.load( std::memory_order_acquire ) )
+            {
+                thread.nextJobIndex = ( thread.nextJobIndex + 1 ) % s_jobPoolSize;
+                job.isInUse.store( true, std::memory_order_relaxed );
+                return &job;
+            }
+        }
+        auto* const job = new sJob;
+        job->isHeapAllocated = true;
+        return job;
+    }
+
+    void Submit( eae6320::Concurrency::Jobs::sJob* const io_job )
+    {
+        const auto threadIndex = GetCurrentThreadIndex();
+        if ( threadIndex != s_invalidThreadIndex )
+        {
+            s_threads[threadIndex]->deque.Push( io_job );
+        }
+        else
+        {
+            eae6320::Concurrency::cMutex::cScopeLock scopeLock( s_sharedJobsMutex );
+            s_sharedJobs.push_back( io_job );
+            s_sharedJobCount.fetch_add( 1 );
+        }
+        if ( s_sleepingWorkerThreadCount.load() > 0 )
+        {
+            WakeWorkerThread();
+        }
+    }
+
+    eae6320::Concurrency::Jobs::sJob* FindJob()
+    {
+        eae6320::Concurrency::Jobs::sJob* job = nullptr;
+        const auto threadIndex = GetCurrentThreadIndex();
+        // A thread works on its own newest job first
+        if ( ( threadIndex != s_invalidThreadIndex ) && s_threads[threadIndex]->deque.Pop( job ) )
+        {
+            return job;
+        }
+        // The shared queue is checked before stealing
+        // because the threads that use it can't run each other's jobs
+        if ( s_sharedJobCount.load( std::memory_order_relaxed ) > 0 )
+        {
+            eae6320::Concurrency::cMutex::cScopeLock scopeLock( s_sharedJobsMutex );
+            if ( !s_sharedJobs.empty() )
+            {
+                job = s_sharedJobs.front();
+                s_sharedJobs.pop_front();
+                s_sharedJobCount.fetch_sub( 1 );
+                return job;
+            }
+        }
+        return StealJob( threadIndex );
+    }
+
+    eae6320::Concurrency::Jobs::sJob* StealJob( const unsigned int i_threadIndex )
+    {
+        const auto threadCount = s_workerThreadCount + s_registeredThreadCount.load( std::memory_order_relaxed );
+        if ( threadCount == 0 )
+        {
+            return nullptr;
+        }
+        // An xorshift random number picks the first thread to steal from
+        unsigned int firstThreadIndex = 0;
+        if ( i_threadIndex != s_invalidThreadIndex )
+        {
+            auto& randomState = s_threads[i_threadIndex]->randomState;
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 17;
+            randomState ^= randomState << 5;
+            firstThreadIndex = randomState % threadCount;
+        }
+        for ( unsigned int i = 0; i < threadCount; ++i )
+        {
+            const auto threadIndex = ( firstThreadIndex + i ) % threadCount;
+            if ( threadIndex == i_threadIndex )
+            {
+                continue;
+            }
+            auto& deque = s_threads[threadIndex]->deque;
+            eae6320::Concurrency::Jobs::sJob* job;
+            if ( !deque.IsProbablyEmpty() && deque.Steal( job ) )
+            {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    unsigned int GetCurrentThreadIndex()
+    {
+        return s_threadIndex;
+    }
+
+    sThreadFibers& GetCurrentThreadFibers()
+    {
+        return s_threadFibers;
+    }
+
+    bool PrepareThreadForFibers( sThreadFibers& io_threadFibers )
+    {
+        if ( !io_threadFibers.isThreadFiberInitialized )
+        {
+            if ( !io_threadFibers.threadFiber.InitializeFromCurrentThread() )
+            {
+                return false;
+            }
+            io_threadFibers.isThreadFiberInitialized = true;
+        }
+        return true;
+    }
+
+    eae6320::Concurrency::Jobs::sFiber* AllocateFiber()
+    {
+        eae6320::Concurrency::cMutex::cScopeLock scopeLock( s_freeFibersMutex );
+        auto* const fiber = s_firstFreeFiber;
+        if ( fiber )
+        {
+            s_firstFreeFiber = fiber->nextFreeFiber;
+            fiber->nextFreeFiber = nullptr;
+        }
+        return fiber;
+    }
+
+    void FreeFiber( eae6320::Concurrency::Jobs::sFiber* const io_fiber )
+    {
+        eae6320::Concurrency::cMutex::cScopeLock scopeLock( s_freeFibersMutex );
+        io_fiber->nextFreeFiber = s_firstFreeFiber;
+        s_firstFreeFiber = io_fiber;
+    }
+
+    void EntryPointFiber( void* const io_fiber )
+    {
+        using namespace eae6320::Concurrency;
+
+        auto* const fiber = static_cast<Jobs::sFiber*>( io_fiber );
+        // A fiber never exits,
+        // and so it is reused by switching to it again with a different job
+        while ( true )
+        {
+            // The job runs on this fiber because the thread is already running it
+            Jobs::ExecuteJob( fiber->job );
+            fiber->job = nullptr;
+            // The thread frees the fiber after switching back to its own stack
+            auto& threadFibers = GetCurrentThreadFibers();
+            threadFibers.fiberToFree = fiber;
+            fiber->fiber.SwitchTo( threadFibers.threadFiber );
+        }
+    }
+
+    void WakeWorkerThread()
+    {
+        // A failure has already been reported by the event
+        if ( !s_whenJobsAreAvailable.Signal() )
+        {
+            EAE6320_ASSERTF( false, "Couldn't wake a worker thread" );
+        }
+    }
+
+    void EntryPointWorkerThread( void* const io_threadIndex )
+    {
+        using namespace eae6320::Concurrency;
+
+        s_threadIndex = static_cast<unsigned int>( reinterpret_cast<uintptr_t>( io_threadIndex ) );
+        unsigned int failedAttemptCount = 0;
+        while ( !s_shouldWorkerThreadsExit.load( std::memory_order_relaxed ) )
+        {
+            if ( auto* const job = FindJob() )
+            {
+                // Finding a job means there could be more,
+                // and so another sleeping thread is woken up to look
+                if ( s_sleepingWorkerThreadCount.load( std::memory_order_relaxed ) > 0 )
+                {
+                    WakeWorkerThread();
+                }
+                Jobs::ExecuteJob( job );
+                failedAttemptCount = 0;
+                continue;
+            }
+            if ( ++failedAttemptCount < s_idleSpinCount )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            // The thread announces that it is going to sleep and then checks for jobs one more time
+            // so that a job that is submitted at the same time either is found or wakes the thread up
+            s_sleepingWorkerThreadCount.fetch_add( 1 );
+            if ( auto* const job = FindJob() )
+            {
+                s_sleepingWorkerThreadCount.fetch_sub( 1 );
+                Jobs::ExecuteJob( job );
+                failedAttemptCount = 0;
+                continue;
+            }
+            WaitForEvent( s_whenJobsAreAvailable, s_sleepTime_inMilliseconds );
+            s_sleepingWorkerThreadCount.fetch_sub( 1 );
+            failedAttemptCount = 0;
+        }
+        s_threadIndex = s_invalidThreadIndex;
+    }
+}
@@ -0,0 +1,166 @@
+/*
+    The job system spreads work across a fixed pool of worker threads
+
+    A job is a function and a pointer to its data.
+    Every thread that uses the job system has its own work-stealing deque (see cWorkStealingDeque.h):
+    a thread pushes the jobs that it runs to its own deque and pops them from it,
+    and a worker thread that runs out of jobs steals from the other threads' deques.
+    A thread that the job system doesn't know about can still run jobs,
+    but its jobs are put in a shared queue that needs a lock.
+
+    A counter keeps track of how many of a group of jobs haven't finished yet:
+        * A thread that waits for a counter runs other jobs while it waits
+            (and so the main thread helps instead of sleeping)
+        * A job can depend on a counter,
+            in which case it isn't given to any thread until that counter reaches zero
+
+    A job can also be run on a fiber (see cFiber.h) from a pool that the job system keeps.
+    When a job that is running on a fiber waits for a counter the fiber is parked
+    and its thread goes back to running other jobs,
+    and the fiber is resumed (possibly on a different thread) once the counter reaches zero.
+    This allows a long chain of jobs that wait for each other
+    without any thread being blocked or running the whole chain on its own stack.
+    A fiber's stack is small, however,
+    and a job that runs on a fiber must not wait for a counter while it has a mutex locked
+    (because it could be resumed on a different thread than the one that locked it).
+
+    The job system must be initialized before jobs can run in parallel,
+    but every function can be called without it (the jobs run on the calling thread).
+*/
+
+#ifndef EAE6320_CONCURRENCY_JOBS_H
+#define EAE6320_CONCURRENCY_JOBS_H
+
+// Include Files
+//==============
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Results/Results.h>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        namespace Jobs
+        {
+            struct sJob;
+        }
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        namespace Jobs
+        {
+            // A job is given the data that was provided when it was run
+            using fJobFunction = void (*)( void* const io_userData );
+
+            // A counter must not be destroyed while any of its jobs (or any jobs that depend on it) haven't run.
+            // A counter can be reused once it has reached zero,
+            // but jobs should only be made to depend on it by the thread that runs its jobs
+            class cCounter
+            {
+                // Interface
+                //==========
+
+            public:
+
+                bool IsDone() const { return m_count.load( std::memory_order_acquire ) == 0; }
+
+                // Initialization / Clean Up
+                //--------------------------
+
+                cCounter();
+                cCounter( const cCounter& ) = delete;
+                cCounter& operator =( const cCounter& ) = delete;
+                ~cCounter();
+
+                // Data
+                //=====
+
+            private:
+
+                std::atomic<uint32_t> m_count{ 0 };
+                // The jobs that are waiting for the count to reach zero.
+                // The list is replaced with a marker when the count reaches zero,
+                // and so a job that is added after that knows that it can run immediately
+                std::atomic<sJob*> m_dependentJobs;
+
+                // Implementation
+                //===============
+
+            private:
+
+                void Increment();
+                void Decrement();
+                // Returns false if the count was already zero
+                // (in which case the job should be run immediately)
+                bool AddDependentJob( sJob* const io_job );
+
+                friend void SubmitNewJob( sJob* const io_job, cCounter* const io_counter, cCounter* const io_dependency );
+                friend void ExecuteJob( sJob* const io_job );
+            };
+
+            // Running
+            //--------
+
+            // The job is run on any thread.
+            // If a counter is provided it is incremented now and decremented when the job has finished.
+            // If a dependency is provided the job isn't run until that counter reaches zero
+            void Run( const fJobFunction i_function, void* const io_userData,
+                cCounter* const io_counter = nullptr, cCounter* const io_dependency = nullptr );
+            // This is the same as Run() except that the job is run on a fiber,
+            // and so it can wait for counters without blocking the thread that runs it.
+            // If every fiber is already in use the job is run on its thread's stack like any other job
+            void RunOnFiber( const fJobFunction i_function, void* const io_userData,
+                cCounter* const io_counter = nullptr, cCounter* const io_dependency = nullptr );
+            // If this is called from a job that is running on a fiber then the fiber is parked until the counter reaches zero.
+            // Otherwise the calling thread runs other jobs until the counter reaches zero
+            void WaitForCounter( const cCounter& i_counter );
+
+            // The range is split into pieces of (at most) the given size,
+            // and the function is called with the beginning and end of each piece: i_function( i_begin, i_end ).
+            // This only returns once every piece has been finished,
+            // and the calling thread works on pieces too.
+            // If the order that the pieces are combined in doesn't depend on which thread runs them
+            // then the results are the same as calling the function once for the whole range
+            template <typename tFunction>
+            void ParallelFor( const size_t i_begin, const size_t i_end, const size_t i_elementCountPerJob, const tFunction& i_function );
+
+            // Threads
+            //--------
+
+            // The number of threads that jobs can run on
+            // (the worker threads and the calling thread)
+            unsigned int GetThreadCount();
+            unsigned int GetWorkerThreadCount();
+            // A thread that often runs or waits for jobs (e.g. the application loop thread)
+            // should register so that it gets its own deque.
+            // The thread that initializes the job system is registered automatically
+            cResult RegisterCurrentThread();
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // If no worker thread count is specified then there is one fewer than the number of logical processors
+            cResult Initialize( const unsigned int i_workerThreadCount = ~0u );
+            bool IsInitialized();
+            // Every job that has been run must have finished
+            cResult CleanUp();
+        }
+    }
+}
+
+#include "Jobs.inl"
+
+#endif    // EAE6320_CONCURRENCY_JOBS_H
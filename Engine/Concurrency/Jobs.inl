@@ -0,0 +1,92 @@
+#ifndef EAE6320_CONCURRENCY_JOBS_INL
+#define EAE6320_CONCURRENCY_JOBS_INL
+
+// Include Files
+//==============
+
+// #include "Jobs.h"
+
+#include <algorithm>
+
+// Helper Class Declarations
+//==========================
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        namespace Jobs
+        {
+            namespace ParallelForHelpers
+            {
+                // Every job claims the next unclaimed piece until there are none left
+                // (rather than every job being given a fixed piece)
+                // so that a thread that is slowed down doesn't hold up the others
+                template <typename tFunction>
+                struct sData
+                {
+                    const tFunction* function;
+                    size_t begin;
+                    size_t end;
+                    size_t elementCountPerJob;
+                    size_t pieceCount;
+                    std::atomic<size_t> nextPiece;
+                };
+
+                template <typename tFunction>
+                void ClaimPieces( void* const io_data )
+                {
+                    auto& data = *static_cast<sData<tFunction>*>( io_data );
+                    for ( auto piece = data.nextPiece.fetch_add( 1, std::memory_order_relaxed ); piece < data.pieceCount;
+                        piece = data.nextPiece.fetch_add( 1, std::memory_order_relaxed ) )
+                    {
+                        const auto begin = data.begin + ( piece * data.elementCountPerJob );
+                        ( *data.function )( begin, std::min( begin + data.elementCountPerJob, data.end ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Interface
+//==========
+
+template <typename tFunction>
+void eae6320::Concurrency::Jobs::ParallelFor( const size_t i_begin, const size_t i_end, const size_t i_elementCountPerJob, const tFunction& i_function )
+{
+    if ( i_end <= i_begin )
+    {
+        return;
+    }
+    const auto elementCountPerJob = std::max<size_t>( i_elementCountPerJob, 1 );
+    const auto pieceCount = ( ( i_end - i_begin ) + elementCountPerJob - 1 ) / elementCountPerJob;
+    const auto threadCount = GetThreadCount();
+    if ( ( pieceCount <= 1 ) || ( threadCount <= 1 ) )
+    {
+        i_function( i_begin, i_end );
+        return;
+    }
+
+    // The data is on this thread's stack,
+    // which is safe because this function doesn't return until every job has finished
+    ParallelForHelpers::sData<tFunction> data;
+    data.function = &i_function;
+    data.begin = i_begin;
+    data.end = i_end;
+    data.elementCountPerJob = elementCountPerJob;
+    data.pieceCount = pieceCount;
+    data.nextPiece.store( 0, std::memory_order_relaxed );
+    cCounter counter;
+    // There is no point in running more jobs than there are other threads to run them
+    // (this thread claims pieces too)
+    const auto jobCount = std::min<size_t>( pieceCount - 1, threadCount - 1 );
+    for ( size_t i = 0; i < jobCount; ++i )
+    {
+        Run( ParallelForHelpers::ClaimPieces<tFunction>, &data, &counter );
+    }
+    ParallelForHelpers::ClaimPieces<tFunction>( &data );
+    WaitForCounter( counter );
+}
+
+#endif    // EAE6320_CONCURRENCY_JOBS_INL
@@ -0,0 +1,141 @@
+// Include Files
+//==============
+
+#include "../cEvent.h"
+
+#include <cerrno>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <time.h>
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Concurrency::WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds )
+{
+    if ( !i_event.m_isInitialized )
+    {
+        EAE6320_ASSERTF( false, "An event can't be waited for until it has been initialized" );
+        eae6320::Logging::OutputError( "An attempt was made to wait for an event that hadn't been initialized" );
+        return eae6320::Results::Failure;
+    }
+
+    // The time-out is converted to an absolute time before the mutex is locked
+    // so that spurious wake-ups don't restart it
+    timespec timeToStopWaiting;
+    if ( i_timeToWait_inMilliseconds != Constants::dontTimeOut )
+    {
+        clock_gettime( CLOCK_REALTIME, &timeToStopWaiting );
+        timeToStopWaiting.tv_sec += static_cast<time_t>( i_timeToWait_inMilliseconds / 1000 );
+        timeToStopWaiting.tv_nsec += static_cast<long>( i_timeToWait_inMilliseconds % 1000 ) * 1000000;
+        if ( timeToStopWaiting.tv_nsec >= 1000000000 )
+        {
+            ++timeToStopWaiting.tv_sec;
+            timeToStopWaiting.tv_nsec -= 1000000000;
+        }
+    }
+
+    auto result = Results::success;
+    pthread_mutex_lock( &i_event.m_mutex );
+    while ( !i_event.m_isSignaled )
+    {
+        const auto waitResult = ( i_timeToWait_inMilliseconds == Constants::dontTimeOut ) ?
+            pthread_cond_wait( &i_event.m_condition, &i_event.m_mutex ) :
+            pthread_cond_timedwait( &i_event.m_condition, &i_event.m_mutex, &timeToStopWaiting );
+        if ( waitResult == ETIMEDOUT )
+        {
+            result = Results::timeOut;
+            break;
+        }
+        else if ( waitResult != 0 )
+        {
+            EAE6320_ASSERTF( false, "Failed to wait for an event (error %i)", waitResult );
+            Logging::OutputError( "POSIX failed waiting for an event (error %i)", waitResult );
+            result = Results::Failure;
+            break;
+        }
+    }
+    // Only one waiting thread sees an automatically-resetting event as signaled
+    if ( result && i_event.m_shouldResetAutomatically )
+    {
+        i_event.m_isSignaled = false;
+    }
+    pthread_mutex_unlock( &i_event.m_mutex );
+    return result;
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::Signal() const
+{
+    EAE6320_ASSERTF( m_isInitialized, "An event can't be signaled until it has been initialized" );
+    pthread_mutex_lock( &m_mutex );
+    m_isSignaled = true;
+    // An automatically-resetting event only releases one waiting thread
+    const auto result = m_shouldResetAutomatically ? pthread_cond_signal( &m_condition ) : pthread_cond_broadcast( &m_condition );
+    pthread_mutex_unlock( &m_mutex );
+    if ( result == 0 )
+    {
+        return Results::success;
+    }
+    EAE6320_ASSERTF( false, "Couldn't signal event (error %i)", result );
+    Logging::OutputError( "POSIX failed to signal an event (error %i)", result );
+    return Results::Failure;
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::ResetToUnsignaled() const
+{
+    EAE6320_ASSERTF( m_isInitialized, "An event can't be reset until it has been initialized" );
+    pthread_mutex_lock( &m_mutex );
+    m_isSignaled = false;
+    pthread_mutex_unlock( &m_mutex );
+    return Results::success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cEvent::Initialize( const EventType i_type, const EventState i_initialState )
+{
+    EAE6320_ASSERTF( !m_isInitialized, "An event can't be initialized twice" );
+    {
+        const auto result = pthread_mutex_init( &m_mutex, nullptr );
+        if ( result != 0 )
+        {
+            EAE6320_ASSERTF( false, "Couldn't create an event's mutex (error %i)", result );
+            Logging::OutputError( "POSIX failed to create an event's mutex (error %i)", result );
+            return Results::Failure;
+        }
+    }
+    {
+        const auto result = pthread_cond_init( &m_condition, nullptr );
+        if ( result != 0 )
+        {
+            pthread_mutex_destroy( &m_mutex );
+            EAE6320_ASSERTF( false, "Couldn't create an event's condition variable (error %i)", result );
+            Logging::OutputError( "POSIX failed to create an event's condition variable (error %i)", result );
+            return Results::Failure;
+        }
+    }
+    m_isSignaled = i_initialState == EventState::SIGNALED;
+    m_shouldResetAutomatically = i_type == EventType::RESET_AUTOMATICALLY_AFTER_BEING_SIGNALED;
+    m_isInitialized = true;
+    return Results::success;
+}
+
+eae6320::Concurrency::cEvent::cEvent()
+{
+
+}
+
+eae6320::cResult eae6320::Concurrency::cEvent::CleanUp()
+{
+    const auto result = Results::success;
+
+    if ( m_isInitialized )
+    {
+        pthread_cond_destroy( &m_condition );
+        pthread_mutex_destroy( &m_mutex );
+        m_isInitialized = false;
+    }
+
+    return result;
+}
@@ -0,0 +1,151 @@
+// Include Files
+//==============
+
+#include "../cFiber.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cFiber::SwitchTo( cFiber& io_fiber )
+{
+    EAE6320_ASSERT( m_isInitialized && io_fiber.m_isInitialized );
+    if ( swapcontext( &m_context, &io_fiber.m_context ) != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't switch to a fiber (error %i)", errno );
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cFiber::Initialize( const fFiberFunction i_fiberFunction, void* const io_userData, const size_t i_stackSize )
+{
+    if ( m_isInitialized )
+    {
+        EAE6320_ASSERTF( false, "A fiber can't be initialized twice" );
+        Logging::OutputError( "An attempt was made to initialize a fiber that was already initialized" );
+        return Results::Failure;
+    }
+    EAE6320_ASSERT( i_fiberFunction );
+
+    auto result = Results::success;
+
+    m_fiberFunction = i_fiberFunction;
+    m_userData = io_userData;
+    // Allocate the stack
+    const auto pageSize = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+    {
+        const auto stackSize = ( ( i_stackSize + pageSize - 1 ) / pageSize ) * pageSize;
+        m_stackAllocationSize = stackSize + pageSize;
+        // The memory is only reserved, and so a fiber that doesn't use its whole stack
+        // doesn't use the physical memory for it
+        m_stackAllocation = mmap( nullptr, m_stackAllocationSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0 );
+        if ( m_stackAllocation == MAP_FAILED )
+        {
+            m_stackAllocation = nullptr;
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF( false, "Couldn't allocate a fiber's stack (error %i)", errno );
+            Logging::OutputError( "POSIX failed to allocate a fiber's stack of %u bytes (error %i)",
+                static_cast<unsigned int>( m_stackAllocationSize ), errno );
+            goto OnExit;
+        }
+        // The stack grows down, and so the guard page is at the beginning of the allocation
+        if ( mprotect( m_stackAllocation, pageSize, PROT_NONE ) != 0 )
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF( false, "Couldn't protect a fiber's guard page (error %i)", errno );
+            Logging::OutputError( "POSIX failed to protect the guard page of a fiber's stack (error %i)", errno );
+            goto OnExit;
+        }
+    }
+    // Create the context
+    {
+        if ( getcontext( &m_context ) != 0 )
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF( false, "Couldn't get a context for a fiber (error %i)", errno );
+            Logging::OutputError( "POSIX failed to get a context for a fiber (error %i)", errno );
+            goto OnExit;
+        }
+        m_context.uc_stack.ss_sp = static_cast<char*>( m_stackAllocation ) + pageSize;
+        m_context.uc_stack.ss_size = m_stackAllocationSize - pageSize;
+        // The function never returns, and so there is no context to continue with
+        m_context.uc_link = nullptr;
+        const auto fiber = reinterpret_cast<uintptr_t>( this );
+        makecontext( &m_context, reinterpret_cast<void (*)()>( EntryPointFiber ), 2,
+            static_cast<unsigned int>( static_cast<uint64_t>( fiber ) >> 32 ), static_cast<unsigned int>( fiber & 0xffffffffu ) );
+    }
+    m_isInitialized = true;
+
+OnExit:
+
+    if ( !result )
+    {
+        CleanUp();
+    }
+
+    return result;
+}
+
+eae6320::cResult eae6320::Concurrency::cFiber::InitializeFromCurrentThread()
+{
+    if ( m_isInitialized )
+    {
+        EAE6320_ASSERTF( false, "A fiber can't be initialized twice" );
+        Logging::OutputError( "An attempt was made to initialize a fiber that was already initialized" );
+        return Results::Failure;
+    }
+
+    // The thread's context is saved the first time that it switches to another fiber
+    m_isInitialized = true;
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Concurrency::cFiber::CleanUp()
+{
+    auto result = Results::success;
+
+    if ( m_stackAllocation )
+    {
+        if ( munmap( m_stackAllocation, m_stackAllocationSize ) != 0 )
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF( false, "Couldn't free a fiber's stack (error %i)", errno );
+            Logging::OutputError( "POSIX failed to free a fiber's stack (error %i)", errno );
+        }
+        m_stackAllocation = nullptr;
+        m_stackAllocationSize = 0;
+    }
+    m_fiberFunction = nullptr;
+    m_userData = nullptr;
+    m_isInitialized = false;
+
+    return result;
+}
+
+eae6320::Concurrency::cFiber::cFiber()
+{
+
+}
+
+// Implementation
+//===============
+
+void eae6320::Concurrency::cFiber::EntryPointFiber( const unsigned int i_fiber_high, const unsigned int i_fiber_low )
+{
+    auto& fiber = *reinterpret_cast<cFiber*>( static_cast<uintptr_t>( ( static_cast<uint64_t>( i_fiber_high ) << 32 ) | i_fiber_low ) );
+    fiber.m_fiberFunction( fiber.m_userData );
+    // There is no context to return to
+    EAE6320_ASSERTF( false, "A fiber's function must never return" );
+    Logging::OutputError( "A fiber's function returned, and so the application must exit" );
+    std::abort();
+}
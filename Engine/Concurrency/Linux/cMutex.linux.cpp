@@ -0,0 +1,51 @@
+// Include Files
+//==============
+
+#include "../cMutex.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cMutex::Lock()
+{
+    const auto result = pthread_mutex_lock( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't lock a mutex (error %i)", result );
+    }
+}
+
+eae6320::cResult eae6320::Concurrency::cMutex::LockIfPossible()
+{
+    return ( pthread_mutex_trylock( &m_mutex ) == 0 ) ? Results::success : Results::Failure;
+}
+
+void eae6320::Concurrency::cMutex::Unlock()
+{
+    const auto result = pthread_mutex_unlock( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't unlock a mutex (error %i)", result );
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cMutex::cMutex()
+    :
+    m_mutex( PTHREAD_MUTEX_INITIALIZER )
+{
+
+}
+
+eae6320::Concurrency::cMutex::~cMutex()
+{
+    const auto result = pthread_mutex_destroy( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't destroy a mutex (error %i)", result );
+    }
+}
@@ -0,0 +1,58 @@
+// Include Files
+//==============
+
+#include "../cMutex_recursive.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cMutexRecursive::Lock()
+{
+    const auto result = pthread_mutex_lock( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't lock a recursive mutex (error %i)", result );
+    }
+}
+
+eae6320::cResult eae6320::Concurrency::cMutexRecursive::LockIfPossible()
+{
+    return ( pthread_mutex_trylock( &m_mutex ) == 0 ) ? Results::success : Results::Failure;
+}
+
+void eae6320::Concurrency::cMutexRecursive::Unlock()
+{
+    const auto result = pthread_mutex_unlock( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't unlock a recursive mutex (error %i)", result );
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cMutexRecursive::cMutexRecursive()
+{
+    // Like a Windows critical section the mutex can be locked again by the thread that holds it
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init( &attributes );
+    pthread_mutexattr_settype( &attributes, PTHREAD_MUTEX_RECURSIVE );
+    const auto result = pthread_mutex_init( &m_mutex, &attributes );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't initialize a recursive mutex (error %i)", result );
+    }
+    pthread_mutexattr_destroy( &attributes );
+}
+
+eae6320::Concurrency::cMutexRecursive::~cMutexRecursive()
+{
+    const auto result = pthread_mutex_destroy( &m_mutex );
+    if ( result != 0 )
+    {
+        EAE6320_ASSERTF( false, "Couldn't destroy a recursive mutex (error %i)", result );
+    }
+}
@@ -0,0 +1,167 @@
+// Include Files
+//==============
+
+#include "../cThread.h"
+
+#include <cerrno>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <new>
+#include <time.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // POSIX requires a different function signature for its thread functions,
+    // and so the user-provided data is passed to a generic POSIX-appropriate function
+    struct sThreadData
+    {
+        eae6320::Concurrency::fThreadFunction threadFunction;
+        void* userData;
+    };
+    void* EntryPointThread( void* io_threadData );
+}
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Concurrency::cThread::Start( fThreadFunction const i_threadFunction, void* const io_userData )
+{
+    if ( m_isRunning )
+    {
+        EAE6320_ASSERTF( false, "A thread can't be started if it is already running" );
+        Logging::OutputError( "An attempt was made to start a thread that was already running" );
+        return Results::Failure;
+    }
+
+    // Unlike Windows the new thread is given data that it owns
+    // (and deletes when it has been extracted),
+    // and so this calling function doesn't need to wait for it
+    auto* const threadData = new ( std::nothrow ) sThreadData{ i_threadFunction, io_userData };
+    if ( !threadData )
+    {
+        EAE6320_ASSERTF( false, "Couldn't allocate memory for a new thread's data" );
+        Logging::OutputError( "A thread couldn't be started because its data couldn't be allocated" );
+        return Results::outOfMemory;
+    }
+    constexpr pthread_attr_t* const useDefaultAttributes = nullptr;
+    const auto result = pthread_create( &m_thread, useDefaultAttributes, EntryPointThread, threadData );
+    if ( result != 0 )
+    {
+        delete threadData;
+        EAE6320_ASSERTF( false, "Couldn't start a thread (error %i)", result );
+        Logging::OutputError( "POSIX failed to start a thread (error %i)", result );
+        return Results::Failure;
+    }
+    m_isRunning = true;
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Concurrency::WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds )
+{
+    if ( io_thread.m_isRunning )
+    {
+        int result;
+        if ( i_timeToWait_inMilliseconds == Constants::dontTimeOut )
+        {
+            result = pthread_join( io_thread.m_thread, nullptr );
+        }
+        else if ( i_timeToWait_inMilliseconds == 0 )
+        {
+            result = pthread_tryjoin_np( io_thread.m_thread, nullptr );
+            if ( result == EBUSY )
+            {
+                return Results::timeOut;
+            }
+        }
+        else
+        {
+            timespec timeToStopWaiting;
+            clock_gettime( CLOCK_REALTIME, &timeToStopWaiting );
+            timeToStopWaiting.tv_sec += static_cast<time_t>( i_timeToWait_inMilliseconds / 1000 );
+            timeToStopWaiting.tv_nsec += static_cast<long>( i_timeToWait_inMilliseconds % 1000 ) * 1000000;
+            if ( timeToStopWaiting.tv_nsec >= 1000000000 )
+            {
+                ++timeToStopWaiting.tv_sec;
+                timeToStopWaiting.tv_nsec -= 1000000000;
+            }
+            result = pthread_timedjoin_np( io_thread.m_thread, nullptr, &timeToStopWaiting );
+        }
+        switch ( result )
+        {
+        // The thread exited
+        case 0:
+            // CleanUp() is called so that this thread object could be reused if desired
+            io_thread.m_isRunning = false;
+            return io_thread.CleanUp();
+        // The time-out period elapsed before the thread exited
+        case ETIMEDOUT:
+            return eae6320::Results::timeOut;
+        // An unexpected error occurred
+        default:
+            EAE6320_ASSERTF( false, "Failed to wait for a thread to exit (error %i)", result );
+            Logging::OutputError( "POSIX failed waiting for a thread to exit (error %i)", result );
+        }
+        return Results::Failure;
+    }
+    else
+    {
+        EAE6320_ASSERTF( false, "A thread can't be waited on to exit if it hasn't been started" );
+        // Even calling the function when the thread isn't running is probably a user error,
+        // the thread isn't running and so success is returned
+        return Results::success;
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cThread::cThread()
+{
+
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cThread::CleanUp()
+{
+    // A thread that is still running when its object is destroyed is detached
+    // so that its resources are released when it exits
+    if ( m_isRunning )
+    {
+        const auto result = pthread_detach( m_thread );
+        m_isRunning = false;
+        if ( result != 0 )
+        {
+            EAE6320_ASSERTF( false, "Couldn't detach a thread (error %i)", result );
+            Logging::OutputError( "POSIX failed to detach a thread (error %i)", result );
+            return Results::Failure;
+        }
+    }
+    return Results::success;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void* EntryPointThread( void* io_threadData )
+    {
+        // Extract the user-provided data
+        auto* const threadData = static_cast<sThreadData*>( io_threadData );
+        const auto threadFunction = threadData->threadFunction;
+        auto* const userData = threadData->userData;
+        delete threadData;
+
+        // Call the user-provided function with the user-provided data
+        threadFunction( userData );
+        return nullptr;
+    }
+}
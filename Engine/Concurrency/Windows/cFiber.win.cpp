@@ -0,0 +1,125 @@
+// Include Files
+//==============
+
+#include "../cFiber.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Windows/Functions.h>
+#include <Engine/Windows/Includes.h>
+
+// Interface
+//==========
+
+void eae6320::Concurrency::cFiber::SwitchTo( cFiber& io_fiber )
+{
+    EAE6320_ASSERT( m_fiber && io_fiber.m_fiber );
+    EAE6320_ASSERT( GetCurrentFiber() == m_fiber );
+    ::SwitchToFiber( io_fiber.m_fiber );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Concurrency::cFiber::Initialize( const fFiberFunction i_fiberFunction, void* const io_userData, const size_t i_stackSize )
+{
+    if ( m_fiber )
+    {
+        EAE6320_ASSERTF( false, "A fiber can't be initialized twice" );
+        Logging::OutputError( "An attempt was made to initialize a fiber that was already initialized" );
+        return Results::Failure;
+    }
+    EAE6320_ASSERT( i_fiberFunction );
+
+    m_fiberFunction = i_fiberFunction;
+    m_userData = io_userData;
+    // Only the reserved size is specified so that a fiber that doesn't use its whole stack
+    // doesn't use the physical memory for it
+    constexpr SIZE_T useDefaultCommitSize = 0;
+    m_fiber = CreateFiberEx( useDefaultCommitSize, static_cast<SIZE_T>( i_stackSize ), FIBER_FLAG_FLOAT_SWITCH, EntryPointFiber, this );
+    if ( !m_fiber )
+    {
+        const auto errorMessage = Windows::GetLastSystemError();
+        EAE6320_ASSERTF( false, "Couldn't create a fiber: %s", errorMessage.c_str() );
+        Logging::OutputError( "Windows failed to create a fiber: %s", errorMessage.c_str() );
+        return Results::Failure;
+    }
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Concurrency::cFiber::InitializeFromCurrentThread()
+{
+    if ( m_fiber )
+    {
+        EAE6320_ASSERTF( false, "A fiber can't be initialized twice" );
+        Logging::OutputError( "An attempt was made to initialize a fiber that was already initialized" );
+        return Results::Failure;
+    }
+
+    if ( IsThreadAFiber() == FALSE )
+    {
+        m_fiber = ConvertThreadToFiberEx( this, FIBER_FLAG_FLOAT_SWITCH );
+        if ( !m_fiber )
+        {
+            const auto errorMessage = Windows::GetLastSystemError();
+            EAE6320_ASSERTF( false, "Couldn't turn a thread into a fiber: %s", errorMessage.c_str() );
+            Logging::OutputError( "Windows failed to turn a thread into a fiber: %s", errorMessage.c_str() );
+            return Results::Failure;
+        }
+        m_shouldConvertBackToThread = true;
+    }
+    else
+    {
+        m_fiber = GetCurrentFiber();
+        m_shouldConvertBackToThread = false;
+    }
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Concurrency::cFiber::CleanUp()
+{
+    auto result = Results::success;
+
+    if ( m_fiber )
+    {
+        if ( m_fiberFunction )
+        {
+            EAE6320_ASSERTF( GetCurrentFiber() != m_fiber, "A fiber can't clean itself up" );
+            DeleteFiber( m_fiber );
+        }
+        else if ( m_shouldConvertBackToThread )
+        {
+            EAE6320_ASSERTF( GetCurrentFiber() == m_fiber, "A thread must be turned back from a fiber on the same thread" );
+            if ( ConvertFiberToThread() == FALSE )
+            {
+                const auto errorMessage = Windows::GetLastSystemError();
+                EAE6320_ASSERTF( false, "Couldn't turn a fiber back into a thread: %s", errorMessage.c_str() );
+                Logging::OutputError( "Windows failed to turn a fiber back into a thread: %s", errorMessage.c_str() );
+                result = Results::Failure;
+            }
+        }
+        m_fiber = nullptr;
+    }
+    m_fiberFunction = nullptr;
+    m_userData = nullptr;
+    m_shouldConvertBackToThread = false;
+
+    return result;
+}
+
+eae6320::Concurrency::cFiber::cFiber()
+{
+
+}
+
+// Implementation
+//===============
+
+void __stdcall eae6320::Concurrency::cFiber::EntryPointFiber( void* io_fiber )
+{
+    auto& fiber = *static_cast<cFiber*>( io_fiber );
+    fiber.m_fiberFunction( fiber.m_userData );
+    // Returning from a fiber's function would exit its thread
+    EAE6320_ASSERTF( false, "A fiber's function must never return" );
+    Logging::OutputError( "A fiber's function returned, which exits the thread that was running it" );
+}
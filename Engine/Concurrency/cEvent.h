@@ -20,6 +20,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
     #include <Engine/Windows/Includes.h>
+#elif defined( EAE6320_PLATFORM_LINUX )
+    #include <pthread.h>
 #endif
 
 // Forward Declarations
@@ -30,6 +32,10 @@ namespace eae6320
     namespace Concurrency
     {
         class cEvent;
+
+        // The default time-out is declared here rather than in the friend declaration
+        // because standard C++ only allows a friend declaration to have default arguments if it is also the definition
+        cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds = Constants::dontTimeOut );
     }
 }
 
@@ -78,7 +84,7 @@ namespace eae6320
             //    * The specified time-out period elapses
             //        * If the caller doesn't specify a time-out period then the function will never return until the event happens
             //        * If the caller specifies a time-out period of zero then the function will return immediately
-            friend cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds = Constants::dontTimeOut );
+            friend cResult WaitForEvent( const cEvent& i_event, const unsigned int i_timeToWait_inMilliseconds );
 
             // This function should be called when an event happens
             // (which "signals" the event happening to any waiting threads)
@@ -103,6 +109,14 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
             HANDLE m_handle = nullptr;
+#elif defined( EAE6320_PLATFORM_LINUX )
+            // POSIX doesn't have events,
+            // and so a condition variable is used to wait for the signaled state to change
+            mutable pthread_mutex_t m_mutex;
+            mutable pthread_cond_t m_condition;
+            mutable bool m_isSignaled = false;
+            bool m_shouldResetAutomatically = false;
+            bool m_isInitialized = false;
 #endif
         };
     }
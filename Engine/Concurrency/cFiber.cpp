@@ -0,0 +1,20 @@
+// Include Files
+//==============
+
+#include "cFiber.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Concurrency::cFiber::~cFiber()
+{
+    if ( !CleanUp() )
+    {
+        EAE6320_ASSERT( false );
+    }
+}
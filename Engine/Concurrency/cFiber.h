@@ -0,0 +1,106 @@
+/*
+    A fiber is a stack that code can run on,
+    but unlike a thread it is never interrupted:
+    it runs until it explicitly switches to another fiber.
+
+    A thread must be turned into a fiber before it can switch to any other fiber,
+    and a fiber can then be switched to by any thread
+    (i.e. a fiber that was running on one thread can be resumed on a different one).
+    This allows code that has to wait to give its thread to other work
+    without the cost of blocking the thread.
+*/
+
+#ifndef EAE6320_CONCURRENCY_CFIBER_H
+#define EAE6320_CONCURRENCY_CFIBER_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <Engine/Results/Results.h>
+
+#if defined( EAE6320_PLATFORM_LINUX )
+    #include <ucontext.h>
+#endif
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        // A user-provided function takes a single void pointer as input,
+        // which allows shared data to be passed to the new fiber.
+        // The function must never return
+        // (when a fiber's work is done it must switch to another fiber instead)
+        using fFiberFunction = void (*)( void* const io_userData );
+
+        class cFiber
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // The calling fiber stops and this fiber continues from where it last stopped
+            // (or calls its function if it has never run).
+            // This returns when another fiber switches back to the calling one
+            void SwitchTo( cFiber& io_fiber );
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // The function is called the first time that the fiber is switched to.
+            // A fiber's stack can't grow, and so it must be big enough for everything that the function calls
+            cResult Initialize( const fFiberFunction i_fiberFunction, void* const io_userData, const size_t i_stackSize );
+            // The calling thread is turned into a fiber so that it can switch to other fibers
+            // (and so that they can switch back to it).
+            // The fiber must be cleaned up on the same thread
+            cResult InitializeFromCurrentThread();
+            // A fiber can't clean itself up
+            cResult CleanUp();
+
+            cFiber();
+            cFiber( const cFiber& ) = delete;
+            cFiber& operator =( const cFiber& ) = delete;
+            ~cFiber();
+
+            // Data
+            //=====
+
+        private:
+
+            fFiberFunction m_fiberFunction = nullptr;
+            void* m_userData = nullptr;
+#if defined( EAE6320_PLATFORM_WINDOWS )
+            void* m_fiber = nullptr;
+            // A thread that was turned into a fiber must be turned back into a thread when it is cleaned up
+            // (unless it was already a fiber)
+            bool m_shouldConvertBackToThread = false;
+#elif defined( EAE6320_PLATFORM_LINUX )
+            ucontext_t m_context;
+            // The stack has an inaccessible page below it
+            // so that overflowing the stack crashes instead of corrupting other memory
+            void* m_stackAllocation = nullptr;
+            size_t m_stackAllocationSize = 0;
+            bool m_isInitialized = false;
+#endif
+
+            // Implementation
+            //===============
+
+        private:
+
+#if defined( EAE6320_PLATFORM_WINDOWS )
+            static void __stdcall EntryPointFiber( void* io_fiber );
+#elif defined( EAE6320_PLATFORM_LINUX )
+            // A pointer can't be passed to the function directly,
+            // and so it is split in half
+            static void EntryPointFiber( const unsigned int i_fiber_high, const unsigned int i_fiber_low );
+#endif
+        };
+    }
+}
+
+#endif    // EAE6320_CONCURRENCY_CFIBER_H
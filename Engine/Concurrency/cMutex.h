@@ -16,6 +16,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
     #include <Engine/Windows/Includes.h>
+#elif defined( EAE6320_PLATFORM_LINUX )
+    #include <pthread.h>
 #endif
 
 // Class Declaration
@@ -71,6 +73,8 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
             SRWLOCK m_srwLock;
+#elif defined( EAE6320_PLATFORM_LINUX )
+            pthread_mutex_t m_mutex;
 #endif
         };
     }
@@ -19,6 +19,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
     #include <Engine/Windows/Includes.h>
+#elif defined( EAE6320_PLATFORM_LINUX )
+    #include <pthread.h>
 #endif
 
 // Class Declaration
@@ -74,6 +76,8 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
             CRITICAL_SECTION m_criticalSection;
+#elif defined( EAE6320_PLATFORM_LINUX )
+            pthread_mutex_t m_mutex;
 #endif
         };
     }
@@ -17,6 +17,8 @@
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
     #include <Engine/Windows/Includes.h>
+#elif defined( EAE6320_PLATFORM_LINUX )
+    #include <pthread.h>
 #endif
 
 // Forward Declarations
@@ -27,6 +29,9 @@ namespace eae6320
     namespace Concurrency
     {
         class cThread;
+
+        // (the default time-out can't be in the friend declaration; see cEvent.h)
+        cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds = Constants::dontTimeOut );
     }
 }
 
@@ -60,7 +65,7 @@ namespace eae6320
             //    * The specified time-out period elapses
             //        * If the caller doesn't specify a time-out period then the function will never return until the thread stops
             //        * If the caller specifies a time-out period of zero then the function will return immediately
-            friend cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds = Constants::dontTimeOut );
+            friend cResult WaitForThreadToStop( cThread& io_thread, const unsigned int i_timeToWait_inMilliseconds );
 
             // Initialization / Clean Up
             //--------------------------
@@ -75,6 +80,9 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_WINDOWS )
             HANDLE m_handle = nullptr;
+#elif defined( EAE6320_PLATFORM_LINUX )
+            pthread_t m_thread;
+            bool m_isRunning = false;
 #endif
 
             // Implementation
@@ -0,0 +1,112 @@
+/*
+    A work-stealing deque is a queue that one thread (the owner) pushes to and pops from at one end
+    while any other thread can steal from the other end
+
+    The owner works on the newest element (which is most likely to still be in its cache)
+    and thieves take the oldest one (which is most likely to be a big piece of unsplit work).
+    Neither end ever takes a lock:
+    the owner only needs an atomic operation when it pops the last element,
+    and a thief only needs one atomic operation per steal.
+
+    This is the Chase-Lev deque,
+    with the memory orderings from "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013).
+    The array grows when it is full;
+    the arrays that are replaced are kept until the deque is destroyed
+    because a thief could still be reading from one of them.
+
+    The elements must be trivially copyable and small enough to be atomic (e.g. pointers).
+*/
+
+#ifndef EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_H
+#define EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_H
+
+// Include Files
+//==============
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Concurrency
+    {
+        template <typename tElement>
+        class cWorkStealingDeque
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // Owner
+            //------
+
+            // These must only be called by the thread that owns the deque
+
+            void Push( const tElement i_element );
+            // Returns false if the deque is empty
+            bool Pop( tElement& o_element );
+
+            // Thieves
+            //--------
+
+            // This can be called by any thread.
+            // Returns false if the deque is empty or if another thread took the element first
+            bool Steal( tElement& o_element );
+
+            // This is only a hint since other threads can change the deque at any time
+            bool IsProbablyEmpty() const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // The capacity is rounded up to a power of two
+            explicit cWorkStealingDeque( const size_t i_initialCapacity = 1024 );
+
+            cWorkStealingDeque( const cWorkStealingDeque& ) = delete;
+            cWorkStealingDeque& operator =( const cWorkStealingDeque& ) = delete;
+
+            // Data
+            //=====
+
+        private:
+
+            // The array is circular and the indices only ever increase,
+            // and so an index's element is at ( index & mask )
+            struct sArray
+            {
+                std::unique_ptr<std::atomic<tElement>[]> elements;
+                int64_t mask;
+
+                explicit sArray( const int64_t i_capacity );
+                tElement Get( const int64_t i_index ) const;
+                void Put( const int64_t i_index, const tElement i_element );
+            };
+
+            // The owner and the thieves each write to a different index,
+            // and so they are kept on different cache lines
+            alignas( 64 ) std::atomic<int64_t> m_top;
+            alignas( 64 ) std::atomic<int64_t> m_bottom;
+            std::atomic<sArray*> m_array;
+            // Only the owner changes this
+            std::vector<std::unique_ptr<sArray>> m_arrays;
+
+            // Implementation
+            //===============
+
+        private:
+
+            sArray* Grow( sArray* const i_array, const int64_t i_top, const int64_t i_bottom );
+        };
+    }
+}
+
+#include "cWorkStealingDeque.inl"
+
+#endif    // EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_H
@@ -0,0 +1,150 @@
+#ifndef EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_INL
+#define EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_INL
+
+// Include Files
+//==============
+
+// #include "cWorkStealingDeque.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <type_traits>
+
+// Interface
+//==========
+
+// Owner
+//------
+
+template <typename tElement>
+void eae6320::Concurrency::cWorkStealingDeque<tElement>::Push( const tElement i_element )
+{
+    const auto bottom = m_bottom.load( std::memory_order_relaxed );
+    const auto top = m_top.load( std::memory_order_acquire );
+    auto* array = m_array.load( std::memory_order_relaxed );
+    if ( ( bottom - top ) > array->mask )
+    {
+        array = Grow( array, top, bottom );
+    }
+    array->Put( bottom, i_element );
+    // A thief that sees the new bottom must also see the element
+    m_bottom.store( bottom + 1, std::memory_order_release );
+}
+
+template <typename tElement>
+bool eae6320::Concurrency::cWorkStealingDeque<tElement>::Pop( tElement& o_element )
+{
+    // The bottom is reserved before the top is read
+    // so that a thief can't take the same element without seeing the reservation
+    const auto bottom = m_bottom.load( std::memory_order_relaxed ) - 1;
+    auto* const array = m_array.load( std::memory_order_relaxed );
+    m_bottom.store( bottom, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    auto top = m_top.load( std::memory_order_relaxed );
+    if ( top <= bottom )
+    {
+        o_element = array->Get( bottom );
+        if ( top == bottom )
+        {
+            // This is the last element, and so the owner races any thieves for it
+            const auto wasTaken = m_top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+            m_bottom.store( bottom + 1, std::memory_order_relaxed );
+            return wasTaken;
+        }
+        return true;
+    }
+    else
+    {
+        // The deque was empty
+        m_bottom.store( bottom + 1, std::memory_order_relaxed );
+        return false;
+    }
+}
+
+// Thieves
+//--------
+
+template <typename tElement>
+bool eae6320::Concurrency::cWorkStealingDeque<tElement>::Steal( tElement& o_element )
+{
+    auto top = m_top.load( std::memory_order_acquire );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    const auto bottom = m_bottom.load( std::memory_order_acquire );
+    if ( top < bottom )
+    {
+        // The element must be read before the top is incremented
+        // because once it has been incremented the owner can overwrite the element
+        auto* const array = m_array.load( std::memory_order_acquire );
+        const auto element = array->Get( top );
+        if ( m_top.compare_exchange_strong( top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+        {
+            o_element = element;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename tElement>
+bool eae6320::Concurrency::cWorkStealingDeque<tElement>::IsProbablyEmpty() const
+{
+    return m_bottom.load( std::memory_order_relaxed ) <= m_top.load( std::memory_order_relaxed );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+template <typename tElement>
+eae6320::Concurrency::cWorkStealingDeque<tElement>::cWorkStealingDeque( const size_t i_initialCapacity )
+    :
+    m_top( 0 ), m_bottom( 0 )
+{
+    static_assert( std::is_trivially_copyable<tElement>::value, "The elements of a work-stealing deque must be trivially copyable" );
+    int64_t capacity = 1;
+    while ( capacity < static_cast<int64_t>( i_initialCapacity ) )
+    {
+        capacity *= 2;
+    }
+    m_arrays.emplace_back( new sArray( capacity ) );
+    m_array.store( m_arrays.back().get(), std::memory_order_relaxed );
+}
+
+// Implementation
+//===============
+
+template <typename tElement>
+eae6320::Concurrency::cWorkStealingDeque<tElement>::sArray::sArray( const int64_t i_capacity )
+    :
+    elements( new std::atomic<tElement>[static_cast<size_t>( i_capacity )] ), mask( i_capacity - 1 )
+{
+    EAE6320_ASSERTF( ( i_capacity > 0 ) && ( ( i_capacity & mask ) == 0 ), "The capacity must be a power of two" );
+}
+
+template <typename tElement>
+tElement eae6320::Concurrency::cWorkStealingDeque<tElement>::sArray::Get( const int64_t i_index ) const
+{
+    return elements[static_cast<size_t>( i_index & mask )].load( std::memory_order_relaxed );
+}
+
+template <typename tElement>
+void eae6320::Concurrency::cWorkStealingDeque<tElement>::sArray::Put( const int64_t i_index, const tElement i_element )
+{
+    elements[static_cast<size_t>( i_index & mask )].store( i_element, std::memory_order_relaxed );
+}
+
+template <typename tElement>
+typename eae6320::Concurrency::cWorkStealingDeque<tElement>::sArray* eae6320::Concurrency::cWorkStealingDeque<tElement>::Grow(
+    sArray* const i_array, const int64_t i_top, const int64_t i_bottom )
+{
+    // The elements keep the same indices in the bigger array
+    // so that a thief reading from either array gets the same element
+    auto* const newArray = new sArray( ( i_array->mask + 1 ) * 2 );
+    for ( auto i = i_top; i < i_bottom; ++i )
+    {
+        newArray->Put( i, i_array->Get( i ) );
+    }
+    m_arrays.emplace_back( newArray );
+    m_array.store( newArray, std::memory_order_release );
+    return newArray;
+}
+
+#endif    // EAE6320_CONCURRENCY_CWORKSTEALINGDEQUE_INL
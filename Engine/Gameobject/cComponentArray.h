@@ -0,0 +1,89 @@
+/*
+A component array stores one type of component for the entities that have it (i.e. a "sparse set")
+
+The components are kept packed in a single array so that a system can iterate over all of them
+without skipping entities that don't have the component.
+When a component is removed the last component is moved into its place,
+and so the order of the components changes and pointers to them are only valid until the array is changed.
+
+The array index of an entity's component is found in a second array that is indexed by the entity ID
+(the IDs are small integers that are reused, and so that array stays about as big as the number of entities).
+*/
+
+#ifndef EAE6320_GAMEOBJECT_CCOMPONENTARRAY_H
+#define EAE6320_GAMEOBJECT_CCOMPONENTARRAY_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Gameobject
+    {
+        using tEntityId = uint32_t;
+        constexpr tEntityId invalidEntityId = ~static_cast<tEntityId>(0);
+
+        // Class Declaration
+        //==================
+
+        template <typename tComponent>
+        class cComponentArray
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // Access
+            //-------
+
+            bool Has(const tEntityId i_entity) const;
+            tComponent& Get(const tEntityId i_entity);
+            const tComponent& Get(const tEntityId i_entity) const;
+
+            // The packed arrays
+            // (the entity at an index owns the component at the same index)
+            size_t GetCount() const { return m_components.size(); }
+            tComponent* GetComponents() { return m_components.data(); }
+            const tComponent* GetComponents() const { return m_components.data(); }
+            const tEntityId* GetEntities() const { return m_entities.data(); }
+
+            // Add / Remove
+            //-------------
+
+            // The entity must not already have the component
+            tComponent& Add(const tEntityId i_entity, const tComponent& i_component);
+            // Returns the entity whose component was moved into the removed component's place
+            // (or invalidEntityId if the removed component was the last one)
+            tEntityId Remove(const tEntityId i_entity);
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            void Reserve(const size_t i_count);
+            // The capacity is kept
+            void Clear();
+
+            // Data
+            //=====
+
+        private:
+
+            std::vector<tComponent> m_components;
+            std::vector<tEntityId> m_entities;
+            // Indexed by entity ID
+            std::vector<uint32_t> m_indicesFromEntities;
+        };
+    }
+}
+
+#include "cComponentArray.inl"
+
+#endif    // EAE6320_GAMEOBJECT_CCOMPONENTARRAY_H
@@ -0,0 +1,97 @@
+#ifndef EAE6320_GAMEOBJECT_CCOMPONENTARRAY_INL
+#define EAE6320_GAMEOBJECT_CCOMPONENTARRAY_INL
+
+// Include Files
+//==============
+
+// #include "cComponentArray.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Access
+//-------
+
+template <typename tComponent>
+bool eae6320::Gameobject::cComponentArray<tComponent>::Has(const tEntityId i_entity) const
+{
+    return (i_entity < m_indicesFromEntities.size()) && (m_indicesFromEntities[i_entity] != invalidEntityId);
+}
+
+template <typename tComponent>
+tComponent& eae6320::Gameobject::cComponentArray<tComponent>::Get(const tEntityId i_entity)
+{
+    EAE6320_ASSERTF(Has(i_entity), "The entity %u doesn't have this component", i_entity);
+    return m_components[m_indicesFromEntities[i_entity]];
+}
+
+template <typename tComponent>
+const tComponent& eae6320::Gameobject::cComponentArray<tComponent>::Get(const tEntityId i_entity) const
+{
+    EAE6320_ASSERTF(Has(i_entity), "The entity %u doesn't have this component", i_entity);
+    return m_components[m_indicesFromEntities[i_entity]];
+}
+
+// Add / Remove
+//-------------
+
+template <typename tComponent>
+tComponent& eae6320::Gameobject::cComponentArray<tComponent>::Add(const tEntityId i_entity, const tComponent& i_component)
+{
+    EAE6320_ASSERT(i_entity != invalidEntityId);
+    EAE6320_ASSERTF(!Has(i_entity), "The entity %u already has this component", i_entity);
+    if (i_entity >= m_indicesFromEntities.size())
+    {
+        m_indicesFromEntities.resize(i_entity + 1, invalidEntityId);
+    }
+    m_indicesFromEntities[i_entity] = static_cast<uint32_t>(m_components.size());
+    m_entities.push_back(i_entity);
+    m_components.push_back(i_component);
+    return m_components.back();
+}
+
+template <typename tComponent>
+eae6320::Gameobject::tEntityId eae6320::Gameobject::cComponentArray<tComponent>::Remove(const tEntityId i_entity)
+{
+    EAE6320_ASSERTF(Has(i_entity), "The entity %u doesn't have this component", i_entity);
+    const auto index = m_indicesFromEntities[i_entity];
+    const auto index_last = m_components.size() - 1;
+    m_indicesFromEntities[i_entity] = invalidEntityId;
+    if (index == index_last)
+    {
+        m_entities.pop_back();
+        m_components.pop_back();
+        return invalidEntityId;
+    }
+    // The last component is moved into the removed component's place
+    const auto entity_moved = m_entities[index_last];
+    m_indicesFromEntities[entity_moved] = index;
+    m_entities[index] = entity_moved;
+    m_entities.pop_back();
+    m_components[index] = m_components[index_last];
+    m_components.pop_back();
+    return entity_moved;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+template <typename tComponent>
+void eae6320::Gameobject::cComponentArray<tComponent>::Reserve(const size_t i_count)
+{
+    m_components.reserve(i_count);
+    m_entities.reserve(i_count);
+    m_indicesFromEntities.reserve(i_count);
+}
+
+template <typename tComponent>
+void eae6320::Gameobject::cComponentArray<tComponent>::Clear()
+{
+    m_components.clear();
+    m_entities.clear();
+    m_indicesFromEntities.clear();
+}
+
+#endif    // EAE6320_GAMEOBJECT_CCOMPONENTARRAY_INL
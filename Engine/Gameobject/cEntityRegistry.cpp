@@ -0,0 +1,426 @@
+// Include Files
+//==============
+
+#include "cEntityRegistry.h"
+#include "cbController.h"
+
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/cMatrix_transformation.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // The smallest world-space box that contains the mesh's local box after it is transformed
+    eae6320::Physics::sAabb CalculateWorldBounds(const eae6320::Graphics::cMesh& i_mesh,
+        const eae6320::Math::cMatrixTransformation& i_transform_localToWorld);
+}
+
+// Interface
+//==========
+
+// Entities
+//---------
+
+eae6320::Gameobject::tEntityId eae6320::Gameobject::cEntityRegistry::CreateEntity()
+{
+    // An ID of an entity that was destroyed is reused if there is one
+    tEntityId entity;
+    if (!m_unusedEntityIds.empty())
+    {
+        entity = m_unusedEntityIds.back();
+        m_unusedEntityIds.pop_back();
+    }
+    else
+    {
+        EAE6320_ASSERT(m_doEntitiesExist.size() < invalidEntityId);
+        entity = static_cast<tEntityId>(m_doEntitiesExist.size());
+        m_doEntitiesExist.push_back(0);
+    }
+    m_doEntitiesExist[entity] = 1;
+    ++m_entityCount;
+    return entity;
+}
+
+void eae6320::Gameobject::cEntityRegistry::DestroyEntity(const tEntityId i_entity)
+{
+    EAE6320_ASSERTF(DoesEntityExist(i_entity), "The entity %u doesn't exist", i_entity);
+
+    if (m_controllers.Has(i_entity))
+    {
+        delete m_controllers.Get(i_entity).controller;
+        m_controllers.Remove(i_entity);
+    }
+    if (m_rigidBodies.Has(i_entity))
+    {
+        const auto& rigidBody = m_rigidBodies.Get(i_entity);
+        rigidBody.world->RemoveBody(rigidBody.body);
+        m_rigidBodies.Remove(i_entity);
+    }
+    if (m_renders.Has(i_entity))
+    {
+        if (!RemoveRender(i_entity))
+        {
+            EAE6320_ASSERT(false);
+        }
+    }
+    if (m_hierarchies.Has(i_entity))
+    {
+        // Any entities that are attached to this one are attached to its parent instead
+        m_transformHierarchy.DestroyNode(m_hierarchies.Get(i_entity).node);
+        m_hierarchies.Remove(i_entity);
+    }
+    if (m_transforms.Has(i_entity))
+    {
+        // The physics world is given the new address of the transform that is moved into the removed one's place
+        const auto entity_moved = m_transforms.Remove(i_entity);
+        if (entity_moved != invalidEntityId)
+        {
+            BindBodyTransforms(entity_moved);
+        }
+    }
+
+    m_doEntitiesExist[i_entity] = 0;
+    m_unusedEntityIds.push_back(i_entity);
+    --m_entityCount;
+}
+
+bool eae6320::Gameobject::cEntityRegistry::DoesEntityExist(const tEntityId i_entity) const
+{
+    return (i_entity < m_doEntitiesExist.size()) && (m_doEntitiesExist[i_entity] != 0);
+}
+
+// Components
+//-----------
+
+eae6320::Gameobject::sTransformComponent& eae6320::Gameobject::cEntityRegistry::AddTransform(const tEntityId i_entity,
+    const Math::sVector& i_position, const Math::cQuaternion& i_orientation)
+{
+    EAE6320_ASSERT(DoesEntityExist(i_entity));
+    sTransformComponent transformComponent;
+    transformComponent.transform = Transform::sTransform(i_position, i_orientation);
+    transformComponent.predictionTransform = Transform::sPredictionTransform(i_position, i_orientation);
+    const auto* const transforms_before = m_transforms.GetComponents();
+    auto& newTransformComponent = m_transforms.Add(i_entity, transformComponent);
+    // If the array grew every transform component moved
+    if (m_transforms.GetComponents() != transforms_before)
+    {
+        const auto* const entities = m_rigidBodies.GetEntities();
+        for (size_t i = 0, count = m_rigidBodies.GetCount(); i < count; ++i)
+        {
+            BindBodyTransforms(entities[i]);
+        }
+    }
+    return newTransformComponent;
+}
+
+eae6320::cResult eae6320::Gameobject::cEntityRegistry::AddRender(const tEntityId i_entity,
+    const char* const i_meshPath, const char* const i_materialPath)
+{
+    EAE6320_ASSERT(DoesEntityExist(i_entity));
+    auto result = Results::success;
+
+    sRenderComponent renderComponent;
+    // Load the material
+    if (!(result = Graphics::cMaterial::s_manager.Load(i_materialPath, renderComponent.materialHandle)))
+    {
+        EAE6320_ASSERTF(false, "Loading of material failed: \"%s\"", i_materialPath);
+        return result;
+    }
+    renderComponent.material = Graphics::cMaterial::s_manager.Get(renderComponent.materialHandle);
+    // Load the mesh
+    if (!(result = Graphics::cMesh::s_manager.Load(i_meshPath, renderComponent.meshHandle)))
+    {
+        EAE6320_ASSERTF(false, "Loading of mesh failed: \"%s\"", i_meshPath);
+        if (!Graphics::cMaterial::s_manager.Release(renderComponent.materialHandle))
+        {
+            EAE6320_ASSERT(false);
+        }
+        return result;
+    }
+    renderComponent.mesh = Graphics::cMesh::s_manager.Get(renderComponent.meshHandle);
+
+    m_renders.Add(i_entity, renderComponent);
+    return result;
+}
+
+void eae6320::Gameobject::cEntityRegistry::AddRigidBody(const tEntityId i_entity, Physics::cWorld& io_world,
+    const Physics::sRigidBodyState& i_rigidBodyState, const Physics::sShape& i_shape)
+{
+    EAE6320_ASSERT(DoesEntityExist(i_entity));
+    auto& transformComponent = m_transforms.Get(i_entity);
+    sRigidBodyComponent rigidBodyComponent;
+    rigidBodyComponent.world = &io_world;
+    rigidBodyComponent.body = io_world.AddBody(transformComponent.transform.position, transformComponent.transform.orientation,
+        i_rigidBodyState, i_shape, &transformComponent.transform, &transformComponent.predictionTransform);
+    m_rigidBodies.Add(i_entity, rigidBodyComponent);
+}
+
+void eae6320::Gameobject::cEntityRegistry::AddController(const tEntityId i_entity, Gameplay::cbController* const i_controller)
+{
+    EAE6320_ASSERT(DoesEntityExist(i_entity));
+    EAE6320_ASSERT(i_controller);
+    EAE6320_ASSERTF(m_rigidBodies.Has(i_entity), "A controller can only be added to an entity with a rigid body");
+    sControllerComponent controllerComponent;
+    controllerComponent.controller = i_controller;
+    m_controllers.Add(i_entity, controllerComponent);
+}
+
+void eae6320::Gameobject::cEntityRegistry::AddHierarchy(const tEntityId i_entity,
+    const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation, const tEntityId i_parent)
+{
+    EAE6320_ASSERT(DoesEntityExist(i_entity));
+    EAE6320_ASSERTF((i_parent == invalidEntityId) || m_hierarchies.Has(i_parent),
+        "An entity can only be attached to a parent with a hierarchy component");
+    sHierarchyComponent hierarchyComponent;
+    hierarchyComponent.node = m_transformHierarchy.CreateNode(i_localPosition, i_localOrientation,
+        (i_parent != invalidEntityId) ? m_hierarchies.Get(i_parent).node : Transform::cTransformHierarchy::invalidNodeId);
+    m_hierarchies.Add(i_entity, hierarchyComponent);
+}
+
+void eae6320::Gameobject::cEntityRegistry::SetParent(const tEntityId i_entity, const tEntityId i_parent)
+{
+    EAE6320_ASSERTF((i_parent == invalidEntityId) || m_hierarchies.Has(i_parent),
+        "An entity can only be attached to a parent with a hierarchy component");
+    m_transformHierarchy.SetParent(m_hierarchies.Get(i_entity).node,
+        (i_parent != invalidEntityId) ? m_hierarchies.Get(i_parent).node : Transform::cTransformHierarchy::invalidNodeId);
+}
+
+void eae6320::Gameobject::cEntityRegistry::SetLocalTransform(const tEntityId i_entity,
+    const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation)
+{
+    m_transformHierarchy.SetLocalTransform(m_hierarchies.Get(i_entity).node, i_localPosition, i_localOrientation);
+}
+
+// Systems
+//--------
+
+void eae6320::Gameobject::cEntityRegistry::UpdateControllers()
+{
+    const auto* const entities = m_controllers.GetEntities();
+    for (size_t i = 0, count = m_controllers.GetCount(); i < count; ++i)
+    {
+        UpdateController(entities[i]);
+    }
+}
+
+void eae6320::Gameobject::cEntityRegistry::UpdateController(const tEntityId i_entity)
+{
+    if (!m_controllers.Has(i_entity))
+    {
+        return;
+    }
+    auto* const controller = m_controllers.Get(i_entity).controller;
+    const auto& rigidBody = m_rigidBodies.Get(i_entity);
+    const auto& transform = m_transforms.Get(i_entity).transform;
+    auto rigidBodyState = rigidBody.world->GetRigidBodyState(rigidBody.body);
+    controller->UpdatePosition(transform, rigidBodyState);
+    controller->UpdateOrientation(transform, rigidBodyState);
+    rigidBody.world->SetRigidBodyState(rigidBody.body, rigidBodyState);
+}
+
+void eae6320::Gameobject::cEntityRegistry::PredictTransforms(const float i_elapsedSecondCount_sinceLastSimulationUpdate)
+{
+    const auto* const entities = m_rigidBodies.GetEntities();
+    for (size_t i = 0, count = m_rigidBodies.GetCount(); i < count; ++i)
+    {
+        PredictTransform(entities[i], i_elapsedSecondCount_sinceLastSimulationUpdate);
+    }
+}
+
+void eae6320::Gameobject::cEntityRegistry::PredictTransform(const tEntityId i_entity, const float i_elapsedSecondCount_sinceLastSimulationUpdate)
+{
+    if (!m_rigidBodies.Has(i_entity))
+    {
+        return;
+    }
+    const auto& rigidBody = m_rigidBodies.Get(i_entity);
+    auto& transformComponent = m_transforms.Get(i_entity);
+    const auto rigidBodyState = rigidBody.world->GetRigidBodyState(rigidBody.body);
+    auto& predictionTransform = transformComponent.predictionTransform;
+    predictionTransform.position = transformComponent.transform.position;
+    predictionTransform.orientation = transformComponent.transform.orientation;
+    predictionTransform.position = rigidBodyState.PredictFuturePosition(i_elapsedSecondCount_sinceLastSimulationUpdate, predictionTransform);
+    predictionTransform.orientation = rigidBodyState.PredictFutureOrientation(i_elapsedSecondCount_sinceLastSimulationUpdate, predictionTransform);
+}
+
+void eae6320::Gameobject::cEntityRegistry::UpdateTransformHierarchy()
+{
+    const auto* const hierarchyComponents = m_hierarchies.GetComponents();
+    const auto* const entities = m_hierarchies.GetEntities();
+    for (size_t i = 0, count = m_hierarchies.GetCount(); i < count; ++i)
+    {
+        const auto entity = entities[i];
+        const auto node = hierarchyComponents[i].node;
+        if (m_transforms.Has(entity) && (m_transformHierarchy.GetParent(node) == Transform::cTransformHierarchy::invalidNodeId))
+        {
+            const auto& predictionTransform = m_transforms.Get(entity).predictionTransform;
+            m_transformHierarchy.SetLocalTransform(node, predictionTransform.position, predictionTransform.orientation);
+        }
+    }
+    m_transformHierarchy.UpdateWorldTransforms();
+}
+
+void eae6320::Gameobject::cEntityRegistry::UpdateSpatialIndex()
+{
+    const auto* const renderComponents = m_renders.GetComponents();
+    const auto* const entities = m_renders.GetEntities();
+    for (size_t i = 0, count = m_renders.GetCount(); i < count; ++i)
+    {
+        const auto entity = entities[i];
+        const auto* const mesh = renderComponents[i].mesh;
+        if (!mesh)
+        {
+            continue;
+        }
+        // The transform is the same one that the entity is rendered with (see Graphics::SubmitEntities())
+        Math::cMatrixTransformation transform_localToWorld;
+        if (m_hierarchies.Has(entity))
+        {
+            transform_localToWorld = m_transformHierarchy.GetWorldTransform(m_hierarchies.Get(entity).node);
+        }
+        else
+        {
+            const auto& predictionTransform = m_transforms.Get(entity).predictionTransform;
+            transform_localToWorld = Math::cMatrixTransformation(predictionTransform.orientation, predictionTransform.position);
+        }
+        const auto bounds = CalculateWorldBounds(*mesh, transform_localToWorld);
+        if (m_spatialIndex.DoesProxyExist(entity))
+        {
+            m_spatialIndex.UpdateProxy(entity, bounds);
+        }
+        else
+        {
+            m_spatialIndex.AddProxy(entity, bounds);
+        }
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+void eae6320::Gameobject::cEntityRegistry::Reserve(const size_t i_entityCount)
+{
+    m_transforms.Reserve(i_entityCount);
+    m_renders.Reserve(i_entityCount);
+    m_rigidBodies.Reserve(i_entityCount);
+    m_controllers.Reserve(i_entityCount);
+    m_hierarchies.Reserve(i_entityCount);
+    m_transformHierarchy.Reserve(i_entityCount);
+    m_doEntitiesExist.reserve(i_entityCount);
+}
+
+eae6320::cResult eae6320::Gameobject::cEntityRegistry::CleanUp()
+{
+    auto result = Results::success;
+
+    // The whole hierarchy is cleared at once
+    // rather than attaching the children of each entity that is destroyed to its parent
+    m_hierarchies.Clear();
+    m_transformHierarchy.Clear();
+    m_spatialIndex.Clear();
+    for (tEntityId entity = 0, end = static_cast<tEntityId>(m_doEntitiesExist.size()); entity < end; ++entity)
+    {
+        if (!DoesEntityExist(entity))
+        {
+            continue;
+        }
+        if (m_renders.Has(entity))
+        {
+            const auto localResult = RemoveRender(entity);
+            if (!localResult && result)
+            {
+                result = localResult;
+            }
+        }
+        DestroyEntity(entity);
+    }
+    m_transforms.Clear();
+    m_renders.Clear();
+    m_rigidBodies.Clear();
+    m_controllers.Clear();
+    m_doEntitiesExist.clear();
+    m_unusedEntityIds.clear();
+    m_entityCount = 0;
+
+    return result;
+}
+
+// Implementation
+//===============
+
+void eae6320::Gameobject::cEntityRegistry::BindBodyTransforms(const tEntityId i_entity)
+{
+    if (m_rigidBodies.Has(i_entity))
+    {
+        const auto& rigidBody = m_rigidBodies.Get(i_entity);
+        auto& transformComponent = m_transforms.Get(i_entity);
+        rigidBody.world->SetTransforms(rigidBody.body, &transformComponent.transform, &transformComponent.predictionTransform);
+    }
+}
+
+eae6320::cResult eae6320::Gameobject::cEntityRegistry::RemoveRender(const tEntityId i_entity)
+{
+    auto result = Results::success;
+
+    auto renderComponent = m_renders.Get(i_entity);
+    m_renders.Remove(i_entity);
+    // The entity isn't in the spatial index until the first time that it is updated
+    if (m_spatialIndex.DoesProxyExist(i_entity))
+    {
+        m_spatialIndex.RemoveProxy(i_entity);
+    }
+    if (renderComponent.materialHandle)
+    {
+        const auto localResult = Graphics::cMaterial::s_manager.Release(renderComponent.materialHandle);
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    if (renderComponent.meshHandle)
+    {
+        const auto localResult = Graphics::cMesh::s_manager.Release(renderComponent.meshHandle);
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+
+    return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    eae6320::Physics::sAabb CalculateWorldBounds(const eae6320::Graphics::cMesh& i_mesh,
+        const eae6320::Math::cMatrixTransformation& i_transform_localToWorld)
+    {
+        using namespace eae6320;
+
+        // The center is transformed, and each world axis of the extents is the sum of how far each rotated local axis reaches along it
+        const auto center_local = (i_mesh.GetMinimumBounds() + i_mesh.GetMaximumBounds()) * 0.5f;
+        const auto extents_local = (i_mesh.GetMaximumBounds() - i_mesh.GetMinimumBounds()) * 0.5f;
+        const auto center_world = i_transform_localToWorld * center_local;
+        const auto& right = i_transform_localToWorld.GetRightDirection();
+        const auto& up = i_transform_localToWorld.GetUpDirection();
+        const auto& back = i_transform_localToWorld.GetBackDirection();
+        const Math::sVector extents_world(
+            (std::abs(right.x) * extents_local.x) + (std::abs(up.x) * extents_local.y) + (std::abs(back.x) * extents_local.z),
+            (std::abs(right.y) * extents_local.x) + (std::abs(up.y) * extents_local.y) + (std::abs(back.y) * extents_local.z),
+            (std::abs(right.z) * extents_local.x) + (std::abs(up.z) * extents_local.y) + (std::abs(back.z) * extents_local.z));
+        return Physics::sAabb(center_world - extents_world, center_world + extents_world);
+    }
+}
@@ -0,0 +1,223 @@
+/*
+An entity registry stores the components of many gameobjects in packed arrays
+
+An entity is only an ID, and each type of component is stored in its own cComponentArray.
+A system is a function that iterates over one packed array
+(e.g. every controller, or every mesh that should be rendered)
+and only looks up the other components of the entities that it needs,
+and so updating many gameobjects touches memory in order instead of following a pointer to every gameobject.
+
+Entities that are created together get components at the same indices of every array,
+and so looking up another component while iterating also mostly touches memory in order.
+
+A rigid body's transforms are updated by the physics world through pointers (see cWorld::AddBody()),
+and since transform components move when the array changes
+the registry gives the physics world the new pointers whenever that happens.
+
+An entity can also have a node in the registry's transform hierarchy (see cTransformHierarchy.h)
+so that it can be attached to another entity and move with it.
+A root node of an entity that also has a transform component follows that transform
+(i.e. it is moved by the physics world), and the entities attached below it follow the root.
+
+The world-space bounds of every entity with a render component are kept in a spatial index (see cSpatialHashGrid.h)
+whose proxy IDs are entity IDs,
+so that rendering only submits the entities inside of the camera's frustum
+and gameplay code can find the entities near a position or along a ray without iterating over all of them.
+
+cGameobject3D is a reference-counted handle to an entity in the default registry.
+*/
+
+#ifndef EAE6320_GAMEOBJECT_CENTITYREGISTRY_H
+#define EAE6320_GAMEOBJECT_CENTITYREGISTRY_H
+
+// Include Files
+//==============
+
+#include "cComponentArray.h"
+
+#include <Engine/Graphics/cMaterial.h>
+#include <Engine/Graphics/cMesh.h>
+#include <Engine/Physics/cSpatialHashGrid.h>
+#include <Engine/Physics/cWorld.h>
+#include <Engine/Results/Results.h>
+#include <Engine/Transform/cTransformHierarchy.h>
+#include <Engine/Transform/sPredictionTransform.h>
+#include <Engine/Transform/sTransform.h>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Gameplay
+    {
+        class cbController;
+    }
+}
+
+// Components
+//===========
+
+namespace eae6320
+{
+    namespace Gameobject
+    {
+        struct sTransformComponent
+        {
+            // The simulated transform
+            Transform::sTransform transform;
+            // Where the entity is rendered
+            // (this is predicted from the simulated transform every frame)
+            Transform::sPredictionTransform predictionTransform;
+        };
+
+        // The component owns a reference to each asset
+        struct sRenderComponent
+        {
+            Graphics::cMesh::Handle meshHandle;
+            Graphics::cMaterial::Handle materialHandle;
+            // These are cached so that the managers don't need to be locked every frame
+            Graphics::cMesh* mesh = nullptr;
+            Graphics::cMaterial* material = nullptr;
+        };
+
+        // The body is removed from the world when the component is removed
+        struct sRigidBodyComponent
+        {
+            Physics::cWorld* world = nullptr;
+            Physics::cWorld::tBodyId body = Physics::cWorld::GetInvalidBodyId();
+        };
+
+        // The component owns the controller
+        struct sControllerComponent
+        {
+            Gameplay::cbController* controller = nullptr;
+        };
+
+        // The component owns the node in the registry's transform hierarchy
+        struct sHierarchyComponent
+        {
+            Transform::cTransformHierarchy::tNodeId node = Transform::cTransformHierarchy::invalidNodeId;
+        };
+    }
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Gameobject
+    {
+        class cEntityRegistry
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // Entities
+            //---------
+
+            tEntityId CreateEntity();
+            // Every component of the entity is removed
+            void DestroyEntity(const tEntityId i_entity);
+            bool DoesEntityExist(const tEntityId i_entity) const;
+            size_t GetEntityCount() const { return m_entityCount; }
+
+            // Components
+            //-----------
+
+            sTransformComponent& AddTransform(const tEntityId i_entity, const Math::sVector& i_position, const Math::cQuaternion& i_orientation);
+            // The mesh and material are loaded (or another reference to them is taken if they are already loaded)
+            cResult AddRender(const tEntityId i_entity, const char* const i_meshPath, const char* const i_materialPath);
+            // The entity must already have a transform component,
+            // which the physics world updates (see cWorld::UpdateTransforms() and cWorld::InterpolateTransforms())
+            void AddRigidBody(const tEntityId i_entity, Physics::cWorld& io_world,
+                const Physics::sRigidBodyState& i_rigidBodyState, const Physics::sShape& i_shape);
+            // The registry takes ownership of the controller.
+            // The entity must already have a rigid body component
+            void AddController(const tEntityId i_entity, Gameplay::cbController* const i_controller);
+            // If a parent is provided it must already have a hierarchy component,
+            // and the local transform is relative to it
+            void AddHierarchy(const tEntityId i_entity, const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation,
+                const tEntityId i_parent = invalidEntityId);
+            // Both entities must have hierarchy components.
+            // If no parent is provided then the entity's node becomes a root
+            void SetParent(const tEntityId i_entity, const tEntityId i_parent);
+            void SetLocalTransform(const tEntityId i_entity, const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation);
+
+            const cComponentArray<sTransformComponent>& GetTransforms() const { return m_transforms; }
+            const cComponentArray<sRenderComponent>& GetRenders() const { return m_renders; }
+            const cComponentArray<sRigidBodyComponent>& GetRigidBodies() const { return m_rigidBodies; }
+            const cComponentArray<sControllerComponent>& GetControllers() const { return m_controllers; }
+            const cComponentArray<sHierarchyComponent>& GetHierarchies() const { return m_hierarchies; }
+            const Transform::cTransformHierarchy& GetTransformHierarchy() const { return m_transformHierarchy; }
+            // This is only up-to-date after UpdateSpatialIndex() has been called
+            const Physics::cSpatialHashGrid& GetSpatialIndex() const { return m_spatialIndex; }
+
+            // Systems
+            //--------
+
+            // Every controller changes the motion of its entity's rigid body
+            // (this should be called once per simulation update before the physics world is updated)
+            void UpdateControllers();
+            void UpdateController(const tEntityId i_entity);
+            // Every entity with a rigid body has its rendered transform extrapolated from its simulated transform.
+            // The physics world can interpolate instead (see cWorld::InterpolateTransforms()),
+            // in which case this doesn't need to be called
+            void PredictTransforms(const float i_elapsedSecondCount_sinceLastSimulationUpdate);
+            void PredictTransform(const tEntityId i_entity, const float i_elapsedSecondCount_sinceLastSimulationUpdate);
+            // Every root node of an entity with a transform component is moved to its rendered transform,
+            // and then the world transforms of every node that moved (and of the nodes attached to them) are calculated.
+            // This should be called every frame after the rendered transforms have been predicted or interpolated
+            void UpdateTransformHierarchy();
+            // Every entity with a render component has the bounds of its mesh where it is rendered updated in the spatial index
+            // (an entity that only moves a little stays in the same cell, and so updating it is cheap).
+            // This should be called every frame after UpdateTransformHierarchy()
+            void UpdateSpatialIndex();
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            cEntityRegistry() = default;
+            // The physics world references the transform components, and so a registry can't be copied
+            cEntityRegistry(const cEntityRegistry&) = delete;
+            cEntityRegistry& operator =(const cEntityRegistry&) = delete;
+
+            void Reserve(const size_t i_entityCount);
+            // Every entity is destroyed
+            // (this must be done before the graphics and physics that the components reference are cleaned up)
+            cResult CleanUp();
+
+            // Data
+            //=====
+
+        private:
+
+            cComponentArray<sTransformComponent> m_transforms;
+            cComponentArray<sRenderComponent> m_renders;
+            cComponentArray<sRigidBodyComponent> m_rigidBodies;
+            cComponentArray<sControllerComponent> m_controllers;
+            cComponentArray<sHierarchyComponent> m_hierarchies;
+            Transform::cTransformHierarchy m_transformHierarchy;
+            Physics::cSpatialHashGrid m_spatialIndex;
+
+            // Indexed by entity ID
+            std::vector<uint8_t> m_doEntitiesExist;
+            std::vector<tEntityId> m_unusedEntityIds;
+            size_t m_entityCount = 0;
+
+            // Implementation
+            //===============
+
+        private:
+
+            // Gives the physics world the address of an entity's transform component
+            void BindBodyTransforms(const tEntityId i_entity);
+            cResult RemoveRender(const tEntityId i_entity);
+        };
+    }
+}
+
+#endif    // EAE6320_GAMEOBJECT_CENTITYREGISTRY_H
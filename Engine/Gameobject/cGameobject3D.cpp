@@ -2,8 +2,17 @@
 //==============
 
 #include "cGameobject3D.h"
+
+#include <Engine/Asserts/Asserts.h>
 #include <Engine/Graphics/cMesh.h>
+#include <Engine/Logging/Logging.h>
 #include <ExampleGame_/Gameplay/cDefaultGameobjectController.h>
+#include <new>
+
+// Static Data Initialization
+//===========================
+
+eae6320::Gameobject::cEntityRegistry eae6320::Gameobject::cGameobject3D::s_registry;
 
 // Interface
 //==========
@@ -11,71 +20,59 @@
 // Initialization / Clean Up
 //--------------------------
 
-eae6320::Gameobject::cGameobject3D::cGameobject3D(const Math::sVector& i_position, const Gameplay::eControllerType i_controllerType)
+eae6320::Gameobject::cGameobject3D::cGameobject3D(const Math::sVector& i_position)
     :
-    m_transform(i_position, Math::cQuaternion()),
-    m_controller(nullptr)
+    m_entity(s_registry.CreateEntity())
 {
-    m_predictionTransform.position = m_transform.position;
-    m_predictionTransform.orientation = m_transform.orientation;
-    switch (i_controllerType)
-    {
-    case Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER:
-        m_controller = reinterpret_cast<Gameplay::cbController*>(Gameplay::DefaultController::Initialize());
-        break;
-    default:;
-    }
+    s_registry.AddTransform(m_entity, i_position, Math::cQuaternion());
 }
 
-eae6320::cResult eae6320::Gameobject::cGameobject3D::Load(const char* const i_path, cGameobject3D*& o_gameobject3D, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const Gameplay::eControllerType i_controllerType)
+eae6320::cResult eae6320::Gameobject::cGameobject3D::Load(const char* const i_path, cGameobject3D*& o_gameobject3D, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const Gameplay::eControllerType i_controllerType, const Physics::ShapeTypes::eType i_shapeType, Physics::cWorld& io_physicsWorld)
 {
     auto result = Results::success;
 
-    //Platform::sDataFromFile dataFromFile;
-
     cGameobject3D* newGameobject3D = nullptr;
 
-    /*// Load the binary data
-    {
-    std::string errorMessage;
-    if (!(result = Platform::LoadBinaryFile(i_path, dataFromFile, &errorMessage)))
-    {
-    EAE6320_ASSERTF(false, errorMessage.c_str());
-    Logging::OutputError("Failed to load shader from file %s: %s", i_path, errorMessage.c_str());
-    goto OnExit;
-    }
-    }*/
-
     // Allocate a new GameObject 3D
     {
-        newGameobject3D = new (std::nothrow) cGameobject3D(i_position, i_controllerType);
+        newGameobject3D = new (std::nothrow) cGameobject3D(i_position);
         if (!newGameobject3D)
         {
             result = Results::outOfMemory;
-            EAE6320_ASSERTF(false, "Couldn't allocate memory for the effect %s", i_path);
-            Logging::OutputError("Failed to allocate memory for the effect %s", i_path);
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for the gameobject %s", i_path);
+            Logging::OutputError("Failed to allocate memory for the gameobject %s", i_path);
             goto OnExit;
         }
     }
-    //if (!(result = newEffect->Initialize(i_path, dataFromFile)))
 
-    // Load the material
-    if (!((result = Graphics::cMaterial::s_manager.Load(i_materialPath, newGameobject3D->m_material))))
+    // Load the mesh and material
+    if (!(result = s_registry.AddRender(newGameobject3D->m_entity, i_meshPath, i_materialPath)))
     {
-        EAE6320_ASSERTF(false, "Loading of material failed: \"%s\"", i_materialPath);
         goto OnExit;
     }
-    newGameobject3D->m_pMaterial = Graphics::cMaterial::s_manager.Get(newGameobject3D->m_material);
 
-    // Load the mesh
+    // Add a body to the physics world
+    // (its shape is fit to the mesh's bounds)
     {
-        if (!((result = Graphics::cMesh::s_manager.Load(i_meshPath, newGameobject3D->m_mesh))))
+        Gameplay::cbController* controller = nullptr;
+        switch (i_controllerType)
         {
-            EAE6320_ASSERTF(false, "Loading of mesh failed");
-            goto OnExit;
+        case Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER:
+            controller = reinterpret_cast<Gameplay::cbController*>(Gameplay::DefaultController::Initialize());
+            break;
+        default:;
+        }
+        if (controller)
+        {
+            Physics::sRigidBodyState rigidBodyState;
+            controller->InitializeRigidBodyState(rigidBodyState);
+            const auto* const mesh = newGameobject3D->GetMesh();
+            const Physics::sAabb localBounds(mesh->GetMinimumBounds(), mesh->GetMaximumBounds());
+            s_registry.AddRigidBody(newGameobject3D->m_entity, io_physicsWorld, rigidBodyState,
+                Physics::sShape::CreateFromBounds(i_shapeType, localBounds));
+            s_registry.AddController(newGameobject3D->m_entity, controller);
         }
     }
-    newGameobject3D->m_pMesh = Graphics::cMesh::s_manager.Get(newGameobject3D->m_mesh);
 
 OnExit:
 
@@ -94,83 +91,50 @@ OnExit:
         o_gameobject3D = nullptr;
     }
 
-    //dataFromFile.Free();
-
     return result;
 }
 
 eae6320::cResult eae6320::Gameobject::cGameobject3D::CleanUp()
 {
-    auto result = Results::success;
-
-    // Material Clean Up
-    if (m_material)
+    // The entity's components release its mesh, material, body, and controller
+    if (s_registry.DoesEntityExist(m_entity))
     {
-        const auto localResult = Graphics::cMaterial::s_manager.Release(m_material);
-        if (!localResult)
-        {
-            EAE6320_ASSERT(false);
-            if (result)
-            {
-                result = localResult;
-            }
-        }
+        s_registry.DestroyEntity(m_entity);
     }
+    m_entity = invalidEntityId;
 
-    // Mesh Clean Up
-    if (m_mesh)
-    {
-        const auto localResult = Graphics::cMesh::s_manager.Release(m_mesh);
-        if (!localResult)
-        {
-            EAE6320_ASSERT(false);
-            if (result)
-            {
-                result = localResult;
-            }
-        }
-    }
+    return Results::success;
+}
 
-    // Controller Clean Up
-    if (m_controller)
-    {
-        delete m_controller;
-    }
+// Access
+//-------
 
-    return result;
+const eae6320::Transform::sPredictionTransform& eae6320::Gameobject::cGameobject3D::GetPredictionTransform() const
+{
+    return s_registry.GetTransforms().Get(m_entity).predictionTransform;
 }
 
+eae6320::Graphics::cMesh* eae6320::Gameobject::cGameobject3D::GetMesh() const
+{
+    return s_registry.GetRenders().Get(m_entity).mesh;
+}
+
+eae6320::Graphics::cMaterial* eae6320::Gameobject::cGameobject3D::GetMaterial() const
+{
+    return s_registry.GetRenders().Get(m_entity).material;
+}
 
 // Update
 //-------
 
 void eae6320::Gameobject::cGameobject3D::UpdateBasedOnSimulationInput() const
 {
-    if (m_controller)
-    {
-        m_controller->UpdatePosition(m_transform);
-        m_controller->UpdateOrientation(m_transform);
-    }
-}
-
-void eae6320::Gameobject::cGameobject3D::UpdateBasedOnSimulationTime(const float i_elapsedSecondCount_sinceLastUpdate)
-{
-    if (m_controller)
-    {
-        m_controller->UpdatePosition(i_elapsedSecondCount_sinceLastUpdate, m_transform);
-        m_controller->UpdateOrientation(i_elapsedSecondCount_sinceLastUpdate, m_transform);
-    }
+    s_registry.UpdateController(m_entity);
 }
 
 void eae6320::Gameobject::cGameobject3D::PredictSimulationBasedOnElapsedTime(const float i_elapsedSecondCount_sinceLastSimulationUpdate)
 {
-    if (m_controller)
-    {
-        m_predictionTransform.position = m_transform.position;
-        m_predictionTransform.orientation = m_transform.orientation;
-        m_controller->UpdatePosition(i_elapsedSecondCount_sinceLastSimulationUpdate, m_predictionTransform);
-        m_controller->UpdateOrientation(i_elapsedSecondCount_sinceLastSimulationUpdate, m_predictionTransform);
-    }
+    s_registry.PredictTransform(m_entity, i_elapsedSecondCount_sinceLastSimulationUpdate);
 }
 
 // Render
@@ -178,9 +142,7 @@ void eae6320::Gameobject::cGameobject3D::PredictSimulationBasedOnElapsedTime(con
 
 void eae6320::Gameobject::cGameobject3D::BindAndDraw() const
 {
-    EAE6320_ASSERT(m_pMaterial);
-    m_pMaterial->Bind();
-    EAE6320_ASSERT(m_pMesh);
-    m_pMesh->Draw();
+    GetMaterial()->Bind();
+    GetMesh()->Draw();
 }
 
@@ -1,5 +1,9 @@
 /*
 A gameobject 3d class is a representation for a 3D gameobject on screen
+
+Its data is stored as components of an entity in the default entity registry (see cEntityRegistry.h),
+and a gameobject is only a reference-counted handle to that entity
+(updating many gameobjects should be done with the registry's systems instead of through each gameobject).
 */
 
 #ifndef EAE6320_GAMEOBJECT_CGAMEOBJECT3D_H
@@ -8,10 +12,11 @@ A gameobject 3d class is a representation for a 3D gameobject on screen
 // Include Files
 //==============
 
-#include <Engine/Transform/sTransform.h>
+#include "cEntityRegistry.h"
+
+#include <Engine/Assets/ReferenceCountedAssets.h>
+#include <Engine/Physics/cWorld.h>
 #include <Engine/Transform/sPredictionTransform.h>
-#include <Engine/Graphics/cMaterial.h>
-#include <Engine/Graphics/cMesh.h>
 #include <ExampleGame_/Gameplay/cDefaultGameobjectController.h>
 
 namespace eae6320
@@ -44,7 +49,7 @@ namespace eae6320
             // Initialization / Clean Up
             //--------------------------
 
-            static cResult Load(const char* const i_path, cGameobject3D*& o_gameobject3D, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const Gameplay::eControllerType i_controllerType);
+            static cResult Load(const char* const i_path, cGameobject3D*& o_gameobject3D, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const Gameplay::eControllerType i_controllerType, const Physics::ShapeTypes::eType i_shapeType, Physics::cWorld& io_physicsWorld);
 
             EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cGameobject3D);
 
@@ -55,11 +60,26 @@ namespace eae6320
 
             cResult CleanUp();
 
+            // Access
+            //-------
+
+            // Every gameobject's entity is in this registry
+            static cEntityRegistry s_registry;
+
+            tEntityId GetEntity() const { return m_entity; }
+            const Transform::sPredictionTransform& GetPredictionTransform() const;
+            Graphics::cMesh* GetMesh() const;
+            Graphics::cMaterial* GetMaterial() const;
+
             //Update
             //------
 
+            // A gameobject's transform is integrated by the physics world that its body was added to
+            // (see cWorld::Integrate() and cWorld::UpdateTransforms())
             void UpdateBasedOnSimulationInput() const;
-            void UpdateBasedOnSimulationTime(const float i_elapsedSecondCount_sinceLastUpdate);
+            // Extrapolates the rendered transform from the last simulation update using the body's velocities.
+            // The physics world can instead interpolate the rendered transforms of all of its bodies at once
+            // (see cWorld::InterpolateTransforms()), in which case this doesn't need to be called
             void PredictSimulationBasedOnElapsedTime(const float i_elapsedSecondCount_sinceLastSimulationUpdate);
 
             // Render
@@ -70,27 +90,21 @@ namespace eae6320
             // Opaque Check
             //-------------
 
-            bool IsOpaque() const { return m_pMaterial->IsOpaque(); }
+            bool IsOpaque() const { return GetMaterial()->IsOpaque(); }
 
         private:
 
             // Initialization / Clean Up
             //--------------------------
-            explicit cGameobject3D(const Math::sVector& i_position, const Gameplay::eControllerType i_controllerType);
+            explicit cGameobject3D(const Math::sVector& i_position);
             ~cGameobject3D() { CleanUp(); }
 
             // Data
             //=====
 
-        public:
-            Transform::sPredictionTransform m_predictionTransform;
-        private:
-            Transform::sTransform m_transform;
-            Gameplay::cbController* m_controller;
-            Graphics::cMesh::Handle m_mesh;
-            Graphics::cMaterial::Handle m_material;
-            Graphics::cMesh* m_pMesh = nullptr;
-            Graphics::cMaterial* m_pMaterial = nullptr;
+            // The entity has a transform and a render component,
+            // and only gameobjects with a controller also have a rigid body and a controller component
+            tEntityId m_entity = invalidEntityId;
             EAE6320_ASSETS_DECLAREREFERENCECOUNT();
         };
     }
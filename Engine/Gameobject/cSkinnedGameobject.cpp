@@ -0,0 +1,130 @@
+// Include Files
+//==============
+
+#include "cSkinnedGameobject.h"
+
+#include <Engine/Logging/Logging.h>
+
+#include <new>
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Gameobject::cSkinnedGameobject::cSkinnedGameobject(const Math::sVector& i_position, const eSkinningMode i_skinningMode)
+    :
+    m_transform(i_position, Math::cQuaternion()),
+    m_skinningMode(i_skinningMode)
+{
+
+}
+
+eae6320::cResult eae6320::Gameobject::cSkinnedGameobject::Load(const char* const i_path, cSkinnedGameobject*& o_skinnedGameobject, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const eSkinningMode i_skinningMode)
+{
+    auto result = Results::success;
+
+    cSkinnedGameobject* newSkinnedGameobject = nullptr;
+
+    // Allocate a new skinned gameobject
+    {
+        newSkinnedGameobject = new (std::nothrow) cSkinnedGameobject(i_position, i_skinningMode);
+        if (!newSkinnedGameobject)
+        {
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for the skinned gameobject %s", i_path);
+            Logging::OutputError("Failed to allocate memory for the skinned gameobject %s", i_path);
+            goto OnExit;
+        }
+    }
+
+    // Load the material
+    if (!((result = Graphics::cMaterial::s_manager.Load(i_materialPath, newSkinnedGameobject->m_material))))
+    {
+        EAE6320_ASSERTF(false, "Loading of material failed: \"%s\"", i_materialPath);
+        goto OnExit;
+    }
+    newSkinnedGameobject->m_pMaterial = Graphics::cMaterial::s_manager.Get(newSkinnedGameobject->m_material);
+
+    // Load the mesh
+    if (!((result = Graphics::cSkinnedMesh::s_manager.Load(i_meshPath, newSkinnedGameobject->m_mesh))))
+    {
+        EAE6320_ASSERTF(false, "Loading of skinned mesh failed: \"%s\"", i_meshPath);
+        goto OnExit;
+    }
+    newSkinnedGameobject->m_pMesh = Graphics::cSkinnedMesh::s_manager.Get(newSkinnedGameobject->m_mesh);
+
+    // The skeleton starts in its bind pose
+    newSkinnedGameobject->m_pose = newSkinnedGameobject->m_pMesh->GetSkeleton().GetBindPose();
+    if ((i_skinningMode == SKIN_ON_GPU) && !newSkinnedGameobject->m_pMesh->CanBeSkinnedOnGpu())
+    {
+        Logging::OutputMessage("The skeleton of \"%s\" has too many joints to be skinned on the GPU and so it will be skinned on the CPU", i_meshPath);
+        newSkinnedGameobject->m_skinningMode = SKIN_ON_CPU;
+    }
+
+OnExit:
+
+    if (result)
+    {
+        EAE6320_ASSERT(newSkinnedGameobject);
+        o_skinnedGameobject = newSkinnedGameobject;
+    }
+    else
+    {
+        if (newSkinnedGameobject)
+        {
+            newSkinnedGameobject->DecrementReferenceCount();
+            newSkinnedGameobject = nullptr;
+        }
+        o_skinnedGameobject = nullptr;
+    }
+
+    return result;
+}
+
+eae6320::cResult eae6320::Gameobject::cSkinnedGameobject::CleanUp()
+{
+    auto result = Results::success;
+
+    // Material Clean Up
+    if (m_material)
+    {
+        const auto localResult = Graphics::cMaterial::s_manager.Release(m_material);
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    m_pMaterial = nullptr;
+
+    // Mesh Clean Up
+    if (m_mesh)
+    {
+        const auto localResult = Graphics::cSkinnedMesh::s_manager.Release(m_mesh);
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    m_pMesh = nullptr;
+
+    return result;
+}
+
+// Render
+//-------
+
+void eae6320::Gameobject::cSkinnedGameobject::BindMaterial() const
+{
+    EAE6320_ASSERT(m_pMaterial);
+    m_pMaterial->Bind();
+}
@@ -0,0 +1,109 @@
+/*
+A skinned gameobject is a 3D gameobject whose mesh is deformed by a skeleton
+
+The gameobject owns the current pose of the skeleton,
+and gameplay code can change it every frame (e.g. from an animation).
+Its material must use a vertex shader that skins vertices (like "Effects/skinned.tef"):
+Vertices that are skinned on the CPU are drawn with an identity matrix palette,
+and so the same material works with both ways of skinning.
+*/
+
+#ifndef EAE6320_GAMEOBJECT_CSKINNEDGAMEOBJECT_H
+#define EAE6320_GAMEOBJECT_CSKINNEDGAMEOBJECT_H
+
+// Include Files
+//==============
+
+#include <Engine/Animation/cSkeleton.h>
+#include <Engine/Graphics/cMaterial.h>
+#include <Engine/Graphics/cSkinnedMesh.h>
+#include <Engine/Transform/sTransform.h>
+
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Gameobject
+    {
+        class cSkinnedGameobject
+        {
+            // Interface
+            //==========
+
+        public:
+
+            enum eSkinningMode : uint8_t
+            {
+                // The vertex shader skins the mesh
+                // (this is only possible if the skeleton's joint transforms fit into the per-skinned draw call constant buffer;
+                // otherwise the mesh is skinned on the CPU instead)
+                SKIN_ON_GPU,
+                // Worker threads skin the mesh and the skinned vertices are uploaded every frame
+                SKIN_ON_CPU
+            };
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            static cResult Load(const char* const i_path, cSkinnedGameobject*& o_skinnedGameobject, const Math::sVector& i_position, char const * const i_meshPath, char const * const i_materialPath, const eSkinningMode i_skinningMode);
+
+            EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cSkinnedGameobject);
+
+            // Reference Counting
+            //-------------------
+
+            EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS();
+
+            cResult CleanUp();
+
+            // Access
+            //-------
+
+            Transform::sTransform& GetTransform() { return m_transform; }
+            const Transform::sTransform& GetTransform() const { return m_transform; }
+            // There is one joint pose for every joint of the skeleton,
+            // each relative to its parent joint.
+            // It starts as the bind pose
+            std::vector<Animation::sJointPose>& GetPose() { return m_pose; }
+            const std::vector<Animation::sJointPose>& GetPose() const { return m_pose; }
+            const Graphics::cSkinnedMesh& GetSkinnedMesh() const { return *m_pMesh; }
+            eSkinningMode GetSkinningMode() const { return m_skinningMode; }
+
+            // Render
+            //-------
+
+            // The mesh is drawn by the graphics system (which has to skin it first)
+            void BindMaterial() const;
+
+            // Opaque Check
+            //-------------
+
+            bool IsOpaque() const { return m_pMaterial->IsOpaque(); }
+
+        private:
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            cSkinnedGameobject(const Math::sVector& i_position, const eSkinningMode i_skinningMode);
+            ~cSkinnedGameobject() { CleanUp(); }
+
+            // Data
+            //=====
+
+            Transform::sTransform m_transform;
+            std::vector<Animation::sJointPose> m_pose;
+            Graphics::cSkinnedMesh::Handle m_mesh;
+            Graphics::cMaterial::Handle m_material;
+            Graphics::cSkinnedMesh* m_pMesh = nullptr;
+            Graphics::cMaterial* m_pMaterial = nullptr;
+            EAE6320_ASSETS_DECLAREREFERENCECOUNT();
+            eSkinningMode m_skinningMode;
+        };
+    }
+}
+
+#endif // EAE6320_GAMEOBJECT_CSKINNEDGAMEOBJECT_H
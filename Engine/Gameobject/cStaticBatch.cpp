@@ -0,0 +1,310 @@
+// Include Files
+//==============
+
+#include "cStaticBatch.h"
+
+#include <Engine/Graphics/MeshHelperStructs.h>
+#include <Engine/Graphics/VertexFormats.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Math/TangentFrame.h>
+#include <Engine/Platform/Platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <new>
+#include <string>
+#include <tuple>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // The geometry of a mesh file that is shared by every instance that uses it
+    struct sSourceMesh
+    {
+        eae6320::Platform::sDataFromFile dataFromFile;
+        const eae6320::Graphics::VertexFormats::sMesh* vertexData = nullptr;
+        const void* indexData = nullptr;
+        uint32_t numberOfVertices = 0;
+        uint32_t numberOfIndices = 0;
+        eae6320::Graphics::IndexDataTypes::eType type = eae6320::Graphics::IndexDataTypes::UNKNOWN;
+        // The bounds of the vertices in the mesh's space
+        eae6320::Physics::sAabb bounds;
+    };
+
+    // Instances are merged into the same batch if they share a material and a chunk
+    using tBatchKey = std::tuple<std::string, int32_t, int32_t, int32_t>;
+}
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Gameobject::cStaticBatch::Build(const sInstance* const i_instances, const size_t i_instanceCount, const float i_chunkSize, std::vector<cStaticBatch*>& o_batches,
+    Physics::cWorld* const io_physicsWorld)
+{
+    auto result = Results::success;
+
+    std::map<std::string, sSourceMesh> sourceMeshes;
+    std::map<tBatchKey, std::vector<size_t>> instancesPerBatch;
+    std::vector<cStaticBatch*> newBatches;
+
+    EAE6320_ASSERT(i_instances || (i_instanceCount == 0));
+    EAE6320_ASSERT(i_chunkSize > 0.0f);
+
+    // Sort the instances into batches and load each mesh once
+    for (size_t i = 0; i < i_instanceCount; i++)
+    {
+        const auto& instance = i_instances[i];
+        EAE6320_ASSERT(instance.meshPath && instance.materialPath);
+
+        const tBatchKey batchKey(instance.materialPath,
+            static_cast<int32_t>(std::floor(instance.position.x / i_chunkSize)),
+            static_cast<int32_t>(std::floor(instance.position.y / i_chunkSize)),
+            static_cast<int32_t>(std::floor(instance.position.z / i_chunkSize)));
+        instancesPerBatch[batchKey].push_back(i);
+
+        if (sourceMeshes.find(instance.meshPath) == sourceMeshes.end())
+        {
+            auto& sourceMesh = sourceMeshes[instance.meshPath];
+            Graphics::HelperStructs::sMeshData meshData;
+            result = Graphics::cMesh::LoadMeshData(instance.meshPath, sourceMesh.dataFromFile, meshData);
+            sourceMesh.vertexData = meshData.vertexData;
+            sourceMesh.indexData = meshData.indexData;
+            sourceMesh.numberOfVertices = meshData.numberOfVertices;
+            sourceMesh.numberOfIndices = meshData.numberOfIndices;
+            sourceMesh.type = meshData.type;
+            // The mesh data points into the loaded file and so it must not free anything
+            // (the skeleton of a skinned mesh is ignored and its bind pose is batched)
+            meshData.vertexData = nullptr;
+            meshData.indexData = nullptr;
+            meshData.skinningData = nullptr;
+            meshData.jointData = nullptr;
+            if (!result)
+            {
+                EAE6320_ASSERTF(false, "Loading of static mesh failed: \"%s\"", instance.meshPath);
+                goto OnExit;
+            }
+            for (uint32_t j = 0; j < sourceMesh.numberOfVertices; j++)
+            {
+                const auto& vertex = sourceMesh.vertexData[j];
+                const Math::sVector position(vertex.x, vertex.y, vertex.z);
+                sourceMesh.bounds = (j == 0) ? Physics::sAabb(position, position) : Physics::Merge(sourceMesh.bounds, Physics::sAabb(position, position));
+            }
+        }
+    }
+
+    // Merge the instances of each batch
+    for (const auto& batch : instancesPerBatch)
+    {
+        const auto& instanceIndices = batch.second;
+        const auto instanceCount = instanceIndices.size();
+
+        // Count the merged geometry and position the batch at the center of its instances
+        uint64_t numberOfVertices = 0;
+        uint64_t numberOfIndices = 0;
+        Math::sVector batchPosition;
+        for (size_t i = 0; i < instanceCount; i++)
+        {
+            const auto& instance = i_instances[instanceIndices[i]];
+            const auto& sourceMesh = sourceMeshes[instance.meshPath];
+            numberOfVertices += sourceMesh.numberOfVertices;
+            numberOfIndices += sourceMesh.numberOfIndices;
+            batchPosition += instance.position;
+        }
+        batchPosition /= static_cast<float>(instanceCount);
+        if ((numberOfVertices > static_cast<uint64_t>(INT32_MAX)) || (numberOfIndices > static_cast<uint64_t>(UINT32_MAX)))
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF(false, "Too much geometry in a single static batch");
+            Logging::OutputError("The static batch for material \"%s\" has too much geometry; use a smaller chunk size", std::get<0>(batch.first).c_str());
+            goto OnExit;
+        }
+        // 16 bit indices are used whenever every vertex can be addressed by them
+        const auto indexType = (numberOfVertices <= (UINT16_MAX + 1u)) ? Graphics::IndexDataTypes::BIT_16 : Graphics::IndexDataTypes::BIT_32;
+
+        Graphics::HelperStructs::sMeshData mergedMeshData(indexType, static_cast<uint32_t>(numberOfVertices), static_cast<uint32_t>(numberOfIndices));
+        if (!mergedMeshData.vertexData || !mergedMeshData.indexData)
+        {
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for a static batch");
+            Logging::OutputError("Failed to allocate memory for the static batch for material \"%s\"", std::get<0>(batch.first).c_str());
+            goto OnExit;
+        }
+
+        // Allocate a new static batch
+        auto* const newBatch = new (std::nothrow) cStaticBatch();
+        if (!newBatch)
+        {
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for a static batch");
+            Logging::OutputError("Failed to allocate memory for the static batch for material \"%s\"", std::get<0>(batch.first).c_str());
+            goto OnExit;
+        }
+        newBatches.push_back(newBatch);
+        newBatch->m_position = batchPosition;
+        newBatch->m_instanceCount = instanceCount;
+
+        // Transform each instance's geometry into the batch's space and append it
+        {
+            auto* const vertexData = mergedMeshData.vertexData;
+            auto* const indexData_16 = reinterpret_cast<uint16_t*>(mergedMeshData.indexData);
+            auto* const indexData_32 = reinterpret_cast<uint32_t*>(mergedMeshData.indexData);
+            uint32_t vertexOffset = 0;
+            uint32_t indexOffset = 0;
+            auto areBoundsInitialized = false;
+            for (size_t i = 0; i < instanceCount; i++)
+            {
+                const auto& instance = i_instances[instanceIndices[i]];
+                const auto& sourceMesh = sourceMeshes[instance.meshPath];
+                const auto relativePosition = instance.position - batchPosition;
+
+                for (uint32_t j = 0; j < sourceMesh.numberOfVertices; j++)
+                {
+                    const auto& sourceVertex = sourceMesh.vertexData[j];
+                    auto& vertex = vertexData[vertexOffset + j];
+                    vertex = sourceVertex;
+
+                    const auto position = (instance.orientation * Math::sVector(sourceVertex.x, sourceVertex.y, sourceVertex.z)) + relativePosition;
+                    vertex.x = position.x;
+                    vertex.y = position.y;
+                    vertex.z = position.z;
+                    // Static instances can only be rotated and translated,
+                    // and so the normals and tangent frames only need to be rotated
+                    const auto normal = instance.orientation * Math::sVector(sourceVertex.nx, sourceVertex.ny, sourceVertex.nz);
+                    vertex.nx = normal.x;
+                    vertex.ny = normal.y;
+                    vertex.nz = normal.z;
+                    {
+                        int16_t tangentFrame[] = { sourceVertex.qx, sourceVertex.qy, sourceVertex.qz, sourceVertex.qw };
+                        Math::RotateTangentFrame(instance.orientation, tangentFrame);
+                        vertex.qx = tangentFrame[0];
+                        vertex.qy = tangentFrame[1];
+                        vertex.qz = tangentFrame[2];
+                        vertex.qw = tangentFrame[3];
+                    }
+
+                    if (areBoundsInitialized)
+                    {
+                        newBatch->m_minimumBounds = Math::sVector(std::min(newBatch->m_minimumBounds.x, position.x), std::min(newBatch->m_minimumBounds.y, position.y), std::min(newBatch->m_minimumBounds.z, position.z));
+                        newBatch->m_maximumBounds = Math::sVector(std::max(newBatch->m_maximumBounds.x, position.x), std::max(newBatch->m_maximumBounds.y, position.y), std::max(newBatch->m_maximumBounds.z, position.z));
+                    }
+                    else
+                    {
+                        newBatch->m_minimumBounds = newBatch->m_maximumBounds = position;
+                        areBoundsInitialized = true;
+                    }
+                }
+
+                for (uint32_t j = 0; j < sourceMesh.numberOfIndices; j++)
+                {
+                    const auto index = vertexOffset + ((sourceMesh.type == Graphics::IndexDataTypes::BIT_16) ?
+                        static_cast<uint32_t>(reinterpret_cast<const uint16_t*>(sourceMesh.indexData)[j]) :
+                        reinterpret_cast<const uint32_t*>(sourceMesh.indexData)[j]);
+                    if (indexType == Graphics::IndexDataTypes::BIT_16)
+                    {
+                        indexData_16[indexOffset + j] = static_cast<uint16_t>(index);
+                    }
+                    else
+                    {
+                        indexData_32[indexOffset + j] = index;
+                    }
+                }
+
+                vertexOffset += sourceMesh.numberOfVertices;
+                indexOffset += sourceMesh.numberOfIndices;
+            }
+        }
+
+        // Create the merged mesh
+        if (!((result = Graphics::cMesh::Create(&mergedMeshData, newBatch->m_pMesh))))
+        {
+            EAE6320_ASSERTF(false, "Creation of the static batch mesh failed");
+            goto OnExit;
+        }
+
+        // Load the material
+        if (!((result = Graphics::cMaterial::s_manager.Load(std::get<0>(batch.first).c_str(), newBatch->m_material))))
+        {
+            EAE6320_ASSERTF(false, "Loading of material failed: \"%s\"", std::get<0>(batch.first).c_str());
+            goto OnExit;
+        }
+        newBatch->m_pMaterial = Graphics::cMaterial::s_manager.Get(newBatch->m_material);
+    }
+
+OnExit:
+
+    if (result)
+    {
+        o_batches.insert(o_batches.end(), newBatches.begin(), newBatches.end());
+        if (io_physicsWorld)
+        {
+            Physics::sRigidBodyState rigidBodyState;
+            rigidBodyState.angularSpeed = 0.0f;
+            for (size_t i = 0; i < i_instanceCount; i++)
+            {
+                const auto& instance = i_instances[i];
+                auto shape = Physics::sShape::CreateFromBounds(instance.shapeType, sourceMeshes[instance.meshPath].bounds);
+                shape.density = 0.0f;
+                io_physicsWorld->AddBody(instance.position, instance.orientation, rigidBodyState, shape);
+            }
+        }
+    }
+    else
+    {
+        for (auto* const newBatch : newBatches)
+        {
+            newBatch->DecrementReferenceCount();
+        }
+    }
+    for (auto& sourceMesh : sourceMeshes)
+    {
+        sourceMesh.second.dataFromFile.Free();
+    }
+
+    return result;
+}
+
+eae6320::cResult eae6320::Gameobject::cStaticBatch::CleanUp()
+{
+    auto result = Results::success;
+
+    // Material Clean Up
+    if (m_material)
+    {
+        const auto localResult = Graphics::cMaterial::s_manager.Release(m_material);
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
+    m_pMaterial = nullptr;
+
+    // Mesh Clean Up
+    if (m_pMesh)
+    {
+        m_pMesh->DecrementReferenceCount();
+        m_pMesh = nullptr;
+    }
+
+    return result;
+}
+
+// Render
+//-------
+
+void eae6320::Gameobject::cStaticBatch::BindAndDraw() const
+{
+    EAE6320_ASSERT(m_pMaterial);
+    m_pMaterial->Bind();
+    EAE6320_ASSERT(m_pMesh);
+    m_pMesh->Draw();
+}
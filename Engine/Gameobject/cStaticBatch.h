@@ -0,0 +1,117 @@
+/*
+A static batch is static geometry that has been merged into a single mesh.
+
+Gameobjects that never move can have their meshes transformed into world space
+once at load time and the meshes that share a material can then be drawn with a single draw call.
+The geometry is split into spatial chunks (rather than all of it being merged into one mesh)
+so that each batch can still be culled independently.
+
+If a physics world is provided then every instance also gets a static body
+so that moving bodies collide with the static geometry.
+*/
+
+#ifndef EAE6320_GAMEOBJECT_CSTATICBATCH_H
+#define EAE6320_GAMEOBJECT_CSTATICBATCH_H
+
+// Include Files
+//==============
+
+#include <Engine/Graphics/cMaterial.h>
+#include <Engine/Graphics/cMesh.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Physics/cWorld.h>
+
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Gameobject
+    {
+        class cStaticBatch
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // A single instance of static geometry that should be merged into a batch
+            struct sInstance
+            {
+                const char* meshPath = nullptr;
+                const char* materialPath = nullptr;
+                Math::sVector position;
+                Math::cQuaternion orientation;
+                // The shape of the instance's static body is fit to the bounds of its mesh
+                Physics::ShapeTypes::eType shapeType = Physics::ShapeTypes::BOX;
+            };
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // Merges all of the instances that share a material and are in the same spatial chunk into a single batch.
+            // The chunk size is the length in world units of the (cubic) chunks that the world is divided into.
+            // If a physics world is provided a static body is added to it for every instance
+            // (the bodies aren't owned by the batches and are removed by clearing the world)
+            static cResult Build(const sInstance* const i_instances, const size_t i_instanceCount, const float i_chunkSize, std::vector<cStaticBatch*>& o_batches,
+                Physics::cWorld* const io_physicsWorld = nullptr);
+
+            EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cStaticBatch);
+
+            // Reference Counting
+            //-------------------
+
+            EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS();
+
+            cResult CleanUp();
+
+            // Access
+            //-------
+
+            // The batch's vertices are relative to its position
+            // (this keeps floating point precision close to the geometry
+            // and allows translucent batches to be sorted the same way as gameobjects)
+            const Math::sVector& GetPosition() const { return m_position; }
+            // The bounds are an axis-aligned box relative to the batch's position
+            const Math::sVector& GetMinimumBounds() const { return m_minimumBounds; }
+            const Math::sVector& GetMaximumBounds() const { return m_maximumBounds; }
+            size_t GetInstanceCount() const { return m_instanceCount; }
+
+            // Render
+            //-------
+
+            void BindAndDraw() const;
+
+            // Opaque Check
+            //-------------
+
+            bool IsOpaque() const { return m_pMaterial->IsOpaque(); }
+
+        private:
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            cStaticBatch() = default;
+            ~cStaticBatch() { CleanUp(); }
+
+            // Data
+            //=====
+
+            Math::sVector m_position;
+            Math::sVector m_minimumBounds;
+            Math::sVector m_maximumBounds;
+            size_t m_instanceCount = 0;
+            // The merged mesh isn't loaded from a file and so it is owned by the batch rather than the mesh manager
+            Graphics::cMesh* m_pMesh = nullptr;
+            Graphics::cMaterial::Handle m_material;
+            Graphics::cMaterial* m_pMaterial = nullptr;
+            EAE6320_ASSETS_DECLAREREFERENCECOUNT();
+        };
+    }
+}
+
+#endif // EAE6320_GAMEOBJECT_CSTATICBATCH_H
@@ -6,10 +6,13 @@
 
 namespace eae6320
 {
+    namespace Physics
+    {
+        struct sRigidBodyState;
+    }
     namespace Transform
     {
         struct sTransform;
-        struct sPredictionTransform;
     }
 }
 
@@ -20,6 +23,8 @@ namespace eae6320
         // Class Declaration
         //==================
 
+        // A controller changes the motion of a gameobject's rigid body;
+        // the bodies of all gameobjects are then integrated together by the physics world (see cWorld.h)
         class cbController
         {
         public:
@@ -31,12 +36,10 @@ namespace eae6320
             // Interface
             //==========
 
-            virtual void UpdatePosition(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform) = 0;
-            virtual void UpdateOrientation(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform) = 0;
-            virtual void UpdatePosition(const Transform::sTransform& i_transform) = 0;
-            virtual void UpdateOrientation(const Transform::sTransform& i_transform) = 0;
-            virtual void UpdatePosition(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform) = 0;
-            virtual void UpdateOrientation(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform) = 0;
+            // This is called once when the gameobject's body is added to the physics world
+            virtual void InitializeRigidBodyState(Physics::sRigidBodyState& io_rigidBodyState) const {}
+            virtual void UpdatePosition(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState) = 0;
+            virtual void UpdateOrientation(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState) = 0;
         };
     }
 }
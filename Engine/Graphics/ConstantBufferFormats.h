@@ -13,6 +13,8 @@
 
 #include <Engine/Math/cMatrix_transformation.h>
 
+#include <cstddef>
+
 // Format Definitions
 //===================
 
@@ -45,6 +47,15 @@ namespace eae6320
                 Math::cMatrixTransformation g_transform_localToWorld;
                 Math::cMatrixTransformation g_transform_localToProjected;
             };
+
+            // A mesh that is skinned on the GPU can't have more joints than this
+            // (meshes with more joints must be skinned on the CPU)
+            constexpr size_t maxJointCountForGpuSkinning = 64;
+
+            struct sPerSkinnedDrawCall
+            {
+                Math::cMatrixTransformation g_transforms_skinning[maxJointCountForGpuSkinning];
+            };
         }
     }
 }
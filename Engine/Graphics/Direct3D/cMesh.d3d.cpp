@@ -45,7 +45,7 @@ eae6320::cResult eae6320::Graphics::cMesh::Initialize(HelperStructs::sMeshData c
             // (by using so-called "semantic" names so that, for example,
             // "POSITION" here matches with "POSITION" in shader code).
             // Note that OpenGL uses arbitrarily assignable number IDs to do the same thing.
-            constexpr unsigned int vertexElementCount = 4;
+            constexpr unsigned int vertexElementCount = 5;
             D3D11_INPUT_ELEMENT_DESC layoutDescription[vertexElementCount] = {};
             {
                 // Slot 0
@@ -115,6 +115,23 @@ eae6320::cResult eae6320::Graphics::cMesh::Initialize(HelperStructs::sMeshData c
                     colorElement.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
                     colorElement.InstanceDataStepRate = 0;    // (Must be zero for per-vertex data)
                 }
+
+                // Slot 4
+
+                // TANGENT_FRAME
+                // 4 int16_t == 8 bytes
+                // Offset = 32
+                {
+                    auto& tangentFrameElement = layoutDescription[4];
+
+                    tangentFrameElement.SemanticName = "TANGENT";
+                    tangentFrameElement.SemanticIndex = 0;    // (Semantics without modifying indices at the end can always use zero)
+                    tangentFrameElement.Format = DXGI_FORMAT_R16G16B16A16_SNORM;
+                    tangentFrameElement.InputSlot = 0;
+                    tangentFrameElement.AlignedByteOffset = offsetof(eae6320::Graphics::VertexFormats::sMesh, qx);
+                    tangentFrameElement.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+                    tangentFrameElement.InstanceDataStepRate = 0;    // (Must be zero for per-vertex data)
+                }
             }
 
             const auto d3DResult = direct3DDevice->CreateInputLayout(layoutDescription, vertexElementCount,
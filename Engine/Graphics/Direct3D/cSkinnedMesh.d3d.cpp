@@ -0,0 +1,302 @@
+// Include Files
+//==============
+
+#include "../cSkinnedMesh.h"
+
+#include "Includes.h"
+#include "../sContext.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Platform/Platform.h>
+
+#include <cstring>
+
+// Static Data Initialization
+//===========================
+
+ID3D11InputLayout* eae6320::Graphics::cSkinnedMesh::ms_vertexInputLayout = nullptr;
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    void SetVertexElement(D3D11_INPUT_ELEMENT_DESC& o_element, const char* const i_semanticName, const DXGI_FORMAT i_format,
+        const unsigned int i_inputSlot, const unsigned int i_offset);
+    eae6320::cResult CreateBuffer(const void* const i_initialData, const size_t i_size, const unsigned int i_bindFlags, const bool i_isDynamic,
+        const char* const i_description, ID3D11Buffer*& o_buffer);
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnGpu() const
+{
+    auto* const direct3DImmediateContext = sContext::g_context.direct3DImmediateContext;
+    EAE6320_ASSERT(direct3DImmediateContext);
+
+    // Bind the bind pose vertices and the skinning data
+    {
+        EAE6320_ASSERT(m_vertexBuffer_bind && m_skinningBuffer);
+        constexpr unsigned int startingSlot = 0;
+        constexpr unsigned int vertexBufferCount = 2;
+        ID3D11Buffer* const vertexBuffers[vertexBufferCount] = { m_vertexBuffer_bind, m_skinningBuffer };
+        constexpr unsigned int bufferStrides[vertexBufferCount] = { sizeof(VertexFormats::sMesh), sizeof(VertexFormats::sSkinning) };
+        constexpr unsigned int bufferOffsets[vertexBufferCount] = { 0, 0 };
+        direct3DImmediateContext->IASetVertexBuffers(startingSlot, vertexBufferCount, vertexBuffers, bufferStrides, bufferOffsets);
+    }
+    // Bind the index buffer
+    {
+        EAE6320_ASSERT(m_indexBuffer);
+        const auto dxgiFormat = (m_type == IndexDataTypes::BIT_16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+        constexpr unsigned int offset = 0;
+        direct3DImmediateContext->IASetIndexBuffer(m_indexBuffer, dxgiFormat, offset);
+    }
+    if (VertexFormats::g_layoutType != VertexFormats::SKINNED_MESH)
+    {
+        VertexFormats::g_layoutType = VertexFormats::SKINNED_MESH;
+        EAE6320_ASSERT(ms_vertexInputLayout);
+        direct3DImmediateContext->IASetInputLayout(ms_vertexInputLayout);
+        direct3DImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    }
+    // Render triangles
+    {
+        constexpr unsigned int indexOfFirstIndexToUse = 0;
+        constexpr unsigned int offsetToAddToEachIndex = 0;
+        direct3DImmediateContext->DrawIndexed(m_numberOfIndices, indexOfFirstIndexToUse, offsetToAddToEachIndex);
+    }
+}
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnCpu(const VertexFormats::sMesh* const i_vertices_skinned) const
+{
+    auto* const direct3DImmediateContext = sContext::g_context.direct3DImmediateContext;
+    EAE6320_ASSERT(direct3DImmediateContext);
+
+    // Upload the skinned vertices
+    {
+        EAE6320_ASSERT(m_vertexBuffer_skinned && i_vertices_skinned);
+        D3D11_MAPPED_SUBRESOURCE mappedSubResource;
+        // Discarding the previous contents lets Direct3D give us new memory
+        // if the GPU is still using the buffer for a previous draw call
+        constexpr unsigned int noSubResources = 0;
+        constexpr auto mapType = D3D11_MAP_WRITE_DISCARD;
+        constexpr unsigned int noFlags = 0;
+        const auto d3DResult = direct3DImmediateContext->Map(m_vertexBuffer_skinned, noSubResources, mapType, noFlags, &mappedSubResource);
+        if (FAILED(d3DResult))
+        {
+            EAE6320_ASSERTF(false, "Couldn't map the skinned vertex buffer (HRESULT %#010x)", d3DResult);
+            Logging::OutputError("Direct3D failed to map the skinned vertex buffer (HRESULT %#010x)", d3DResult);
+            return;
+        }
+        memcpy(mappedSubResource.pData, i_vertices_skinned, m_vertices_bind.size() * sizeof(VertexFormats::sMesh));
+        direct3DImmediateContext->Unmap(m_vertexBuffer_skinned, noSubResources);
+    }
+    // Bind the skinned vertices
+    // (the skinning data is still needed because the vertex shader skins the vertices again with an identity matrix palette)
+    {
+        constexpr unsigned int startingSlot = 0;
+        constexpr unsigned int vertexBufferCount = 2;
+        ID3D11Buffer* const vertexBuffers[vertexBufferCount] = { m_vertexBuffer_skinned, m_skinningBuffer };
+        constexpr unsigned int bufferStrides[vertexBufferCount] = { sizeof(VertexFormats::sMesh), sizeof(VertexFormats::sSkinning) };
+        constexpr unsigned int bufferOffsets[vertexBufferCount] = { 0, 0 };
+        direct3DImmediateContext->IASetVertexBuffers(startingSlot, vertexBufferCount, vertexBuffers, bufferStrides, bufferOffsets);
+    }
+    // Bind the index buffer
+    {
+        EAE6320_ASSERT(m_indexBuffer);
+        const auto dxgiFormat = (m_type == IndexDataTypes::BIT_16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+        constexpr unsigned int offset = 0;
+        direct3DImmediateContext->IASetIndexBuffer(m_indexBuffer, dxgiFormat, offset);
+    }
+    if (VertexFormats::g_layoutType != VertexFormats::SKINNED_MESH)
+    {
+        VertexFormats::g_layoutType = VertexFormats::SKINNED_MESH;
+        EAE6320_ASSERT(ms_vertexInputLayout);
+        direct3DImmediateContext->IASetInputLayout(ms_vertexInputLayout);
+        direct3DImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    }
+    // Render triangles
+    {
+        constexpr unsigned int indexOfFirstIndexToUse = 0;
+        constexpr unsigned int offsetToAddToEachIndex = 0;
+        direct3DImmediateContext->DrawIndexed(m_numberOfIndices, indexOfFirstIndexToUse, offsetToAddToEachIndex);
+    }
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::InitializePlatformSpecific(const HelperStructs::sMeshData& i_meshData)
+{
+    auto result = Results::success;
+
+    auto* const direct3DDevice = sContext::g_context.direct3DDevice;
+    EAE6320_ASSERT(direct3DDevice);
+
+    // Initialize vertex format
+    if (!ms_vertexInputLayout)
+    {
+        // Load the compiled binary vertex shader for the input layout
+        Platform::sDataFromFile vertexShaderDataFromFile;
+        std::string errorMessage;
+        if ((result = LoadBinaryFile("data/Shaders/Vertex/vertexInputLayout_skinnedMesh.busl", vertexShaderDataFromFile, &errorMessage)))
+        {
+            // These elements must match the VertexFormats::sMesh and VertexFormats::sSkinning layout structs exactly
+            // (slot 0 is the sMesh stream and slot 1 is the sSkinning stream)
+            constexpr unsigned int vertexElementCount = 7;
+            D3D11_INPUT_ELEMENT_DESC layoutDescription[vertexElementCount] = {};
+            {
+                SetVertexElement(layoutDescription[0], "POSITION", DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(VertexFormats::sMesh, x));
+                SetVertexElement(layoutDescription[1], "NORMAL", DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(VertexFormats::sMesh, nx));
+                SetVertexElement(layoutDescription[2], "TEXCOORD", DXGI_FORMAT_R16G16_FLOAT, 0, offsetof(VertexFormats::sMesh, u));
+                SetVertexElement(layoutDescription[3], "COLOR", DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(VertexFormats::sMesh, r));
+                SetVertexElement(layoutDescription[4], "TANGENT", DXGI_FORMAT_R16G16B16A16_SNORM, 0, offsetof(VertexFormats::sMesh, qx));
+                // The indices are integers and the weights are normalized to [0,1]
+                SetVertexElement(layoutDescription[5], "BLENDINDICES", DXGI_FORMAT_R8G8B8A8_UINT, 1, offsetof(VertexFormats::sSkinning, jointIndices));
+                SetVertexElement(layoutDescription[6], "BLENDWEIGHT", DXGI_FORMAT_R8G8B8A8_UNORM, 1, offsetof(VertexFormats::sSkinning, jointWeights));
+            }
+
+            const auto d3DResult = direct3DDevice->CreateInputLayout(layoutDescription, vertexElementCount,
+                vertexShaderDataFromFile.data, vertexShaderDataFromFile.size, &ms_vertexInputLayout);
+            vertexShaderDataFromFile.Free();
+            if (FAILED(d3DResult))
+            {
+                result = Results::Failure;
+                EAE6320_ASSERTF(false, "Skinned mesh vertex input layout creation failed (HRESULT %#010x)", d3DResult);
+                Logging::OutputError("Direct3D failed to create the skinned mesh vertex input layout (HRESULT %#010x)", d3DResult);
+                goto OnExit;
+            }
+        }
+        else
+        {
+            EAE6320_ASSERTF(false, errorMessage.c_str());
+            Logging::OutputError("The skinned mesh vertex input layout shader couldn't be loaded: %s", errorMessage.c_str());
+            goto OnExit;
+        }
+    }
+    else
+    {
+        // Every skinned mesh holds a reference to the shared input layout
+        // so that it is released with the last one
+        ms_vertexInputLayout->AddRef();
+    }
+
+    // Vertex Buffers
+    {
+        const auto vertexDataSize = i_meshData.numberOfVertices * sizeof(VertexFormats::sMesh);
+        if (!((result = CreateBuffer(i_meshData.vertexData, vertexDataSize, D3D11_BIND_VERTEX_BUFFER, false, "bind pose vertex", m_vertexBuffer_bind))))
+        {
+            goto OnExit;
+        }
+        if (!((result = CreateBuffer(nullptr, vertexDataSize, D3D11_BIND_VERTEX_BUFFER, true, "skinned vertex", m_vertexBuffer_skinned))))
+        {
+            goto OnExit;
+        }
+        if (!((result = CreateBuffer(i_meshData.skinningData, i_meshData.numberOfVertices * sizeof(VertexFormats::sSkinning), D3D11_BIND_VERTEX_BUFFER, false,
+            "skinning", m_skinningBuffer))))
+        {
+            goto OnExit;
+        }
+    }
+
+    // Index Buffer
+    {
+        const auto indexDataSize = (m_type == IndexDataTypes::BIT_16) ? m_numberOfIndices * sizeof(uint16_t) : m_numberOfIndices * sizeof(uint32_t);
+        if (!((result = CreateBuffer(i_meshData.indexData, indexDataSize, D3D11_BIND_INDEX_BUFFER, false, "index", m_indexBuffer))))
+        {
+            goto OnExit;
+        }
+    }
+
+OnExit:
+
+    return result;
+}
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::CleanUp()
+{
+    const auto result = Results::success;
+
+    if (m_vertexBuffer_bind)
+    {
+        m_vertexBuffer_bind->Release();
+        m_vertexBuffer_bind = nullptr;
+    }
+    if (m_vertexBuffer_skinned)
+    {
+        m_vertexBuffer_skinned->Release();
+        m_vertexBuffer_skinned = nullptr;
+    }
+    if (m_skinningBuffer)
+    {
+        m_skinningBuffer->Release();
+        m_skinningBuffer = nullptr;
+    }
+    if (m_indexBuffer)
+    {
+        m_indexBuffer->Release();
+        m_indexBuffer = nullptr;
+        // A mesh only has an index buffer if it also holds a reference to the input layout
+        if (ms_vertexInputLayout && (ms_vertexInputLayout->Release() == 0))
+        {
+            ms_vertexInputLayout = nullptr;
+        }
+    }
+    m_skeleton.CleanUp();
+
+    return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void SetVertexElement(D3D11_INPUT_ELEMENT_DESC& o_element, const char* const i_semanticName, const DXGI_FORMAT i_format,
+        const unsigned int i_inputSlot, const unsigned int i_offset)
+    {
+        o_element.SemanticName = i_semanticName;
+        o_element.SemanticIndex = 0;    // (Semantics without modifying indices at the end can always use zero)
+        o_element.Format = i_format;
+        o_element.InputSlot = i_inputSlot;
+        o_element.AlignedByteOffset = i_offset;
+        o_element.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+        o_element.InstanceDataStepRate = 0;    // (Must be zero for per-vertex data)
+    }
+
+    eae6320::cResult CreateBuffer(const void* const i_initialData, const size_t i_size, const unsigned int i_bindFlags, const bool i_isDynamic,
+        const char* const i_description, ID3D11Buffer*& o_buffer)
+    {
+        D3D11_BUFFER_DESC bufferDescription{};
+        {
+            EAE6320_ASSERT(i_size < (uint64_t(1u) << (sizeof(bufferDescription.ByteWidth) * 8)));
+            bufferDescription.ByteWidth = static_cast<unsigned int>(i_size);
+            // Dynamic buffers are rewritten by the CPU every time that they are used
+            bufferDescription.Usage = i_isDynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_IMMUTABLE;
+            bufferDescription.BindFlags = i_bindFlags;
+            bufferDescription.CPUAccessFlags = i_isDynamic ? D3D11_CPU_ACCESS_WRITE : 0;
+            bufferDescription.MiscFlags = 0;
+            bufferDescription.StructureByteStride = 0;    // Not used
+        }
+        D3D11_SUBRESOURCE_DATA initialData{};
+        initialData.pSysMem = i_initialData;
+        // (The other data members are ignored for non-texture buffers)
+
+        auto* const direct3DDevice = eae6320::Graphics::sContext::g_context.direct3DDevice;
+        const auto d3DResult = direct3DDevice->CreateBuffer(&bufferDescription, i_initialData ? &initialData : nullptr, &o_buffer);
+        if (FAILED(d3DResult))
+        {
+            EAE6320_ASSERTF(false, "Skinned mesh %s buffer creation failed (HRESULT %#010x)", i_description, d3DResult);
+            eae6320::Logging::OutputError("Direct3D failed to create a skinned mesh %s buffer (HRESULT %#010x)", i_description, d3DResult);
+            return eae6320::Results::Failure;
+        }
+        return eae6320::Results::success;
+    }
+}
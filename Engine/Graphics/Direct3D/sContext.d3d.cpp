@@ -35,6 +35,7 @@ eae6320::cResult eae6320::Graphics::sContext::Initialize( const sInitializationP
     auto result = Results::success;
 
     windowBeingRenderedTo = i_initializationParameters.mainWindow;
+    syncInterval = i_initializationParameters.shouldWaitForVerticalBlank ? 1 : 0;
 
     // Create an interface to a Direct3D device
     if ( !( (result = CreateDevice( i_initializationParameters.resolutionWidth, i_initializationParameters.resolutionHeight )) ) )
@@ -117,9 +118,8 @@ void eae6320::Graphics::sContext::ClearDepthBuffer(const float i_depth) const
 void eae6320::Graphics::sContext::BufferSwap() const
 {
     EAE6320_ASSERT(swapChain);
-    constexpr unsigned int swapImmediately = 0;
     constexpr unsigned int presentNextFrame = 0;
-    const auto result = swapChain->Present(swapImmediately, presentNextFrame);
+    const auto result = swapChain->Present(syncInterval, presentNextFrame);
     EAE6320_ASSERT(SUCCEEDED(result));
 }
 
@@ -6,21 +6,34 @@
 #include "cConstantBuffer.h"
 #include "ConstantBufferFormats.h"
 #include "cSamplerState.h"
+#include "cSkinnedMesh.h"
 #include "sContext.h"
 #include "ColorFormats.h"
+#include "sEntitiesToRender.h"
+#include "Skinning.h"
 
 #include <Engine/Asserts/Asserts.h>
 #include <Engine/Concurrency/cEvent.h>
+#include <Engine/Concurrency/Jobs.h>
 #include <Engine/Logging/Logging.h>
+#include <Engine/Math/TransformBatch.h>
 #include <Engine/Platform/Platform.h>
+#include <Engine/Time/Time.h>
 #include <Engine/UserOutput/UserOutput.h>
 #include <Engine/Gameobject/cGameobject2D.h>
+#include <Engine/Gameobject/cEntityRegistry.h>
 #include <Engine/Gameobject/cGameobject3D.h>
+#include <Engine/Gameobject/cSkinnedGameobject.h>
+#include <Engine/Gameobject/cStaticBatch.h>
 #include <Engine/Camera/cbCamera.h>
 
+#if defined( EAE6320_PLATFORM_WINDOWS )
 #include <External/DirectXTex/Includes.h>
 
 #include <codecvt>
+#endif
+#include <atomic>
+#include <initializer_list>
 #include <algorithm>
 #include <utility>
 
@@ -33,19 +46,48 @@ namespace
     // Constant buffer object
     eae6320::Graphics::cConstantBuffer s_constantBuffer_perFrame(eae6320::Graphics::ConstantBufferTypes::PerFrame);
     eae6320::Graphics::cConstantBuffer s_constantBuffer_perDrawCall(eae6320::Graphics::ConstantBufferTypes::PerDrawCall);
+    eae6320::Graphics::cConstantBuffer s_constantBuffer_perSkinnedDrawCall(eae6320::Graphics::ConstantBufferTypes::PerSkinnedDrawCall);
     // In our class we will only have a single sampler state
     eae6320::Graphics::cSamplerState s_samplerState;
 
     // Submission Data
     //----------------
 
+    // The draw call owns a reference to the mesh and the material
+    // (and so the gameobject or entity that they came from can be destroyed before the frame is rendered)
+    struct sMeshToRender
+    {
+        eae6320::Graphics::cMesh* mesh = nullptr;
+        eae6320::Graphics::cMaterial* material = nullptr;
+
+        void BindAndDraw() const
+        {
+            material->Bind();
+            mesh->Draw();
+        }
+    };
+
+    struct sSkinnedGameobjectToRender
+    {
+        eae6320::Gameobject::cSkinnedGameobject* gameobject = nullptr;
+        eae6320::Graphics::ConstantBufferFormats::sPerDrawCall constantData_perDrawCall;
+        // The index of the gameobject's first joint in the frame's skinning transforms
+        size_t firstSkinningTransform = 0;
+    };
+
     // This struct's data is populated at submission time;
     // it must cache whatever is necessary in order to render a frame
     struct sDataRequiredToRenderAFrame
     {
         std::vector<eae6320::Gameobject::cGameobject2D*> gameobjects2D_perFrame;
-        std::vector<std::pair<eae6320::Gameobject::cGameobject3D*, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> gameobjects3D_opaque_perFrame;
-        std::vector<std::pair<eae6320::Gameobject::cGameobject3D*, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> gameobjects3D_translucent_perFrame;
+        std::vector<std::pair<sMeshToRender, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> meshes_opaque_perFrame;
+        std::vector<std::pair<sMeshToRender, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> meshes_translucent_perFrame;
+        std::vector<std::pair<eae6320::Gameobject::cStaticBatch*, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> staticBatches_opaque_perFrame;
+        std::vector<std::pair<eae6320::Gameobject::cStaticBatch*, eae6320::Graphics::ConstantBufferFormats::sPerDrawCall>> staticBatches_translucent_perFrame;
+        std::vector<sSkinnedGameobjectToRender> skinnedGameobjects_gpu_perFrame;
+        std::vector<sSkinnedGameobjectToRender> skinnedGameobjects_cpu_perFrame;
+        // The skinning transforms of every skinned gameobject are stored contiguously
+        std::vector<eae6320::Math::cMatrixTransformation> transforms_skinning_perFrame;
         eae6320::Graphics::ConstantBufferFormats::sPerFrame constantData_perFrame;
         eae6320::Graphics::ColorFormats::sColor clearColor_perFrame;
         std::string screenShotPath_perFrame;
@@ -53,24 +95,46 @@ namespace
 
         void CleanUp()
         {
+            for (auto* const meshes : { &meshes_opaque_perFrame, &meshes_translucent_perFrame })
+            {
+                const auto length = meshes->size();
+                for (size_t i = 0; i < length; i++)
+                {
+                    // Clean up mesh and material
+                    (*meshes)[i].first.mesh->DecrementReferenceCount();
+                    (*meshes)[i].first.material->DecrementReferenceCount();
+                }
+                meshes->clear();
+            }
             {
-                const auto length = gameobjects3D_opaque_perFrame.size();
+                const auto length = staticBatches_opaque_perFrame.size();
                 for (size_t i = 0; i < length; i++)
                 {
-                    // Clean up 3d opaque gameobject
-                    gameobjects3D_opaque_perFrame[i].first->DecrementReferenceCount();
+                    // Clean up opaque static batch
+                    staticBatches_opaque_perFrame[i].first->DecrementReferenceCount();
                 }
-                gameobjects3D_opaque_perFrame.clear();
+                staticBatches_opaque_perFrame.clear();
             }
             {
-                const auto length = gameobjects3D_translucent_perFrame.size();
+                const auto length = staticBatches_translucent_perFrame.size();
                 for (size_t i = 0; i < length; i++)
                 {
-                    // Clean up 3d translucent gameobject
-                    gameobjects3D_translucent_perFrame[i].first->DecrementReferenceCount();
+                    // Clean up translucent static batch
+                    staticBatches_translucent_perFrame[i].first->DecrementReferenceCount();
                 }
-                gameobjects3D_translucent_perFrame.clear();
+                staticBatches_translucent_perFrame.clear();
             }
+            for (auto* const skinnedGameobjects : { &skinnedGameobjects_gpu_perFrame, &skinnedGameobjects_cpu_perFrame })
+            {
+                const auto length = skinnedGameobjects->size();
+                for (size_t i = 0; i < length; i++)
+                {
+                    // Clean up skinned gameobject
+                    (*skinnedGameobjects)[i].gameobject->DecrementReferenceCount();
+                }
+                skinnedGameobjects->clear();
+            }
+            transforms_skinning_perFrame.clear();
             {
                 const auto length = gameobjects2D_perFrame.size();
                 for (size_t i = 0; i < length; i++)
@@ -99,6 +163,28 @@ namespace
     // and the application loop thread can start submitting data for the following frame
     // (the application loop thread waits for the signal)
     eae6320::Concurrency::cEvent s_whenDataForANewFrameCanBeSubmittedFromApplicationThread;
+    // This is written by the main/render thread after every buffer swap
+    // and read by the application loop thread to time its frames
+    std::atomic<uint64_t> s_tickCount_mostRecentBufferSwap(0);
+
+    // These are only used by the application loop thread when submitting many meshes at once
+    // (they are kept between frames so that their memory can be re-used)
+    eae6320::Math::sTransformArrays s_transformArrays_meshes_opaque;
+    eae6320::Math::sTransformArrays s_transformArrays_meshes_translucent;
+    // The transforms of submitted meshes are calculated as jobs in ranges of this many meshes
+    // (it is a multiple of four so that every range but the last one is calculated entirely with SIMD instructions)
+    constexpr size_t s_meshCountPerJob = 256;
+    // The entities that are culled when a registry is submitted directly
+    // (it is kept between frames so that its memory can be re-used)
+    eae6320::Graphics::sEntitiesToRender s_entitiesToRender;
+
+    // The following are only used by the render thread when drawing skinned gameobjects
+    // (they are kept between frames so that their memory can be re-used)
+    std::vector<eae6320::Graphics::Skinning::sJob> s_skinningJobs;
+    std::vector<eae6320::Graphics::VertexFormats::sMesh> s_vertices_skinned;
+    eae6320::Graphics::ConstantBufferFormats::sPerSkinnedDrawCall s_constantData_perSkinnedDrawCall;
+    // Vertices that were skinned on the CPU are drawn with a palette of identity transforms
+    const eae6320::Graphics::ConstantBufferFormats::sPerSkinnedDrawCall s_constantData_perSkinnedDrawCall_identity;
 
     // Following variables help with the screenshot functionality
     eae6320::Platform::sDataFromFile s_rawImageData = {};
@@ -107,6 +193,30 @@ namespace
     bool s_isComInitialized = false;
 }
 
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // Submits the meshes in the range [0, i_count):
+    // i_getMesh(index, o_meshToRender) fills in the mesh and material and returns the prediction transform
+    // (or null if the mesh shouldn't be submitted),
+    // and then the transforms of every mesh are calculated together with SIMD instructions
+    // (the camera must be submitted first)
+    template <typename tGetMesh>
+    void SubmitMeshes(const size_t i_count, const tGetMesh& i_getMesh);
+    // This is the same except that i_getMesh() returns the local-to-world transform
+    // (e.g. from a transform hierarchy), which is used as-is
+    template <typename tGetMesh>
+    void SubmitMeshesWithWorldTransforms(const size_t i_count, const tGetMesh& i_getMesh);
+
+    void CullEntitiesWithTransforms(const eae6320::Gameobject::cEntityRegistry& i_registry,
+        const eae6320::Math::cMatrixTransformation& i_transform_worldToCamera, const eae6320::Math::cMatrixTransformation& i_transform_cameraToProjected,
+        eae6320::Graphics::sEntitiesToRender& o_entitiesToRender);
+    // The camera that the entities were culled with must already have been submitted
+    void SubmitCulledEntities(const eae6320::Graphics::sEntitiesToRender& i_entitiesToRender);
+}
+
 // Interface
 //==========
 
@@ -161,17 +271,128 @@ void eae6320::Graphics::SubmitGameobject3D(Gameobject::cGameobject3D*const& i_ga
 
     EAE6320_ASSERT(i_gameObject3D);
 
-    i_gameObject3D->IncrementReferenceCount();
+    sMeshToRender meshToRender;
+    meshToRender.mesh = i_gameObject3D->GetMesh();
+    meshToRender.material = i_gameObject3D->GetMaterial();
+    meshToRender.mesh->IncrementReferenceCount();
+    meshToRender.material->IncrementReferenceCount();
+
+    const auto& predictionTransform = i_gameObject3D->GetPredictionTransform();
+    ConstantBufferFormats::sPerDrawCall constantData_perDrawCall;
+    constantData_perDrawCall.g_transform_localToWorld = Math::cMatrixTransformation(predictionTransform.orientation, predictionTransform.position);
+
+    auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+    constantData_perDrawCall.g_transform_localToProjected = constantData_perFrame.g_transform_cameraToProjected * Math::cMatrixTransformation::ConcatenateAffine(constantData_perFrame.g_transform_worldToCamera, constantData_perDrawCall.g_transform_localToWorld);
+
+    meshToRender.material->IsOpaque() ?
+        s_dataBeingSubmittedByApplicationThread->meshes_opaque_perFrame.push_back(std::make_pair(meshToRender, constantData_perDrawCall)) :
+        s_dataBeingSubmittedByApplicationThread->meshes_translucent_perFrame.push_back(std::make_pair(meshToRender, constantData_perDrawCall));
+}
+
+void eae6320::Graphics::SubmitGameobject3Ds(Gameobject::cGameobject3D*const* const i_gameObject3Ds, const size_t i_count)
+{
+    EAE6320_ASSERT(i_gameObject3Ds || (i_count == 0));
+
+    SubmitMeshes(i_count, [i_gameObject3Ds](const size_t i_index, sMeshToRender& o_meshToRender)
+    {
+        const auto* const gameObject3D = i_gameObject3Ds[i_index];
+        EAE6320_ASSERT(gameObject3D);
+        o_meshToRender.mesh = gameObject3D->GetMesh();
+        o_meshToRender.material = gameObject3D->GetMaterial();
+        return &gameObject3D->GetPredictionTransform();
+    });
+}
+
+void eae6320::Graphics::CullEntities(const Gameobject::cEntityRegistry& i_registry, const Camera::cbCamera& i_camera,
+    sEntitiesToRender& o_entitiesToRender)
+{
+    CullEntitiesWithTransforms(i_registry,
+        Math::cMatrixTransformation::CreateWorldToCameraTransform(i_camera.m_predictionTransform.orientation, i_camera.m_predictionTransform.position),
+        i_camera.m_projectedTransformPerspective, o_entitiesToRender);
+}
+
+void eae6320::Graphics::SubmitEntities(const Gameobject::cEntityRegistry& i_registry)
+{
+    EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+    // The entities are culled with the camera that has already been submitted
+    const auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+    CullEntitiesWithTransforms(i_registry, constantData_perFrame.g_transform_worldToCamera, constantData_perFrame.g_transform_cameraToProjected,
+        s_entitiesToRender);
+    SubmitCulledEntities(s_entitiesToRender);
+}
+
+void eae6320::Graphics::SubmitEntities(const sEntitiesToRender& i_entitiesToRender)
+{
+    EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+    // The camera that the entities were culled with is submitted
+    auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+    constantData_perFrame.g_transform_worldToCamera = i_entitiesToRender.transform_worldToCamera;
+    constantData_perFrame.g_transform_cameraToProjected = i_entitiesToRender.transform_cameraToProjected;
+    SubmitCulledEntities(i_entitiesToRender);
+}
+
+void eae6320::Graphics::SubmitStaticBatch(Gameobject::cStaticBatch*const& i_staticBatch)
+{
+    EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+    EAE6320_ASSERT(i_staticBatch);
 
+    // The vertices of a static batch are already in world space relative to the batch's position
     ConstantBufferFormats::sPerDrawCall constantData_perDrawCall;
-    constantData_perDrawCall.g_transform_localToWorld = Math::cMatrixTransformation(i_gameObject3D->m_predictionTransform.orientation, i_gameObject3D->m_predictionTransform.position);
+    constantData_perDrawCall.g_transform_localToWorld = Math::cMatrixTransformation(Math::cQuaternion(), i_staticBatch->GetPosition());
 
     auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
     constantData_perDrawCall.g_transform_localToProjected = constantData_perFrame.g_transform_cameraToProjected * Math::cMatrixTransformation::ConcatenateAffine(constantData_perFrame.g_transform_worldToCamera, constantData_perDrawCall.g_transform_localToWorld);
 
-    i_gameObject3D->IsOpaque() ?
-        s_dataBeingSubmittedByApplicationThread->gameobjects3D_opaque_perFrame.push_back(std::make_pair(i_gameObject3D, constantData_perDrawCall)) :
-        s_dataBeingSubmittedByApplicationThread->gameobjects3D_translucent_perFrame.push_back(std::make_pair(i_gameObject3D, constantData_perDrawCall));
+    // Cull the batch if none of it can be seen
+    if (constantData_perDrawCall.g_transform_localToProjected.IsAxisAlignedBoxOutsideOfClipSpace(i_staticBatch->GetMinimumBounds(), i_staticBatch->GetMaximumBounds()))
+    {
+        return;
+    }
+
+    i_staticBatch->IncrementReferenceCount();
+
+    i_staticBatch->IsOpaque() ?
+        s_dataBeingSubmittedByApplicationThread->staticBatches_opaque_perFrame.push_back(std::make_pair(i_staticBatch, constantData_perDrawCall)) :
+        s_dataBeingSubmittedByApplicationThread->staticBatches_translucent_perFrame.push_back(std::make_pair(i_staticBatch, constantData_perDrawCall));
+}
+
+void eae6320::Graphics::SubmitSkinnedGameobject(Gameobject::cSkinnedGameobject*const& i_skinnedGameobject)
+{
+    EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+    EAE6320_ASSERT(i_skinnedGameobject);
+
+    i_skinnedGameobject->IncrementReferenceCount();
+
+    sSkinnedGameobjectToRender skinnedGameobjectToRender;
+    skinnedGameobjectToRender.gameobject = i_skinnedGameobject;
+    {
+        auto& constantData_perDrawCall = skinnedGameobjectToRender.constantData_perDrawCall;
+        const auto& transform = i_skinnedGameobject->GetTransform();
+        constantData_perDrawCall.g_transform_localToWorld = Math::cMatrixTransformation(transform.orientation, transform.position);
+
+        auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+        constantData_perDrawCall.g_transform_localToProjected = constantData_perFrame.g_transform_cameraToProjected * Math::cMatrixTransformation::ConcatenateAffine(constantData_perFrame.g_transform_worldToCamera, constantData_perDrawCall.g_transform_localToWorld);
+    }
+
+    // The pose is evaluated now (on the application loop thread)
+    // so that the gameobject is free to change it while the frame is being rendered
+    {
+        const auto& skeleton = i_skinnedGameobject->GetSkinnedMesh().GetSkeleton();
+        const auto& pose = i_skinnedGameobject->GetPose();
+        EAE6320_ASSERT(pose.size() == skeleton.GetJointCount());
+        auto& transforms_skinning = s_dataBeingSubmittedByApplicationThread->transforms_skinning_perFrame;
+        skinnedGameobjectToRender.firstSkinningTransform = transforms_skinning.size();
+        transforms_skinning.resize(transforms_skinning.size() + skeleton.GetJointCount());
+        skeleton.CalculateSkinningTransforms(pose.data(), transforms_skinning.data() + skinnedGameobjectToRender.firstSkinningTransform);
+    }
+
+    (i_skinnedGameobject->GetSkinningMode() == Gameobject::cSkinnedGameobject::SKIN_ON_GPU) ?
+        s_dataBeingSubmittedByApplicationThread->skinnedGameobjects_gpu_perFrame.push_back(skinnedGameobjectToRender) :
+        s_dataBeingSubmittedByApplicationThread->skinnedGameobjects_cpu_perFrame.push_back(skinnedGameobjectToRender);
 }
 
 void eae6320::Graphics::SubmitScreenShotName(const std::string& i_filePath)
@@ -238,35 +459,126 @@ void eae6320::Graphics::RenderFrame()
         s_constantBuffer_perFrame.Update(&constantData_perFrame);
     }
 
-    // Bind and draw opaque 3d gameobjects
+    // Bind and draw opaque meshes
+    {
+        const auto length = s_dataBeingRenderedByRenderThread->meshes_opaque_perFrame.size();
+        for (size_t i = 0; i < length; i++)
+        {
+            auto& constantData_perDrawCall = s_dataBeingRenderedByRenderThread->meshes_opaque_perFrame[i].second;
+            s_constantBuffer_perDrawCall.Update(&constantData_perDrawCall);
+            s_dataBeingRenderedByRenderThread->meshes_opaque_perFrame[i].first.BindAndDraw();
+        }
+    }
+
+    // Bind and draw opaque static batches
     {
-        const auto length = s_dataBeingRenderedByRenderThread->gameobjects3D_opaque_perFrame.size();
+        const auto length = s_dataBeingRenderedByRenderThread->staticBatches_opaque_perFrame.size();
         for (size_t i = 0; i < length; i++)
         {
-            auto& constantData_perDrawCall = s_dataBeingRenderedByRenderThread->gameobjects3D_opaque_perFrame[i].second;
+            auto& constantData_perDrawCall = s_dataBeingRenderedByRenderThread->staticBatches_opaque_perFrame[i].second;
             s_constantBuffer_perDrawCall.Update(&constantData_perDrawCall);
-            s_dataBeingRenderedByRenderThread->gameobjects3D_opaque_perFrame[i].first->BindAndDraw();
+            s_dataBeingRenderedByRenderThread->staticBatches_opaque_perFrame[i].first->BindAndDraw();
+        }
+    }
+
+    // Bind and draw skinned gameobjects that are skinned on the GPU
+    {
+        const auto& transforms_skinning = s_dataBeingRenderedByRenderThread->transforms_skinning_perFrame;
+        const auto length = s_dataBeingRenderedByRenderThread->skinnedGameobjects_gpu_perFrame.size();
+        for (size_t i = 0; i < length; i++)
+        {
+            auto& skinnedGameobjectToRender = s_dataBeingRenderedByRenderThread->skinnedGameobjects_gpu_perFrame[i];
+            s_constantBuffer_perDrawCall.Update(&skinnedGameobjectToRender.constantData_perDrawCall);
+            const auto& skinnedMesh = skinnedGameobjectToRender.gameobject->GetSkinnedMesh();
+            const auto jointCount = skinnedMesh.GetSkeleton().GetJointCount();
+            EAE6320_ASSERT(jointCount <= ConstantBufferFormats::maxJointCountForGpuSkinning);
+            std::copy_n(transforms_skinning.begin() + skinnedGameobjectToRender.firstSkinningTransform, jointCount,
+                s_constantData_perSkinnedDrawCall.g_transforms_skinning);
+            s_constantBuffer_perSkinnedDrawCall.Update(&s_constantData_perSkinnedDrawCall);
+            skinnedGameobjectToRender.gameobject->BindMaterial();
+            skinnedMesh.DrawSkinnedOnGpu();
         }
     }
 
-    // Bind and draw translucent 3d gameobjects
+    // Skin, bind, and draw skinned gameobjects that are skinned on the CPU
+    if (!s_dataBeingRenderedByRenderThread->skinnedGameobjects_cpu_perFrame.empty())
     {
-        sort(s_dataBeingRenderedByRenderThread->gameobjects3D_translucent_perFrame.begin(), s_dataBeingRenderedByRenderThread->gameobjects3D_translucent_perFrame.end(),
-            [](const auto& i_this, const auto& i_other)
+        const auto& skinnedGameobjects = s_dataBeingRenderedByRenderThread->skinnedGameobjects_cpu_perFrame;
+        const auto length = skinnedGameobjects.size();
+        // Every gameobject is skinned into its own range of a single array
+        {
+            size_t vertexCount = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                vertexCount += skinnedGameobjects[i].gameobject->GetSkinnedMesh().GetVertexCount();
+            }
+            s_vertices_skinned.resize(vertexCount);
+        }
+        s_skinningJobs.resize(length);
+        {
+            const auto* const transforms_skinning = s_dataBeingRenderedByRenderThread->transforms_skinning_perFrame.data();
+            size_t firstVertex = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                const auto& skinnedMesh = skinnedGameobjects[i].gameobject->GetSkinnedMesh();
+                auto& skinningJob = s_skinningJobs[i];
+                skinningJob.vertices_bind = skinnedMesh.GetBindVertices();
+                skinningJob.skinningData = skinnedMesh.GetSkinningData();
+                skinningJob.transforms_skinning = transforms_skinning + skinnedGameobjects[i].firstSkinningTransform;
+                skinningJob.vertices_skinned = s_vertices_skinned.data() + firstVertex;
+                skinningJob.vertexCount = skinnedMesh.GetVertexCount();
+                firstVertex += skinningJob.vertexCount;
+            }
+        }
+        Skinning::SkinInParallel(s_skinningJobs.data(), length);
+
+        s_constantBuffer_perSkinnedDrawCall.Update(&s_constantData_perSkinnedDrawCall_identity);
+        for (size_t i = 0; i < length; i++)
         {
-            const auto& transform_worldToCamera = s_dataBeingRenderedByRenderThread->constantData_perFrame.g_transform_worldToCamera;
+            s_constantBuffer_perDrawCall.Update(&skinnedGameobjects[i].constantData_perDrawCall);
+            skinnedGameobjects[i].gameobject->BindMaterial();
+            skinnedGameobjects[i].gameobject->GetSkinnedMesh().DrawSkinnedOnCpu(s_skinningJobs[i].vertices_skinned);
+        }
+    }
 
+    // Bind and draw translucent meshes and static batches
+    {
+        const auto& transform_worldToCamera = s_dataBeingRenderedByRenderThread->constantData_perFrame.g_transform_worldToCamera;
+        const auto isFurtherFromCamera = [&transform_worldToCamera](const auto& i_this, const auto& i_other)
+        {
             const auto& this_translationVectorInCameraSpace = transform_worldToCamera*i_this.second.g_transform_localToWorld.GetTranslation();
             const auto& other_translationVectorInCameraSpace = transform_worldToCamera*i_other.second.g_transform_localToWorld.GetTranslation();
 
             return this_translationVectorInCameraSpace.z < other_translationVectorInCameraSpace.z;
-        });
-        const auto length = s_dataBeingRenderedByRenderThread->gameobjects3D_translucent_perFrame.size();
-        for (size_t i = 0; i < length; i++)
+        };
+        auto& meshes_translucent_perFrame = s_dataBeingRenderedByRenderThread->meshes_translucent_perFrame;
+        auto& staticBatches_translucent_perFrame = s_dataBeingRenderedByRenderThread->staticBatches_translucent_perFrame;
+        sort(meshes_translucent_perFrame.begin(), meshes_translucent_perFrame.end(), isFurtherFromCamera);
+        sort(staticBatches_translucent_perFrame.begin(), staticBatches_translucent_perFrame.end(), isFurtherFromCamera);
+
+        // The two sorted lists are merged while drawing so that everything is drawn back to front
+        const auto length_meshes = meshes_translucent_perFrame.size();
+        const auto length_staticBatches = staticBatches_translucent_perFrame.size();
+        size_t i_mesh = 0;
+        size_t i_staticBatch = 0;
+        while ((i_mesh < length_meshes) || (i_staticBatch < length_staticBatches))
         {
-            auto& constantData_perDrawCall = s_dataBeingRenderedByRenderThread->gameobjects3D_translucent_perFrame[i].second;
-            s_constantBuffer_perDrawCall.Update(&constantData_perDrawCall);
-            s_dataBeingRenderedByRenderThread->gameobjects3D_translucent_perFrame[i].first->BindAndDraw();
+            const auto shouldStaticBatchBeDrawn = (i_mesh >= length_meshes) ||
+                ((i_staticBatch < length_staticBatches) && isFurtherFromCamera(staticBatches_translucent_perFrame[i_staticBatch], meshes_translucent_perFrame[i_mesh]));
+            if (shouldStaticBatchBeDrawn)
+            {
+                auto& constantData_perDrawCall = staticBatches_translucent_perFrame[i_staticBatch].second;
+                s_constantBuffer_perDrawCall.Update(&constantData_perDrawCall);
+                staticBatches_translucent_perFrame[i_staticBatch].first->BindAndDraw();
+                ++i_staticBatch;
+            }
+            else
+            {
+                auto& constantData_perDrawCall = meshes_translucent_perFrame[i_mesh].second;
+                s_constantBuffer_perDrawCall.Update(&constantData_perDrawCall);
+                meshes_translucent_perFrame[i_mesh].first.BindAndDraw();
+                ++i_mesh;
+            }
         }
     }
 
@@ -279,6 +591,7 @@ void eae6320::Graphics::RenderFrame()
         }
     }
 
+#if defined( EAE6320_PLATFORM_WINDOWS )
     // Take a screen shot if user requests it and if the COM is initialzied and raw buffer successfully allocated
     if (s_isComInitialized && s_rawImageData.data && !s_dataBeingRenderedByRenderThread->screenShotPath_perFrame.empty())
     {
@@ -313,11 +626,13 @@ void eae6320::Graphics::RenderFrame()
             }
         }
     }
+#endif
 
     // Everything has been drawn to the "back buffer", which is just an image in memory.
     // In order to display it the contents of the back buffer must be "presented"
     // (or "swapped" with the "front buffer")
     g_context.BufferSwap();
+    s_tickCount_mostRecentBufferSwap = Time::GetCurrentSystemTimeTickCount();
 
     // Once everything has been drawn the data that was submitted for this frame
     // should be cleaned up and cleared.
@@ -325,6 +640,11 @@ void eae6320::Graphics::RenderFrame()
     s_dataBeingRenderedByRenderThread->CleanUp();
 }
 
+uint64_t eae6320::Graphics::GetTickCountOfMostRecentBufferSwap()
+{
+    return s_tickCount_mostRecentBufferSwap;
+}
+
 // Initialization / Clean Up
 //--------------------------
 
@@ -338,6 +658,7 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
         EAE6320_ASSERT(false);
         goto OnExit;
     }
+#if defined( EAE6320_PLATFORM_WINDOWS )
     // Initialize COM
     {
         constexpr void* const thisMustBeNull = nullptr;
@@ -368,6 +689,7 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
             s_resolutionHeight = i_initializationParameters.resolutionHeight;
         }
     }
+#endif
     // Initialize the asset managers
     {
         if (!((result = cShader::s_manager.Initialize())))
@@ -399,6 +721,12 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
             EAE6320_ASSERT(false);
             goto OnExit;
         }
+
+        if (!((result = cSkinnedMesh::s_manager.Initialize())))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
     }
 
     // Initialize the platform-independent graphics objects
@@ -429,6 +757,19 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
             EAE6320_ASSERT(false);
             goto OnExit;
         }
+        if ((result = s_constantBuffer_perSkinnedDrawCall.Initialize()))
+        {
+            // There is only a single per-skinned drawcall constant buffer that is re-used
+            // and so it can be bound at initialization time and never unbound
+            s_constantBuffer_perSkinnedDrawCall.Bind(
+                // Only vertex shaders skin vertices
+                ShaderTypes::Vertex);
+        }
+        else
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
         if ((result = s_samplerState.Initialize()))
         {
             // There is only a single sampler state that is re-used
@@ -441,6 +782,12 @@ eae6320::cResult eae6320::Graphics::Initialize(const sInitializationParameters&
             goto OnExit;
         }
     }
+    // Initialize skinning on the CPU
+    if (!((result = Skinning::Initialize())))
+    {
+        EAE6320_ASSERT(false);
+        goto OnExit;
+    }
     // Initialize the events
     {
         if (!((result = s_whenAllDataHasBeenSubmittedFromApplicationThread.Initialize(Concurrency::EventType::RESET_AUTOMATICALLY_AFTER_BEING_SIGNALED))))
@@ -466,7 +813,19 @@ eae6320::cResult eae6320::Graphics::CleanUp()
     auto result = Results::success;
     s_dataBeingSubmittedByApplicationThread->CleanUp();
     s_dataBeingRenderedByRenderThread->CleanUp();
+    s_entitiesToRender.CleanUp();
 
+    {
+        const auto localResult = Skinning::CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
     {
         const auto localResult = s_constantBuffer_perFrame.CleanUp();
         if (!localResult)
@@ -489,6 +848,17 @@ eae6320::cResult eae6320::Graphics::CleanUp()
             }
         }
     }
+    {
+        const auto localResult = s_constantBuffer_perSkinnedDrawCall.CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
     {
         const auto localResult = s_samplerState.CleanUp();
         if (!localResult)
@@ -533,6 +903,17 @@ eae6320::cResult eae6320::Graphics::CleanUp()
             }
         }
     }
+    {
+        const auto localResult = cSkinnedMesh::s_manager.CleanUp();
+        if (!localResult)
+        {
+            EAE6320_ASSERT(false);
+            if (result)
+            {
+                result = localResult;
+            }
+        }
+    }
     {
         const auto localResult = cShader::s_manager.CleanUp();
         if (!localResult)
@@ -555,8 +936,10 @@ eae6320::cResult eae6320::Graphics::CleanUp()
             }
         }
     }
+#if defined( EAE6320_PLATFORM_WINDOWS )
     // Try to un-initialize com regardless of its initialization status
     CoUninitialize();
+#endif
 
     // Reset raw image data buffer
     s_rawImageData.Free();
@@ -576,4 +959,175 @@ eae6320::cResult eae6320::Graphics::CleanUp()
     }
 
     return result;
-}
\ No newline at end of file
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    template <typename tGetMesh>
+    void SubmitMeshes(const size_t i_count, const tGetMesh& i_getMesh)
+    {
+        using namespace eae6320;
+        using namespace eae6320::Graphics;
+
+        EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+        // Every mesh is gathered once into the opaque or translucent frame data,
+        // and its transform is gathered into the matching arrays
+        // so that each group's constant data can be calculated directly into the frame data
+        auto& transformArrays_opaque = s_transformArrays_meshes_opaque;
+        auto& transformArrays_translucent = s_transformArrays_meshes_translucent;
+        transformArrays_opaque.Clear();
+        transformArrays_translucent.Clear();
+        transformArrays_opaque.Reserve(i_count);
+        auto& meshes_opaque = s_dataBeingSubmittedByApplicationThread->meshes_opaque_perFrame;
+        auto& meshes_translucent = s_dataBeingSubmittedByApplicationThread->meshes_translucent_perFrame;
+        const auto firstOpaque = meshes_opaque.size();
+        const auto firstTranslucent = meshes_translucent.size();
+        for (size_t i = 0; i < i_count; i++)
+        {
+            sMeshToRender meshToRender;
+            const auto* const predictionTransform = i_getMesh(i, meshToRender);
+            if (!predictionTransform)
+            {
+                continue;
+            }
+            EAE6320_ASSERT(meshToRender.mesh && meshToRender.material);
+            meshToRender.mesh->IncrementReferenceCount();
+            meshToRender.material->IncrementReferenceCount();
+            const auto isOpaque = meshToRender.material->IsOpaque();
+            (isOpaque ? transformArrays_opaque : transformArrays_translucent).Append(predictionTransform->position, predictionTransform->orientation);
+            (isOpaque ? meshes_opaque : meshes_translucent).push_back(std::make_pair(meshToRender, ConstantBufferFormats::sPerDrawCall()));
+        }
+
+        // Every range only writes the constant data of its own meshes,
+        // and so the results are the same no matter how the ranges are split between threads
+        auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+        const auto transform_worldToProjected = constantData_perFrame.g_transform_cameraToProjected * constantData_perFrame.g_transform_worldToCamera;
+        const auto calculateTransforms = [&transform_worldToProjected](const Math::sTransformArrays& i_transformArrays,
+            std::pair<sMeshToRender, ConstantBufferFormats::sPerDrawCall>* const io_meshes)
+        {
+            Concurrency::Jobs::ParallelFor(0, i_transformArrays.GetCount(), s_meshCountPerJob,
+                [&i_transformArrays, io_meshes, &transform_worldToProjected](const size_t i_begin, const size_t i_end)
+                {
+                    auto& constantData_perDrawCall = io_meshes[i_begin].second;
+                    Math::CalculateTransforms(i_transformArrays, i_begin, i_end - i_begin, transform_worldToProjected,
+                        &constantData_perDrawCall.g_transform_localToWorld, &constantData_perDrawCall.g_transform_localToProjected, sizeof(*io_meshes));
+                });
+        };
+        if (meshes_opaque.size() > firstOpaque)
+        {
+            calculateTransforms(transformArrays_opaque, meshes_opaque.data() + firstOpaque);
+        }
+        if (meshes_translucent.size() > firstTranslucent)
+        {
+            calculateTransforms(transformArrays_translucent, meshes_translucent.data() + firstTranslucent);
+        }
+    }
+
+    template <typename tGetMesh>
+    void SubmitMeshesWithWorldTransforms(const size_t i_count, const tGetMesh& i_getMesh)
+    {
+        using namespace eae6320;
+        using namespace eae6320::Graphics;
+
+        EAE6320_ASSERT(s_dataBeingSubmittedByApplicationThread);
+
+        auto& constantData_perFrame = s_dataBeingSubmittedByApplicationThread->constantData_perFrame;
+        const auto transform_worldToProjected = constantData_perFrame.g_transform_cameraToProjected * constantData_perFrame.g_transform_worldToCamera;
+        for (size_t i = 0; i < i_count; i++)
+        {
+            sMeshToRender meshToRender;
+            const auto* const transform_localToWorld = i_getMesh(i, meshToRender);
+            if (!transform_localToWorld)
+            {
+                continue;
+            }
+            EAE6320_ASSERT(meshToRender.mesh && meshToRender.material);
+            meshToRender.mesh->IncrementReferenceCount();
+            meshToRender.material->IncrementReferenceCount();
+            ConstantBufferFormats::sPerDrawCall constantData_perDrawCall;
+            constantData_perDrawCall.g_transform_localToWorld = *transform_localToWorld;
+            constantData_perDrawCall.g_transform_localToProjected = transform_worldToProjected * *transform_localToWorld;
+            meshToRender.material->IsOpaque() ?
+                s_dataBeingSubmittedByApplicationThread->meshes_opaque_perFrame.push_back(std::make_pair(meshToRender, constantData_perDrawCall)) :
+                s_dataBeingSubmittedByApplicationThread->meshes_translucent_perFrame.push_back(std::make_pair(meshToRender, constantData_perDrawCall));
+        }
+    }
+
+    void CullEntitiesWithTransforms(const eae6320::Gameobject::cEntityRegistry& i_registry,
+        const eae6320::Math::cMatrixTransformation& i_transform_worldToCamera, const eae6320::Math::cMatrixTransformation& i_transform_cameraToProjected,
+        eae6320::Graphics::sEntitiesToRender& o_entitiesToRender)
+    {
+        using namespace eae6320;
+
+        // The references from the previous time that the entities were culled are released
+        o_entitiesToRender.CleanUp();
+        o_entitiesToRender.transform_worldToCamera = i_transform_worldToCamera;
+        o_entitiesToRender.transform_cameraToProjected = i_transform_cameraToProjected;
+
+        // Only the entities whose bounds are inside of the camera's frustum are kept
+        // (they are sorted so that they are submitted in the same order every frame)
+        auto& visibleEntities = o_entitiesToRender.visibleEntities;
+        {
+            const auto transform_worldToProjected = i_transform_cameraToProjected * i_transform_worldToCamera;
+            i_registry.GetSpatialIndex().QueryFrustum(transform_worldToProjected, visibleEntities);
+            std::sort(visibleEntities.begin(), visibleEntities.end());
+        }
+
+        // Each visible entity's render component is copied along with its transform component
+        // (or its world transform from the transform hierarchy if it has a hierarchy component)
+        const auto& renders = i_registry.GetRenders();
+        const auto& transforms = i_registry.GetTransforms();
+        const auto& hierarchies = i_registry.GetHierarchies();
+        const auto& transformHierarchy = i_registry.GetTransformHierarchy();
+        o_entitiesToRender.entities.reserve(visibleEntities.size());
+        for (const auto entity : visibleEntities)
+        {
+            const auto& renderComponent = renders.Get(entity);
+            EAE6320_ASSERT(renderComponent.mesh && renderComponent.material);
+            renderComponent.mesh->IncrementReferenceCount();
+            renderComponent.material->IncrementReferenceCount();
+            if (!hierarchies.Has(entity))
+            {
+                Graphics::sEntitiesToRender::sEntity entityToRender;
+                entityToRender.mesh = renderComponent.mesh;
+                entityToRender.material = renderComponent.material;
+                entityToRender.predictionTransform = transforms.Get(entity).predictionTransform;
+                o_entitiesToRender.entities.push_back(entityToRender);
+            }
+            else
+            {
+                Graphics::sEntitiesToRender::sEntity_hierarchy entityToRender;
+                entityToRender.mesh = renderComponent.mesh;
+                entityToRender.material = renderComponent.material;
+                entityToRender.transform_localToWorld = transformHierarchy.GetWorldTransform(hierarchies.Get(entity).node);
+                o_entitiesToRender.entities_hierarchy.push_back(entityToRender);
+            }
+        }
+    }
+
+    void SubmitCulledEntities(const eae6320::Graphics::sEntitiesToRender& i_entitiesToRender)
+    {
+        using namespace eae6320::Graphics;
+
+        const auto* const entities = i_entitiesToRender.entities.data();
+        SubmitMeshes(i_entitiesToRender.entities.size(), [entities](const size_t i_index, sMeshToRender& o_meshToRender)
+        {
+            const auto& entity = entities[i_index];
+            o_meshToRender.mesh = entity.mesh;
+            o_meshToRender.material = entity.material;
+            return &entity.predictionTransform;
+        });
+        const auto* const entities_hierarchy = i_entitiesToRender.entities_hierarchy.data();
+        SubmitMeshesWithWorldTransforms(i_entitiesToRender.entities_hierarchy.size(), [entities_hierarchy](const size_t i_index, sMeshToRender& o_meshToRender)
+        {
+            const auto& entity = entities_hierarchy[i_index];
+            o_meshToRender.mesh = entity.mesh;
+            o_meshToRender.material = entity.material;
+            return &entity.transform_localToWorld;
+        });
+    }
+}
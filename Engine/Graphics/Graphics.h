@@ -34,7 +34,10 @@ namespace eae6320
     namespace Gameobject
     {
         class cGameobject2D;
+        class cEntityRegistry;
         class cGameobject3D;
+        class cSkinnedGameobject;
+        class cStaticBatch;
     }
 }
 
@@ -46,6 +49,7 @@ namespace eae6320
         {
             struct sColor;
         }
+        struct sEntitiesToRender;
     }
 }
 
@@ -71,6 +75,30 @@ namespace eae6320
         void SubmitCamera(Camera::cbCamera*const& i_camera);
         void SubmitGameobject2D(Gameobject::cGameobject2D*const& i_gameObject2D);
         void SubmitGameobject3D(Gameobject::cGameobject3D*const& i_gameObject3D);
+        // This is equivalent to submitting each gameobject individually
+        // but the transforms of all of them are calculated together with SIMD instructions
+        // (the camera must be submitted first)
+        void SubmitGameobject3Ds(Gameobject::cGameobject3D*const* const i_gameObject3Ds, const size_t i_count);
+        // Every entity with a render component whose bounds are inside of the camera's frustum is submitted
+        // (its transform component's prediction transform is used the same way as SubmitGameobject3Ds()).
+        // The frustum is tested with the registry's spatial index,
+        // and so the camera must be submitted first and the index must have been updated (see cEntityRegistry::UpdateSpatialIndex())
+        void SubmitEntities(const Gameobject::cEntityRegistry& i_registry);
+        // The entities that SubmitEntities() would submit can instead be culled and copied ahead of time
+        // so that submitting them doesn't read the registry or the camera (see sEntitiesToRender.h).
+        // Culling doesn't submit anything and can be done from any thread
+        // (but not while the registry or the camera is being changed),
+        // and the index must have been updated the same way
+        void CullEntities(const Gameobject::cEntityRegistry& i_registry, const Camera::cbCamera& i_camera, sEntitiesToRender& o_entitiesToRender);
+        // The camera that the entities were culled with is submitted too
+        // (and so SubmitCamera() doesn't need to be called)
+        void SubmitEntities(const sEntitiesToRender& i_entitiesToRender);
+        // Static batches whose bounds are outside of the camera's view are culled at submission time
+        // (the camera must be submitted before any static batches)
+        void SubmitStaticBatch(Gameobject::cStaticBatch*const& i_staticBatch);
+        // Skinned gameobjects are drawn with the opaque geometry
+        // (their pose is evaluated at submission time)
+        void SubmitSkinnedGameobject(Gameobject::cSkinnedGameobject*const& i_skinnedGameobject);
         void SubmitScreenShotName(const std::string& i_filePath);
 
         // When the application is ready to submit data for a new frame
@@ -89,6 +117,10 @@ namespace eae6320
         // It will render a submitted frame as soon as it is ready
         // (i.e. as soon as SignalThatAllDataForAFrameHasBeenSubmitted() has been called)
         void RenderFrame();
+        // This returns the system time tick count (see Time.h) when RenderFrame() most recently swapped buffers
+        // (zero if it hasn't yet).
+        // If buffer swaps wait for vertical blanks this is when the most recent vertical blank was
+        uint64_t GetTickCountOfMostRecentBufferSwap();
 
         // Initialization / Clean Up
         //--------------------------
@@ -97,11 +129,16 @@ namespace eae6320
         {
 #if defined( EAE6320_PLATFORM_WINDOWS )
             HWND mainWindow = nullptr;
-            uint16_t resolutionWidth = 0, resolutionHeight = 0;
     #if defined( EAE6320_PLATFORM_GL )
                 HINSTANCE thisInstanceOfTheApplication = nullptr;
     #endif
 #endif
+            // A headless application has no window,
+            // but it still has a resolution (e.g. for the camera's aspect ratio)
+            uint16_t resolutionWidth = 0, resolutionHeight = 0;
+            // If this is true a buffer swap waits for the next vertical blank
+            // (a headless application has no display and ignores it)
+            bool shouldWaitForVerticalBlank = false;
         };
 
         cResult Initialize(const sInitializationParameters& i_initializationParameters);
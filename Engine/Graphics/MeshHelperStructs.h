@@ -17,6 +17,7 @@ namespace eae6320
         namespace VertexFormats
         {
             struct sMesh;
+            struct sSkinning;
         }
     }
 }
@@ -41,6 +42,66 @@ namespace eae6320
     }
 }
 
+// Binary Mesh File Format
+//========================
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        // A built mesh file (.bmf) is laid out as:
+        //    * sHeader
+        //    * Index data (16 or 32 bit indices)
+        //    * Vertex data (VertexFormats::sMesh)
+        //    * Skinning data (VertexFormats::sSkinning; only if the mesh has a skeleton)
+        //    * Joint data (HelperStructs::sJoint; only if the mesh has a skeleton)
+        // Every section starts at an offset from the beginning of the file that is a multiple of sectionAlignment
+        // (any gaps are filled with paddingValue)
+        // so that a file that was loaded into suitably aligned memory (or mapped) can be used in place.
+        // The checksum covers every byte after the header
+        // so that corrupt data can be rejected before anything is sent to the GPU
+        namespace BinaryMeshFile
+        {
+            // "EBMF" when read as bytes
+            constexpr uint32_t magic = 0x464d4245;
+            // This must be incremented whenever the layout of the file changes
+            //    * 2: Tangent frames were added to the vertex data
+            //    * 3: Skinning and joint data were added
+            constexpr uint16_t currentVersion = 3;
+            // Joint indices are stored in 8 bits
+            constexpr uint32_t maxJointCount = 256;
+            constexpr uint32_t sectionAlignment = 16;
+            constexpr uint8_t paddingValue = 0xdd;
+
+            struct sHeader
+            {
+                uint32_t magic = BinaryMeshFile::magic;
+                uint16_t version = currentVersion;
+                // The size of the header is stored so that it can be validated independently of the version
+                uint16_t headerSize = static_cast<uint16_t>(sizeof(sHeader));
+                // This must match sizeof(VertexFormats::sMesh) of the code that loads the file
+                uint32_t vertexSize = 0;
+                uint32_t numberOfVertices = 0;
+                uint32_t numberOfIndices = 0;
+                // The offsets are from the beginning of the file
+                uint32_t offsetToIndexData = 0;
+                uint32_t offsetToVertexData = 0;
+                // A mesh without a skeleton has no joints and both of these offsets are 0
+                uint32_t offsetToSkinningData = 0;
+                uint32_t offsetToJointData = 0;
+                uint32_t numberOfJoints = 0;
+                // The total size of the file (including the header)
+                uint32_t fileSize = 0;
+                // Math::CalculateXxHash32() of every byte after the header
+                uint32_t checksum = 0;
+                IndexDataTypes::eType indexType = IndexDataTypes::UNKNOWN;
+                uint8_t reserved[3] = {};
+            };
+            static_assert((sizeof(sHeader) % sizeof(uint32_t)) == 0, "The binary mesh file header must not need any implicit padding");
+        }
+    }
+}
+
 // Helper Structs for Meshes
 //===========================
 
@@ -50,6 +111,18 @@ namespace eae6320
     {
         namespace HelperStructs
         {
+            // A joint of a skeleton in its bind pose
+            struct sJoint
+            {
+                // A parent always comes before its children
+                // (the root joints have no parent and use -1)
+                int32_t parentIndex = -1;
+                // The rotation and translation are relative to the parent
+                // (the rotation is a normalized quaternion stored as w, x, y, z)
+                float rotation[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+                float translation[3] = { 0.0f, 0.0f, 0.0f };
+            };
+
             struct sMeshData
             {
                 // Data
@@ -57,8 +130,13 @@ namespace eae6320
 
                 VertexFormats::sMesh* vertexData = nullptr;
                 void* indexData = nullptr;
+                // The skinning and joint data only exist if the mesh has a skeleton
+                // (there is a skinning element for every vertex)
+                VertexFormats::sSkinning* skinningData = nullptr;
+                sJoint* jointData = nullptr;
                 uint32_t numberOfVertices = 0;
                 uint32_t numberOfIndices = 0;
+                uint32_t numberOfJoints = 0;
                 IndexDataTypes::eType type = IndexDataTypes::UNKNOWN;
 
                 // Interface
@@ -81,6 +159,16 @@ namespace eae6320
                         free(indexData);
                         indexData = nullptr;
                     }
+                    if (skinningData)
+                    {
+                        free(skinningData);
+                        skinningData = nullptr;
+                    }
+                    if (jointData)
+                    {
+                        free(jointData);
+                        jointData = nullptr;
+                    }
                 }
             };
         }
@@ -0,0 +1,84 @@
+// Include Files
+//==============
+
+#include "../cConstantBuffer.h"
+
+#include "../cShader.h"
+#include "../sContext.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cConstantBuffer::Bind( const uint_fast8_t i_shaderTypesToBindTo ) const
+{
+    EAE6320_ASSERT( m_data );
+
+    // A GPU would bind the buffer once per shader stage
+    if ( i_shaderTypesToBindTo & ShaderTypes::Vertex )
+    {
+        ++sContext::g_context.commandCounts.bindCount;
+    }
+    if ( i_shaderTypesToBindTo & ShaderTypes::Fragment )
+    {
+        ++sContext::g_context.commandCounts.bindCount;
+    }
+}
+
+void eae6320::Graphics::cConstantBuffer::Update( const void* const i_data ) const
+{
+    EAE6320_ASSERT( m_data );
+
+    // The data is still copied so that the CPU cost of an update stays comparable to a real platform
+    memcpy( m_data, i_data, m_size );
+    sContext::g_context.commandCounts.uploadedByteCount += m_size;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cConstantBuffer::CleanUp()
+{
+    const auto result = Results::success;
+
+    if ( m_data )
+    {
+        free( m_data );
+        m_data = nullptr;
+    }
+
+    return result;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cConstantBuffer::InitializePlatformSpecific( const void* const i_initialData )
+{
+    m_data = malloc( m_size );
+    if ( !m_data )
+    {
+        EAE6320_ASSERTF( false, "Couldn't allocate %zu bytes for a constant buffer", m_size );
+        Logging::OutputError( "Failed to allocate %zu bytes for a null constant buffer", m_size );
+        return Results::outOfMemory;
+    }
+    if ( i_initialData )
+    {
+        memcpy( m_data, i_initialData, m_size );
+    }
+    else
+    {
+        memset( m_data, 0, m_size );
+    }
+    return Results::success;
+}
@@ -0,0 +1,44 @@
+// Include Files
+//==============
+
+#include "../cEffect.h"
+#include "../sContext.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cEffect::InitializePlatformSpecific()
+{
+    // Nothing Special is required to be done here.
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cEffect::CleanUpPlatformSpecific()
+{
+    // Nothing Special is required to be done here.
+
+    return Results::success;
+}
+
+// Render
+//-------
+
+void eae6320::Graphics::cEffect::BindPlatformSpecific() const
+{
+    // Vertex shader
+    {
+        EAE6320_ASSERT(m_vertexShader);
+        ++sContext::g_context.commandCounts.bindCount;
+    }
+    // Fragment shader
+    {
+        EAE6320_ASSERT(m_fragmentShader);
+        ++sContext::g_context.commandCounts.bindCount;
+    }
+}
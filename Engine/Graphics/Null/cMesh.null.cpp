@@ -0,0 +1,39 @@
+// Include Files
+//==============
+
+#include "../cMesh.h"
+
+#include "../sContext.h"
+#include "../MeshHelperStructs.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+
+eae6320::cResult eae6320::Graphics::cMesh::Initialize(HelperStructs::sMeshData const*const& i_meshData)
+{
+    EAE6320_ASSERT(i_meshData);
+
+    // Only what is needed to draw is kept;
+    // the vertex and index data would have been copied to the GPU
+    m_numberOfIndices = i_meshData->numberOfIndices;
+    m_type = i_meshData->type;
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cMesh::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
+
+void eae6320::Graphics::cMesh::Draw() const
+{
+    auto& commandCounts = sContext::g_context.commandCounts;
+    ++commandCounts.drawCallCount;
+    commandCounts.vertexCount += m_numberOfIndices;
+}
@@ -0,0 +1,41 @@
+// Include Files
+//==============
+
+#include "../cRenderState.h"
+
+#include "../sContext.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cRenderState::Bind() const
+{
+    // Alpha transparency, depth buffering, and drawing both triangle sides
+    // would each be a separate state object on a GPU
+    constexpr uint64_t stateObjectCount = 3;
+    sContext::g_context.commandCounts.bindCount += stateObjectCount;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cRenderState::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cRenderState::InitializeFromBits()
+{
+    // The bits are all that the null platform needs
+    return Results::success;
+}
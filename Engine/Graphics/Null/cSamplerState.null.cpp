@@ -0,0 +1,32 @@
+// Include Files
+//==============
+
+#include "../cSamplerState.h"
+
+#include "../sContext.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSamplerState::Bind() const
+{
+    ++sContext::g_context.commandCounts.bindCount;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSamplerState::Initialize()
+{
+    // Nothing needs to be created
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cSamplerState::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
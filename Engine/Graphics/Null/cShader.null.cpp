@@ -0,0 +1,36 @@
+// Include Files
+//==============
+
+#include "../cShader.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Platform/Platform.h>
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cShader::Initialize( const char* const i_path, const Platform::sDataFromFile& i_loadedShader )
+{
+    // The compiled shader is loaded (so that missing or corrupt assets are still caught)
+    // but there is nothing to create it with
+    if ( i_loadedShader.data && ( i_loadedShader.size > 0 ) )
+    {
+        return Results::success;
+    }
+    else
+    {
+        EAE6320_ASSERTF( false, "The shader %s is empty", i_path );
+        Logging::OutputError( "The shader %s is empty", i_path );
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Graphics::cShader::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
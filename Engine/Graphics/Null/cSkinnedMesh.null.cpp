@@ -0,0 +1,50 @@
+// Include Files
+//==============
+
+#include "../cSkinnedMesh.h"
+
+#include "../sContext.h"
+#include "../MeshHelperStructs.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnGpu() const
+{
+    auto& commandCounts = sContext::g_context.commandCounts;
+    ++commandCounts.drawCallCount;
+    commandCounts.vertexCount += m_numberOfIndices;
+}
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnCpu(const VertexFormats::sMesh* const) const
+{
+    auto& commandCounts = sContext::g_context.commandCounts;
+    // The skinned vertices would have been uploaded before drawing
+    commandCounts.uploadedByteCount += m_vertices_bind.size() * sizeof(VertexFormats::sMesh);
+    ++commandCounts.drawCallCount;
+    commandCounts.vertexCount += m_numberOfIndices;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::InitializePlatformSpecific(const HelperStructs::sMeshData&)
+{
+    // The bind pose vertices and index count have already been copied,
+    // and nothing else would exist without a GPU
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
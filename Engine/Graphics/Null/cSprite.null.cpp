@@ -0,0 +1,32 @@
+// Include Files
+//==============
+
+#include "../cSprite.h"
+
+#include "../sContext.h"
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+
+eae6320::cResult eae6320::Graphics::cSprite::Initialize(const Transform::sRectTransform&)
+{
+    // The sprite's vertices would be created from the rect transform on a GPU
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cSprite::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
+
+void eae6320::Graphics::cSprite::Draw() const
+{
+    // A sprite is a single quad drawn as a triangle strip
+    constexpr uint64_t vertexCountPerSprite = 4;
+    auto& commandCounts = sContext::g_context.commandCounts;
+    ++commandCounts.drawCallCount;
+    commandCounts.vertexCount += vertexCountPerSprite;
+}
@@ -0,0 +1,36 @@
+// Include Files
+//==============
+
+#include "../cTexture.h"
+
+#include "../sContext.h"
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cTexture::Bind(const unsigned int) const
+{
+    ++sContext::g_context.commandCounts.bindCount;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cTexture::Initialize(const char* const, const void* const, const size_t)
+{
+    // The texture's info has already been read from the file,
+    // and so its dimensions are still available even though nothing is created
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::cTexture::CleanUp()
+{
+    // Nothing was created
+    return Results::success;
+}
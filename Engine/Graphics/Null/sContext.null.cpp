@@ -0,0 +1,83 @@
+// Include Files
+//==============
+
+#include "../sContext.h"
+#include "../ColorFormats.h"
+#include "../Graphics.h"
+
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Platform/Platform.h>
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::sContext::Initialize(const sInitializationParameters& i_initializationParameters)
+{
+    resolutionWidth = i_initializationParameters.resolutionWidth;
+    resolutionHeight = i_initializationParameters.resolutionHeight;
+    commandCounts = sCommandCounts();
+
+    Logging::OutputMessage("The null graphics context was initialized (%ux%u); nothing will be rendered",
+        resolutionWidth, resolutionHeight);
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::sContext::CleanUp()
+{
+    const auto result = Results::success;
+
+    // Clean up can be called more than once (the context's destructor also calls it),
+    // and so the totals are only reported if there is something to report
+    if (commandCounts.frameCount > 0)
+    {
+        const auto frameCount = static_cast<double>(commandCounts.frameCount);
+        Logging::OutputMessage("The null graphics context received the following commands over %llu frames:"
+            "\n\tDraw calls: %llu (%.1f per frame)"
+            "\n\tVertices: %llu (%.1f per frame)"
+            "\n\tBinds: %llu (%.1f per frame)"
+            "\n\tUploaded bytes: %llu (%.1f per frame)",
+            static_cast<unsigned long long>(commandCounts.frameCount),
+            static_cast<unsigned long long>(commandCounts.drawCallCount), commandCounts.drawCallCount / frameCount,
+            static_cast<unsigned long long>(commandCounts.vertexCount), commandCounts.vertexCount / frameCount,
+            static_cast<unsigned long long>(commandCounts.bindCount), commandCounts.bindCount / frameCount,
+            static_cast<unsigned long long>(commandCounts.uploadedByteCount), commandCounts.uploadedByteCount / frameCount);
+    }
+    commandCounts = sCommandCounts();
+    resolutionWidth = 0;
+    resolutionHeight = 0;
+
+    return result;
+}
+
+// Render
+//-------
+
+void eae6320::Graphics::sContext::ClearImageBuffer(const ColorFormats::sColor) const
+{
+    // There is no image buffer
+}
+
+void eae6320::Graphics::sContext::ClearDepthBuffer(const float) const
+{
+    // There is no depth buffer
+}
+
+void eae6320::Graphics::sContext::BufferSwap() const
+{
+    ++commandCounts.frameCount;
+}
+
+// User actions
+//-------------
+void eae6320::Graphics::sContext::GetRawImageFromBackBuffer(Platform::sDataFromFile& o_rawImageData) const
+{
+    // Nothing was rendered, and so the "back buffer" is always black
+    EAE6320_ASSERT(o_rawImageData.data);
+    memset(o_rawImageData.data, 0, o_rawImageData.size);
+}
@@ -274,6 +274,39 @@ eae6320::cResult eae6320::Graphics::cMesh::Initialize(HelperStructs::sMeshData c
                 goto OnExit;
             }
         }
+
+        // Tangent Frame (4)
+        // 4 int16_t == 8 bytes
+        // Offset = 32
+        {
+            constexpr GLuint vertexElementLocation = 4;
+            constexpr auto elementCount = 4;
+            constexpr GLboolean normalized = GL_TRUE;    // The given shorts should be normalized to [-1,1]
+            glVertexAttribPointer(vertexElementLocation, elementCount, GL_SHORT, normalized, stride,
+                reinterpret_cast<GLvoid*>(offsetof(eae6320::Graphics::VertexFormats::sMesh, qx)));
+            const auto errorCode = glGetError();
+            if (errorCode == GL_NO_ERROR)
+            {
+                glEnableVertexAttribArray(vertexElementLocation);
+                const auto errorCode = glGetError();
+                if (errorCode != GL_NO_ERROR)
+                {
+                    result = Results::Failure;
+                    EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                    Logging::OutputError("OpenGL failed to enable the TANGENT_FRAME vertex attribute at location %u: %s",
+                        vertexElementLocation, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                    goto OnExit;
+                }
+            }
+            else
+            {
+                result = Results::Failure;
+                EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                Logging::OutputError("OpenGL failed to set the TANGENT_FRAME vertex attribute at location %u: %s",
+                    vertexElementLocation, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                goto OnExit;
+            }
+        }
     }
 
 OnExit:
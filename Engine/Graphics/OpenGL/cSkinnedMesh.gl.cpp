@@ -0,0 +1,343 @@
+// Include Files
+//==============
+
+#include "../cSkinnedMesh.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+#include <initializer_list>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    eae6320::cResult CreateBuffer(const GLenum i_target, const void* const i_data, const size_t i_size, const GLenum i_usage,
+        const char* const i_description, GLuint& o_bufferId);
+    eae6320::cResult CreateVertexArray(GLuint& o_vertexArrayId);
+    // The stream of vertices must be bound to GL_ARRAY_BUFFER
+    eae6320::cResult SetMeshVertexAttributes();
+    // The stream of skinning data must be bound to GL_ARRAY_BUFFER
+    eae6320::cResult SetSkinningVertexAttributes();
+    eae6320::cResult SetVertexAttribute(const GLuint i_location, const GLint i_elementCount, const GLenum i_type, const GLboolean i_normalized,
+        const bool i_isInteger, const GLsizei i_stride, const size_t i_offset, const char* const i_description);
+    void DeleteBuffer(GLuint& io_bufferId, eae6320::cResult& io_result);
+}
+
+// Interface
+//==========
+
+// Render
+//-------
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnGpu() const
+{
+    // Bind the bind pose vertices, the skinning data, and the index buffer
+    {
+        glBindVertexArray(m_vertexArrayId_bind);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+    }
+    // Render triangles
+    {
+        constexpr GLenum mode = GL_TRIANGLES;
+        const GLenum indexType = (m_type == IndexDataTypes::BIT_16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        constexpr GLvoid* const offset = nullptr;
+        glDrawElements(mode, m_numberOfIndices, indexType, offset);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+    }
+}
+
+void eae6320::Graphics::cSkinnedMesh::DrawSkinnedOnCpu(const VertexFormats::sMesh* const i_vertices_skinned) const
+{
+    EAE6320_ASSERT(i_vertices_skinned);
+    // Upload the skinned vertices
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, m_vertexBufferId_skinned);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+        const auto bufferSize = static_cast<GLsizeiptr>(m_vertices_bind.size() * sizeof(VertexFormats::sMesh));
+        // Orphaning the old storage first means that OpenGL can give us new memory
+        // if the GPU is still using the buffer for a previous draw call
+        glBufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bufferSize, i_vertices_skinned);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+    }
+    // Bind the skinned vertices and the index buffer
+    {
+        glBindVertexArray(m_vertexArrayId_skinned);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+    }
+    // Render triangles
+    {
+        constexpr GLenum mode = GL_TRIANGLES;
+        const GLenum indexType = (m_type == IndexDataTypes::BIT_16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        constexpr GLvoid* const offset = nullptr;
+        glDrawElements(mode, m_numberOfIndices, indexType, offset);
+        EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+    }
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::InitializePlatformSpecific(const HelperStructs::sMeshData& i_meshData)
+{
+    auto result = Results::success;
+
+    const auto vertexDataSize = i_meshData.numberOfVertices * sizeof(VertexFormats::sMesh);
+    const auto indexDataSize = (m_type == IndexDataTypes::BIT_16) ? m_numberOfIndices * sizeof(uint16_t) : m_numberOfIndices * sizeof(uint32_t);
+
+    // The buffers are shared by both vertex arrays, and so they are created first
+    // (the index buffer is created once a vertex array is bound because that is where it is recorded)
+    if (!((result = CreateBuffer(GL_ARRAY_BUFFER, i_meshData.vertexData, vertexDataSize, GL_STATIC_DRAW, "bind pose vertex", m_vertexBufferId_bind))))
+    {
+        goto OnExit;
+    }
+    if (!((result = CreateBuffer(GL_ARRAY_BUFFER, nullptr, vertexDataSize, GL_STREAM_DRAW, "skinned vertex", m_vertexBufferId_skinned))))
+    {
+        goto OnExit;
+    }
+    if (!((result = CreateBuffer(GL_ARRAY_BUFFER, i_meshData.skinningData, i_meshData.numberOfVertices * sizeof(VertexFormats::sSkinning),
+        GL_STATIC_DRAW, "skinning", m_skinningBufferId))))
+    {
+        goto OnExit;
+    }
+
+    // The vertex array for skinning on the GPU
+    {
+        if (!((result = CreateVertexArray(m_vertexArrayId_bind))))
+        {
+            goto OnExit;
+        }
+        if (!((result = CreateBuffer(GL_ELEMENT_ARRAY_BUFFER, i_meshData.indexData, indexDataSize, GL_STATIC_DRAW, "index", m_indexBufferId))))
+        {
+            goto OnExit;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, m_vertexBufferId_bind);
+        if (!((result = SetMeshVertexAttributes())))
+        {
+            goto OnExit;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, m_skinningBufferId);
+        if (!((result = SetSkinningVertexAttributes())))
+        {
+            goto OnExit;
+        }
+    }
+    // The vertex array for skinning on the CPU
+    // (the skinning data is still needed because the vertex shader skins the vertices again with an identity matrix palette)
+    {
+        if (!((result = CreateVertexArray(m_vertexArrayId_skinned))))
+        {
+            goto OnExit;
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBufferId);
+        glBindBuffer(GL_ARRAY_BUFFER, m_vertexBufferId_skinned);
+        if (!((result = SetMeshVertexAttributes())))
+        {
+            goto OnExit;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, m_skinningBufferId);
+        if (!((result = SetSkinningVertexAttributes())))
+        {
+            goto OnExit;
+        }
+    }
+
+OnExit:
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    EAE6320_ASSERT(glGetError() == GL_NO_ERROR);
+
+    return result;
+}
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::CleanUp()
+{
+    auto result = Results::success;
+
+    // Make sure that neither vertex array is bound
+    glBindVertexArray(0);
+    {
+        const auto errorCode = glGetError();
+        if (errorCode != GL_NO_ERROR)
+        {
+            result = Results::Failure;
+            EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            Logging::OutputError("OpenGL failed to unbind all vertex arrays before cleaning up a skinned mesh: %s",
+                reinterpret_cast<const char*>(gluErrorString(errorCode)));
+        }
+    }
+    for (auto* const vertexArrayId : { &m_vertexArrayId_bind, &m_vertexArrayId_skinned })
+    {
+        if (*vertexArrayId != 0)
+        {
+            constexpr auto arrayCount = 1;
+            glDeleteVertexArrays(arrayCount, vertexArrayId);
+            const auto errorCode = glGetError();
+            if (errorCode != GL_NO_ERROR)
+            {
+                if (result)
+                {
+                    result = Results::Failure;
+                }
+                EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                Logging::OutputError("OpenGL failed to delete a skinned mesh vertex array: %s",
+                    reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            }
+            *vertexArrayId = 0;
+        }
+    }
+    DeleteBuffer(m_vertexBufferId_bind, result);
+    DeleteBuffer(m_vertexBufferId_skinned, result);
+    DeleteBuffer(m_skinningBufferId, result);
+    DeleteBuffer(m_indexBufferId, result);
+    m_skeleton.CleanUp();
+
+    return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    eae6320::cResult CreateBuffer(const GLenum i_target, const void* const i_data, const size_t i_size, const GLenum i_usage,
+        const char* const i_description, GLuint& o_bufferId)
+    {
+        constexpr auto bufferCount = 1;
+        glGenBuffers(bufferCount, &o_bufferId);
+        auto errorCode = glGetError();
+        if (errorCode == GL_NO_ERROR)
+        {
+            glBindBuffer(i_target, o_bufferId);
+            errorCode = glGetError();
+            if (errorCode == GL_NO_ERROR)
+            {
+                EAE6320_ASSERT(i_size < uint64_t(1u) << sizeof(GLsizeiptr) * 8);
+                glBufferData(i_target, static_cast<GLsizeiptr>(i_size), i_data, i_usage);
+                errorCode = glGetError();
+            }
+        }
+        if (errorCode != GL_NO_ERROR)
+        {
+            EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            eae6320::Logging::OutputError("OpenGL failed to create a skinned mesh %s buffer: %s",
+                i_description, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            return eae6320::Results::Failure;
+        }
+        return eae6320::Results::success;
+    }
+
+    eae6320::cResult CreateVertexArray(GLuint& o_vertexArrayId)
+    {
+        constexpr auto arrayCount = 1;
+        glGenVertexArrays(arrayCount, &o_vertexArrayId);
+        auto errorCode = glGetError();
+        if (errorCode == GL_NO_ERROR)
+        {
+            glBindVertexArray(o_vertexArrayId);
+            errorCode = glGetError();
+        }
+        if (errorCode != GL_NO_ERROR)
+        {
+            EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            eae6320::Logging::OutputError("OpenGL failed to create a skinned mesh vertex array: %s",
+                reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            return eae6320::Results::Failure;
+        }
+        return eae6320::Results::success;
+    }
+
+    eae6320::cResult SetMeshVertexAttributes()
+    {
+        using namespace eae6320::Graphics::VertexFormats;
+        constexpr auto stride = static_cast<GLsizei>(sizeof(sMesh));
+        // These must match the locations used by cMesh
+        auto result = SetVertexAttribute(0, 3, GL_FLOAT, GL_FALSE, false, stride, offsetof(sMesh, x), "POSITION");
+        if (result)
+        {
+            result = SetVertexAttribute(1, 3, GL_FLOAT, GL_FALSE, false, stride, offsetof(sMesh, nx), "NORMAL");
+        }
+        if (result)
+        {
+            result = SetVertexAttribute(2, 2, GL_HALF_FLOAT, GL_FALSE, false, stride, offsetof(sMesh, u), "TEXTURE_COORDINATES");
+        }
+        if (result)
+        {
+            result = SetVertexAttribute(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, false, stride, offsetof(sMesh, r), "COLOR");
+        }
+        if (result)
+        {
+            result = SetVertexAttribute(4, 4, GL_SHORT, GL_TRUE, false, stride, offsetof(sMesh, qx), "TANGENT_FRAME");
+        }
+        return result;
+    }
+
+    eae6320::cResult SetSkinningVertexAttributes()
+    {
+        using namespace eae6320::Graphics::VertexFormats;
+        constexpr auto stride = static_cast<GLsizei>(sizeof(sSkinning));
+        // The joint indices must stay integers (rather than being converted to floats)
+        // so that they can index into the matrix palette
+        auto result = SetVertexAttribute(5, 4, GL_UNSIGNED_BYTE, GL_FALSE, true, stride, offsetof(sSkinning, jointIndices), "JOINT_INDICES");
+        if (result)
+        {
+            result = SetVertexAttribute(6, 4, GL_UNSIGNED_BYTE, GL_TRUE, false, stride, offsetof(sSkinning, jointWeights), "JOINT_WEIGHTS");
+        }
+        return result;
+    }
+
+    eae6320::cResult SetVertexAttribute(const GLuint i_location, const GLint i_elementCount, const GLenum i_type, const GLboolean i_normalized,
+        const bool i_isInteger, const GLsizei i_stride, const size_t i_offset, const char* const i_description)
+    {
+        if (i_isInteger)
+        {
+            glVertexAttribIPointer(i_location, i_elementCount, i_type, i_stride, reinterpret_cast<GLvoid*>(i_offset));
+        }
+        else
+        {
+            glVertexAttribPointer(i_location, i_elementCount, i_type, i_normalized, i_stride, reinterpret_cast<GLvoid*>(i_offset));
+        }
+        auto errorCode = glGetError();
+        if (errorCode == GL_NO_ERROR)
+        {
+            glEnableVertexAttribArray(i_location);
+            errorCode = glGetError();
+        }
+        if (errorCode != GL_NO_ERROR)
+        {
+            EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            eae6320::Logging::OutputError("OpenGL failed to set the %s vertex attribute at location %u: %s",
+                i_description, i_location, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            return eae6320::Results::Failure;
+        }
+        return eae6320::Results::success;
+    }
+
+    void DeleteBuffer(GLuint& io_bufferId, eae6320::cResult& io_result)
+    {
+        if (io_bufferId != 0)
+        {
+            constexpr auto bufferCount = 1;
+            glDeleteBuffers(bufferCount, &io_bufferId);
+            const auto errorCode = glGetError();
+            if (errorCode != GL_NO_ERROR)
+            {
+                if (io_result)
+                {
+                    io_result = eae6320::Results::Failure;
+                }
+                EAE6320_ASSERTF(false, reinterpret_cast<const char*>(gluErrorString(errorCode)));
+                eae6320::Logging::OutputError("OpenGL failed to delete a skinned mesh buffer: %s",
+                    reinterpret_cast<const char*>(gluErrorString(errorCode)));
+            }
+            io_bufferId = 0;
+        }
+    }
+}
@@ -54,6 +54,17 @@ eae6320::cResult eae6320::Graphics::sContext::Initialize(const sInitializationPa
         EAE6320_ASSERT(false);
         goto OnExit;
     }
+    // Set whether buffer swaps wait for vertical blanks
+    // (if this fails rendering still works but frames won't be aligned with vertical blanks)
+    {
+        const auto swapInterval = i_initializationParameters.shouldWaitForVerticalBlank ? 1 : 0;
+        if (wglSwapIntervalEXT(swapInterval) == FALSE)
+        {
+            const auto windowsErrorMessage = Windows::GetLastSystemError();
+            EAE6320_ASSERTF(false, windowsErrorMessage.c_str());
+            Logging::OutputError("Windows failed to set the OpenGL swap interval to %i: %s", swapInterval, windowsErrorMessage.c_str());
+        }
+    }
 
 OnExit:
 
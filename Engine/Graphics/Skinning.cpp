@@ -0,0 +1,262 @@
+// Include Files
+//==============
+
+#include "Skinning.h"
+
+#include "VertexFormats.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Math/TangentFrame.h>
+
+#include <algorithm>
+#include <vector>
+
+#if defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 1 ) ) || defined( __SSE__ )
+    #define EAE6320_GRAPHICS_SKINNING_USESSE
+    #include <xmmintrin.h>
+#endif
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // The transforms are read as 16 column-major floats
+    static_assert(sizeof(eae6320::Math::cMatrixTransformation) == (16 * sizeof(float)), "A transform must be exactly 16 floats");
+
+    // Each job is split into chunks of this many vertices,
+    // which is small enough that the work is spread evenly between threads
+    // but big enough that the threads don't spend their time fighting over which chunk is next
+    constexpr size_t s_vertexCountPerChunk = 512;
+
+    // This is only changed by the submitting thread before any chunks are skinned
+    // (it is kept between frames so that it doesn't have to be allocated again)
+    std::vector<size_t> s_firstChunkOfEachJob;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    void SkinTangentFrame(const float* const i_transform_blended, const eae6320::Graphics::VertexFormats::sMesh& i_vertex,
+        eae6320::Graphics::VertexFormats::sMesh& o_vertex);
+    eae6320::Math::sVector TransformDirection(const float* const i_transform, const eae6320::Math::sVector& i_direction);
+    void SkinChunk(const eae6320::Graphics::Skinning::sJob* const i_jobs, const size_t i_chunkIndex);
+}
+
+// Interface
+//==========
+
+void eae6320::Graphics::Skinning::SkinVertices(const sJob& i_job, const size_t i_firstVertex, const size_t i_vertexCount)
+{
+#if defined( EAE6320_GRAPHICS_SKINNING_USESSE )
+    EAE6320_ASSERT((i_firstVertex + i_vertexCount) <= i_job.vertexCount);
+    const auto* const transforms = reinterpret_cast<const float*>(i_job.transforms_skinning);
+    const auto endVertex = i_firstVertex + i_vertexCount;
+    for (auto i = i_firstVertex; i < endVertex; i++)
+    {
+        const auto& vertex_bind = i_job.vertices_bind[i];
+        const auto& skinning = i_job.skinningData[i];
+        auto& vertex_skinned = i_job.vertices_skinned[i];
+
+        // Blend the transforms of the influencing joints
+        // (every operation is done in the same order as the scalar implementation
+        // so that the results are exactly the same)
+        __m128 columns[4];
+        {
+            const auto* const transform0 = transforms + (skinning.jointIndices[0] * 16);
+            const auto weight0 = _mm_set1_ps(static_cast<float>(skinning.jointWeights[0]) * (1.0f / 255.0f));
+            for (auto c = 0; c < 4; c++)
+            {
+                columns[c] = _mm_mul_ps(_mm_loadu_ps(transform0 + (c * 4)), weight0);
+            }
+            for (auto j = 1; j < 4; j++)
+            {
+                const auto* const transform = transforms + (skinning.jointIndices[j] * 16);
+                const auto weight = _mm_set1_ps(static_cast<float>(skinning.jointWeights[j]) * (1.0f / 255.0f));
+                for (auto c = 0; c < 4; c++)
+                {
+                    columns[c] = _mm_add_ps(columns[c], _mm_mul_ps(_mm_loadu_ps(transform + (c * 4)), weight));
+                }
+            }
+        }
+
+        vertex_skinned = vertex_bind;
+        alignas(16) float result[4];
+        // Position
+        {
+            auto position = _mm_mul_ps(columns[0], _mm_set1_ps(vertex_bind.x));
+            position = _mm_add_ps(position, _mm_mul_ps(columns[1], _mm_set1_ps(vertex_bind.y)));
+            position = _mm_add_ps(position, _mm_mul_ps(columns[2], _mm_set1_ps(vertex_bind.z)));
+            position = _mm_add_ps(position, columns[3]);
+            _mm_store_ps(result, position);
+            vertex_skinned.x = result[0];
+            vertex_skinned.y = result[1];
+            vertex_skinned.z = result[2];
+        }
+        // Normal
+        // (like on the GPU the normal isn't re-normalized)
+        {
+            auto normal = _mm_mul_ps(columns[0], _mm_set1_ps(vertex_bind.nx));
+            normal = _mm_add_ps(normal, _mm_mul_ps(columns[1], _mm_set1_ps(vertex_bind.ny)));
+            normal = _mm_add_ps(normal, _mm_mul_ps(columns[2], _mm_set1_ps(vertex_bind.nz)));
+            _mm_store_ps(result, normal);
+            vertex_skinned.nx = result[0];
+            vertex_skinned.ny = result[1];
+            vertex_skinned.nz = result[2];
+        }
+        // Tangent Frame
+        {
+            alignas(16) float transform_blended[16];
+            for (auto c = 0; c < 4; c++)
+            {
+                _mm_store_ps(transform_blended + (c * 4), columns[c]);
+            }
+            SkinTangentFrame(transform_blended, vertex_bind, vertex_skinned);
+        }
+    }
+#else
+    SkinVertices_reference(i_job, i_firstVertex, i_vertexCount);
+#endif
+}
+
+void eae6320::Graphics::Skinning::SkinVertices_reference(const sJob& i_job, const size_t i_firstVertex, const size_t i_vertexCount)
+{
+    EAE6320_ASSERT((i_firstVertex + i_vertexCount) <= i_job.vertexCount);
+    const auto* const transforms = reinterpret_cast<const float*>(i_job.transforms_skinning);
+    const auto endVertex = i_firstVertex + i_vertexCount;
+    for (auto i = i_firstVertex; i < endVertex; i++)
+    {
+        const auto& vertex_bind = i_job.vertices_bind[i];
+        const auto& skinning = i_job.skinningData[i];
+        auto& vertex_skinned = i_job.vertices_skinned[i];
+
+        // Blend the transforms of the influencing joints
+        float transform_blended[16];
+        {
+            const auto* const transform0 = transforms + (skinning.jointIndices[0] * 16);
+            const auto weight0 = static_cast<float>(skinning.jointWeights[0]) * (1.0f / 255.0f);
+            for (auto k = 0; k < 16; k++)
+            {
+                transform_blended[k] = transform0[k] * weight0;
+            }
+            for (auto j = 1; j < 4; j++)
+            {
+                const auto* const transform = transforms + (skinning.jointIndices[j] * 16);
+                const auto weight = static_cast<float>(skinning.jointWeights[j]) * (1.0f / 255.0f);
+                for (auto k = 0; k < 16; k++)
+                {
+                    transform_blended[k] = transform_blended[k] + (transform[k] * weight);
+                }
+            }
+        }
+
+        vertex_skinned = vertex_bind;
+        // Position
+        {
+            const auto* const t = transform_blended;
+            vertex_skinned.x = (((t[0] * vertex_bind.x) + (t[4] * vertex_bind.y)) + (t[8] * vertex_bind.z)) + t[12];
+            vertex_skinned.y = (((t[1] * vertex_bind.x) + (t[5] * vertex_bind.y)) + (t[9] * vertex_bind.z)) + t[13];
+            vertex_skinned.z = (((t[2] * vertex_bind.x) + (t[6] * vertex_bind.y)) + (t[10] * vertex_bind.z)) + t[14];
+        }
+        // Normal
+        // (like on the GPU the normal isn't re-normalized)
+        {
+            const auto normal = TransformDirection(transform_blended, Math::sVector(vertex_bind.nx, vertex_bind.ny, vertex_bind.nz));
+            vertex_skinned.nx = normal.x;
+            vertex_skinned.ny = normal.y;
+            vertex_skinned.nz = normal.z;
+        }
+        // Tangent Frame
+        SkinTangentFrame(transform_blended, vertex_bind, vertex_skinned);
+    }
+}
+
+void eae6320::Graphics::Skinning::SkinInParallel(const sJob* const i_jobs, const size_t i_jobCount)
+{
+    EAE6320_ASSERT(i_jobs || (i_jobCount == 0));
+
+    s_firstChunkOfEachJob.resize(i_jobCount);
+    size_t chunkCount = 0;
+    for (size_t i = 0; i < i_jobCount; i++)
+    {
+        s_firstChunkOfEachJob[i] = chunkCount;
+        chunkCount += (i_jobs[i].vertexCount + (s_vertexCountPerChunk - 1)) / s_vertexCountPerChunk;
+    }
+
+    // Every chunk writes to different vertices,
+    // and so it doesn't matter which thread skins which chunk
+    Concurrency::Jobs::ParallelFor(0, chunkCount, 1, [i_jobs](const size_t i_firstChunk, const size_t i_endChunk)
+        {
+            for (auto i = i_firstChunk; i < i_endChunk; i++)
+            {
+                SkinChunk(i_jobs, i);
+            }
+        });
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::Skinning::Initialize()
+{
+    // The chunks are skinned by the job system
+    // (if it hasn't been initialized they are all skinned by the submitting thread)
+    s_firstChunkOfEachJob.clear();
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Graphics::Skinning::CleanUp()
+{
+    s_firstChunkOfEachJob.clear();
+    s_firstChunkOfEachJob.shrink_to_fit();
+
+    return Results::success;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void SkinTangentFrame(const float* const i_transform_blended, const eae6320::Graphics::VertexFormats::sMesh& i_vertex,
+        eae6320::Graphics::VertexFormats::sMesh& o_vertex)
+    {
+        // The tangent frame can't be transformed as a quaternion
+        // because a blend of rotations isn't a rotation,
+        // and so it is transformed as three directions and then packed again
+        int16_t tangentFrame[] = { i_vertex.qx, i_vertex.qy, i_vertex.qz, i_vertex.qw };
+        eae6320::Math::sVector tangent, bitangent, normal;
+        eae6320::Math::UnpackTangentFrame(tangentFrame, tangent, bitangent, normal);
+        eae6320::Math::PackTangentFrame(TransformDirection(i_transform_blended, tangent), TransformDirection(i_transform_blended, bitangent),
+            TransformDirection(i_transform_blended, normal), tangentFrame);
+        o_vertex.qx = tangentFrame[0];
+        o_vertex.qy = tangentFrame[1];
+        o_vertex.qz = tangentFrame[2];
+        o_vertex.qw = tangentFrame[3];
+    }
+
+    eae6320::Math::sVector TransformDirection(const float* const i_transform, const eae6320::Math::sVector& i_direction)
+    {
+        const auto* const t = i_transform;
+        return eae6320::Math::sVector(
+            ((t[0] * i_direction.x) + (t[4] * i_direction.y)) + (t[8] * i_direction.z),
+            ((t[1] * i_direction.x) + (t[5] * i_direction.y)) + (t[9] * i_direction.z),
+            ((t[2] * i_direction.x) + (t[6] * i_direction.y)) + (t[10] * i_direction.z));
+    }
+
+    void SkinChunk(const eae6320::Graphics::Skinning::sJob* const i_jobs, const size_t i_chunkIndex)
+    {
+        // Find which job the chunk belongs to
+        const auto jobIndex = static_cast<size_t>(std::upper_bound(s_firstChunkOfEachJob.begin(), s_firstChunkOfEachJob.end(), i_chunkIndex)
+            - s_firstChunkOfEachJob.begin()) - 1;
+        const auto& job = i_jobs[jobIndex];
+        const auto firstVertex = (i_chunkIndex - s_firstChunkOfEachJob[jobIndex]) * s_vertexCountPerChunk;
+        eae6320::Graphics::Skinning::SkinVertices(job, firstVertex, std::min(s_vertexCountPerChunk, job.vertexCount - firstVertex));
+    }
+}
@@ -0,0 +1,84 @@
+/*
+    This file declares the CPU implementation of skinning
+
+    Skinning moves each vertex of a mesh by blending the transforms of the joints that influence it.
+    It can happen on the GPU (in a vertex shader) or on the CPU (with the results uploaded to a dynamic vertex buffer),
+    and the CPU implementation is the reference that the GPU implementation must match.
+
+    CPU skinning is done in parallel:
+    All of the skinned meshes that are rendered in a frame are submitted at once,
+    and the vertices are split into chunks that are skinned as jobs by the job system
+    (as well as by the thread that submitted them).
+*/
+
+#ifndef EAE6320_GRAPHICS_SKINNING_H
+#define EAE6320_GRAPHICS_SKINNING_H
+
+// Include Files
+//==============
+
+#include <Engine/Results/Results.h>
+
+#include <cstddef>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        namespace VertexFormats
+        {
+            struct sMesh;
+            struct sSkinning;
+        }
+    }
+    namespace Math
+    {
+        class cMatrixTransformation;
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        namespace Skinning
+        {
+            // A single skinned mesh to be skinned on the CPU
+            struct sJob
+            {
+                const VertexFormats::sMesh* vertices_bind = nullptr;
+                const VertexFormats::sSkinning* skinningData = nullptr;
+                // There must be a transform for every joint that the skinning data refers to
+                const Math::cMatrixTransformation* transforms_skinning = nullptr;
+                VertexFormats::sMesh* vertices_skinned = nullptr;
+                size_t vertexCount = 0;
+            };
+
+            // Skins the vertices of a single job on the calling thread.
+            // If SIMD instructions are available they are used,
+            // but the results are identical to the scalar implementation either way
+            void SkinVertices(const sJob& i_job, const size_t i_firstVertex, const size_t i_vertexCount);
+            // This is always the scalar implementation
+            void SkinVertices_reference(const sJob& i_job, const size_t i_firstVertex, const size_t i_vertexCount);
+
+            // Skins every job and returns once they are all finished
+            // (the calling thread does some of the work, too).
+            // This must only be called from one thread at a time
+            void SkinInParallel(const sJob* const i_jobs, const size_t i_jobCount);
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            cResult Initialize();
+            cResult CleanUp();
+        }
+    }
+}
+
+#endif    // EAE6320_GRAPHICS_SKINNING_H
@@ -38,7 +38,7 @@ namespace eae6320
                 explicit sTextureCoordinates(const float i_left = 0.0f, const float i_right = 1.0f, const float i_top = 1.0f, const float i_bottom = 0.0f) :
                     left(Math::MakeHalfFromFloat(i_left)),
                     right(Math::MakeHalfFromFloat(i_right)),
-#if defined( EAE6320_PLATFORM_D3D )
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
                     top(Math::MakeHalfFromFloat(1.0f - i_top)),
                     bottom(Math::MakeHalfFromFloat(1.0f - i_bottom))
 #elif defined( EAE6320_PLATFORM_GL )
@@ -24,7 +24,8 @@ namespace eae6320
             {
                 UNKNOWN,
                 SPRITE,
-                MESH
+                MESH,
+                SKINNED_MESH
             };
 
             struct sSprite
@@ -61,6 +62,30 @@ namespace eae6320
                 // 4 uint8_t == 4 bytes
                 // Offset = 28
                 uint8_t r, g, b, a;
+
+                // TANGENT_FRAME
+                // 4 int16_t == 8 bytes
+                // Offset = 32
+                // (a quaternion that rotates +x/+y/+z to the tangent/bitangent/normal
+                // with the handedness of the bitangent in the sign of w; see Math::PackTangentFrame())
+                int16_t qx, qy, qz, qw;
+            };
+
+            // A skinned mesh has a second stream of vertex data
+            // so that the sMesh stream can be replaced by vertices that were skinned on the CPU
+            // without the skinning data having to be copied every frame
+            struct sSkinning
+            {
+                // BLENDINDICES
+                // 4 uint8_t == 4 bytes
+                // Offset = 0
+                uint8_t jointIndices[4];
+
+                // BLENDWEIGHT
+                // 4 uint8_t == 4 bytes
+                // Offset = 4
+                // (the weights are normalized and always add up to exactly 255)
+                uint8_t jointWeights[4];
             };
         }
     }
@@ -27,6 +27,7 @@ eae6320::cResult eae6320::Graphics::cConstantBuffer::Initialize( const void* con
                 case ConstantBufferTypes::PerFrame: m_size = sizeof( ConstantBufferFormats::sPerFrame ); break;
                 case ConstantBufferTypes::PerMaterial: m_size = sizeof( ConstantBufferFormats::sPerMaterial ); break;
                 case ConstantBufferTypes::PerDrawCall: m_size = sizeof( ConstantBufferFormats::sPerDrawCall ); break;
+                case ConstantBufferTypes::PerSkinnedDrawCall: m_size = sizeof( ConstantBufferFormats::sPerSkinnedDrawCall ); break;
 
             // This should never happen
             default:
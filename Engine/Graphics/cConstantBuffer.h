@@ -23,6 +23,7 @@
 
 #include "Configuration.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <Engine/Results/Results.h>
 
@@ -61,6 +62,10 @@ namespace eae6320
         //    * Per-Draw Call:
         //        * These are values that are associated with a specific draw call
         //        * The constant buffer must be updated and bound for every draw call that is made
+        //    * Per-Skinned Draw Call:
+        //        * These are the joint transforms of a skinned mesh that is skinned on the GPU
+        //        * They are kept separate from the per-draw call data
+        //            so that draw calls that aren't skinned don't have to pay to update them
         enum class ConstantBufferTypes : uint8_t
         {
             // These values aren't arbitrary enumerations;
@@ -69,6 +74,7 @@ namespace eae6320
             PerFrame = 0,
             PerMaterial = 1,
             PerDrawCall = 2,
+            PerSkinnedDrawCall = 3,
 
             count,
             Invalid = count
@@ -127,6 +133,9 @@ namespace eae6320
             ID3D11Buffer* m_buffer = nullptr;
 #elif defined( EAE6320_PLATFORM_GL )
             GLuint m_bufferId = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+            // The most recently updated data is copied here instead of to a GPU
+            void* m_data = nullptr;
 #endif
             
             // The constant buffer type defines the size of the constant data
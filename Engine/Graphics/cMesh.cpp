@@ -6,8 +6,11 @@
 
 #include <Engine/Asserts/Asserts.h>
 #include <Engine/Logging/Logging.h>
+#include <Engine/Math/Hash.h>
 #include <Engine/Platform/Platform.h>
 
+#include <algorithm>
+#include <cstring>
 #include <new>
 
 
@@ -30,82 +33,66 @@ eae6320::cResult eae6320::Graphics::cMesh::Load(const char* const i_path, cMesh*
     HelperStructs::sMeshData newMeshDataExtractedFromFile;
     cMesh* newMesh = nullptr;
 
-    // Load the binary data
+    // Load and extract the mesh data
+    if (!((result = LoadMeshData(i_path, dataFromFile, newMeshDataExtractedFromFile))))
     {
-        std::string errorMessage;
-        if (!((result = LoadBinaryFile(i_path, dataFromFile, &errorMessage))))
-        {
-            EAE6320_ASSERTF(false, errorMessage.c_str());
-            Logging::OutputError("Failed to load mesh from file %s: %s", i_path, errorMessage.c_str());
-            goto OnExit;
-        }
+        goto OnExit;
     }
 
-    // Allocate a new mesh
+    // Create the new mesh
+    if (!((result = Create(&newMeshDataExtractedFromFile, newMesh))))
     {
-        newMesh = new (std::nothrow) cMesh();
-        if (!newMesh)
-        {
-            result = Results::outOfMemory;
-            EAE6320_ASSERTF(false, "Couldn't allocate memory for the mesh %s", i_path);
-            Logging::OutputError("Failed to allocate memory for the mesh %s", i_path);
-            goto OnExit;
-        }
+        EAE6320_ASSERTF(false, "Creation of new mesh failed: \"%s\"", i_path);
+        goto OnExit;
     }
 
-    // Extract data from loaded mesh file
-    {
-        // Casting data to uintptr_t for pointer arithematic
-
-        auto currentOffset = reinterpret_cast<uintptr_t>(dataFromFile.data);
-        const auto finalOffset = currentOffset + dataFromFile.size;
-
-        // Extracting Vertex Count
-
-        const auto numberOfVerticesWithTypeOfIndexData = *reinterpret_cast<uint32_t*>(currentOffset);
-        newMeshDataExtractedFromFile.numberOfVertices = numberOfVerticesWithTypeOfIndexData & INT32_MAX;
-
-        // Extracting Type Of Index Data        
-
-        newMeshDataExtractedFromFile.type = (!(numberOfVerticesWithTypeOfIndexData & (INT32_MAX + 1u))) ? IndexDataTypes::BIT_16 : IndexDataTypes::BIT_32;
-
-        // Extracting Index Count
-
-        currentOffset += sizeof(newMeshDataExtractedFromFile.numberOfVertices);
-        newMeshDataExtractedFromFile.numberOfIndices = *reinterpret_cast<uint32_t*>(currentOffset);
+OnExit:
 
-        // Extracting Index Data
+    if (result)
+    {
+        EAE6320_ASSERT(newMesh);
+        o_mesh = newMesh;
+    }
+    else
+    {
+        o_mesh = nullptr;
+    }
+    // The extracted data points into the loaded file and so it must not be freed by the mesh data
+    newMeshDataExtractedFromFile.vertexData = nullptr;
+    newMeshDataExtractedFromFile.indexData = nullptr;
+    newMeshDataExtractedFromFile.skinningData = nullptr;
+    newMeshDataExtractedFromFile.jointData = nullptr;
+    dataFromFile.Free();
 
-        currentOffset += sizeof(newMeshDataExtractedFromFile.numberOfIndices);
-        newMeshDataExtractedFromFile.indexData = reinterpret_cast<void*>(currentOffset);
+    return result;
+}
 
-        // Extracting Vertex Data
-        const auto sizeInBytesOfIndexData = newMeshDataExtractedFromFile.numberOfIndices * (newMeshDataExtractedFromFile.type == IndexDataTypes::BIT_16 ? sizeof(uint16_t) : sizeof(uint32_t));
-        currentOffset += sizeInBytesOfIndexData;
-        {
-            // Calculate and remove the added padding
-            currentOffset += sizeInBytesOfIndexData % alignof(VertexFormats::sMesh);
-        }
+eae6320::cResult eae6320::Graphics::cMesh::Create(HelperStructs::sMeshData const*const& i_meshData, cMesh*& o_mesh)
+{
+    auto result = Results::success;
 
-        newMeshDataExtractedFromFile.vertexData = reinterpret_cast<VertexFormats::sMesh*>(currentOffset);
+    cMesh* newMesh = nullptr;
 
-        // Check EOF
+    EAE6320_ASSERT(i_meshData);
 
-        currentOffset += newMeshDataExtractedFromFile.numberOfVertices * sizeof(VertexFormats::sMesh);
-        if (finalOffset != currentOffset)
+    // Allocate a new mesh
+    {
+        newMesh = new (std::nothrow) cMesh();
+        if (!newMesh)
         {
-            result = Results::Failure;
-            EAE6320_ASSERTF(false, "Redundant data found in file: \"%s\"", i_path);
-            Logging::OutputError("Mesh file: \"%s\" has redundant data", i_path);
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for the mesh");
+            Logging::OutputError("Failed to allocate memory for the mesh");
             goto OnExit;
         }
     }
 
-    if (!((result = newMesh->Initialize(&newMeshDataExtractedFromFile))))
+    if (!((result = newMesh->Initialize(i_meshData))))
     {
         EAE6320_ASSERTF(false, "Initialization of new mesh failed");
         goto OnExit;
     }
+    newMesh->CalculateBounds(*i_meshData);
 
 OnExit:
 
@@ -123,9 +110,183 @@ OnExit:
         }
         o_mesh = nullptr;
     }
-    dataFromFile.Free();
-    newMeshDataExtractedFromFile.vertexData = nullptr;
-    newMeshDataExtractedFromFile.indexData = nullptr;
+
+    return result;
+}
+
+eae6320::cResult eae6320::Graphics::cMesh::LoadMeshData(const char* const i_path, Platform::sDataFromFile& o_dataFromFile, HelperStructs::sMeshData& o_meshData)
+{
+    auto result = Results::success;
+
+    // Load the binary data
+    {
+        std::string errorMessage;
+        if (!((result = LoadBinaryFile(i_path, o_dataFromFile, &errorMessage))))
+        {
+            EAE6320_ASSERTF(false, errorMessage.c_str());
+            Logging::OutputError("Failed to load mesh from file %s: %s", i_path, errorMessage.c_str());
+            goto OnExit;
+        }
+    }
+
+    // Validate the file and extract the mesh data from it.
+    // Everything is checked before anything is dereferenced
+    // so that a corrupt or truncated file can never cause an out-of-bounds read
+    {
+        using namespace BinaryMeshFile;
+
+        const auto* const fileData = static_cast<const uint8_t*>(o_dataFromFile.data);
+        const auto fileSize = o_dataFromFile.size;
+
+        // Header
+        if (fileSize < sizeof(sHeader))
+        {
+            result = Results::invalidFile;
+            EAE6320_ASSERTF(false, "The mesh file \"%s\" is too small to have a header", i_path);
+            Logging::OutputError("The mesh file \"%s\" is only %zu bytes and is too small to have a header", i_path, fileSize);
+            goto OnExit;
+        }
+        sHeader header;
+        memcpy(&header, fileData, sizeof(header));
+        if (header.magic != magic)
+        {
+            result = Results::invalidFile;
+            EAE6320_ASSERTF(false, "\"%s\" isn't a built mesh file", i_path);
+            Logging::OutputError("\"%s\" isn't a built mesh file (its magic number is %#010x)", i_path, header.magic);
+            goto OnExit;
+        }
+        if ((header.version != currentVersion) || (header.headerSize != sizeof(sHeader)))
+        {
+            result = Results::invalidFile;
+            EAE6320_ASSERTF(false, "The mesh file \"%s\" has an unsupported version", i_path);
+            Logging::OutputError("The mesh file \"%s\" is version %u but version %u is required (it must be rebuilt)", i_path, header.version, currentVersion);
+            goto OnExit;
+        }
+        if (header.vertexSize != sizeof(VertexFormats::sMesh))
+        {
+            result = Results::invalidFile;
+            EAE6320_ASSERTF(false, "The mesh file \"%s\" has a different vertex format", i_path);
+            Logging::OutputError("The mesh file \"%s\" has %u byte vertices but %zu byte vertices are required (it must be rebuilt)", i_path, header.vertexSize, sizeof(VertexFormats::sMesh));
+            goto OnExit;
+        }
+        if ((header.indexType != IndexDataTypes::BIT_16) && (header.indexType != IndexDataTypes::BIT_32))
+        {
+            result = Results::invalidFile;
+            EAE6320_ASSERTF(false, "The mesh file \"%s\" has an invalid index type", i_path);
+            Logging::OutputError("The mesh file \"%s\" has an invalid index type (%u)", i_path, header.indexType);
+            goto OnExit;
+        }
+
+        // Sections
+        {
+            const auto indexSize = (header.indexType == IndexDataTypes::BIT_16) ? sizeof(uint16_t) : sizeof(uint32_t);
+            // 64 bit math is used so that the sizes can't overflow
+            const auto indexDataEnd = static_cast<uint64_t>(header.offsetToIndexData) + (static_cast<uint64_t>(header.numberOfIndices) * indexSize);
+            const auto vertexDataEnd = static_cast<uint64_t>(header.offsetToVertexData) + (static_cast<uint64_t>(header.numberOfVertices) * sizeof(VertexFormats::sMesh));
+            auto areSectionsAligned = ((header.offsetToIndexData % sectionAlignment) == 0) && ((header.offsetToVertexData % sectionAlignment) == 0);
+            auto areSectionsInOrder = (header.offsetToIndexData >= sizeof(sHeader)) && (header.offsetToVertexData >= indexDataEnd);
+            auto dataEnd = vertexDataEnd;
+            if (header.numberOfJoints > 0)
+            {
+                const auto skinningDataEnd = static_cast<uint64_t>(header.offsetToSkinningData) + (static_cast<uint64_t>(header.numberOfVertices) * sizeof(VertexFormats::sSkinning));
+                const auto jointDataEnd = static_cast<uint64_t>(header.offsetToJointData) + (static_cast<uint64_t>(header.numberOfJoints) * sizeof(HelperStructs::sJoint));
+                areSectionsAligned = areSectionsAligned && ((header.offsetToSkinningData % sectionAlignment) == 0) && ((header.offsetToJointData % sectionAlignment) == 0);
+                areSectionsInOrder = areSectionsInOrder && (header.offsetToSkinningData >= vertexDataEnd) && (header.offsetToJointData >= skinningDataEnd);
+                dataEnd = jointDataEnd;
+            }
+            else
+            {
+                areSectionsInOrder = areSectionsInOrder && (header.offsetToSkinningData == 0) && (header.offsetToJointData == 0);
+            }
+            if (!areSectionsAligned || !areSectionsInOrder || (dataEnd != header.fileSize) || (header.fileSize != fileSize))
+            {
+                result = Results::invalidFile;
+                EAE6320_ASSERTF(false, "The mesh file \"%s\" has invalid section offsets", i_path);
+                Logging::OutputError("The mesh file \"%s\" has invalid section offsets or is truncated (%zu bytes instead of %u)", i_path, fileSize, header.fileSize);
+                goto OnExit;
+            }
+            if ((header.numberOfVertices < 3) || (header.numberOfIndices == 0) || ((header.numberOfIndices % 3) != 0)
+                || ((header.indexType == IndexDataTypes::BIT_16) && (header.numberOfVertices > (UINT16_MAX + 1u)))
+                || (header.numberOfJoints > maxJointCount))
+            {
+                result = Results::invalidFile;
+                EAE6320_ASSERTF(false, "The mesh file \"%s\" has invalid counts", i_path);
+                Logging::OutputError("The mesh file \"%s\" has an invalid number of vertices (%u), indices (%u), or joints (%u)", i_path,
+                    header.numberOfVertices, header.numberOfIndices, header.numberOfJoints);
+                goto OnExit;
+            }
+        }
+
+        // Checksum
+        {
+            const auto checksum = Math::CalculateXxHash32(fileData + sizeof(sHeader), fileSize - sizeof(sHeader));
+            if (checksum != header.checksum)
+            {
+                result = Results::invalidFile;
+                EAE6320_ASSERTF(false, "The mesh file \"%s\" is corrupt", i_path);
+                Logging::OutputError("The mesh file \"%s\" is corrupt (its checksum is %#010x instead of %#010x)", i_path, checksum, header.checksum);
+                goto OnExit;
+            }
+        }
+
+        // The loaded file's memory is allocated with the default alignment
+        // which is enough for the sections to be used in place
+        EAE6320_ASSERT((reinterpret_cast<uintptr_t>(fileData) % alignof(VertexFormats::sMesh)) == 0);
+
+        o_meshData.numberOfVertices = header.numberOfVertices;
+        o_meshData.numberOfIndices = header.numberOfIndices;
+        o_meshData.type = header.indexType;
+        o_meshData.indexData = const_cast<uint8_t*>(fileData + header.offsetToIndexData);
+        o_meshData.vertexData = reinterpret_cast<VertexFormats::sMesh*>(const_cast<uint8_t*>(fileData + header.offsetToVertexData));
+
+        // Skeleton
+        if (header.numberOfJoints > 0)
+        {
+            auto* const skinningData = reinterpret_cast<VertexFormats::sSkinning*>(const_cast<uint8_t*>(fileData + header.offsetToSkinningData));
+            auto* const jointData = reinterpret_cast<HelperStructs::sJoint*>(const_cast<uint8_t*>(fileData + header.offsetToJointData));
+            // The checksum only proves that the file wasn't corrupted after it was built,
+            // and so the indices are checked before anything uses them to index an array
+            for (uint32_t i = 0; i < header.numberOfJoints; i++)
+            {
+                const auto parentIndex = jointData[i].parentIndex;
+                if ((parentIndex < -1) || (parentIndex >= static_cast<int32_t>(i)))
+                {
+                    result = Results::invalidFile;
+                    EAE6320_ASSERTF(false, "The mesh file \"%s\" has an invalid skeleton", i_path);
+                    Logging::OutputError("The mesh file \"%s\" has an invalid parent (%d) for joint %u", i_path, parentIndex, i);
+                    goto OnExit;
+                }
+            }
+            for (uint32_t i = 0; i < header.numberOfVertices; i++)
+            {
+                for (auto j = 0; j < 4; j++)
+                {
+                    if (skinningData[i].jointIndices[j] >= header.numberOfJoints)
+                    {
+                        result = Results::invalidFile;
+                        EAE6320_ASSERTF(false, "The mesh file \"%s\" has invalid skinning data", i_path);
+                        Logging::OutputError("The mesh file \"%s\" has vertex %u influenced by joint %u but there are only %u joints", i_path,
+                            i, skinningData[i].jointIndices[j], header.numberOfJoints);
+                        goto OnExit;
+                    }
+                }
+            }
+            o_meshData.skinningData = skinningData;
+            o_meshData.jointData = jointData;
+            o_meshData.numberOfJoints = header.numberOfJoints;
+        }
+    }
+
+OnExit:
+
+    if (!result)
+    {
+        o_meshData.vertexData = nullptr;
+        o_meshData.indexData = nullptr;
+        o_meshData.skinningData = nullptr;
+        o_meshData.jointData = nullptr;
+        o_dataFromFile.Free();
+    }
 
     return result;
 }
@@ -134,3 +295,23 @@ eae6320::Graphics::cMesh::~cMesh()
 {
     CleanUp();
 }
+
+// Implementation
+//===============
+
+void eae6320::Graphics::cMesh::CalculateBounds(const HelperStructs::sMeshData& i_meshData)
+{
+    if (i_meshData.numberOfVertices == 0)
+    {
+        m_minimumBounds = m_maximumBounds = Math::sVector();
+        return;
+    }
+    const auto& firstVertex = i_meshData.vertexData[0];
+    m_minimumBounds = m_maximumBounds = Math::sVector(firstVertex.x, firstVertex.y, firstVertex.z);
+    for (uint32_t i = 1; i < i_meshData.numberOfVertices; i++)
+    {
+        const auto& vertex = i_meshData.vertexData[i];
+        m_minimumBounds = Math::sVector(std::min(m_minimumBounds.x, vertex.x), std::min(m_minimumBounds.y, vertex.y), std::min(m_minimumBounds.z, vertex.z));
+        m_maximumBounds = Math::sVector(std::max(m_maximumBounds.x, vertex.x), std::max(m_maximumBounds.y, vertex.y), std::max(m_maximumBounds.z, vertex.z));
+    }
+}
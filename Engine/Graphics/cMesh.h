@@ -13,6 +13,7 @@ A mesh is a 3d representation of an entity on screen
 
 #include <Engine/Assets/cManager.h>
 #include <Engine/Assets/ReferenceCountedAssets.h>
+#include <Engine/Math/sVector.h>
 #include <Engine/Results/Results.h>
 
 #ifdef EAE6320_PLATFORM_GL
@@ -36,6 +37,10 @@ namespace eae6320
             struct sMeshData;
         }
     }
+    namespace Platform
+    {
+        struct sDataFromFile;
+    }
 }
 
 // Class Declaration
@@ -60,6 +65,15 @@ namespace eae6320
             //--------------------------
 
             static cResult Load(const char* const i_path, cMesh*& o_mesh);
+            // Creates a mesh from data that was generated at run-time rather than loaded from a file
+            // (e.g. static geometry that has been merged into a single batch)
+            static cResult Create(HelperStructs::sMeshData const*const& i_meshData, cMesh*& o_mesh);
+
+            // Extracts the mesh data from a built mesh file without creating a mesh.
+            // The extracted vertex and index data point into o_dataFromFile,
+            // and so they are only valid until it is freed
+            // (which also means that o_meshData must not be allowed to free them)
+            static cResult LoadMeshData(const char* const i_path, Platform::sDataFromFile& o_dataFromFile, HelperStructs::sMeshData& o_meshData);
 
             EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cMesh);
 
@@ -73,6 +87,14 @@ namespace eae6320
 
             void Draw() const;
 
+            // Bounds
+            //-------
+
+            // The bounds are an axis-aligned box in the mesh's local space
+            // (calculated from the vertex positions when the mesh is created)
+            const Math::sVector& GetMinimumBounds() const { return m_minimumBounds; }
+            const Math::sVector& GetMaximumBounds() const { return m_maximumBounds; }
+
             // Data
             //=====
 
@@ -102,6 +124,8 @@ namespace eae6320
 #endif
             EAE6320_ASSETS_DECLAREREFERENCECOUNT();
             IndexDataTypes::eType m_type = IndexDataTypes::UNKNOWN;
+            Math::sVector m_minimumBounds;
+            Math::sVector m_maximumBounds;
 
             // Implementation
             //===============
@@ -114,6 +138,7 @@ namespace eae6320
 
             cResult Initialize(HelperStructs::sMeshData const*const& i_meshData);
             cResult CleanUp();
+            void CalculateBounds(const HelperStructs::sMeshData& i_meshData);
         };
     }
 }
@@ -58,7 +58,7 @@ namespace eae6320
 
 #if defined( EAE6320_PLATFORM_D3D )
             ID3D11SamplerState* m_samplerState = nullptr;
-#else
+#elif defined( EAE6320_PLATFORM_GL )
             GLuint m_samplerStateId = 0;
 #endif
 
@@ -0,0 +1,147 @@
+// Include Files
+//==============
+
+#include "cSkinnedMesh.h"
+
+#include "cMesh.h"
+#include "ConstantBufferFormats.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Platform/Platform.h>
+
+#include <new>
+
+// Static Data Initialization
+//===========================
+
+eae6320::Assets::cManager<eae6320::Graphics::cSkinnedMesh> eae6320::Graphics::cSkinnedMesh::s_manager;
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::Load(const char* const i_path, cSkinnedMesh*& o_mesh)
+{
+    auto result = Results::success;
+
+    Platform::sDataFromFile dataFromFile;
+    HelperStructs::sMeshData newMeshDataExtractedFromFile;
+    cSkinnedMesh* newMesh = nullptr;
+
+    // Load and extract the mesh data
+    if (!((result = cMesh::LoadMeshData(i_path, dataFromFile, newMeshDataExtractedFromFile))))
+    {
+        goto OnExit;
+    }
+    if (newMeshDataExtractedFromFile.numberOfJoints == 0)
+    {
+        result = Results::invalidFile;
+        EAE6320_ASSERTF(false, "The mesh \"%s\" doesn't have a skeleton", i_path);
+        Logging::OutputError("The mesh \"%s\" can't be used as a skinned mesh because it doesn't have a skeleton", i_path);
+        goto OnExit;
+    }
+
+    // Allocate a new skinned mesh
+    {
+        newMesh = new (std::nothrow) cSkinnedMesh();
+        if (!newMesh)
+        {
+            result = Results::outOfMemory;
+            EAE6320_ASSERTF(false, "Couldn't allocate memory for the skinned mesh %s", i_path);
+            Logging::OutputError("Failed to allocate memory for the skinned mesh %s", i_path);
+            goto OnExit;
+        }
+    }
+
+    if (!((result = newMesh->Initialize(newMeshDataExtractedFromFile))))
+    {
+        EAE6320_ASSERTF(false, "Initialization of new skinned mesh failed: \"%s\"", i_path);
+        goto OnExit;
+    }
+
+OnExit:
+
+    if (result)
+    {
+        EAE6320_ASSERT(newMesh);
+        o_mesh = newMesh;
+    }
+    else
+    {
+        if (newMesh)
+        {
+            newMesh->DecrementReferenceCount();
+            newMesh = nullptr;
+        }
+        o_mesh = nullptr;
+    }
+    // The extracted data points into the loaded file and so it must not be freed by the mesh data
+    newMeshDataExtractedFromFile.vertexData = nullptr;
+    newMeshDataExtractedFromFile.indexData = nullptr;
+    newMeshDataExtractedFromFile.skinningData = nullptr;
+    newMeshDataExtractedFromFile.jointData = nullptr;
+    dataFromFile.Free();
+
+    return result;
+}
+
+// Access
+//-------
+
+bool eae6320::Graphics::cSkinnedMesh::CanBeSkinnedOnGpu() const
+{
+    return m_skeleton.GetJointCount() <= ConstantBufferFormats::maxJointCountForGpuSkinning;
+}
+
+// Implementation
+//===============
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Graphics::cSkinnedMesh::Initialize(const HelperStructs::sMeshData& i_meshData)
+{
+    auto result = Results::success;
+
+    // Skeleton
+    {
+        const auto jointCount = i_meshData.numberOfJoints;
+        std::vector<int32_t> parentIndices(jointCount);
+        std::vector<Animation::sJointPose> bindPose(jointCount);
+        for (uint32_t i = 0; i < jointCount; i++)
+        {
+            const auto& joint = i_meshData.jointData[i];
+            parentIndices[i] = joint.parentIndex;
+            bindPose[i].rotation = Math::cQuaternion(joint.rotation[0], joint.rotation[1], joint.rotation[2], joint.rotation[3]);
+            bindPose[i].translation = Math::sVector(joint.translation[0], joint.translation[1], joint.translation[2]);
+        }
+        if (!((result = m_skeleton.Initialize(parentIndices.data(), bindPose.data(), jointCount))))
+        {
+            EAE6320_ASSERTF(false, "Initialization of the skeleton failed");
+            goto OnExit;
+        }
+    }
+
+    // The vertices are kept for skinning on the CPU
+    m_vertices_bind.assign(i_meshData.vertexData, i_meshData.vertexData + i_meshData.numberOfVertices);
+    m_skinningData.assign(i_meshData.skinningData, i_meshData.skinningData + i_meshData.numberOfVertices);
+    m_numberOfIndices = i_meshData.numberOfIndices;
+    m_type = i_meshData.type;
+
+    if (!((result = InitializePlatformSpecific(i_meshData))))
+    {
+        goto OnExit;
+    }
+
+OnExit:
+
+    return result;
+}
+
+eae6320::Graphics::cSkinnedMesh::~cSkinnedMesh()
+{
+    CleanUp();
+}
@@ -0,0 +1,144 @@
+/*
+A skinned mesh is a mesh whose vertices are moved by the joints of a skeleton
+
+Every vertex is influenced by up to four joints,
+and it can either be skinned on the GPU (using the matrix palette in the per-skinned draw call constant buffer)
+or on the CPU (with the skinned vertices uploaded to a dynamic vertex buffer).
+*/
+
+#ifndef EAE6320_GRAPHICS_CSKINNEDMESH_H
+#define EAE6320_GRAPHICS_CSKINNEDMESH_H
+
+// Include Files
+//==============
+
+#include "Configuration.h"
+#include "MeshHelperStructs.h"
+#include "VertexFormats.h"
+
+#include <Engine/Animation/cSkeleton.h>
+#include <Engine/Assets/cManager.h>
+#include <Engine/Assets/ReferenceCountedAssets.h>
+#include <Engine/Results/Results.h>
+
+#include <vector>
+
+#ifdef EAE6320_PLATFORM_GL
+#include "OpenGL/Includes.h"
+#endif
+
+// Forward Declarations
+//=====================
+
+#if defined( EAE6320_PLATFORM_D3D )
+struct ID3D11Buffer;
+struct ID3D11InputLayout;
+#endif
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        class cSkinnedMesh
+        {
+            // Interface
+            //==========
+
+        public:
+            // Assets
+            //-------
+            using Handle = Assets::cHandle<cSkinnedMesh>;
+            static Assets::cManager<cSkinnedMesh> s_manager;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // The mesh file must have a skeleton
+            static cResult Load(const char* const i_path, cSkinnedMesh*& o_mesh);
+
+            EAE6320_ASSETS_DECLAREDELETEDREFERENCECOUNTEDFUNCTIONS(cSkinnedMesh);
+
+            // Reference Counting
+            //-------------------
+
+            EAE6320_ASSETS_DECLAREREFERENCECOUNTINGFUNCTIONS();
+
+            // Access
+            //-------
+
+            const Animation::cSkeleton& GetSkeleton() const { return m_skeleton; }
+            size_t GetVertexCount() const { return m_vertices_bind.size(); }
+            // The source data for skinning on the CPU
+            const VertexFormats::sMesh* GetBindVertices() const { return m_vertices_bind.data(); }
+            const VertexFormats::sSkinning* GetSkinningData() const { return m_skinningData.data(); }
+            // Only meshes whose joint transforms fit into the per-skinned draw call constant buffer can be skinned on the GPU
+            bool CanBeSkinnedOnGpu() const;
+
+            // Render
+            //-------
+
+            // Draws the mesh using the bind pose vertices
+            // (the vertex shader must skin them with the currently-bound per-skinned draw call constant data)
+            void DrawSkinnedOnGpu() const;
+            // Uploads vertices that were already skinned on the CPU and draws them
+            // (the vertex shader still skins them, and so the per-skinned draw call constant data must be an identity matrix palette).
+            // There must be GetVertexCount() vertices
+            void DrawSkinnedOnCpu(const VertexFormats::sMesh* const i_vertices_skinned) const;
+
+            // Data
+            //=====
+
+        private:
+            Animation::cSkeleton m_skeleton;
+            // Copies of the vertex data are kept in system memory for skinning on the CPU
+            std::vector<VertexFormats::sMesh> m_vertices_bind;
+            std::vector<VertexFormats::sSkinning> m_skinningData;
+            uint32_t m_numberOfIndices = 0;
+#if defined( EAE6320_PLATFORM_D3D )
+            // The vertices in their bind pose (for skinning on the GPU)
+            ID3D11Buffer* m_vertexBuffer_bind = nullptr;
+            // Vertices that were skinned on the CPU are written to this every time that the mesh is drawn
+            // (Direct3D renames the buffer behind the scenes when it is discarded,
+            // and so it can be used for many draw calls in a single frame)
+            ID3D11Buffer* m_vertexBuffer_skinned = nullptr;
+            // The joint indices and weights are in their own stream
+            // so that they can be used with either vertex buffer
+            ID3D11Buffer* m_skinningBuffer = nullptr;
+            ID3D11Buffer* m_indexBuffer = nullptr;
+            // Both ways of skinning use the same input layout
+            static ID3D11InputLayout* ms_vertexInputLayout;
+#elif defined( EAE6320_PLATFORM_GL )
+            // One vertex array uses the bind pose vertices (for skinning on the GPU)
+            // and the other uses vertices that were skinned on the CPU
+            GLuint m_vertexArrayId_bind = 0;
+            GLuint m_vertexArrayId_skinned = 0;
+            GLuint m_vertexBufferId_bind = 0;
+            // Vertices that were skinned on the CPU are written to this every time that the mesh is drawn
+            // (the buffer is orphaned each time so that OpenGL doesn't have to wait for the previous draw call)
+            GLuint m_vertexBufferId_skinned = 0;
+            GLuint m_skinningBufferId = 0;
+            GLuint m_indexBufferId = 0;
+#endif
+            EAE6320_ASSETS_DECLAREREFERENCECOUNT();
+            IndexDataTypes::eType m_type = IndexDataTypes::UNKNOWN;
+
+            // Implementation
+            //===============
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            cSkinnedMesh() = default;
+            ~cSkinnedMesh();
+
+            cResult Initialize(const HelperStructs::sMeshData& i_meshData);
+            cResult InitializePlatformSpecific(const HelperStructs::sMeshData& i_meshData);
+            cResult CleanUp();
+        };
+    }
+}
+
+#endif    // EAE6320_GRAPHICS_CSKINNEDMESH_H
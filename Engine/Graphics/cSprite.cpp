@@ -107,7 +107,7 @@ void eae6320::Graphics::cSprite::GenerateVertexData(const Transform::sRectTransf
             o_vertexData[3].v = HelperStructs::g_defaultMappedUVs.top;
         }
     }
-#if defined( EAE6320_PLATFORM_D3D ) 
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
     std::swap(o_vertexData[1], o_vertexData[2]);
 #endif
 }
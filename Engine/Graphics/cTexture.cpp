@@ -39,6 +39,8 @@ eae6320::cResult eae6320::Graphics::cTexture::Load(const char* const i_path, cTe
 
     Platform::sDataFromFile dataFromFile;
     cTexture* newTexture = nullptr;
+    uintptr_t currentOffset = 0;
+    uintptr_t finalOffset = 0;
 
     // Load the binary data
     {
@@ -52,8 +54,8 @@ eae6320::cResult eae6320::Graphics::cTexture::Load(const char* const i_path, cTe
     }
 
     // Extract data from the file
-    auto currentOffset = reinterpret_cast<uintptr_t>(dataFromFile.data);
-    const auto finalOffset = currentOffset + dataFromFile.size;
+    currentOffset = reinterpret_cast<uintptr_t>(dataFromFile.data);
+    finalOffset = currentOffset + dataFromFile.size;
 
     // The file starts with information about the texture
     {
@@ -11,6 +11,7 @@
 // Include Files
 //==============
 
+#include <cstdint>
 #include <Engine/Results/Results.h>
 #include "ColorFormats.h"
 
@@ -87,11 +88,32 @@ namespace eae6320
             ID3D11RenderTargetView* renderTargetView = nullptr;
             // A depth/stencil view allows a texture to have depth rendered to it
             ID3D11DepthStencilView* depthStencilView = nullptr;
+            // The number of vertical blanks that a buffer swap waits for
+            // (zero means that it doesn't wait)
+            unsigned int syncInterval = 0;
 #elif defined( EAE6320_PLATFORM_GL )
             HDC deviceContext = nullptr;
             HGLRC openGlRenderingContext = nullptr;
             uint16_t resolutionWidth = 0;
             uint16_t resolutionHeight = 0;
+#elif defined( EAE6320_PLATFORM_NULL )
+            // Nothing is actually rendered;
+            // instead the commands that would have been sent to a GPU are counted
+            // so that a headless application can report how much work it submitted
+            struct sCommandCounts
+            {
+                uint64_t frameCount = 0;
+                uint64_t drawCallCount = 0;
+                // The number of vertices (or indices) that the draw calls would have processed
+                uint64_t vertexCount = 0;
+                // Shaders, constant buffers, textures, and render states
+                uint64_t bindCount = 0;
+                // Constant buffer updates and vertices that were skinned on the CPU
+                uint64_t uploadedByteCount = 0;
+            };
+            mutable sCommandCounts commandCounts;
+            uint16_t resolutionWidth = 0;
+            uint16_t resolutionHeight = 0;
 #endif
 
             // Interface
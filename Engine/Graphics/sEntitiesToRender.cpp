@@ -0,0 +1,34 @@
+// Include Files
+//==============
+
+#include "sEntitiesToRender.h"
+
+#include "cMaterial.h"
+#include "cMesh.h"
+
+// Interface
+//==========
+
+// Initialization / Clean Up
+//--------------------------
+
+void eae6320::Graphics::sEntitiesToRender::CleanUp()
+{
+    for (const auto& entity : entities)
+    {
+        entity.mesh->DecrementReferenceCount();
+        entity.material->DecrementReferenceCount();
+    }
+    entities.clear();
+    for (const auto& entity : entities_hierarchy)
+    {
+        entity.mesh->DecrementReferenceCount();
+        entity.material->DecrementReferenceCount();
+    }
+    entities_hierarchy.clear();
+}
+
+eae6320::Graphics::sEntitiesToRender::~sEntitiesToRender()
+{
+    CleanUp();
+}
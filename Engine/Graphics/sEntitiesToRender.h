@@ -0,0 +1,96 @@
+/*
+    This struct holds a copy of everything that is needed to submit the entities of a registry
+    that are inside of a camera's frustum (see Graphics::CullEntities() and Graphics::SubmitEntities())
+
+    Submitting a copy doesn't read the registry or the camera,
+    and so an application can keep one for every frame in flight
+    and cull a frame while the frame before it is submitted and the frame after it is updated
+    (see cbApplication::CanUpdateOverlapPreviousSubmission()).
+
+    Like the data that is submitted to be rendered,
+    a copy owns a reference to every mesh and material in it
+    (and so the entities that they came from can be destroyed before the copy is submitted).
+*/
+
+#ifndef EAE6320_GRAPHICS_SENTITIESTORENDER_H
+#define EAE6320_GRAPHICS_SENTITIESTORENDER_H
+
+// Include Files
+//==============
+
+#include <Engine/Gameobject/cComponentArray.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Transform/sPredictionTransform.h>
+
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        class cMaterial;
+        class cMesh;
+    }
+}
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+    namespace Graphics
+    {
+        struct sEntitiesToRender
+        {
+            // Data
+            //=====
+
+            // An entity that is rendered where its transform component's prediction transform is
+            struct sEntity
+            {
+                cMesh* mesh = nullptr;
+                cMaterial* material = nullptr;
+                Transform::sPredictionTransform predictionTransform;
+            };
+            // An entity that is rendered where its node in the transform hierarchy is
+            struct sEntity_hierarchy
+            {
+                cMesh* mesh = nullptr;
+                cMaterial* material = nullptr;
+                Math::cMatrixTransformation transform_localToWorld;
+            };
+
+            // The camera that the entities were culled with
+            Math::cMatrixTransformation transform_worldToCamera;
+            Math::cMatrixTransformation transform_cameraToProjected;
+            // The entities are in the order of their IDs
+            // so that they are submitted in the same order every frame
+            std::vector<sEntity> entities;
+            std::vector<sEntity_hierarchy> entities_hierarchy;
+            // This is only used while culling
+            // (it is kept so that its memory can be re-used)
+            std::vector<Gameobject::tEntityId> visibleEntities;
+
+            // Interface
+            //==========
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // This releases the references to every mesh and material
+            void CleanUp();
+
+            sEntitiesToRender() = default;
+            ~sEntitiesToRender();
+
+            // A copy would release the same references twice
+            sEntitiesToRender(const sEntitiesToRender&) = delete;
+            sEntitiesToRender& operator =(const sEntitiesToRender&) = delete;
+        };
+    }
+}
+
+#endif    // EAE6320_GRAPHICS_SENTITIESTORENDER_H
@@ -6,6 +6,7 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <Engine/Asserts/Asserts.h>
 #include <fstream>
 #include <sstream>
@@ -15,7 +15,7 @@ namespace eae6320
         // Interface
         //==========
 
-        float ConvertDegreesToRadians( const float i_degrees );
+        constexpr float ConvertDegreesToRadians( const float i_degrees );
         uint16_t ConvertFloatToHalf( const float i_value );
         float ConvertHorizontalFieldOfViewToVerticalFieldOfView( const float i_horizontalFieldOfView_inRadians,
             // aspectRatio = width / height
@@ -27,6 +27,26 @@ namespace eae6320
         // If the multiple is known to be a power-of-2 this is cheaper than the previous function
         template<typename tUnsignedInteger, class EnforceUnsigned = typename std::enable_if<std::is_unsigned<tUnsignedInteger>::value>::type>
             tUnsignedInteger RoundUpToMultiplePowerOf2( const tUnsignedInteger i_value, const tUnsignedInteger i_multipleWhichIsAPowerOf2 );
+
+        // Compile-Time Functions
+        //-----------------------
+
+        // Unlike the <cmath> functions these can be evaluated at compile time
+        // so that transforms that are built from them can be constants.
+        // They calculate with doubles, and so the float versions are as accurate as a float can be
+        // (but they are slower than the <cmath> functions if they are called at run time)
+        namespace Constexpr
+        {
+            constexpr double Sin( const double i_angleInRadians );
+            constexpr float Sin( const float i_angleInRadians );
+            constexpr double Cos( const double i_angleInRadians );
+            constexpr float Cos( const float i_angleInRadians );
+            constexpr double Tan( const double i_angleInRadians );
+            constexpr float Tan( const float i_angleInRadians );
+            // The value must not be negative
+            constexpr double SquareRoot( const double i_value );
+            constexpr float SquareRoot( const float i_value );
+        }
     }
 }
 
@@ -13,7 +13,7 @@
 // Interface
 //==========
 
-inline float eae6320::Math::ConvertDegreesToRadians( const float i_degrees )
+constexpr float eae6320::Math::ConvertDegreesToRadians( const float i_degrees )
 {
     return i_degrees * ( pi / 180.0f );
 }
@@ -48,4 +48,126 @@ template<typename tUnsignedInteger, class EnforceUnsigned>
     return returnValue;
 }
 
+// Compile-Time Functions
+//-----------------------
+
+constexpr double eae6320::Math::Constexpr::Sin( const double i_angleInRadians )
+{
+    constexpr auto pi_double = 3.14159265358979323846;
+    // The angle is reduced to [-pi, pi]
+    auto x = i_angleInRadians;
+    {
+        const auto revolutionCount = x / ( 2.0 * pi_double );
+        const auto revolutionCount_rounded = static_cast<long long>( revolutionCount + ( ( revolutionCount < 0.0 ) ? -0.5 : 0.5 ) );
+        x -= static_cast<double>( revolutionCount_rounded ) * ( 2.0 * pi_double );
+    }
+    // and then to [-pi/2, pi/2] using sin( pi - x ) = sin( x )
+    if ( x > ( 0.5 * pi_double ) )
+    {
+        x = pi_double - x;
+    }
+    else if ( x < ( -0.5 * pi_double ) )
+    {
+        x = -pi_double - x;
+    }
+    // In that range the Taylor series has converged to double precision after 12 terms
+    // (the coefficients are +/-1/n! for odd n)
+    constexpr double coefficients[] =
+    {
+        -0.16666666666666666, 0.008333333333333333, -0.0001984126984126984, 2.7557319223985893e-06,
+        -2.505210838544172e-08, 1.6059043836821613e-10, -7.647163731819816e-13, 2.8114572543455206e-15,
+        -8.22063524662433e-18, 1.9572941063391263e-20, -3.868170170630684e-23
+    };
+    const auto xx = x * x;
+    auto sum = 0.0;
+    for ( auto i = sizeof( coefficients ) / sizeof( coefficients[0] ); i > 0; --i )
+    {
+        sum = ( sum + coefficients[i - 1] ) * xx;
+    }
+    return x + ( x * sum );
+}
+
+constexpr float eae6320::Math::Constexpr::Sin( const float i_angleInRadians )
+{
+    return static_cast<float>( Sin( static_cast<double>( i_angleInRadians ) ) );
+}
+
+constexpr double eae6320::Math::Constexpr::Cos( const double i_angleInRadians )
+{
+    constexpr auto pi_double = 3.14159265358979323846;
+    // The angle is reduced to [-pi, pi]
+    auto x = i_angleInRadians;
+    {
+        const auto revolutionCount = x / ( 2.0 * pi_double );
+        const auto revolutionCount_rounded = static_cast<long long>( revolutionCount + ( ( revolutionCount < 0.0 ) ? -0.5 : 0.5 ) );
+        x -= static_cast<double>( revolutionCount_rounded ) * ( 2.0 * pi_double );
+    }
+    // and then to [0, pi/2] using cos( -x ) = cos( x ) and cos( pi - x ) = -cos( x )
+    if ( x < 0.0 )
+    {
+        x = -x;
+    }
+    auto sign = 1.0;
+    if ( x > ( 0.5 * pi_double ) )
+    {
+        x = pi_double - x;
+        sign = -1.0;
+    }
+    // In that range the Taylor series has converged to double precision after 12 terms
+    // (the coefficients are +/-1/n! for even n)
+    constexpr double coefficients[] =
+    {
+        -0.5, 0.041666666666666664, -0.001388888888888889, 2.48015873015873e-05,
+        -2.755731922398589e-07, 2.08767569878681e-09, -1.1470745597729725e-11, 4.779477332387385e-14,
+        -1.5619206968586225e-16, 4.110317623312165e-19, -8.896791392450574e-22
+    };
+    const auto xx = x * x;
+    auto sum = 0.0;
+    for ( auto i = sizeof( coefficients ) / sizeof( coefficients[0] ); i > 0; --i )
+    {
+        sum = ( sum + coefficients[i - 1] ) * xx;
+    }
+    return sign * ( 1.0 + sum );
+}
+
+constexpr float eae6320::Math::Constexpr::Cos( const float i_angleInRadians )
+{
+    return static_cast<float>( Cos( static_cast<double>( i_angleInRadians ) ) );
+}
+
+constexpr double eae6320::Math::Constexpr::Tan( const double i_angleInRadians )
+{
+    return Sin( i_angleInRadians ) / Cos( i_angleInRadians );
+}
+
+constexpr float eae6320::Math::Constexpr::Tan( const float i_angleInRadians )
+{
+    return static_cast<float>( Tan( static_cast<double>( i_angleInRadians ) ) );
+}
+
+constexpr double eae6320::Math::Constexpr::SquareRoot( const double i_value )
+{
+    if ( i_value <= 0.0 )
+    {
+        return 0.0;
+    }
+    // Starting above the square root Newton's method decreases every iteration
+    // until it reaches the closest double that it can
+    auto guess = ( i_value > 1.0 ) ? i_value : 1.0;
+    while ( true )
+    {
+        const auto nextGuess = 0.5 * ( guess + ( i_value / guess ) );
+        if ( nextGuess >= guess )
+        {
+            return guess;
+        }
+        guess = nextGuess;
+    }
+}
+
+constexpr float eae6320::Math::Constexpr::SquareRoot( const float i_value )
+{
+    return static_cast<float>( SquareRoot( static_cast<double>( i_value ) ) );
+}
+
 #endif    // EAE6320_MATH_FUNCTIONS_INL
\ No newline at end of file
@@ -3,6 +3,23 @@
 
 #include "Half.h"
 
+#include "Simd.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+#if defined( EAE6320_MATH_SIMD_SSE )
+    #include <emmintrin.h>
+    // F16C instructions can be used if the compiler can generate them,
+    // but whether the CPU supports them must be checked at run time
+    #if defined( _MSC_VER ) || defined( __F16C__ )
+        #define EAE6320_MATH_HALF_F16C
+        #include <immintrin.h>
+        #if defined( _MSC_VER )
+            #include <intrin.h>
+        #endif
+    #endif
+#endif
+
 // Static Data Initialization
 //===========================
 
@@ -31,18 +48,43 @@ namespace
     int32_t const maxD = infC - maxC - 1;
     int32_t const minD = minC - subC - 1;
 
-    union
+    // Each conversion uses its own local copies of these
+    // so that the functions can be called from multiple threads at once
+    union uBits
     {
         float m_float;
         int32_t m_signedInteger;
         uint32_t m_unsignedInteger;
-    }v, s;
+    };
 }
 
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+#if defined( EAE6320_MATH_SIMD_SSE )
+    // These are the same branchless algorithms as the scalar functions, 4 values at a time
+    void MakeHalvesFromFloats_sse(const float* const i_values, uint16_t* const o_halves);
+    void MakeFloatsFromHalves_sse(const uint16_t* const i_halves, float* const o_values);
+    // Returns i_mask ? i_new : i_old for each lane
+    // (the same as "old ^= (new ^ old) & mask" in the scalar functions)
+    __m128i Select(const __m128i i_old, const __m128i i_new, const __m128i i_mask);
+#elif defined( EAE6320_MATH_SIMD_NEON )
+    // This is the same branchless algorithm as the scalar function, 4 values at a time
+    void MakeHalvesFromFloats_neon(const float* const i_values, uint16_t* const o_halves);
+#endif
+#if defined( EAE6320_MATH_HALF_F16C )
+    bool IsF16cSupported();
+#endif
+}
+
+// Interface
+//==========
 
 uint16_t eae6320::Math::MakeHalfFromFloat(const float i_value)
 {
-    
+    uBits v, s;
     v.m_float = i_value;
     uint32_t sign = v.m_signedInteger & signN;
     v.m_signedInteger ^= sign;
@@ -55,11 +97,12 @@ uint16_t eae6320::Math::MakeHalfFromFloat(const float i_value)
     v.m_unsignedInteger >>= shift; // logical shift
     v.m_signedInteger ^= ((v.m_signedInteger - maxD) ^ v.m_signedInteger) & -(v.m_signedInteger > maxC);
     v.m_signedInteger ^= ((v.m_signedInteger - minD) ^ v.m_signedInteger) & -(v.m_signedInteger > subC);
-    return v.m_unsignedInteger | sign;
+    return static_cast<uint16_t>(v.m_unsignedInteger | sign);
 }
 
 float eae6320::Math::MakeFloatFromHalf(const uint16_t i_value)
 {
+    uBits v, s;
     v.m_unsignedInteger = i_value;
     auto sign = v.m_signedInteger & signC;
     v.m_signedInteger ^= sign;
@@ -73,4 +116,157 @@ float eae6320::Math::MakeFloatFromHalf(const uint16_t i_value)
     v.m_signedInteger ^= (s.m_signedInteger ^ v.m_signedInteger) & mask;
     v.m_signedInteger |= sign;
     return v.m_float;
-}
\ No newline at end of file
+}
+
+void eae6320::Math::MakeHalvesFromFloats(const float* const i_values, const size_t i_count, uint16_t* const o_halves)
+{
+    EAE6320_ASSERT((i_values && o_halves) || (i_count == 0));
+    size_t i = 0;
+    // Hardware conversion isn't used in this direction
+    // because it rounds to the nearest half and clamps rather than truncating
+#if defined( EAE6320_MATH_SIMD_SSE )
+    for (; (i + 4) <= i_count; i += 4)
+    {
+        MakeHalvesFromFloats_sse(i_values + i, o_halves + i);
+    }
+#elif defined( EAE6320_MATH_SIMD_NEON )
+    for (; (i + 4) <= i_count; i += 4)
+    {
+        MakeHalvesFromFloats_neon(i_values + i, o_halves + i);
+    }
+#endif
+    for (; i < i_count; ++i)
+    {
+        o_halves[i] = MakeHalfFromFloat(i_values[i]);
+    }
+}
+
+void eae6320::Math::MakeFloatsFromHalves(const uint16_t* const i_halves, const size_t i_count, float* const o_values)
+{
+    EAE6320_ASSERT((i_halves && o_values) || (i_count == 0));
+    size_t i = 0;
+    // Every half can be represented exactly as a float,
+    // and so hardware conversion gives the same results as the software conversion
+#if defined( EAE6320_MATH_HALF_F16C )
+    static const auto isF16cSupported = IsF16cSupported();
+    if (isF16cSupported)
+    {
+        for (; (i + 4) <= i_count; i += 4)
+        {
+            const auto halves = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(i_halves + i));
+            _mm_storeu_ps(o_values + i, _mm_cvtph_ps(halves));
+        }
+    }
+#endif
+#if defined( EAE6320_MATH_SIMD_SSE )
+    for (; (i + 4) <= i_count; i += 4)
+    {
+        MakeFloatsFromHalves_sse(i_halves + i, o_values + i);
+    }
+#elif defined( EAE6320_MATH_SIMD_NEON )
+    for (; (i + 4) <= i_count; i += 4)
+    {
+        vst1q_f32(o_values + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i_halves + i))));
+    }
+#endif
+    for (; i < i_count; ++i)
+    {
+        o_values[i] = MakeFloatFromHalf(i_halves[i]);
+    }
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+#if defined( EAE6320_MATH_SIMD_SSE )
+    void MakeHalvesFromFloats_sse(const float* const i_values, uint16_t* const o_halves)
+    {
+        auto v = _mm_castps_si128(_mm_loadu_ps(i_values));
+        auto sign = _mm_and_si128(v, _mm_set1_epi32(signN));
+        v = _mm_xor_si128(v, sign);
+        sign = _mm_srli_epi32(sign, shiftSign);
+        // (a float that is too big to be converted becomes 0x80000000 like the scalar conversion,
+        // but those values are never selected)
+        const auto s = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(_mm_set1_epi32(mulN)), _mm_castsi128_ps(v)));
+        v = Select(v, s, _mm_cmpgt_epi32(_mm_set1_epi32(minN), v));
+        v = Select(v, _mm_set1_epi32(infN), _mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32(infN), v), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxN))));
+        v = Select(v, _mm_set1_epi32(nanN), _mm_and_si128(_mm_cmpgt_epi32(_mm_set1_epi32(nanN), v), _mm_cmpgt_epi32(v, _mm_set1_epi32(infN))));
+        v = _mm_srli_epi32(v, shift);
+        v = Select(v, _mm_sub_epi32(v, _mm_set1_epi32(maxD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxC)));
+        v = Select(v, _mm_sub_epi32(v, _mm_set1_epi32(minD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(subC)));
+        v = _mm_or_si128(v, sign);
+        // SSE2 can only pack with signed saturation,
+        // and so the 16 bits are sign extended first so that they are kept as they are
+        v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(o_halves), _mm_packs_epi32(v, v));
+    }
+
+    void MakeFloatsFromHalves_sse(const uint16_t* const i_halves, float* const o_values)
+    {
+        auto v = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(i_halves)), _mm_setzero_si128());
+        auto sign = _mm_and_si128(v, _mm_set1_epi32(signC));
+        v = _mm_xor_si128(v, sign);
+        sign = _mm_slli_epi32(sign, shiftSign);
+        v = Select(v, _mm_add_epi32(v, _mm_set1_epi32(minD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(subC)));
+        v = Select(v, _mm_add_epi32(v, _mm_set1_epi32(maxD)), _mm_cmpgt_epi32(v, _mm_set1_epi32(maxC)));
+        const auto s = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_mm_set1_epi32(mulC)), _mm_cvtepi32_ps(v)));
+        const auto mask = _mm_cmpgt_epi32(_mm_set1_epi32(norC), v);
+        v = _mm_slli_epi32(v, shift);
+        v = Select(v, s, mask);
+        v = _mm_or_si128(v, sign);
+        _mm_storeu_ps(o_values, _mm_castsi128_ps(v));
+    }
+
+    __m128i Select(const __m128i i_old, const __m128i i_new, const __m128i i_mask)
+    {
+        return _mm_xor_si128(i_old, _mm_and_si128(_mm_xor_si128(i_new, i_old), i_mask));
+    }
+#elif defined( EAE6320_MATH_SIMD_NEON )
+    void MakeHalvesFromFloats_neon(const float* const i_values, uint16_t* const o_halves)
+    {
+        auto v = vreinterpretq_s32_f32(vld1q_f32(i_values));
+        auto sign = vandq_s32(v, vdupq_n_s32(signN));
+        v = veorq_s32(v, sign);
+        sign = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(sign), shiftSign));
+        // (a float that is too big to be converted saturates instead of becoming 0x80000000 like the scalar conversion,
+        // but those values are never selected)
+        const auto s = vcvtq_s32_f32(vmulq_f32(vreinterpretq_f32_s32(vdupq_n_s32(mulN)), vreinterpretq_f32_s32(v)));
+        // vbslq_s32() selects the bits of its second argument where the mask is set
+        v = vbslq_s32(vcltq_s32(v, vdupq_n_s32(minN)), s, v);
+        v = vbslq_s32(vandq_u32(vcltq_s32(v, vdupq_n_s32(infN)), vcgtq_s32(v, vdupq_n_s32(maxN))), vdupq_n_s32(infN), v);
+        v = vbslq_s32(vandq_u32(vcltq_s32(v, vdupq_n_s32(nanN)), vcgtq_s32(v, vdupq_n_s32(infN))), vdupq_n_s32(nanN), v);
+        v = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(v), shift));
+        v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(maxC)), vsubq_s32(v, vdupq_n_s32(maxD)), v);
+        v = vbslq_s32(vcgtq_s32(v, vdupq_n_s32(subC)), vsubq_s32(v, vdupq_n_s32(minD)), v);
+        v = vorrq_s32(v, sign);
+        // Only the low 16 bits of each lane are kept
+        vst1_u16(o_halves, vmovn_u32(vreinterpretq_u32_s32(v)));
+    }
+#endif
+
+#if defined( EAE6320_MATH_HALF_F16C )
+    bool IsF16cSupported()
+    {
+#if defined( _MSC_VER )
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 1);
+        // F16C instructions are VEX encoded,
+        // and so the operating system must also support AVX
+        constexpr int osxsave = 1 << 27;
+        constexpr int avx = 1 << 28;
+        constexpr int f16c = 1 << 29;
+        constexpr int required = osxsave | avx | f16c;
+        if ((cpuInfo[2] & required) != required)
+        {
+            return false;
+        }
+        return (_xgetbv(0) & 0x6) == 0x6;
+#else
+        // The compiler was told that the target CPU supports F16C
+        return true;
+#endif
+    }
+#endif
+}
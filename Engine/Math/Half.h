@@ -1,10 +1,15 @@
 /*
 This file contains representation for a half(half of float)
+
+A float is converted to a half by truncating (i.e. rounding towards zero),
+and floats that are too big to be represented become infinity.
+Every function is safe to call from multiple threads at once.
 */
 
 #ifndef EAE6320_MATH_HALF_H
 #define EAE6320_MATH_HALF_H
 
+#include <cstddef>
 #include <cstdint>
 
 // Class Declaration
@@ -20,7 +25,14 @@ namespace eae6320
 
         uint16_t MakeHalfFromFloat(const float i_value);
         float MakeFloatFromHalf(const uint16_t i_value);
+
+        // These convert whole arrays using SIMD instructions when they are available.
+        // The results are identical to converting each element individually
+        // except that a signaling NaN half may become a quiet NaN float
+        // (hardware conversion from half to float is used when the CPU supports it)
+        void MakeHalvesFromFloats(const float* const i_values, const size_t i_count, uint16_t* const o_halves);
+        void MakeFloatsFromHalves(const uint16_t* const i_halves, const size_t i_count, float* const o_values);
     }
 }
 
-#endif //  EAE6320_MATH_HALF_H
\ No newline at end of file
+#endif //  EAE6320_MATH_HALF_H
@@ -0,0 +1,110 @@
+// Header Files
+//=============
+
+#include "Hash.h"
+
+#include <cstring>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr uint32_t s_prime1 = 2654435761u;
+    constexpr uint32_t s_prime2 = 2246822519u;
+    constexpr uint32_t s_prime3 = 3266489917u;
+    constexpr uint32_t s_prime4 = 668265263u;
+    constexpr uint32_t s_prime5 = 374761393u;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    uint32_t RotateLeft(const uint32_t i_value, const unsigned int i_count);
+    // The data isn't guaranteed to be aligned and so it is copied rather than dereferenced
+    uint32_t ReadUnaligned32(const uint8_t* const i_data);
+    uint32_t Round(const uint32_t i_accumulator, const uint32_t i_input);
+}
+
+// Interface
+//==========
+
+uint32_t eae6320::Math::CalculateXxHash32(const void* const i_data, const size_t i_byteCount, const uint32_t i_seed)
+{
+    auto* currentByte = static_cast<const uint8_t*>(i_data);
+    auto* const endByte = currentByte + i_byteCount;
+
+    uint32_t hash;
+    if (i_byteCount >= 16)
+    {
+        // Four independent lanes each consume 4 bytes of every 16 byte stripe
+        auto* const lastStripe = endByte - 16;
+        auto lane1 = i_seed + s_prime1 + s_prime2;
+        auto lane2 = i_seed + s_prime2;
+        auto lane3 = i_seed + 0;
+        auto lane4 = i_seed - s_prime1;
+        do
+        {
+            lane1 = Round(lane1, ReadUnaligned32(currentByte));
+            lane2 = Round(lane2, ReadUnaligned32(currentByte + 4));
+            lane3 = Round(lane3, ReadUnaligned32(currentByte + 8));
+            lane4 = Round(lane4, ReadUnaligned32(currentByte + 12));
+            currentByte += 16;
+        } while (currentByte <= lastStripe);
+        hash = RotateLeft(lane1, 1) + RotateLeft(lane2, 7) + RotateLeft(lane3, 12) + RotateLeft(lane4, 18);
+    }
+    else
+    {
+        hash = i_seed + s_prime5;
+    }
+    hash += static_cast<uint32_t>(i_byteCount);
+
+    // Consume the remaining bytes that didn't fill a stripe
+    while ((currentByte + 4) <= endByte)
+    {
+        hash += ReadUnaligned32(currentByte) * s_prime3;
+        hash = RotateLeft(hash, 17) * s_prime4;
+        currentByte += 4;
+    }
+    while (currentByte < endByte)
+    {
+        hash += (*currentByte) * s_prime5;
+        hash = RotateLeft(hash, 11) * s_prime1;
+        ++currentByte;
+    }
+
+    // Avalanche
+    hash ^= hash >> 15;
+    hash *= s_prime2;
+    hash ^= hash >> 13;
+    hash *= s_prime3;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    uint32_t RotateLeft(const uint32_t i_value, const unsigned int i_count)
+    {
+        return (i_value << i_count) | (i_value >> (32 - i_count));
+    }
+
+    uint32_t ReadUnaligned32(const uint8_t* const i_data)
+    {
+        // Both of our platforms are little-endian, which is what xxHash expects
+        uint32_t value;
+        memcpy(&value, i_data, sizeof(value));
+        return value;
+    }
+
+    uint32_t Round(const uint32_t i_accumulator, const uint32_t i_input)
+    {
+        return RotateLeft(i_accumulator + (i_input * s_prime2), 13) * s_prime1;
+    }
+}
@@ -0,0 +1,29 @@
+/*
+This file contains non-cryptographic hash functions
+that can be used to checksum data (e.g. to validate binary asset files)
+*/
+
+#ifndef EAE6320_MATH_HASH_H
+#define EAE6320_MATH_HASH_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Math
+    {
+        // Calculates the 32 bit xxHash (XXH32) of the given data.
+        // The result matches the reference implementation
+        // and so files can be verified with any other xxHash tool
+        uint32_t CalculateXxHash32(const void* const i_data, const size_t i_byteCount, const uint32_t i_seed = 0);
+    }
+}
+
+#endif //  EAE6320_MATH_HASH_H
@@ -0,0 +1,475 @@
+// Include Files
+//==============
+
+#include "QuaternionBatch.h"
+
+#include "cMatrix_transformation.h"
+#include "cQuaternion.h"
+#include "Simd.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <initializer_list>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // The kernels are written once in terms of these functions,
+    // which guarantees that every SIMD lane and every leftover element does exactly the same operations
+    using eae6320::Math::Simd::Add;
+    using eae6320::Math::Simd::Subtract;
+    using eae6320::Math::Simd::Multiply;
+    using eae6320::Math::Simd::Divide;
+    using eae6320::Math::Simd::Negate;
+    using eae6320::Math::Simd::SquareRoot;
+    using eae6320::Math::Simd::LessThan;
+    using eae6320::Math::Simd::Select;
+
+    // These splat, load, and store either one element (when tLanes is a float) or four (when tLanes is a SIMD register)
+    template <typename tLanes> tLanes Splat( const float i_value );
+    template <typename tLanes> tLanes Load( const float* const i_values );
+    template <> inline float Splat<float>( const float i_value ) { return i_value; }
+    template <> inline float Load<float>( const float* const i_values ) { return *i_values; }
+    inline void Store( const float i_value, float* const o_values ) { *o_values = i_value; }
+    void Store( const float( &i_transform )[16], float* const o_transform, const size_t i_stride );
+#if defined( EAE6320_MATH_SIMD )
+    template <> inline eae6320::Math::Simd::tFloat4 Splat<eae6320::Math::Simd::tFloat4>( const float i_value )
+    {
+        return eae6320::Math::Simd::Splat( i_value );
+    }
+    template <> inline eae6320::Math::Simd::tFloat4 Load<eae6320::Math::Simd::tFloat4>( const float* const i_values )
+    {
+        return eae6320::Math::Simd::Load( i_values );
+    }
+    using eae6320::Math::Simd::Store;
+    // The transforms of four quaternions are transposed and stored i_stride bytes apart
+    void Store( eae6320::Math::Simd::tFloat4( &io_transforms )[16], float* const o_transform0, const size_t i_stride );
+#endif
+
+    template <typename tLanes>
+    struct sQuaternionLanes
+    {
+        tLanes w, x, y, z;
+    };
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Load( const eae6320::Math::sQuaternionArrays& i_quaternions, const size_t i_index );
+    template <typename tLanes>
+    void Store( const sQuaternionLanes<tLanes>& i_quaternion, eae6320::Math::sQuaternionArrays& o_quaternions, const size_t i_index );
+
+    // Calls i_function( tLanes(), index ) for every index in the range,
+    // first four at a time with SIMD registers and then one at a time with floats for any that are left over
+    template <typename tFunction>
+    void ForEach( const size_t i_first, const size_t i_count, const tFunction& i_function );
+
+    // These are the same calculations as the cQuaternion functions
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Multiply( const sQuaternionLanes<tLanes>& i_lhs, const sQuaternionLanes<tLanes>& i_rhs );
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Normalize( const sQuaternionLanes<tLanes>& i_quaternion );
+    template <typename tLanes>
+    tLanes Dot( const sQuaternionLanes<tLanes>& i_lhs, const sQuaternionLanes<tLanes>& i_rhs );
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Blend( const sQuaternionLanes<tLanes>& i_from, const tLanes i_t_from,
+        const sQuaternionLanes<tLanes>& i_to, const tLanes i_t_to );
+    template <typename tLanes>
+    void CalculateRotationTransform( const sQuaternionLanes<tLanes>& i_quaternion, tLanes( &o_transform )[16] );
+
+    // Approximates sin( i_t * theta ) / sin( theta ) for a cos( theta ) in the range [0, 1]
+    // with a series in terms of cos( theta ) (as described in "A Fast and Accurate Estimate for SLERP" by David Eberly),
+    // which avoids both the trigonometric functions and the division by zero when theta is zero
+    template <typename tLanes>
+    tLanes CalculateSlerpWeight( const tLanes i_t, const tLanes i_cosTheta_minusOne );
+    // Cody-Waite reduction to [-pi/4, pi/4] followed by the minimax polynomials from the Cephes library
+    template <typename tLanes>
+    void CalculateSinCos( const tLanes i_angle, tLanes& o_sin, tLanes& o_cos );
+    // Returns the nearest whole number (the magnitude must be less than 2^22)
+    template <typename tLanes>
+    tLanes Round( const tLanes i_value );
+}
+
+// Interface
+//==========
+
+void eae6320::Math::sQuaternionArrays::Append( const cQuaternion& i_quaternion )
+{
+    w.push_back( i_quaternion.m_w );
+    x.push_back( i_quaternion.m_x );
+    y.push_back( i_quaternion.m_y );
+    z.push_back( i_quaternion.m_z );
+}
+
+eae6320::Math::cQuaternion eae6320::Math::sQuaternionArrays::Get( const size_t i_index ) const
+{
+    EAE6320_ASSERT( i_index < GetCount() );
+    return cQuaternion( w[i_index], x[i_index], y[i_index], z[i_index] );
+}
+
+void eae6320::Math::sQuaternionArrays::Set( const size_t i_index, const cQuaternion& i_quaternion )
+{
+    EAE6320_ASSERT( i_index < GetCount() );
+    w[i_index] = i_quaternion.m_w;
+    x[i_index] = i_quaternion.m_x;
+    y[i_index] = i_quaternion.m_y;
+    z[i_index] = i_quaternion.m_z;
+}
+
+void eae6320::Math::sQuaternionArrays::Resize( const size_t i_count )
+{
+    w.resize( i_count, 1.0f );
+    x.resize( i_count, 0.0f );
+    y.resize( i_count, 0.0f );
+    z.resize( i_count, 0.0f );
+}
+
+void eae6320::Math::sQuaternionArrays::Reserve( const size_t i_count )
+{
+    for ( auto* const components : { &w, &x, &y, &z } )
+    {
+        components->reserve( i_count );
+    }
+}
+
+void eae6320::Math::sQuaternionArrays::Clear()
+{
+    for ( auto* const components : { &w, &x, &y, &z } )
+    {
+        components->clear();
+    }
+}
+
+// Operations
+//-----------
+
+void eae6320::Math::Multiply( const sQuaternionArrays& i_lhs, const sQuaternionArrays& i_rhs, const size_t i_first, const size_t i_count,
+    sQuaternionArrays& o_products )
+{
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_lhs.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_rhs.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= o_products.GetCount() );
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        Store( ::Multiply( Load<tLanes>( i_lhs, i_index ), Load<tLanes>( i_rhs, i_index ) ), o_products, i_index );
+    } );
+}
+
+void eae6320::Math::Normalize( sQuaternionArrays& io_quaternions, const size_t i_first, const size_t i_count )
+{
+    EAE6320_ASSERT( ( i_first + i_count ) <= io_quaternions.GetCount() );
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        Store( ::Normalize( Load<tLanes>( io_quaternions, i_index ) ), io_quaternions, i_index );
+    } );
+}
+
+// Interpolation
+//--------------
+
+void eae6320::Math::Nlerp( const sQuaternionArrays& i_from, const sQuaternionArrays& i_to, const float i_t, const size_t i_first, const size_t i_count,
+    sQuaternionArrays& o_results )
+{
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_from.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_to.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= o_results.GetCount() );
+    const auto t_from = 1.0f - i_t;
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        const auto from = Load<tLanes>( i_from, i_index );
+        const auto to = Load<tLanes>( i_to, i_index );
+        // The destination is negated if it is more than 180 degrees away
+        const auto t = Splat<tLanes>( i_t );
+        const auto t_to = Select( LessThan( ::Dot( from, to ), Splat<tLanes>( 0.0f ) ), Negate( t ), t );
+        Store( ::Normalize( Blend( from, Splat<tLanes>( t_from ), to, t_to ) ), o_results, i_index );
+    } );
+}
+
+void eae6320::Math::Slerp( const sQuaternionArrays& i_from, const sQuaternionArrays& i_to, const float i_t, const size_t i_first, const size_t i_count,
+    sQuaternionArrays& o_results )
+{
+    EAE6320_ASSERT( ( i_t >= 0.0f ) && ( i_t <= 1.0f ) );
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_from.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_to.GetCount() );
+    EAE6320_ASSERT( ( i_first + i_count ) <= o_results.GetCount() );
+    const auto t_from = 1.0f - i_t;
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        const auto from = Load<tLanes>( i_from, i_index );
+        const auto to = Load<tLanes>( i_to, i_index );
+        // The destination is negated if it is more than 180 degrees away
+        const auto cosTheta = ::Dot( from, to );
+        const auto isNegated = LessThan( cosTheta, Splat<tLanes>( 0.0f ) );
+        const auto cosTheta_minusOne = Subtract( Select( isNegated, Negate( cosTheta ), cosTheta ), Splat<tLanes>( 1.0f ) );
+        const auto weight_from = CalculateSlerpWeight( Splat<tLanes>( t_from ), cosTheta_minusOne );
+        const auto weight_to = CalculateSlerpWeight( Splat<tLanes>( i_t ), cosTheta_minusOne );
+        Store( Blend( from, weight_from, to, Select( isNegated, Negate( weight_to ), weight_to ) ), o_results, i_index );
+    } );
+}
+
+// Construction
+//-------------
+
+void eae6320::Math::MakeFromAxisAngles( const float* const i_anglesInRadians,
+    const float* const i_axes_x, const float* const i_axes_y, const float* const i_axes_z,
+    const size_t i_first, const size_t i_count, sQuaternionArrays& o_quaternions )
+{
+    EAE6320_ASSERT( ( i_anglesInRadians && i_axes_x && i_axes_y && i_axes_z ) || ( i_count == 0 ) );
+    EAE6320_ASSERT( ( i_first + i_count ) <= o_quaternions.GetCount() );
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        const auto theta_half = ::Multiply( Load<tLanes>( i_anglesInRadians + i_index ), Splat<tLanes>( 0.5f ) );
+        tLanes sin_theta_half, cos_theta_half;
+        CalculateSinCos( theta_half, sin_theta_half, cos_theta_half );
+        sQuaternionLanes<tLanes> quaternion;
+        quaternion.w = cos_theta_half;
+        quaternion.x = ::Multiply( Load<tLanes>( i_axes_x + i_index ), sin_theta_half );
+        quaternion.y = ::Multiply( Load<tLanes>( i_axes_y + i_index ), sin_theta_half );
+        quaternion.z = ::Multiply( Load<tLanes>( i_axes_z + i_index ), sin_theta_half );
+        Store( quaternion, o_quaternions, i_index );
+    } );
+}
+
+// Conversion
+//-----------
+
+void eae6320::Math::CalculateRotationTransforms( const sQuaternionArrays& i_quaternions, const size_t i_first, const size_t i_count,
+    cMatrixTransformation* const o_transforms, const size_t i_outputStride )
+{
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_quaternions.GetCount() );
+    EAE6320_ASSERT( o_transforms || ( i_count == 0 ) );
+    EAE6320_ASSERT( ( i_count <= 1 ) || ( i_outputStride >= sizeof( cMatrixTransformation ) ) );
+    ForEach( i_first, i_count, [&]( auto i_lanes, const size_t i_index )
+    {
+        using tLanes = decltype( i_lanes );
+        tLanes transform[16];
+        CalculateRotationTransform( Load<tLanes>( i_quaternions, i_index ), transform );
+        // (cMatrixTransformation stores exactly 16 floats)
+        auto* const output = reinterpret_cast<float*>( reinterpret_cast<char*>( o_transforms ) + ( ( i_index - i_first ) * i_outputStride ) );
+        Store( transform, output, i_outputStride );
+    } );
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void Store( const float( &i_transform )[16], float* const o_transform, const size_t )
+    {
+        for ( size_t i = 0; i < 16; ++i )
+        {
+            o_transform[i] = i_transform[i];
+        }
+    }
+
+#if defined( EAE6320_MATH_SIMD )
+    void Store( eae6320::Math::Simd::tFloat4( &io_transforms )[16], float* const o_transform0, const size_t i_stride )
+    {
+        eae6320::Math::Simd::StoreTransposed( io_transforms, o_transform0, i_stride );
+    }
+#endif
+
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Load( const eae6320::Math::sQuaternionArrays& i_quaternions, const size_t i_index )
+    {
+        sQuaternionLanes<tLanes> quaternion;
+        quaternion.w = Load<tLanes>( &i_quaternions.w[i_index] );
+        quaternion.x = Load<tLanes>( &i_quaternions.x[i_index] );
+        quaternion.y = Load<tLanes>( &i_quaternions.y[i_index] );
+        quaternion.z = Load<tLanes>( &i_quaternions.z[i_index] );
+        return quaternion;
+    }
+
+    template <typename tLanes>
+    void Store( const sQuaternionLanes<tLanes>& i_quaternion, eae6320::Math::sQuaternionArrays& o_quaternions, const size_t i_index )
+    {
+        Store( i_quaternion.w, &o_quaternions.w[i_index] );
+        Store( i_quaternion.x, &o_quaternions.x[i_index] );
+        Store( i_quaternion.y, &o_quaternions.y[i_index] );
+        Store( i_quaternion.z, &o_quaternions.z[i_index] );
+    }
+
+    template <typename tFunction>
+    void ForEach( const size_t i_first, const size_t i_count, const tFunction& i_function )
+    {
+        const auto end = i_first + i_count;
+        auto i = i_first;
+#if defined( EAE6320_MATH_SIMD )
+        for ( ; ( i + 4 ) <= end; i += 4 )
+        {
+            i_function( eae6320::Math::Simd::Splat( 0.0f ), i );
+        }
+#endif
+        for ( ; i < end; ++i )
+        {
+            i_function( 0.0f, i );
+        }
+    }
+
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Multiply( const sQuaternionLanes<tLanes>& i_lhs, const sQuaternionLanes<tLanes>& i_rhs )
+    {
+        sQuaternionLanes<tLanes> product;
+        product.w = Subtract( Multiply( i_lhs.w, i_rhs.w ),
+            Add( Add( Multiply( i_lhs.x, i_rhs.x ), Multiply( i_lhs.y, i_rhs.y ) ), Multiply( i_lhs.z, i_rhs.z ) ) );
+        product.x = Add( Add( Multiply( i_lhs.w, i_rhs.x ), Multiply( i_lhs.x, i_rhs.w ) ),
+            Subtract( Multiply( i_lhs.y, i_rhs.z ), Multiply( i_lhs.z, i_rhs.y ) ) );
+        product.y = Add( Add( Multiply( i_lhs.w, i_rhs.y ), Multiply( i_lhs.y, i_rhs.w ) ),
+            Subtract( Multiply( i_lhs.z, i_rhs.x ), Multiply( i_lhs.x, i_rhs.z ) ) );
+        product.z = Add( Add( Multiply( i_lhs.w, i_rhs.z ), Multiply( i_lhs.z, i_rhs.w ) ),
+            Subtract( Multiply( i_lhs.x, i_rhs.y ), Multiply( i_lhs.y, i_rhs.x ) ) );
+        return product;
+    }
+
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Normalize( const sQuaternionLanes<tLanes>& i_quaternion )
+    {
+        const auto length = SquareRoot( Dot( i_quaternion, i_quaternion ) );
+        const auto length_reciprocal = Divide( Splat<tLanes>( 1.0f ), length );
+        sQuaternionLanes<tLanes> normalized;
+        normalized.w = Multiply( i_quaternion.w, length_reciprocal );
+        normalized.x = Multiply( i_quaternion.x, length_reciprocal );
+        normalized.y = Multiply( i_quaternion.y, length_reciprocal );
+        normalized.z = Multiply( i_quaternion.z, length_reciprocal );
+        return normalized;
+    }
+
+    template <typename tLanes>
+    tLanes Dot( const sQuaternionLanes<tLanes>& i_lhs, const sQuaternionLanes<tLanes>& i_rhs )
+    {
+        return Add( Add( Add( Multiply( i_lhs.w, i_rhs.w ), Multiply( i_lhs.x, i_rhs.x ) ),
+            Multiply( i_lhs.y, i_rhs.y ) ), Multiply( i_lhs.z, i_rhs.z ) );
+    }
+
+    template <typename tLanes>
+    sQuaternionLanes<tLanes> Blend( const sQuaternionLanes<tLanes>& i_from, const tLanes i_t_from,
+        const sQuaternionLanes<tLanes>& i_to, const tLanes i_t_to )
+    {
+        sQuaternionLanes<tLanes> result;
+        result.w = Add( Multiply( i_from.w, i_t_from ), Multiply( i_to.w, i_t_to ) );
+        result.x = Add( Multiply( i_from.x, i_t_from ), Multiply( i_to.x, i_t_to ) );
+        result.y = Add( Multiply( i_from.y, i_t_from ), Multiply( i_to.y, i_t_to ) );
+        result.z = Add( Multiply( i_from.z, i_t_from ), Multiply( i_to.z, i_t_to ) );
+        return result;
+    }
+
+    template <typename tLanes>
+    void CalculateRotationTransform( const sQuaternionLanes<tLanes>& i_quaternion, tLanes( &o_transform )[16] )
+    {
+        // This is calculated the same way as the cMatrixTransformation constructor
+        const auto& w = i_quaternion.w;
+        const auto& x = i_quaternion.x;
+        const auto& y = i_quaternion.y;
+        const auto& z = i_quaternion.z;
+        const auto _2x = Add( x, x );
+        const auto _2y = Add( y, y );
+        const auto _2z = Add( z, z );
+        const auto _2xx = Multiply( x, _2x );
+        const auto _2xy = Multiply( _2x, y );
+        const auto _2xz = Multiply( _2x, z );
+        const auto _2xw = Multiply( _2x, w );
+        const auto _2yy = Multiply( _2y, y );
+        const auto _2yz = Multiply( _2y, z );
+        const auto _2yw = Multiply( _2y, w );
+        const auto _2zz = Multiply( _2z, z );
+        const auto _2zw = Multiply( _2z, w );
+        const auto zero = Splat<tLanes>( 0.0f );
+        const auto one = Splat<tLanes>( 1.0f );
+
+        o_transform[0] = Subtract( Subtract( one, _2yy ), _2zz );
+        o_transform[1] = Add( _2xy, _2zw );
+        o_transform[2] = Subtract( _2xz, _2yw );
+        o_transform[3] = zero;
+
+        o_transform[4] = Subtract( _2xy, _2zw );
+        o_transform[5] = Subtract( Subtract( one, _2xx ), _2zz );
+        o_transform[6] = Add( _2yz, _2xw );
+        o_transform[7] = zero;
+
+        o_transform[8] = Add( _2xz, _2yw );
+        o_transform[9] = Subtract( _2yz, _2xw );
+        o_transform[10] = Subtract( Subtract( one, _2xx ), _2yy );
+        o_transform[11] = zero;
+
+        o_transform[12] = zero;
+        o_transform[13] = zero;
+        o_transform[14] = zero;
+        o_transform[15] = one;
+    }
+
+    template <typename tLanes>
+    tLanes CalculateSlerpWeight( const tLanes i_t, const tLanes i_cosTheta_minusOne )
+    {
+        // The series is truncated after 16 terms
+        // and the last term is scaled by mu to minimize the maximum error (which is then about 3e-8)
+        constexpr auto mu = 1.916666f;
+        constexpr size_t termCount = 16;
+        constexpr float u[termCount] =
+        {
+            1.0f / ( 1.0f * 3.0f ), 1.0f / ( 2.0f * 5.0f ), 1.0f / ( 3.0f * 7.0f ), 1.0f / ( 4.0f * 9.0f ),
+            1.0f / ( 5.0f * 11.0f ), 1.0f / ( 6.0f * 13.0f ), 1.0f / ( 7.0f * 15.0f ), 1.0f / ( 8.0f * 17.0f ),
+            1.0f / ( 9.0f * 19.0f ), 1.0f / ( 10.0f * 21.0f ), 1.0f / ( 11.0f * 23.0f ), 1.0f / ( 12.0f * 25.0f ),
+            1.0f / ( 13.0f * 27.0f ), 1.0f / ( 14.0f * 29.0f ), 1.0f / ( 15.0f * 31.0f ), mu / ( 16.0f * 33.0f )
+        };
+        constexpr float v[termCount] =
+        {
+            1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+            5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, 8.0f / 17.0f,
+            9.0f / 19.0f, 10.0f / 21.0f, 11.0f / 23.0f, 12.0f / 25.0f,
+            13.0f / 27.0f, 14.0f / 29.0f, 15.0f / 31.0f, mu * 16.0f / 33.0f
+        };
+        const auto tt = Multiply( i_t, i_t );
+        const auto one = Splat<tLanes>( 1.0f );
+        auto weight = one;
+        for ( size_t i = termCount; i > 0; --i )
+        {
+            const auto b = Multiply( Subtract( Multiply( Splat<tLanes>( u[i - 1] ), tt ), Splat<tLanes>( v[i - 1] ) ), i_cosTheta_minusOne );
+            weight = Add( one, Multiply( b, weight ) );
+        }
+        return Multiply( i_t, weight );
+    }
+
+    template <typename tLanes>
+    void CalculateSinCos( const tLanes i_angle, tLanes& o_sin, tLanes& o_cos )
+    {
+        // The angle is reduced to r + ( quarterTurnCount * pi/2 ).
+        // pi/2 is split into three parts so that the reduction is exact for moderately sized angles
+        const auto quarterTurnCount = Round( Multiply( i_angle, Splat<tLanes>( 0.636619772367581343f ) ) );
+        const auto r = Subtract( Subtract( Subtract( i_angle,
+            Multiply( quarterTurnCount, Splat<tLanes>( 1.5703125f ) ) ),
+            Multiply( quarterTurnCount, Splat<tLanes>( 4.837512969970703125e-4f ) ) ),
+            Multiply( quarterTurnCount, Splat<tLanes>( 7.54978995489188216e-8f ) ) );
+        const auto rr = Multiply( r, r );
+        const auto sin_r = Add( Multiply( Multiply( Subtract( Multiply( Add( Multiply(
+            Splat<tLanes>( -1.9515295891e-4f ), rr ), Splat<tLanes>( 8.3321608736e-3f ) ), rr ), Splat<tLanes>( 1.6666654611e-1f ) ),
+            rr ), r ), r );
+        const auto cos_r = Add( Subtract( Multiply( Multiply( Add( Multiply( Subtract( Multiply(
+            Splat<tLanes>( 2.443315711809948e-5f ), rr ), Splat<tLanes>( 1.388731625493765e-3f ) ), rr ), Splat<tLanes>( 4.166664568298827e-2f ) ),
+            rr ), rr ), Multiply( Splat<tLanes>( 0.5f ), rr ) ), Splat<tLanes>( 1.0f ) );
+        // The quarter turns are split into a quarter turn of -1, 0, or 1 and a whole number of half turns:
+        //    * sin( r +/- pi/2 ) = +/-cos( r ) and cos( r +/- pi/2 ) = -/+sin( r )
+        //    * Each half turn negates both the sine and the cosine
+        const auto two = Splat<tLanes>( 2.0f );
+        const auto half = Splat<tLanes>( 0.5f );
+        const auto quarterTurn = Subtract( quarterTurnCount, Multiply( two, Round( Multiply( quarterTurnCount, half ) ) ) );
+        const auto halfTurnCount = Multiply( Subtract( quarterTurnCount, quarterTurn ), half );
+        const auto halfTurn = Subtract( halfTurnCount, Multiply( two, Round( Multiply( halfTurnCount, half ) ) ) );
+        const auto sign = Subtract( Splat<tLanes>( 1.0f ), Multiply( two, Multiply( halfTurn, halfTurn ) ) );
+        const auto isQuarterTurned = LessThan( half, Multiply( quarterTurn, quarterTurn ) );
+        o_sin = Multiply( Select( isQuarterTurned, Multiply( quarterTurn, cos_r ), sin_r ), sign );
+        o_cos = Multiply( Select( isQuarterTurned, Negate( Multiply( quarterTurn, sin_r ) ), cos_r ), sign );
+    }
+
+    template <typename tLanes>
+    tLanes Round( const tLanes i_value )
+    {
+        // Adding 1.5 * 2^23 pushes every fractional bit out of the mantissa
+        // and the hardware rounds to the nearest whole number
+        const auto rounder = Splat<tLanes>( 12582912.0f );
+        return Subtract( Add( i_value, rounder ), rounder );
+    }
+}
@@ -0,0 +1,113 @@
+/*
+This file contains batch versions of the quaternion operations
+that are needed to integrate and interpolate the orientations of many objects at once
+
+The quaternions are stored as a separate array for each component (i.e. "structure of arrays")
+so that the same component of four quaternions can be loaded into a single SIMD register
+(see TransformBatch.h, which uses the same layout).
+
+Every function operates on the range [i_first, i_first + i_count)
+so that the work for a batch can be split into ranges that are calculated on different threads.
+The outputs must already contain the range (they aren't resized)
+and may be the same arrays as the inputs.
+
+Multiplication, normalization, and nlerp give exactly the same results as the cQuaternion functions.
+Slerp and construction from an axis and angle use polynomial approximations instead of the trigonometric functions;
+their results are within 2e-7 of the exact values (about as close as the cQuaternion functions).
+*/
+
+#ifndef EAE6320_MATH_QUATERNIONBATCH_H
+#define EAE6320_MATH_QUATERNIONBATCH_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Math
+    {
+        class cMatrixTransformation;
+        class cQuaternion;
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Math
+    {
+        // The orientations of many objects
+        struct sQuaternionArrays
+        {
+            // Data
+            //=====
+
+            std::vector<float> w, x, y, z;
+
+            // Interface
+            //==========
+
+            void Append(const cQuaternion& i_quaternion);
+            cQuaternion Get(const size_t i_index) const;
+            void Set(const size_t i_index, const cQuaternion& i_quaternion);
+            size_t GetCount() const { return w.size(); }
+            // New quaternions are the identity
+            void Resize(const size_t i_count);
+            void Reserve(const size_t i_count);
+            // The capacity is kept so that the arrays can be refilled every frame without allocating
+            void Clear();
+        };
+
+        // Operations
+        //-----------
+
+        void Multiply(const sQuaternionArrays& i_lhs, const sQuaternionArrays& i_rhs, const size_t i_first, const size_t i_count,
+            sQuaternionArrays& o_products);
+        // None of the quaternions may have a length of zero
+        void Normalize(sQuaternionArrays& io_quaternions, const size_t i_first, const size_t i_count);
+
+        // Interpolation
+        //--------------
+
+        // Every quaternion is interpolated by the same amount
+        // (e.g. between the previous and current simulation updates when rendering).
+        // Both sets of quaternions must be normalized,
+        // and the interpolation takes the shortest path
+        void Nlerp(const sQuaternionArrays& i_from, const sQuaternionArrays& i_to, const float i_t, const size_t i_first, const size_t i_count,
+            sQuaternionArrays& o_results);
+        // i_t must be in the range [0, 1]
+        void Slerp(const sQuaternionArrays& i_from, const sQuaternionArrays& i_to, const float i_t, const size_t i_first, const size_t i_count,
+            sQuaternionArrays& o_results);
+
+        // Construction
+        //-------------
+
+        // This is the batch version of the cQuaternion( angle, axis ) constructor:
+        //    * Each array has an element for every quaternion in o_quaternions
+        //        (i.e. the range uses the same indices for the inputs and the outputs)
+        //    * The axes must be normalized
+        //    * The angles should be no more than a few thousand radians
+        //        (the error of reducing bigger angles to a single revolution starts to become noticeable)
+        void MakeFromAxisAngles(const float* const i_anglesInRadians,
+            const float* const i_axes_x, const float* const i_axes_y, const float* const i_axes_z,
+            const size_t i_first, const size_t i_count, sQuaternionArrays& o_quaternions);
+
+        // Conversion
+        //-----------
+
+        // Calculates the rotation transforms of the quaternions in the range
+        // (the outputs are laid out the same way as in CalculateTransforms() in TransformBatch.h)
+        void CalculateRotationTransforms(const sQuaternionArrays& i_quaternions, const size_t i_first, const size_t i_count,
+            cMatrixTransformation* const o_transforms, const size_t i_outputStride);
+    }
+}
+
+#endif //  EAE6320_MATH_QUATERNIONBATCH_H
@@ -0,0 +1,242 @@
+/*
+    This file selects the SIMD instruction set that the math library uses
+    and wraps the handful of 4-wide float operations that it needs
+
+    Every operation also has an overload for a single float
+    so that a kernel can be written once as a template and instantiated both for SIMD registers
+    and for the single elements that are left over at the end of an array
+
+    SSE is used when compiling for x86/x64 with SSE2 available (MSVC's default for both platforms)
+    and NEON is used when compiling for ARM.
+    Defining EAE6320_MATH_DISABLE_SIMD forces the scalar implementation.
+
+    The SIMD implementations perform the same operations in the same order as the scalar ones
+    (multiplications and additions are never fused), and so they produce bit-identical results
+*/
+
+#ifndef EAE6320_MATH_SIMD_H
+#define EAE6320_MATH_SIMD_H
+
+// Instruction Set Selection
+//==========================
+
+#if !defined( EAE6320_MATH_DISABLE_SIMD )
+    #if defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) || defined( __SSE2__ )
+        #define EAE6320_MATH_SIMD_SSE
+    #elif defined( _M_ARM ) || defined( _M_ARM64 ) || defined( __ARM_NEON )
+        #define EAE6320_MATH_SIMD_NEON
+    #endif
+#endif
+
+#if defined( EAE6320_MATH_SIMD_SSE ) || defined( EAE6320_MATH_SIMD_NEON )
+    #define EAE6320_MATH_SIMD
+#endif
+
+// Include Files
+//==============
+
+#if defined( EAE6320_MATH_SIMD_SSE )
+    #include <xmmintrin.h>
+#elif defined( EAE6320_MATH_SIMD_NEON )
+    #include <arm_neon.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Math
+    {
+        namespace Simd
+        {
+            // Single Element
+            //---------------
+
+            inline float Add( const float i_lhs, const float i_rhs ) { return i_lhs + i_rhs; }
+            inline float Subtract( const float i_lhs, const float i_rhs ) { return i_lhs - i_rhs; }
+            inline float Multiply( const float i_lhs, const float i_rhs ) { return i_lhs * i_rhs; }
+            inline float Divide( const float i_lhs, const float i_rhs ) { return i_lhs / i_rhs; }
+            inline float Negate( const float i_value ) { return -i_value; }
+            inline float SquareRoot( const float i_value ) { return std::sqrt( i_value ); }
+            inline float Absolute( const float i_value ) { return std::abs( i_value ); }
+
+            inline bool LessThan( const float i_lhs, const float i_rhs ) { return i_lhs < i_rhs; }
+            inline bool LessThanOrEqual( const float i_lhs, const float i_rhs ) { return i_lhs <= i_rhs; }
+            inline bool And( const bool i_lhs, const bool i_rhs ) { return i_lhs && i_rhs; }
+            inline float Select( const bool i_condition, const float i_ifTrue, const float i_ifFalse ) { return i_condition ? i_ifTrue : i_ifFalse; }
+        }
+    }
+}
+
+#if defined( EAE6320_MATH_SIMD )
+
+namespace eae6320
+{
+    namespace Math
+    {
+        namespace Simd
+        {
+            // The loads and stores don't require alignment
+            // (heap allocations aren't guaranteed to be 16 byte aligned on 32-bit Windows)
+            // but they are faster when the data is aligned
+
+#if defined( EAE6320_MATH_SIMD_SSE )
+            using tFloat4 = __m128;
+
+            inline tFloat4 Load( const float* const i_values ) { return _mm_loadu_ps( i_values ); }
+            inline void Store( const tFloat4 i_value, float* const o_values ) { _mm_storeu_ps( o_values, i_value ); }
+            inline tFloat4 Set( const float i_x, const float i_y, const float i_z, const float i_w ) { return _mm_setr_ps( i_x, i_y, i_z, i_w ); }
+            inline tFloat4 Splat( const float i_value ) { return _mm_set1_ps( i_value ); }
+
+            inline tFloat4 Add( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_add_ps( i_lhs, i_rhs ); }
+            inline tFloat4 Subtract( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_sub_ps( i_lhs, i_rhs ); }
+            inline tFloat4 Multiply( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_mul_ps( i_lhs, i_rhs ); }
+            inline tFloat4 Divide( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_div_ps( i_lhs, i_rhs ); }
+            // Negation flips the sign bit (like scalar negation) rather than subtracting from zero
+            inline tFloat4 Negate( const tFloat4 i_value ) { return _mm_xor_ps( i_value, _mm_set1_ps( -0.0f ) ); }
+            inline tFloat4 SquareRoot( const tFloat4 i_value ) { return _mm_sqrt_ps( i_value ); }
+            inline tFloat4 Absolute( const tFloat4 i_value ) { return _mm_andnot_ps( _mm_set1_ps( -0.0f ), i_value ); }
+
+            // Comparisons return a mask with every bit of a lane set if the comparison is true for that lane
+            using tMask4 = __m128;
+            inline tMask4 LessThan( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_cmplt_ps( i_lhs, i_rhs ); }
+            inline tMask4 LessThanOrEqual( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return _mm_cmple_ps( i_lhs, i_rhs ); }
+            inline tMask4 And( const tMask4 i_lhs, const tMask4 i_rhs ) { return _mm_and_ps( i_lhs, i_rhs ); }
+            // Returns a bit for each lane (the first lane is the lowest bit)
+            inline unsigned int GetBits( const tMask4 i_mask ) { return static_cast<unsigned int>( _mm_movemask_ps( i_mask ) ); }
+            inline tFloat4 Select( const tMask4 i_condition, const tFloat4 i_ifTrue, const tFloat4 i_ifFalse )
+            {
+                return _mm_or_ps( _mm_and_ps( i_condition, i_ifTrue ), _mm_andnot_ps( i_condition, i_ifFalse ) );
+            }
+
+            // Loads 4 columns of 4 floats and returns them as 4 rows
+            inline void LoadTransposed( const float* const i_values, tFloat4& o_row0, tFloat4& o_row1, tFloat4& o_row2, tFloat4& o_row3 )
+            {
+                o_row0 = _mm_loadu_ps( i_values );
+                o_row1 = _mm_loadu_ps( i_values + 4 );
+                o_row2 = _mm_loadu_ps( i_values + 8 );
+                o_row3 = _mm_loadu_ps( i_values + 12 );
+                _MM_TRANSPOSE4_PS( o_row0, o_row1, o_row2, o_row3 );
+            }
+            // Swaps the rows and columns of 4 registers
+            inline void Transpose( tFloat4& io_row0, tFloat4& io_row1, tFloat4& io_row2, tFloat4& io_row3 )
+            {
+                _MM_TRANSPOSE4_PS( io_row0, io_row1, io_row2, io_row3 );
+            }
+#elif defined( EAE6320_MATH_SIMD_NEON )
+            using tFloat4 = float32x4_t;
+
+            inline tFloat4 Load( const float* const i_values ) { return vld1q_f32( i_values ); }
+            inline void Store( const tFloat4 i_value, float* const o_values ) { vst1q_f32( o_values, i_value ); }
+            inline tFloat4 Set( const float i_x, const float i_y, const float i_z, const float i_w )
+            {
+                const float values[] = { i_x, i_y, i_z, i_w };
+                return vld1q_f32( values );
+            }
+            inline tFloat4 Splat( const float i_value ) { return vdupq_n_f32( i_value ); }
+
+            // (vmlaq_f32() isn't used because it may be fused into a single instruction)
+            inline tFloat4 Add( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vaddq_f32( i_lhs, i_rhs ); }
+            inline tFloat4 Subtract( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vsubq_f32( i_lhs, i_rhs ); }
+            inline tFloat4 Multiply( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vmulq_f32( i_lhs, i_rhs ); }
+            inline tFloat4 Negate( const tFloat4 i_value ) { return vnegq_f32( i_value ); }
+#if defined( _M_ARM64 ) || defined( __aarch64__ )
+            inline tFloat4 Divide( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vdivq_f32( i_lhs, i_rhs ); }
+            inline tFloat4 SquareRoot( const tFloat4 i_value ) { return vsqrtq_f32( i_value ); }
+#else
+            // 32-bit ARM only has estimates of these,
+            // and so each lane is calculated individually to get the same results as the scalar operations
+            inline tFloat4 Divide( const tFloat4 i_lhs, const tFloat4 i_rhs )
+            {
+                float lhs[4], rhs[4];
+                vst1q_f32( lhs, i_lhs );
+                vst1q_f32( rhs, i_rhs );
+                for ( size_t i = 0; i < 4; ++i )
+                {
+                    lhs[i] /= rhs[i];
+                }
+                return vld1q_f32( lhs );
+            }
+            inline tFloat4 SquareRoot( const tFloat4 i_value )
+            {
+                float values[4];
+                vst1q_f32( values, i_value );
+                for ( size_t i = 0; i < 4; ++i )
+                {
+                    values[i] = std::sqrt( values[i] );
+                }
+                return vld1q_f32( values );
+            }
+#endif
+
+            inline tFloat4 Absolute( const tFloat4 i_value ) { return vabsq_f32( i_value ); }
+
+            // Comparisons return a mask with every bit of a lane set if the comparison is true for that lane
+            using tMask4 = uint32x4_t;
+            inline tMask4 LessThan( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vcltq_f32( i_lhs, i_rhs ); }
+            inline tMask4 LessThanOrEqual( const tFloat4 i_lhs, const tFloat4 i_rhs ) { return vcleq_f32( i_lhs, i_rhs ); }
+            inline tMask4 And( const tMask4 i_lhs, const tMask4 i_rhs ) { return vandq_u32( i_lhs, i_rhs ); }
+            // Returns a bit for each lane (the first lane is the lowest bit)
+            inline unsigned int GetBits( const tMask4 i_mask )
+            {
+                // NEON has no equivalent of SSE's movemask,
+                // and so each lane is reduced to its bit and the lanes are added together
+                const uint32_t laneBits[] = { 1, 2, 4, 8 };
+                const auto bits = vandq_u32( i_mask, vld1q_u32( laneBits ) );
+                const auto sums = vadd_u32( vget_low_u32( bits ), vget_high_u32( bits ) );
+                return vget_lane_u32( vpadd_u32( sums, sums ), 0 );
+            }
+            inline tFloat4 Select( const tMask4 i_condition, const tFloat4 i_ifTrue, const tFloat4 i_ifFalse )
+            {
+                return vbslq_f32( i_condition, i_ifTrue, i_ifFalse );
+            }
+
+            // Loads 4 columns of 4 floats and returns them as 4 rows
+            inline void LoadTransposed( const float* const i_values, tFloat4& o_row0, tFloat4& o_row1, tFloat4& o_row2, tFloat4& o_row3 )
+            {
+                // A de-interleaving load is a transpose
+                const auto rows = vld4q_f32( i_values );
+                o_row0 = rows.val[0];
+                o_row1 = rows.val[1];
+                o_row2 = rows.val[2];
+                o_row3 = rows.val[3];
+            }
+            // Swaps the rows and columns of 4 registers
+            inline void Transpose( tFloat4& io_row0, tFloat4& io_row1, tFloat4& io_row2, tFloat4& io_row3 )
+            {
+                // Transposing each 2x2 block and then swapping the top-right and bottom-left blocks
+                const auto rows01 = vtrnq_f32( io_row0, io_row1 );
+                const auto rows23 = vtrnq_f32( io_row2, io_row3 );
+                io_row0 = vcombine_f32( vget_low_f32( rows01.val[0] ), vget_low_f32( rows23.val[0] ) );
+                io_row1 = vcombine_f32( vget_low_f32( rows01.val[1] ), vget_low_f32( rows23.val[1] ) );
+                io_row2 = vcombine_f32( vget_high_f32( rows01.val[0] ), vget_high_f32( rows23.val[0] ) );
+                io_row3 = vcombine_f32( vget_high_f32( rows01.val[1] ), vget_high_f32( rows23.val[1] ) );
+            }
+#endif
+
+            // Each register holds the same element of 4 different column-major 4x4 matrices;
+            // the registers are transposed and each matrix is stored i_strideInBytes after the previous one
+            inline void StoreTransposed( tFloat4( &io_elements )[16], float* const o_matrix0, const size_t i_strideInBytes )
+            {
+                for ( size_t column = 0; column < 4; ++column )
+                {
+                    auto* const columnElements = io_elements + ( column * 4 );
+                    Transpose( columnElements[0], columnElements[1], columnElements[2], columnElements[3] );
+                    for ( size_t matrix = 0; matrix < 4; ++matrix )
+                    {
+                        Store( columnElements[matrix],
+                            reinterpret_cast<float*>( reinterpret_cast<char*>( o_matrix0 ) + ( matrix * i_strideInBytes ) ) + ( column * 4 ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif    // EAE6320_MATH_SIMD
+
+#endif    // EAE6320_MATH_SIMD_H
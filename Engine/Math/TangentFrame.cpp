@@ -0,0 +1,141 @@
+// Header Files
+//=============
+
+#include "TangentFrame.h"
+
+#include "cQuaternion.h"
+#include "sVector.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr float s_maxPackedValue = 32767.0f;
+    // The smallest w that can still be stored with a sign
+    constexpr float s_bias = 1.0f / s_maxPackedValue;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    int16_t PackComponent(const float i_value);
+}
+
+// Interface
+//==========
+
+void eae6320::Math::PackTangentFrame(const sVector& i_tangent, const sVector& i_bitangent, const sVector& i_normal, int16_t o_packed[4])
+{
+    // Make an orthonormal basis
+    const auto normal = i_normal.GetNormalized();
+    auto tangent = i_tangent - (normal * Dot(normal, i_tangent));
+    if (tangent.Normalize() == 0.0f)
+    {
+        // Any direction perpendicular to the normal is as good as any other
+        tangent = Cross((std::abs(normal.x) < 0.9f) ? sVector::right : sVector::up, normal).GetNormalized();
+    }
+    const auto bitangent = Cross(normal, tangent);
+    const auto isMirrored = Dot(bitangent, i_bitangent) < 0.0f;
+
+    // Convert the rotation matrix whose columns are the basis vectors to a quaternion
+    float w, x, y, z;
+    {
+        const auto trace = tangent.x + bitangent.y + normal.z;
+        if (trace > 0.0f)
+        {
+            const auto s = 0.5f / std::sqrt(trace + 1.0f);
+            w = 0.25f / s;
+            x = (bitangent.z - normal.y) * s;
+            y = (normal.x - tangent.z) * s;
+            z = (tangent.y - bitangent.x) * s;
+        }
+        else if ((tangent.x > bitangent.y) && (tangent.x > normal.z))
+        {
+            const auto s = 2.0f * std::sqrt(1.0f + tangent.x - bitangent.y - normal.z);
+            w = (bitangent.z - normal.y) / s;
+            x = 0.25f * s;
+            y = (bitangent.x + tangent.y) / s;
+            z = (normal.x + tangent.z) / s;
+        }
+        else if (bitangent.y > normal.z)
+        {
+            const auto s = 2.0f * std::sqrt(1.0f + bitangent.y - tangent.x - normal.z);
+            w = (normal.x - tangent.z) / s;
+            x = (bitangent.x + tangent.y) / s;
+            y = 0.25f * s;
+            z = (normal.y + bitangent.z) / s;
+        }
+        else
+        {
+            const auto s = 2.0f * std::sqrt(1.0f + normal.z - tangent.x - bitangent.y);
+            w = (tangent.y - bitangent.x) / s;
+            x = (normal.x + tangent.z) / s;
+            y = (normal.y + bitangent.z) / s;
+            z = 0.25f * s;
+        }
+        const auto length = std::sqrt((w * w) + (x * x) + (y * y) + (z * z));
+        w /= length; x /= length; y /= length; z /= length;
+    }
+    // q and -q are the same rotation, and so w can always be made positive
+    if (w < 0.0f)
+    {
+        w = -w; x = -x; y = -y; z = -z;
+    }
+    // Make sure that w can't be quantized to 0 (which has no sign)
+    if (w < s_bias)
+    {
+        const auto scale = std::sqrt(1.0f - (s_bias * s_bias));
+        w = s_bias;
+        x *= scale; y *= scale; z *= scale;
+    }
+    // The sign of w is the handedness
+    if (isMirrored)
+    {
+        w = -w; x = -x; y = -y; z = -z;
+    }
+
+    o_packed[0] = PackComponent(x);
+    o_packed[1] = PackComponent(y);
+    o_packed[2] = PackComponent(z);
+    o_packed[3] = PackComponent(w);
+}
+
+void eae6320::Math::UnpackTangentFrame(const int16_t i_packed[4], sVector& o_tangent, sVector& o_bitangent, sVector& o_normal)
+{
+    // This must match the decoding in the shaders
+    auto x = std::max(static_cast<float>(i_packed[0]) / s_maxPackedValue, -1.0f);
+    auto y = std::max(static_cast<float>(i_packed[1]) / s_maxPackedValue, -1.0f);
+    auto z = std::max(static_cast<float>(i_packed[2]) / s_maxPackedValue, -1.0f);
+    auto w = std::max(static_cast<float>(i_packed[3]) / s_maxPackedValue, -1.0f);
+    const auto length = std::sqrt((w * w) + (x * x) + (y * y) + (z * z));
+    x /= length; y /= length; z /= length; w /= length;
+
+    o_tangent = sVector(1.0f - (2.0f * ((y * y) + (z * z))), 2.0f * ((x * y) + (w * z)), 2.0f * ((x * z) - (w * y)));
+    o_normal = sVector(2.0f * ((x * z) + (w * y)), 2.0f * ((y * z) - (w * x)), 1.0f - (2.0f * ((x * x) + (y * y))));
+    o_bitangent = Cross(o_normal, o_tangent) * ((w < 0.0f) ? -1.0f : 1.0f);
+}
+
+void eae6320::Math::RotateTangentFrame(const cQuaternion& i_rotation, int16_t io_packed[4])
+{
+    sVector tangent, bitangent, normal;
+    UnpackTangentFrame(io_packed, tangent, bitangent, normal);
+    PackTangentFrame(i_rotation * tangent, i_rotation * bitangent, i_rotation * normal, io_packed);
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    int16_t PackComponent(const float i_value)
+    {
+        const auto clamped = std::min(std::max(i_value, -1.0f), 1.0f);
+        return static_cast<int16_t>(std::lround(clamped * s_maxPackedValue));
+    }
+}
@@ -0,0 +1,48 @@
+/*
+This file contains functions to pack a tangent frame (tangent, bitangent, and normal)
+into a quaternion of four signed normalized 16 bit integers and to unpack it again
+
+The quaternion rotates the +x, +y, and +z axes to the tangent, bitangent, and normal.
+A quaternion can only represent a rotation, and so if the tangent frame is mirrored
+(i.e. the bitangent is the negative of Cross(normal, tangent)) this is stored in the sign of w
+(the quaternion is biased so that w is never 0 and always has a sign).
+*/
+
+#ifndef EAE6320_MATH_TANGENTFRAME_H
+#define EAE6320_MATH_TANGENTFRAME_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Math
+    {
+        class cQuaternion;
+        struct sVector;
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Math
+    {
+        // The tangent is made orthogonal to the normal
+        // and only the handedness of the bitangent is used
+        void PackTangentFrame(const sVector& i_tangent, const sVector& i_bitangent, const sVector& i_normal, int16_t o_packed[4]);
+        void UnpackTangentFrame(const int16_t i_packed[4], sVector& o_tangent, sVector& o_bitangent, sVector& o_normal);
+        // Rotates a packed tangent frame (e.g. when baking an orientation into vertex data)
+        // while keeping its handedness
+        void RotateTangentFrame(const cQuaternion& i_rotation, int16_t io_packed[4]);
+    }
+}
+
+#endif //  EAE6320_MATH_TANGENTFRAME_H
\ No newline at end of file
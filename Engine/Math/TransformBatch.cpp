@@ -0,0 +1,234 @@
+// Include Files
+//==============
+
+#include "TransformBatch.h"
+
+#include "cMatrix_transformation.h"
+#include "cQuaternion.h"
+#include "Simd.h"
+#include "sVector.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <initializer_list>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // The kernel is written once in terms of these functions,
+    // which guarantees that every SIMD lane and every leftover element does exactly the same operations
+    using eae6320::Math::Simd::Add;
+    using eae6320::Math::Simd::Subtract;
+    using eae6320::Math::Simd::Multiply;
+
+    // The matrices are 16 elements in column-major order (see cMatrix_transformation.h).
+    // The orientation is w, x, y, z
+    template <typename tLanes>
+    void CalculateTransforms( const tLanes( &i_position )[3], const tLanes( &i_orientation )[4],
+        const tLanes( &i_transform_worldToProjected )[16], const tLanes i_zero, const tLanes i_one,
+        tLanes( &o_transform_localToWorld )[16], tLanes( &o_transform_localToProjected )[16] );
+
+    float* GetOutput( eae6320::Math::cMatrixTransformation* const i_outputs, const size_t i_index, const size_t i_stride );
+}
+
+// Interface
+//==========
+
+void eae6320::Math::sTransformArrays::Append( const sVector& i_position, const cQuaternion& i_orientation )
+{
+    positions_x.push_back( i_position.x );
+    positions_y.push_back( i_position.y );
+    positions_z.push_back( i_position.z );
+    orientations_w.push_back( i_orientation.m_w );
+    orientations_x.push_back( i_orientation.m_x );
+    orientations_y.push_back( i_orientation.m_y );
+    orientations_z.push_back( i_orientation.m_z );
+}
+
+void eae6320::Math::sTransformArrays::Reserve( const size_t i_count )
+{
+    for ( auto* const components : { &positions_x, &positions_y, &positions_z,
+        &orientations_w, &orientations_x, &orientations_y, &orientations_z } )
+    {
+        components->reserve( i_count );
+    }
+}
+
+void eae6320::Math::sTransformArrays::Clear()
+{
+    for ( auto* const components : { &positions_x, &positions_y, &positions_z,
+        &orientations_w, &orientations_x, &orientations_y, &orientations_z } )
+    {
+        components->clear();
+    }
+}
+
+void eae6320::Math::CalculateTransforms( const sTransformArrays& i_transforms, const size_t i_first, const size_t i_count,
+    const cMatrixTransformation& i_transform_worldToProjected,
+    cMatrixTransformation* const o_transforms_localToWorld, cMatrixTransformation* const o_transforms_localToProjected,
+    const size_t i_outputStride )
+{
+    EAE6320_ASSERT( ( i_first + i_count ) <= i_transforms.GetCount() );
+    EAE6320_ASSERT( ( i_count <= 1 ) || ( i_outputStride >= sizeof( cMatrixTransformation ) ) );
+
+    // (cMatrixTransformation stores exactly 16 floats)
+    const auto& transform_worldToProjected = reinterpret_cast<const float( & )[16]>( i_transform_worldToProjected );
+    size_t i = 0;
+
+#if defined( EAE6320_MATH_SIMD )
+    // Four objects are calculated at a time
+    {
+        Simd::tFloat4 transform_worldToProjected_splat[16];
+        for ( size_t j = 0; j < 16; ++j )
+        {
+            transform_worldToProjected_splat[j] = Simd::Splat( transform_worldToProjected[j] );
+        }
+        const auto zero = Simd::Splat( 0.0f );
+        const auto one = Simd::Splat( 1.0f );
+
+        for ( ; ( i + 4 ) <= i_count; i += 4 )
+        {
+            const auto index = i_first + i;
+            const Simd::tFloat4 position[] =
+            {
+                Simd::Load( &i_transforms.positions_x[index] ),
+                Simd::Load( &i_transforms.positions_y[index] ),
+                Simd::Load( &i_transforms.positions_z[index] )
+            };
+            const Simd::tFloat4 orientation[] =
+            {
+                Simd::Load( &i_transforms.orientations_w[index] ),
+                Simd::Load( &i_transforms.orientations_x[index] ),
+                Simd::Load( &i_transforms.orientations_y[index] ),
+                Simd::Load( &i_transforms.orientations_z[index] )
+            };
+            Simd::tFloat4 transform_localToWorld[16], transform_localToProjected[16];
+            ::CalculateTransforms( position, orientation, transform_worldToProjected_splat, zero, one,
+                transform_localToWorld, transform_localToProjected );
+
+            if ( o_transforms_localToWorld )
+            {
+                Simd::StoreTransposed( transform_localToWorld, GetOutput( o_transforms_localToWorld, i, i_outputStride ), i_outputStride );
+            }
+            if ( o_transforms_localToProjected )
+            {
+                Simd::StoreTransposed( transform_localToProjected, GetOutput( o_transforms_localToProjected, i, i_outputStride ), i_outputStride );
+            }
+        }
+    }
+#endif
+
+    // Any remaining objects are calculated one at a time
+    {
+        for ( ; i < i_count; ++i )
+        {
+            const auto index = i_first + i;
+            const float position[] =
+            {
+                i_transforms.positions_x[index], i_transforms.positions_y[index], i_transforms.positions_z[index]
+            };
+            const float orientation[] =
+            {
+                i_transforms.orientations_w[index], i_transforms.orientations_x[index],
+                i_transforms.orientations_y[index], i_transforms.orientations_z[index]
+            };
+            float transform_localToWorld[16], transform_localToProjected[16];
+            ::CalculateTransforms( position, orientation, transform_worldToProjected, 0.0f, 1.0f,
+                transform_localToWorld, transform_localToProjected );
+
+            if ( o_transforms_localToWorld )
+            {
+                auto* const output = GetOutput( o_transforms_localToWorld, i, i_outputStride );
+                for ( size_t j = 0; j < 16; ++j )
+                {
+                    output[j] = transform_localToWorld[j];
+                }
+            }
+            if ( o_transforms_localToProjected )
+            {
+                auto* const output = GetOutput( o_transforms_localToProjected, i, i_outputStride );
+                for ( size_t j = 0; j < 16; ++j )
+                {
+                    output[j] = transform_localToProjected[j];
+                }
+            }
+        }
+    }
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    template <typename tLanes>
+    void CalculateTransforms( const tLanes( &i_position )[3], const tLanes( &i_orientation )[4],
+        const tLanes( &i_transform_worldToProjected )[16], const tLanes i_zero, const tLanes i_one,
+        tLanes( &o_transform_localToWorld )[16], tLanes( &o_transform_localToProjected )[16] )
+    {
+        // The local-to-world transform is calculated the same way as the cMatrixTransformation constructor
+        {
+            const auto& w = i_orientation[0];
+            const auto& x = i_orientation[1];
+            const auto& y = i_orientation[2];
+            const auto& z = i_orientation[3];
+            const auto _2x = Add( x, x );
+            const auto _2y = Add( y, y );
+            const auto _2z = Add( z, z );
+            const auto _2xx = Multiply( x, _2x );
+            const auto _2xy = Multiply( _2x, y );
+            const auto _2xz = Multiply( _2x, z );
+            const auto _2xw = Multiply( _2x, w );
+            const auto _2yy = Multiply( _2y, y );
+            const auto _2yz = Multiply( _2y, z );
+            const auto _2yw = Multiply( _2y, w );
+            const auto _2zz = Multiply( _2z, z );
+            const auto _2zw = Multiply( _2z, w );
+
+            o_transform_localToWorld[0] = Subtract( Subtract( i_one, _2yy ), _2zz );
+            o_transform_localToWorld[1] = Add( _2xy, _2zw );
+            o_transform_localToWorld[2] = Subtract( _2xz, _2yw );
+            o_transform_localToWorld[3] = i_zero;
+
+            o_transform_localToWorld[4] = Subtract( _2xy, _2zw );
+            o_transform_localToWorld[5] = Subtract( Subtract( i_one, _2xx ), _2zz );
+            o_transform_localToWorld[6] = Add( _2yz, _2xw );
+            o_transform_localToWorld[7] = i_zero;
+
+            o_transform_localToWorld[8] = Add( _2xz, _2yw );
+            o_transform_localToWorld[9] = Subtract( _2yz, _2xw );
+            o_transform_localToWorld[10] = Subtract( Subtract( i_one, _2xx ), _2yy );
+            o_transform_localToWorld[11] = i_zero;
+
+            o_transform_localToWorld[12] = i_position[0];
+            o_transform_localToWorld[13] = i_position[1];
+            o_transform_localToWorld[14] = i_position[2];
+            o_transform_localToWorld[15] = i_one;
+        }
+        // The local-to-world transform is affine,
+        // and so its bottom row doesn't need to be multiplied
+        // (the world-to-projected transform is a general 4x4 matrix)
+        for ( size_t column = 0; column < 4; ++column )
+        {
+            const auto* const localToWorld = o_transform_localToWorld + ( column * 4 );
+            for ( size_t row = 0; row < 4; ++row )
+            {
+                auto element = Add( Add(
+                    Multiply( i_transform_worldToProjected[row], localToWorld[0] ),
+                    Multiply( i_transform_worldToProjected[4 + row], localToWorld[1] ) ),
+                    Multiply( i_transform_worldToProjected[8 + row], localToWorld[2] ) );
+                if ( column == 3 )
+                {
+                    element = Add( element, i_transform_worldToProjected[12 + row] );
+                }
+                o_transform_localToProjected[( column * 4 ) + row] = element;
+            }
+        }
+    }
+
+    float* GetOutput( eae6320::Math::cMatrixTransformation* const i_outputs, const size_t i_index, const size_t i_stride )
+    {
+        return reinterpret_cast<float*>( reinterpret_cast<char*>( i_outputs ) + ( i_index * i_stride ) );
+    }
+}
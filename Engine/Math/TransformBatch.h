@@ -0,0 +1,75 @@
+/*
+This file contains a batch version of calculating the transforms that are needed to draw an object
+(local-to-world and local-to-projected) for many objects at once
+
+The positions and orientations are stored as a separate array for each component (i.e. "structure of arrays")
+so that the same component of several objects can be loaded into a single SIMD register.
+Each SIMD lane then calculates the transforms of a different object
+and the results are transposed back into matrices when they are stored.
+
+The work for a batch can be split into ranges and each range can be calculated on a different thread
+(the arrays are only read and each range writes to different outputs).
+*/
+
+#ifndef EAE6320_MATH_TRANSFORMBATCH_H
+#define EAE6320_MATH_TRANSFORMBATCH_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Math
+    {
+        class cMatrixTransformation;
+        class cQuaternion;
+        struct sVector;
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Math
+    {
+        // The positions and orientations of many objects
+        struct sTransformArrays
+        {
+            // Data
+            //=====
+
+            std::vector<float> positions_x, positions_y, positions_z;
+            std::vector<float> orientations_w, orientations_x, orientations_y, orientations_z;
+
+            // Interface
+            //==========
+
+            void Append(const sVector& i_position, const cQuaternion& i_orientation);
+            size_t GetCount() const { return positions_x.size(); }
+            void Reserve(const size_t i_count);
+            // The capacity is kept so that the arrays can be refilled every frame without allocating
+            void Clear();
+        };
+
+        // Calculates the transforms of the objects in the range [i_first, i_first + i_count).
+        //    * The output pointers point at the outputs of the first object in the range
+        //        and each following object's outputs are i_outputStride bytes after the previous object's
+        //        (this allows them to be written directly into arrays of constant buffer data)
+        //    * Either output can be null if it isn't needed
+        //    * The results only depend on each object's own transform and not on which lane or range it was calculated in
+        void CalculateTransforms(const sTransformArrays& i_transforms, const size_t i_first, const size_t i_count,
+            const cMatrixTransformation& i_transform_worldToProjected,
+            cMatrixTransformation* const o_transforms_localToWorld, cMatrixTransformation* const o_transforms_localToProjected,
+            const size_t i_outputStride);
+    }
+}
+
+#endif //  EAE6320_MATH_TRANSFORMBATCH_H
@@ -3,11 +3,32 @@
 
 #include "cMatrix_transformation.h"
 
-#include "cQuaternion.h"
+#include "Simd.h"
 #include "sVector.h"
+#include "sVector4.h"
 
 #include <cmath>
 
+// Helper Function Declarations
+//=============================
+
+#if defined( EAE6320_MATH_SIMD )
+
+namespace
+{
+    // These add the products in the same order as the scalar implementations
+    // so that the results are identical
+    eae6320::Math::Simd::tFloat4 TransformDirection( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z );
+    eae6320::Math::Simd::tFloat4 TransformPosition( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z );
+    eae6320::Math::Simd::tFloat4 TransformVector4( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z, const float i_w );
+    void LoadColumns( const float* const i_columns, eae6320::Math::Simd::tFloat4( &o_columns )[4] );
+}
+
+#endif
+
 // Interface
 //==========
 
@@ -16,15 +37,51 @@
 
 eae6320::Math::sVector eae6320::Math::cMatrixTransformation::operator *( const sVector& i_rhs ) const
 {
+#if defined( EAE6320_MATH_SIMD )
+    Simd::tFloat4 columns[4];
+    LoadColumns( &m_00, columns );
+    float result[4];
+    Simd::Store( TransformPosition( columns, i_rhs.x, i_rhs.y, i_rhs.z ), result );
+    return sVector( result[0], result[1], result[2] );
+#else
     return sVector(
         ( m_00 * i_rhs.x ) + ( m_01 * i_rhs.y ) + ( m_02 * i_rhs.z ) + m_03,
         ( m_10 * i_rhs.x ) + ( m_11 * i_rhs.y ) + ( m_12 * i_rhs.z ) + m_13,
         ( m_20 * i_rhs.x ) + ( m_21 * i_rhs.y ) + ( m_22 * i_rhs.z ) + m_23
     );
+#endif
+}
+
+eae6320::Math::sVector4 eae6320::Math::cMatrixTransformation::operator *( const sVector4& i_rhs ) const
+{
+#if defined( EAE6320_MATH_SIMD )
+    Simd::tFloat4 columns[4];
+    LoadColumns( &m_00, columns );
+    sVector4 result;
+    Simd::Store( TransformVector4( columns, i_rhs.x, i_rhs.y, i_rhs.z, i_rhs.w ), &result.x );
+    return result;
+#else
+    return sVector4(
+        ( m_00 * i_rhs.x ) + ( m_01 * i_rhs.y ) + ( m_02 * i_rhs.z ) + ( m_03 * i_rhs.w ),
+        ( m_10 * i_rhs.x ) + ( m_11 * i_rhs.y ) + ( m_12 * i_rhs.z ) + ( m_13 * i_rhs.w ),
+        ( m_20 * i_rhs.x ) + ( m_21 * i_rhs.y ) + ( m_22 * i_rhs.z ) + ( m_23 * i_rhs.w ),
+        ( m_30 * i_rhs.x ) + ( m_31 * i_rhs.y ) + ( m_32 * i_rhs.z ) + ( m_33 * i_rhs.w )
+    );
+#endif
 }
 
 eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::operator *( const cMatrixTransformation& i_rhs ) const
 {
+#if defined( EAE6320_MATH_SIMD )
+    Simd::tFloat4 columns[4];
+    LoadColumns( &m_00, columns );
+    cMatrixTransformation result;
+    Simd::Store( TransformVector4( columns, i_rhs.m_00, i_rhs.m_10, i_rhs.m_20, i_rhs.m_30 ), &result.m_00 );
+    Simd::Store( TransformVector4( columns, i_rhs.m_01, i_rhs.m_11, i_rhs.m_21, i_rhs.m_31 ), &result.m_01 );
+    Simd::Store( TransformVector4( columns, i_rhs.m_02, i_rhs.m_12, i_rhs.m_22, i_rhs.m_32 ), &result.m_02 );
+    Simd::Store( TransformVector4( columns, i_rhs.m_03, i_rhs.m_13, i_rhs.m_23, i_rhs.m_33 ), &result.m_03 );
+    return result;
+#else
     return cMatrixTransformation(
         ( m_00 * i_rhs.m_00 ) + ( m_01 * i_rhs.m_10 ) + ( m_02 * i_rhs.m_20 ) + ( m_03 * i_rhs.m_30 ),
         ( m_10 * i_rhs.m_00 ) + ( m_11 * i_rhs.m_10 ) + ( m_12 * i_rhs.m_20 ) + ( m_13 * i_rhs.m_30 ),
@@ -46,12 +103,26 @@ eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::opera
         ( m_20 * i_rhs.m_03 ) + ( m_21 * i_rhs.m_13 ) + ( m_22 * i_rhs.m_23 ) + ( m_23 * i_rhs.m_33 ),
         ( m_30 * i_rhs.m_03 ) + ( m_31 * i_rhs.m_13 ) + ( m_32 * i_rhs.m_23 ) + ( m_33 * i_rhs.m_33 )
     );
+#endif
 }
 
 const eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::ConcatenateAffine(
     const cMatrixTransformation& i_nextTransform, const cMatrixTransformation& i_firstTransform )
 {
     // A few simplifying assumptions can be made for affine transformations vs. general 4x4 matrix multiplication
+#if defined( EAE6320_MATH_SIMD )
+    Simd::tFloat4 columns[4];
+    LoadColumns( &i_nextTransform.m_00, columns );
+    cMatrixTransformation result;
+    Simd::Store( TransformDirection( columns, i_firstTransform.m_00, i_firstTransform.m_10, i_firstTransform.m_20 ), &result.m_00 );
+    Simd::Store( TransformDirection( columns, i_firstTransform.m_01, i_firstTransform.m_11, i_firstTransform.m_21 ), &result.m_01 );
+    Simd::Store( TransformDirection( columns, i_firstTransform.m_02, i_firstTransform.m_12, i_firstTransform.m_22 ), &result.m_02 );
+    Simd::Store( TransformPosition( columns, i_firstTransform.m_03, i_firstTransform.m_13, i_firstTransform.m_23 ), &result.m_03 );
+    // The bottom row of an affine transform is known
+    result.m_30 = result.m_31 = result.m_32 = 0.0f;
+    result.m_33 = 1.0f;
+    return result;
+#else
     return cMatrixTransformation(
         ( i_nextTransform.m_00 * i_firstTransform.m_00 ) + ( i_nextTransform.m_01 * i_firstTransform.m_10 ) + ( i_nextTransform.m_02 * i_firstTransform.m_20 ),
         ( i_nextTransform.m_10 * i_firstTransform.m_00 ) + ( i_nextTransform.m_11 * i_firstTransform.m_10 ) + ( i_nextTransform.m_12 * i_firstTransform.m_20 ),
@@ -73,103 +144,141 @@ const eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation:
         ( i_nextTransform.m_20 * i_firstTransform.m_03 ) + ( i_nextTransform.m_21 * i_firstTransform.m_13 ) + ( i_nextTransform.m_22 * i_firstTransform.m_23 ) + i_nextTransform.m_23,
         1.0f
     );
+#endif
 }
 
-// Camera
-//-------
+// Culling
+//--------
 
-eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateWorldToCameraTransform( const cMatrixTransformation& i_transform_localCameraToWorld )
+bool eae6320::Math::cMatrixTransformation::IsAxisAlignedBoxOutsideOfClipSpace( const sVector& i_minimum, const sVector& i_maximum ) const
 {
-    // Many simplifying assumptions can be made in order to create the inverse
-    // because in our class a camera can only ever have rotation and translation
-    // (i.e. it can't be scaled)
-    return cMatrixTransformation(
-        i_transform_localCameraToWorld.m_00, i_transform_localCameraToWorld.m_01, i_transform_localCameraToWorld.m_02, 0.0f,
-        i_transform_localCameraToWorld.m_10, i_transform_localCameraToWorld.m_11, i_transform_localCameraToWorld.m_12, 0.0f,
-        i_transform_localCameraToWorld.m_20, i_transform_localCameraToWorld.m_21, i_transform_localCameraToWorld.m_22, 0.0f,
+    // Each corner of the box is transformed into clip space
+    // and a bit is set for every plane that the corner is outside of.
+    // If any single bit is set for all eight corners then the whole box is outside of that plane
+    constexpr unsigned int allPlanes = 0x3f;
+    auto planesThatAllCornersAreOutsideOf = allPlanes;
+    for ( unsigned int i = 0; ( i < 8 ) && ( planesThatAllCornersAreOutsideOf != 0 ); ++i )
+    {
+        const auto x = ( i & 1 ) ? i_maximum.x : i_minimum.x;
+        const auto y = ( i & 2 ) ? i_maximum.y : i_minimum.y;
+        const auto z = ( i & 4 ) ? i_maximum.z : i_minimum.z;
 
-        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_00 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_10 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_20 ),
-        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_01 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_11 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_21 ),
-        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_02 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_12 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_22 ),
+        const auto x_clip = ( m_00 * x ) + ( m_01 * y ) + ( m_02 * z ) + m_03;
+        const auto y_clip = ( m_10 * x ) + ( m_11 * y ) + ( m_12 * z ) + m_13;
+        const auto z_clip = ( m_20 * x ) + ( m_21 * y ) + ( m_22 * z ) + m_23;
+        const auto w_clip = ( m_30 * x ) + ( m_31 * y ) + ( m_32 * z ) + m_33;
 
-        1.0f );
+        auto planesThatThisCornerIsOutsideOf = 0u;
+        if ( x_clip < -w_clip ) planesThatThisCornerIsOutsideOf |= 0x01;
+        if ( x_clip > w_clip ) planesThatThisCornerIsOutsideOf |= 0x02;
+        if ( y_clip < -w_clip ) planesThatThisCornerIsOutsideOf |= 0x04;
+        if ( y_clip > w_clip ) planesThatThisCornerIsOutsideOf |= 0x08;
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
+        // Direct3D's projected depth ranges from 0 to w
+        if ( z_clip < 0.0f ) planesThatThisCornerIsOutsideOf |= 0x10;
+#elif defined( EAE6320_PLATFORM_GL )
+        // OpenGL's projected depth ranges from -w to w
+        if ( z_clip < -w_clip ) planesThatThisCornerIsOutsideOf |= 0x10;
+#else
+    #error "No projected depth range exists for this graphics platform"
+#endif
+        if ( z_clip > w_clip ) planesThatThisCornerIsOutsideOf |= 0x20;
+
+        planesThatAllCornersAreOutsideOf &= planesThatThisCornerIsOutsideOf;
+    }
+    return planesThatAllCornersAreOutsideOf != 0;
 }
 
-eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateCameraToProjectedTransformPerspective(
-    const float i_verticalFieldOfView_inRadians,
-    const float i_aspectRatio,
-    const float i_z_nearPlane, const float i_z_farPlane )
+void eae6320::Math::cMatrixTransformation::GetClipSpacePlanes( sVector4( &o_planes )[6] ) const
 {
-    const auto yScale = 1.0f / std::tan( i_verticalFieldOfView_inRadians * 0.5f );
-    const auto xScale = yScale / i_aspectRatio;
-#if defined( EAE6320_PLATFORM_D3D )
-    const auto zDistanceScale = i_z_farPlane / ( i_z_nearPlane - i_z_farPlane );
-    return cMatrixTransformation(
-        xScale, 0.0f, 0.0f, 0.0f,
-        0.0f, yScale, 0.0f, 0.0f,
-        0.0f, 0.0f, zDistanceScale, -1.0f,
-        0.0f, 0.0f, i_z_nearPlane * zDistanceScale, 0.0f );
+    // Each plane is a combination of the rows that calculate x, y, z, and w in clip space
+    // (e.g. a position is inside of the left plane if x_clip >= -w_clip, which is ( row3 + row0 ) * p >= 0)
+    const sVector4 row0( m_00, m_01, m_02, m_03 );
+    const sVector4 row1( m_10, m_11, m_12, m_13 );
+    const sVector4 row2( m_20, m_21, m_22, m_23 );
+    const sVector4 row3( m_30, m_31, m_32, m_33 );
+    o_planes[0] = row3 + row0;
+    o_planes[1] = row3 - row0;
+    o_planes[2] = row3 + row1;
+    o_planes[3] = row3 - row1;
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
+    // Direct3D's projected depth ranges from 0 to w
+    o_planes[4] = row2;
 #elif defined( EAE6320_PLATFORM_GL )
-    const auto zDistanceScale = 1.0f / ( i_z_nearPlane - i_z_farPlane );
-    return cMatrixTransformation(
-        xScale, 0.0f, 0.0f, 0.0f,
-        0.0f, yScale, 0.0f, 0.0f,
-        0.0f, 0.0f, ( i_z_nearPlane + i_z_farPlane ) * zDistanceScale, -1.0f,
-        0.0f, 0.0f, ( 2.0f * i_z_nearPlane * i_z_farPlane ) * zDistanceScale, 0.0f );
+    // OpenGL's projected depth ranges from -w to w
+    o_planes[4] = row3 + row2;
+#else
+    #error "No projected depth range exists for this graphics platform"
 #endif
+    o_planes[5] = row3 - row2;
 }
 
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cMatrixTransformation::cMatrixTransformation( const cQuaternion& i_rotation, const sVector& i_translation )
-    :
-    m_30( 0.0f ), m_31( 0.0f ), m_32( 0.0f ),
-    m_03( i_translation.x ), m_13( i_translation.y ), m_23( i_translation.z ),
-    m_33( 1.0f )
+bool eae6320::Math::cMatrixTransformation::GetClipSpaceCorners( sVector( &o_corners )[8] ) const
 {
-    const auto _2x = i_rotation.m_x + i_rotation.m_x;
-    const auto _2y = i_rotation.m_y + i_rotation.m_y;
-    const auto _2z = i_rotation.m_z + i_rotation.m_z;
-    const auto _2xx = i_rotation.m_x * _2x;
-    const auto _2xy = _2x * i_rotation.m_y;
-    const auto _2xz = _2x * i_rotation.m_z;
-    const auto _2xw = _2x * i_rotation.m_w;
-    const auto _2yy = _2y * i_rotation.m_y;
-    const auto _2yz = _2y * i_rotation.m_z;
-    const auto _2yw = _2y * i_rotation.m_w;
-    const auto _2zz = _2z * i_rotation.m_z;
-    const auto _2zw = _2z * i_rotation.m_w;
-
-    m_00 = 1.0f - _2yy - _2zz;
-    m_01 = _2xy - _2zw;
-    m_02 = _2xz + _2yw;
-
-    m_10 = _2xy + _2zw;
-    m_11 = 1.0f - _2xx - _2zz;
-    m_12 = _2yz - _2xw;
-
-    m_20 = _2xz - _2yw;
-    m_21 = _2yz + _2xw;
-    m_22 = 1.0f - _2xx - _2yy;
+    // Every corner is where three of the clip-space planes meet
+    sVector4 planes[6];
+    GetClipSpacePlanes( planes );
+    for ( unsigned int i = 0; i < 8; ++i )
+    {
+        const auto& plane_x = planes[( i & 1 ) ? 1 : 0];
+        const auto& plane_y = planes[( i & 2 ) ? 3 : 2];
+        const auto& plane_z = planes[( i & 4 ) ? 5 : 4];
+        const auto normal_x = plane_x.GetXYZ();
+        const auto normal_y = plane_y.GetXYZ();
+        const auto normal_z = plane_z.GetXYZ();
+        const auto cross_yz = Cross( normal_y, normal_z );
+        const auto determinant = Dot( normal_x, cross_yz );
+        if ( determinant == 0.0f )
+        {
+            return false;
+        }
+        // The position p where Dot( normal, p ) + w is zero for all three planes
+        const auto corner = ( ( cross_yz * plane_x.w ) + ( Cross( normal_z, normal_x ) * plane_y.w ) + ( Cross( normal_x, normal_y ) * plane_z.w ) )
+            * ( -1.0f / determinant );
+        if ( !std::isfinite( corner.x ) || !std::isfinite( corner.y ) || !std::isfinite( corner.z ) )
+        {
+            return false;
+        }
+        o_corners[i] = corner;
+    }
+    return true;
 }
 
-// Implementation
-//===============
-
-// Initialization / Shut Down
-//---------------------------
-
-eae6320::Math::cMatrixTransformation::cMatrixTransformation(
-    const float i_00, const float i_10, const float i_20, const float i_30,
-    const float i_01, const float i_11, const float i_21, const float i_31,
-    const float i_02, const float i_12, const float i_22, const float i_32,
-    const float i_03, const float i_13, const float i_23, const float i_33 )
-    :
-    m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
-    m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
-    m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
-    m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
+// Helper Function Definitions
+//============================
+
+#if defined( EAE6320_MATH_SIMD )
+
+namespace
 {
+    eae6320::Math::Simd::tFloat4 TransformDirection( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z )
+    {
+        using namespace eae6320::Math::Simd;
+        return Add( Add( Multiply( i_columns[0], Splat( i_x ) ), Multiply( i_columns[1], Splat( i_y ) ) ), Multiply( i_columns[2], Splat( i_z ) ) );
+    }
+
+    eae6320::Math::Simd::tFloat4 TransformPosition( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z )
+    {
+        return eae6320::Math::Simd::Add( TransformDirection( i_columns, i_x, i_y, i_z ), i_columns[3] );
+    }
 
+    eae6320::Math::Simd::tFloat4 TransformVector4( const eae6320::Math::Simd::tFloat4( &i_columns )[4],
+        const float i_x, const float i_y, const float i_z, const float i_w )
+    {
+        using namespace eae6320::Math::Simd;
+        return Add( TransformDirection( i_columns, i_x, i_y, i_z ), Multiply( i_columns[3], Splat( i_w ) ) );
+    }
+
+    void LoadColumns( const float* const i_columns, eae6320::Math::Simd::tFloat4( &o_columns )[4] )
+    {
+        using namespace eae6320::Math::Simd;
+        o_columns[0] = Load( i_columns );
+        o_columns[1] = Load( i_columns + 4 );
+        o_columns[2] = Load( i_columns + 8 );
+        o_columns[3] = Load( i_columns + 12 );
+    }
 }
+
+#endif
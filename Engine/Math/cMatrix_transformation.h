@@ -17,6 +17,12 @@
             * The first vector is right, the second vector is up, and the third vector is back
                 * This is an arbitrary convention, and not necessarily a common one
                     (Maya, for example, has the first vector left and the third vector forward)
+        * Each column is loaded into a single SIMD register when SIMD is available (see Simd.h)
+            * The class isn't declared as 16 byte aligned because 32-bit Windows heap allocations wouldn't honor it
+                (the loads don't require alignment, but they are faster when a matrix happens to be aligned)
+
+    Transforms can be built at compile time (e.g. for static objects and fixed cameras)
+    but the multiplication functions use SIMD instructions and can only be evaluated at run time
 */
 
 #ifndef EAE6320_MATH_CMATRIX_TRANSFORMATION_H
@@ -31,6 +37,7 @@ namespace eae6320
     {
         class cQuaternion;
         struct sVector;
+        struct sVector4;
     }
 }
 
@@ -51,7 +58,9 @@ namespace eae6320
             // Multiplication
             //---------------
 
+            // A 3 element vector is treated as a position (i.e. its translation is applied)
             sVector operator *(const sVector& i_rhs) const;
+            sVector4 operator *(const sVector4& i_rhs) const;
             cMatrixTransformation operator *(const cMatrixTransformation& i_rhs) const;
             // If both transforms are known to be affine
             // (in our class this should be true of everything except camera-to-projected transforms)
@@ -71,13 +80,19 @@ namespace eae6320
             //-------
 
             // A world-to-camera transform (for rendering) can be created by specifying the relative camera data
-            static cMatrixTransformation CreateWorldToCameraTransform(
+            static constexpr cMatrixTransformation CreateWorldToCameraTransform(
                 const cQuaternion& i_cameraOrientation, const sVector& i_cameraPosition);
             // If a camera's local-to-world transform has already been created then it can be specified instead to save calculations
-            static cMatrixTransformation CreateWorldToCameraTransform(const cMatrixTransformation& transform_localCameraToWorld);
+            static constexpr cMatrixTransformation CreateWorldToCameraTransform(const cMatrixTransformation& transform_localCameraToWorld);
+            // A camera can also be specified by where it is and what it is looking at
+            static constexpr cMatrixTransformation CreateWorldToCameraTransformLookAt(
+                const sVector& i_cameraPosition, const sVector& i_targetPosition,
+                // The camera's up direction will be as close to this as possible
+                // (it must not be parallel to the direction that the camera is looking)
+                const sVector& i_upDirection);
 
             // A camera-to-projected transform (for rendering) can be created by specifying the relative data
-            static cMatrixTransformation CreateCameraToProjectedTransformPerspective(
+            static constexpr cMatrixTransformation CreateCameraToProjectedTransformPerspective(
                 // The vertical field of view is the vertical angle of the view frustum (i.e. how wide the camera can see vertically)
                 //    * If you prefer to think in terms of degrees you can use Math::ConvertDegreesToRadians()
                 //    * If you prefer to think in terms of horizontal field of view you can use Math::ConvertHorizontalFieldOfViewToVerticalFieldOfView()
@@ -95,11 +110,30 @@ namespace eae6320
                 //            (i.e. where you don't notice things disappearing when the camera gets far away)
                 const float i_z_nearPlane, const float i_z_farPlane);
 
+            // Culling
+            //--------
+
+            // Returns true if an axis-aligned box (specified in the space that this transform converts from)
+            // is completely on the outside of any one of the clip-space planes.
+            // The test is conservative: a box that isn't rejected might still not be visible
+            bool IsAxisAlignedBoxOutsideOfClipSpace( const sVector& i_minimum, const sVector& i_maximum ) const;
+            // Calculates the planes of clip space (left, right, bottom, top, near, far)
+            // in the space that this transform converts from.
+            // A plane's x, y, and z are its normal (which isn't normalized) and its w is its distance,
+            // and a position p is on the inside of a plane if ( Dot( normal, p ) + w ) >= 0
+            void GetClipSpacePlanes( sVector4( &o_planes )[6] ) const;
+            // Calculates the corners of clip space (i.e. the corners of the view frustum)
+            // in the space that this transform converts from,
+            // which is the same as transforming the corners of the projected cube by the inverse of this transform.
+            // Corner i is on the right if ( i & 1 ), on the top if ( i & 2 ), and on the far plane if ( i & 4 ).
+            // False is returned if the corners aren't finite (e.g. if the far plane is infinitely far away)
+            bool GetClipSpaceCorners( sVector( &o_corners )[8] ) const;
+
             // Initialization / Shut Down
             //---------------------------
 
-            cMatrixTransformation() = default;    // The default constructor creates a a transform with no rotation and no translation
-            cMatrixTransformation(const cQuaternion& i_rotation, const sVector& i_translation);
+            constexpr cMatrixTransformation() = default;    // The default constructor creates a a transform with no rotation and no translation
+            constexpr cMatrixTransformation(const cQuaternion& i_rotation, const sVector& i_translation);
 
             cMatrixTransformation(const cMatrixTransformation&) = default;
             cMatrixTransformation& operator= (const cMatrixTransformation&) = default;
@@ -123,7 +157,7 @@ namespace eae6320
             // Initialization / Shut Down
             //---------------------------
 
-            cMatrixTransformation(
+            constexpr cMatrixTransformation(
                 const float i_00, const float i_10, const float i_20, const float i_30,
                 const float i_01, const float i_11, const float i_21, const float i_31,
                 const float i_02, const float i_12, const float i_22, const float i_32,
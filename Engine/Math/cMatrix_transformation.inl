@@ -6,6 +6,10 @@
 
 // #include "cMatrix_transformation.h"
 
+#include "cQuaternion.h"
+#include "Functions.h"
+#include "sVector.h"
+
 // Interface
 //==========
 
@@ -35,10 +39,125 @@ inline const eae6320::Math::sVector& eae6320::Math::cMatrixTransformation::GetTr
 // Camera
 //-------
 
-inline eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateWorldToCameraTransform(
+constexpr eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateWorldToCameraTransform(
     const cQuaternion& i_cameraOrientation, const sVector& i_cameraPosition )
 {
     return CreateWorldToCameraTransform( cMatrixTransformation( i_cameraOrientation, i_cameraPosition ) );
 }
 
+constexpr eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateWorldToCameraTransform( const cMatrixTransformation& i_transform_localCameraToWorld )
+{
+    // Many simplifying assumptions can be made in order to create the inverse
+    // because in our class a camera can only ever have rotation and translation
+    // (i.e. it can't be scaled)
+    return cMatrixTransformation(
+        i_transform_localCameraToWorld.m_00, i_transform_localCameraToWorld.m_01, i_transform_localCameraToWorld.m_02, 0.0f,
+        i_transform_localCameraToWorld.m_10, i_transform_localCameraToWorld.m_11, i_transform_localCameraToWorld.m_12, 0.0f,
+        i_transform_localCameraToWorld.m_20, i_transform_localCameraToWorld.m_21, i_transform_localCameraToWorld.m_22, 0.0f,
+
+        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_00 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_10 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_20 ),
+        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_01 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_11 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_21 ),
+        -( i_transform_localCameraToWorld.m_03 * i_transform_localCameraToWorld.m_02 ) - ( i_transform_localCameraToWorld.m_13 * i_transform_localCameraToWorld.m_12 ) - ( i_transform_localCameraToWorld.m_23 * i_transform_localCameraToWorld.m_22 ),
+
+        1.0f );
+}
+
+constexpr eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateWorldToCameraTransformLookAt(
+    const sVector& i_cameraPosition, const sVector& i_targetPosition, const sVector& i_upDirection )
+{
+    // A camera looks in the opposite direction of its back vector
+    auto back = i_cameraPosition - i_targetPosition;
+    back *= 1.0f / Constexpr::SquareRoot( Dot( back, back ) );
+    auto right = Cross( i_upDirection, back );
+    right *= 1.0f / Constexpr::SquareRoot( Dot( right, right ) );
+    const auto up = Cross( back, right );
+    // The camera's axes are the rows of the inverse rotation
+    return cMatrixTransformation(
+        right.x, up.x, back.x, 0.0f,
+        right.y, up.y, back.y, 0.0f,
+        right.z, up.z, back.z, 0.0f,
+        -Dot( right, i_cameraPosition ), -Dot( up, i_cameraPosition ), -Dot( back, i_cameraPosition ), 1.0f );
+}
+
+constexpr eae6320::Math::cMatrixTransformation eae6320::Math::cMatrixTransformation::CreateCameraToProjectedTransformPerspective(
+    const float i_verticalFieldOfView_inRadians,
+    const float i_aspectRatio,
+    const float i_z_nearPlane, const float i_z_farPlane )
+{
+    const auto yScale = 1.0f / Constexpr::Tan( i_verticalFieldOfView_inRadians * 0.5f );
+    const auto xScale = yScale / i_aspectRatio;
+#if defined( EAE6320_PLATFORM_D3D ) || defined( EAE6320_PLATFORM_NULL )
+    const auto zDistanceScale = i_z_farPlane / ( i_z_nearPlane - i_z_farPlane );
+    return cMatrixTransformation(
+        xScale, 0.0f, 0.0f, 0.0f,
+        0.0f, yScale, 0.0f, 0.0f,
+        0.0f, 0.0f, zDistanceScale, -1.0f,
+        0.0f, 0.0f, i_z_nearPlane * zDistanceScale, 0.0f );
+#elif defined( EAE6320_PLATFORM_GL )
+    const auto zDistanceScale = 1.0f / ( i_z_nearPlane - i_z_farPlane );
+    return cMatrixTransformation(
+        xScale, 0.0f, 0.0f, 0.0f,
+        0.0f, yScale, 0.0f, 0.0f,
+        0.0f, 0.0f, ( i_z_nearPlane + i_z_farPlane ) * zDistanceScale, -1.0f,
+        0.0f, 0.0f, ( 2.0f * i_z_nearPlane * i_z_farPlane ) * zDistanceScale, 0.0f );
+#else
+    #error "No projected depth range exists for this graphics platform"
+#endif
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrixTransformation::cMatrixTransformation( const cQuaternion& i_rotation, const sVector& i_translation )
+    :
+    m_30( 0.0f ), m_31( 0.0f ), m_32( 0.0f ),
+    m_03( i_translation.x ), m_13( i_translation.y ), m_23( i_translation.z ),
+    m_33( 1.0f )
+{
+    const auto _2x = i_rotation.m_x + i_rotation.m_x;
+    const auto _2y = i_rotation.m_y + i_rotation.m_y;
+    const auto _2z = i_rotation.m_z + i_rotation.m_z;
+    const auto _2xx = i_rotation.m_x * _2x;
+    const auto _2xy = _2x * i_rotation.m_y;
+    const auto _2xz = _2x * i_rotation.m_z;
+    const auto _2xw = _2x * i_rotation.m_w;
+    const auto _2yy = _2y * i_rotation.m_y;
+    const auto _2yz = _2y * i_rotation.m_z;
+    const auto _2yw = _2y * i_rotation.m_w;
+    const auto _2zz = _2z * i_rotation.m_z;
+    const auto _2zw = _2z * i_rotation.m_w;
+
+    m_00 = 1.0f - _2yy - _2zz;
+    m_01 = _2xy - _2zw;
+    m_02 = _2xz + _2yw;
+
+    m_10 = _2xy + _2zw;
+    m_11 = 1.0f - _2xx - _2zz;
+    m_12 = _2yz - _2xw;
+
+    m_20 = _2xz - _2yw;
+    m_21 = _2yz + _2xw;
+    m_22 = 1.0f - _2xx - _2yy;
+}
+
+// Implementation
+//===============
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::cMatrixTransformation::cMatrixTransformation(
+    const float i_00, const float i_10, const float i_20, const float i_30,
+    const float i_01, const float i_11, const float i_21, const float i_31,
+    const float i_02, const float i_12, const float i_22, const float i_32,
+    const float i_03, const float i_13, const float i_23, const float i_33 )
+    :
+    m_00( i_00 ), m_10( i_10 ), m_20( i_20 ), m_30( i_30 ),
+    m_01( i_01 ), m_11( i_11 ), m_21( i_21 ), m_31( i_31 ),
+    m_02( i_02 ), m_12( i_12 ), m_22( i_22 ), m_32( i_32 ),
+    m_03( i_03 ), m_13( i_13 ), m_23( i_23 ), m_33( i_33 )
+{
+
+}
+
 #endif    // EAE6320_MATH_CMATRIX_TRANSFORMATION_INL
@@ -1,5 +1,7 @@
 /*
     This class represents a rotation or an orientation
+
+    Everything except normalization and interpolation can be evaluated at compile time
 */
 
 #ifndef EAE6320_MATH_CQUATERNION_H
@@ -33,18 +35,18 @@ namespace eae6320
             // RotateVector
             //-------------
 
-            sVector operator *(const sVector& i_rhs) const;
+            constexpr sVector operator *(const sVector& i_rhs) const;
 
             // Multiplication
             //---------------
 
-            cQuaternion operator *( const cQuaternion& i_rhs ) const;
+            constexpr cQuaternion operator *( const cQuaternion& i_rhs ) const;
 
             // Inversion
             //----------
 
-            void Invert();
-            cQuaternion GetInverse() const;
+            constexpr void Invert();
+            constexpr cQuaternion GetInverse() const;
 
             // Normalization
             //--------------
@@ -55,7 +57,17 @@ namespace eae6320
             // Products
             //---------
 
-            friend float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+            friend constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+
+            // Interpolation
+            //--------------
+
+            // Both quaternions must be normalized.
+            // The interpolation takes the shortest path
+            // (if the quaternions are more than 180 degrees apart the destination is negated).
+            // Nlerp() is cheaper but its speed of rotation isn't constant
+            friend cQuaternion Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+            friend cQuaternion Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
 
             // Access
             //-------
@@ -63,14 +75,19 @@ namespace eae6320
             // Calculating the forward direction involves a variation of calculating a full transformation matrix;
             // if the transform is already available or will need to be calculated in the future
             // it is more efficient to extract the forward direction from that
-            sVector CalculateForwardDirection() const;
+            constexpr sVector CalculateForwardDirection() const;
 
             // Initialization / Shut Down
             //---------------------------
 
-            cQuaternion() = default;    // Identity
-            cQuaternion( const float i_angleInRadians,    // A positive angle rotates counter-clockwise (right-handed) around the axis
+            constexpr cQuaternion() = default;    // Identity
+            // (this uses the compile-time trigonometric functions in Functions.h;
+            // the batch functions in QuaternionBatch.h are much faster for many orientations at run time)
+            constexpr cQuaternion( const float i_angleInRadians,    // A positive angle rotates counter-clockwise (right-handed) around the axis
                 const sVector& i_axisOfRotation_normalized );
+            // The components must already be normalized
+            // (this is meant for orientations that were stored as data, e.g. in a skeleton)
+            constexpr cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
 
             // Data
             //=====
@@ -82,19 +99,19 @@ namespace eae6320
             float m_y = 0.0f;
             float m_z = 0.0f;
 
-            // Implementation
-            //===============
-
-            // Initialization / Shut Down
-            //---------------------------
-
-            cQuaternion( const float i_w, const float i_x, const float i_y, const float i_z );
-
             // Friends
             //========
 
             friend class cMatrixTransformation;
+            friend struct sQuaternionArrays;
+            friend struct sTransformArrays;
         };
+
+        // The friend functions are also declared here in the namespace
+        // (a friend declaration alone doesn't make them visible outside of the class)
+        constexpr float Dot( const cQuaternion& i_lhs, const cQuaternion& i_rhs );
+        cQuaternion Nlerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
+        cQuaternion Slerp( const cQuaternion& i_from, const cQuaternion& i_to, const float i_t );
     }
 }
 
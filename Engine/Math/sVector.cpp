@@ -18,74 +18,21 @@ namespace eae6320
 {
     namespace Math
     {
-        sVector const sVector::right(1.0f, 0.0f, 0.0f);
-        sVector const sVector::up(0.0f, 1.0f, 0.0f);
-        sVector const sVector::forward(0.0f, 0.0f, 1.0f);
+        constexpr sVector sVector::right(1.0f, 0.0f, 0.0f);
+        constexpr sVector sVector::up(0.0f, 1.0f, 0.0f);
+        constexpr sVector sVector::forward(0.0f, 0.0f, 1.0f);
 
-        sVector const sVector::left(-1.0f, 0.0f, 0.0f);
-        sVector const sVector::down(0.0f, -1.0f, 0.0f);
-        sVector const sVector::back(0.0f, 0.0f, -1.0f);
+        constexpr sVector sVector::left(-1.0f, 0.0f, 0.0f);
+        constexpr sVector sVector::down(0.0f, -1.0f, 0.0f);
+        constexpr sVector sVector::back(0.0f, 0.0f, -1.0f);
 
-        sVector const sVector::zero(0.0f, 0.0f, 0.0f);
+        constexpr sVector sVector::zero(0.0f, 0.0f, 0.0f);
     }
 }
 
 // Interface
 //==========
 
-// Addition
-//---------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator +(const sVector& i_rhs) const
-{
-    return sVector(x + i_rhs.x, y + i_rhs.y, z + i_rhs.z);
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator +=(const sVector& i_rhs)
-{
-    x += i_rhs.x;
-    y += i_rhs.y;
-    z += i_rhs.z;
-    return *this;
-}
-
-// Subtraction / Negation
-//-----------------------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator -(const sVector& i_rhs) const
-{
-    return sVector(x - i_rhs.x, y - i_rhs.y, z - i_rhs.z);
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator -=(const sVector& i_rhs)
-{
-    x -= i_rhs.x;
-    y -= i_rhs.y;
-    z -= i_rhs.z;
-    return *this;
-}
-
-eae6320::Math::sVector eae6320::Math::sVector::operator -() const
-{
-    return sVector(-x, -y, -z);
-}
-
-// Multiplication
-//---------------
-
-eae6320::Math::sVector eae6320::Math::sVector::operator *(const float i_rhs) const
-{
-    return sVector(x * i_rhs, y * i_rhs, z * i_rhs);
-}
-
-eae6320::Math::sVector& eae6320::Math::sVector::operator *=(const float i_rhs)
-{
-    x *= i_rhs;
-    y *= i_rhs;
-    z *= i_rhs;
-    return *this;
-}
-
 // Division
 //---------
 
@@ -137,35 +84,3 @@ eae6320::Math::sVector eae6320::Math::sVector::GetNormalized() const
     }
     return zero;
 }
-
-// Comparison
-//-----------
-
-bool eae6320::Math::sVector::operator ==(const sVector& i_rhs) const
-{
-    // Use & rather than && to prevent branches (all three comparisons will be evaluated)
-    return (x == i_rhs.x) & (y == i_rhs.y) & (z == i_rhs.z);
-}
-
-bool eae6320::Math::sVector::operator !=(const sVector& i_rhs) const
-{
-    // Use | rather than || to prevent branches (all three comparisons will be evaluated)
-    return (x != i_rhs.x) | (y != i_rhs.y) | (z != i_rhs.z);
-}
-
-// Products
-//---------
-
-float eae6320::Math::Dot(const sVector& i_lhs, const sVector& i_rhs)
-{
-    return (i_lhs.x * i_rhs.x) + (i_lhs.y * i_rhs.y) + (i_lhs.z * i_rhs.z);
-}
-
-eae6320::Math::sVector eae6320::Math::Cross(const sVector& i_lhs, const sVector& i_rhs)
-{
-    return sVector(
-        (i_lhs.y * i_rhs.z) - (i_lhs.z * i_rhs.y),
-        (i_lhs.z * i_rhs.x) - (i_lhs.x * i_rhs.z),
-        (i_lhs.x * i_rhs.y) - (i_lhs.y * i_rhs.x)
-    );
-}
@@ -1,5 +1,11 @@
 /*
     This struct represents a position or direction
+
+    It is tightly packed (12 bytes) and so its operators are scalar;
+    see sVector4 for a type that can be operated on with SIMD instructions
+
+    Everything except division, length, and normalization can be evaluated at compile time
+    (see Math::Constexpr in Functions.h for a square root that can be)
 */
 
 #ifndef EAE6320_MATH_SVECTOR_H
@@ -22,6 +28,9 @@ namespace eae6320
             // Static Data Declaration
             //========================
 
+            // These are defined as constant expressions,
+            // and so they are initialized before any dynamic initialization that might use them
+
             static sVector const right;
             static sVector const up;
             static sVector const forward;
@@ -38,22 +47,22 @@ namespace eae6320
             // Addition
             //---------
 
-            sVector operator +( const sVector& i_rhs ) const;
-            sVector& operator +=( const sVector& i_rhs );
+            constexpr sVector operator +( const sVector& i_rhs ) const;
+            constexpr sVector& operator +=( const sVector& i_rhs );
 
             // Subtraction / Negation
             //-----------------------
 
-            sVector operator -( const sVector& i_rhs ) const;
-            sVector& operator -=( const sVector& i_rhs );
-            sVector operator -() const;
+            constexpr sVector operator -( const sVector& i_rhs ) const;
+            constexpr sVector& operator -=( const sVector& i_rhs );
+            constexpr sVector operator -() const;
 
             // Multiplication
             //---------------
 
-            sVector operator *( const float i_rhs ) const;
-            sVector& operator *=( const float i_rhs );
-            friend sVector operator *( const float i_lhs, const sVector& i_rhs );
+            constexpr sVector operator *( const float i_rhs ) const;
+            constexpr sVector& operator *=( const float i_rhs );
+            friend constexpr sVector operator *( const float i_lhs, const sVector& i_rhs );
 
             // Division
             //---------
@@ -71,21 +80,27 @@ namespace eae6320
             // Products
             //---------
 
-            friend float Dot( const sVector& i_lhs, const sVector& i_rhs );
-            friend sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
+            friend constexpr float Dot( const sVector& i_lhs, const sVector& i_rhs );
+            friend constexpr sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
 
             // Comparison
             //-----------
 
-            bool operator ==( const sVector& i_rhs ) const;
-            bool operator !=( const sVector& i_rhs ) const;
+            constexpr bool operator ==( const sVector& i_rhs ) const;
+            constexpr bool operator !=( const sVector& i_rhs ) const;
 
             // Initialization / Shut Down
             //---------------------------
 
-            sVector() = default;
-            sVector( const float i_x, const float i_y, const float i_z );
+            constexpr sVector() = default;
+            constexpr sVector( const float i_x, const float i_y, const float i_z );
         };
+
+        // The friend functions are also declared here in the namespace
+        // (a friend declaration alone doesn't make them visible outside of the struct)
+        constexpr sVector operator *( const float i_lhs, const sVector& i_rhs );
+        constexpr float Dot( const sVector& i_lhs, const sVector& i_rhs );
+        constexpr sVector Cross( const sVector& i_lhs, const sVector& i_rhs );
     }
 }
 
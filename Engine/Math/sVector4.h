@@ -0,0 +1,95 @@
+/*
+    This struct represents a homogeneous position or direction
+    (or any other 4 floats that should be operated on together)
+
+    Unlike sVector it is 16 bytes and 16 byte aligned
+    so that it can be operated on with a single SIMD register
+    (on 32-bit Windows that alignment isn't guaranteed for heap allocations,
+    and so the SIMD loads don't require it)
+*/
+
+#ifndef EAE6320_MATH_SVECTOR4_H
+#define EAE6320_MATH_SVECTOR4_H
+
+// Include Files
+//==============
+
+#include "sVector.h"
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+    namespace Math
+    {
+        struct alignas( 16 ) sVector4
+        {
+            // Data
+            //=====
+
+            float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f;
+
+            // Interface
+            //==========
+
+            // Addition
+            //---------
+
+            sVector4 operator +( const sVector4& i_rhs ) const;
+            sVector4& operator +=( const sVector4& i_rhs );
+
+            // Subtraction / Negation
+            //-----------------------
+
+            sVector4 operator -( const sVector4& i_rhs ) const;
+            sVector4& operator -=( const sVector4& i_rhs );
+            sVector4 operator -() const;
+
+            // Multiplication
+            //---------------
+
+            sVector4 operator *( const float i_rhs ) const;
+            sVector4& operator *=( const float i_rhs );
+            // Component-wise
+            sVector4 operator *( const sVector4& i_rhs ) const;
+
+            // Division
+            //---------
+
+            sVector4 operator /( const float i_rhs ) const;
+
+            // Products
+            //---------
+
+            friend float Dot( const sVector4& i_lhs, const sVector4& i_rhs );
+
+            // Comparison
+            //-----------
+
+            bool operator ==( const sVector4& i_rhs ) const;
+            bool operator !=( const sVector4& i_rhs ) const;
+
+            // Access
+            //-------
+
+            sVector GetXYZ() const;
+
+            // Initialization / Shut Down
+            //---------------------------
+
+            constexpr sVector4() = default;
+            constexpr sVector4( const float i_x, const float i_y, const float i_z, const float i_w );
+            // A position should have a w of 1 and a direction should have a w of 0
+            constexpr sVector4( const sVector& i_xyz, const float i_w );
+        };
+
+        // The friend function is also declared here in the namespace
+        // (a friend declaration alone doesn't make it visible outside of the struct)
+        float Dot( const sVector4& i_lhs, const sVector4& i_rhs );
+    }
+}
+
+#include "sVector4.inl"
+
+#endif    // EAE6320_MATH_SVECTOR4_H
@@ -0,0 +1,155 @@
+#ifndef EAE6320_MATH_SVECTOR4_INL
+#define EAE6320_MATH_SVECTOR4_INL
+
+// Include Files
+//==============
+
+// #include "sVector4.h"
+
+#include "Simd.h"
+
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+// Addition
+//---------
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator +( const sVector4& i_rhs ) const
+{
+#if defined( EAE6320_MATH_SIMD )
+    sVector4 result;
+    Simd::Store( Simd::Add( Simd::Load( &x ), Simd::Load( &i_rhs.x ) ), &result.x );
+    return result;
+#else
+    return sVector4( x + i_rhs.x, y + i_rhs.y, z + i_rhs.z, w + i_rhs.w );
+#endif
+}
+
+inline eae6320::Math::sVector4& eae6320::Math::sVector4::operator +=( const sVector4& i_rhs )
+{
+    return *this = *this + i_rhs;
+}
+
+// Subtraction / Negation
+//-----------------------
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator -( const sVector4& i_rhs ) const
+{
+#if defined( EAE6320_MATH_SIMD )
+    sVector4 result;
+    Simd::Store( Simd::Subtract( Simd::Load( &x ), Simd::Load( &i_rhs.x ) ), &result.x );
+    return result;
+#else
+    return sVector4( x - i_rhs.x, y - i_rhs.y, z - i_rhs.z, w - i_rhs.w );
+#endif
+}
+
+inline eae6320::Math::sVector4& eae6320::Math::sVector4::operator -=( const sVector4& i_rhs )
+{
+    return *this = *this - i_rhs;
+}
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator -() const
+{
+#if defined( EAE6320_MATH_SIMD )
+    sVector4 result;
+    Simd::Store( Simd::Negate( Simd::Load( &x ) ), &result.x );
+    return result;
+#else
+    return sVector4( -x, -y, -z, -w );
+#endif
+}
+
+// Multiplication
+//---------------
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator *( const float i_rhs ) const
+{
+#if defined( EAE6320_MATH_SIMD )
+    sVector4 result;
+    Simd::Store( Simd::Multiply( Simd::Load( &x ), Simd::Splat( i_rhs ) ), &result.x );
+    return result;
+#else
+    return sVector4( x * i_rhs, y * i_rhs, z * i_rhs, w * i_rhs );
+#endif
+}
+
+inline eae6320::Math::sVector4& eae6320::Math::sVector4::operator *=( const float i_rhs )
+{
+    return *this = *this * i_rhs;
+}
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator *( const sVector4& i_rhs ) const
+{
+#if defined( EAE6320_MATH_SIMD )
+    sVector4 result;
+    Simd::Store( Simd::Multiply( Simd::Load( &x ), Simd::Load( &i_rhs.x ) ), &result.x );
+    return result;
+#else
+    return sVector4( x * i_rhs.x, y * i_rhs.y, z * i_rhs.z, w * i_rhs.w );
+#endif
+}
+
+// Division
+//---------
+
+inline eae6320::Math::sVector4 eae6320::Math::sVector4::operator /( const float i_rhs ) const
+{
+    EAE6320_ASSERTF( std::abs( i_rhs ) > 1.0e-9f, "Can't divide by zero" );
+    return *this * ( 1.0f / i_rhs );
+}
+
+// Products
+//---------
+
+inline float eae6320::Math::Dot( const sVector4& i_lhs, const sVector4& i_rhs )
+{
+    // A horizontal SIMD sum would add the products in a different order than this
+    // (and wouldn't be any faster for a single dot product)
+    return ( i_lhs.x * i_rhs.x ) + ( i_lhs.y * i_rhs.y ) + ( i_lhs.z * i_rhs.z ) + ( i_lhs.w * i_rhs.w );
+}
+
+// Comparison
+//-----------
+
+inline bool eae6320::Math::sVector4::operator ==( const sVector4& i_rhs ) const
+{
+    // Use & rather than && to prevent branches (all four comparisons will be evaluated)
+    return ( x == i_rhs.x ) & ( y == i_rhs.y ) & ( z == i_rhs.z ) & ( w == i_rhs.w );
+}
+
+inline bool eae6320::Math::sVector4::operator !=( const sVector4& i_rhs ) const
+{
+    // Use | rather than || to prevent branches (all four comparisons will be evaluated)
+    return ( x != i_rhs.x ) | ( y != i_rhs.y ) | ( z != i_rhs.z ) | ( w != i_rhs.w );
+}
+
+// Access
+//-------
+
+inline eae6320::Math::sVector eae6320::Math::sVector4::GetXYZ() const
+{
+    return sVector( x, y, z );
+}
+
+// Initialization / Shut Down
+//---------------------------
+
+constexpr eae6320::Math::sVector4::sVector4( const float i_x, const float i_y, const float i_z, const float i_w )
+    :
+    x( i_x ), y( i_y ), z( i_z ), w( i_w )
+{
+
+}
+
+constexpr eae6320::Math::sVector4::sVector4( const sVector& i_xyz, const float i_w )
+    :
+    x( i_xyz.x ), y( i_xyz.y ), z( i_xyz.z ), w( i_w )
+{
+
+}
+
+#endif    // EAE6320_MATH_SVECTOR4_INL
@@ -0,0 +1,1242 @@
+// Include Files
+//==============
+
+#include "Narrowphase.h"
+
+#include "sShape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/Constants.h>
+#include <initializer_list>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr unsigned int s_maxGjkIterationCount = 32;
+    // GJK stops when a new support point can't bring the closest point closer by more than this fraction
+    constexpr auto s_gjkRelativeTolerance = 1.0e-5f;
+    // Cores that are closer than this are treated as overlapping
+    // (the direction between points that are this close isn't reliable)
+    constexpr auto s_overlapDistance = 1.0e-4f;
+
+    constexpr unsigned int s_maxEpaIterationCount = 48;
+    constexpr unsigned int s_maxEpaVertexCount = s_maxEpaIterationCount + 4;
+    // A closed polytope made of triangles has 2 * (vertexCount - 2) faces
+    constexpr unsigned int s_maxEpaFaceCount = 2 * s_maxEpaVertexCount;
+    constexpr unsigned int s_maxEpaHorizonEdgeCount = s_maxEpaFaceCount;
+    // EPA stops when a new support point doesn't move the closest face farther than this
+    constexpr auto s_epaTolerance = 1.0e-4f;
+
+    // A box's face has 4 points, but the face of a hull can have more,
+    // and clipping a face adds at most one point for every side of the other face
+    constexpr unsigned int s_maxFacePointCount = 32;
+    // A capsule lies on its side if its segment is closer to perpendicular to the contact normal than this
+    // (the cosine of about 84 degrees)
+    constexpr auto s_capsuleFaceTolerance = 0.1f;
+    // A hull's point is on its supporting face
+    // if it is closer to the face than this fraction of the hull's extent along the contact normal
+    constexpr auto s_hullFaceTolerance = 1.0e-3f;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // A shape in world space
+    struct sPlacedShape
+    {
+        const eae6320::Physics::sShape* shape;
+        eae6320::Math::sVector position;
+        eae6320::Math::cQuaternion orientation;
+        eae6320::Math::cQuaternion orientation_inverse;
+    };
+
+    // A point of the Minkowski difference of the cores (A - B) and the points of A and B that it was made from
+    struct sSupportVertex
+    {
+        eae6320::Math::sVector point;
+        eae6320::Math::sVector pointOnA;
+        eae6320::Math::sVector pointOnB;
+    };
+    sSupportVertex GetSupportVertex(const sPlacedShape& i_a, const sPlacedShape& i_b, const eae6320::Math::sVector& i_direction);
+
+    // The closest point of a simplex to the origin is the weighted sum of its vertices
+    struct sSimplex
+    {
+        sSupportVertex vertices[4];
+        float weights[4];
+        unsigned int count;
+    };
+    // These reduce the simplex to the vertices of the feature that is closest to the origin
+    // and calculate the weights of the closest point
+    void SolveSegment(const sSupportVertex i_a, const sSupportVertex i_b, sSimplex& o_simplex);
+    void SolveTriangle(const sSupportVertex i_a, const sSupportVertex i_b, const sSupportVertex i_c, sSimplex& o_simplex);
+    // Returns false if the origin is inside of the tetrahedron
+    // (in which case the simplex isn't changed)
+    bool SolveTetrahedron(sSimplex& io_simplex);
+    eae6320::Math::sVector GetClosestPoint(const sSimplex& i_simplex);
+
+    namespace GjkResults
+    {
+        enum eResult
+        {
+            // The closest points of the cores were found
+            SEPARATED,
+            // The cores are farther apart than the maximum distance
+            TOO_FAR,
+            // The cores overlap, and the simplex contains the origin
+            OVERLAPPING
+        };
+    }
+    GjkResults::eResult RunGjk(const sPlacedShape& i_a, const sPlacedShape& i_b, const float i_maxDistance,
+        sSimplex& o_simplex, eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB);
+    // Returns false if the overlap couldn't be calculated
+    // (e.g. if the Minkowski difference is flat because both shapes are flat)
+    bool RunEpa(const sPlacedShape& i_a, const sPlacedShape& i_b, const sSimplex& i_simplex,
+        eae6320::Math::sVector& o_normal, float& o_depth, eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB);
+
+    // Spheres and capsules
+    bool IsRound(const eae6320::Physics::sShape& i_shape);
+    void GetCoreSegment(const sPlacedShape& i_shape, eae6320::Math::sVector& o_start, eae6320::Math::sVector& o_end);
+    void FindClosestPointsOfSegments(const eae6320::Math::sVector& i_startA, const eae6320::Math::sVector& i_endA,
+        const eae6320::Math::sVector& i_startB, const eae6320::Math::sVector& i_endB,
+        eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB);
+
+    // Calculates the contact of the shapes from the closest points of their separated cores
+    bool CalculateContactFromCores(const eae6320::Math::sVector& i_corePointOnA, const eae6320::Math::sVector& i_corePointOnB,
+        const float i_radiusA, const float i_radiusB, const float i_margin, eae6320::Physics::Narrowphase::sContact& o_contact);
+    bool CalculateDeepestContact(const sPlacedShape& i_a, const sPlacedShape& i_b, const float i_margin,
+        eae6320::Physics::Narrowphase::sContact& o_contact);
+
+    // The part of a shape's core that is farthest in a direction, in world space:
+    //  * 1 point for a sphere or a corner
+    //  * 2 points for a capsule on its side or an edge
+    //  * A convex polygon (with its points in order around it) for a face
+    struct sFace
+    {
+        eae6320::Math::sVector points[s_maxFacePointCount];
+        unsigned int count;
+    };
+    void GetSupportingFace(const sPlacedShape& i_shape, const eae6320::Math::sVector& i_direction, sFace& o_face);
+    // Puts points that are on a plane into order around their convex hull
+    // (points that are inside of the hull are removed)
+    void SortIntoConvexPolygon(const eae6320::Math::sVector& i_normal, sFace& io_face);
+    // Removes the part of a face that is in front of a plane
+    void ClipFace(const eae6320::Math::sVector& i_pointOnPlane, const eae6320::Math::sVector& i_planeNormal, sFace& io_face);
+    // Removes the part of a face that is outside of the infinite prism
+    // that a convex polygon makes when it is extruded along the normal
+    void ClipFaceToPolygon(const sFace& i_polygon, const eae6320::Math::sVector& i_normal, sFace& io_face);
+    // Returns how far a point has to move along a direction to reach the plane of a polygon
+    // (the face of a shape isn't exactly perpendicular to the contact normal unless it is resting flat)
+    float CalculateDistanceToFace(const eae6320::Math::sVector& i_point, const eae6320::Math::sVector& i_direction, const sFace& i_polygon);
+
+    // Chooses the contacts that keep the largest area
+    // (the deepest contact is always kept so that the overlap keeps being resolved)
+    unsigned int ReduceContacts(const eae6320::Physics::Narrowphase::sContact* const i_contacts, const unsigned int i_contactCount,
+        eae6320::Physics::Narrowphase::sContact (&o_contacts)[eae6320::Physics::Narrowphase::maxContactCount]);
+    // Returns a value that grows with the area of the quadrilateral
+    // (the points can be in any order)
+    float CalculateAreaMeasure(const eae6320::Math::sVector& i_point0, const eae6320::Math::sVector& i_point1,
+        const eae6320::Math::sVector& i_point2, const eae6320::Math::sVector& i_point3);
+}
+
+// Interface
+//==========
+
+unsigned int eae6320::Physics::Narrowphase::CalculateContacts(const sShape& i_shapeA, const Math::sVector& i_positionA, const Math::cQuaternion& i_orientationA,
+    const sShape& i_shapeB, const Math::sVector& i_positionB, const Math::cQuaternion& i_orientationB,
+    const float i_margin, sContact (&o_contacts)[maxContactCount])
+{
+    const sPlacedShape a = { &i_shapeA, i_positionA, i_orientationA, i_orientationA.GetInverse() };
+    const sPlacedShape b = { &i_shapeB, i_positionB, i_orientationB, i_orientationB.GetInverse() };
+    sContact deepestContact;
+    if (!CalculateDeepestContact(a, b, i_margin, deepestContact))
+    {
+        return 0;
+    }
+
+    // The features of the cores that face each other are clipped against each other,
+    // and every clipped point that is close enough becomes a contact
+    const auto& normal = deepestContact.normal;
+    const auto radiusA = i_shapeA.GetCoreRadius();
+    const auto radiusB = i_shapeB.GetCoreRadius();
+    sContact contacts[s_maxFacePointCount];
+    unsigned int contactCount = 0;
+    {
+        sFace faceA, faceB;
+        GetSupportingFace(a, normal, faceA);
+        GetSupportingFace(b, -normal, faceB);
+        // A single point can only touch at the deepest contact
+        if ((faceA.count >= 2) && (faceB.count >= 2))
+        {
+            const auto AddContact = [&contacts, &contactCount, &normal, radiusA, radiusB, i_margin](
+                const Math::sVector& i_corePointOnA, const Math::sVector& i_corePointOnB)
+            {
+                const auto depth = Dot(i_corePointOnA - i_corePointOnB, normal) + radiusA + radiusB;
+                if (depth >= -i_margin)
+                {
+                    auto& contact = contacts[contactCount++];
+                    contact.pointOnA = i_corePointOnA + (normal * radiusA);
+                    contact.pointOnB = i_corePointOnB - (normal * radiusB);
+                    contact.normal = normal;
+                    contact.depth = depth;
+                }
+            };
+            if (faceA.count >= 3)
+            {
+                // B's feature is clipped to A's face and then projected onto its plane
+                ClipFaceToPolygon(faceA, normal, faceB);
+                for (unsigned int i = 0; i < faceB.count; ++i)
+                {
+                    const auto& pointOnB = faceB.points[i];
+                    AddContact(pointOnB + (normal * CalculateDistanceToFace(pointOnB, normal, faceA)), pointOnB);
+                }
+            }
+            else if (faceB.count >= 3)
+            {
+                ClipFaceToPolygon(faceB, normal, faceA);
+                for (unsigned int i = 0; i < faceA.count; ++i)
+                {
+                    const auto& pointOnA = faceA.points[i];
+                    AddContact(pointOnA, pointOnA + (normal * CalculateDistanceToFace(pointOnA, normal, faceB)));
+                }
+            }
+            else
+            {
+                // Two segments (e.g. capsules side by side) touch along the part of B's segment
+                // that is between the ends of A's
+                const auto& startA = faceA.points[0];
+                const auto& endA = faceA.points[1];
+                const auto directionA = endA - startA;
+                ClipFace(startA, -directionA, faceB);
+                ClipFace(endA, directionA, faceB);
+                const auto lengthSquaredA = Dot(directionA, directionA);
+                for (unsigned int i = 0; i < faceB.count; ++i)
+                {
+                    const auto& pointOnB = faceB.points[i];
+                    const auto t = (lengthSquaredA > 0.0f) ?
+                        std::min(std::max(Dot(pointOnB - startA, directionA) / lengthSquaredA, 0.0f), 1.0f) : 0.0f;
+                    AddContact(startA + (directionA * t), pointOnB);
+                }
+            }
+        }
+    }
+    if (contactCount == 0)
+    {
+        o_contacts[0] = deepestContact;
+        return 1;
+    }
+    return ReduceContacts(contacts, contactCount, o_contacts);
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    sSupportVertex GetSupportVertex(const sPlacedShape& i_a, const sPlacedShape& i_b, const eae6320::Math::sVector& i_direction)
+    {
+        // The support point of A - B in a direction is A's support point in that direction
+        // minus B's support point in the opposite direction
+        sSupportVertex vertex;
+        vertex.pointOnA = i_a.position + (i_a.orientation * i_a.shape->GetCoreSupportPoint(i_a.orientation_inverse * i_direction));
+        vertex.pointOnB = i_b.position + (i_b.orientation * i_b.shape->GetCoreSupportPoint(i_b.orientation_inverse * -i_direction));
+        vertex.point = vertex.pointOnA - vertex.pointOnB;
+        return vertex;
+    }
+
+    void SolveSegment(const sSupportVertex i_a, const sSupportVertex i_b, sSimplex& o_simplex)
+    {
+        const auto ab = i_b.point - i_a.point;
+        const auto lengthSquared = Dot(ab, ab);
+        const auto t = (lengthSquared > 0.0f) ? (-Dot(i_a.point, ab) / lengthSquared) : 0.0f;
+        if (t <= 0.0f)
+        {
+            o_simplex.vertices[0] = i_a;
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+        }
+        else if (t >= 1.0f)
+        {
+            o_simplex.vertices[0] = i_b;
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+        }
+        else
+        {
+            o_simplex.vertices[0] = i_a;
+            o_simplex.vertices[1] = i_b;
+            o_simplex.weights[0] = 1.0f - t;
+            o_simplex.weights[1] = t;
+            o_simplex.count = 2;
+        }
+    }
+
+    void SolveTriangle(const sSupportVertex i_a, const sSupportVertex i_b, const sSupportVertex i_c, sSimplex& o_simplex)
+    {
+        // This finds the Voronoi region of the triangle that contains the origin
+        // (see "Real-Time Collision Detection" by Christer Ericson, section 5.1.5)
+        const auto& a = i_a.point;
+        const auto& b = i_b.point;
+        const auto& c = i_c.point;
+        const auto ab = b - a;
+        const auto ac = c - a;
+
+        const auto d1 = -Dot(ab, a);
+        const auto d2 = -Dot(ac, a);
+        if ((d1 <= 0.0f) && (d2 <= 0.0f))
+        {
+            o_simplex.vertices[0] = i_a;
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+            return;
+        }
+        const auto d3 = -Dot(ab, b);
+        const auto d4 = -Dot(ac, b);
+        if ((d3 >= 0.0f) && (d4 <= d3))
+        {
+            o_simplex.vertices[0] = i_b;
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+            return;
+        }
+        const auto vc = (d1 * d4) - (d3 * d2);
+        if ((vc <= 0.0f) && (d1 >= 0.0f) && (d3 <= 0.0f))
+        {
+            const auto v = d1 / (d1 - d3);
+            o_simplex.vertices[0] = i_a;
+            o_simplex.vertices[1] = i_b;
+            o_simplex.weights[0] = 1.0f - v;
+            o_simplex.weights[1] = v;
+            o_simplex.count = 2;
+            return;
+        }
+        const auto d5 = -Dot(ab, c);
+        const auto d6 = -Dot(ac, c);
+        if ((d6 >= 0.0f) && (d5 <= d6))
+        {
+            o_simplex.vertices[0] = i_c;
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+            return;
+        }
+        const auto vb = (d5 * d2) - (d1 * d6);
+        if ((vb <= 0.0f) && (d2 >= 0.0f) && (d6 <= 0.0f))
+        {
+            const auto w = d2 / (d2 - d6);
+            o_simplex.vertices[0] = i_a;
+            o_simplex.vertices[1] = i_c;
+            o_simplex.weights[0] = 1.0f - w;
+            o_simplex.weights[1] = w;
+            o_simplex.count = 2;
+            return;
+        }
+        const auto va = (d3 * d6) - (d5 * d4);
+        if ((va <= 0.0f) && ((d4 - d3) >= 0.0f) && ((d5 - d6) >= 0.0f))
+        {
+            const auto w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            o_simplex.vertices[0] = i_b;
+            o_simplex.vertices[1] = i_c;
+            o_simplex.weights[0] = 1.0f - w;
+            o_simplex.weights[1] = w;
+            o_simplex.count = 2;
+            return;
+        }
+        const auto sum = va + vb + vc;
+        if (sum <= 0.0f)
+        {
+            // A degenerate triangle is reduced to its closest edge
+            sSimplex edges[3];
+            SolveSegment(i_a, i_b, edges[0]);
+            SolveSegment(i_a, i_c, edges[1]);
+            SolveSegment(i_b, i_c, edges[2]);
+            const auto* closestEdge = &edges[0];
+            auto closestDistanceSquared = Dot(GetClosestPoint(edges[0]), GetClosestPoint(edges[0]));
+            for (unsigned int i = 1; i < 3; ++i)
+            {
+                const auto closestPoint = GetClosestPoint(edges[i]);
+                const auto distanceSquared = Dot(closestPoint, closestPoint);
+                if (distanceSquared < closestDistanceSquared)
+                {
+                    closestEdge = &edges[i];
+                    closestDistanceSquared = distanceSquared;
+                }
+            }
+            o_simplex = *closestEdge;
+            return;
+        }
+        const auto v = vb / sum;
+        const auto w = vc / sum;
+        o_simplex.vertices[0] = i_a;
+        o_simplex.vertices[1] = i_b;
+        o_simplex.vertices[2] = i_c;
+        o_simplex.weights[0] = 1.0f - v - w;
+        o_simplex.weights[1] = v;
+        o_simplex.weights[2] = w;
+        o_simplex.count = 3;
+    }
+
+    bool SolveTetrahedron(sSimplex& io_simplex)
+    {
+        // The closest point is on one of the faces that the origin is in front of
+        // (see "Real-Time Collision Detection" by Christer Ericson, section 5.1.6)
+        const auto& vertices = io_simplex.vertices;
+        // Each face and the vertex opposite of it
+        const unsigned int faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+        sSimplex closestFace;
+        auto closestDistanceSquared = 0.0f;
+        auto isOutsideOfAnyFace = false;
+        for (const auto& face : faces)
+        {
+            const auto& a = vertices[face[0]].point;
+            const auto normal = Cross(vertices[face[1]].point - a, vertices[face[2]].point - a);
+            const auto side_origin = -Dot(a, normal);
+            const auto side_opposite = Dot(vertices[face[3]].point - a, normal);
+            // (A flat tetrahedron has the opposite vertex on every face's plane,
+            // and so the origin is treated as being outside of all of them)
+            if ((side_origin * side_opposite) <= 0.0f)
+            {
+                sSimplex faceSimplex;
+                SolveTriangle(vertices[face[0]], vertices[face[1]], vertices[face[2]], faceSimplex);
+                const auto closestPoint = GetClosestPoint(faceSimplex);
+                const auto distanceSquared = Dot(closestPoint, closestPoint);
+                if (!isOutsideOfAnyFace || (distanceSquared < closestDistanceSquared))
+                {
+                    closestFace = faceSimplex;
+                    closestDistanceSquared = distanceSquared;
+                    isOutsideOfAnyFace = true;
+                }
+            }
+        }
+        if (isOutsideOfAnyFace)
+        {
+            io_simplex = closestFace;
+        }
+        return isOutsideOfAnyFace;
+    }
+
+    eae6320::Math::sVector GetClosestPoint(const sSimplex& i_simplex)
+    {
+        eae6320::Math::sVector closestPoint;
+        for (unsigned int i = 0; i < i_simplex.count; ++i)
+        {
+            closestPoint += i_simplex.vertices[i].point * i_simplex.weights[i];
+        }
+        return closestPoint;
+    }
+
+    GjkResults::eResult RunGjk(const sPlacedShape& i_a, const sPlacedShape& i_b, const float i_maxDistance,
+        sSimplex& o_simplex, eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB)
+    {
+        using namespace eae6320::Math;
+
+        // The search starts from the support point in the direction from B's position to A's
+        // because that is the part of A - B that is most likely to be close to the origin
+        {
+            auto direction = i_a.position - i_b.position;
+            if (Dot(direction, direction) <= 0.0f)
+            {
+                direction = sVector(1.0f, 0.0f, 0.0f);
+            }
+            o_simplex.vertices[0] = GetSupportVertex(i_a, i_b, -direction);
+            o_simplex.weights[0] = 1.0f;
+            o_simplex.count = 1;
+        }
+        auto closestPoint = o_simplex.vertices[0].point;
+        const auto maxDistanceSquared = i_maxDistance * i_maxDistance;
+        for (unsigned int iteration = 0; iteration < s_maxGjkIterationCount; ++iteration)
+        {
+            const auto distanceSquared = Dot(closestPoint, closestPoint);
+            if (distanceSquared <= (s_overlapDistance * s_overlapDistance))
+            {
+                return GjkResults::OVERLAPPING;
+            }
+
+            const auto newVertex = GetSupportVertex(i_a, i_b, -closestPoint);
+            // Every point of A - B is at least this far along the direction of the closest point,
+            // and so if that is beyond the maximum distance there is no reason to continue
+            const auto projection = Dot(closestPoint, newVertex.point);
+            if ((projection > 0.0f) && ((projection * projection) > (distanceSquared * maxDistanceSquared)))
+            {
+                return GjkResults::TOO_FAR;
+            }
+            // If the new vertex can't get meaningfully closer to the origin then the closest point has been found
+            if ((distanceSquared - projection) <= (s_gjkRelativeTolerance * distanceSquared))
+            {
+                break;
+            }
+            {
+                auto isDuplicate = false;
+                for (unsigned int i = 0; i < o_simplex.count; ++i)
+                {
+                    isDuplicate = isDuplicate || (o_simplex.vertices[i].point == newVertex.point);
+                }
+                if (isDuplicate)
+                {
+                    break;
+                }
+            }
+
+            o_simplex.vertices[o_simplex.count] = newVertex;
+            ++o_simplex.count;
+            switch (o_simplex.count)
+            {
+            case 2:
+                SolveSegment(o_simplex.vertices[0], o_simplex.vertices[1], o_simplex);
+                break;
+            case 3:
+                SolveTriangle(o_simplex.vertices[0], o_simplex.vertices[1], o_simplex.vertices[2], o_simplex);
+                break;
+            case 4:
+                if (!SolveTetrahedron(o_simplex))
+                {
+                    return GjkResults::OVERLAPPING;
+                }
+                break;
+            default:
+                EAE6320_ASSERT(false);
+            }
+
+            const auto newClosestPoint = GetClosestPoint(o_simplex);
+            // Floating point error can keep the distance from decreasing
+            // when the closest point is almost found
+            const auto isProgressing = Dot(newClosestPoint, newClosestPoint) < distanceSquared;
+            closestPoint = newClosestPoint;
+            if (!isProgressing)
+            {
+                break;
+            }
+        }
+        if (Dot(closestPoint, closestPoint) <= (s_overlapDistance * s_overlapDistance))
+        {
+            return GjkResults::OVERLAPPING;
+        }
+
+        o_pointOnA = sVector();
+        o_pointOnB = sVector();
+        for (unsigned int i = 0; i < o_simplex.count; ++i)
+        {
+            o_pointOnA += o_simplex.vertices[i].pointOnA * o_simplex.weights[i];
+            o_pointOnB += o_simplex.vertices[i].pointOnB * o_simplex.weights[i];
+        }
+        return GjkResults::SEPARATED;
+    }
+
+    bool RunEpa(const sPlacedShape& i_a, const sPlacedShape& i_b, const sSimplex& i_simplex,
+        eae6320::Math::sVector& o_normal, float& o_depth, eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB)
+    {
+        using namespace eae6320::Math;
+
+        sSupportVertex vertices[s_maxEpaVertexCount];
+        unsigned int vertexCount = i_simplex.count;
+        for (unsigned int i = 0; i < vertexCount; ++i)
+        {
+            vertices[i] = i_simplex.vertices[i];
+        }
+
+        // GJK can stop with fewer than four vertices if the origin is on (or very close to) the simplex,
+        // and so the simplex is expanded into a tetrahedron that still contains the origin
+        // (the origin is then on its boundary, which EPA handles)
+        constexpr auto epsilon = 1.0e-6f;
+        if (vertexCount == 1)
+        {
+            const sVector directions[] =
+            {
+                sVector(1.0f, 0.0f, 0.0f), sVector(-1.0f, 0.0f, 0.0f),
+                sVector(0.0f, 1.0f, 0.0f), sVector(0.0f, -1.0f, 0.0f),
+                sVector(0.0f, 0.0f, 1.0f), sVector(0.0f, 0.0f, -1.0f)
+            };
+            for (const auto& direction : directions)
+            {
+                const auto vertex = GetSupportVertex(i_a, i_b, direction);
+                const auto offset = vertex.point - vertices[0].point;
+                if (Dot(offset, offset) > epsilon)
+                {
+                    vertices[vertexCount++] = vertex;
+                    break;
+                }
+            }
+        }
+        if (vertexCount == 2)
+        {
+            const auto line = (vertices[1].point - vertices[0].point).GetNormalized();
+            // The search directions are perpendicular to the line,
+            // starting from the cross product with the axis that is least aligned with it
+            const auto absolute_x = std::abs(line.x);
+            const auto absolute_y = std::abs(line.y);
+            const auto absolute_z = std::abs(line.z);
+            const auto axis = ((absolute_x <= absolute_y) && (absolute_x <= absolute_z)) ? sVector(1.0f, 0.0f, 0.0f) :
+                ((absolute_y <= absolute_z) ? sVector(0.0f, 1.0f, 0.0f) : sVector(0.0f, 0.0f, 1.0f));
+            const auto perpendicular1 = Cross(line, axis).GetNormalized();
+            const auto perpendicular2 = Cross(line, perpendicular1);
+            constexpr unsigned int directionCount = 6;
+            for (unsigned int i = 0; i < directionCount; ++i)
+            {
+                const auto angle = (2.0f * pi * static_cast<float>(i)) / static_cast<float>(directionCount);
+                const auto direction = (perpendicular1 * std::cos(angle)) + (perpendicular2 * std::sin(angle));
+                const auto vertex = GetSupportVertex(i_a, i_b, direction);
+                const auto offset = Cross(vertex.point - vertices[0].point, line);
+                if (Dot(offset, offset) > epsilon)
+                {
+                    vertices[vertexCount++] = vertex;
+                    break;
+                }
+            }
+        }
+        if (vertexCount == 3)
+        {
+            const auto normal = Cross(vertices[1].point - vertices[0].point, vertices[2].point - vertices[0].point);
+            const auto normalLengthSquared = Dot(normal, normal);
+            if (normalLengthSquared > 0.0f)
+            {
+                for (const auto direction : { normal, -normal })
+                {
+                    const auto vertex = GetSupportVertex(i_a, i_b, direction);
+                    const auto distance = Dot(vertex.point - vertices[0].point, normal);
+                    if ((distance * distance) > (epsilon * normalLengthSquared))
+                    {
+                        vertices[vertexCount++] = vertex;
+                        break;
+                    }
+                }
+            }
+        }
+        if (vertexCount != 4)
+        {
+            return false;
+        }
+        {
+            const auto volume = Dot(vertices[1].point - vertices[0].point,
+                Cross(vertices[2].point - vertices[0].point, vertices[3].point - vertices[0].point));
+            if (std::abs(volume) <= epsilon)
+            {
+                return false;
+            }
+        }
+
+        // Every face points away from a point that is inside of the polytope
+        // (the polytope only grows, and so the center of the first tetrahedron stays inside of it)
+        const auto interiorPoint = (vertices[0].point + vertices[1].point + vertices[2].point + vertices[3].point) * 0.25f;
+        struct sFace
+        {
+            unsigned int indices[3];
+            sVector normal;
+            // The distance of the face's plane from the origin
+            float distance;
+        };
+        sFace faces[s_maxEpaFaceCount];
+        unsigned int faceCount = 0;
+        const auto AddFace = [&vertices, &faces, &faceCount, &interiorPoint](unsigned int i_index0, unsigned int i_index1, unsigned int i_index2)
+        {
+            const auto& a = vertices[i_index0].point;
+            auto normal = Cross(vertices[i_index1].point - a, vertices[i_index2].point - a);
+            const auto length = normal.GetLength();
+            // A face with no area would have no direction
+            // (it is left out, which leaves a small gap in the polytope that the search can't go through)
+            if ((length <= 1.0e-12f) || (faceCount >= s_maxEpaFaceCount))
+            {
+                return;
+            }
+            normal /= length;
+            if (Dot(normal, a - interiorPoint) < 0.0f)
+            {
+                std::swap(i_index1, i_index2);
+                normal = -normal;
+            }
+            auto& face = faces[faceCount++];
+            face.indices[0] = i_index0;
+            face.indices[1] = i_index1;
+            face.indices[2] = i_index2;
+            face.normal = normal;
+            face.distance = Dot(normal, a);
+        };
+        AddFace(0, 1, 2);
+        AddFace(0, 1, 3);
+        AddFace(0, 2, 3);
+        AddFace(1, 2, 3);
+
+        unsigned int closestFaceIndex = 0;
+        for (unsigned int iteration = 0; ; ++iteration)
+        {
+            if (faceCount == 0)
+            {
+                return false;
+            }
+            closestFaceIndex = 0;
+            for (unsigned int i = 1; i < faceCount; ++i)
+            {
+                if (faces[i].distance < faces[closestFaceIndex].distance)
+                {
+                    closestFaceIndex = i;
+                }
+            }
+            const auto closestFace = faces[closestFaceIndex];
+            if ((iteration >= s_maxEpaIterationCount) || (vertexCount >= s_maxEpaVertexCount))
+            {
+                break;
+            }
+
+            // If the support point in the face's direction isn't beyond the face
+            // then the face is on the boundary of the Minkowski difference
+            const auto newVertex = GetSupportVertex(i_a, i_b, closestFace.normal);
+            if ((Dot(newVertex.point, closestFace.normal) - closestFace.distance) <= s_epaTolerance)
+            {
+                break;
+            }
+            const auto newIndex = vertexCount++;
+            vertices[newIndex] = newVertex;
+
+            // Every face that the new vertex is in front of is removed,
+            // and the hole is filled with new faces from the edges around it to the new vertex.
+            // An edge of the hole belongs to only one of the removed faces,
+            // and so edges that are shared by two removed faces cancel each other out
+            struct sEdge
+            {
+                unsigned int indices[2];
+            };
+            sEdge horizon[s_maxEpaHorizonEdgeCount];
+            unsigned int horizonEdgeCount = 0;
+            auto hasHorizonOverflowed = false;
+            for (unsigned int i = 0; i < faceCount;)
+            {
+                const auto& face = faces[i];
+                if (Dot(face.normal, newVertex.point - vertices[face.indices[0]].point) > 0.0f)
+                {
+                    for (unsigned int j = 0; j < 3; ++j)
+                    {
+                        const sEdge edge = { { face.indices[j], face.indices[(j + 1) % 3] } };
+                        auto wasShared = false;
+                        for (unsigned int k = 0; k < horizonEdgeCount; ++k)
+                        {
+                            if ((horizon[k].indices[0] == edge.indices[1]) && (horizon[k].indices[1] == edge.indices[0]))
+                            {
+                                horizon[k] = horizon[--horizonEdgeCount];
+                                wasShared = true;
+                                break;
+                            }
+                        }
+                        if (!wasShared)
+                        {
+                            if (horizonEdgeCount < s_maxEpaHorizonEdgeCount)
+                            {
+                                horizon[horizonEdgeCount++] = edge;
+                            }
+                            else
+                            {
+                                hasHorizonOverflowed = true;
+                            }
+                        }
+                    }
+                    faces[i] = faces[--faceCount];
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+            for (unsigned int i = 0; i < horizonEdgeCount; ++i)
+            {
+                AddFace(horizon[i].indices[0], horizon[i].indices[1], newIndex);
+            }
+            if (hasHorizonOverflowed)
+            {
+                return false;
+            }
+        }
+
+        // The closest point of the face to the origin is converted into the points on each shape
+        // using its barycentric coordinates
+        // (see "Real-Time Collision Detection" by Christer Ericson, section 3.4)
+        const auto& closestFace = faces[closestFaceIndex];
+        const auto& a = vertices[closestFace.indices[0]];
+        const auto& b = vertices[closestFace.indices[1]];
+        const auto& c = vertices[closestFace.indices[2]];
+        const auto closestPoint = closestFace.normal * closestFace.distance;
+        const auto ab = b.point - a.point;
+        const auto ac = c.point - a.point;
+        const auto ap = closestPoint - a.point;
+        const auto d00 = Dot(ab, ab);
+        const auto d01 = Dot(ab, ac);
+        const auto d11 = Dot(ac, ac);
+        const auto d20 = Dot(ap, ab);
+        const auto d21 = Dot(ap, ac);
+        const auto denominator = (d00 * d11) - (d01 * d01);
+        auto v = 0.0f, w = 0.0f;
+        if (denominator > 0.0f)
+        {
+            v = ((d11 * d20) - (d01 * d21)) / denominator;
+            w = ((d00 * d21) - (d01 * d20)) / denominator;
+        }
+        const auto u = 1.0f - v - w;
+        o_normal = closestFace.normal;
+        o_depth = std::max(closestFace.distance, 0.0f);
+        o_pointOnA = (a.pointOnA * u) + (b.pointOnA * v) + (c.pointOnA * w);
+        o_pointOnB = (a.pointOnB * u) + (b.pointOnB * v) + (c.pointOnB * w);
+        return true;
+    }
+
+    bool IsRound(const eae6320::Physics::sShape& i_shape)
+    {
+        return (i_shape.type == eae6320::Physics::ShapeTypes::SPHERE) || (i_shape.type == eae6320::Physics::ShapeTypes::CAPSULE);
+    }
+
+    void GetCoreSegment(const sPlacedShape& i_shape, eae6320::Math::sVector& o_start, eae6320::Math::sVector& o_end)
+    {
+        if (i_shape.shape->type == eae6320::Physics::ShapeTypes::CAPSULE)
+        {
+            const auto halfSegment = i_shape.orientation * eae6320::Math::sVector(0.0f, i_shape.shape->halfHeight, 0.0f);
+            o_start = i_shape.position - halfSegment;
+            o_end = i_shape.position + halfSegment;
+        }
+        else
+        {
+            o_start = o_end = i_shape.position;
+        }
+    }
+
+    void FindClosestPointsOfSegments(const eae6320::Math::sVector& i_startA, const eae6320::Math::sVector& i_endA,
+        const eae6320::Math::sVector& i_startB, const eae6320::Math::sVector& i_endB,
+        eae6320::Math::sVector& o_pointOnA, eae6320::Math::sVector& o_pointOnB)
+    {
+        // See "Real-Time Collision Detection" by Christer Ericson, section 5.1.9
+        constexpr auto epsilon = 1.0e-12f;
+        const auto directionA = i_endA - i_startA;
+        const auto directionB = i_endB - i_startB;
+        const auto offset = i_startA - i_startB;
+        const auto lengthSquaredA = Dot(directionA, directionA);
+        const auto lengthSquaredB = Dot(directionB, directionB);
+        const auto f = Dot(directionB, offset);
+        const auto Clamp = [](const float i_value) { return std::min(std::max(i_value, 0.0f), 1.0f); };
+        float s, t;
+        if ((lengthSquaredA <= epsilon) && (lengthSquaredB <= epsilon))
+        {
+            s = t = 0.0f;
+        }
+        else if (lengthSquaredA <= epsilon)
+        {
+            s = 0.0f;
+            t = Clamp(f / lengthSquaredB);
+        }
+        else
+        {
+            const auto c = Dot(directionA, offset);
+            if (lengthSquaredB <= epsilon)
+            {
+                t = 0.0f;
+                s = Clamp(-c / lengthSquaredA);
+            }
+            else
+            {
+                const auto b = Dot(directionA, directionB);
+                const auto denominator = (lengthSquaredA * lengthSquaredB) - (b * b);
+                // Parallel segments have a denominator of zero and any point can be chosen
+                s = (denominator > 0.0f) ? Clamp(((b * f) - (c * lengthSquaredB)) / denominator) : 0.0f;
+                t = ((b * s) + f) / lengthSquaredB;
+                if (t < 0.0f)
+                {
+                    t = 0.0f;
+                    s = Clamp(-c / lengthSquaredA);
+                }
+                else if (t > 1.0f)
+                {
+                    t = 1.0f;
+                    s = Clamp((b - c) / lengthSquaredA);
+                }
+            }
+        }
+        o_pointOnA = i_startA + (directionA * s);
+        o_pointOnB = i_startB + (directionB * t);
+    }
+
+    bool CalculateContactFromCores(const eae6320::Math::sVector& i_corePointOnA, const eae6320::Math::sVector& i_corePointOnB,
+        const float i_radiusA, const float i_radiusB, const float i_margin, eae6320::Physics::Narrowphase::sContact& o_contact)
+    {
+        const auto offset = i_corePointOnB - i_corePointOnA;
+        const auto distance = offset.GetLength();
+        const auto depth = i_radiusA + i_radiusB - distance;
+        if (depth < -i_margin)
+        {
+            return false;
+        }
+        // Cores that touch have no direction between them
+        // (this can only happen with spheres and capsules, and any direction will separate them)
+        o_contact.normal = (distance > s_overlapDistance) ? (offset / distance) : eae6320::Math::sVector(0.0f, 1.0f, 0.0f);
+        o_contact.depth = depth;
+        o_contact.pointOnA = i_corePointOnA + (o_contact.normal * i_radiusA);
+        o_contact.pointOnB = i_corePointOnB - (o_contact.normal * i_radiusB);
+        return true;
+    }
+
+    bool CalculateDeepestContact(const sPlacedShape& i_a, const sPlacedShape& i_b, const float i_margin,
+        eae6320::Physics::Narrowphase::sContact& o_contact)
+    {
+        using namespace eae6320::Math;
+
+        const auto radiusA = i_a.shape->GetCoreRadius();
+        const auto radiusB = i_b.shape->GetCoreRadius();
+
+        // The cores of spheres and capsules are segments (a sphere's is a segment with no length),
+        // and so their closest points can be calculated directly
+        if (IsRound(*i_a.shape) && IsRound(*i_b.shape))
+        {
+            sVector startA, endA, startB, endB;
+            GetCoreSegment(i_a, startA, endA);
+            GetCoreSegment(i_b, startB, endB);
+            sVector corePointOnA, corePointOnB;
+            FindClosestPointsOfSegments(startA, endA, startB, endB, corePointOnA, corePointOnB);
+            return CalculateContactFromCores(corePointOnA, corePointOnB, radiusA, radiusB, i_margin, o_contact);
+        }
+
+        sSimplex simplex;
+        sVector corePointOnA, corePointOnB;
+        auto result = RunGjk(i_a, i_b, radiusA + radiusB + i_margin, simplex, corePointOnA, corePointOnB);
+        if (result == GjkResults::SEPARATED)
+        {
+            // Floating point error can make GJK stop before it finds the closest points when the cores barely touch
+            // (especially when one shape is much larger than the other),
+            // and so the cores are checked to actually be separated in the direction between the points
+            const auto offset = corePointOnB - corePointOnA;
+            const auto distance = offset.GetLength();
+            const auto direction = offset / distance;
+            const auto separation = -Dot(GetSupportVertex(i_a, i_b, direction).point, direction);
+            if (separation < s_overlapDistance)
+            {
+                result = GjkResults::OVERLAPPING;
+            }
+        }
+        switch (result)
+        {
+        case GjkResults::SEPARATED:
+            return CalculateContactFromCores(corePointOnA, corePointOnB, radiusA, radiusB, i_margin, o_contact);
+        case GjkResults::TOO_FAR:
+            return false;
+        case GjkResults::OVERLAPPING:
+            {
+                sVector normal;
+                float depth;
+                if (!RunEpa(i_a, i_b, simplex, normal, depth, corePointOnA, corePointOnB))
+                {
+                    return false;
+                }
+                // The rounded parts of the shapes are outside of the cores
+                o_contact.normal = normal;
+                o_contact.depth = depth + radiusA + radiusB;
+                o_contact.pointOnA = corePointOnA + (normal * radiusA);
+                o_contact.pointOnB = corePointOnB - (normal * radiusB);
+                return true;
+            }
+        default:
+            EAE6320_ASSERT(false);
+            return false;
+        }
+    }
+
+    void GetSupportingFace(const sPlacedShape& i_shape, const eae6320::Math::sVector& i_direction, sFace& o_face)
+    {
+        using namespace eae6320::Math;
+        using namespace eae6320::Physics;
+
+        const auto& shape = *i_shape.shape;
+        const auto direction_local = i_shape.orientation_inverse * i_direction;
+        o_face.count = 0;
+        switch (shape.type)
+        {
+        case ShapeTypes::SPHERE:
+            o_face.points[o_face.count++] = sVector();
+            break;
+        case ShapeTypes::CAPSULE:
+            if (std::abs(direction_local.y) <= (s_capsuleFaceTolerance * direction_local.GetLength()))
+            {
+                o_face.points[o_face.count++] = sVector(0.0f, -shape.halfHeight, 0.0f);
+                o_face.points[o_face.count++] = sVector(0.0f, shape.halfHeight, 0.0f);
+            }
+            else
+            {
+                o_face.points[o_face.count++] = shape.GetCoreSupportPoint(direction_local);
+            }
+            break;
+        case ShapeTypes::BOX:
+            {
+                // The face is the one whose axis is most aligned with the direction
+                const float direction[] = { direction_local.x, direction_local.y, direction_local.z };
+                const float halfExtents[] = { shape.halfExtents.x, shape.halfExtents.y, shape.halfExtents.z };
+                unsigned int axis = 0;
+                for (unsigned int i = 1; i < 3; ++i)
+                {
+                    if (std::abs(direction[i]) > std::abs(direction[axis]))
+                    {
+                        axis = i;
+                    }
+                }
+                const auto axis_u = (axis + 1) % 3;
+                const auto axis_v = (axis + 2) % 3;
+                const float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+                for (const auto& corner : corners)
+                {
+                    float point[3];
+                    point[axis] = (direction[axis] >= 0.0f) ? halfExtents[axis] : -halfExtents[axis];
+                    point[axis_u] = corner[0] * halfExtents[axis_u];
+                    point[axis_v] = corner[1] * halfExtents[axis_v];
+                    o_face.points[o_face.count++] = sVector(point[0], point[1], point[2]);
+                }
+            }
+            break;
+        case ShapeTypes::CONVEX_HULL:
+            {
+                EAE6320_ASSERT(shape.hullPoints && (shape.hullPointCount > 0));
+                auto maxDistance = Dot(shape.hullPoints[0], direction_local);
+                auto minDistance = maxDistance;
+                for (uint32_t i = 1; i < shape.hullPointCount; ++i)
+                {
+                    const auto distance = Dot(shape.hullPoints[i], direction_local);
+                    maxDistance = std::max(maxDistance, distance);
+                    minDistance = std::min(minDistance, distance);
+                }
+                const auto faceDistance = maxDistance - (s_hullFaceTolerance * (maxDistance - minDistance));
+                for (uint32_t i = 0; (i < shape.hullPointCount) && (o_face.count < s_maxFacePointCount); ++i)
+                {
+                    if (Dot(shape.hullPoints[i], direction_local) >= faceDistance)
+                    {
+                        o_face.points[o_face.count++] = shape.hullPoints[i];
+                    }
+                }
+                SortIntoConvexPolygon(direction_local, o_face);
+            }
+            break;
+        default:
+            EAE6320_ASSERTF(false, "Unknown shape type %u", static_cast<unsigned int>(shape.type));
+            o_face.points[o_face.count++] = shape.GetCoreSupportPoint(direction_local);
+        }
+        for (unsigned int i = 0; i < o_face.count; ++i)
+        {
+            o_face.points[i] = i_shape.position + (i_shape.orientation * o_face.points[i]);
+        }
+    }
+
+    void SortIntoConvexPolygon(const eae6320::Math::sVector& i_normal, sFace& io_face)
+    {
+        using namespace eae6320::Math;
+
+        if (io_face.count < 3)
+        {
+            return;
+        }
+        // The points are projected onto the plane and their hull is found with Andrew's monotone chain
+        const auto absolute_x = std::abs(i_normal.x);
+        const auto absolute_y = std::abs(i_normal.y);
+        const auto absolute_z = std::abs(i_normal.z);
+        const auto axis = ((absolute_x <= absolute_y) && (absolute_x <= absolute_z)) ? sVector(1.0f, 0.0f, 0.0f) :
+            ((absolute_y <= absolute_z) ? sVector(0.0f, 1.0f, 0.0f) : sVector(0.0f, 0.0f, 1.0f));
+        const auto axis_u = Cross(i_normal, axis);
+        const auto axis_v = Cross(i_normal, axis_u);
+        struct sProjectedPoint
+        {
+            float u, v;
+            sVector point;
+        };
+        sProjectedPoint points[s_maxFacePointCount];
+        const auto pointCount = io_face.count;
+        for (unsigned int i = 0; i < pointCount; ++i)
+        {
+            const auto& point = io_face.points[i];
+            points[i] = { Dot(point, axis_u), Dot(point, axis_v), point };
+        }
+        std::sort(points, points + pointCount, [](const sProjectedPoint& i_lhs, const sProjectedPoint& i_rhs)
+        {
+            return (i_lhs.u < i_rhs.u) || ((i_lhs.u == i_rhs.u) && (i_lhs.v < i_rhs.v));
+        });
+        const auto IsTurningLeft = [](const sProjectedPoint& i_a, const sProjectedPoint& i_b, const sProjectedPoint& i_c)
+        {
+            return (((i_b.u - i_a.u) * (i_c.v - i_a.v)) - ((i_b.v - i_a.v) * (i_c.u - i_a.u))) > 0.0f;
+        };
+        const sProjectedPoint* hull[2 * s_maxFacePointCount];
+        unsigned int hullCount = 0;
+        for (unsigned int i = 0; i < pointCount; ++i)
+        {
+            while ((hullCount >= 2) && !IsTurningLeft(*hull[hullCount - 2], *hull[hullCount - 1], points[i]))
+            {
+                --hullCount;
+            }
+            hull[hullCount++] = &points[i];
+        }
+        for (unsigned int i = pointCount - 1, lowerCount = hullCount + 1; i-- > 0;)
+        {
+            while ((hullCount >= lowerCount) && !IsTurningLeft(*hull[hullCount - 2], *hull[hullCount - 1], points[i]))
+            {
+                --hullCount;
+            }
+            hull[hullCount++] = &points[i];
+        }
+        // The last point is the same as the first
+        io_face.count = hullCount - 1;
+        for (unsigned int i = 0; i < io_face.count; ++i)
+        {
+            io_face.points[i] = hull[i]->point;
+        }
+    }
+
+    void ClipFace(const eae6320::Math::sVector& i_pointOnPlane, const eae6320::Math::sVector& i_planeNormal, sFace& io_face)
+    {
+        float distances[s_maxFacePointCount];
+        for (unsigned int i = 0; i < io_face.count; ++i)
+        {
+            distances[i] = Dot(io_face.points[i] - i_pointOnPlane, i_planeNormal);
+        }
+        const auto Intersect = [&io_face, &distances](const unsigned int i_index0, const unsigned int i_index1)
+        {
+            const auto& point0 = io_face.points[i_index0];
+            return point0 + ((io_face.points[i_index1] - point0) * (distances[i_index0] / (distances[i_index0] - distances[i_index1])));
+        };
+        switch (io_face.count)
+        {
+        case 0:
+            break;
+        case 1:
+            io_face.count = (distances[0] > 0.0f) ? 0 : 1;
+            break;
+        case 2:
+            if ((distances[0] > 0.0f) && (distances[1] > 0.0f))
+            {
+                io_face.count = 0;
+            }
+            else if (distances[0] > 0.0f)
+            {
+                io_face.points[0] = Intersect(0, 1);
+            }
+            else if (distances[1] > 0.0f)
+            {
+                io_face.points[1] = Intersect(1, 0);
+            }
+            break;
+        default:
+            {
+                // See "Reentrant Polygon Clipping" by Sutherland and Hodgman
+                sFace clippedFace;
+                clippedFace.count = 0;
+                for (unsigned int i = 0, previous = io_face.count - 1; i < io_face.count; previous = i++)
+                {
+                    if (((distances[previous] > 0.0f) != (distances[i] > 0.0f)) && (clippedFace.count < s_maxFacePointCount))
+                    {
+                        clippedFace.points[clippedFace.count++] = Intersect(previous, i);
+                    }
+                    if ((distances[i] <= 0.0f) && (clippedFace.count < s_maxFacePointCount))
+                    {
+                        clippedFace.points[clippedFace.count++] = io_face.points[i];
+                    }
+                }
+                io_face = clippedFace;
+            }
+        }
+    }
+
+    void ClipFaceToPolygon(const sFace& i_polygon, const eae6320::Math::sVector& i_normal, sFace& io_face)
+    {
+        EAE6320_ASSERT(i_polygon.count >= 3);
+        eae6320::Math::sVector center;
+        for (unsigned int i = 0; i < i_polygon.count; ++i)
+        {
+            center += i_polygon.points[i];
+        }
+        center /= static_cast<float>(i_polygon.count);
+        for (unsigned int i = 0; (i < i_polygon.count) && (io_face.count > 0); ++i)
+        {
+            const auto& start = i_polygon.points[i];
+            const auto& end = i_polygon.points[(i + 1) % i_polygon.count];
+            // Each side's plane faces away from the center
+            auto sideNormal = Cross(end - start, i_normal);
+            if (Dot(sideNormal, center - start) > 0.0f)
+            {
+                sideNormal = -sideNormal;
+            }
+            ClipFace(start, sideNormal, io_face);
+        }
+    }
+
+    float CalculateDistanceToFace(const eae6320::Math::sVector& i_point, const eae6320::Math::sVector& i_direction, const sFace& i_polygon)
+    {
+        EAE6320_ASSERT(i_polygon.count >= 3);
+        const auto& pointOnPlane = i_polygon.points[0];
+        const auto planeNormal = Cross(i_polygon.points[1] - pointOnPlane, i_polygon.points[2] - pointOnPlane);
+        const auto denominator = Dot(planeNormal, i_direction);
+        // A face that is almost parallel to the direction uses the plane that is perpendicular to it instead
+        return (std::abs(denominator) > (1.0e-3f * planeNormal.GetLength())) ?
+            (Dot(planeNormal, pointOnPlane - i_point) / denominator) : Dot(pointOnPlane - i_point, i_direction);
+    }
+
+    unsigned int ReduceContacts(const eae6320::Physics::Narrowphase::sContact* const i_contacts, const unsigned int i_contactCount,
+        eae6320::Physics::Narrowphase::sContact (&o_contacts)[eae6320::Physics::Narrowphase::maxContactCount])
+    {
+        using namespace eae6320::Physics::Narrowphase;
+
+        if (i_contactCount <= maxContactCount)
+        {
+            std::copy(i_contacts, i_contacts + i_contactCount, o_contacts);
+            return i_contactCount;
+        }
+        // The contacts are chosen one at a time:
+        //  * The deepest
+        //  * The farthest from the deepest
+        //  * The one that makes the largest triangle with the first two
+        //  * The one that makes the largest quadrilateral with the first three
+        bool isChosen[s_maxFacePointCount] = {};
+        for (unsigned int chosenCount = 0; chosenCount < maxContactCount; ++chosenCount)
+        {
+            auto chosenIndex = i_contactCount;
+            auto largestMeasure = 0.0f;
+            for (unsigned int i = 0; i < i_contactCount; ++i)
+            {
+                if (isChosen[i])
+                {
+                    continue;
+                }
+                const auto& point = i_contacts[i].pointOnB;
+                float measure;
+                switch (chosenCount)
+                {
+                case 0:
+                    measure = i_contacts[i].depth;
+                    break;
+                case 1:
+                    {
+                        const auto offset = point - o_contacts[0].pointOnB;
+                        measure = Dot(offset, offset);
+                    }
+                    break;
+                case 2:
+                    {
+                        const auto cross = Cross(o_contacts[1].pointOnB - o_contacts[0].pointOnB, point - o_contacts[0].pointOnB);
+                        measure = Dot(cross, cross);
+                    }
+                    break;
+                default:
+                    measure = CalculateAreaMeasure(o_contacts[0].pointOnB, o_contacts[1].pointOnB, o_contacts[2].pointOnB, point);
+                }
+                if ((chosenIndex == i_contactCount) || (measure > largestMeasure))
+                {
+                    chosenIndex = i;
+                    largestMeasure = measure;
+                }
+            }
+            isChosen[chosenIndex] = true;
+            o_contacts[chosenCount] = i_contacts[chosenIndex];
+        }
+        return maxContactCount;
+    }
+
+    float CalculateAreaMeasure(const eae6320::Math::sVector& i_point0, const eae6320::Math::sVector& i_point1,
+        const eae6320::Math::sVector& i_point2, const eae6320::Math::sVector& i_point3)
+    {
+        // The cross product of a quadrilateral's diagonals is twice its area.
+        // Which pairs of points are the diagonals depends on the order of the points,
+        // and the actual diagonals are the pairing with the largest cross product
+        const auto cross0 = Cross(i_point0 - i_point1, i_point2 - i_point3);
+        const auto cross1 = Cross(i_point0 - i_point2, i_point1 - i_point3);
+        const auto cross2 = Cross(i_point0 - i_point3, i_point1 - i_point2);
+        return std::max(Dot(cross0, cross0), std::max(Dot(cross1, cross1), Dot(cross2, cross2)));
+    }
+}
@@ -0,0 +1,74 @@
+/*
+    The narrowphase calculates whether two shapes that the broadphase found are actually touching
+    and where their surfaces touch (or overlap)
+
+    First the deepest contact is found:
+        * Pairs of spheres and capsules are calculated directly from the closest points of their cores
+        * Every other pair uses the shapes' support points (see sShape::GetCoreSupportPoint()):
+            GJK finds the closest points of the cores if they don't overlap
+            and EPA finds the direction and depth of the overlap if they do
+    (a sphere or capsule that touches a box or a hull only needs EPA if its core is inside the other shape,
+    and so the rounded part of those shapes is always exact).
+
+    A single point isn't enough for a box to rest on another box, though,
+    and so the feature of each shape that faces the other along the contact normal
+    (a box's face, a capsule's segment, the points of a hull on a plane) is then clipped against the other's
+    to find every point where they touch.
+*/
+
+#ifndef EAE6320_PHYSICS_NARROWPHASE_H
+#define EAE6320_PHYSICS_NARROWPHASE_H
+
+// Include Files
+//==============
+
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        struct sShape;
+    }
+}
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        namespace Narrowphase
+        {
+            struct sContact
+            {
+                // The deepest point of each shape's surface in world space
+                Math::sVector pointOnA;
+                Math::sVector pointOnB;
+                // The unit direction from shape A to shape B
+                // (moving B along it separates the shapes)
+                Math::sVector normal;
+                // Positive if the shapes overlap and negative if there is a gap between them
+                float depth = 0.0f;
+            };
+
+            // If there are more contacts than this the ones that cover the largest area are chosen
+            constexpr unsigned int maxContactCount = 4;
+
+            // Returns the number of contacts,
+            // which is zero unless the shapes overlap or the gap between them is smaller than the margin
+            // (contacts that aren't touching yet let the solver stop the shapes before they overlap).
+            // Every contact has the same normal
+            unsigned int CalculateContacts(const sShape& i_shapeA, const Math::sVector& i_positionA, const Math::cQuaternion& i_orientationA,
+                const sShape& i_shapeB, const Math::sVector& i_positionB, const Math::cQuaternion& i_orientationB,
+                const float i_margin, sContact (&o_contacts)[maxContactCount]);
+        }
+    }
+}
+
+#endif    // EAE6320_PHYSICS_NARROWPHASE_H
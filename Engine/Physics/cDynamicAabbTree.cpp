@@ -0,0 +1,363 @@
+// Include Files
+//==============
+
+#include "cDynamicAabbTree.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr int32_t s_nullNode = -1;
+}
+
+// Inherited Interface
+//====================
+
+void eae6320::Physics::cDynamicAabbTree::AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds)
+{
+    if (i_proxyId >= m_leavesFromProxyIds.size())
+    {
+        m_leavesFromProxyIds.resize(i_proxyId + 1, s_nullNode);
+        m_boundsFromProxyIds.resize(i_proxyId + 1);
+    }
+    EAE6320_ASSERTF(m_leavesFromProxyIds[i_proxyId] == s_nullNode, "The proxy %u already exists", i_proxyId);
+
+    const auto leaf = AllocateNode();
+    {
+        auto& node = m_nodes[leaf];
+        node.bounds = i_bounds.GetExpanded(m_margin);
+        node.proxyId = i_proxyId;
+    }
+    m_boundsFromProxyIds[i_proxyId] = i_bounds;
+    m_leavesFromProxyIds[i_proxyId] = leaf;
+    InsertLeaf(leaf);
+}
+
+void eae6320::Physics::cDynamicAabbTree::RemoveProxy(const tProxyId i_proxyId)
+{
+    EAE6320_ASSERTF((i_proxyId < m_leavesFromProxyIds.size()) && (m_leavesFromProxyIds[i_proxyId] != s_nullNode),
+        "The proxy %u doesn't exist", i_proxyId);
+    const auto leaf = m_leavesFromProxyIds[i_proxyId];
+    RemoveLeaf(leaf);
+    FreeNode(leaf);
+    m_leavesFromProxyIds[i_proxyId] = s_nullNode;
+}
+
+void eae6320::Physics::cDynamicAabbTree::UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds)
+{
+    for (size_t i = 0, count = i_bounds.GetCount(); i < count; ++i)
+    {
+        const auto proxyId = i_proxyIds[i];
+        EAE6320_ASSERTF((proxyId < m_leavesFromProxyIds.size()) && (m_leavesFromProxyIds[proxyId] != s_nullNode),
+            "The proxy %u doesn't exist", proxyId);
+        const auto leaf = m_leavesFromProxyIds[proxyId];
+        const auto bounds = i_bounds.Get(i);
+        m_boundsFromProxyIds[proxyId] = bounds;
+        // The leaf only needs to be moved if the proxy has left its expanded box
+        auto& node = m_nodes[leaf];
+        if (!node.bounds.Contains(bounds))
+        {
+            node.bounds = bounds.GetExpanded(m_margin);
+            RemoveLeaf(leaf);
+            InsertLeaf(leaf);
+        }
+    }
+}
+
+void eae6320::Physics::cDynamicAabbTree::FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs)
+{
+    o_pairs.clear();
+    if (m_root == s_nullNode)
+    {
+        return;
+    }
+
+    m_stack.clear();
+    m_stack.push_back(sNodePair{ m_root, m_root });
+    while (!m_stack.empty())
+    {
+        const auto nodePair = m_stack.back();
+        m_stack.pop_back();
+        const auto& node_a = m_nodes[nodePair.node_a];
+        const auto& node_b = m_nodes[nodePair.node_b];
+
+        // The pairs inside of a subtree are the pairs inside of each child
+        // and the pairs between the two children
+        if (nodePair.node_a == nodePair.node_b)
+        {
+            if (!node_a.IsLeaf())
+            {
+                m_stack.push_back(sNodePair{ node_a.child1, node_a.child1 });
+                m_stack.push_back(sNodePair{ node_a.child2, node_a.child2 });
+                m_stack.push_back(sNodePair{ node_a.child1, node_a.child2 });
+            }
+            continue;
+        }
+
+        if (!node_a.bounds.Overlaps(node_b.bounds))
+        {
+            continue;
+        }
+        if (node_a.IsLeaf() && node_b.IsLeaf())
+        {
+            // The expanded boxes overlap, but the actual boxes might not
+            if (m_boundsFromProxyIds[node_a.proxyId].Overlaps(m_boundsFromProxyIds[node_b.proxyId]))
+            {
+                o_pairs.push_back((node_a.proxyId < node_b.proxyId) ?
+                    sOverlappingPair{ node_a.proxyId, node_b.proxyId } : sOverlappingPair{ node_b.proxyId, node_a.proxyId });
+            }
+        }
+        // The taller node is descended into so that both sides shrink at about the same rate
+        else if (node_b.IsLeaf() || (!node_a.IsLeaf() && (node_a.height >= node_b.height)))
+        {
+            m_stack.push_back(sNodePair{ node_a.child1, nodePair.node_b });
+            m_stack.push_back(sNodePair{ node_a.child2, nodePair.node_b });
+        }
+        else
+        {
+            m_stack.push_back(sNodePair{ nodePair.node_a, node_b.child1 });
+            m_stack.push_back(sNodePair{ nodePair.node_a, node_b.child2 });
+        }
+    }
+
+    std::sort(o_pairs.begin(), o_pairs.end());
+}
+
+void eae6320::Physics::cDynamicAabbTree::Clear()
+{
+    m_nodes.clear();
+    m_root = s_nullNode;
+    m_freeList = s_nullNode;
+    m_leavesFromProxyIds.clear();
+    m_boundsFromProxyIds.clear();
+}
+
+// Interface
+//==========
+
+int32_t eae6320::Physics::cDynamicAabbTree::GetHeight() const
+{
+    return (m_root != s_nullNode) ? m_nodes[m_root].height : -1;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::cDynamicAabbTree::cDynamicAabbTree(const float i_margin)
+    :
+    m_root(s_nullNode), m_freeList(s_nullNode), m_margin(i_margin)
+{
+    EAE6320_ASSERT(i_margin >= 0.0f);
+}
+
+// Implementation
+//===============
+
+int32_t eae6320::Physics::cDynamicAabbTree::AllocateNode()
+{
+    int32_t index;
+    if (m_freeList != s_nullNode)
+    {
+        index = m_freeList;
+        m_freeList = m_nodes[index].parent;
+    }
+    else
+    {
+        index = static_cast<int32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+    auto& node = m_nodes[index];
+    node.parent = s_nullNode;
+    node.child1 = node.child2 = s_nullNode;
+    node.height = 0;
+    node.proxyId = 0;
+    return index;
+}
+
+void eae6320::Physics::cDynamicAabbTree::FreeNode(const int32_t i_node)
+{
+    auto& node = m_nodes[i_node];
+    node.parent = m_freeList;
+    node.height = -1;
+    m_freeList = i_node;
+}
+
+void eae6320::Physics::cDynamicAabbTree::InsertLeaf(const int32_t i_leaf)
+{
+    if (m_root == s_nullNode)
+    {
+        m_root = i_leaf;
+        m_nodes[i_leaf].parent = s_nullNode;
+        return;
+    }
+
+    // Find the best sibling for the leaf
+    // by descending the tree towards the child that would grow the least
+    // (the cost of a node is its perimeter, which is proportional to how likely a query is to visit it)
+    const auto leafBounds = m_nodes[i_leaf].bounds;
+    auto sibling = m_root;
+    while (!m_nodes[sibling].IsLeaf())
+    {
+        const auto& node = m_nodes[sibling];
+        const auto perimeter = node.bounds.GetPerimeter();
+        const auto combinedPerimeter = Merge(node.bounds, leafBounds).GetPerimeter();
+        // The cost of making a new parent for this node and the leaf
+        const auto cost = 2.0f * combinedPerimeter;
+        // The minimum cost of pushing the leaf further down the tree
+        // (this node and all of its ancestors will grow)
+        const auto inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+        const auto GetDescendingCost = [this, &leafBounds, inheritanceCost](const int32_t i_child)
+        {
+            const auto& child = m_nodes[i_child];
+            const auto childPerimeter = Merge(leafBounds, child.bounds).GetPerimeter();
+            return (child.IsLeaf() ? childPerimeter : (childPerimeter - child.bounds.GetPerimeter())) + inheritanceCost;
+        };
+        const auto cost1 = GetDescendingCost(node.child1);
+        const auto cost2 = GetDescendingCost(node.child2);
+        if ((cost < cost1) && (cost < cost2))
+        {
+            break;
+        }
+        sibling = (cost1 < cost2) ? node.child1 : node.child2;
+    }
+
+    // Create a new parent for the leaf and its sibling
+    // (allocating can move the nodes, and so none of them are referenced until it's done)
+    const auto oldParent = m_nodes[sibling].parent;
+    const auto newParent = AllocateNode();
+    {
+        auto& node = m_nodes[newParent];
+        node.parent = oldParent;
+        node.bounds = Merge(leafBounds, m_nodes[sibling].bounds);
+        node.height = m_nodes[sibling].height + 1;
+        node.child1 = sibling;
+        node.child2 = i_leaf;
+    }
+    m_nodes[sibling].parent = newParent;
+    m_nodes[i_leaf].parent = newParent;
+    if (oldParent != s_nullNode)
+    {
+        auto& node = m_nodes[oldParent];
+        (node.child1 == sibling ? node.child1 : node.child2) = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    Refit(newParent);
+}
+
+void eae6320::Physics::cDynamicAabbTree::RemoveLeaf(const int32_t i_leaf)
+{
+    if (i_leaf == m_root)
+    {
+        m_root = s_nullNode;
+        return;
+    }
+
+    // The leaf's parent is removed and the leaf's sibling takes its place
+    const auto parent = m_nodes[i_leaf].parent;
+    const auto grandParent = m_nodes[parent].parent;
+    const auto sibling = (m_nodes[parent].child1 == i_leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+    m_nodes[sibling].parent = grandParent;
+    FreeNode(parent);
+    if (grandParent != s_nullNode)
+    {
+        auto& node = m_nodes[grandParent];
+        (node.child1 == parent ? node.child1 : node.child2) = sibling;
+        Refit(grandParent);
+    }
+    else
+    {
+        m_root = sibling;
+    }
+}
+
+void eae6320::Physics::cDynamicAabbTree::Refit(int32_t i_node)
+{
+    while (i_node != s_nullNode)
+    {
+        i_node = Balance(i_node);
+        auto& node = m_nodes[i_node];
+        const auto& child1 = m_nodes[node.child1];
+        const auto& child2 = m_nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.bounds = Merge(child1.bounds, child2.bounds);
+        i_node = node.parent;
+    }
+}
+
+int32_t eae6320::Physics::cDynamicAabbTree::Balance(const int32_t i_node)
+{
+    const auto iA = i_node;
+    auto& a = m_nodes[iA];
+    if (a.IsLeaf() || (a.height < 2))
+    {
+        return iA;
+    }
+
+    const auto iB = a.child1;
+    const auto iC = a.child2;
+    auto& b = m_nodes[iB];
+    auto& c = m_nodes[iC];
+    const auto balance = c.height - b.height;
+
+    // If one child is too tall it is rotated up into A's place
+    // and A takes the place of the rotated child's shorter child
+    const auto Rotate = [this, iA, &a](const int32_t i_up, sNode& io_up, int32_t& io_upInA, const int32_t i_other)
+    {
+        const auto iF = io_up.child1;
+        const auto iG = io_up.child2;
+        auto& f = m_nodes[iF];
+        auto& g = m_nodes[iG];
+        const auto& other = m_nodes[i_other];
+
+        // The rotated child replaces A
+        io_up.child1 = iA;
+        io_up.parent = a.parent;
+        a.parent = i_up;
+        if (io_up.parent != s_nullNode)
+        {
+            auto& parent = m_nodes[io_up.parent];
+            (parent.child1 == iA ? parent.child1 : parent.child2) = i_up;
+        }
+        else
+        {
+            m_root = i_up;
+        }
+
+        // The taller grandchild stays with the rotated child and the shorter one moves to A
+        const auto isFTaller = f.height > g.height;
+        const auto iTaller = isFTaller ? iF : iG;
+        const auto iShorter = isFTaller ? iG : iF;
+        auto& taller = m_nodes[iTaller];
+        auto& shorter = m_nodes[iShorter];
+        io_up.child2 = iTaller;
+        io_upInA = iShorter;
+        shorter.parent = iA;
+        a.bounds = Merge(other.bounds, shorter.bounds);
+        a.height = 1 + std::max(other.height, shorter.height);
+        io_up.bounds = Merge(a.bounds, taller.bounds);
+        io_up.height = 1 + std::max(a.height, taller.height);
+    };
+
+    if (balance > 1)
+    {
+        Rotate(iC, c, a.child2, iB);
+        return iC;
+    }
+    else if (balance < -1)
+    {
+        Rotate(iB, b, a.child1, iC);
+        return iB;
+    }
+    else
+    {
+        return iA;
+    }
+}
@@ -0,0 +1,118 @@
+/*
+    A broadphase that keeps the boxes in a bounding volume hierarchy
+
+    Every proxy is a leaf of a binary tree, and every other node's box contains the boxes of its children.
+    The box that is stored in a leaf is the proxy's box expanded by a margin
+    so that a proxy that only moves a little doesn't need to be moved in the tree.
+    When a proxy does move outside of its expanded box its leaf is removed and reinserted,
+    and the tree is rebalanced using rotations so that its height stays logarithmic.
+
+    The pairs are found by traversing the tree once and comparing it with itself:
+    two subtrees are only descended into if their boxes overlap,
+    which makes the cost depend on how close the boxes are to each other rather than on how they are spread out along an axis.
+*/
+
+#ifndef EAE6320_PHYSICS_CDYNAMICAABBTREE_H
+#define EAE6320_PHYSICS_CDYNAMICAABBTREE_H
+
+// Include Files
+//==============
+
+#include "cbBroadphase.h"
+#include "sAabb.h"
+
+#include <cstdint>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cDynamicAabbTree final : public cbBroadphase
+        {
+            // Inherited Interface
+            //====================
+
+        public:
+
+            void AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds) override;
+            void RemoveProxy(const tProxyId i_proxyId) override;
+            void UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds) override;
+
+            void FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs) override;
+
+            void Clear() override;
+
+            // Interface
+            //==========
+
+            // The height of a tree with a single leaf is 0
+            // (and an empty tree has a height of -1)
+            int32_t GetHeight() const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // A bigger margin means that proxies need to be reinserted less often
+            // but that more nodes are visited when finding pairs
+            explicit cDynamicAabbTree(const float i_margin = 0.1f);
+
+            // Data
+            //=====
+
+        private:
+
+            struct sNode
+            {
+                // The expanded box of a leaf or the box that contains both children
+                sAabb bounds;
+                // When a node is on the free list this is the index of the next free node
+                int32_t parent;
+                int32_t child1, child2;
+                // A leaf has a height of 0 and a free node has a height of -1
+                int32_t height;
+                tProxyId proxyId;
+
+                bool IsLeaf() const { return child1 < 0; }
+            };
+
+            std::vector<sNode> m_nodes;
+            int32_t m_root;
+            int32_t m_freeList;
+            std::vector<int32_t> m_leavesFromProxyIds;
+            // The actual boxes of the proxies
+            // (they are kept out of the nodes so that more nodes fit in the cache)
+            std::vector<sAabb> m_boundsFromProxyIds;
+            float m_margin;
+            // The pairs of nodes that still need to be compared when finding pairs
+            // (a node paired with itself means the pairs inside of its subtree).
+            // This is only a member so that the memory isn't allocated every update
+            struct sNodePair
+            {
+                int32_t node_a, node_b;
+            };
+            std::vector<sNodePair> m_stack;
+
+            // Implementation
+            //===============
+
+        private:
+
+            int32_t AllocateNode();
+            void FreeNode(const int32_t i_node);
+
+            void InsertLeaf(const int32_t i_leaf);
+            void RemoveLeaf(const int32_t i_leaf);
+            // Recalculates the boxes and heights of a node and all of its ancestors
+            void Refit(int32_t i_node);
+            // Rotates the node's children if one is more than 1 level taller than the other
+            // and returns the index of the node that is now in its place
+            int32_t Balance(const int32_t i_node);
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CDYNAMICAABBTREE_H
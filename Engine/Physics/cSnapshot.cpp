@@ -0,0 +1,26 @@
+// Include Files
+//==============
+
+#include "cSnapshot.h"
+
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/Hash.h>
+
+// Interface
+//==========
+
+void eae6320::Physics::cSnapshot::SetData(const void* const i_data, const size_t i_size)
+{
+    EAE6320_ASSERT(i_data || (i_size == 0));
+    m_data.resize(i_size);
+    if (i_size > 0)
+    {
+        std::memcpy(m_data.data(), i_data, i_size);
+    }
+}
+
+uint32_t eae6320::Physics::cSnapshot::CalculateChecksum() const
+{
+    return Math::CalculateXxHash32(m_data.data(), m_data.size());
+}
@@ -0,0 +1,68 @@
+/*
+    A snapshot is a copy of the state of a physics world at one moment
+    (see cWorld::SaveSnapshot() and cWorld::LoadSnapshot())
+
+    The state is stored in a single contiguous buffer.
+    Saving a snapshot is only a few memcpy()s of the world's arrays,
+    and a snapshot that is saved again reuses the memory that it already has.
+
+    The buffer is a plain sequence of bytes,
+    and so it can be written to a file (e.g. for a replay) or sent over a network
+    and then made into a snapshot again in another run.
+    The checksum can be compared between runs to verify that they are deterministic:
+    the same build of the same simulation given the same inputs has the same checksum after every update.
+*/
+
+#ifndef EAE6320_PHYSICS_CSNAPSHOT_H
+#define EAE6320_PHYSICS_CSNAPSHOT_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cSnapshot
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // Access
+            //-------
+
+            const void* GetData() const { return m_data.data(); }
+            size_t GetSize() const { return m_data.size(); }
+            bool IsEmpty() const { return m_data.empty(); }
+            // Replaces the snapshot with data that was saved from another snapshot
+            // (the data is validated when the snapshot is loaded into a world)
+            void SetData(const void* const i_data, const size_t i_size);
+
+            // A hash of every byte
+            uint32_t CalculateChecksum() const;
+
+            // Data
+            //=====
+
+        private:
+
+            std::vector<uint8_t> m_data;
+
+            // Friends
+            //========
+
+            friend class cWorld;
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CSNAPSHOT_H
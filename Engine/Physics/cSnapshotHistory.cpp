@@ -0,0 +1,96 @@
+// Include Files
+//==============
+
+#include "cSnapshotHistory.h"
+
+#include "cWorld.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+
+// Interface
+//==========
+
+// Access
+//-------
+
+void eae6320::Physics::cSnapshotHistory::Save(const uint64_t i_updateIndex, const cWorld& i_world)
+{
+    if (m_snapshotCount > 0)
+    {
+        if (i_updateIndex == m_newestUpdateIndex)
+        {
+            // The newest snapshot is replaced
+            --m_snapshotCount;
+        }
+        else if (i_updateIndex != (m_newestUpdateIndex + 1))
+        {
+            m_snapshotCount = 0;
+        }
+    }
+    i_world.SaveSnapshot(m_snapshots[i_updateIndex % m_snapshots.size()]);
+    m_newestUpdateIndex = i_updateIndex;
+    m_snapshotCount = std::min(m_snapshotCount + 1, m_snapshots.size());
+}
+
+const eae6320::Physics::cSnapshot* eae6320::Physics::cSnapshotHistory::Find(const uint64_t i_updateIndex) const
+{
+    if ((m_snapshotCount > 0) && (i_updateIndex <= m_newestUpdateIndex) && ((m_newestUpdateIndex - i_updateIndex) < m_snapshotCount))
+    {
+        return &m_snapshots[i_updateIndex % m_snapshots.size()];
+    }
+    return nullptr;
+}
+
+// Rollback
+//---------
+
+eae6320::cResult eae6320::Physics::cSnapshotHistory::RollBack(const uint64_t i_updateIndex, cWorld& io_world)
+{
+    const auto* const snapshot = Find(i_updateIndex);
+    if (!snapshot)
+    {
+        Logging::OutputError("The physics world can't be rolled back to update %llu because there is no snapshot of it",
+            static_cast<unsigned long long>(i_updateIndex));
+        return Results::Failure;
+    }
+    const auto result = io_world.LoadSnapshot(*snapshot);
+    if (result)
+    {
+        m_snapshotCount -= static_cast<size_t>(m_newestUpdateIndex - i_updateIndex);
+        m_newestUpdateIndex = i_updateIndex;
+    }
+    return result;
+}
+
+eae6320::cResult eae6320::Physics::cSnapshotHistory::Resimulate(const uint64_t i_fromUpdateIndex, const float i_secondCountPerUpdate,
+    cWorld& io_world, const fBeforeUpdate& i_beforeUpdate)
+{
+    const auto newestUpdateIndex = m_newestUpdateIndex;
+    const auto result = RollBack(i_fromUpdateIndex, io_world);
+    if (!result)
+    {
+        return result;
+    }
+    for (auto updateIndex = i_fromUpdateIndex; updateIndex <= newestUpdateIndex; ++updateIndex)
+    {
+        if (i_beforeUpdate)
+        {
+            i_beforeUpdate(updateIndex, io_world);
+        }
+        Save(updateIndex, io_world);
+        io_world.Update(i_secondCountPerUpdate);
+    }
+    return result;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::cSnapshotHistory::cSnapshotHistory(const size_t i_capacity)
+    :
+    m_snapshots(i_capacity)
+{
+    EAE6320_ASSERT(i_capacity > 0);
+}
@@ -0,0 +1,108 @@
+/*
+    A snapshot history keeps a snapshot of a physics world for each of the most recent simulation updates
+    so that the world can be rolled back to an earlier update and simulated forward again
+
+    This is what rollback networking needs:
+    when an input for an earlier update arrives late the world is rolled back to that update,
+    the input is applied, and the updates since then are simulated again.
+    The same history can also rewind a replay.
+
+    The snapshots are a ring buffer whose memory is reused,
+    and so saving a snapshot every update doesn't allocate once the history is full.
+    Simulating again is only the same as the first time if the world is deterministic
+    (see cWorld.h), which can be checked by comparing snapshot checksums (see cSnapshot.h).
+*/
+
+#ifndef EAE6320_PHYSICS_CSNAPSHOTHISTORY_H
+#define EAE6320_PHYSICS_CSNAPSHOTHISTORY_H
+
+// Include Files
+//==============
+
+#include "cSnapshot.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Results/Results.h>
+#include <functional>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cWorld;
+    }
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cSnapshotHistory
+        {
+            // Interface
+            //==========
+
+        public:
+
+            // This is called at the start of each update that is simulated again
+            // (e.g. to apply the inputs that were recorded for that update)
+            using fBeforeUpdate = std::function<void(const uint64_t i_updateIndex, cWorld& io_world)>;
+
+            // Access
+            //-------
+
+            // Saves the state of the world at the start of an update
+            // (i.e. after the updates before it and any input since then).
+            // Each update must be saved after the one before it
+            // (saving the newest update again replaces its snapshot,
+            // and saving any other update forgets the older snapshots)
+            void Save(const uint64_t i_updateIndex, const cWorld& i_world);
+            // Returns null if there is no snapshot of the update
+            // (it was never saved, it has been overwritten, or it was forgotten by a rollback)
+            const cSnapshot* Find(const uint64_t i_updateIndex) const;
+            size_t GetSnapshotCount() const { return m_snapshotCount; }
+            // These are only valid if there is at least one snapshot
+            uint64_t GetOldestUpdateIndex() const { return m_newestUpdateIndex + 1 - m_snapshotCount; }
+            uint64_t GetNewestUpdateIndex() const { return m_newestUpdateIndex; }
+
+            // Rollback
+            //---------
+
+            // Restores the world to the start of an earlier update
+            // and forgets the snapshots of every update after it
+            cResult RollBack(const uint64_t i_updateIndex, cWorld& io_world);
+            // Rolls the world back to the start of an earlier update
+            // and then simulates it until the end of the newest update,
+            // saving a new snapshot at the start of each update
+            // (the world is then in the same state as it would be if those updates had just been simulated normally)
+            cResult Resimulate(const uint64_t i_fromUpdateIndex, const float i_secondCountPerUpdate, cWorld& io_world,
+                const fBeforeUpdate& i_beforeUpdate = fBeforeUpdate());
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            explicit cSnapshotHistory(const size_t i_capacity);
+
+            void Clear() { m_snapshotCount = 0; }
+
+            // Data
+            //=====
+
+        private:
+
+            std::vector<cSnapshot> m_snapshots;
+            uint64_t m_newestUpdateIndex = 0;
+            size_t m_snapshotCount = 0;
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CSNAPSHOTHISTORY_H
@@ -0,0 +1,1034 @@
+// Include Files
+//==============
+
+#include "cSpatialHashGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/Simd.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Math/sVector4.h>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr auto s_invalidIndex = ~static_cast<uint32_t>(0);
+    constexpr uint32_t s_largeProxyCellIndex = 0;
+    // A box can't be bigger than this fraction of a cell and still be stored in a cell.
+    // It is a little less than a whole cell so that rounding when calculating which cell a box's center is in
+    // can't make the box stick out of the cell by more than half of a cell
+    constexpr float s_maxProxySizeInCells = 0.9375f;
+    // Each coordinate of a cell is packed into 21 bits of the hash table's key
+    constexpr int32_t s_minCellCoordinate = -(1 << 20);
+    constexpr int32_t s_maxCellCoordinate = (1 << 20) - 1;
+    // No cell's key can be this because it uses 64 bits
+    constexpr auto s_emptyHashTableKey = ~static_cast<uint64_t>(0);
+    constexpr size_t s_minHashTableSize = 64;
+    // A direction's component that is smaller than this is treated as 0 when casting a ray
+    constexpr float s_minRayDirection = 1.0e-30f;
+    // A block of cells is split until it has at most this many cells,
+    // and then each of its cells is looked up in the hash table
+    constexpr uint64_t s_maxCellCountPerBlock = 8;
+    // Looking up a cell in the hash table is slower than checking the coordinates of a cell that exists
+    // (the cells are next to each other in memory),
+    // and so every cell is checked instead when that would check fewer than this many cells for each cell that would be looked up
+    constexpr uint64_t s_cellCountToCheckPerLookUp = 2;
+    // Each split halves the longest side of a block, and a side can't be longer than the range of cell coordinates,
+    // and so the blocks that are waiting to be checked never need more space than this
+    constexpr size_t s_maxBlockStackSize = (3 * 21) + 1;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    uint64_t PackCellKey(const int32_t i_x, const int32_t i_y, const int32_t i_z);
+    size_t HashCellKey(const uint64_t i_key);
+    // Returns the coordinate of the cell that contains the position clamped to the range that can be stored
+    int32_t CalculateClampedCellCoordinate(const float i_position, const float i_inverseCellSize);
+
+    // These are written once as templates so that they can compare four boxes at a time
+    // and also the boxes that are left over at the end of an array (see Simd.h)
+
+    template <typename tFloat> tFloat Splat(const float i_value);
+    template <> float Splat<float>(const float i_value);
+#if defined( EAE6320_MATH_SIMD )
+    template <> eae6320::Math::Simd::tFloat4 Splat<eae6320::Math::Simd::tFloat4>(const float i_value);
+#endif
+    template <typename tFloat> tFloat Minimum(const tFloat i_lhs, const tFloat i_rhs);
+    template <typename tFloat> tFloat Maximum(const tFloat i_lhs, const tFloat i_rhs);
+
+    struct sRay
+    {
+        float origin[3];
+        float inverseDirection[3];
+        float maxDistance;
+    };
+    // Returns where the ray enters the box (which is never less than 0) and where it exits it,
+    // and so the ray hits the box if the entry is before both the exit and the ray's max distance
+    template <typename tFloat>
+    tFloat CalculateRayEntry(const sRay& i_ray,
+        const tFloat i_minimum_x, const tFloat i_minimum_y, const tFloat i_minimum_z,
+        const tFloat i_maximum_x, const tFloat i_maximum_y, const tFloat i_maximum_z,
+        tFloat& o_exit);
+
+    // Calls i_test() with the components of four boxes at a time (and then one at a time for the rest)
+    // starting at i_begin, and calls i_output(index) for every box that passes
+    template <typename tTest, typename tOutput>
+    void TestBoxes(const eae6320::Physics::sAabbArrays& i_bounds, const size_t i_begin, const tTest& i_test, const tOutput& i_output);
+}
+
+// Inherited Interface
+//====================
+
+void eae6320::Physics::cSpatialHashGrid::AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds)
+{
+    if (i_proxyId >= m_proxyLocations.size())
+    {
+        m_proxyLocations.resize(i_proxyId + 1, sProxyLocation{ s_invalidIndex, s_invalidIndex });
+    }
+    EAE6320_ASSERTF(m_proxyLocations[i_proxyId].cellIndex == s_invalidIndex, "The proxy %u already exists", i_proxyId);
+    const auto cellIndex = FindOrCreateCell(i_bounds);
+    auto& cell = m_cells[cellIndex];
+    m_proxyLocations[i_proxyId] = sProxyLocation{ cellIndex, static_cast<uint32_t>(cell.proxyIds.size()) };
+    cell.bounds.Append(i_bounds);
+    cell.proxyIds.push_back(i_proxyId);
+    ++m_proxyCount;
+}
+
+void eae6320::Physics::cSpatialHashGrid::RemoveProxy(const tProxyId i_proxyId)
+{
+    EAE6320_ASSERTF(DoesProxyExist(i_proxyId), "The proxy %u doesn't exist", i_proxyId);
+    auto& location = m_proxyLocations[i_proxyId];
+    RemoveFromCell(location.cellIndex, location.index);
+    location = sProxyLocation{ s_invalidIndex, s_invalidIndex };
+    --m_proxyCount;
+}
+
+void eae6320::Physics::cSpatialHashGrid::UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds)
+{
+    for (size_t i = 0, count = i_bounds.GetCount(); i < count; ++i)
+    {
+        UpdateProxy(i_proxyIds[i], i_bounds.Get(i));
+    }
+}
+
+void eae6320::Physics::cSpatialHashGrid::FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs)
+{
+    o_pairs.clear();
+
+    // Compares one box with the boxes of a cell starting at i_begin
+    const auto AddPairs = [&o_pairs](const sCell& i_cell_a, const size_t i_index_a, const sCell& i_cell_b, const size_t i_begin)
+    {
+        const auto bounds_a = i_cell_a.bounds.Get(i_index_a);
+        const auto proxyId_a = i_cell_a.proxyIds[i_index_a];
+        TestBoxes(i_cell_b.bounds, i_begin,
+            [&bounds_a](const auto i_minimum_x, const auto i_minimum_y, const auto i_minimum_z,
+                const auto i_maximum_x, const auto i_maximum_y, const auto i_maximum_z)
+            {
+                using namespace Math;
+                using tFloat = std::decay_t<decltype(i_minimum_x)>;
+                return Simd::And(
+                    Simd::And(
+                        Simd::And(Simd::LessThanOrEqual(i_minimum_x, Splat<tFloat>(bounds_a.maximum.x)), Simd::LessThanOrEqual(Splat<tFloat>(bounds_a.minimum.x), i_maximum_x)),
+                        Simd::And(Simd::LessThanOrEqual(i_minimum_y, Splat<tFloat>(bounds_a.maximum.y)), Simd::LessThanOrEqual(Splat<tFloat>(bounds_a.minimum.y), i_maximum_y))),
+                    Simd::And(Simd::LessThanOrEqual(i_minimum_z, Splat<tFloat>(bounds_a.maximum.z)), Simd::LessThanOrEqual(Splat<tFloat>(bounds_a.minimum.z), i_maximum_z)));
+            },
+            [&o_pairs, &i_cell_b, proxyId_a](const size_t i_index_b)
+            {
+                const auto proxyId_b = i_cell_b.proxyIds[i_index_b];
+                o_pairs.push_back((proxyId_a < proxyId_b) ? sOverlappingPair{ proxyId_a, proxyId_b } : sOverlappingPair{ proxyId_b, proxyId_a });
+            });
+    };
+
+    // Large proxies could overlap anything,
+    // and so each one is compared with the large proxies after it and with every other cell
+    const auto& largeProxyCell = m_cells[s_largeProxyCellIndex];
+    for (size_t i = 0, count = largeProxyCell.proxyIds.size(); i < count; ++i)
+    {
+        AddPairs(largeProxyCell, i, largeProxyCell, i + 1);
+        for (size_t j = 1, cellCount = m_cells.size(); j < cellCount; ++j)
+        {
+            AddPairs(largeProxyCell, i, m_cells[j], 0);
+        }
+    }
+
+    // The boxes in a cell can only overlap boxes in the same cell or in a neighboring one,
+    // and so each cell is compared with itself and with the 13 neighbors that come after it
+    // (the other 13 neighbors compare themselves with it)
+    constexpr int32_t neighborOffsets[13][3] =
+    {
+        { 1, -1, -1 }, { 1, -1, 0 }, { 1, -1, 1 },
+        { 1, 0, -1 }, { 1, 0, 0 }, { 1, 0, 1 },
+        { 1, 1, -1 }, { 1, 1, 0 }, { 1, 1, 1 },
+        { 0, 1, -1 }, { 0, 1, 0 }, { 0, 1, 1 },
+        { 0, 0, 1 },
+    };
+    for (size_t i = 1, cellCount = m_cells.size(); i < cellCount; ++i)
+    {
+        const auto& cell = m_cells[i];
+        const auto count = cell.proxyIds.size();
+        for (size_t j = 0; j < count; ++j)
+        {
+            AddPairs(cell, j, cell, j + 1);
+        }
+        for (const auto& neighborOffset : neighborOffsets)
+        {
+            const auto neighborIndex = FindCell(cell.x + neighborOffset[0], cell.y + neighborOffset[1], cell.z + neighborOffset[2]);
+            if (neighborIndex != s_invalidIndex)
+            {
+                const auto& neighbor = m_cells[neighborIndex];
+                for (size_t j = 0; j < count; ++j)
+                {
+                    AddPairs(cell, j, neighbor, 0);
+                }
+            }
+        }
+    }
+
+    std::sort(o_pairs.begin(), o_pairs.end());
+}
+
+void eae6320::Physics::cSpatialHashGrid::Clear()
+{
+    m_cells.resize(1);
+    m_cells[s_largeProxyCellIndex].bounds.Clear();
+    m_cells[s_largeProxyCellIndex].proxyIds.clear();
+    std::fill(m_hashTableKeys.begin(), m_hashTableKeys.end(), s_emptyHashTableKey);
+    m_proxyLocations.clear();
+    m_proxyCount = 0;
+}
+
+// Interface
+//==========
+
+// Proxies
+//--------
+
+void eae6320::Physics::cSpatialHashGrid::UpdateProxy(const tProxyId i_proxyId, const sAabb& i_bounds)
+{
+    EAE6320_ASSERTF(DoesProxyExist(i_proxyId), "The proxy %u doesn't exist", i_proxyId);
+    auto& location = m_proxyLocations[i_proxyId];
+
+    // If the box is still in the same cell then only its bounds change
+    {
+        int32_t coordinates[3];
+        const auto isInACell = CalculateCellCoordinates(i_bounds, coordinates);
+        auto& cell = m_cells[location.cellIndex];
+        if (isInACell ?
+            ((location.cellIndex != s_largeProxyCellIndex) && (cell.x == coordinates[0]) && (cell.y == coordinates[1]) && (cell.z == coordinates[2])) :
+            (location.cellIndex == s_largeProxyCellIndex))
+        {
+            cell.bounds.Set(location.index, i_bounds);
+            return;
+        }
+    }
+
+    // Otherwise it is moved to its new cell
+    RemoveFromCell(location.cellIndex, location.index);
+    const auto cellIndex = FindOrCreateCell(i_bounds);
+    auto& cell = m_cells[cellIndex];
+    location = sProxyLocation{ cellIndex, static_cast<uint32_t>(cell.proxyIds.size()) };
+    cell.bounds.Append(i_bounds);
+    cell.proxyIds.push_back(i_proxyId);
+}
+
+bool eae6320::Physics::cSpatialHashGrid::DoesProxyExist(const tProxyId i_proxyId) const
+{
+    return (i_proxyId < m_proxyLocations.size()) && (m_proxyLocations[i_proxyId].cellIndex != s_invalidIndex);
+}
+
+eae6320::Physics::sAabb eae6320::Physics::cSpatialHashGrid::GetBounds(const tProxyId i_proxyId) const
+{
+    EAE6320_ASSERTF(DoesProxyExist(i_proxyId), "The proxy %u doesn't exist", i_proxyId);
+    const auto& location = m_proxyLocations[i_proxyId];
+    return m_cells[location.cellIndex].bounds.Get(location.index);
+}
+
+// Queries
+//--------
+
+void eae6320::Physics::cSpatialHashGrid::QueryAabb(const sAabb& i_bounds, std::vector<tProxyId>& o_proxyIds) const
+{
+    o_proxyIds.clear();
+
+    int32_t cellRange_minimum[3], cellRange_maximum[3];
+    CalculateCellRange(i_bounds, cellRange_minimum, cellRange_maximum);
+    ForEachCellInRange(cellRange_minimum, cellRange_maximum, [&i_bounds, &o_proxyIds](const sCell& i_cell)
+    {
+        TestBoxes(i_cell.bounds, 0,
+            [&i_bounds](const auto i_minimum_x, const auto i_minimum_y, const auto i_minimum_z,
+                const auto i_maximum_x, const auto i_maximum_y, const auto i_maximum_z)
+            {
+                using namespace Math;
+                using tFloat = std::decay_t<decltype(i_minimum_x)>;
+                return Simd::And(
+                    Simd::And(
+                        Simd::And(Simd::LessThanOrEqual(i_minimum_x, Splat<tFloat>(i_bounds.maximum.x)), Simd::LessThanOrEqual(Splat<tFloat>(i_bounds.minimum.x), i_maximum_x)),
+                        Simd::And(Simd::LessThanOrEqual(i_minimum_y, Splat<tFloat>(i_bounds.maximum.y)), Simd::LessThanOrEqual(Splat<tFloat>(i_bounds.minimum.y), i_maximum_y))),
+                    Simd::And(Simd::LessThanOrEqual(i_minimum_z, Splat<tFloat>(i_bounds.maximum.z)), Simd::LessThanOrEqual(Splat<tFloat>(i_bounds.minimum.z), i_maximum_z)));
+            },
+            [&i_cell, &o_proxyIds](const size_t i_index)
+            {
+                o_proxyIds.push_back(i_cell.proxyIds[i_index]);
+            });
+    });
+}
+
+void eae6320::Physics::cSpatialHashGrid::QuerySphere(const Math::sVector& i_center, const float i_radius, std::vector<tProxyId>& o_proxyIds) const
+{
+    o_proxyIds.clear();
+
+    // A box overlaps the sphere if the closest position in the box to the center is inside of the sphere
+    const auto radiusSquared = i_radius * i_radius;
+    const auto IsInside = [&i_center, radiusSquared](const auto i_minimum_x, const auto i_minimum_y, const auto i_minimum_z,
+        const auto i_maximum_x, const auto i_maximum_y, const auto i_maximum_z)
+    {
+        using namespace Math;
+        using tFloat = std::decay_t<decltype(i_minimum_x)>;
+        const auto zero = Splat<tFloat>(0.0f);
+        const auto center_x = Splat<tFloat>(i_center.x);
+        const auto center_y = Splat<tFloat>(i_center.y);
+        const auto center_z = Splat<tFloat>(i_center.z);
+        // (at most one of the two distances along each axis is positive)
+        const auto distance_x = Simd::Add(Maximum(Simd::Subtract(i_minimum_x, center_x), zero), Maximum(Simd::Subtract(center_x, i_maximum_x), zero));
+        const auto distance_y = Simd::Add(Maximum(Simd::Subtract(i_minimum_y, center_y), zero), Maximum(Simd::Subtract(center_y, i_maximum_y), zero));
+        const auto distance_z = Simd::Add(Maximum(Simd::Subtract(i_minimum_z, center_z), zero), Maximum(Simd::Subtract(center_z, i_maximum_z), zero));
+        const auto distanceSquared = Simd::Add(Simd::Add(Simd::Multiply(distance_x, distance_x), Simd::Multiply(distance_y, distance_y)),
+            Simd::Multiply(distance_z, distance_z));
+        return Simd::LessThanOrEqual(distanceSquared, Splat<tFloat>(radiusSquared));
+    };
+
+    // A box is entirely inside of the sphere if the farthest position in the box from the center is inside of the sphere
+    const auto IsEntirelyInside = [&i_center, radiusSquared](const float i_minimum_x, const float i_minimum_y, const float i_minimum_z,
+        const float i_maximum_x, const float i_maximum_y, const float i_maximum_z)
+    {
+        const auto distance_x = std::max(i_center.x - i_minimum_x, i_maximum_x - i_center.x);
+        const auto distance_y = std::max(i_center.y - i_minimum_y, i_maximum_y - i_center.y);
+        const auto distance_z = std::max(i_center.z - i_minimum_z, i_maximum_z - i_center.z);
+        return (((distance_x * distance_x) + (distance_y * distance_y)) + (distance_z * distance_z)) <= radiusSquared;
+    };
+
+    const Math::sVector extents(i_radius, i_radius, i_radius);
+    const sAabb bounds(i_center - extents, i_center + extents);
+    int32_t cellRange_minimum[3], cellRange_maximum[3];
+    CalculateCellRange(bounds, cellRange_minimum, cellRange_maximum);
+    ForEachCellInShape(cellRange_minimum, cellRange_maximum, IsInside, IsEntirelyInside,
+        [&IsInside, &o_proxyIds](const sCell& i_cell, const bool i_isEntirelyInside)
+    {
+        if (i_isEntirelyInside)
+        {
+            o_proxyIds.insert(o_proxyIds.end(), i_cell.proxyIds.begin(), i_cell.proxyIds.end());
+            return;
+        }
+        TestBoxes(i_cell.bounds, 0, IsInside, [&i_cell, &o_proxyIds](const size_t i_index)
+        {
+            o_proxyIds.push_back(i_cell.proxyIds[i_index]);
+        });
+    });
+}
+
+void eae6320::Physics::cSpatialHashGrid::QueryFrustum(const Math::cMatrixTransformation& i_transform_worldToProjected,
+    std::vector<tProxyId>& o_proxyIds) const
+{
+    o_proxyIds.clear();
+
+    // The frustum's bounds are the bounds of its corners
+    // (a frustum without a finite far plane could cover anything)
+    sAabb frustumBounds;
+    {
+        Math::sVector corners[8];
+        if (i_transform_worldToProjected.GetClipSpaceCorners(corners))
+        {
+            frustumBounds = sAabb(corners[0], corners[0]);
+            for (size_t i = 1; i < 8; ++i)
+            {
+                frustumBounds = Merge(frustumBounds, sAabb(corners[i], corners[i]));
+            }
+        }
+        else
+        {
+            const auto maxFloat = std::numeric_limits<float>::max();
+            frustumBounds = sAabb(Math::sVector(-maxFloat, -maxFloat, -maxFloat), Math::sVector(maxFloat, maxFloat, maxFloat));
+        }
+    }
+    Math::sVector4 planes[6];
+    i_transform_worldToProjected.GetClipSpacePlanes(planes);
+    // A box is outside of a plane if the corner that is farthest in the direction of the plane's normal is outside of it.
+    // A box near an edge of the frustum can be inside of every plane but still outside of the frustum,
+    // and so boxes that don't overlap the frustum's bounds are also rejected
+    const auto IsInside = [&planes, &frustumBounds](const auto i_minimum_x, const auto i_minimum_y, const auto i_minimum_z,
+        const auto i_maximum_x, const auto i_maximum_y, const auto i_maximum_z)
+    {
+        using namespace Math;
+        using tFloat = std::decay_t<decltype(i_minimum_x)>;
+        const auto IsInsideOfPlane = [&](const sVector4& i_plane)
+        {
+            const auto distance = Simd::Add(Simd::Add(Simd::Add(
+                Simd::Multiply(Splat<tFloat>(i_plane.x), (i_plane.x >= 0.0f) ? i_maximum_x : i_minimum_x),
+                Simd::Multiply(Splat<tFloat>(i_plane.y), (i_plane.y >= 0.0f) ? i_maximum_y : i_minimum_y)),
+                Simd::Multiply(Splat<tFloat>(i_plane.z), (i_plane.z >= 0.0f) ? i_maximum_z : i_minimum_z)),
+                Splat<tFloat>(i_plane.w));
+            return Simd::LessThanOrEqual(Splat<tFloat>(0.0f), distance);
+        };
+        const auto doBoundsOverlap = Simd::And(
+            Simd::And(
+                Simd::And(Simd::LessThanOrEqual(i_minimum_x, Splat<tFloat>(frustumBounds.maximum.x)), Simd::LessThanOrEqual(Splat<tFloat>(frustumBounds.minimum.x), i_maximum_x)),
+                Simd::And(Simd::LessThanOrEqual(i_minimum_y, Splat<tFloat>(frustumBounds.maximum.y)), Simd::LessThanOrEqual(Splat<tFloat>(frustumBounds.minimum.y), i_maximum_y))),
+            Simd::And(Simd::LessThanOrEqual(i_minimum_z, Splat<tFloat>(frustumBounds.maximum.z)), Simd::LessThanOrEqual(Splat<tFloat>(frustumBounds.minimum.z), i_maximum_z)));
+        return Simd::And(Simd::And(Simd::And(
+            Simd::And(IsInsideOfPlane(planes[0]), IsInsideOfPlane(planes[1])),
+            Simd::And(IsInsideOfPlane(planes[2]), IsInsideOfPlane(planes[3]))),
+            Simd::And(IsInsideOfPlane(planes[4]), IsInsideOfPlane(planes[5]))),
+            doBoundsOverlap);
+    };
+
+    // A box is entirely inside of the frustum if the corner that is nearest in the direction of each plane's normal is inside of it
+    // (it must also be inside of the frustum's bounds so that every box in it passes IsInside())
+    const auto IsEntirelyInside = [&planes, &frustumBounds](const float i_minimum_x, const float i_minimum_y, const float i_minimum_z,
+        const float i_maximum_x, const float i_maximum_y, const float i_maximum_z)
+    {
+        if (!((frustumBounds.minimum.x <= i_minimum_x) && (i_maximum_x <= frustumBounds.maximum.x)
+            && (frustumBounds.minimum.y <= i_minimum_y) && (i_maximum_y <= frustumBounds.maximum.y)
+            && (frustumBounds.minimum.z <= i_minimum_z) && (i_maximum_z <= frustumBounds.maximum.z)))
+        {
+            return false;
+        }
+        for (const auto& plane : planes)
+        {
+            const auto distance = (((plane.x * ((plane.x >= 0.0f) ? i_minimum_x : i_maximum_x))
+                + (plane.y * ((plane.y >= 0.0f) ? i_minimum_y : i_maximum_y)))
+                + (plane.z * ((plane.z >= 0.0f) ? i_minimum_z : i_maximum_z)))
+                + plane.w;
+            if (!(0.0f <= distance))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Only the cells that the frustum's bounds touch are checked,
+    // and blocks of them that are outside of the frustum are rejected as a whole
+    // (most of the cells in the bounds of a frustum are outside of it)
+    int32_t cellRange_minimum[3], cellRange_maximum[3];
+    CalculateCellRange(frustumBounds, cellRange_minimum, cellRange_maximum);
+    ForEachCellInShape(cellRange_minimum, cellRange_maximum, IsInside, IsEntirelyInside,
+        [&IsInside, &o_proxyIds](const sCell& i_cell, const bool i_isEntirelyInside)
+    {
+        if (i_isEntirelyInside)
+        {
+            o_proxyIds.insert(o_proxyIds.end(), i_cell.proxyIds.begin(), i_cell.proxyIds.end());
+            return;
+        }
+        TestBoxes(i_cell.bounds, 0, IsInside, [&i_cell, &o_proxyIds](const size_t i_index)
+        {
+            o_proxyIds.push_back(i_cell.proxyIds[i_index]);
+        });
+    });
+}
+
+void eae6320::Physics::cSpatialHashGrid::Raycast(const Math::sVector& i_origin, const Math::sVector& i_direction, const float i_maxDistance,
+    std::vector<sRayHit>& o_hits) const
+{
+    o_hits.clear();
+
+    // A component of the direction that is 0 would make the distances to the planes of that axis infinite
+    // (or not a number if the ray starts on one of them),
+    // and so a huge number is used instead
+    const auto CalculateInverse = [](const float i_value)
+    {
+        return (std::abs(i_value) >= s_minRayDirection) ? (1.0f / i_value) : (1.0f / s_minRayDirection);
+    };
+    sRay ray;
+    ray.origin[0] = i_origin.x;
+    ray.origin[1] = i_origin.y;
+    ray.origin[2] = i_origin.z;
+    ray.inverseDirection[0] = CalculateInverse(i_direction.x);
+    ray.inverseDirection[1] = CalculateInverse(i_direction.y);
+    ray.inverseDirection[2] = CalculateInverse(i_direction.z);
+    ray.maxDistance = i_maxDistance;
+    const auto IsHit = [&ray](const auto i_minimum_x, const auto i_minimum_y, const auto i_minimum_z,
+        const auto i_maximum_x, const auto i_maximum_y, const auto i_maximum_z)
+    {
+        using namespace Math;
+        using tFloat = std::decay_t<decltype(i_minimum_x)>;
+        tFloat exit;
+        const auto entry = CalculateRayEntry(ray, i_minimum_x, i_minimum_y, i_minimum_z, i_maximum_x, i_maximum_y, i_maximum_z, exit);
+        return Simd::And(Simd::LessThanOrEqual(entry, exit), Simd::LessThanOrEqual(entry, Splat<tFloat>(ray.maxDistance)));
+    };
+
+    const auto end = i_origin + (i_direction * i_maxDistance);
+    const sAabb bounds(
+        Math::sVector(std::min(i_origin.x, end.x), std::min(i_origin.y, end.y), std::min(i_origin.z, end.z)),
+        Math::sVector(std::max(i_origin.x, end.x), std::max(i_origin.y, end.y), std::max(i_origin.z, end.z)));
+    int32_t cellRange_minimum[3], cellRange_maximum[3];
+    CalculateCellRange(bounds, cellRange_minimum, cellRange_maximum);
+    // A ray can't have a box entirely inside of it
+    const auto IsEntirelyInside = [](const float, const float, const float, const float, const float, const float) { return false; };
+    ForEachCellInShape(cellRange_minimum, cellRange_maximum, IsHit, IsEntirelyInside, [&ray, &IsHit, &o_hits](const sCell& i_cell, const bool)
+    {
+        TestBoxes(i_cell.bounds, 0, IsHit, [&ray, &i_cell, &o_hits](const size_t i_index)
+        {
+            // The distance of a hit is calculated again
+            // (which gives the same result as the SIMD calculation)
+            const auto& bounds = i_cell.bounds;
+            float exit;
+            const auto entry = CalculateRayEntry(ray, bounds.minimum_x[i_index], bounds.minimum_y[i_index], bounds.minimum_z[i_index],
+                bounds.maximum_x[i_index], bounds.maximum_y[i_index], bounds.maximum_z[i_index], exit);
+            o_hits.push_back(sRayHit{ i_cell.proxyIds[i_index], entry });
+        });
+    });
+
+    std::sort(o_hits.begin(), o_hits.end(), [](const sRayHit& i_lhs, const sRayHit& i_rhs)
+    {
+        return (i_lhs.distance < i_rhs.distance) || ((i_lhs.distance == i_rhs.distance) && (i_lhs.proxyId < i_rhs.proxyId));
+    });
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::cSpatialHashGrid::cSpatialHashGrid(const float i_cellSize)
+    :
+    m_cells(1), m_cellSize(i_cellSize), m_inverseCellSize(1.0f / i_cellSize)
+{
+    EAE6320_ASSERT(i_cellSize > 0.0f);
+}
+
+// Implementation
+//===============
+
+bool eae6320::Physics::cSpatialHashGrid::CalculateCellCoordinates(const sAabb& i_bounds, int32_t (&o_coordinates)[3]) const
+{
+    const auto maxSize = m_cellSize * s_maxProxySizeInCells;
+    const auto size = i_bounds.maximum - i_bounds.minimum;
+    if (!((size.x <= maxSize) && (size.y <= maxSize) && (size.z <= maxSize)))
+    {
+        return false;
+    }
+    const auto center = (i_bounds.minimum + i_bounds.maximum) * 0.5f;
+    const float centerComponents[] = { center.x, center.y, center.z };
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const auto coordinate = std::floor(centerComponents[i] * m_inverseCellSize);
+        // (this is false if the coordinate isn't a number)
+        if (!((coordinate >= static_cast<float>(s_minCellCoordinate)) && (coordinate <= static_cast<float>(s_maxCellCoordinate))))
+        {
+            return false;
+        }
+        o_coordinates[i] = static_cast<int32_t>(coordinate);
+    }
+    return true;
+}
+
+uint32_t eae6320::Physics::cSpatialHashGrid::FindOrCreateCell(const sAabb& i_bounds)
+{
+    int32_t coordinates[3];
+    if (!CalculateCellCoordinates(i_bounds, coordinates))
+    {
+        return s_largeProxyCellIndex;
+    }
+    {
+        const auto cellIndex = FindCell(coordinates[0], coordinates[1], coordinates[2]);
+        if (cellIndex != s_invalidIndex)
+        {
+            return cellIndex;
+        }
+    }
+
+    // The hash table is kept at most half full so that searches stay short
+    if ((m_cells.size() * 2) > m_hashTableKeys.size())
+    {
+        GrowHashTable();
+    }
+    const auto cellIndex = static_cast<uint32_t>(m_cells.size());
+    m_cells.emplace_back();
+    auto& cell = m_cells.back();
+    cell.x = coordinates[0];
+    cell.y = coordinates[1];
+    cell.z = coordinates[2];
+    const auto key = PackCellKey(cell.x, cell.y, cell.z);
+    const auto slot = FindHashTableSlot(key);
+    m_hashTableKeys[slot] = key;
+    m_hashTableCellIndices[slot] = cellIndex;
+    return cellIndex;
+}
+
+uint32_t eae6320::Physics::cSpatialHashGrid::FindCell(const int32_t i_x, const int32_t i_y, const int32_t i_z) const
+{
+    if (m_hashTableKeys.empty()
+        || (i_x < s_minCellCoordinate) || (i_x > s_maxCellCoordinate)
+        || (i_y < s_minCellCoordinate) || (i_y > s_maxCellCoordinate)
+        || (i_z < s_minCellCoordinate) || (i_z > s_maxCellCoordinate))
+    {
+        return s_invalidIndex;
+    }
+    const auto key = PackCellKey(i_x, i_y, i_z);
+    const auto slot = FindHashTableSlot(key);
+    return (m_hashTableKeys[slot] == key) ? m_hashTableCellIndices[slot] : s_invalidIndex;
+}
+
+void eae6320::Physics::cSpatialHashGrid::RemoveFromCell(const uint32_t i_cellIndex, const uint32_t i_index)
+{
+    // The last box in the cell is moved into the removed box's place
+    auto& cell = m_cells[i_cellIndex];
+    const auto lastIndex = static_cast<uint32_t>(cell.proxyIds.size() - 1);
+    if (i_index != lastIndex)
+    {
+        cell.bounds.Set(i_index, cell.bounds.Get(lastIndex));
+        cell.proxyIds[i_index] = cell.proxyIds[lastIndex];
+        m_proxyLocations[cell.proxyIds[i_index]].index = i_index;
+    }
+    cell.bounds.Resize(lastIndex);
+    cell.proxyIds.pop_back();
+
+    if (cell.proxyIds.empty() && (i_cellIndex != s_largeProxyCellIndex))
+    {
+        RemoveCell(i_cellIndex);
+    }
+}
+
+void eae6320::Physics::cSpatialHashGrid::RemoveCell(const uint32_t i_cellIndex)
+{
+    EAE6320_ASSERT((i_cellIndex != s_largeProxyCellIndex) && m_cells[i_cellIndex].proxyIds.empty());
+
+    // Remove the cell's key from the hash table
+    {
+        const auto& cell = m_cells[i_cellIndex];
+        auto emptySlot = FindHashTableSlot(PackCellKey(cell.x, cell.y, cell.z));
+        EAE6320_ASSERT(m_hashTableCellIndices[emptySlot] == i_cellIndex);
+        m_hashTableKeys[emptySlot] = s_emptyHashTableKey;
+        // Any keys after it that would no longer be found (because the search would stop at the empty slot)
+        // are moved back into the empty slot
+        const auto mask = m_hashTableKeys.size() - 1;
+        for (auto slot = (emptySlot + 1) & mask; m_hashTableKeys[slot] != s_emptyHashTableKey; slot = (slot + 1) & mask)
+        {
+            const auto key = m_hashTableKeys[slot];
+            const auto desiredSlot = HashCellKey(key) & mask;
+            if (((slot - desiredSlot) & mask) >= ((slot - emptySlot) & mask))
+            {
+                m_hashTableKeys[emptySlot] = key;
+                m_hashTableCellIndices[emptySlot] = m_hashTableCellIndices[slot];
+                m_hashTableKeys[slot] = s_emptyHashTableKey;
+                emptySlot = slot;
+            }
+        }
+    }
+
+    // The last cell is moved into the removed cell's place
+    const auto lastCellIndex = static_cast<uint32_t>(m_cells.size() - 1);
+    if (i_cellIndex != lastCellIndex)
+    {
+        auto& cell = m_cells[i_cellIndex];
+        cell = std::move(m_cells[lastCellIndex]);
+        m_hashTableCellIndices[FindHashTableSlot(PackCellKey(cell.x, cell.y, cell.z))] = i_cellIndex;
+        for (const auto proxyId : cell.proxyIds)
+        {
+            m_proxyLocations[proxyId].cellIndex = i_cellIndex;
+        }
+    }
+    m_cells.pop_back();
+}
+
+void eae6320::Physics::cSpatialHashGrid::GrowHashTable()
+{
+    const auto size = std::max(m_hashTableKeys.size() * 2, s_minHashTableSize);
+    m_hashTableKeys.assign(size, s_emptyHashTableKey);
+    m_hashTableCellIndices.assign(size, s_invalidIndex);
+    for (uint32_t i = 1, cellCount = static_cast<uint32_t>(m_cells.size()); i < cellCount; ++i)
+    {
+        const auto& cell = m_cells[i];
+        const auto key = PackCellKey(cell.x, cell.y, cell.z);
+        const auto slot = FindHashTableSlot(key);
+        m_hashTableKeys[slot] = key;
+        m_hashTableCellIndices[slot] = i;
+    }
+}
+
+size_t eae6320::Physics::cSpatialHashGrid::FindHashTableSlot(const uint64_t i_key) const
+{
+    EAE6320_ASSERT(!m_hashTableKeys.empty());
+    const auto mask = m_hashTableKeys.size() - 1;
+    auto slot = HashCellKey(i_key) & mask;
+    while ((m_hashTableKeys[slot] != i_key) && (m_hashTableKeys[slot] != s_emptyHashTableKey))
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template <typename tFunction>
+void eae6320::Physics::cSpatialHashGrid::ForEachCellInRange(const int32_t (&i_minimum)[3], const int32_t (&i_maximum)[3],
+    const tFunction& i_function) const
+{
+    if (!m_cells[s_largeProxyCellIndex].proxyIds.empty())
+    {
+        i_function(m_cells[s_largeProxyCellIndex]);
+    }
+
+    uint64_t rangeCellCount = 1;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (i_maximum[i] < i_minimum[i])
+        {
+            return;
+        }
+        rangeCellCount *= static_cast<uint64_t>(static_cast<int64_t>(i_maximum[i]) - i_minimum[i] + 1);
+    }
+    if (rangeCellCount >= (m_cells.size() - 1))
+    {
+        for (size_t i = 1, cellCount = m_cells.size(); i < cellCount; ++i)
+        {
+            const auto& cell = m_cells[i];
+            if ((cell.x >= i_minimum[0]) && (cell.x <= i_maximum[0])
+                && (cell.y >= i_minimum[1]) && (cell.y <= i_maximum[1])
+                && (cell.z >= i_minimum[2]) && (cell.z <= i_maximum[2]))
+            {
+                i_function(cell);
+            }
+        }
+    }
+    else
+    {
+        for (auto x = i_minimum[0]; x <= i_maximum[0]; ++x)
+        {
+            for (auto y = i_minimum[1]; y <= i_maximum[1]; ++y)
+            {
+                for (auto z = i_minimum[2]; z <= i_maximum[2]; ++z)
+                {
+                    const auto cellIndex = FindCell(x, y, z);
+                    if (cellIndex != s_invalidIndex)
+                    {
+                        i_function(m_cells[cellIndex]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename tIsInside, typename tIsEntirelyInside, typename tFunction>
+void eae6320::Physics::cSpatialHashGrid::ForEachCellInShape(const int32_t (&i_minimum)[3], const int32_t (&i_maximum)[3],
+    const tIsInside& i_isInside, const tIsEntirelyInside& i_isEntirelyInside, const tFunction& i_function) const
+{
+    if (!m_cells[s_largeProxyCellIndex].proxyIds.empty())
+    {
+        i_function(m_cells[s_largeProxyCellIndex], false);
+    }
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (i_maximum[i] < i_minimum[i])
+        {
+            return;
+        }
+    }
+
+    struct sBlock
+    {
+        int32_t minimum[3], maximum[3];
+        bool isEntirelyInside;
+    };
+    // The loose bounds of a block go from the loose bounds of its first cell to the loose bounds of its last one,
+    // and so they always contain the loose bounds of every cell in the block
+    // (which means that every cell in a block that is entirely inside is also entirely inside).
+    // A single cell is tested as a block with one cell in it
+    const auto looseDistance = m_cellSize * 0.5f;
+    const auto cellSize = m_cellSize;
+    const auto CalculateLooseMinimum = [cellSize, looseDistance](const int32_t i_coordinate)
+    {
+        return (static_cast<float>(i_coordinate) * cellSize) - looseDistance;
+    };
+    const auto CalculateLooseMaximum = [cellSize, looseDistance](const int32_t i_coordinate)
+    {
+        return ((static_cast<float>(i_coordinate) * cellSize) + cellSize) + looseDistance;
+    };
+    const auto IsInside = [&i_isInside, &CalculateLooseMinimum, &CalculateLooseMaximum](const sBlock& i_block)
+    {
+        return i_isInside(
+            CalculateLooseMinimum(i_block.minimum[0]), CalculateLooseMinimum(i_block.minimum[1]), CalculateLooseMinimum(i_block.minimum[2]),
+            CalculateLooseMaximum(i_block.maximum[0]), CalculateLooseMaximum(i_block.maximum[1]), CalculateLooseMaximum(i_block.maximum[2]));
+    };
+    const auto IsEntirelyInside = [&i_isEntirelyInside, &CalculateLooseMinimum, &CalculateLooseMaximum](const sBlock& i_block)
+    {
+        return i_isEntirelyInside(
+            CalculateLooseMinimum(i_block.minimum[0]), CalculateLooseMinimum(i_block.minimum[1]), CalculateLooseMinimum(i_block.minimum[2]),
+            CalculateLooseMaximum(i_block.maximum[0]), CalculateLooseMaximum(i_block.maximum[1]), CalculateLooseMaximum(i_block.maximum[2]));
+    };
+    const auto CalculateCellCount = [](const sBlock& i_block)
+    {
+        return static_cast<uint64_t>((static_cast<int64_t>(i_block.maximum[0]) - i_block.minimum[0] + 1)
+            * (static_cast<int64_t>(i_block.maximum[1]) - i_block.minimum[1] + 1)
+            * (static_cast<int64_t>(i_block.maximum[2]) - i_block.minimum[2] + 1));
+    };
+    // Calls i_function(block) for every block that is either small or entirely inside of the shape
+    // until it returns false
+    const auto ForEachBlockInShape = [&i_minimum, &i_maximum, &IsInside, &IsEntirelyInside, &CalculateCellCount](
+        const auto& i_function)
+    {
+        sBlock blocks[s_maxBlockStackSize];
+        size_t blockCount = 0;
+        blocks[blockCount++] = sBlock{ { i_minimum[0], i_minimum[1], i_minimum[2] }, { i_maximum[0], i_maximum[1], i_maximum[2] }, false };
+        while (blockCount > 0)
+        {
+            auto block = blocks[--blockCount];
+            if (!IsInside(block))
+            {
+                continue;
+            }
+            block.isEntirelyInside = IsEntirelyInside(block);
+            if (block.isEntirelyInside || (CalculateCellCount(block) <= s_maxCellCountPerBlock))
+            {
+                if (!i_function(block))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                size_t longestSide = 0;
+                for (size_t i = 1; i < 3; ++i)
+                {
+                    longestSide = ((block.maximum[i] - block.minimum[i]) > (block.maximum[longestSide] - block.minimum[longestSide])) ? i : longestSide;
+                }
+                EAE6320_ASSERT((blockCount + 2) <= s_maxBlockStackSize);
+                const auto middle = static_cast<int32_t>((static_cast<int64_t>(block.minimum[longestSide]) + block.maximum[longestSide]) >> 1);
+                auto& lowerBlock = blocks[blockCount++];
+                auto& upperBlock = blocks[blockCount++];
+                lowerBlock = block;
+                upperBlock = block;
+                lowerBlock.maximum[longestSide] = middle;
+                upperBlock.minimum[longestSide] = middle + 1;
+            }
+        }
+    };
+
+    // If there are too many cells in the range then the blocks are found once to count how many cells would be looked up
+    // and then again to look them up
+    // (finding the blocks is much cheaper than looking up the cells)
+    const auto maxCellCountToLookUp = static_cast<uint64_t>(m_cells.size() - 1) / s_cellCountToCheckPerLookUp;
+    auto shouldCheckEveryCell = false;
+    {
+        const sBlock range{ { i_minimum[0], i_minimum[1], i_minimum[2] }, { i_maximum[0], i_maximum[1], i_maximum[2] }, false };
+        if (CalculateCellCount(range) > maxCellCountToLookUp)
+        {
+            uint64_t cellCountToLookUp = 0;
+            ForEachBlockInShape([maxCellCountToLookUp, &cellCountToLookUp, &CalculateCellCount](const sBlock& i_block)
+            {
+                cellCountToLookUp += CalculateCellCount(i_block);
+                return cellCountToLookUp <= maxCellCountToLookUp;
+            });
+            shouldCheckEveryCell = cellCountToLookUp > maxCellCountToLookUp;
+        }
+    }
+    if (shouldCheckEveryCell)
+    {
+        for (size_t i = 1, count = m_cells.size(); i < count; ++i)
+        {
+            const auto& cell = m_cells[i];
+            if ((cell.x >= i_minimum[0]) && (cell.x <= i_maximum[0])
+                && (cell.y >= i_minimum[1]) && (cell.y <= i_maximum[1])
+                && (cell.z >= i_minimum[2]) && (cell.z <= i_maximum[2]))
+            {
+                const sBlock cellBlock{ { cell.x, cell.y, cell.z }, { cell.x, cell.y, cell.z }, false };
+                if (IsInside(cellBlock))
+                {
+                    i_function(cell, IsEntirelyInside(cellBlock));
+                }
+            }
+        }
+    }
+    else
+    {
+        // The cells in a small block are tested before being looked up
+        // (most cells don't exist, and looking one up is more expensive than testing it)
+        ForEachBlockInShape([this, &i_function, &IsInside, &IsEntirelyInside](const sBlock& i_block)
+        {
+            for (auto x = i_block.minimum[0]; x <= i_block.maximum[0]; ++x)
+            {
+                for (auto y = i_block.minimum[1]; y <= i_block.maximum[1]; ++y)
+                {
+                    for (auto z = i_block.minimum[2]; z <= i_block.maximum[2]; ++z)
+                    {
+                        auto isEntirelyInside = i_block.isEntirelyInside;
+                        if (!isEntirelyInside)
+                        {
+                            const sBlock cellBlock{ { x, y, z }, { x, y, z }, false };
+                            if (!IsInside(cellBlock))
+                            {
+                                continue;
+                            }
+                            isEntirelyInside = IsEntirelyInside(cellBlock);
+                        }
+                        const auto cellIndex = FindCell(x, y, z);
+                        if (cellIndex != s_invalidIndex)
+                        {
+                            i_function(m_cells[cellIndex], isEntirelyInside);
+                        }
+                    }
+                }
+            }
+            return true;
+        });
+    }
+}
+
+void eae6320::Physics::cSpatialHashGrid::CalculateCellRange(const sAabb& i_bounds, int32_t (&o_minimum)[3], int32_t (&o_maximum)[3]) const
+{
+    // A box in a cell can stick out of it by half of a cell,
+    // and so the box's center can be half of a cell outside of the query's box
+    const auto looseDistance = m_cellSize * 0.5f;
+    o_minimum[0] = CalculateClampedCellCoordinate(i_bounds.minimum.x - looseDistance, m_inverseCellSize);
+    o_minimum[1] = CalculateClampedCellCoordinate(i_bounds.minimum.y - looseDistance, m_inverseCellSize);
+    o_minimum[2] = CalculateClampedCellCoordinate(i_bounds.minimum.z - looseDistance, m_inverseCellSize);
+    o_maximum[0] = CalculateClampedCellCoordinate(i_bounds.maximum.x + looseDistance, m_inverseCellSize);
+    o_maximum[1] = CalculateClampedCellCoordinate(i_bounds.maximum.y + looseDistance, m_inverseCellSize);
+    o_maximum[2] = CalculateClampedCellCoordinate(i_bounds.maximum.z + looseDistance, m_inverseCellSize);
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    uint64_t PackCellKey(const int32_t i_x, const int32_t i_y, const int32_t i_z)
+    {
+        EAE6320_ASSERT((i_x >= s_minCellCoordinate) && (i_x <= s_maxCellCoordinate));
+        EAE6320_ASSERT((i_y >= s_minCellCoordinate) && (i_y <= s_maxCellCoordinate));
+        EAE6320_ASSERT((i_z >= s_minCellCoordinate) && (i_z <= s_maxCellCoordinate));
+        return (static_cast<uint64_t>(i_x - s_minCellCoordinate) << 42)
+            | (static_cast<uint64_t>(i_y - s_minCellCoordinate) << 21)
+            | static_cast<uint64_t>(i_z - s_minCellCoordinate);
+    }
+
+    size_t HashCellKey(const uint64_t i_key)
+    {
+        // Neighboring cells have keys that only differ in a few bits,
+        // and so the bits are mixed (this is the finalizer of MurmurHash3)
+        auto hash = i_key;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash);
+    }
+
+    int32_t CalculateClampedCellCoordinate(const float i_position, const float i_inverseCellSize)
+    {
+        const auto coordinate = std::floor(i_position * i_inverseCellSize);
+        if (coordinate <= static_cast<float>(s_minCellCoordinate))
+        {
+            return s_minCellCoordinate;
+        }
+        else if (coordinate >= static_cast<float>(s_maxCellCoordinate))
+        {
+            return s_maxCellCoordinate;
+        }
+        else
+        {
+            EAE6320_ASSERTF(coordinate == coordinate, "A spatial query's position isn't a number");
+            return static_cast<int32_t>(coordinate);
+        }
+    }
+
+    template <> float Splat<float>(const float i_value)
+    {
+        return i_value;
+    }
+#if defined( EAE6320_MATH_SIMD )
+    template <> eae6320::Math::Simd::tFloat4 Splat<eae6320::Math::Simd::tFloat4>(const float i_value)
+    {
+        return eae6320::Math::Simd::Splat(i_value);
+    }
+#endif
+
+    template <typename tFloat> tFloat Minimum(const tFloat i_lhs, const tFloat i_rhs)
+    {
+        using namespace eae6320::Math;
+        return Simd::Select(Simd::LessThan(i_lhs, i_rhs), i_lhs, i_rhs);
+    }
+
+    template <typename tFloat> tFloat Maximum(const tFloat i_lhs, const tFloat i_rhs)
+    {
+        using namespace eae6320::Math;
+        return Simd::Select(Simd::LessThan(i_rhs, i_lhs), i_lhs, i_rhs);
+    }
+
+    template <typename tFloat>
+    tFloat CalculateRayEntry(const sRay& i_ray,
+        const tFloat i_minimum_x, const tFloat i_minimum_y, const tFloat i_minimum_z,
+        const tFloat i_maximum_x, const tFloat i_maximum_y, const tFloat i_maximum_z,
+        tFloat& o_exit)
+    {
+        using namespace eae6320::Math;
+
+        // The distances to the two planes of each axis are calculated,
+        // and the ray is inside of the box after it has entered every pair of planes and before it has exited any of them
+        const tFloat minimums[] = { i_minimum_x, i_minimum_y, i_minimum_z };
+        const tFloat maximums[] = { i_maximum_x, i_maximum_y, i_maximum_z };
+        auto entry = Splat<tFloat>(0.0f);
+        auto exit = Splat<tFloat>(i_ray.maxDistance);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const auto origin = Splat<tFloat>(i_ray.origin[i]);
+            const auto inverseDirection = Splat<tFloat>(i_ray.inverseDirection[i]);
+            const auto distance_minimum = Simd::Multiply(Simd::Subtract(minimums[i], origin), inverseDirection);
+            const auto distance_maximum = Simd::Multiply(Simd::Subtract(maximums[i], origin), inverseDirection);
+            entry = Maximum(entry, Minimum(distance_minimum, distance_maximum));
+            exit = Minimum(exit, Maximum(distance_minimum, distance_maximum));
+        }
+        o_exit = exit;
+        return entry;
+    }
+
+    template <typename tTest, typename tOutput>
+    void TestBoxes(const eae6320::Physics::sAabbArrays& i_bounds, const size_t i_begin, const tTest& i_test, const tOutput& i_output)
+    {
+        const auto count = i_bounds.GetCount();
+        const auto* const minimum_x = i_bounds.minimum_x.data();
+        const auto* const minimum_y = i_bounds.minimum_y.data();
+        const auto* const minimum_z = i_bounds.minimum_z.data();
+        const auto* const maximum_x = i_bounds.maximum_x.data();
+        const auto* const maximum_y = i_bounds.maximum_y.data();
+        const auto* const maximum_z = i_bounds.maximum_z.data();
+
+        auto i = i_begin;
+#if defined( EAE6320_MATH_SIMD )
+        {
+            using namespace eae6320::Math;
+            for (; (i + 4) <= count; i += 4)
+            {
+                const auto bits = Simd::GetBits(i_test(
+                    Simd::Load(minimum_x + i), Simd::Load(minimum_y + i), Simd::Load(minimum_z + i),
+                    Simd::Load(maximum_x + i), Simd::Load(maximum_y + i), Simd::Load(maximum_z + i)));
+                if (bits != 0)
+                {
+                    for (unsigned int lane = 0; lane < 4; ++lane)
+                    {
+                        if ((bits & (1u << lane)) != 0)
+                        {
+                            i_output(i + lane);
+                        }
+                    }
+                }
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if (i_test(minimum_x[i], minimum_y[i], minimum_z[i], maximum_x[i], maximum_y[i], maximum_z[i]))
+            {
+                i_output(i);
+            }
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*
+    A spatial index that answers "what is near this box/sphere/frustum/ray" without iterating every proxy
+
+    Space is divided into cubic cells, and a proxy is stored in the cell that contains the center of its box.
+    A proxy's box can stick out of its cell by at most half of a cell
+    (i.e. the grid is "loose"; anything bigger is kept in a separate list of large proxies that every query checks),
+    and so a query only needs to look at the cells that its shape overlaps after being expanded by half of a cell.
+    Only cells that have proxies in them exist, and they are found with a hash table of their coordinates,
+    and so the size of the world doesn't matter.
+
+    The boxes in each cell are stored as a separate array for each component
+    so that a query compares four of them at a time using SIMD instructions.
+    A cell is also rejected as a whole before any of its boxes are compared
+    (e.g. a frustum query only looks inside the cells whose loose bounds are inside of the frustum),
+    and the frustum, sphere, and ray queries reject whole blocks of cells before looking any of them up.
+    The boxes of a cell that is entirely inside of a frustum or sphere aren't compared at all.
+
+    Updating a proxy whose center stays in the same cell only changes its box,
+    and so proxies that move a little every frame are cheap to keep up-to-date.
+
+    The grid is also a broadphase (see cbBroadphase.h):
+    a pair can only overlap if their cells are neighbors,
+    and so each cell is only compared with itself and with half of its neighbors.
+*/
+
+#ifndef EAE6320_PHYSICS_CSPATIALHASHGRID_H
+#define EAE6320_PHYSICS_CSPATIALHASHGRID_H
+
+// Include Files
+//==============
+
+#include "cbBroadphase.h"
+#include "sAabb.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Math
+    {
+        class cMatrixTransformation;
+        struct sVector;
+    }
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cSpatialHashGrid final : public cbBroadphase
+        {
+            // Inherited Interface
+            //====================
+
+        public:
+
+            void AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds) override;
+            void RemoveProxy(const tProxyId i_proxyId) override;
+            void UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds) override;
+
+            void FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs) override;
+
+            void Clear() override;
+
+            // Interface
+            //==========
+
+            struct sRayHit
+            {
+                tProxyId proxyId;
+                // The distance along the ray where it enters the proxy's box
+                // (this is 0 if the ray starts inside of the box)
+                float distance;
+            };
+
+            // Proxies
+            //--------
+
+            void UpdateProxy(const tProxyId i_proxyId, const sAabb& i_bounds);
+            bool DoesProxyExist(const tProxyId i_proxyId) const;
+            sAabb GetBounds(const tProxyId i_proxyId) const;
+            size_t GetProxyCount() const { return m_proxyCount; }
+            // The number of cells that have proxies in them
+            size_t GetCellCount() const { return m_cells.size() - 1; }
+
+            // Queries
+            //--------
+
+            // Every proxy whose box overlaps the shape is output
+            // (any existing IDs in the output are cleared).
+            // The order depends on which cells the proxies are in
+
+            void QueryAabb(const sAabb& i_bounds, std::vector<tProxyId>& o_proxyIds) const;
+            void QuerySphere(const Math::sVector& i_center, const float i_radius, std::vector<tProxyId>& o_proxyIds) const;
+            // The frustum is the clip space of the transform (see cMatrixTransformation::GetClipSpacePlanes()),
+            // and the test is conservative in the same way as cMatrixTransformation::IsAxisAlignedBoxOutsideOfClipSpace()
+            // except that boxes that don't overlap the bounds of the frustum's corners are also rejected
+            void QueryFrustum(const Math::cMatrixTransformation& i_transform_worldToProjected, std::vector<tProxyId>& o_proxyIds) const;
+            // The direction doesn't need to be normalized;
+            // the hits' distances are in multiples of its length (and the max distance must be finite).
+            // The hits are sorted from nearest to farthest
+            void Raycast(const Math::sVector& i_origin, const Math::sVector& i_direction, const float i_maxDistance,
+                std::vector<sRayHit>& o_hits) const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // Proxies that are (almost) as big as the cell size in any dimension are kept in a list that every query checks,
+            // and so the cells should be at least as big as most proxies.
+            // Smaller cells mean that queries compare fewer boxes but look at more cells
+            explicit cSpatialHashGrid(const float i_cellSize = 4.0f);
+
+            // Data
+            //=====
+
+        private:
+
+            struct sCell
+            {
+                sAabbArrays bounds;
+                std::vector<tProxyId> proxyIds;
+                int32_t x = 0, y = 0, z = 0;
+            };
+            // The first cell has the large proxies and isn't in the hash table,
+            // and every other cell has at least one proxy
+            std::vector<sCell> m_cells;
+
+            // The hash table uses open addressing:
+            // a key's slot is found by starting at its hash and searching forward until the key (or an empty slot) is found
+            std::vector<uint64_t> m_hashTableKeys;
+            std::vector<uint32_t> m_hashTableCellIndices;
+
+            struct sProxyLocation
+            {
+                uint32_t cellIndex;
+                uint32_t index;
+            };
+            // Indexed by proxy ID
+            std::vector<sProxyLocation> m_proxyLocations;
+            size_t m_proxyCount = 0;
+
+            float m_cellSize;
+            float m_inverseCellSize;
+
+            // Implementation
+            //===============
+
+        private:
+
+            // Returns false if the box is too big for a cell
+            // (or if its center is too far away from the origin),
+            // in which case it belongs in the first cell
+            bool CalculateCellCoordinates(const sAabb& i_bounds, int32_t (&o_coordinates)[3]) const;
+            uint32_t FindOrCreateCell(const sAabb& i_bounds);
+            uint32_t FindCell(const int32_t i_x, const int32_t i_y, const int32_t i_z) const;
+            void RemoveFromCell(const uint32_t i_cellIndex, const uint32_t i_index);
+            void RemoveCell(const uint32_t i_cellIndex);
+            void GrowHashTable();
+            size_t FindHashTableSlot(const uint64_t i_key) const;
+
+            // Calls i_function(cell) for the large proxies' cell (if it has any)
+            // and for every cell whose coordinates are in the range (inclusive).
+            // If the range covers more cells than exist then every cell is checked instead of looking each one up
+            template <typename tFunction>
+            void ForEachCellInRange(const int32_t (&i_minimum)[3], const int32_t (&i_maximum)[3], const tFunction& i_function) const;
+            // Calls i_function(cell, isEntirelyInside) for the large proxies' cell (if it has any, and it is never entirely inside)
+            // and for every cell whose coordinates are in the range (inclusive)
+            // and whose loose bounds pass i_isInside(minimum_x, minimum_y, minimum_z, maximum_x, maximum_y, maximum_z).
+            // If the loose bounds also pass i_isEntirelyInside() then every box in the cell is inside of the shape
+            // and the boxes don't need to be tested.
+            // The range is split in half again and again and a block of cells whose loose bounds don't pass is skipped as a whole,
+            // and so only the cells near the shape are looked up
+            // (or, if that would still look up a lot of cells compared to how many exist, every cell is checked instead)
+            template <typename tIsInside, typename tIsEntirelyInside, typename tFunction>
+            void ForEachCellInShape(const int32_t (&i_minimum)[3], const int32_t (&i_maximum)[3],
+                const tIsInside& i_isInside, const tIsEntirelyInside& i_isEntirelyInside, const tFunction& i_function) const;
+            // The range of cells whose loose bounds could overlap the box
+            void CalculateCellRange(const sAabb& i_bounds, int32_t (&o_minimum)[3], int32_t (&o_maximum)[3]) const;
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CSPATIALHASHGRID_H
@@ -0,0 +1,235 @@
+// Include Files
+//==============
+
+#include "cSweepAndPrune.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/Simd.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    constexpr auto s_invalidIndex = ~static_cast<uint32_t>(0);
+    constexpr auto s_removedProxyId = ~static_cast<eae6320::Physics::cbBroadphase::tProxyId>(0);
+    // If more proxies than this have been added since the last sort
+    // then sorting from scratch is faster than inserting each of them
+    constexpr size_t s_maxAddedProxyCountToInsert = 32;
+}
+
+// Inherited Interface
+//====================
+
+void eae6320::Physics::cSweepAndPrune::AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds)
+{
+    EAE6320_ASSERT(i_proxyId != s_removedProxyId);
+    if (i_proxyId >= m_indicesFromProxyIds.size())
+    {
+        m_indicesFromProxyIds.resize(i_proxyId + 1, s_invalidIndex);
+    }
+    EAE6320_ASSERTF(m_indicesFromProxyIds[i_proxyId] == s_invalidIndex, "The proxy %u already exists", i_proxyId);
+    m_indicesFromProxyIds[i_proxyId] = static_cast<uint32_t>(m_proxyIds.size());
+    m_proxyIds.push_back(i_proxyId);
+    m_bounds.Append(i_bounds);
+    ++m_addedProxyCount;
+}
+
+void eae6320::Physics::cSweepAndPrune::RemoveProxy(const tProxyId i_proxyId)
+{
+    EAE6320_ASSERTF((i_proxyId < m_indicesFromProxyIds.size()) && (m_indicesFromProxyIds[i_proxyId] != s_invalidIndex),
+        "The proxy %u doesn't exist", i_proxyId);
+    m_proxyIds[m_indicesFromProxyIds[i_proxyId]] = s_removedProxyId;
+    m_indicesFromProxyIds[i_proxyId] = s_invalidIndex;
+    ++m_removedProxyCount;
+}
+
+void eae6320::Physics::cSweepAndPrune::UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds)
+{
+    for (size_t i = 0, count = i_bounds.GetCount(); i < count; ++i)
+    {
+        const auto proxyId = i_proxyIds[i];
+        EAE6320_ASSERTF((proxyId < m_indicesFromProxyIds.size()) && (m_indicesFromProxyIds[proxyId] != s_invalidIndex),
+            "The proxy %u doesn't exist", proxyId);
+        m_bounds.Set(m_indicesFromProxyIds[proxyId], i_bounds.Get(i));
+    }
+}
+
+void eae6320::Physics::cSweepAndPrune::FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs)
+{
+    o_pairs.clear();
+    Sort();
+
+    const auto count = m_proxyIds.size();
+    const auto* const minimum_x = m_bounds.minimum_x.data();
+    const auto* const minimum_y = m_bounds.minimum_y.data();
+    const auto* const minimum_z = m_bounds.minimum_z.data();
+    const auto* const maximum_x = m_bounds.maximum_x.data();
+    const auto* const maximum_y = m_bounds.maximum_y.data();
+    const auto* const maximum_z = m_bounds.maximum_z.data();
+    const auto AddPair = [this, &o_pairs](const size_t i_index_a, const size_t i_index_b)
+    {
+        const auto proxyId_a = m_proxyIds[i_index_a];
+        const auto proxyId_b = m_proxyIds[i_index_b];
+        o_pairs.push_back((proxyId_a < proxyId_b) ? sOverlappingPair{ proxyId_a, proxyId_b } : sOverlappingPair{ proxyId_b, proxyId_a });
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Every box after this one starts at or after its minimum x,
+        // and so they overlap in x until one starts after its maximum x
+        auto j = i + 1;
+#if defined( EAE6320_MATH_SIMD )
+        {
+            using namespace Math;
+
+            const auto maximum_x_i = Simd::Splat(maximum_x[i]);
+            const auto minimum_y_i = Simd::Splat(minimum_y[i]);
+            const auto maximum_y_i = Simd::Splat(maximum_y[i]);
+            const auto minimum_z_i = Simd::Splat(minimum_z[i]);
+            const auto maximum_z_i = Simd::Splat(maximum_z[i]);
+            auto isSweepFinished = false;
+            for (; (j + 4) <= count; j += 4)
+            {
+                const auto isInRange = Simd::LessThanOrEqual(Simd::Load(minimum_x + j), maximum_x_i);
+                const auto overlaps = Simd::And(isInRange, Simd::And(
+                    Simd::And(Simd::LessThanOrEqual(Simd::Load(minimum_y + j), maximum_y_i), Simd::LessThanOrEqual(minimum_y_i, Simd::Load(maximum_y + j))),
+                    Simd::And(Simd::LessThanOrEqual(Simd::Load(minimum_z + j), maximum_z_i), Simd::LessThanOrEqual(minimum_z_i, Simd::Load(maximum_z + j)))));
+                const auto overlapBits = Simd::GetBits(overlaps);
+                if (overlapBits != 0)
+                {
+                    for (unsigned int lane = 0; lane < 4; ++lane)
+                    {
+                        if ((overlapBits & (1u << lane)) != 0)
+                        {
+                            AddPair(i, j + lane);
+                        }
+                    }
+                }
+                // The boxes are sorted, and so if any of these four is out of range then so is every box after it
+                if (Simd::GetBits(isInRange) != 0xf)
+                {
+                    isSweepFinished = true;
+                    break;
+                }
+            }
+            if (isSweepFinished)
+            {
+                continue;
+            }
+        }
+#endif
+        for (; (j < count) && (minimum_x[j] <= maximum_x[i]); ++j)
+        {
+            if ((minimum_y[j] <= maximum_y[i]) && (minimum_y[i] <= maximum_y[j])
+                && (minimum_z[j] <= maximum_z[i]) && (minimum_z[i] <= maximum_z[j]))
+            {
+                AddPair(i, j);
+            }
+        }
+    }
+
+    std::sort(o_pairs.begin(), o_pairs.end());
+}
+
+void eae6320::Physics::cSweepAndPrune::Clear()
+{
+    m_bounds.Clear();
+    m_proxyIds.clear();
+    m_indicesFromProxyIds.clear();
+    m_removedProxyCount = 0;
+    m_addedProxyCount = 0;
+}
+
+// Implementation
+//===============
+
+void eae6320::Physics::cSweepAndPrune::Sort()
+{
+    // Remove any proxies that were marked as removed
+    // (the remaining proxies stay in the same order)
+    if (m_removedProxyCount > 0)
+    {
+        size_t newCount = 0;
+        for (size_t i = 0, count = m_proxyIds.size(); i < count; ++i)
+        {
+            if (m_proxyIds[i] != s_removedProxyId)
+            {
+                if (newCount != i)
+                {
+                    m_proxyIds[newCount] = m_proxyIds[i];
+                    m_bounds.Set(newCount, m_bounds.Get(i));
+                }
+                ++newCount;
+            }
+        }
+        m_proxyIds.resize(newCount);
+        m_bounds.Resize(newCount);
+        m_removedProxyCount = 0;
+    }
+
+    const auto count = m_proxyIds.size();
+    if (m_addedProxyCount > s_maxAddedProxyCountToInsert)
+    {
+        SortFromScratch();
+    }
+    else
+    {
+        // Insertion sort
+        auto& minimum_x = m_bounds.minimum_x;
+        for (size_t i = 1; i < count; ++i)
+        {
+            const auto minimum_x_i = minimum_x[i];
+            if (minimum_x[i - 1] > minimum_x_i)
+            {
+                const auto bounds = m_bounds.Get(i);
+                const auto proxyId = m_proxyIds[i];
+                auto j = i;
+                do
+                {
+                    m_bounds.Set(j, m_bounds.Get(j - 1));
+                    m_proxyIds[j] = m_proxyIds[j - 1];
+                    --j;
+                } while ((j > 0) && (minimum_x[j - 1] > minimum_x_i));
+                m_bounds.Set(j, bounds);
+                m_proxyIds[j] = proxyId;
+            }
+        }
+    }
+    m_addedProxyCount = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_indicesFromProxyIds[m_proxyIds[i]] = static_cast<uint32_t>(i);
+    }
+}
+
+void eae6320::Physics::cSweepAndPrune::SortFromScratch()
+{
+    const auto count = m_proxyIds.size();
+    m_sortedIndices.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_sortedIndices[i] = static_cast<uint32_t>(i);
+    }
+    {
+        const auto& minimum_x = m_bounds.minimum_x;
+        std::sort(m_sortedIndices.begin(), m_sortedIndices.end(), [&minimum_x](const uint32_t i_lhs, const uint32_t i_rhs)
+        {
+            return minimum_x[i_lhs] < minimum_x[i_rhs];
+        });
+    }
+
+    sAabbArrays sortedBounds;
+    sortedBounds.Reserve(count);
+    std::vector<tProxyId> sortedProxyIds;
+    sortedProxyIds.reserve(count);
+    for (const auto index : m_sortedIndices)
+    {
+        sortedBounds.Append(m_bounds.Get(index));
+        sortedProxyIds.push_back(m_proxyIds[index]);
+    }
+    m_bounds = std::move(sortedBounds);
+    m_proxyIds = std::move(sortedProxyIds);
+}
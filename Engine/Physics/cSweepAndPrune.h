@@ -0,0 +1,75 @@
+/*
+    A broadphase that keeps the boxes sorted along the x axis
+
+    The boxes are stored as a separate array for each component in the order of their minimum x.
+    Finding the pairs then only needs one pass:
+    each box is compared with the boxes after it until one starts beyond its maximum x,
+    and those comparisons are done four at a time using SIMD instructions.
+
+    The bodies only move a little bit every update, and so the order barely changes
+    and is restored with an insertion sort that is almost linear.
+    (If many proxies have been added since the last update they are sorted from scratch instead.)
+*/
+
+#ifndef EAE6320_PHYSICS_CSWEEPANDPRUNE_H
+#define EAE6320_PHYSICS_CSWEEPANDPRUNE_H
+
+// Include Files
+//==============
+
+#include "cbBroadphase.h"
+#include "sAabb.h"
+
+#include <cstddef>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cSweepAndPrune final : public cbBroadphase
+        {
+            // Inherited Interface
+            //====================
+
+        public:
+
+            void AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds) override;
+            void RemoveProxy(const tProxyId i_proxyId) override;
+            void UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds) override;
+
+            void FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs) override;
+
+            void Clear() override;
+
+            // Data
+            //=====
+
+        private:
+
+            // Sorted by minimum x
+            // (after FindOverlappingPairs(); new proxies are appended at the end until then)
+            sAabbArrays m_bounds;
+            std::vector<tProxyId> m_proxyIds;
+            std::vector<uint32_t> m_indicesFromProxyIds;
+            // Removed proxies are marked with an invalid ID and are only removed from the arrays when they are sorted
+            size_t m_removedProxyCount = 0;
+            size_t m_addedProxyCount = 0;
+            // This is only a member so that the memory isn't allocated every update
+            std::vector<uint32_t> m_sortedIndices;
+
+            // Implementation
+            //===============
+
+        private:
+
+            void Sort();
+            void SortFromScratch();
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CSWEEPANDPRUNE_H
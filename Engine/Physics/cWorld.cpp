@@ -0,0 +1,1338 @@
+// Include Files
+//==============
+
+#include "cWorld.h"
+
+#include "Narrowphase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/Simd.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Transform/sPredictionTransform.h>
+#include <Engine/Transform/sTransform.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // Contacts are created when bodies are closer than this (so that the solver can stop them before they touch),
+    // and a contact that is within this distance of the previous update's contact is treated as the same contact
+    constexpr auto s_contactDistance = 0.02f;
+
+    // Update() splits the loops over every body into ranges of this many bodies
+    // that are calculated as jobs
+    // (it is a multiple of four so that every range but the last one is calculated entirely with SIMD instructions)
+    constexpr size_t s_bodyCountPerJob = 256;
+
+    constexpr unsigned int s_velocityIterationCount = 10;
+    // The fraction of the overlap that is corrected every second
+    // (correcting all of it at once adds energy and makes resting contacts jitter)
+    constexpr auto s_overlapCorrectionFactor = 0.2f;
+    // Overlap that is less than this isn't corrected,
+    // which keeps resting contacts touching between updates
+    constexpr auto s_allowedOverlap = 0.005f;
+    // Slower collisions than this don't bounce
+    // (otherwise resting bodies would keep bouncing a tiny amount because of gravity)
+    constexpr auto s_minSpeedToBounce = 1.0f;
+
+    constexpr auto s_invalidIslandIndex = ~static_cast<uint32_t>(0);
+
+    // This changes whenever the layout of a snapshot changes
+    // so that a snapshot from an older build isn't loaded
+    constexpr uint32_t s_snapshotVersion = 1;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // io_positions += i_velocities * i_secondCountToIntegrate for the range
+    // (in the same order as sRigidBodyState::UpdatePosition() so that the results are identical)
+    void IntegrateComponent(float* const io_positions, const float* const i_velocities, const float i_secondCountToIntegrate,
+        const size_t i_first, const size_t i_count);
+    // o_results = i_from + ((i_to - i_from) * i_t) for the range
+    void InterpolateComponent(const float* const i_from, const float* const i_to, const float i_t,
+        const size_t i_first, const size_t i_count, float* const o_results);
+    void CopyRange(const std::vector<float>& i_source, const size_t i_first, const size_t i_count, std::vector<float>& o_destination);
+
+    // The bounds kernel is written once in terms of these functions
+    // so that every SIMD lane and every leftover element does exactly the same operations
+    using eae6320::Math::Simd::Absolute;
+    using eae6320::Math::Simd::Add;
+    using eae6320::Math::Simd::Subtract;
+    using eae6320::Math::Simd::Multiply;
+
+    // Rotates and translates a local box and calculates the world-space box that contains it.
+    // The orientation is w, x, y, z
+    template <typename tLanes>
+    void CalculateBounds(const tLanes(&i_position)[3], const tLanes(&i_orientation)[4],
+        const tLanes(&i_center_local)[3], const tLanes(&i_extents_local)[3], const tLanes i_one,
+        tLanes(&o_minimum)[3], tLanes(&o_maximum)[3]);
+
+    template <typename tElement>
+    void RemoveBySwapping(std::vector<tElement>& io_elements, const size_t i_index);
+
+    // A snapshot is a header, every array of body state, the gravity, and then the manifolds
+    struct sSnapshotHeader
+    {
+        uint32_t version;
+        uint32_t bodyCount;
+        uint32_t manifoldCount;
+    };
+    constexpr size_t s_snapshotByteCount_perBody = sizeof(eae6320::Physics::cWorld::tBodyId)
+        // Position, velocity, orientation, angular velocity axis, and angular speed
+        + ((3 + 3 + 4 + 3 + 1) * sizeof(float));
+    struct sSnapshotManifold
+    {
+        uint32_t bodyA, bodyB;
+        uint32_t pointCount;
+        float friction, restitution;
+    };
+    // The rest of a contact point is only used by the solver and is recalculated every update
+    struct sSnapshotContactPoint
+    {
+        eae6320::Math::sVector pointOnA_local, pointOnB_local;
+        eae6320::Math::sVector normal;
+        float depth;
+        float normalImpulse, tangentImpulse1, tangentImpulse2;
+    };
+    void Write(const void* const i_data, const size_t i_byteCount, uint8_t*& io_destination);
+    template <typename tElement>
+    void Write(const std::vector<tElement>& i_elements, uint8_t*& io_destination);
+    // These return false if there isn't enough data left
+    bool Read(void* const o_data, const size_t i_byteCount, const uint8_t*& io_source, const uint8_t* const i_end);
+    template <typename tElement>
+    bool Read(std::vector<tElement>& o_elements, const uint8_t*& io_source, const uint8_t* const i_end);
+}
+
+// Interface
+//==========
+
+// Bodies
+//-------
+
+eae6320::Physics::cWorld::tBodyId eae6320::Physics::cWorld::AddBody(const Math::sVector& i_position, const Math::cQuaternion& i_orientation,
+    const sRigidBodyState& i_rigidBodyState, const sShape& i_shape, Transform::sTransform* const i_transform,
+    Transform::sPredictionTransform* const i_predictionTransform)
+{
+    // An ID of a body that was removed is reused if there is one
+    tBodyId bodyId;
+    if (!m_unusedBodyIds.empty())
+    {
+        bodyId = m_unusedBodyIds.back();
+        m_unusedBodyIds.pop_back();
+    }
+    else
+    {
+        EAE6320_ASSERT(m_indicesFromBodyIds.size() < GetInvalidBodyId());
+        bodyId = static_cast<tBodyId>(m_indicesFromBodyIds.size());
+        m_indicesFromBodyIds.push_back(GetInvalidBodyId());
+    }
+    const auto index = GetBodyCount();
+    m_indicesFromBodyIds[bodyId] = static_cast<uint32_t>(index);
+    m_bodyIds.push_back(bodyId);
+
+    m_positions.Append(i_position);
+    m_velocities.Append(i_rigidBodyState.velocity);
+    m_orientations.Append(i_orientation);
+    m_angularVelocityAxes.Append(i_rigidBodyState.angularVelocity_axis_local);
+    m_angularSpeeds.push_back(i_rigidBodyState.angularSpeed);
+    m_transforms.push_back(i_transform);
+    m_previousPositions.Append(i_position);
+    m_previousOrientations.Append(i_orientation);
+    m_predictionTransforms.push_back(i_predictionTransform);
+    {
+        const auto localBounds = i_shape.CalculateBounds();
+        m_localBoundsCenters.Append((localBounds.minimum + localBounds.maximum) * 0.5f);
+        // The bounds are enlarged by half of the contact distance
+        // so that the bounds of two bodies that are close enough to have contacts overlap
+        // (rotating the enlarged box can only make its world bounds bigger)
+        const auto margin = s_contactDistance * 0.5f;
+        m_localBoundsExtents.Append(((localBounds.maximum - localBounds.minimum) * 0.5f) + Math::sVector(margin, margin, margin));
+    }
+    m_bounds.Resize(index + 1);
+    m_shapes.push_back(i_shape);
+    {
+        const auto mass = i_shape.IsStatic() ? 0.0f : i_shape.CalculateMass();
+        if (mass > 0.0f)
+        {
+            const auto inertia = i_shape.CalculateInertia(mass);
+            m_inverseMasses.push_back(1.0f / mass);
+            // A shape with no size along an axis can't be rotated around the other axes by collisions
+            m_inverseInertias_local.Append(Math::sVector(
+                (inertia.x > 0.0f) ? (1.0f / inertia.x) : 0.0f,
+                (inertia.y > 0.0f) ? (1.0f / inertia.y) : 0.0f,
+                (inertia.z > 0.0f) ? (1.0f / inertia.z) : 0.0f));
+        }
+        else
+        {
+            m_inverseMasses.push_back(0.0f);
+            m_inverseInertias_local.Append(Math::sVector());
+        }
+    }
+
+    // The temporary arrays always have an element for every body
+    // so that different ranges can be integrated at the same time without resizing them
+    m_rotations.Resize(index + 1);
+    m_rotationAngles.resize(index + 1);
+    m_interpolatedPositions.Resize(index + 1);
+    m_interpolatedOrientations.Resize(index + 1);
+
+    UpdateBounds(index, 1);
+    m_broadphase->AddProxy(bodyId, m_bounds.Get(index));
+
+    return bodyId;
+}
+
+void eae6320::Physics::cWorld::RemoveBody(const tBodyId i_bodyId)
+{
+    const auto index = GetIndex(i_bodyId);
+    const auto index_last = GetBodyCount() - 1;
+
+    // The last body is moved into the removed body's place
+    m_indicesFromBodyIds[m_bodyIds[index_last]] = static_cast<uint32_t>(index);
+    RemoveBySwapping(m_bodyIds, index);
+
+    m_positions.RemoveBySwapping(index);
+    m_velocities.RemoveBySwapping(index);
+    m_orientations.Set(index, m_orientations.Get(index_last));
+    m_orientations.Resize(index_last);
+    m_angularVelocityAxes.RemoveBySwapping(index);
+    RemoveBySwapping(m_angularSpeeds, index);
+    RemoveBySwapping(m_transforms, index);
+    m_previousPositions.RemoveBySwapping(index);
+    m_previousOrientations.Set(index, m_previousOrientations.Get(index_last));
+    m_previousOrientations.Resize(index_last);
+    RemoveBySwapping(m_predictionTransforms, index);
+    m_localBoundsCenters.RemoveBySwapping(index);
+    m_localBoundsExtents.RemoveBySwapping(index);
+    m_bounds.Set(index, m_bounds.Get(index_last));
+    m_bounds.Resize(index_last);
+    RemoveBySwapping(m_shapes, index);
+    RemoveBySwapping(m_inverseMasses, index);
+    m_inverseInertias_local.RemoveBySwapping(index);
+    m_broadphase->RemoveProxy(i_bodyId);
+    // The body's contacts are removed so that they aren't used if its ID is reused
+    m_manifolds.erase(std::remove_if(m_manifolds.begin(), m_manifolds.end(), [i_bodyId](const sContactManifold& i_manifold)
+    {
+        return (i_manifold.bodyA == i_bodyId) || (i_manifold.bodyB == i_bodyId);
+    }), m_manifolds.end());
+    m_islands.clear();
+
+    m_rotations.Resize(index_last);
+    m_rotationAngles.resize(index_last);
+    m_interpolatedPositions.Resize(index_last);
+    m_interpolatedOrientations.Resize(index_last);
+
+    m_indicesFromBodyIds[i_bodyId] = GetInvalidBodyId();
+    m_unusedBodyIds.push_back(i_bodyId);
+}
+
+void eae6320::Physics::cWorld::SetTransforms(const tBodyId i_bodyId, Transform::sTransform* const i_transform,
+    Transform::sPredictionTransform* const i_predictionTransform)
+{
+    const auto index = GetIndex(i_bodyId);
+    m_transforms[index] = i_transform;
+    m_predictionTransforms[index] = i_predictionTransform;
+}
+
+eae6320::Physics::sRigidBodyState eae6320::Physics::cWorld::GetRigidBodyState(const tBodyId i_bodyId) const
+{
+    const auto index = GetIndex(i_bodyId);
+    sRigidBodyState rigidBodyState;
+    rigidBodyState.velocity = m_velocities.Get(index);
+    rigidBodyState.angularVelocity_axis_local = m_angularVelocityAxes.Get(index);
+    rigidBodyState.angularSpeed = m_angularSpeeds[index];
+    return rigidBodyState;
+}
+
+void eae6320::Physics::cWorld::SetRigidBodyState(const tBodyId i_bodyId, const sRigidBodyState& i_rigidBodyState)
+{
+    const auto index = GetIndex(i_bodyId);
+    m_velocities.Set(index, i_rigidBodyState.velocity);
+    m_angularVelocityAxes.Set(index, i_rigidBodyState.angularVelocity_axis_local);
+    m_angularSpeeds[index] = i_rigidBodyState.angularSpeed;
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::GetPosition(const tBodyId i_bodyId) const
+{
+    return m_positions.Get(GetIndex(i_bodyId));
+}
+
+eae6320::Math::cQuaternion eae6320::Physics::cWorld::GetOrientation(const tBodyId i_bodyId) const
+{
+    return m_orientations.Get(GetIndex(i_bodyId));
+}
+
+void eae6320::Physics::cWorld::SetPosition(const tBodyId i_bodyId, const Math::sVector& i_position)
+{
+    const auto index = GetIndex(i_bodyId);
+    m_positions.Set(index, i_position);
+    m_previousPositions.Set(index, i_position);
+}
+
+void eae6320::Physics::cWorld::SetOrientation(const tBodyId i_bodyId, const Math::cQuaternion& i_orientation)
+{
+    const auto index = GetIndex(i_bodyId);
+    m_orientations.Set(index, i_orientation);
+    m_previousOrientations.Set(index, i_orientation);
+}
+
+// Simulation
+//-----------
+
+void eae6320::Physics::cWorld::Update(const float i_secondCountToIntegrate)
+{
+    // Every range only writes to its own bodies,
+    // and so the results are the same no matter how the ranges are split between threads
+    const auto bodyCount = GetBodyCount();
+    Concurrency::Jobs::ParallelFor(0, bodyCount, s_bodyCountPerJob, [this](const size_t i_begin, const size_t i_end)
+        {
+            UpdateBounds(i_begin, i_end - i_begin);
+        });
+    FindOverlappingPairs();
+    UpdateContacts();
+    SolveContacts(i_secondCountToIntegrate);
+    Concurrency::Jobs::ParallelFor(0, bodyCount, s_bodyCountPerJob, [this, i_secondCountToIntegrate](const size_t i_begin, const size_t i_end)
+        {
+            Integrate(i_secondCountToIntegrate, i_begin, i_end - i_begin);
+            UpdateTransforms(i_begin, i_end - i_begin);
+        });
+}
+
+void eae6320::Physics::cWorld::Integrate(const float i_secondCountToIntegrate)
+{
+    Integrate(i_secondCountToIntegrate, 0, GetBodyCount());
+}
+
+void eae6320::Physics::cWorld::Integrate(const float i_secondCountToIntegrate, const size_t i_first, const size_t i_count)
+{
+    EAE6320_ASSERT((i_first + i_count) <= GetBodyCount());
+    if (i_count == 0)
+    {
+        return;
+    }
+
+    // Keep the state that is being integrated from for interpolation
+    {
+        CopyRange(m_positions.x, i_first, i_count, m_previousPositions.x);
+        CopyRange(m_positions.y, i_first, i_count, m_previousPositions.y);
+        CopyRange(m_positions.z, i_first, i_count, m_previousPositions.z);
+        CopyRange(m_orientations.w, i_first, i_count, m_previousOrientations.w);
+        CopyRange(m_orientations.x, i_first, i_count, m_previousOrientations.x);
+        CopyRange(m_orientations.y, i_first, i_count, m_previousOrientations.y);
+        CopyRange(m_orientations.z, i_first, i_count, m_previousOrientations.z);
+    }
+    // Update positions
+    {
+        IntegrateComponent(m_positions.x.data(), m_velocities.x.data(), i_secondCountToIntegrate, i_first, i_count);
+        IntegrateComponent(m_positions.y.data(), m_velocities.y.data(), i_secondCountToIntegrate, i_first, i_count);
+        IntegrateComponent(m_positions.z.data(), m_velocities.z.data(), i_secondCountToIntegrate, i_first, i_count);
+    }
+    // Update orientations
+    {
+        // The rotation during this update is applied in local space
+        // (i.e. the orientation is multiplied by it on the right)
+        for (size_t i = i_first, end = i_first + i_count; i < end; ++i)
+        {
+            m_rotationAngles[i] = m_angularSpeeds[i] * i_secondCountToIntegrate;
+        }
+        Math::MakeFromAxisAngles(m_rotationAngles.data(),
+            m_angularVelocityAxes.x.data(), m_angularVelocityAxes.y.data(), m_angularVelocityAxes.z.data(),
+            i_first, i_count, m_rotations);
+        Math::Multiply(m_orientations, m_rotations, i_first, i_count, m_orientations);
+        Math::Normalize(m_orientations, i_first, i_count);
+    }
+}
+
+void eae6320::Physics::cWorld::UpdateTransforms() const
+{
+    UpdateTransforms(0, GetBodyCount());
+}
+
+void eae6320::Physics::cWorld::UpdateTransforms(const size_t i_first, const size_t i_count) const
+{
+    EAE6320_ASSERT((i_first + i_count) <= GetBodyCount());
+    for (size_t i = i_first, end = i_first + i_count; i < end; ++i)
+    {
+        if (auto* const transform = m_transforms[i])
+        {
+            transform->position = m_positions.Get(i);
+            transform->orientation = m_orientations.Get(i);
+            transform->UpdateLocalAxes();
+        }
+    }
+}
+
+void eae6320::Physics::cWorld::InterpolateTransforms(const float i_t)
+{
+    InterpolateTransforms(i_t, 0, GetBodyCount());
+}
+
+void eae6320::Physics::cWorld::InterpolateTransforms(const float i_t, const size_t i_first, const size_t i_count)
+{
+    EAE6320_ASSERT((i_first + i_count) <= GetBodyCount());
+    EAE6320_ASSERT((i_t >= 0.0f) && (i_t <= 1.0f));
+    if (i_count == 0)
+    {
+        return;
+    }
+
+    // Every body is blended at once
+    {
+        InterpolateComponent(m_previousPositions.x.data(), m_positions.x.data(), i_t, i_first, i_count, m_interpolatedPositions.x.data());
+        InterpolateComponent(m_previousPositions.y.data(), m_positions.y.data(), i_t, i_first, i_count, m_interpolatedPositions.y.data());
+        InterpolateComponent(m_previousPositions.z.data(), m_positions.z.data(), i_t, i_first, i_count, m_interpolatedPositions.z.data());
+        Math::Nlerp(m_previousOrientations, m_orientations, i_t, i_first, i_count, m_interpolatedOrientations);
+    }
+    // and then copied into the transforms that are rendered
+    for (size_t i = i_first, end = i_first + i_count; i < end; ++i)
+    {
+        if (auto* const predictionTransform = m_predictionTransforms[i])
+        {
+            predictionTransform->position = m_interpolatedPositions.Get(i);
+            predictionTransform->orientation = m_interpolatedOrientations.Get(i);
+        }
+    }
+}
+
+// Collision Detection
+//--------------------
+
+void eae6320::Physics::cWorld::UpdateBounds()
+{
+    UpdateBounds(0, GetBodyCount());
+}
+
+void eae6320::Physics::cWorld::UpdateBounds(const size_t i_first, const size_t i_count)
+{
+    EAE6320_ASSERT((i_first + i_count) <= GetBodyCount());
+
+    auto i = i_first;
+    const auto end = i_first + i_count;
+#if defined( EAE6320_MATH_SIMD )
+    // Four bodies are calculated at a time
+    {
+        const auto one = Math::Simd::Splat(1.0f);
+        for (; (i + 4) <= end; i += 4)
+        {
+            using Math::Simd::Load;
+            const Math::Simd::tFloat4 position[] = { Load(&m_positions.x[i]), Load(&m_positions.y[i]), Load(&m_positions.z[i]) };
+            const Math::Simd::tFloat4 orientation[] =
+            {
+                Load(&m_orientations.w[i]), Load(&m_orientations.x[i]), Load(&m_orientations.y[i]), Load(&m_orientations.z[i])
+            };
+            const Math::Simd::tFloat4 center_local[] =
+            {
+                Load(&m_localBoundsCenters.x[i]), Load(&m_localBoundsCenters.y[i]), Load(&m_localBoundsCenters.z[i])
+            };
+            const Math::Simd::tFloat4 extents_local[] =
+            {
+                Load(&m_localBoundsExtents.x[i]), Load(&m_localBoundsExtents.y[i]), Load(&m_localBoundsExtents.z[i])
+            };
+            Math::Simd::tFloat4 minimum[3], maximum[3];
+            CalculateBounds(position, orientation, center_local, extents_local, one, minimum, maximum);
+            Math::Simd::Store(minimum[0], &m_bounds.minimum_x[i]);
+            Math::Simd::Store(minimum[1], &m_bounds.minimum_y[i]);
+            Math::Simd::Store(minimum[2], &m_bounds.minimum_z[i]);
+            Math::Simd::Store(maximum[0], &m_bounds.maximum_x[i]);
+            Math::Simd::Store(maximum[1], &m_bounds.maximum_y[i]);
+            Math::Simd::Store(maximum[2], &m_bounds.maximum_z[i]);
+        }
+    }
+#endif
+    // Any remaining bodies are calculated one at a time
+    for (; i < end; ++i)
+    {
+        const float position[] = { m_positions.x[i], m_positions.y[i], m_positions.z[i] };
+        const float orientation[] = { m_orientations.w[i], m_orientations.x[i], m_orientations.y[i], m_orientations.z[i] };
+        const float center_local[] = { m_localBoundsCenters.x[i], m_localBoundsCenters.y[i], m_localBoundsCenters.z[i] };
+        const float extents_local[] = { m_localBoundsExtents.x[i], m_localBoundsExtents.y[i], m_localBoundsExtents.z[i] };
+        float minimum[3], maximum[3];
+        CalculateBounds(position, orientation, center_local, extents_local, 1.0f, minimum, maximum);
+        m_bounds.Set(i, sAabb(Math::sVector(minimum[0], minimum[1], minimum[2]), Math::sVector(maximum[0], maximum[1], maximum[2])));
+    }
+}
+
+eae6320::Physics::sAabb eae6320::Physics::cWorld::GetBounds(const tBodyId i_bodyId) const
+{
+    return m_bounds.Get(GetIndex(i_bodyId));
+}
+
+void eae6320::Physics::cWorld::FindOverlappingPairs()
+{
+    m_broadphase->UpdateProxies(m_bodyIds.data(), m_bounds);
+    m_broadphase->FindOverlappingPairs(m_overlappingPairs);
+}
+
+void eae6320::Physics::cWorld::UpdateContacts()
+{
+    std::swap(m_manifolds, m_previousManifolds);
+    m_manifolds.clear();
+
+    size_t previousManifoldIndex = 0;
+    const auto previousManifoldCount = m_previousManifolds.size();
+    for (const auto& pair : m_overlappingPairs)
+    {
+        if (!DoesBodyExist(pair.proxyA) || !DoesBodyExist(pair.proxyB))
+        {
+            continue;
+        }
+        const auto index_a = GetIndex(pair.proxyA);
+        const auto index_b = GetIndex(pair.proxyB);
+        if ((m_inverseMasses[index_a] <= 0.0f) && (m_inverseMasses[index_b] <= 0.0f))
+        {
+            continue;
+        }
+        // A broadphase can find pairs whose bounds don't actually overlap (e.g. the dynamic tree's boxes are enlarged),
+        // and which ones it finds depends on how the bodies have moved in earlier updates.
+        // Ignoring them makes the contacts only depend on where the bodies are now
+        // (which is what makes a snapshot simulate the same way every time that it is loaded).
+        // The bounds already include the contact distance
+        if (!m_bounds.Get(index_a).Overlaps(m_bounds.Get(index_b)))
+        {
+            continue;
+        }
+
+        // The pair's manifold from the last update is used if there was one
+        // (both are sorted, and so any manifolds before it are for pairs that are no longer overlapping)
+        const auto IsBeforePair = [&pair](const sContactManifold& i_manifold)
+        {
+            return (i_manifold.bodyA < pair.proxyA) || ((i_manifold.bodyA == pair.proxyA) && (i_manifold.bodyB < pair.proxyB));
+        };
+        while ((previousManifoldIndex < previousManifoldCount) && IsBeforePair(m_previousManifolds[previousManifoldIndex]))
+        {
+            ++previousManifoldIndex;
+        }
+        sContactManifold manifold;
+        if ((previousManifoldIndex < previousManifoldCount)
+            && (m_previousManifolds[previousManifoldIndex].bodyA == pair.proxyA) && (m_previousManifolds[previousManifoldIndex].bodyB == pair.proxyB))
+        {
+            manifold = m_previousManifolds[previousManifoldIndex];
+        }
+        else
+        {
+            const auto& shape_a = m_shapes[index_a];
+            const auto& shape_b = m_shapes[index_b];
+            manifold.bodyA = pair.proxyA;
+            manifold.bodyB = pair.proxyB;
+            manifold.friction = std::sqrt(shape_a.friction * shape_b.friction);
+            manifold.restitution = std::max(shape_a.restitution, shape_b.restitution);
+        }
+
+        const auto position_a = m_positions.Get(index_a);
+        const auto orientation_a = m_orientations.Get(index_a);
+        const auto position_b = m_positions.Get(index_b);
+        const auto orientation_b = m_orientations.Get(index_b);
+        Narrowphase::sContact contacts[Narrowphase::maxContactCount];
+        const auto contactCount = Narrowphase::CalculateContacts(m_shapes[index_a], position_a, orientation_a,
+            m_shapes[index_b], position_b, orientation_b, s_contactDistance, contacts);
+        manifold.Update(contacts, contactCount, position_a, orientation_a, position_b, orientation_b, s_contactDistance);
+        if (manifold.pointCount > 0)
+        {
+            m_manifolds.push_back(manifold);
+        }
+    }
+}
+
+// Contact Resolution
+//-------------------
+
+void eae6320::Physics::cWorld::SolveContacts(const float i_secondCountToIntegrate)
+{
+    PrepareIslands(i_secondCountToIntegrate);
+
+    // The islands with the most contacts are solved first
+    // so that a big island doesn't start last and leave the other threads waiting for it
+    const auto islandCount = GetIslandCount();
+    m_islandSolveOrder.resize(islandCount);
+    for (size_t i = 0; i < islandCount; ++i)
+    {
+        m_islandSolveOrder[i] = static_cast<uint32_t>(i);
+    }
+    std::sort(m_islandSolveOrder.begin(), m_islandSolveOrder.end(), [this](const uint32_t i_lhs, const uint32_t i_rhs)
+        {
+            const auto manifoldCount_lhs = m_islands[i_lhs].manifoldCount;
+            const auto manifoldCount_rhs = m_islands[i_rhs].manifoldCount;
+            return (manifoldCount_lhs > manifoldCount_rhs) || ((manifoldCount_lhs == manifoldCount_rhs) && (i_lhs < i_rhs));
+        });
+    // Every island only writes to its own manifolds and bodies,
+    // and so the results are the same no matter which thread solves which island or in which order
+    Concurrency::Jobs::ParallelFor(0, islandCount, 1, [this, i_secondCountToIntegrate](const size_t i_begin, const size_t i_end)
+        {
+            for (auto i = i_begin; i < i_end; ++i)
+            {
+                SolveIsland(m_islandSolveOrder[i], i_secondCountToIntegrate);
+            }
+        });
+}
+
+void eae6320::Physics::cWorld::PrepareIslands(const float i_secondCountToIntegrate)
+{
+    const auto bodyCount = GetBodyCount();
+
+    // Apply gravity
+    if (m_gravity != Math::sVector::zero)
+    {
+        const auto velocityChange = m_gravity * i_secondCountToIntegrate;
+        for (size_t i = 0; i < bodyCount; ++i)
+        {
+            if (m_inverseMasses[i] > 0.0f)
+            {
+                m_velocities.x[i] += velocityChange.x;
+                m_velocities.y[i] += velocityChange.y;
+                m_velocities.z[i] += velocityChange.z;
+            }
+        }
+    }
+
+    m_islands.clear();
+    m_islandManifoldIndices.clear();
+    m_islandBodyIndices.clear();
+    if (m_manifolds.empty())
+    {
+        return;
+    }
+
+    // Every pair of touching dynamic bodies is merged into the same set
+    // (a union-find where each body points to a parent and the root of each tree identifies the set)
+    m_islandParents.resize(bodyCount);
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        m_islandParents[i] = static_cast<uint32_t>(i);
+    }
+    const auto FindRoot = [this](uint32_t i_index)
+    {
+        while (m_islandParents[i_index] != i_index)
+        {
+            // Every other node is pointed at its grandparent to keep the trees flat
+            m_islandParents[i_index] = m_islandParents[m_islandParents[i_index]];
+            i_index = m_islandParents[i_index];
+        }
+        return i_index;
+    };
+    m_solverBodies.resize(bodyCount);
+    for (const auto& manifold : m_manifolds)
+    {
+        const auto index_a = static_cast<uint32_t>(GetIndex(manifold.bodyA));
+        const auto index_b = static_cast<uint32_t>(GetIndex(manifold.bodyB));
+        // Static bodies are included so that the solver can read their velocities,
+        // but they aren't written to and so they can be shared by different islands
+        InitializeSolverBody(index_a);
+        InitializeSolverBody(index_b);
+        if ((m_inverseMasses[index_a] > 0.0f) && (m_inverseMasses[index_b] > 0.0f))
+        {
+            const auto root_a = FindRoot(index_a);
+            const auto root_b = FindRoot(index_b);
+            if (root_a != root_b)
+            {
+                m_islandParents[root_b] = root_a;
+            }
+        }
+    }
+
+    // Each set that has a contact is an island
+    // (the islands are numbered in the order of the manifolds so that the result doesn't depend on the body order)
+    const auto manifoldCount = m_manifolds.size();
+    m_islandIndicesFromRoots.assign(bodyCount, s_invalidIslandIndex);
+    m_islandIndicesFromManifolds.resize(manifoldCount);
+    for (size_t i = 0; i < manifoldCount; ++i)
+    {
+        const auto& manifold = m_manifolds[i];
+        const auto index_a = GetIndex(manifold.bodyA);
+        const auto dynamicIndex = static_cast<uint32_t>((m_inverseMasses[index_a] > 0.0f) ? index_a : GetIndex(manifold.bodyB));
+        const auto root = FindRoot(dynamicIndex);
+        if (m_islandIndicesFromRoots[root] == s_invalidIslandIndex)
+        {
+            m_islandIndicesFromRoots[root] = static_cast<uint32_t>(m_islands.size());
+            m_islands.push_back(sIsland{ 0, 0, 0, 0 });
+        }
+        const auto islandIndex = m_islandIndicesFromRoots[root];
+        m_islandIndicesFromManifolds[i] = islandIndex;
+        ++m_islands[islandIndex].manifoldCount;
+    }
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        if (m_inverseMasses[i] > 0.0f)
+        {
+            const auto islandIndex = m_islandIndicesFromRoots[FindRoot(static_cast<uint32_t>(i))];
+            if (islandIndex != s_invalidIslandIndex)
+            {
+                ++m_islands[islandIndex].bodyCount;
+            }
+        }
+    }
+
+    // The islands' ranges are calculated from their counts
+    // and then the indices are sorted into them
+    {
+        uint32_t firstManifold = 0, firstBody = 0;
+        for (auto& island : m_islands)
+        {
+            island.firstManifold = firstManifold;
+            island.firstBody = firstBody;
+            firstManifold += island.manifoldCount;
+            firstBody += island.bodyCount;
+            island.manifoldCount = 0;
+            island.bodyCount = 0;
+        }
+        m_islandManifoldIndices.resize(firstManifold);
+        m_islandBodyIndices.resize(firstBody);
+    }
+    for (size_t i = 0; i < manifoldCount; ++i)
+    {
+        auto& island = m_islands[m_islandIndicesFromManifolds[i]];
+        m_islandManifoldIndices[island.firstManifold + island.manifoldCount++] = static_cast<uint32_t>(i);
+    }
+    for (size_t i = 0; i < bodyCount; ++i)
+    {
+        if (m_inverseMasses[i] > 0.0f)
+        {
+            const auto islandIndex = m_islandIndicesFromRoots[FindRoot(static_cast<uint32_t>(i))];
+            if (islandIndex != s_invalidIslandIndex)
+            {
+                auto& island = m_islands[islandIndex];
+                m_islandBodyIndices[island.firstBody + island.bodyCount++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+void eae6320::Physics::cWorld::SolveIsland(const size_t i_islandIndex, const float i_secondCountToIntegrate)
+{
+    EAE6320_ASSERT(i_islandIndex < m_islands.size());
+    const auto& island = m_islands[i_islandIndex];
+    const auto* const manifoldIndices = m_islandManifoldIndices.data() + island.firstManifold;
+    const auto inverseSecondCount = (i_secondCountToIntegrate > 0.0f) ? (1.0f / i_secondCountToIntegrate) : 0.0f;
+
+    // Static bodies are shared between islands and so only dynamic bodies are changed
+    const auto ApplyImpulse = [](sSolverBody& io_body, const Math::sVector& i_offset, const Math::sVector& i_impulse)
+    {
+        if (io_body.inverseMass > 0.0f)
+        {
+            io_body.velocity += i_impulse * io_body.inverseMass;
+            io_body.angularVelocity += io_body.MultiplyByInverseInertia(Cross(i_offset, i_impulse));
+        }
+    };
+    const auto CalculateEffectiveMass = [](const sSolverBody& i_body_a, const sSolverBody& i_body_b,
+        const Math::sVector& i_offsetFromA, const Math::sVector& i_offsetFromB, const Math::sVector& i_direction)
+    {
+        const auto angular_a = Cross(i_offsetFromA, i_direction);
+        const auto angular_b = Cross(i_offsetFromB, i_direction);
+        const auto inverseMass = i_body_a.inverseMass + i_body_b.inverseMass
+            + Dot(angular_a, i_body_a.MultiplyByInverseInertia(angular_a)) + Dot(angular_b, i_body_b.MultiplyByInverseInertia(angular_b));
+        return (inverseMass > 0.0f) ? (1.0f / inverseMass) : 0.0f;
+    };
+    const auto CalculateRelativeVelocity = [](const sSolverBody& i_body_a, const sSolverBody& i_body_b,
+        const Math::sVector& i_offsetFromA, const Math::sVector& i_offsetFromB)
+    {
+        return (i_body_b.velocity + Cross(i_body_b.angularVelocity, i_offsetFromB))
+            - (i_body_a.velocity + Cross(i_body_a.angularVelocity, i_offsetFromA));
+    };
+
+    // Prepare the contact points and then apply the impulses from the last update
+    for (uint32_t i = 0; i < island.manifoldCount; ++i)
+    {
+        auto& manifold = m_manifolds[manifoldIndices[i]];
+        const auto index_a = GetIndex(manifold.bodyA);
+        const auto index_b = GetIndex(manifold.bodyB);
+        auto& body_a = m_solverBodies[index_a];
+        auto& body_b = m_solverBodies[index_b];
+        const auto position_a = m_positions.Get(index_a);
+        const auto position_b = m_positions.Get(index_b);
+        const auto orientation_a = m_orientations.Get(index_a);
+        const auto orientation_b = m_orientations.Get(index_b);
+        for (unsigned int j = 0; j < manifold.pointCount; ++j)
+        {
+            auto& point = manifold.points[j];
+            const auto contactPoint = ((position_a + (orientation_a * point.pointOnA_local)) + (position_b + (orientation_b * point.pointOnB_local))) * 0.5f;
+            point.offsetFromA = contactPoint - position_a;
+            point.offsetFromB = contactPoint - position_b;
+
+            // The tangents are calculated from the normal the same way every update
+            // so that the friction impulses from the last update still point the same way
+            const auto& normal = point.normal;
+            point.tangent1 = ((std::abs(normal.x) >= 0.57735f) ? Math::sVector(normal.y, -normal.x, 0.0f) : Math::sVector(0.0f, normal.z, -normal.y)).GetNormalized();
+            point.tangent2 = Cross(normal, point.tangent1);
+
+            point.normalMass = CalculateEffectiveMass(body_a, body_b, point.offsetFromA, point.offsetFromB, normal);
+            point.tangentMass1 = CalculateEffectiveMass(body_a, body_b, point.offsetFromA, point.offsetFromB, point.tangent1);
+            point.tangentMass2 = CalculateEffectiveMass(body_a, body_b, point.offsetFromA, point.offsetFromB, point.tangent2);
+
+            // The velocity bias is the relative normal velocity that the solver aims for
+            if (point.depth < 0.0f)
+            {
+                // A contact that isn't touching yet allows the bodies to move together until they touch
+                point.velocityBias = point.depth * inverseSecondCount;
+            }
+            else
+            {
+                point.velocityBias = s_overlapCorrectionFactor * inverseSecondCount * std::max(point.depth - s_allowedOverlap, 0.0f);
+                const auto normalSpeed = Dot(CalculateRelativeVelocity(body_a, body_b, point.offsetFromA, point.offsetFromB), normal);
+                if (normalSpeed < -s_minSpeedToBounce)
+                {
+                    point.velocityBias = std::max(point.velocityBias, -manifold.restitution * normalSpeed);
+                }
+            }
+
+        }
+    }
+    // (The biases are all calculated before any impulses are applied
+    // so that they are based on the velocities that the bodies had when they collided)
+    for (uint32_t i = 0; i < island.manifoldCount; ++i)
+    {
+        auto& manifold = m_manifolds[manifoldIndices[i]];
+        auto& body_a = m_solverBodies[GetIndex(manifold.bodyA)];
+        auto& body_b = m_solverBodies[GetIndex(manifold.bodyB)];
+        for (unsigned int j = 0; j < manifold.pointCount; ++j)
+        {
+            const auto& point = manifold.points[j];
+            const auto impulse = (point.normal * point.normalImpulse) + (point.tangent1 * point.tangentImpulse1) + (point.tangent2 * point.tangentImpulse2);
+            ApplyImpulse(body_a, point.offsetFromA, -impulse);
+            ApplyImpulse(body_b, point.offsetFromB, impulse);
+        }
+    }
+
+    // Solve every point in turn
+    for (unsigned int iteration = 0; iteration < s_velocityIterationCount; ++iteration)
+    {
+        for (uint32_t i = 0; i < island.manifoldCount; ++i)
+        {
+            auto& manifold = m_manifolds[manifoldIndices[i]];
+            auto& body_a = m_solverBodies[GetIndex(manifold.bodyA)];
+            auto& body_b = m_solverBodies[GetIndex(manifold.bodyB)];
+            for (unsigned int j = 0; j < manifold.pointCount; ++j)
+            {
+                auto& point = manifold.points[j];
+
+                // Friction
+                // (the friction impulse is limited by the normal impulse from the last iteration)
+                {
+                    const auto maxFrictionImpulse = manifold.friction * point.normalImpulse;
+                    const auto ApplyFriction = [&](const Math::sVector& i_tangent, const float i_tangentMass, float& io_accumulatedImpulse)
+                    {
+                        const auto tangentSpeed = Dot(CalculateRelativeVelocity(body_a, body_b, point.offsetFromA, point.offsetFromB), i_tangent);
+                        const auto previousImpulse = io_accumulatedImpulse;
+                        io_accumulatedImpulse = std::min(std::max(previousImpulse - (tangentSpeed * i_tangentMass), -maxFrictionImpulse), maxFrictionImpulse);
+                        const auto impulse = i_tangent * (io_accumulatedImpulse - previousImpulse);
+                        ApplyImpulse(body_a, point.offsetFromA, -impulse);
+                        ApplyImpulse(body_b, point.offsetFromB, impulse);
+                    };
+                    ApplyFriction(point.tangent1, point.tangentMass1, point.tangentImpulse1);
+                    ApplyFriction(point.tangent2, point.tangentMass2, point.tangentImpulse2);
+                }
+                // Normal
+                // (the accumulated impulse can only push the bodies apart,
+                // but an individual iteration can reduce it if an earlier iteration pushed too much)
+                {
+                    const auto normalSpeed = Dot(CalculateRelativeVelocity(body_a, body_b, point.offsetFromA, point.offsetFromB), point.normal);
+                    const auto previousImpulse = point.normalImpulse;
+                    point.normalImpulse = std::max(previousImpulse + ((point.velocityBias - normalSpeed) * point.normalMass), 0.0f);
+                    const auto impulse = point.normal * (point.normalImpulse - previousImpulse);
+                    ApplyImpulse(body_a, point.offsetFromA, -impulse);
+                    ApplyImpulse(body_b, point.offsetFromB, impulse);
+                }
+            }
+        }
+    }
+
+    // Copy the velocities back into the island's bodies
+    for (uint32_t i = 0; i < island.bodyCount; ++i)
+    {
+        const auto index = m_islandBodyIndices[island.firstBody + i];
+        const auto& body = m_solverBodies[index];
+        m_velocities.Set(index, body.velocity);
+        // The angular velocity is stored as a local axis and a speed
+        const auto angularVelocity_local = m_orientations.Get(index).GetInverse() * body.angularVelocity;
+        const auto angularSpeed = angularVelocity_local.GetLength();
+        if (angularSpeed > 1.0e-6f)
+        {
+            m_angularVelocityAxes.Set(index, angularVelocity_local / angularSpeed);
+            m_angularSpeeds[index] = angularSpeed;
+        }
+        else
+        {
+            m_angularSpeeds[index] = 0.0f;
+        }
+    }
+}
+
+// Snapshots
+//----------
+
+void eae6320::Physics::cWorld::SaveSnapshot(cSnapshot& o_snapshot) const
+{
+    const auto bodyCount = GetBodyCount();
+    size_t pointCount = 0;
+    for (const auto& manifold : m_manifolds)
+    {
+        pointCount += manifold.pointCount;
+    }
+    const auto byteCount = sizeof(sSnapshotHeader) + (bodyCount * s_snapshotByteCount_perBody) + sizeof(m_gravity)
+        + (m_manifolds.size() * sizeof(sSnapshotManifold)) + (pointCount * sizeof(sSnapshotContactPoint));
+    // The memory is only reallocated if this is bigger than any snapshot that was saved into it before
+    o_snapshot.m_data.resize(byteCount);
+
+    auto* destination = o_snapshot.m_data.data();
+    {
+        const sSnapshotHeader header = { s_snapshotVersion, static_cast<uint32_t>(bodyCount), static_cast<uint32_t>(m_manifolds.size()) };
+        Write(&header, sizeof(header), destination);
+    }
+    Write(m_bodyIds, destination);
+    Write(m_positions.x, destination);
+    Write(m_positions.y, destination);
+    Write(m_positions.z, destination);
+    Write(m_velocities.x, destination);
+    Write(m_velocities.y, destination);
+    Write(m_velocities.z, destination);
+    Write(m_orientations.w, destination);
+    Write(m_orientations.x, destination);
+    Write(m_orientations.y, destination);
+    Write(m_orientations.z, destination);
+    Write(m_angularVelocityAxes.x, destination);
+    Write(m_angularVelocityAxes.y, destination);
+    Write(m_angularVelocityAxes.z, destination);
+    Write(m_angularSpeeds, destination);
+    Write(&m_gravity, sizeof(m_gravity), destination);
+    for (const auto& manifold : m_manifolds)
+    {
+        const sSnapshotManifold snapshotManifold = { manifold.bodyA, manifold.bodyB, manifold.pointCount, manifold.friction, manifold.restitution };
+        Write(&snapshotManifold, sizeof(snapshotManifold), destination);
+        for (unsigned int i = 0; i < manifold.pointCount; ++i)
+        {
+            const auto& point = manifold.points[i];
+            const sSnapshotContactPoint snapshotPoint = { point.pointOnA_local, point.pointOnB_local, point.normal, point.depth,
+                point.normalImpulse, point.tangentImpulse1, point.tangentImpulse2 };
+            Write(&snapshotPoint, sizeof(snapshotPoint), destination);
+        }
+    }
+    EAE6320_ASSERT(destination == (o_snapshot.m_data.data() + byteCount));
+}
+
+eae6320::cResult eae6320::Physics::cWorld::LoadSnapshot(const cSnapshot& i_snapshot)
+{
+    const auto* source = i_snapshot.m_data.data();
+    const auto* const end = source + i_snapshot.m_data.size();
+    const auto bodyCount = GetBodyCount();
+
+    sSnapshotHeader header;
+    if (!Read(&header, sizeof(header), source, end) || (header.version != s_snapshotVersion))
+    {
+        Logging::OutputError("A physics snapshot couldn't be loaded because it isn't a valid snapshot");
+        return Results::Failure;
+    }
+    if ((header.bodyCount != bodyCount) || (static_cast<size_t>(end - source) < (bodyCount * sizeof(tBodyId)))
+        || ((bodyCount > 0) && (std::memcmp(source, m_bodyIds.data(), bodyCount * sizeof(tBodyId)) != 0)))
+    {
+        Logging::OutputError("A physics snapshot couldn't be loaded because it was saved from a world with different bodies");
+        return Results::Failure;
+    }
+
+    // The manifolds are read first (into the array that UpdateContacts() uses for the previous manifolds)
+    // so that the world isn't changed if the snapshot is cut off
+    {
+        const auto byteCount_bodies = (bodyCount * s_snapshotByteCount_perBody) + sizeof(m_gravity);
+        if (static_cast<size_t>(end - source) < byteCount_bodies)
+        {
+            Logging::OutputError("A physics snapshot couldn't be loaded because it is incomplete");
+            return Results::Failure;
+        }
+        const auto* manifoldSource = source + byteCount_bodies;
+        m_previousManifolds.resize(header.manifoldCount);
+        for (auto& manifold : m_previousManifolds)
+        {
+            sSnapshotManifold snapshotManifold;
+            if (!Read(&snapshotManifold, sizeof(snapshotManifold), manifoldSource, end)
+                || (snapshotManifold.pointCount > sContactManifold::s_maxPointCount)
+                || !DoesBodyExist(snapshotManifold.bodyA) || !DoesBodyExist(snapshotManifold.bodyB))
+            {
+                m_previousManifolds.clear();
+                Logging::OutputError("A physics snapshot couldn't be loaded because its contacts are invalid");
+                return Results::Failure;
+            }
+            manifold = sContactManifold();
+            manifold.bodyA = snapshotManifold.bodyA;
+            manifold.bodyB = snapshotManifold.bodyB;
+            manifold.pointCount = snapshotManifold.pointCount;
+            manifold.friction = snapshotManifold.friction;
+            manifold.restitution = snapshotManifold.restitution;
+            for (unsigned int i = 0; i < manifold.pointCount; ++i)
+            {
+                sSnapshotContactPoint snapshotPoint;
+                if (!Read(&snapshotPoint, sizeof(snapshotPoint), manifoldSource, end))
+                {
+                    m_previousManifolds.clear();
+                    Logging::OutputError("A physics snapshot couldn't be loaded because it is incomplete");
+                    return Results::Failure;
+                }
+                auto& point = manifold.points[i];
+                point.pointOnA_local = snapshotPoint.pointOnA_local;
+                point.pointOnB_local = snapshotPoint.pointOnB_local;
+                point.normal = snapshotPoint.normal;
+                point.depth = snapshotPoint.depth;
+                point.normalImpulse = snapshotPoint.normalImpulse;
+                point.tangentImpulse1 = snapshotPoint.tangentImpulse1;
+                point.tangentImpulse2 = snapshotPoint.tangentImpulse2;
+            }
+        }
+        if (manifoldSource != end)
+        {
+            m_previousManifolds.clear();
+            Logging::OutputError("A physics snapshot couldn't be loaded because it has extra data");
+            return Results::Failure;
+        }
+    }
+
+    // Now that the whole snapshot is known to be valid the bodies can be changed
+    source += bodyCount * sizeof(tBodyId);
+    if (!(Read(m_positions.x, source, end) && Read(m_positions.y, source, end) && Read(m_positions.z, source, end)
+        && Read(m_velocities.x, source, end) && Read(m_velocities.y, source, end) && Read(m_velocities.z, source, end)
+        && Read(m_orientations.w, source, end) && Read(m_orientations.x, source, end)
+        && Read(m_orientations.y, source, end) && Read(m_orientations.z, source, end)
+        && Read(m_angularVelocityAxes.x, source, end) && Read(m_angularVelocityAxes.y, source, end) && Read(m_angularVelocityAxes.z, source, end)
+        && Read(m_angularSpeeds, source, end)
+        && Read(&m_gravity, sizeof(m_gravity), source, end)))
+    {
+        EAE6320_ASSERT(false);
+    }
+    std::swap(m_manifolds, m_previousManifolds);
+    // The islands were calculated from the contacts that were just replaced
+    m_islands.clear();
+    // The bodies jumped to the snapshot's state and so there is nothing to interpolate from
+    m_previousPositions = m_positions;
+    m_previousOrientations = m_orientations;
+    return Results::success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::cWorld::cWorld(const BroadphaseTypes::eType i_broadphaseType)
+    :
+    m_broadphase(&m_sweepAndPrune)
+{
+    switch (i_broadphaseType)
+    {
+    case BroadphaseTypes::SWEEP_AND_PRUNE:
+        m_broadphase = &m_sweepAndPrune;
+        break;
+    case BroadphaseTypes::DYNAMIC_AABB_TREE:
+        m_broadphase = &m_dynamicAabbTree;
+        break;
+    case BroadphaseTypes::SPATIAL_HASH_GRID:
+        m_broadphase = &m_spatialHashGrid;
+        break;
+    default:
+        EAE6320_ASSERTF(false, "Unknown broadphase type %u", static_cast<unsigned int>(i_broadphaseType));
+    }
+}
+
+void eae6320::Physics::cWorld::Reserve(const size_t i_bodyCount)
+{
+    m_positions.Reserve(i_bodyCount);
+    m_velocities.Reserve(i_bodyCount);
+    m_orientations.Reserve(i_bodyCount);
+    m_angularVelocityAxes.Reserve(i_bodyCount);
+    m_angularSpeeds.reserve(i_bodyCount);
+    m_transforms.reserve(i_bodyCount);
+    m_previousPositions.Reserve(i_bodyCount);
+    m_previousOrientations.Reserve(i_bodyCount);
+    m_predictionTransforms.reserve(i_bodyCount);
+    m_localBoundsCenters.Reserve(i_bodyCount);
+    m_localBoundsExtents.Reserve(i_bodyCount);
+    m_bounds.Reserve(i_bodyCount);
+    m_shapes.reserve(i_bodyCount);
+    m_inverseMasses.reserve(i_bodyCount);
+    m_inverseInertias_local.Reserve(i_bodyCount);
+    m_bodyIds.reserve(i_bodyCount);
+    m_indicesFromBodyIds.reserve(i_bodyCount);
+    m_rotations.Reserve(i_bodyCount);
+    m_rotationAngles.reserve(i_bodyCount);
+    m_interpolatedPositions.Reserve(i_bodyCount);
+    m_interpolatedOrientations.Reserve(i_bodyCount);
+}
+
+void eae6320::Physics::cWorld::Clear()
+{
+    m_positions.Clear();
+    m_velocities.Clear();
+    m_orientations.Clear();
+    m_angularVelocityAxes.Clear();
+    m_angularSpeeds.clear();
+    m_transforms.clear();
+    m_previousPositions.Clear();
+    m_previousOrientations.Clear();
+    m_predictionTransforms.clear();
+    m_localBoundsCenters.Clear();
+    m_localBoundsExtents.Clear();
+    m_bounds.Clear();
+    m_shapes.clear();
+    m_inverseMasses.clear();
+    m_inverseInertias_local.Clear();
+    m_bodyIds.clear();
+    m_indicesFromBodyIds.clear();
+    m_unusedBodyIds.clear();
+    m_rotations.Clear();
+    m_rotationAngles.clear();
+    m_interpolatedPositions.Clear();
+    m_interpolatedOrientations.Clear();
+    m_broadphase->Clear();
+    m_overlappingPairs.clear();
+    m_manifolds.clear();
+    m_previousManifolds.clear();
+    m_islands.clear();
+}
+
+// Implementation
+//===============
+
+bool eae6320::Physics::cWorld::DoesBodyExist(const tBodyId i_bodyId) const
+{
+    return (i_bodyId < m_indicesFromBodyIds.size()) && (m_indicesFromBodyIds[i_bodyId] != GetInvalidBodyId());
+}
+
+size_t eae6320::Physics::cWorld::GetIndex(const tBodyId i_bodyId) const
+{
+    EAE6320_ASSERTF((i_bodyId < m_indicesFromBodyIds.size()) && (m_indicesFromBodyIds[i_bodyId] != GetInvalidBodyId()),
+        "The body %u doesn't exist", i_bodyId);
+    return m_indicesFromBodyIds[i_bodyId];
+}
+
+void eae6320::Physics::cWorld::InitializeSolverBody(const size_t i_index)
+{
+    auto& body = m_solverBodies[i_index];
+    const auto orientation = m_orientations.Get(i_index);
+    body.velocity = m_velocities.Get(i_index);
+    body.angularVelocity = orientation * (m_angularVelocityAxes.Get(i_index) * m_angularSpeeds[i_index]);
+    body.inverseMass = m_inverseMasses[i_index];
+    // The world-space inverse inertia is R * I^-1 * R^T,
+    // where the columns of R are the body's local axes in world space
+    {
+        const Math::sVector axes[] =
+        {
+            orientation * Math::sVector(1.0f, 0.0f, 0.0f),
+            orientation * Math::sVector(0.0f, 1.0f, 0.0f),
+            orientation * Math::sVector(0.0f, 0.0f, 1.0f)
+        };
+        const auto inverseInertia_local = m_inverseInertias_local.Get(i_index);
+        const float inverseInertias[] = { inverseInertia_local.x, inverseInertia_local.y, inverseInertia_local.z };
+        // Each row is calculated from the same component of every axis
+        const auto CalculateRow = [&axes, &inverseInertias](const float i_component0, const float i_component1, const float i_component2)
+        {
+            return (axes[0] * (i_component0 * inverseInertias[0]))
+                + (axes[1] * (i_component1 * inverseInertias[1]))
+                + (axes[2] * (i_component2 * inverseInertias[2]));
+        };
+        body.inverseInertia_world[0] = CalculateRow(axes[0].x, axes[1].x, axes[2].x);
+        body.inverseInertia_world[1] = CalculateRow(axes[0].y, axes[1].y, axes[2].y);
+        body.inverseInertia_world[2] = CalculateRow(axes[0].z, axes[1].z, axes[2].z);
+    }
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::sSolverBody::MultiplyByInverseInertia(const Math::sVector& i_vector) const
+{
+    return Math::sVector(Dot(inverseInertia_world[0], i_vector), Dot(inverseInertia_world[1], i_vector), Dot(inverseInertia_world[2], i_vector));
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::Append(const Math::sVector& i_vector)
+{
+    x.push_back(i_vector.x);
+    y.push_back(i_vector.y);
+    z.push_back(i_vector.z);
+}
+
+eae6320::Math::sVector eae6320::Physics::cWorld::sVectorArrays::Get(const size_t i_index) const
+{
+    return Math::sVector(x[i_index], y[i_index], z[i_index]);
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::Set(const size_t i_index, const Math::sVector& i_vector)
+{
+    x[i_index] = i_vector.x;
+    y[i_index] = i_vector.y;
+    z[i_index] = i_vector.z;
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::Resize(const size_t i_count)
+{
+    x.resize(i_count);
+    y.resize(i_count);
+    z.resize(i_count);
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::RemoveBySwapping(const size_t i_index)
+{
+    ::RemoveBySwapping(x, i_index);
+    ::RemoveBySwapping(y, i_index);
+    ::RemoveBySwapping(z, i_index);
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::Reserve(const size_t i_count)
+{
+    x.reserve(i_count);
+    y.reserve(i_count);
+    z.reserve(i_count);
+}
+
+void eae6320::Physics::cWorld::sVectorArrays::Clear()
+{
+    x.clear();
+    y.clear();
+    z.clear();
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void IntegrateComponent(float* const io_positions, const float* const i_velocities, const float i_secondCountToIntegrate,
+        const size_t i_first, const size_t i_count)
+    {
+        auto i = i_first;
+        const auto end = i_first + i_count;
+#if defined( EAE6320_MATH_SIMD )
+        {
+            using namespace eae6320::Math;
+
+            const auto secondCountToIntegrate = Simd::Splat(i_secondCountToIntegrate);
+            for (; (i + 4) <= end; i += 4)
+            {
+                Simd::Store(Simd::Add(Simd::Load(io_positions + i), Simd::Multiply(Simd::Load(i_velocities + i), secondCountToIntegrate)),
+                    io_positions + i);
+            }
+        }
+#endif
+        for (; i < end; ++i)
+        {
+            io_positions[i] = io_positions[i] + (i_velocities[i] * i_secondCountToIntegrate);
+        }
+    }
+
+    void InterpolateComponent(const float* const i_from, const float* const i_to, const float i_t,
+        const size_t i_first, const size_t i_count, float* const o_results)
+    {
+        auto i = i_first;
+        const auto end = i_first + i_count;
+#if defined( EAE6320_MATH_SIMD )
+        {
+            using namespace eae6320::Math;
+
+            const auto t = Simd::Splat(i_t);
+            for (; (i + 4) <= end; i += 4)
+            {
+                const auto from = Simd::Load(i_from + i);
+                Simd::Store(Simd::Add(from, Simd::Multiply(Simd::Subtract(Simd::Load(i_to + i), from), t)), o_results + i);
+            }
+        }
+#endif
+        for (; i < end; ++i)
+        {
+            o_results[i] = i_from[i] + ((i_to[i] - i_from[i]) * i_t);
+        }
+    }
+
+    void CopyRange(const std::vector<float>& i_source, const size_t i_first, const size_t i_count, std::vector<float>& o_destination)
+    {
+        std::copy(i_source.begin() + i_first, i_source.begin() + (i_first + i_count), o_destination.begin() + i_first);
+    }
+
+    template <typename tLanes>
+    void CalculateBounds(const tLanes(&i_position)[3], const tLanes(&i_orientation)[4],
+        const tLanes(&i_center_local)[3], const tLanes(&i_extents_local)[3], const tLanes i_one,
+        tLanes(&o_minimum)[3], tLanes(&o_maximum)[3])
+    {
+        // The rotation matrix is calculated the same way as the cMatrixTransformation constructor
+        // (and is indexed [row][column])
+        const auto& w = i_orientation[0];
+        const auto& x = i_orientation[1];
+        const auto& y = i_orientation[2];
+        const auto& z = i_orientation[3];
+        const auto _2x = Add(x, x);
+        const auto _2y = Add(y, y);
+        const auto _2z = Add(z, z);
+        const auto _2xx = Multiply(x, _2x);
+        const auto _2xy = Multiply(_2x, y);
+        const auto _2xz = Multiply(_2x, z);
+        const auto _2xw = Multiply(_2x, w);
+        const auto _2yy = Multiply(_2y, y);
+        const auto _2yz = Multiply(_2y, z);
+        const auto _2yw = Multiply(_2y, w);
+        const auto _2zz = Multiply(_2z, z);
+        const auto _2zw = Multiply(_2z, w);
+        const tLanes rotation[3][3] =
+        {
+            { Subtract(Subtract(i_one, _2yy), _2zz), Subtract(_2xy, _2zw), Add(_2xz, _2yw) },
+            { Add(_2xy, _2zw), Subtract(Subtract(i_one, _2xx), _2zz), Subtract(_2yz, _2xw) },
+            { Subtract(_2xz, _2yw), Add(_2yz, _2xw), Subtract(Subtract(i_one, _2xx), _2yy) }
+        };
+
+        // The center is transformed like a point,
+        // and the extent along each world axis is the sum of the lengths of the rotated local extents projected onto it
+        for (size_t row = 0; row < 3; ++row)
+        {
+            const auto& rotationRow = rotation[row];
+            const auto center = Add(i_position[row], Add(Add(
+                Multiply(rotationRow[0], i_center_local[0]),
+                Multiply(rotationRow[1], i_center_local[1])),
+                Multiply(rotationRow[2], i_center_local[2])));
+            const auto extent = Add(Add(
+                Multiply(Absolute(rotationRow[0]), i_extents_local[0]),
+                Multiply(Absolute(rotationRow[1]), i_extents_local[1])),
+                Multiply(Absolute(rotationRow[2]), i_extents_local[2]));
+            o_minimum[row] = Subtract(center, extent);
+            o_maximum[row] = Add(center, extent);
+        }
+    }
+
+    template <typename tElement>
+    void RemoveBySwapping(std::vector<tElement>& io_elements, const size_t i_index)
+    {
+        EAE6320_ASSERT(i_index < io_elements.size());
+        io_elements[i_index] = io_elements.back();
+        io_elements.pop_back();
+    }
+
+    void Write(const void* const i_data, const size_t i_byteCount, uint8_t*& io_destination)
+    {
+        if (i_byteCount > 0)
+        {
+            std::memcpy(io_destination, i_data, i_byteCount);
+            io_destination += i_byteCount;
+        }
+    }
+
+    template <typename tElement>
+    void Write(const std::vector<tElement>& i_elements, uint8_t*& io_destination)
+    {
+        Write(i_elements.data(), i_elements.size() * sizeof(tElement), io_destination);
+    }
+
+    bool Read(void* const o_data, const size_t i_byteCount, const uint8_t*& io_source, const uint8_t* const i_end)
+    {
+        if (static_cast<size_t>(i_end - io_source) < i_byteCount)
+        {
+            return false;
+        }
+        if (i_byteCount > 0)
+        {
+            std::memcpy(o_data, io_source, i_byteCount);
+            io_source += i_byteCount;
+        }
+        return true;
+    }
+
+    template <typename tElement>
+    bool Read(std::vector<tElement>& o_elements, const uint8_t*& io_source, const uint8_t* const i_end)
+    {
+        return Read(o_elements.data(), o_elements.size() * sizeof(tElement), io_source, i_end);
+    }
+}
@@ -0,0 +1,341 @@
+/*
+    A physics world simulates the rigid bodies of many objects at once
+
+    The state of every body is stored as a separate array for each component (i.e. "structure of arrays")
+    so that all of the bodies can be integrated in a single pass using SIMD instructions
+    (see TransformBatch.h and QuaternionBatch.h in the Math library).
+    The bodies are integrated the same way as sRigidBodyState::UpdatePosition() and UpdateOrientation().
+
+    The arrays are kept packed: when a body is removed the last body is moved into its place.
+    Bodies are therefore identified by an ID that stays the same for as long as the body exists,
+    and the ID is only translated into an array index when the world is accessed.
+
+    Integration and updating transforms work on ranges of the arrays
+    so that the work can be split up and calculated on different threads
+    (each range only writes to its own bodies).
+
+    Every body also has a shape (see sShape.h) that determines its mass and its bounding box.
+    The world-space boxes are calculated and given to a broadphase (see cbBroadphase.h)
+    which finds the pairs of bodies that might be colliding,
+    and the narrowphase (see Narrowphase.h) then calculates the contacts of the pairs that actually touch.
+
+    The contacts are resolved with sequential impulses:
+    every contact point is solved one at a time and the whole set is iterated a fixed number of times,
+    which converges to the impulses that stop the bodies from moving into each other.
+    The bodies are first grouped into islands of bodies that touch each other
+    (static bodies don't connect islands because the solver never changes their motion),
+    and since the islands are independent they can be solved at the same time on different threads.
+    The impulses of each contact point are kept for the next update to start from (see sContactManifold.h).
+
+    A simulation update is:
+        UpdateBounds(), FindOverlappingPairs(), UpdateContacts(), SolveContacts(), Integrate(), UpdateTransforms()
+    (Update() does all of them, and splits the bounds, integration, and transforms into ranges that run as jobs;
+    see Jobs.h).
+
+    Rendering happens more often than simulation updates,
+    and so the position and orientation of every body before the last integration are also kept.
+    InterpolateTransforms() blends the two states of every body in a single pass
+    (rendering is then one simulation update behind, but nothing is shown where the simulation won't be).
+
+    The simulation is deterministic:
+    the same build given the same bodies and the same inputs calculates exactly the same results every time.
+    Nothing depends on memory addresses or timing,
+    and the contacts only depend on the current state of the bodies and not on the broadphase's history.
+    That state can be saved into a snapshot (see cSnapshot.h) and loaded again,
+    which is what replays and rolling back and simulating again are built on (see cSnapshotHistory.h).
+*/
+
+#ifndef EAE6320_PHYSICS_CWORLD_H
+#define EAE6320_PHYSICS_CWORLD_H
+
+// Include Files
+//==============
+
+#include "cbBroadphase.h"
+#include "cDynamicAabbTree.h"
+#include "cSnapshot.h"
+#include "cSpatialHashGrid.h"
+#include "cSweepAndPrune.h"
+#include "sAabb.h"
+#include "sContactManifold.h"
+#include "sRigidBodyState.h"
+#include "sShape.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Math/QuaternionBatch.h>
+#include <Engine/Results/Results.h>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Transform
+    {
+        struct sPredictionTransform;
+        struct sTransform;
+    }
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cWorld
+        {
+            // Interface
+            //==========
+
+        public:
+
+            using tBodyId = uint32_t;
+            static tBodyId GetInvalidBodyId() { return ~static_cast<tBodyId>(0); }
+
+            // Bodies
+            //-------
+
+            // The shape determines the body's bounds and mass
+            // (a shape with no density makes the body static).
+            // If a transform is provided it is updated with the body's position and orientation by UpdateTransforms()
+            // and if a prediction transform is provided it is updated by InterpolateTransforms()
+            // (the transforms must exist until the body is removed)
+            tBodyId AddBody(const Math::sVector& i_position, const Math::cQuaternion& i_orientation,
+                const sRigidBodyState& i_rigidBodyState, const sShape& i_shape, Transform::sTransform* const i_transform = nullptr,
+                Transform::sPredictionTransform* const i_predictionTransform = nullptr);
+            void RemoveBody(const tBodyId i_bodyId);
+            // Changes the transforms that a body updates
+            // (e.g. when the object that owns them has been moved in memory)
+            void SetTransforms(const tBodyId i_bodyId, Transform::sTransform* const i_transform,
+                Transform::sPredictionTransform* const i_predictionTransform);
+            size_t GetBodyCount() const { return m_bodyIds.size(); }
+
+            // The motion of a body (e.g. after a controller has changed it based on input)
+            sRigidBodyState GetRigidBodyState(const tBodyId i_bodyId) const;
+            void SetRigidBodyState(const tBodyId i_bodyId, const sRigidBodyState& i_rigidBodyState);
+
+            Math::sVector GetPosition(const tBodyId i_bodyId) const;
+            Math::cQuaternion GetOrientation(const tBodyId i_bodyId) const;
+            // These move a body immediately (i.e. without integrating its velocity)
+            // and it isn't interpolated from where it was
+            void SetPosition(const tBodyId i_bodyId, const Math::sVector& i_position);
+            void SetOrientation(const tBodyId i_bodyId, const Math::cQuaternion& i_orientation);
+
+            // Simulation
+            //-----------
+
+            // Does every step of a simulation update in order
+            // (the calling thread waits for the jobs that it runs)
+            void Update(const float i_secondCountToIntegrate);
+
+            // This should be called once per simulation update with the fixed simulation period
+            void Integrate(const float i_secondCountToIntegrate);
+            // Integrates the bodies in the array range [i_first, i_first + i_count)
+            // (the ranges of a single update can be integrated at the same time on different threads)
+            void Integrate(const float i_secondCountToIntegrate, const size_t i_first, const size_t i_count);
+
+            // Copies the positions and orientations of the bodies into their transforms
+            void UpdateTransforms() const;
+            void UpdateTransforms(const size_t i_first, const size_t i_count) const;
+
+            // Blends the positions and orientations from before and after the last integration
+            // and copies them into the bodies' prediction transforms
+            // (i_t is how much of a simulation update has elapsed since the last one, from 0 to 1)
+            void InterpolateTransforms(const float i_t);
+            void InterpolateTransforms(const float i_t, const size_t i_first, const size_t i_count);
+
+            // Collision Detection
+            //--------------------
+
+            // Calculates the world-space bounds of the bodies
+            // (this should be called before finding the pairs whenever the bodies have moved).
+            // The bounds are a little bigger than the shapes
+            // so that the broadphase also finds bodies that are close enough to have contacts before they touch
+            void UpdateBounds();
+            void UpdateBounds(const size_t i_first, const size_t i_count);
+            sAabb GetBounds(const tBodyId i_bodyId) const;
+
+            // Finds the pairs of bodies whose bounds overlap
+            // (the bounds of every body must have been updated first)
+            void FindOverlappingPairs();
+            // The proxy IDs of the pairs are body IDs.
+            // The pairs are from the last time that FindOverlappingPairs() was called,
+            // and so they can include bodies that have been removed since then
+            const std::vector<cbBroadphase::sOverlappingPair>& GetOverlappingPairs() const { return m_overlappingPairs; }
+            // If the world's broadphase is a spatial hash grid then it can also be queried for bodies
+            // (its proxy IDs are body IDs, and its bounds are from the last time that FindOverlappingPairs() was called).
+            // Null is returned for any other broadphase
+            const cSpatialHashGrid* GetSpatialHashGrid() const { return (m_broadphase == &m_spatialHashGrid) ? &m_spatialHashGrid : nullptr; }
+
+            // Calculates the contacts of the overlapping pairs
+            // (this should be called after FindOverlappingPairs()).
+            // Only pairs with at least one dynamic body are calculated
+            void UpdateContacts();
+            // The manifolds are sorted by their body IDs and every one has at least one point
+            const std::vector<sContactManifold>& GetContactManifolds() const { return m_manifolds; }
+
+            // Contact Resolution
+            //-------------------
+
+            // Gravity is applied to the velocities of the dynamic bodies first
+            // so that the contacts of resting bodies cancel it out
+            // (this should be called after UpdateContacts() and before integrating)
+            void SolveContacts(const float i_secondCountToIntegrate);
+            // SolveContacts() applies gravity and finds the islands and then solves every island as jobs (see Jobs.h).
+            // The islands of a single update can be solved at the same time on different threads,
+            // and they are only valid until the next time that a body is added or removed
+            void PrepareIslands(const float i_secondCountToIntegrate);
+            size_t GetIslandCount() const { return m_islands.size(); }
+            void SolveIsland(const size_t i_islandIndex, const float i_secondCountToIntegrate);
+
+            // The acceleration that is applied to every dynamic body
+            // (there is no gravity by default)
+            const Math::sVector& GetGravity() const { return m_gravity; }
+            void SetGravity(const Math::sVector& i_gravity) { m_gravity = i_gravity; }
+
+            // Snapshots
+            //----------
+
+            // Saves everything that the next update depends on:
+            // the motion of every body, the gravity, and the impulses that the contacts will start from.
+            // The bodies' shapes aren't saved,
+            // and so a snapshot can only be loaded into a world that has the same bodies (with the same IDs)
+            void SaveSnapshot(cSnapshot& o_snapshot) const;
+            // The world isn't changed if the snapshot doesn't match it.
+            // The bodies' transforms aren't updated until UpdateTransforms() is called
+            cResult LoadSnapshot(const cSnapshot& i_snapshot);
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            explicit cWorld(const BroadphaseTypes::eType i_broadphaseType = BroadphaseTypes::SWEEP_AND_PRUNE);
+            // The broadphase is referenced by pointer, and so a world can't be copied
+            cWorld(const cWorld&) = delete;
+            cWorld& operator =(const cWorld&) = delete;
+
+            void Reserve(const size_t i_bodyCount);
+            // All bodies are removed (and any IDs that were returned are no longer valid)
+            void Clear();
+
+            // Data
+            //=====
+
+        private:
+
+            struct sVectorArrays
+            {
+                std::vector<float> x, y, z;
+
+                void Append(const Math::sVector& i_vector);
+                Math::sVector Get(const size_t i_index) const;
+                void Set(const size_t i_index, const Math::sVector& i_vector);
+                // New vectors are zero
+                void Resize(const size_t i_count);
+                // The element at i_index is replaced by the last element
+                void RemoveBySwapping(const size_t i_index);
+                void Reserve(const size_t i_count);
+                void Clear();
+            };
+
+            // The state of each body
+            sVectorArrays m_positions;
+            sVectorArrays m_velocities;
+            Math::sQuaternionArrays m_orientations;
+            // The angular velocity is in local space
+            sVectorArrays m_angularVelocityAxes;
+            std::vector<float> m_angularSpeeds;
+            std::vector<Transform::sTransform*> m_transforms;
+            // The state of each body before the last integration
+            sVectorArrays m_previousPositions;
+            Math::sQuaternionArrays m_previousOrientations;
+            std::vector<Transform::sPredictionTransform*> m_predictionTransforms;
+            // The local bounds are stored as a center and half of the size along each axis
+            // so that they can be rotated
+            sVectorArrays m_localBoundsCenters;
+            sVectorArrays m_localBoundsExtents;
+            sAabbArrays m_bounds;
+
+            // Each body's shape and the mass properties that are calculated from it
+            std::vector<sShape> m_shapes;
+            // Static bodies have an inverse mass and inverse inertia of zero
+            std::vector<float> m_inverseMasses;
+            // The inverses of the moments of inertia around the local axes
+            sVectorArrays m_inverseInertias_local;
+            Math::sVector m_gravity;
+
+            // Each body's ID and the array index of each ID
+            std::vector<tBodyId> m_bodyIds;
+            std::vector<uint32_t> m_indicesFromBodyIds;
+            std::vector<tBodyId> m_unusedBodyIds;
+
+            // These are calculated every integration
+            // and are only members so that the memory isn't allocated every update
+            Math::sQuaternionArrays m_rotations;
+            std::vector<float> m_rotationAngles;
+            // These are calculated every interpolation
+            sVectorArrays m_interpolatedPositions;
+            Math::sQuaternionArrays m_interpolatedOrientations;
+
+            // Every broadphase is a member so that the world doesn't need to allocate one,
+            // but only the selected one has any proxies
+            cSweepAndPrune m_sweepAndPrune;
+            cDynamicAabbTree m_dynamicAabbTree;
+            cSpatialHashGrid m_spatialHashGrid;
+            cbBroadphase* m_broadphase;
+            std::vector<cbBroadphase::sOverlappingPair> m_overlappingPairs;
+
+            // The manifolds of the last update are merged with the new pairs
+            // (both are sorted by body IDs, and so a manifold is found without searching)
+            std::vector<sContactManifold> m_manifolds;
+            std::vector<sContactManifold> m_previousManifolds;
+
+            // The solver accesses bodies in the order of the contacts rather than in array order,
+            // and so everything that it needs for a body is copied into a single struct.
+            // The angular velocity is in world space, and the inverse inertia is rotated into world space
+            struct sSolverBody
+            {
+                Math::sVector velocity;
+                Math::sVector angularVelocity;
+                // The rows of the matrix
+                Math::sVector inverseInertia_world[3];
+                float inverseMass;
+
+                Math::sVector MultiplyByInverseInertia(const Math::sVector& i_vector) const;
+            };
+            // There is an element for every body, but only the bodies with contacts are filled in
+            std::vector<sSolverBody> m_solverBodies;
+            // Each island is a range of the manifold indices and a range of the body array indices.
+            // A static body can touch many islands, and so only the dynamic bodies are in an island's range
+            struct sIsland
+            {
+                uint32_t firstManifold, manifoldCount;
+                uint32_t firstBody, bodyCount;
+            };
+            std::vector<sIsland> m_islands;
+            std::vector<uint32_t> m_islandManifoldIndices;
+            std::vector<uint32_t> m_islandBodyIndices;
+            // These are only members so that the memory isn't allocated every update
+            std::vector<uint32_t> m_islandParents;
+            std::vector<uint32_t> m_islandIndicesFromRoots;
+            std::vector<uint32_t> m_islandIndicesFromManifolds;
+            // The islands in the order that SolveContacts() starts solving them
+            std::vector<uint32_t> m_islandSolveOrder;
+
+            // Implementation
+            //===============
+
+        private:
+
+            bool DoesBodyExist(const tBodyId i_bodyId) const;
+            size_t GetIndex(const tBodyId i_bodyId) const;
+            // Copies a body's velocities into its solver body
+            void InitializeSolverBody(const size_t i_index);
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CWORLD_H
@@ -0,0 +1,118 @@
+/*
+    A broadphase finds the pairs of bodies whose bounding boxes overlap
+    so that only those pairs need to be tested for an actual collision
+
+    Each body is represented by a proxy that has the body's axis-aligned bounding box.
+    A proxy is identified by an ID that the owner chooses
+    (the physics world uses its body IDs; see cWorld.h),
+    and the IDs should be small because the broadphases use them as array indices.
+
+    There are three implementations:
+        * Sweep and prune (see cSweepAndPrune.h) is the fastest when most of the bodies move every update
+        * A dynamic AABB tree (see cDynamicAabbTree.h) is better when the bodies are spread out unevenly
+            or when most of them don't move
+        * A spatial hash grid (see cSpatialHashGrid.h) is the best when the bodies are about the same size,
+            and it can also answer queries (e.g. what is inside of a sphere, or what a ray hits)
+    They all find exactly the same pairs.
+*/
+
+#ifndef EAE6320_PHYSICS_CBBROADPHASE_H
+#define EAE6320_PHYSICS_CBBROADPHASE_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+#include <vector>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        struct sAabb;
+        struct sAabbArrays;
+    }
+}
+
+// Broadphase Types
+//=================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        namespace BroadphaseTypes
+        {
+            enum eType : uint8_t
+            {
+                SWEEP_AND_PRUNE,
+                DYNAMIC_AABB_TREE,
+                SPATIAL_HASH_GRID
+            };
+        }
+    }
+}
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        class cbBroadphase
+        {
+            // Interface
+            //==========
+
+        public:
+
+            using tProxyId = uint32_t;
+
+            // The proxy with the smaller ID is always first
+            struct sOverlappingPair
+            {
+                tProxyId proxyA, proxyB;
+            };
+
+            // Proxies
+            //--------
+
+            virtual void AddProxy(const tProxyId i_proxyId, const sAabb& i_bounds) = 0;
+            virtual void RemoveProxy(const tProxyId i_proxyId) = 0;
+            // Changes the bounds of many proxies at once:
+            // i_proxyIds has an element for every box in i_bounds
+            virtual void UpdateProxies(const tProxyId* const i_proxyIds, const sAabbArrays& i_bounds) = 0;
+
+            // Pairs
+            //------
+
+            // Every pair of proxies whose bounds overlap is output once
+            // (any existing pairs in o_pairs are cleared).
+            // The pairs are sorted by their IDs so that the order doesn't depend on the broadphase
+            virtual void FindOverlappingPairs(std::vector<sOverlappingPair>& o_pairs) = 0;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // All of the proxies are removed
+            virtual void Clear() = 0;
+
+            virtual ~cbBroadphase() = default;
+        };
+
+        inline bool operator <(const cbBroadphase::sOverlappingPair& i_lhs, const cbBroadphase::sOverlappingPair& i_rhs)
+        {
+            return (i_lhs.proxyA < i_rhs.proxyA) || ((i_lhs.proxyA == i_rhs.proxyA) && (i_lhs.proxyB < i_rhs.proxyB));
+        }
+        inline bool operator ==(const cbBroadphase::sOverlappingPair& i_lhs, const cbBroadphase::sOverlappingPair& i_rhs)
+        {
+            return (i_lhs.proxyA == i_rhs.proxyA) && (i_lhs.proxyB == i_rhs.proxyB);
+        }
+    }
+}
+
+#endif    // EAE6320_PHYSICS_CBBROADPHASE_H
@@ -0,0 +1,109 @@
+// Include Files
+//==============
+
+#include "sAabb.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+#include <initializer_list>
+
+// Interface
+//==========
+
+bool eae6320::Physics::sAabb::Overlaps(const sAabb& i_other) const
+{
+    return (minimum.x <= i_other.maximum.x) && (i_other.minimum.x <= maximum.x)
+        && (minimum.y <= i_other.maximum.y) && (i_other.minimum.y <= maximum.y)
+        && (minimum.z <= i_other.maximum.z) && (i_other.minimum.z <= maximum.z);
+}
+
+bool eae6320::Physics::sAabb::Contains(const sAabb& i_other) const
+{
+    return (minimum.x <= i_other.minimum.x) && (i_other.maximum.x <= maximum.x)
+        && (minimum.y <= i_other.minimum.y) && (i_other.maximum.y <= maximum.y)
+        && (minimum.z <= i_other.minimum.z) && (i_other.maximum.z <= maximum.z);
+}
+
+float eae6320::Physics::sAabb::GetPerimeter() const
+{
+    const auto size = maximum - minimum;
+    return (size.x * size.y) + (size.y * size.z) + (size.z * size.x);
+}
+
+eae6320::Physics::sAabb eae6320::Physics::sAabb::GetExpanded(const float i_distance) const
+{
+    const Math::sVector expansion(i_distance, i_distance, i_distance);
+    return sAabb(minimum - expansion, maximum + expansion);
+}
+
+eae6320::Physics::sAabb eae6320::Physics::Merge(const sAabb& i_lhs, const sAabb& i_rhs)
+{
+    return sAabb(
+        Math::sVector(std::min(i_lhs.minimum.x, i_rhs.minimum.x), std::min(i_lhs.minimum.y, i_rhs.minimum.y), std::min(i_lhs.minimum.z, i_rhs.minimum.z)),
+        Math::sVector(std::max(i_lhs.maximum.x, i_rhs.maximum.x), std::max(i_lhs.maximum.y, i_rhs.maximum.y), std::max(i_lhs.maximum.z, i_rhs.maximum.z)));
+}
+
+// Arrays
+//-------
+
+void eae6320::Physics::sAabbArrays::Append(const sAabb& i_aabb)
+{
+    minimum_x.push_back(i_aabb.minimum.x);
+    minimum_y.push_back(i_aabb.minimum.y);
+    minimum_z.push_back(i_aabb.minimum.z);
+    maximum_x.push_back(i_aabb.maximum.x);
+    maximum_y.push_back(i_aabb.maximum.y);
+    maximum_z.push_back(i_aabb.maximum.z);
+}
+
+eae6320::Physics::sAabb eae6320::Physics::sAabbArrays::Get(const size_t i_index) const
+{
+    EAE6320_ASSERT(i_index < GetCount());
+    return sAabb(Math::sVector(minimum_x[i_index], minimum_y[i_index], minimum_z[i_index]),
+        Math::sVector(maximum_x[i_index], maximum_y[i_index], maximum_z[i_index]));
+}
+
+void eae6320::Physics::sAabbArrays::Set(const size_t i_index, const sAabb& i_aabb)
+{
+    EAE6320_ASSERT(i_index < GetCount());
+    minimum_x[i_index] = i_aabb.minimum.x;
+    minimum_y[i_index] = i_aabb.minimum.y;
+    minimum_z[i_index] = i_aabb.minimum.z;
+    maximum_x[i_index] = i_aabb.maximum.x;
+    maximum_y[i_index] = i_aabb.maximum.y;
+    maximum_z[i_index] = i_aabb.maximum.z;
+}
+
+void eae6320::Physics::sAabbArrays::Resize(const size_t i_count)
+{
+    for (auto* const components : { &minimum_x, &minimum_y, &minimum_z, &maximum_x, &maximum_y, &maximum_z })
+    {
+        components->resize(i_count);
+    }
+}
+
+void eae6320::Physics::sAabbArrays::Reserve(const size_t i_count)
+{
+    for (auto* const components : { &minimum_x, &minimum_y, &minimum_z, &maximum_x, &maximum_y, &maximum_z })
+    {
+        components->reserve(i_count);
+    }
+}
+
+void eae6320::Physics::sAabbArrays::Clear()
+{
+    for (auto* const components : { &minimum_x, &minimum_y, &minimum_z, &maximum_x, &maximum_y, &maximum_z })
+    {
+        components->clear();
+    }
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::sAabb::sAabb(const Math::sVector& i_minimum, const Math::sVector& i_maximum)
+    :
+    minimum(i_minimum), maximum(i_maximum)
+{
+    EAE6320_ASSERT((minimum.x <= maximum.x) && (minimum.y <= maximum.y) && (minimum.z <= maximum.z));
+}
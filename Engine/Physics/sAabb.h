@@ -0,0 +1,77 @@
+/*
+    An axis-aligned bounding box
+
+    The broadphase stores the boxes of many bodies as a separate array for each component
+    (see sAabbArrays) so that one box can be compared against four others at a time using SIMD instructions
+*/
+
+#ifndef EAE6320_PHYSICS_SAABB_H
+#define EAE6320_PHYSICS_SAABB_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <Engine/Math/sVector.h>
+#include <vector>
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        struct sAabb
+        {
+            // Data
+            //=====
+
+            Math::sVector minimum;
+            Math::sVector maximum;
+
+            // Interface
+            //==========
+
+            // Boxes that only touch are considered to overlap
+            bool Overlaps(const sAabb& i_other) const;
+            bool Contains(const sAabb& i_other) const;
+            // Half of the surface area
+            // (it is only used to compare the sizes of boxes, and so the factor of 2 doesn't matter)
+            float GetPerimeter() const;
+            sAabb GetExpanded(const float i_distance) const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            sAabb() = default;
+            sAabb(const Math::sVector& i_minimum, const Math::sVector& i_maximum);
+        };
+
+        // The smallest box that contains both boxes
+        sAabb Merge(const sAabb& i_lhs, const sAabb& i_rhs);
+
+        // The boxes of many bodies
+        struct sAabbArrays
+        {
+            // Data
+            //=====
+
+            std::vector<float> minimum_x, minimum_y, minimum_z;
+            std::vector<float> maximum_x, maximum_y, maximum_z;
+
+            // Interface
+            //==========
+
+            void Append(const sAabb& i_aabb);
+            sAabb Get(const size_t i_index) const;
+            void Set(const size_t i_index, const sAabb& i_aabb);
+            size_t GetCount() const { return minimum_x.size(); }
+            void Resize(const size_t i_count);
+            void Reserve(const size_t i_count);
+            void Clear();
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_SAABB_H
@@ -0,0 +1,56 @@
+// Include Files
+//==============
+
+#include "sContactManifold.h"
+
+#include "Narrowphase.h"
+
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+void eae6320::Physics::sContactManifold::Update(const Narrowphase::sContact* const i_contacts, const unsigned int i_contactCount,
+    const Math::sVector& i_positionA, const Math::cQuaternion& i_orientationA,
+    const Math::sVector& i_positionB, const Math::cQuaternion& i_orientationB, const float i_matchingDistance)
+{
+    EAE6320_ASSERT(i_contactCount <= s_maxPointCount);
+    const auto orientationA_inverse = i_orientationA.GetInverse();
+    const auto orientationB_inverse = i_orientationB.GetInverse();
+    const auto matchingDistanceSquared = i_matchingDistance * i_matchingDistance;
+    sContactPoint newPoints[s_maxPointCount];
+    for (unsigned int i = 0; i < i_contactCount; ++i)
+    {
+        const auto& contact = i_contacts[i];
+        auto& newPoint = newPoints[i];
+        newPoint.pointOnA_local = orientationA_inverse * (contact.pointOnA - i_positionA);
+        newPoint.pointOnB_local = orientationB_inverse * (contact.pointOnB - i_positionB);
+        newPoint.normal = contact.normal;
+        newPoint.depth = contact.depth;
+
+        auto closestIndex = pointCount;
+        auto closestDistanceSquared = matchingDistanceSquared;
+        for (unsigned int j = 0; j < pointCount; ++j)
+        {
+            const auto offset = points[j].pointOnA_local - newPoint.pointOnA_local;
+            const auto distanceSquared = Dot(offset, offset);
+            if (distanceSquared < closestDistanceSquared)
+            {
+                closestIndex = j;
+                closestDistanceSquared = distanceSquared;
+            }
+        }
+        if (closestIndex < pointCount)
+        {
+            const auto& closestPoint = points[closestIndex];
+            newPoint.normalImpulse = closestPoint.normalImpulse;
+            newPoint.tangentImpulse1 = closestPoint.tangentImpulse1;
+            newPoint.tangentImpulse2 = closestPoint.tangentImpulse2;
+        }
+    }
+    for (unsigned int i = 0; i < i_contactCount; ++i)
+    {
+        points[i] = newPoints[i];
+    }
+    pointCount = i_contactCount;
+}
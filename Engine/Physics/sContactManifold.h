@@ -0,0 +1,105 @@
+/*
+    A contact manifold is the set of points where two bodies touch
+
+    The narrowphase calculates up to four points every update,
+    and each point is stored relative to both bodies so that the solver can find them as the bodies move.
+
+    The points also keep the impulses that the solver applied to them
+    so that the next update's solver can start from them ("warm starting"):
+    a resting stack then needs far fewer iterations to stay still.
+    A new point takes the impulses of the previous update's point that was in the same place on body A.
+*/
+
+#ifndef EAE6320_PHYSICS_SCONTACTMANIFOLD_H
+#define EAE6320_PHYSICS_SCONTACTMANIFOLD_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+
+// Forward Declarations
+//=====================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        namespace Narrowphase
+        {
+            struct sContact;
+        }
+    }
+}
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        struct sContactPoint
+        {
+            // Data
+            //=====
+
+            // Relative to each body's position and orientation
+            Math::sVector pointOnA_local;
+            Math::sVector pointOnB_local;
+            // From body A to body B in world space
+            Math::sVector normal;
+            // Positive if the bodies overlap at the point
+            float depth = 0.0f;
+
+            // The accumulated impulses from the last time that the point was solved
+            float normalImpulse = 0.0f;
+            float tangentImpulse1 = 0.0f;
+            float tangentImpulse2 = 0.0f;
+
+            // These are only used by the solver while it solves the point
+            Math::sVector offsetFromA, offsetFromB;
+            Math::sVector tangent1, tangent2;
+            float normalMass = 0.0f;
+            float tangentMass1 = 0.0f;
+            float tangentMass2 = 0.0f;
+            float velocityBias = 0.0f;
+        };
+
+        struct sContactManifold
+        {
+            // Data
+            //=====
+
+            static constexpr unsigned int s_maxPointCount = 4;
+
+            // The world's body IDs
+            // (A always has the smaller ID)
+            uint32_t bodyA = 0;
+            uint32_t bodyB = 0;
+            sContactPoint points[s_maxPointCount];
+            unsigned int pointCount = 0;
+            float friction = 0.0f;
+            float restitution = 0.0f;
+
+            // Interface
+            //==========
+
+            // Replaces the points with new contacts from the narrowphase.
+            // A new point that is closer than the matching distance to a previous point (on body A)
+            // keeps that point's impulses
+            void Update(const Narrowphase::sContact* const i_contacts, const unsigned int i_contactCount,
+                const Math::sVector& i_positionA, const Math::cQuaternion& i_orientationA,
+                const Math::sVector& i_positionB, const Math::cQuaternion& i_orientationB, const float i_matchingDistance);
+
+            bool operator <(const sContactManifold& i_rhs) const
+            {
+                return (bodyA < i_rhs.bodyA) || ((bodyA == i_rhs.bodyA) && (bodyB < i_rhs.bodyB));
+            }
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_SCONTACTMANIFOLD_H
@@ -0,0 +1,227 @@
+// Include Files
+//==============
+
+#include "sShape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Math/Constants.h>
+
+// Interface
+//==========
+
+eae6320::Physics::sAabb eae6320::Physics::sShape::CalculateBounds() const
+{
+    switch (type)
+    {
+    case ShapeTypes::SPHERE:
+        return sAabb(Math::sVector(-radius, -radius, -radius), Math::sVector(radius, radius, radius));
+    case ShapeTypes::CAPSULE:
+        {
+            const auto halfHeight_total = halfHeight + radius;
+            return sAabb(Math::sVector(-radius, -halfHeight_total, -radius), Math::sVector(radius, halfHeight_total, radius));
+        }
+    case ShapeTypes::BOX:
+        return sAabb(-halfExtents, halfExtents);
+    case ShapeTypes::CONVEX_HULL:
+        {
+            EAE6320_ASSERT(hullPoints && (hullPointCount > 0));
+            auto minimum = hullPoints[0];
+            auto maximum = hullPoints[0];
+            for (uint32_t i = 1; i < hullPointCount; ++i)
+            {
+                const auto& point = hullPoints[i];
+                minimum = Math::sVector(std::min(minimum.x, point.x), std::min(minimum.y, point.y), std::min(minimum.z, point.z));
+                maximum = Math::sVector(std::max(maximum.x, point.x), std::max(maximum.y, point.y), std::max(maximum.z, point.z));
+            }
+            return sAabb(minimum, maximum);
+        }
+    default:
+        EAE6320_ASSERTF(false, "Unknown shape type %u", static_cast<unsigned int>(type));
+        return sAabb();
+    }
+}
+
+// Mass
+//-----
+
+float eae6320::Physics::sShape::CalculateVolume() const
+{
+    switch (type)
+    {
+    case ShapeTypes::SPHERE:
+        return (4.0f / 3.0f) * Math::pi * radius * radius * radius;
+    case ShapeTypes::CAPSULE:
+        return (Math::pi * radius * radius * (2.0f * halfHeight)) + ((4.0f / 3.0f) * Math::pi * radius * radius * radius);
+    case ShapeTypes::BOX:
+        return 8.0f * halfExtents.x * halfExtents.y * halfExtents.z;
+    case ShapeTypes::CONVEX_HULL:
+        {
+            const auto bounds = CalculateBounds();
+            const auto size = bounds.maximum - bounds.minimum;
+            return size.x * size.y * size.z;
+        }
+    default:
+        EAE6320_ASSERTF(false, "Unknown shape type %u", static_cast<unsigned int>(type));
+        return 0.0f;
+    }
+}
+
+eae6320::Math::sVector eae6320::Physics::sShape::CalculateInertia(const float i_mass) const
+{
+    switch (type)
+    {
+    case ShapeTypes::SPHERE:
+        {
+            const auto inertia = 0.4f * i_mass * radius * radius;
+            return Math::sVector(inertia, inertia, inertia);
+        }
+    case ShapeTypes::CAPSULE:
+        {
+            // A cylinder and two hemispheres,
+            // with the mass divided between them by their volumes
+            const auto height = 2.0f * halfHeight;
+            const auto radiusSquared = radius * radius;
+            const auto volume_cylinder = Math::pi * radiusSquared * height;
+            const auto volume_sphere = (4.0f / 3.0f) * Math::pi * radiusSquared * radius;
+            const auto volume = volume_cylinder + volume_sphere;
+            if (volume <= 0.0f)
+            {
+                return Math::sVector();
+            }
+            const auto mass_cylinder = i_mass * (volume_cylinder / volume);
+            const auto mass_sphere = i_mass * (volume_sphere / volume);
+            const auto inertia_axis = (0.5f * mass_cylinder * radiusSquared) + (0.4f * mass_sphere * radiusSquared);
+            // The hemispheres' inertia is moved away from the center by the parallel axis theorem
+            const auto inertia_across = (mass_cylinder * ((0.25f * radiusSquared) + ((height * height) / 12.0f)))
+                + (mass_sphere * ((0.4f * radiusSquared) + (0.25f * height * height) + (0.375f * height * radius)));
+            return Math::sVector(inertia_across, inertia_axis, inertia_across);
+        }
+    case ShapeTypes::BOX:
+    case ShapeTypes::CONVEX_HULL:
+        {
+            Math::sVector halfSize = halfExtents;
+            if (type == ShapeTypes::CONVEX_HULL)
+            {
+                const auto bounds = CalculateBounds();
+                halfSize = (bounds.maximum - bounds.minimum) * 0.5f;
+            }
+            const auto x2 = halfSize.x * halfSize.x;
+            const auto y2 = halfSize.y * halfSize.y;
+            const auto z2 = halfSize.z * halfSize.z;
+            const auto factor = i_mass / 3.0f;
+            return Math::sVector(factor * (y2 + z2), factor * (x2 + z2), factor * (x2 + y2));
+        }
+    default:
+        EAE6320_ASSERTF(false, "Unknown shape type %u", static_cast<unsigned int>(type));
+        return Math::sVector();
+    }
+}
+
+// Collision
+//----------
+
+eae6320::Math::sVector eae6320::Physics::sShape::GetCoreSupportPoint(const Math::sVector& i_direction_local) const
+{
+    switch (type)
+    {
+    case ShapeTypes::SPHERE:
+        return Math::sVector();
+    case ShapeTypes::CAPSULE:
+        return Math::sVector(0.0f, (i_direction_local.y >= 0.0f) ? halfHeight : -halfHeight, 0.0f);
+    case ShapeTypes::BOX:
+        return Math::sVector(
+            (i_direction_local.x >= 0.0f) ? halfExtents.x : -halfExtents.x,
+            (i_direction_local.y >= 0.0f) ? halfExtents.y : -halfExtents.y,
+            (i_direction_local.z >= 0.0f) ? halfExtents.z : -halfExtents.z);
+    case ShapeTypes::CONVEX_HULL:
+        {
+            EAE6320_ASSERT(hullPoints && (hullPointCount > 0));
+            auto supportIndex = 0u;
+            auto supportDistance = Dot(hullPoints[0], i_direction_local);
+            for (uint32_t i = 1; i < hullPointCount; ++i)
+            {
+                const auto distance = Dot(hullPoints[i], i_direction_local);
+                if (distance > supportDistance)
+                {
+                    supportIndex = i;
+                    supportDistance = distance;
+                }
+            }
+            return hullPoints[supportIndex];
+        }
+    default:
+        EAE6320_ASSERTF(false, "Unknown shape type %u", static_cast<unsigned int>(type));
+        return Math::sVector();
+    }
+}
+
+float eae6320::Physics::sShape::GetCoreRadius() const
+{
+    return ((type == ShapeTypes::SPHERE) || (type == ShapeTypes::CAPSULE)) ? radius : 0.0f;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::Physics::sShape eae6320::Physics::sShape::CreateSphere(const float i_radius)
+{
+    EAE6320_ASSERT(i_radius >= 0.0f);
+    sShape shape;
+    shape.type = ShapeTypes::SPHERE;
+    shape.radius = i_radius;
+    return shape;
+}
+
+eae6320::Physics::sShape eae6320::Physics::sShape::CreateCapsule(const float i_radius, const float i_halfHeight)
+{
+    EAE6320_ASSERT((i_radius >= 0.0f) && (i_halfHeight >= 0.0f));
+    sShape shape;
+    shape.type = ShapeTypes::CAPSULE;
+    shape.radius = i_radius;
+    shape.halfHeight = i_halfHeight;
+    return shape;
+}
+
+eae6320::Physics::sShape eae6320::Physics::sShape::CreateBox(const Math::sVector& i_halfExtents)
+{
+    EAE6320_ASSERT((i_halfExtents.x >= 0.0f) && (i_halfExtents.y >= 0.0f) && (i_halfExtents.z >= 0.0f));
+    sShape shape;
+    shape.type = ShapeTypes::BOX;
+    shape.halfExtents = i_halfExtents;
+    return shape;
+}
+
+eae6320::Physics::sShape eae6320::Physics::sShape::CreateConvexHull(const Math::sVector* const i_points, const uint32_t i_pointCount)
+{
+    EAE6320_ASSERT(i_points && (i_pointCount > 0));
+    sShape shape;
+    shape.type = ShapeTypes::CONVEX_HULL;
+    shape.hullPoints = i_points;
+    shape.hullPointCount = i_pointCount;
+    return shape;
+}
+
+eae6320::Physics::sShape eae6320::Physics::sShape::CreateFromBounds(const ShapeTypes::eType i_type, const sAabb& i_bounds_local)
+{
+    const Math::sVector halfSize(
+        std::max(std::abs(i_bounds_local.minimum.x), std::abs(i_bounds_local.maximum.x)),
+        std::max(std::abs(i_bounds_local.minimum.y), std::abs(i_bounds_local.maximum.y)),
+        std::max(std::abs(i_bounds_local.minimum.z), std::abs(i_bounds_local.maximum.z)));
+    switch (i_type)
+    {
+    case ShapeTypes::SPHERE:
+        return CreateSphere(std::max(halfSize.x, std::max(halfSize.y, halfSize.z)));
+    case ShapeTypes::CAPSULE:
+        {
+            const auto radius = std::max(halfSize.x, halfSize.z);
+            return CreateCapsule(radius, std::max(halfSize.y - radius, 0.0f));
+        }
+    case ShapeTypes::BOX:
+        return CreateBox(halfSize);
+    default:
+        EAE6320_ASSERTF(false, "A shape of type %u can't be created from bounds", static_cast<unsigned int>(i_type));
+        return CreateBox(halfSize);
+    }
+}
@@ -0,0 +1,128 @@
+/*
+    The collision shape of a rigid body
+
+    Every shape is convex and is centered on its body's position (and rotates with its orientation).
+    Spheres and capsules are represented as a "core" (a point or a segment)
+    and every point that is within the radius of it,
+    and the narrowphase (see Narrowphase.h) uses that to collide them without approximating their curved surfaces.
+
+    The shape also determines the body's mass:
+    the mass is the shape's volume times its density,
+    and a density of zero makes a body static
+    (it has an infinite mass and collisions never change its motion).
+*/
+
+#ifndef EAE6320_PHYSICS_SSHAPE_H
+#define EAE6320_PHYSICS_SSHAPE_H
+
+// Include Files
+//==============
+
+#include "sAabb.h"
+
+#include <cstdint>
+#include <Engine/Math/sVector.h>
+
+// Shape Types
+//============
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        namespace ShapeTypes
+        {
+            enum eType : uint8_t
+            {
+                SPHERE,
+                // The segment of a capsule is along its local y axis
+                CAPSULE,
+                BOX,
+                CONVEX_HULL
+            };
+        }
+    }
+}
+
+// Struct Declaration
+//===================
+
+namespace eae6320
+{
+    namespace Physics
+    {
+        struct sShape
+        {
+            // Data
+            //=====
+
+            ShapeTypes::eType type = ShapeTypes::SPHERE;
+
+            // Spheres and capsules
+            float radius = 0.5f;
+            // Half of the length of a capsule's segment
+            float halfHeight = 0.0f;
+
+            // Half of a box's size along each local axis
+            Math::sVector halfExtents;
+
+            // A convex hull is the smallest convex shape that contains these points.
+            // The points don't need to be only the corners of the hull (e.g. they can be a mesh's vertices),
+            // but every point makes collisions slower.
+            // The array isn't copied, and so it must exist for as long as any body that has the shape
+            const Math::sVector* hullPoints = nullptr;
+            uint32_t hullPointCount = 0;
+
+            // Mass per cubic unit
+            // (zero means that a body is static)
+            float density = 1.0f;
+            // The friction of a contact is the geometric mean of both shapes' friction,
+            // and its restitution is the larger of both shapes' restitution
+            float friction = 0.5f;
+            float restitution = 0.0f;
+
+            // Interface
+            //==========
+
+            bool IsStatic() const { return density <= 0.0f; }
+
+            // Relative to the body's position and orientation
+            sAabb CalculateBounds() const;
+
+            // Mass
+            //-----
+
+            // A convex hull's volume is approximated by the volume of its bounds
+            float CalculateVolume() const;
+            float CalculateMass() const { return density * CalculateVolume(); }
+            // The moments of inertia around the local axes of a body with this shape and the given mass
+            // (the inertia of a convex hull is approximated by the inertia of its bounds)
+            Math::sVector CalculateInertia(const float i_mass) const;
+
+            // Collision
+            //----------
+
+            // The point of the shape's core that is farthest in a local direction
+            // (the shape is every point within GetCoreRadius() of its core).
+            // For a box or a convex hull the core is the whole shape
+            Math::sVector GetCoreSupportPoint(const Math::sVector& i_direction_local) const;
+            float GetCoreRadius() const;
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            static sShape CreateSphere(const float i_radius);
+            static sShape CreateCapsule(const float i_radius, const float i_halfHeight);
+            static sShape CreateBox(const Math::sVector& i_halfExtents);
+            static sShape CreateConvexHull(const Math::sVector* const i_points, const uint32_t i_pointCount);
+            // Creates a shape of the given type that fits local bounds (e.g. a mesh's bounds).
+            // The shape is centered on the body, and so bounds that aren't centered are made symmetric first.
+            // The radius of a sphere or a capsule is the largest half size across its round axes,
+            // which fits round meshes (like a ball or a capsule) exactly.
+            // A convex hull can't be created from bounds
+            static sShape CreateFromBounds(const ShapeTypes::eType i_type, const sAabb& i_bounds_local);
+        };
+    }
+}
+
+#endif    // EAE6320_PHYSICS_SSHAPE_H
@@ -0,0 +1,548 @@
+// Include Files
+//==============
+
+#include "../Platform.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <Engine/Asserts/Asserts.h>
+#include <fcntl.h>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    std::string GetLastSystemError( int* const o_optionalErrorCode = nullptr );
+    eae6320::cResult GetResultFromErrorCode( const int i_errorCode );
+    eae6320::cResult SetLastWriteTime( const char* const i_path, const timespec& i_lastWriteTime, std::string* const o_errorMessage );
+}
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Platform::CopyFile( const char* const i_path_source, const char* const i_path_target,
+    const bool i_shouldFunctionFailIfTargetAlreadyExists, const bool i_shouldTargetFileTimeBeModified,
+    std::string* o_errorMessage )
+{
+    auto result = Results::success;
+
+    sDataFromFile dataFromFile;
+    struct stat sourceInfo;
+
+    if ( i_shouldFunctionFailIfTargetAlreadyExists && DoesFileExist( i_path_target ) )
+    {
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "The target file \"" << i_path_target << "\" already exists";
+            *o_errorMessage = errorMessage.str();
+        }
+        result = Results::Failure;
+        goto OnExit;
+    }
+    if ( stat( i_path_source, &sourceInfo ) != 0 )
+    {
+        int errorCode;
+        const auto systemErrorMessage = GetLastSystemError( &errorCode );
+        if ( o_errorMessage )
+        {
+            *o_errorMessage = systemErrorMessage;
+        }
+        result = GetResultFromErrorCode( errorCode );
+        goto OnExit;
+    }
+    if ( !( result = LoadBinaryFile( i_path_source, dataFromFile, o_errorMessage ) ) )
+    {
+        goto OnExit;
+    }
+    if ( !( result = WriteBinaryFile( i_path_target, dataFromFile.data, dataFromFile.size, o_errorMessage ) ) )
+    {
+        goto OnExit;
+    }
+    // Like on Windows the copy keeps the source's last write time unless it is explicitly requested to be modified
+    // (writing the file already made it the current time)
+    if ( !i_shouldTargetFileTimeBeModified )
+    {
+        if ( !( result = SetLastWriteTime( i_path_target, sourceInfo.st_mtim, o_errorMessage ) ) )
+        {
+            goto OnExit;
+        }
+    }
+
+OnExit:
+
+    dataFromFile.Free();
+
+    return result;
+}
+
+eae6320::cResult eae6320::Platform::CreateDirectoryIfItDoesntExist( const std::string& i_filePath, std::string* const o_errorMessage )
+{
+    // If the path is to a file (likely), remove it so that only the directory remains
+    std::string directory = i_filePath;
+    {
+        const auto pos_slash = directory.find_last_of( '/' );
+        if ( pos_slash == directory.npos )
+        {
+            return Results::success;
+        }
+        directory = directory.substr( 0, pos_slash );
+    }
+    // Create every directory in the path that doesn't exist yet
+    for ( auto pos_slash = directory.find( '/', 1 ); ; pos_slash = directory.find( '/', pos_slash + 1 ) )
+    {
+        const auto parentDirectory = directory.substr( 0, pos_slash );
+        constexpr mode_t readWriteAndSearchPermissions = 0755;
+        if ( ( mkdir( parentDirectory.c_str(), readWriteAndSearchPermissions ) != 0 ) && ( errno != EEXIST ) )
+        {
+            if ( o_errorMessage )
+            {
+                std::ostringstream errorMessage;
+                errorMessage << "The directory \"" << parentDirectory << "\" couldn't be created: " << GetLastSystemError();
+                *o_errorMessage = errorMessage.str();
+            }
+            return Results::Failure;
+        }
+        if ( pos_slash == directory.npos )
+        {
+            break;
+        }
+    }
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Platform::GetCurrentWorkingDirectory( std::string& o_filePath, std::string* const o_errorMessage )
+{
+    // Like on Windows this is the directory that the executable is in
+    // (rather than the directory that the process was started from)
+    char buffer[PATH_MAX];
+    const auto characterCount = readlink( "/proc/self/exe", buffer, sizeof( buffer ) );
+    if ( ( characterCount > 0 ) && ( static_cast<size_t>( characterCount ) < sizeof( buffer ) ) )
+    {
+        o_filePath.assign( buffer, static_cast<size_t>( characterCount ) );
+        // Remove the executable name from file path
+        const auto pos_slash = o_filePath.find_last_of( '/' );
+        o_filePath = o_filePath.substr( 0, pos_slash );
+        return Results::success;
+    }
+    else
+    {
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "Linux failed to get the current working directory: " << GetLastSystemError();
+            *o_errorMessage = errorMessage.str();
+        }
+        return Results::Failure;
+    }
+}
+
+bool eae6320::Platform::DoesFileExist( const char* const i_path, std::string* const o_errorMessage )
+{
+    struct stat fileInfo;
+    if ( stat( i_path, &fileInfo ) == 0 )
+    {
+        return true;
+    }
+    else
+    {
+        int errorCode;
+        const auto errorMessage = GetLastSystemError( &errorCode );
+        EAE6320_ASSERTF( ( ( errorCode == ENOENT ) || ( errorCode == ENOTDIR ) ),
+            "stat() failed with the unexpected error code of %i: %s", errorCode, errorMessage.c_str() );
+        if ( o_errorMessage )
+        {
+            *o_errorMessage = errorMessage;
+        }
+        return false;
+    }
+}
+
+eae6320::cResult eae6320::Platform::ExecuteCommand( const char* const i_command, int* const o_exitCode, std::string* const o_errorMessage )
+{
+    const auto status = system( i_command );
+    if ( ( status != -1 ) && WIFEXITED( status ) )
+    {
+        if ( o_exitCode )
+        {
+            *o_exitCode = WEXITSTATUS( status );
+        }
+        return Results::success;
+    }
+    else
+    {
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "The command \"" << i_command << "\" couldn't be executed or didn't exit normally";
+            if ( status == -1 )
+            {
+                errorMessage << ": " << GetLastSystemError();
+            }
+            *o_errorMessage = errorMessage.str();
+        }
+        return Results::Failure;
+    }
+}
+
+eae6320::cResult eae6320::Platform::GetEnvironmentVariable( const char* const i_key, std::string& o_value, std::string* const o_errorMessage )
+{
+    const auto* const value = getenv( i_key );
+    if ( value )
+    {
+        o_value = value;
+        return Results::success;
+    }
+    else
+    {
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "The environment variable \"" << i_key << "\" doesn't exist";
+            *o_errorMessage = errorMessage.str();
+        }
+        return Results::Platform::environmentVariableDoesntExist;
+    }
+}
+
+eae6320::cResult eae6320::Platform::GetFilesInDirectory( const std::string& i_path, std::vector<std::string>& o_paths,
+    const bool i_shouldSubdirectoriesBeSearchedRecursively, std::string* const o_errorMessage )
+{
+    auto result = Results::success;
+
+    // Transform the path to have a trailing slash
+    const auto path_trailingSlash = ( !i_path.empty() && ( i_path.back() == '/' ) ) ? i_path : ( i_path + "/" );
+
+    auto* const directory = opendir( path_trailingSlash.c_str() );
+    if ( directory )
+    {
+        // Process each file
+        errno = 0;
+        while ( const auto* const entry = readdir( directory ) )
+        {
+            // The first files found are . and ..
+            if ( entry->d_name[0] != '.' )
+            {
+                const auto path = path_trailingSlash + entry->d_name;
+                struct stat fileInfo;
+                if ( stat( path.c_str(), &fileInfo ) != 0 )
+                {
+                    int errorCode;
+                    const auto systemErrorMessage = GetLastSystemError( &errorCode );
+                    if ( o_errorMessage )
+                    {
+                        *o_errorMessage = systemErrorMessage;
+                    }
+                    result = GetResultFromErrorCode( errorCode );
+                    goto OnExit;
+                }
+                if ( S_ISDIR( fileInfo.st_mode ) )
+                {
+                    if ( i_shouldSubdirectoriesBeSearchedRecursively )
+                    {
+                        if ( !( result = GetFilesInDirectory( path, o_paths, i_shouldSubdirectoriesBeSearchedRecursively, o_errorMessage ) ) )
+                        {
+                            goto OnExit;
+                        }
+                    }
+                }
+                else
+                {
+                    o_paths.push_back( path );
+                }
+            }
+            errno = 0;
+        }
+        // Verify that the loop exited because all files were found
+        if ( errno != 0 )
+        {
+            if ( o_errorMessage )
+            {
+                *o_errorMessage = GetLastSystemError();
+            }
+            result = Results::Failure;
+            goto OnExit;
+        }
+    }
+    else
+    {
+        int errorCode;
+        const auto systemErrorMessage = GetLastSystemError( &errorCode );
+        if ( o_errorMessage )
+        {
+            *o_errorMessage = systemErrorMessage;
+        }
+        result = GetResultFromErrorCode( errorCode );
+        goto OnExit;
+    }
+
+OnExit:
+
+    if ( directory )
+    {
+        closedir( directory );
+    }
+
+    return result;
+}
+
+eae6320::cResult eae6320::Platform::GetLastWriteTime( const char* const i_path, uint64_t& o_lastWriteTime, std::string* const o_errorMessage )
+{
+    struct stat fileInfo;
+    if ( stat( i_path, &fileInfo ) == 0 )
+    {
+        // The time is only compared with other last write times,
+        // and so the units just need to be fine enough (nanoseconds are used)
+        constexpr uint64_t nanosecondsPerSecond = 1000000000;
+        o_lastWriteTime = ( static_cast<uint64_t>( fileInfo.st_mtim.tv_sec ) * nanosecondsPerSecond )
+            + static_cast<uint64_t>( fileInfo.st_mtim.tv_nsec );
+        return Results::success;
+    }
+    else
+    {
+        int errorCode;
+        const auto systemErrorMessage = GetLastSystemError( &errorCode );
+        if ( o_errorMessage )
+        {
+            *o_errorMessage = systemErrorMessage;
+        }
+        return GetResultFromErrorCode( errorCode );
+    }
+}
+
+eae6320::cResult eae6320::Platform::InvalidateLastWriteTime( const char* const i_path, std::string* const o_errorMessage )
+{
+    // The earliest possible time on Windows is used on every platform
+    // (1980-01-01 in seconds since the Unix epoch)
+    timespec earliestPossibleTime{};
+    earliestPossibleTime.tv_sec = 315532800;
+    return SetLastWriteTime( i_path, earliestPossibleTime, o_errorMessage );
+}
+
+eae6320::cResult eae6320::Platform::LoadBinaryFile( const char* const i_path, sDataFromFile& o_data, std::string* const o_errorMessage )
+{
+    auto result = Results::success;
+
+    // Initialize the output struct so that if there's an error during this function any existing garbage data isn't misinterpreted
+    {
+        o_data.data = nullptr;
+        o_data.size = 0;
+    }
+
+    sDataFromFile dataFromFile;
+
+    // Open the file
+    const auto fileDescriptor = open( i_path, O_RDONLY );
+    if ( fileDescriptor == -1 )
+    {
+        int errorCode;
+        const auto systemErrorMessage = GetLastSystemError( &errorCode );
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "Linux failed to open the file \"" << i_path << "\" for reading: " << systemErrorMessage;
+            *o_errorMessage = errorMessage.str();
+        }
+        result = GetResultFromErrorCode( errorCode );
+        goto OnExit;
+    }
+    // Get the file's size
+    {
+        struct stat fileInfo;
+        if ( fstat( fileDescriptor, &fileInfo ) != 0 )
+        {
+            if ( o_errorMessage )
+            {
+                std::ostringstream errorMessage;
+                errorMessage << "Linux failed to get the size of the file \"" << i_path << "\": " << GetLastSystemError();
+                *o_errorMessage = errorMessage.str();
+            }
+            result = Results::Failure;
+            goto OnExit;
+        }
+        dataFromFile.size = static_cast<size_t>( fileInfo.st_size );
+    }
+    // Read the file's contents into temporary memory
+    dataFromFile.data = malloc( dataFromFile.size );
+    if ( !dataFromFile.data && ( dataFromFile.size > 0 ) )
+    {
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "Failed to allocate " << dataFromFile.size << " bytes to read in the file \"" << i_path << "\"";
+            *o_errorMessage = errorMessage.str();
+        }
+        result = Results::outOfMemory;
+        goto OnExit;
+    }
+    for ( size_t byteCount_read = 0; byteCount_read < dataFromFile.size; )
+    {
+        const auto byteCount_thisRead = read( fileDescriptor,
+            static_cast<uint8_t*>( dataFromFile.data ) + byteCount_read, dataFromFile.size - byteCount_read );
+        if ( byteCount_thisRead > 0 )
+        {
+            byteCount_read += static_cast<size_t>( byteCount_thisRead );
+        }
+        else if ( ( byteCount_thisRead == -1 ) && ( errno == EINTR ) )
+        {
+            continue;
+        }
+        else
+        {
+            if ( o_errorMessage )
+            {
+                std::ostringstream errorMessage;
+                errorMessage << "Linux failed to read the contents of the file \"" << i_path << "\"";
+                if ( byteCount_thisRead == -1 )
+                {
+                    errorMessage << ": " << GetLastSystemError();
+                }
+                *o_errorMessage = errorMessage.str();
+            }
+            result = Results::Failure;
+            goto OnExit;
+        }
+    }
+
+OnExit:
+
+    if ( result )
+    {
+        o_data = dataFromFile;
+    }
+    else
+    {
+        dataFromFile.Free();
+    }
+    if ( fileDescriptor != -1 )
+    {
+        close( fileDescriptor );
+    }
+
+    return result;
+}
+
+eae6320::cResult eae6320::Platform::WriteBinaryFile( const char* const i_path, const void* const i_data, const size_t i_size, std::string* const o_errorMessage )
+{
+    auto result = Results::success;
+
+    // Open the file (and create it if it doesn't exist)
+    constexpr mode_t readAndWritePermissions = 0644;
+    const auto fileDescriptor = open( i_path, O_WRONLY | O_CREAT | O_TRUNC, readAndWritePermissions );
+    if ( fileDescriptor == -1 )
+    {
+        int errorCode;
+        const auto systemErrorMessage = GetLastSystemError( &errorCode );
+        if ( o_errorMessage )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "Linux failed to open the file \"" << i_path << "\" for writing: " << systemErrorMessage;
+            *o_errorMessage = errorMessage.str();
+        }
+        result = GetResultFromErrorCode( errorCode );
+        goto OnExit;
+    }
+    // Write the data to the file
+    for ( size_t byteCount_written = 0; byteCount_written < i_size; )
+    {
+        const auto byteCount_thisWrite = write( fileDescriptor,
+            static_cast<const uint8_t*>( i_data ) + byteCount_written, i_size - byteCount_written );
+        if ( byteCount_thisWrite >= 0 )
+        {
+            byteCount_written += static_cast<size_t>( byteCount_thisWrite );
+        }
+        else if ( errno != EINTR )
+        {
+            if ( o_errorMessage )
+            {
+                std::ostringstream errorMessage;
+                errorMessage << "Linux failed to write to the file \"" << i_path << "\": " << GetLastSystemError();
+                *o_errorMessage = errorMessage.str();
+            }
+            result = Results::Failure;
+            goto OnExit;
+        }
+    }
+
+OnExit:
+
+    if ( fileDescriptor != -1 )
+    {
+        if ( ( close( fileDescriptor ) != 0 ) && result )
+        {
+            if ( o_errorMessage )
+            {
+                std::ostringstream errorMessage;
+                errorMessage << "Linux failed to close the file \"" << i_path << "\" after writing to it: " << GetLastSystemError();
+                *o_errorMessage = errorMessage.str();
+            }
+            result = Results::Failure;
+        }
+    }
+
+    return result;
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    std::string GetLastSystemError( int* const o_optionalErrorCode )
+    {
+        const auto errorCode = errno;
+        if ( o_optionalErrorCode )
+        {
+            *o_optionalErrorCode = errorCode;
+        }
+        return strerror( errorCode );
+    }
+
+    eae6320::cResult GetResultFromErrorCode( const int i_errorCode )
+    {
+        switch ( i_errorCode )
+        {
+        case ENOENT:
+        case ENOTDIR:
+            return eae6320::Results::fileDoesntExist;
+        case ENOMEM:
+            return eae6320::Results::outOfMemory;
+        default:
+            return eae6320::Results::Failure;
+        }
+    }
+
+    eae6320::cResult SetLastWriteTime( const char* const i_path, const timespec& i_lastWriteTime, std::string* const o_errorMessage )
+    {
+        timespec times[2];
+        {
+            // The last access time is left unchanged
+            times[0].tv_sec = 0;
+            times[0].tv_nsec = UTIME_OMIT;
+            times[1] = i_lastWriteTime;
+        }
+        constexpr int noFlags = 0;
+        if ( utimensat( AT_FDCWD, i_path, times, noFlags ) == 0 )
+        {
+            return eae6320::Results::success;
+        }
+        else
+        {
+            int errorCode;
+            const auto systemErrorMessage = GetLastSystemError( &errorCode );
+            if ( o_errorMessage )
+            {
+                *o_errorMessage = systemErrorMessage;
+            }
+            return GetResultFromErrorCode( errorCode );
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// Include Files
+//==============
+
+#include "../Time.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <time.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // The monotonic clock is measured in nanoseconds
+    constexpr uint64_t s_ticksPerSecond = 1000000000;
+    constexpr double s_secondsPerTick = 1.0 / static_cast<double>( s_ticksPerSecond );
+}
+
+// Interface
+//==========
+
+// Time
+//-----
+
+uint64_t eae6320::Time::GetCurrentSystemTimeTickCount()
+{
+    timespec time;
+    // The monotonic clock is required by POSIX and so this should never fail
+    if ( clock_gettime( CLOCK_MONOTONIC, &time ) != 0 )
+    {
+        EAE6320_ASSERTF( false, "clock_gettime() failed" );
+    }
+    return ( static_cast<uint64_t>( time.tv_sec ) * s_ticksPerSecond ) + static_cast<uint64_t>( time.tv_nsec );
+}
+
+double eae6320::Time::ConvertTicksToSeconds( const uint64_t i_tickCount )
+{
+    return static_cast<double>( i_tickCount ) * s_secondsPerTick;
+}
+
+uint64_t eae6320::Time::ConvertSecondsToTicks( const double i_secondCount )
+{
+    return static_cast<uint64_t>( ( i_secondCount / s_secondsPerTick ) + 0.5 );
+}
+
+double eae6320::Time::ConvertRatePerSecondToRatePerTick( const double i_rate_perSecond )
+{
+    return i_rate_perSecond * s_secondsPerTick;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Time::Initialize()
+{
+    // The frequency of the monotonic clock is always the same,
+    // and so there is nothing to query
+    Logging::OutputMessage( "Initialized time" );
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Time::CleanUp()
+{
+    return Results::success;
+}
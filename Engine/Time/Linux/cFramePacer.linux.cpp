@@ -0,0 +1,46 @@
+// Include Files
+//==============
+
+#include "../cFramePacer.h"
+
+#include "../Time.h"
+
+#include <cerrno>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <time.h>
+
+// Implementation
+//===============
+
+eae6320::cResult eae6320::Time::cFramePacer::InitializePlatformSpecific()
+{
+    // Sleeping on the monotonic clock is already precise
+    // (how precise is measured when the sleep is calibrated)
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::CleanUpPlatformSpecific()
+{
+    return Results::success;
+}
+
+void eae6320::Time::cFramePacer::SleepPlatformSpecific( const uint64_t i_tickCount ) const
+{
+    // Ticks are nanoseconds on the monotonic clock (see Time.linux.cpp),
+    // and so the sleep can end at an absolute time on the same clock.
+    // An absolute time also means that a sleep that is interrupted by a signal can simply be restarted
+    timespec wakeUpTime;
+    {
+        constexpr uint64_t nanosecondsPerSecond = 1000000000;
+        const auto tickCount_wakeUp = GetCurrentSystemTimeTickCount() + i_tickCount;
+        wakeUpTime.tv_sec = static_cast<time_t>( tickCount_wakeUp / nanosecondsPerSecond );
+        wakeUpTime.tv_nsec = static_cast<long>( tickCount_wakeUp % nanosecondsPerSecond );
+    }
+    int result;
+    do
+    {
+        result = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTime, nullptr );
+    } while ( result == EINTR );
+    EAE6320_ASSERTF( result == 0, "clock_nanosleep() failed" );
+}
@@ -8,3 +8,4 @@
 //===================
 
 #pragma comment( lib, "Kernel32.lib" )
+#pragma comment( lib, "Winmm.lib" )
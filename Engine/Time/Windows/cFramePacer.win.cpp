@@ -0,0 +1,126 @@
+// Include Files
+//==============
+
+#include "../cFramePacer.h"
+
+#include "../Time.h"
+
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Windows/Functions.h>
+#include <mmsystem.h>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // This is only defined by newer versions of the Windows SDK
+    // (and it is only supported by Windows 10 version 1803 and later)
+#if defined( CREATE_WAITABLE_TIMER_HIGH_RESOLUTION )
+    constexpr DWORD s_createWaitableTimerHighResolution = CREATE_WAITABLE_TIMER_HIGH_RESOLUTION;
+#else
+    constexpr DWORD s_createWaitableTimerHighResolution = 0x00000002;
+#endif
+
+    // Without this the scheduler only wakes sleeping threads about every 15.6 milliseconds
+    constexpr UINT s_timerResolution_inMilliseconds = 1;
+}
+
+// Implementation
+//===============
+
+eae6320::cResult eae6320::Time::cFramePacer::InitializePlatformSpecific()
+{
+    // Increase the resolution of the scheduler for the old timers
+    // (which are used if the high resolution timer can't be created)
+    m_wasTimerResolutionIncreased = timeBeginPeriod( s_timerResolution_inMilliseconds ) == TIMERR_NOERROR;
+    // Create a waitable timer
+    {
+        constexpr LPSECURITY_ATTRIBUTES defaultSecurityAttributes = nullptr;
+        constexpr LPCWSTR noName = nullptr;
+        constexpr DWORD timerAccess = TIMER_MODIFY_STATE | SYNCHRONIZE;
+        m_waitableTimer = CreateWaitableTimerExW( defaultSecurityAttributes, noName, s_createWaitableTimerHighResolution, timerAccess );
+        if ( m_waitableTimer )
+        {
+            Logging::OutputMessage( "The frame pacer will sleep with a high resolution waitable timer" );
+        }
+        else
+        {
+            // Older versions of Windows don't support high resolution timers,
+            // and the timer will only be as precise as the scheduler
+            constexpr DWORD defaultTimer = 0;
+            m_waitableTimer = CreateWaitableTimerExW( defaultSecurityAttributes, noName, defaultTimer, timerAccess );
+            if ( m_waitableTimer )
+            {
+                Logging::OutputMessage( "The frame pacer will sleep with a waitable timer (high resolution timers aren't supported)" );
+            }
+            else
+            {
+                const auto errorMessage = Windows::GetLastSystemError();
+                EAE6320_ASSERTF( false, "Couldn't create a waitable timer: %s", errorMessage.c_str() );
+                Logging::OutputError( "Windows failed to create a waitable timer for the frame pacer: %s", errorMessage.c_str() );
+                if ( m_wasTimerResolutionIncreased )
+                {
+                    timeEndPeriod( s_timerResolution_inMilliseconds );
+                    m_wasTimerResolutionIncreased = false;
+                }
+                return Results::Failure;
+            }
+        }
+    }
+
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::CleanUpPlatformSpecific()
+{
+    auto result = Results::success;
+
+    if ( m_waitableTimer )
+    {
+        if ( CloseHandle( m_waitableTimer ) == FALSE )
+        {
+            result = Results::Failure;
+            const auto errorMessage = Windows::GetLastSystemError();
+            EAE6320_ASSERTF( false, "Couldn't close the waitable timer: %s", errorMessage.c_str() );
+            Logging::OutputError( "Windows failed to close the frame pacer's waitable timer: %s", errorMessage.c_str() );
+        }
+        m_waitableTimer = nullptr;
+    }
+    if ( m_wasTimerResolutionIncreased )
+    {
+        timeEndPeriod( s_timerResolution_inMilliseconds );
+        m_wasTimerResolutionIncreased = false;
+    }
+
+    return result;
+}
+
+void eae6320::Time::cFramePacer::SleepPlatformSpecific( const uint64_t i_tickCount ) const
+{
+    EAE6320_ASSERT( m_waitableTimer );
+    // A negative due time is relative to now, and it is measured in 100 nanosecond intervals
+    LARGE_INTEGER dueTime;
+    {
+        constexpr double intervalsPerSecond = 1.0e7;
+        dueTime.QuadPart = -static_cast<LONGLONG>( ConvertTicksToSeconds( i_tickCount ) * intervalsPerSecond );
+        if ( dueTime.QuadPart == 0 )
+        {
+            return;
+        }
+    }
+    constexpr LONG dontRepeat = 0;
+    constexpr PTIMERAPCROUTINE noCompletionRoutine = nullptr;
+    constexpr LPVOID noCompletionArgument = nullptr;
+    constexpr BOOL dontResumeSuspendedSystem = FALSE;
+    if ( SetWaitableTimer( m_waitableTimer, &dueTime, dontRepeat, noCompletionRoutine, noCompletionArgument, dontResumeSuspendedSystem ) != FALSE )
+    {
+        const auto result = WaitForSingleObject( m_waitableTimer, INFINITE );
+        EAE6320_ASSERT( result == WAIT_OBJECT_0 );
+    }
+    else
+    {
+        EAE6320_ASSERTF( false, "Couldn't set the waitable timer: %s", Windows::GetLastSystemError().c_str() );
+    }
+}
@@ -0,0 +1,349 @@
+// Include Files
+//==============
+
+#include "cFramePacer.h"
+
+#include "Time.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Engine/Asserts/Asserts.h>
+#include <Engine/Logging/Logging.h>
+#include <thread>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // A wait always spins for at least this long
+    // even if the platform's sleep seems to be precise
+    // (waking up slightly early and spinning is better than waking up late)
+    constexpr double s_minimumSpinDuration_inSeconds = 50.0e-6;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // The estimate rises to a larger sample immediately but falls towards a smaller sample gradually,
+    // so that a single slow sample is enough to make the estimate safe
+    // but a single fast sample isn't enough to make it unsafe
+    void UpdateEstimate( const uint64_t i_sample, const uint64_t i_fallDivisor, uint64_t& io_estimate );
+}
+
+// Interface
+//==========
+
+// Run
+//----
+
+void eae6320::Time::cFramePacer::WaitUntilNextFrame()
+{
+    EAE6320_ASSERT( m_isInitialized );
+
+    const auto tickCount_perFrame = GetTickCountPerFrame();
+    auto tickCount_current = GetCurrentSystemTimeTickCount();
+    // The first frame is never limited because there is no previous frame to pace it from
+    const auto isPaced = ( tickCount_perFrame > 0 ) && ( m_frameCount > 0 );
+    uint64_t tickCount_due;
+    if ( isPaced )
+    {
+        tickCount_due = CalculateWhenNextFrameIsDue( tickCount_current, tickCount_perFrame );
+        WaitUntil( tickCount_due );
+        tickCount_current = GetCurrentSystemTimeTickCount();
+    }
+    else
+    {
+        tickCount_due = tickCount_current;
+    }
+    // Update the statistics
+    if ( isPaced )
+    {
+        const auto tickCount_late = ( tickCount_current > tickCount_due ) ? ( tickCount_current - tickCount_due ) : 0;
+        m_tickCount_lateness_total += tickCount_late;
+        m_tickCount_lateness_max = std::max( m_tickCount_lateness_max, tickCount_late );
+
+        const auto tickCount_sincePreviousFrame = tickCount_current - m_tickCount_currentFrame_start;
+        const auto tickCount_jitter = ( tickCount_sincePreviousFrame > tickCount_perFrame ) ?
+            ( tickCount_sincePreviousFrame - tickCount_perFrame ) : ( tickCount_perFrame - tickCount_sincePreviousFrame );
+        const auto jitter_inSeconds = ConvertTicksToSeconds( tickCount_jitter );
+        m_jitterSquared_total_inSeconds += jitter_inSeconds * jitter_inSeconds;
+        m_tickCount_jitter_max = std::max( m_tickCount_jitter_max, tickCount_jitter );
+
+        ++m_pacedFrameCount;
+    }
+    ++m_frameCount;
+    m_tickCount_currentFrame_due = tickCount_due;
+    m_tickCount_currentFrame_start = tickCount_current;
+}
+
+// Access
+//-------
+
+void eae6320::Time::cFramePacer::GetStatistics( sStatistics& o_statistics ) const
+{
+    o_statistics.frameCount = m_frameCount;
+    o_statistics.missedFrameCount = m_missedFrameCount;
+    if ( m_pacedFrameCount > 0 )
+    {
+        const auto pacedFrameCount = static_cast<double>( m_pacedFrameCount );
+        o_statistics.lateness_mean_inSeconds = ConvertTicksToSeconds( m_tickCount_lateness_total ) / pacedFrameCount;
+        o_statistics.lateness_max_inSeconds = ConvertTicksToSeconds( m_tickCount_lateness_max );
+        o_statistics.jitter_rootMeanSquare_inSeconds = std::sqrt( m_jitterSquared_total_inSeconds / pacedFrameCount );
+        o_statistics.jitter_max_inSeconds = ConvertTicksToSeconds( m_tickCount_jitter_max );
+    }
+    else
+    {
+        o_statistics.lateness_mean_inSeconds = o_statistics.lateness_max_inSeconds = 0.0;
+        o_statistics.jitter_rootMeanSquare_inSeconds = o_statistics.jitter_max_inSeconds = 0.0;
+    }
+    o_statistics.secondCount_slept = ConvertTicksToSeconds( m_tickCount_slept );
+    o_statistics.secondCount_spun = ConvertTicksToSeconds( m_tickCount_spun );
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::SetTargetFrameRate( const double i_frameRate_perSecond )
+{
+    if ( i_frameRate_perSecond < 0.0 )
+    {
+        EAE6320_ASSERTF( false, "A frame rate can't be negative" );
+        Logging::OutputError( "The frame pacer can't use a negative target frame rate (%f)", i_frameRate_perSecond );
+        return Results::Failure;
+    }
+    m_tickCount_perFrame_target = ( i_frameRate_perSecond > 0.0 ) ? ConvertSecondsToTicks( 1.0 / i_frameRate_perSecond ) : 0;
+    if ( m_mode != VerticalBlankAligned )
+    {
+        m_mode = ( m_tickCount_perFrame_target > 0 ) ? TargetFrameRate : Unlimited;
+    }
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::SetBackgroundFrameRate( const double i_frameRate_perSecond )
+{
+    if ( i_frameRate_perSecond < 0.0 )
+    {
+        EAE6320_ASSERTF( false, "A frame rate can't be negative" );
+        Logging::OutputError( "The frame pacer can't use a negative background frame rate (%f)", i_frameRate_perSecond );
+        return Results::Failure;
+    }
+    m_tickCount_perFrame_background = ( i_frameRate_perSecond > 0.0 ) ? ConvertSecondsToTicks( 1.0 / i_frameRate_perSecond ) : 0;
+    return Results::success;
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::AlignWithVerticalBlanks( const double i_refreshRate_perSecond )
+{
+    if ( i_refreshRate_perSecond <= 0.0 )
+    {
+        EAE6320_ASSERTF( false, "A refresh rate must be positive" );
+        Logging::OutputError( "The frame pacer can't be aligned with a non-positive refresh rate (%f)", i_refreshRate_perSecond );
+        return Results::Failure;
+    }
+    m_tickCount_perVerticalBlank = ConvertSecondsToTicks( 1.0 / i_refreshRate_perSecond );
+    m_mode = VerticalBlankAligned;
+    return Results::success;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::Time::cFramePacer::Initialize()
+{
+    EAE6320_ASSERTF( !m_isInitialized, "The frame pacer is already initialized" );
+
+    const auto result = InitializePlatformSpecific();
+    if ( result )
+    {
+        m_isInitialized = true;
+        CalibrateSleep();
+    }
+    return result;
+}
+
+eae6320::cResult eae6320::Time::cFramePacer::CleanUp()
+{
+    if ( !m_isInitialized )
+    {
+        return Results::success;
+    }
+
+    if ( m_frameCount > 0 )
+    {
+        sStatistics statistics;
+        GetStatistics( statistics );
+        const auto secondCount_waited = statistics.secondCount_slept + statistics.secondCount_spun;
+        Logging::OutputMessage( "Frame pacing over %llu frames (%llu missed):"
+            " lateness mean %.3f ms, max %.3f ms; jitter RMS %.3f ms, max %.3f ms; %.1f%% of %.2f seconds of waiting was spent sleeping",
+            static_cast<unsigned long long>( statistics.frameCount ), static_cast<unsigned long long>( statistics.missedFrameCount ),
+            statistics.lateness_mean_inSeconds * 1000.0, statistics.lateness_max_inSeconds * 1000.0,
+            statistics.jitter_rootMeanSquare_inSeconds * 1000.0, statistics.jitter_max_inSeconds * 1000.0,
+            ( secondCount_waited > 0.0 ) ? ( 100.0 * statistics.secondCount_slept / secondCount_waited ) : 0.0, secondCount_waited );
+    }
+
+    const auto result = CleanUpPlatformSpecific();
+    m_isInitialized = false;
+    return result;
+}
+
+eae6320::Time::cFramePacer::~cFramePacer()
+{
+    if ( !CleanUp() )
+    {
+        EAE6320_ASSERT( false );
+    }
+}
+
+// Implementation
+//===============
+
+uint64_t eae6320::Time::cFramePacer::GetTickCountPerFrame() const
+{
+    auto tickCount_perFrame = m_tickCount_perFrame_target;
+    if ( m_mode == VerticalBlankAligned )
+    {
+        // Every frame is displayed for the same whole number of vertical blanks,
+        // and so the frame rate is the integer fraction of the refresh rate that is closest to the target
+        // (the refresh rate itself if there is no target)
+        EAE6320_ASSERT( m_tickCount_perVerticalBlank > 0 );
+        const auto verticalBlankCount_perFrame = std::max( ( m_tickCount_perFrame_target + ( m_tickCount_perVerticalBlank / 2 ) ) / m_tickCount_perVerticalBlank,
+            uint64_t( 1 ) );
+        tickCount_perFrame = verticalBlankCount_perFrame * m_tickCount_perVerticalBlank;
+    }
+    // Being in the background can only make frames slower
+    if ( m_isInBackground && ( m_tickCount_perFrame_background > 0 ) )
+    {
+        tickCount_perFrame = std::max( tickCount_perFrame, m_tickCount_perFrame_background );
+    }
+    return tickCount_perFrame;
+}
+
+uint64_t eae6320::Time::cFramePacer::CalculateWhenNextFrameIsDue( const uint64_t i_tickCount_current, const uint64_t i_tickCount_perFrame )
+{
+    // A frame is due one frame period after the previous frame was due (rather than after it started)
+    // so that a frame that starts a little late doesn't delay every frame after it
+    auto tickCount_due = m_tickCount_currentFrame_due + i_tickCount_perFrame;
+    if ( ( m_mode == VerticalBlankAligned ) && !m_isInBackground
+        && ( m_tickCount_mostRecentBufferSwap > m_tickCount_currentFrame_start ) )
+    {
+        // The most recent buffer swap was of the frame that started most recently
+        // (unless it took more than two frames, in which case it was something unusual like a hitch that shouldn't be learned from)
+        {
+            const auto tickCount_startToBufferSwap = m_tickCount_mostRecentBufferSwap - m_tickCount_currentFrame_start;
+            if ( tickCount_startToBufferSwap < ( 2 * i_tickCount_perFrame ) )
+            {
+                constexpr uint64_t fallDivisor = 16;
+                UpdateEstimate( tickCount_startToBufferSwap, fallDivisor, m_tickCount_startToBufferSwap );
+            }
+        }
+        // Vertical blanks happen every refresh period after the most recent buffer swap,
+        // and the next frame should be swapped at the vertical blank that is closest to one frame period after the current one was.
+        // The frame must start early enough to be ready by then, but any earlier would add latency
+        // (the input it reads would be older when it is displayed)
+        const auto tickCount_bufferSwap_ideal = tickCount_due + m_tickCount_startToBufferSwap;
+        if ( tickCount_bufferSwap_ideal > m_tickCount_mostRecentBufferSwap )
+        {
+            const auto verticalBlankCount = std::max( ( ( tickCount_bufferSwap_ideal - m_tickCount_mostRecentBufferSwap ) + ( m_tickCount_perVerticalBlank / 2 ) )
+                / m_tickCount_perVerticalBlank, uint64_t( 1 ) );
+            const auto tickCount_bufferSwap = m_tickCount_mostRecentBufferSwap + ( verticalBlankCount * m_tickCount_perVerticalBlank );
+            // An eighth of a refresh period of slack makes up for the swap time being an estimate
+            const auto tickCount_early = m_tickCount_startToBufferSwap + ( m_tickCount_perVerticalBlank / 8 );
+            tickCount_due = ( tickCount_bufferSwap > tickCount_early ) ? ( tickCount_bufferSwap - tickCount_early ) : 0;
+            // Two frames must never be displayed at the same vertical blank
+            while ( tickCount_due < ( m_tickCount_currentFrame_start + ( i_tickCount_perFrame / 2 ) ) )
+            {
+                tickCount_due += m_tickCount_perVerticalBlank;
+            }
+        }
+    }
+    // If the application has fallen more than a whole frame behind (e.g. because of a hitch)
+    // the schedule is restarted rather than running frames back to back until it catches up
+    if ( i_tickCount_current > ( tickCount_due + i_tickCount_perFrame ) )
+    {
+        ++m_missedFrameCount;
+        tickCount_due = i_tickCount_current;
+    }
+    return tickCount_due;
+}
+
+void eae6320::Time::cFramePacer::WaitUntil( const uint64_t i_tickCount_due )
+{
+    auto tickCount_current = GetCurrentSystemTimeTickCount();
+    if ( tickCount_current >= i_tickCount_due )
+    {
+        return;
+    }
+    // Sleep for as much of the wait as possible
+    {
+        const auto tickCount_spin_minimum = ConvertSecondsToTicks( s_minimumSpinDuration_inSeconds );
+        const auto tickCount_spin = std::max( m_tickCount_sleepOvershoot, tickCount_spin_minimum );
+        const auto tickCount_remaining = i_tickCount_due - tickCount_current;
+        if ( tickCount_remaining > tickCount_spin )
+        {
+            const auto tickCount_toSleep = tickCount_remaining - tickCount_spin;
+            SleepPlatformSpecific( tickCount_toSleep );
+            const auto tickCount_afterSleeping = GetCurrentSystemTimeTickCount();
+            const auto tickCount_slept = tickCount_afterSleeping - tickCount_current;
+            m_tickCount_slept += tickCount_slept;
+            // Learn from how precise the sleep was
+            {
+                const auto tickCount_overshoot = ( tickCount_slept > tickCount_toSleep ) ? ( tickCount_slept - tickCount_toSleep ) : 0;
+                constexpr uint64_t fallDivisor = 32;
+                UpdateEstimate( tickCount_overshoot, fallDivisor, m_tickCount_sleepOvershoot );
+            }
+            tickCount_current = tickCount_afterSleeping;
+        }
+    }
+    // Spin for the rest of it
+    {
+        const auto tickCount_beforeSpinning = tickCount_current;
+        while ( tickCount_current < i_tickCount_due )
+        {
+            std::this_thread::yield();
+            tickCount_current = GetCurrentSystemTimeTickCount();
+        }
+        m_tickCount_spun += ( tickCount_current > tickCount_beforeSpinning ) ? ( tickCount_current - tickCount_beforeSpinning ) : 0;
+    }
+}
+
+void eae6320::Time::cFramePacer::CalibrateSleep()
+{
+    // Sleep a few times for a short time and measure how late each one wakes up
+    // (the longest overshoot is used so that the first frames don't wake up late;
+    // the estimate is then refined by every sleep while frames are being paced)
+    constexpr unsigned int sleepCount = 8;
+    constexpr double sleepDuration_inSeconds = 1.0e-3;
+    const auto tickCount_toSleep = ConvertSecondsToTicks( sleepDuration_inSeconds );
+    uint64_t tickCount_overshoot_max = 0;
+    for ( unsigned int i = 0; i < sleepCount; ++i )
+    {
+        const auto tickCount_beforeSleeping = GetCurrentSystemTimeTickCount();
+        SleepPlatformSpecific( tickCount_toSleep );
+        const auto tickCount_slept = GetCurrentSystemTimeTickCount() - tickCount_beforeSleeping;
+        if ( tickCount_slept > tickCount_toSleep )
+        {
+            tickCount_overshoot_max = std::max( tickCount_overshoot_max, tickCount_slept - tickCount_toSleep );
+        }
+    }
+    m_tickCount_sleepOvershoot = tickCount_overshoot_max;
+    Logging::OutputMessage( "Sleeping for %.3f ms overshot by as much as %.3f ms, and so frame waits will start spinning that early",
+        sleepDuration_inSeconds * 1000.0, ConvertTicksToSeconds( m_tickCount_sleepOvershoot ) * 1000.0 );
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void UpdateEstimate( const uint64_t i_sample, const uint64_t i_fallDivisor, uint64_t& io_estimate )
+    {
+        EAE6320_ASSERT( i_fallDivisor > 0 );
+        if ( i_sample >= io_estimate )
+        {
+            io_estimate = i_sample;
+        }
+        else
+        {
+            io_estimate -= ( io_estimate - i_sample ) / i_fallDivisor;
+        }
+    }
+}
@@ -0,0 +1,171 @@
+/*
+    A frame pacer limits how frequently the application loop runs
+    so that it doesn't use a whole CPU core submitting frames that nobody will see
+
+    Waiting for the next frame is done in two parts:
+        * Most of the wait is spent sleeping (which lets the CPU idle)
+        * The last short part of the wait is spent spinning (which is precise)
+    Every platform's sleep overshoots the requested time by a different amount,
+    and so how much of each wait is left for spinning is calibrated when the pacer is initialized
+    and then adjusted every time that it sleeps.
+
+    The application loop should wait at the start of an iteration (before it reads input)
+    so that the input it reads is as recent as possible when the frame is submitted.
+*/
+
+#ifndef EAE6320_TIME_CFRAMEPACER_H
+#define EAE6320_TIME_CFRAMEPACER_H
+
+// Include Files
+//==============
+
+#include <cstdint>
+#include <Engine/Results/Results.h>
+
+#if defined( EAE6320_PLATFORM_WINDOWS )
+    #include <Engine/Windows/Includes.h>
+#endif
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Time
+    {
+        class cFramePacer
+        {
+            // Interface
+            //==========
+
+        public:
+
+            enum eMode : uint8_t
+            {
+                // Frames are run as fast as possible
+                Unlimited,
+                // Frames are run at the target frame rate
+                TargetFrameRate,
+                // Frames are run at the display's refresh rate (or at an integer fraction of it if the target frame rate is lower),
+                // and each wait ends just early enough for the frame to be ready before the vertical blank that it will be displayed at
+                // (buffer swaps must wait for vertical blanks for this to work)
+                VerticalBlankAligned,
+            };
+
+            struct sStatistics
+            {
+                uint64_t frameCount = 0;
+                // The number of frames that were due more than a whole frame period before the pacer was asked to wait for them
+                // (the schedule is restarted rather than running frames back to back to catch up)
+                uint64_t missedFrameCount = 0;
+                // How much later than it was due each frame started
+                double lateness_mean_inSeconds = 0.0;
+                double lateness_max_inSeconds = 0.0;
+                // How much the time between the starts of consecutive frames differed from the frame period
+                double jitter_rootMeanSquare_inSeconds = 0.0;
+                double jitter_max_inSeconds = 0.0;
+                // How the time spent waiting was divided
+                double secondCount_slept = 0.0;
+                double secondCount_spun = 0.0;
+            };
+
+            // Run
+            //----
+
+            // This returns when the next frame should start
+            // (immediately if the mode is unlimited and the application isn't in the background)
+            void WaitUntilNextFrame();
+
+            // Access
+            //-------
+
+            eMode GetMode() const { return m_mode; }
+            void GetStatistics( sStatistics& o_statistics ) const;
+
+            // Zero means that frames aren't limited
+            cResult SetTargetFrameRate( const double i_frameRate_perSecond );
+            // The frame rate that is used instead of the target one while the application is in the background
+            // (e.g. when its window is minimized or doesn't have focus).
+            // Zero means that being in the background doesn't change the frame rate
+            cResult SetBackgroundFrameRate( const double i_frameRate_perSecond );
+            void SetIsInBackground( const bool i_isInBackground ) { m_isInBackground = i_isInBackground; }
+            // Once this has been called the mode is VerticalBlankAligned
+            cResult AlignWithVerticalBlanks( const double i_refreshRate_perSecond );
+            // When aligned with vertical blanks this should be called every frame (before waiting)
+            // with the time of the most recent buffer swap, which is when the most recent vertical blank was
+            void SetTickCountOfMostRecentBufferSwap( const uint64_t i_tickCount ) { m_tickCount_mostRecentBufferSwap = i_tickCount; }
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            // Time must be initialized first
+            cResult Initialize();
+            // The statistics are logged when the pacer is cleaned up
+            cResult CleanUp();
+
+            ~cFramePacer();
+
+            // Data
+            //=====
+
+        private:
+
+            eMode m_mode = Unlimited;
+            bool m_isInBackground = false;
+            bool m_isInitialized = false;
+
+            // Zero means that the rate isn't limited
+            uint64_t m_tickCount_perFrame_target = 0;
+            uint64_t m_tickCount_perFrame_background = 0;
+            uint64_t m_tickCount_perVerticalBlank = 0;
+
+            // When the current frame was due to start and when it actually started
+            uint64_t m_tickCount_currentFrame_due = 0;
+            uint64_t m_tickCount_currentFrame_start = 0;
+            uint64_t m_tickCount_mostRecentBufferSwap = 0;
+            // How long it takes from when a frame starts until its buffer swap
+            // (a wait aligned with vertical blanks ends this long before the vertical blank)
+            uint64_t m_tickCount_startToBufferSwap = 0;
+            // How much longer than requested the platform's sleep is expected to take
+            // (a wait spins instead of sleeping for this long)
+            uint64_t m_tickCount_sleepOvershoot = 0;
+
+            // Statistics
+            uint64_t m_frameCount = 0;
+            // Only frames that were waited for are included in the lateness and jitter
+            uint64_t m_pacedFrameCount = 0;
+            uint64_t m_missedFrameCount = 0;
+            uint64_t m_tickCount_lateness_total = 0;
+            uint64_t m_tickCount_lateness_max = 0;
+            double m_jitterSquared_total_inSeconds = 0.0;
+            uint64_t m_tickCount_jitter_max = 0;
+            uint64_t m_tickCount_slept = 0;
+            uint64_t m_tickCount_spun = 0;
+
+#if defined( EAE6320_PLATFORM_WINDOWS )
+            // A waitable timer can sleep for less than a millisecond
+            // (if Windows supports high resolution timers)
+            HANDLE m_waitableTimer = nullptr;
+            bool m_wasTimerResolutionIncreased = false;
+#endif
+
+            // Implementation
+            //===============
+
+        private:
+
+            uint64_t GetTickCountPerFrame() const;
+            uint64_t CalculateWhenNextFrameIsDue( const uint64_t i_tickCount_current, const uint64_t i_tickCount_perFrame );
+            void WaitUntil( const uint64_t i_tickCount_due );
+            void CalibrateSleep();
+
+            // These are implemented differently for each platform
+            cResult InitializePlatformSpecific();
+            cResult CleanUpPlatformSpecific();
+            // The sleep may be shorter or (more likely) longer than requested
+            void SleepPlatformSpecific( const uint64_t i_tickCount ) const;
+        };
+    }
+}
+
+#endif    // EAE6320_TIME_CFRAMEPACER_H
@@ -0,0 +1,281 @@
+// Include Files
+//==============
+
+#include "cTransformHierarchy.h"
+
+#include <algorithm>
+#include <Engine/Asserts/Asserts.h>
+
+// Static Data Initialization
+//===========================
+
+constexpr eae6320::Transform::cTransformHierarchy::tNodeId eae6320::Transform::cTransformHierarchy::invalidNodeId;
+constexpr uint32_t eae6320::Transform::cTransformHierarchy::s_invalidIndex;
+
+// Interface
+//==========
+
+// Nodes
+//------
+
+eae6320::Transform::cTransformHierarchy::tNodeId eae6320::Transform::cTransformHierarchy::CreateNode(
+    const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation, const tNodeId i_parent)
+{
+    // An ID of a node that was destroyed is reused if there is one
+    tNodeId node;
+    if (!m_unusedNodeIds.empty())
+    {
+        node = m_unusedNodeIds.back();
+        m_unusedNodeIds.pop_back();
+    }
+    else
+    {
+        EAE6320_ASSERT(m_indices.size() < invalidNodeId);
+        node = static_cast<tNodeId>(m_indices.size());
+        m_indices.push_back(s_invalidIndex);
+    }
+
+    // The node is added as a root at the end
+    const auto index = static_cast<uint32_t>(m_nodeIds.size());
+    m_parentIndices.push_back(s_invalidIndex);
+    m_subtreeSizes.push_back(1);
+    m_localPositions.push_back(i_localPosition);
+    m_localOrientations.push_back(i_localOrientation);
+    m_worldTransforms.emplace_back();
+    m_areDirty.push_back(1);
+    m_nodeIds.push_back(node);
+    m_indices[node] = index;
+    m_isAnyNodeDirty = true;
+
+    // and then moved to the end of its parent's subtree
+    if (i_parent != invalidNodeId)
+    {
+        SetParent(node, i_parent);
+    }
+
+    return node;
+}
+
+void eae6320::Transform::cTransformHierarchy::DestroyNode(const tNodeId i_node)
+{
+    const auto index = GetIndex(i_node);
+    const auto parentIndex = m_parentIndices[index];
+    const auto end = index + m_subtreeSizes[index];
+
+    // The node's transform is concatenated with each child's
+    // so that the children don't move when they are attached to the node's parent
+    {
+        const auto& localPosition = m_localPositions[index];
+        const auto& localOrientation = m_localOrientations[index];
+        for (auto i = index + 1; i < end; i += m_subtreeSizes[i])
+        {
+            EAE6320_ASSERT(m_parentIndices[i] == index);
+            m_localPositions[i] = localPosition + (localOrientation * m_localPositions[i]);
+            m_localOrientations[i] = (localOrientation * m_localOrientations[i]).GetNormalized();
+            m_parentIndices[i] = parentIndex;
+            m_areDirty[i] = 1;
+            m_isAnyNodeDirty = true;
+        }
+    }
+    if (parentIndex != s_invalidIndex)
+    {
+        AddToSubtreeSizes(parentIndex, -1);
+    }
+
+    // The node is moved to the end and removed
+    const auto count = static_cast<uint32_t>(m_nodeIds.size());
+    RotateNodes(index, index + 1, count);
+    m_parentIndices.pop_back();
+    m_subtreeSizes.pop_back();
+    m_localPositions.pop_back();
+    m_localOrientations.pop_back();
+    m_worldTransforms.pop_back();
+    m_areDirty.pop_back();
+    m_nodeIds.pop_back();
+
+    m_indices[i_node] = s_invalidIndex;
+    m_unusedNodeIds.push_back(i_node);
+}
+
+bool eae6320::Transform::cTransformHierarchy::DoesNodeExist(const tNodeId i_node) const
+{
+    return (i_node < m_indices.size()) && (m_indices[i_node] != s_invalidIndex);
+}
+
+void eae6320::Transform::cTransformHierarchy::SetParent(const tNodeId i_node, const tNodeId i_parent)
+{
+    const auto index = GetIndex(i_node);
+    const auto subtreeSize = m_subtreeSizes[index];
+    const auto parentIndex_old = m_parentIndices[index];
+    const auto parentIndex_new = (i_parent != invalidNodeId) ? GetIndex(i_parent) : s_invalidIndex;
+    EAE6320_ASSERTF((parentIndex_new == s_invalidIndex) || (parentIndex_new < index) || (parentIndex_new >= (index + subtreeSize)),
+        "A node can't be attached to itself or to one of its descendants");
+
+    // The subtree is moved to the end of the new parent's subtree
+    // (which must be found before the subtree sizes change)
+    const auto destination = (parentIndex_new != s_invalidIndex) ?
+        (parentIndex_new + m_subtreeSizes[parentIndex_new]) : static_cast<uint32_t>(m_nodeIds.size());
+    if (parentIndex_old != s_invalidIndex)
+    {
+        AddToSubtreeSizes(parentIndex_old, -static_cast<int32_t>(subtreeSize));
+    }
+    if (parentIndex_new != s_invalidIndex)
+    {
+        AddToSubtreeSizes(parentIndex_new, static_cast<int32_t>(subtreeSize));
+    }
+    m_parentIndices[index] = parentIndex_new;
+    m_areDirty[index] = 1;
+    m_isAnyNodeDirty = true;
+    if (destination > index)
+    {
+        RotateNodes(index, index + subtreeSize, destination);
+    }
+    else if (destination < index)
+    {
+        RotateNodes(destination, index, index + subtreeSize);
+    }
+}
+
+eae6320::Transform::cTransformHierarchy::tNodeId eae6320::Transform::cTransformHierarchy::GetParent(const tNodeId i_node) const
+{
+    const auto parentIndex = m_parentIndices[GetIndex(i_node)];
+    return (parentIndex != s_invalidIndex) ? m_nodeIds[parentIndex] : invalidNodeId;
+}
+
+// Transforms
+//-----------
+
+void eae6320::Transform::cTransformHierarchy::SetLocalTransform(const tNodeId i_node,
+    const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation)
+{
+    const auto index = GetIndex(i_node);
+    m_localPositions[index] = i_localPosition;
+    m_localOrientations[index] = i_localOrientation;
+    m_areDirty[index] = 1;
+    m_isAnyNodeDirty = true;
+}
+
+const eae6320::Math::sVector& eae6320::Transform::cTransformHierarchy::GetLocalPosition(const tNodeId i_node) const
+{
+    return m_localPositions[GetIndex(i_node)];
+}
+
+const eae6320::Math::cQuaternion& eae6320::Transform::cTransformHierarchy::GetLocalOrientation(const tNodeId i_node) const
+{
+    return m_localOrientations[GetIndex(i_node)];
+}
+
+const eae6320::Math::cMatrixTransformation& eae6320::Transform::cTransformHierarchy::GetWorldTransform(const tNodeId i_node) const
+{
+    EAE6320_ASSERTF(!m_isAnyNodeDirty || !m_areDirty[GetIndex(i_node)], "A node's world transform is out-of-date until the world transforms are updated");
+    return m_worldTransforms[GetIndex(i_node)];
+}
+
+void eae6320::Transform::cTransformHierarchy::UpdateWorldTransforms()
+{
+    if (!m_isAnyNodeDirty)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0, count = static_cast<uint32_t>(m_nodeIds.size()); i < count;)
+    {
+        if (!m_areDirty[i])
+        {
+            ++i;
+            continue;
+        }
+        // Every node in a dirty node's subtree is calculated
+        // (each node's parent comes before it, and so has already been calculated)
+        const auto end = i + m_subtreeSizes[i];
+        for (auto j = i; j < end; ++j)
+        {
+            const Math::cMatrixTransformation transform_localToParent(m_localOrientations[j], m_localPositions[j]);
+            const auto parentIndex = m_parentIndices[j];
+            m_worldTransforms[j] = (parentIndex != s_invalidIndex) ?
+                Math::cMatrixTransformation::ConcatenateAffine(m_worldTransforms[parentIndex], transform_localToParent) :
+                transform_localToParent;
+            m_areDirty[j] = 0;
+        }
+        i = end;
+    }
+    m_isAnyNodeDirty = false;
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+void eae6320::Transform::cTransformHierarchy::Reserve(const size_t i_nodeCount)
+{
+    m_parentIndices.reserve(i_nodeCount);
+    m_subtreeSizes.reserve(i_nodeCount);
+    m_localPositions.reserve(i_nodeCount);
+    m_localOrientations.reserve(i_nodeCount);
+    m_worldTransforms.reserve(i_nodeCount);
+    m_areDirty.reserve(i_nodeCount);
+    m_nodeIds.reserve(i_nodeCount);
+    m_indices.reserve(i_nodeCount);
+}
+
+void eae6320::Transform::cTransformHierarchy::Clear()
+{
+    m_parentIndices.clear();
+    m_subtreeSizes.clear();
+    m_localPositions.clear();
+    m_localOrientations.clear();
+    m_worldTransforms.clear();
+    m_areDirty.clear();
+    m_nodeIds.clear();
+    m_indices.clear();
+    m_unusedNodeIds.clear();
+    m_isAnyNodeDirty = false;
+}
+
+// Implementation
+//===============
+
+uint32_t eae6320::Transform::cTransformHierarchy::GetIndex(const tNodeId i_node) const
+{
+    EAE6320_ASSERTF(DoesNodeExist(i_node), "The transform hierarchy node %u doesn't exist", i_node);
+    return m_indices[i_node];
+}
+
+void eae6320::Transform::cTransformHierarchy::RotateNodes(const uint32_t i_begin, const uint32_t i_middle, const uint32_t i_end)
+{
+    EAE6320_ASSERT((i_begin <= i_middle) && (i_middle <= i_end) && (i_end <= m_nodeIds.size()));
+    if ((i_begin == i_middle) || (i_middle == i_end))
+    {
+        return;
+    }
+
+    std::rotate(m_parentIndices.begin() + i_begin, m_parentIndices.begin() + i_middle, m_parentIndices.begin() + i_end);
+    std::rotate(m_subtreeSizes.begin() + i_begin, m_subtreeSizes.begin() + i_middle, m_subtreeSizes.begin() + i_end);
+    std::rotate(m_localPositions.begin() + i_begin, m_localPositions.begin() + i_middle, m_localPositions.begin() + i_end);
+    std::rotate(m_localOrientations.begin() + i_begin, m_localOrientations.begin() + i_middle, m_localOrientations.begin() + i_end);
+    std::rotate(m_worldTransforms.begin() + i_begin, m_worldTransforms.begin() + i_middle, m_worldTransforms.begin() + i_end);
+    std::rotate(m_areDirty.begin() + i_begin, m_areDirty.begin() + i_middle, m_areDirty.begin() + i_end);
+    std::rotate(m_nodeIds.begin() + i_begin, m_nodeIds.begin() + i_middle, m_nodeIds.begin() + i_end);
+
+    // Any node could have its parent in the range that moved
+    const auto firstCount = i_middle - i_begin;
+    const auto secondCount = i_end - i_middle;
+    for (auto& parentIndex : m_parentIndices)
+    {
+        if ((parentIndex != s_invalidIndex) && (parentIndex >= i_begin) && (parentIndex < i_end))
+        {
+            parentIndex = (parentIndex < i_middle) ? (parentIndex + secondCount) : (parentIndex - firstCount);
+        }
+    }
+    for (auto i = i_begin; i < i_end; ++i)
+    {
+        m_indices[m_nodeIds[i]] = i;
+    }
+}
+
+void eae6320::Transform::cTransformHierarchy::AddToSubtreeSizes(const uint32_t i_index, const int32_t i_nodeCountToAdd)
+{
+    for (auto index = i_index; index != s_invalidIndex; index = m_parentIndices[index])
+    {
+        m_subtreeSizes[index] = static_cast<uint32_t>(static_cast<int32_t>(m_subtreeSizes[index]) + i_nodeCountToAdd);
+    }
+}
@@ -0,0 +1,127 @@
+/*
+A transform hierarchy stores the transforms of nodes that can be attached to other nodes
+(e.g. a weapon that is held by a character, or a camera rig on a vehicle)
+
+Each node has a transform relative to its parent (or to the world if it is a root),
+and its local-to-world transform is its parent's local-to-world transform concatenated with its own.
+
+The nodes are stored in depth-first order as separate arrays for each piece of data:
+every node comes after its parent, and a node's descendants come immediately after it.
+This means that a single pass in order can calculate every local-to-world transform
+because a node's parent has always been calculated before the node.
+
+Changing a node's local transform marks it as dirty,
+and updating the world transforms only calculates the subtrees of the dirty nodes
+(a node's whole subtree is calculated together because the descendants' world transforms depend on it)
+and skips everything else.
+
+A node is referred to by an ID that doesn't change when it is moved in the arrays,
+which happens when nodes are created, destroyed, or attached to different parents.
+Those changes have to move the other nodes and so they cost more than updating,
+but they are expected to be much less common.
+*/
+
+#ifndef EAE6320_CTRANSFORMHIERARCHY_H
+#define EAE6320_CTRANSFORMHIERARCHY_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <Engine/Math/cMatrix_transformation.h>
+#include <Engine/Math/cQuaternion.h>
+#include <Engine/Math/sVector.h>
+#include <vector>
+
+// Class Declaration
+//==================
+
+namespace eae6320
+{
+    namespace Transform
+    {
+        class cTransformHierarchy
+        {
+            // Interface
+            //==========
+
+        public:
+
+            using tNodeId = uint32_t;
+            static constexpr tNodeId invalidNodeId = ~static_cast<tNodeId>(0);
+
+            // Nodes
+            //------
+
+            // If no parent is provided then the node is a root
+            // (and its local transform is relative to the world)
+            tNodeId CreateNode(const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation,
+                const tNodeId i_parent = invalidNodeId);
+            // The node's children are attached to its parent (or become roots)
+            // and keep the same world transforms
+            void DestroyNode(const tNodeId i_node);
+            bool DoesNodeExist(const tNodeId i_node) const;
+            // If no parent is provided then the node becomes a root.
+            // The node's local transform doesn't change (and so its world transform does)
+            void SetParent(const tNodeId i_node, const tNodeId i_parent);
+            tNodeId GetParent(const tNodeId i_node) const;
+            size_t GetNodeCount() const { return m_nodeIds.size(); }
+
+            // Transforms
+            //-----------
+
+            void SetLocalTransform(const tNodeId i_node, const Math::sVector& i_localPosition, const Math::cQuaternion& i_localOrientation);
+            const Math::sVector& GetLocalPosition(const tNodeId i_node) const;
+            const Math::cQuaternion& GetLocalOrientation(const tNodeId i_node) const;
+            // This is only up-to-date after UpdateWorldTransforms() has been called
+            const Math::cMatrixTransformation& GetWorldTransform(const tNodeId i_node) const;
+
+            // Calculates the world transform of every node that has changed and of every node below it
+            void UpdateWorldTransforms();
+
+            // Initialization / Clean Up
+            //--------------------------
+
+            void Reserve(const size_t i_nodeCount);
+            // Every node is destroyed
+            void Clear();
+
+            // Data
+            //=====
+
+        private:
+
+            static constexpr uint32_t s_invalidIndex = ~static_cast<uint32_t>(0);
+
+            // These are in depth-first order
+            std::vector<uint32_t> m_parentIndices;
+            // The number of nodes in each node's subtree (including itself)
+            std::vector<uint32_t> m_subtreeSizes;
+            std::vector<Math::sVector> m_localPositions;
+            std::vector<Math::cQuaternion> m_localOrientations;
+            std::vector<Math::cMatrixTransformation> m_worldTransforms;
+            std::vector<uint8_t> m_areDirty;
+            std::vector<tNodeId> m_nodeIds;
+
+            // Indexed by node ID
+            std::vector<uint32_t> m_indices;
+            std::vector<tNodeId> m_unusedNodeIds;
+            bool m_isAnyNodeDirty = false;
+
+            // Implementation
+            //===============
+
+        private:
+
+            uint32_t GetIndex(const tNodeId i_node) const;
+            // Moves the nodes in [i_middle, i_end) to i_begin (like std::rotate())
+            // and updates the parent indices and the node IDs' indices
+            void RotateNodes(const uint32_t i_begin, const uint32_t i_middle, const uint32_t i_end);
+            // Adds to the subtree size of the node and of every node above it
+            void AddToSubtreeSizes(const uint32_t i_index, const int32_t i_nodeCountToAdd);
+        };
+    }
+}
+
+#endif    // EAE6320_CTRANSFORMHIERARCHY_H
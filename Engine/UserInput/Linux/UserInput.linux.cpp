@@ -0,0 +1,40 @@
+// Include Files
+//==============
+
+#include "../UserInput.h"
+
+// Static Data Initialization
+//===========================
+
+namespace eae6320
+{
+    namespace UserInput
+    {
+        // There is never a window to be in focus or a mouse to track
+        bool g_isWindowInFocus = false;
+        bool g_isMouseTracked = false;
+        sMousePoints g_mousePoints;
+    }
+}
+
+// Interface
+//==========
+
+// A headless application has no window to receive keyboard input,
+// and so no key is ever pressed
+// (gameplay code behaves as if the player isn't touching the keyboard)
+
+bool eae6320::UserInput::IsKeyPressed(const uint_fast8_t)
+{
+    return false;
+}
+
+bool eae6320::UserInput::IsKeyPressedOnce(const uint_fast8_t)
+{
+    return false;
+}
+
+bool eae6320::UserInput::IsKeyPressedAndReleased(const uint_fast8_t)
+{
+    return false;
+}
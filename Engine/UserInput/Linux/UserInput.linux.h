@@ -0,0 +1,22 @@
+/*
+This file contains platform-specific global variables
+*/
+
+#ifndef EAE6320_APPLICATION_USERINPUT_LINUX_H
+#define EAE6320_APPLICATION_USERINPUT_LINUX_H
+
+// Data
+//=====
+
+// A headless application has no window or mouse,
+// but these match the Windows ones so that platform-independent code can still check them
+struct sMousePoints
+{
+    short x = 0;
+    short y = 0;
+};
+extern bool g_isWindowInFocus;
+extern bool g_isMouseTracked;
+extern sMousePoints g_mousePoints;
+
+#endif    // EAE6320_APPLICATION_USERINPUT_LINUX_H
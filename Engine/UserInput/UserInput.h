@@ -8,7 +8,9 @@
 // Include Files
 //==============
 
+#if defined( EAE6320_PLATFORM_WINDOWS )
 #include <Engine/Windows/Includes.h>
+#endif
 
 #include <cstdint>
 
@@ -104,6 +106,8 @@ namespace eae6320
         }
 #if defined( EAE6320_PLATFORM_WINDOWS )
 #include "Windows/UserInput.win.h"
+#elif defined( EAE6320_PLATFORM_LINUX )
+#include "Linux/UserInput.linux.h"
 #endif
     }
 }
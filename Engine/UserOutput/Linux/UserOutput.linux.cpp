@@ -0,0 +1,51 @@
+// Include Files
+//==============
+
+#include "../UserOutput.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <Engine/Asserts/Asserts.h>
+
+// Interface
+//==========
+
+void eae6320::UserOutput::Print( const char* const i_message, ... )
+{
+    // There is no window to show a message box in,
+    // and so the message is written to the standard output
+    // (which is what a person or a script running a headless application is watching)
+    int formattingResult;
+    {
+        va_list insertions;
+        va_start( insertions, i_message );
+        formattingResult = vfprintf( stdout, i_message, insertions );
+        va_end( insertions );
+    }
+    if ( formattingResult >= 0 )
+    {
+        fputc( '\n', stdout );
+    }
+    else
+    {
+        EAE6320_ASSERTF( false, "An encoding error occurred in UserOutput for the message \"%s\"", i_message );
+        fprintf( stdout, "ENCODING ERROR! Unformatted message was:\n\t%s\n", i_message );
+    }
+    // The output is flushed immediately so that it isn't lost if the application is killed
+    fflush( stdout );
+}
+
+// Initialization / Clean Up
+//--------------------------
+
+eae6320::cResult eae6320::UserOutput::Initialize( const sInitializationParameters& )
+{
+    return Results::success;
+}
+
+eae6320::cResult eae6320::UserOutput::CleanUp()
+{
+    fflush( stdout );
+
+    return Results::success;
+}
@@ -19,6 +19,16 @@ namespace
     auto s_resolutionHeight_validity = eae6320::Results::Failure;
     uint16_t s_resolutionWidth = 0;
     auto s_resolutionWidth_validity = eae6320::Results::Failure;
+    bool s_shouldRunBenchmarks = false;
+    auto s_shouldRunBenchmarks_validity = eae6320::Results::Failure;
+    uint32_t s_frameCountToRender = 0;
+    auto s_frameCountToRender_validity = eae6320::Results::Failure;
+    uint16_t s_targetFrameRate = 0;
+    auto s_targetFrameRate_validity = eae6320::Results::Failure;
+    uint16_t s_backgroundFrameRate = 0;
+    auto s_backgroundFrameRate_validity = eae6320::Results::Failure;
+    bool s_shouldAlignFramesWithVerticalBlanks = false;
+    auto s_shouldAlignFramesWithVerticalBlanks_validity = eae6320::Results::Failure;
 
     constexpr auto* const s_userSettingsFileName = "settings.ini";
 }
@@ -70,6 +80,91 @@ eae6320::cResult eae6320::UserSettings::GetDesiredInitialResolutionHeight(uint16
     }
 }
 
+eae6320::cResult eae6320::UserSettings::GetShouldRunBenchmarks(bool& o_shouldRunBenchmarks)
+{
+    const auto result = InitializeIfNecessary();
+    if (result)
+    {
+        if (s_shouldRunBenchmarks_validity)
+        {
+            o_shouldRunBenchmarks = s_shouldRunBenchmarks;
+        }
+        return s_shouldRunBenchmarks_validity;
+    }
+    else
+    {
+        return result;
+    }
+}
+
+eae6320::cResult eae6320::UserSettings::GetFrameCountToRender(uint32_t& o_frameCount)
+{
+    const auto result = InitializeIfNecessary();
+    if (result)
+    {
+        if (s_frameCountToRender_validity)
+        {
+            o_frameCount = s_frameCountToRender;
+        }
+        return s_frameCountToRender_validity;
+    }
+    else
+    {
+        return result;
+    }
+}
+
+eae6320::cResult eae6320::UserSettings::GetTargetFrameRate(uint16_t& o_frameRate)
+{
+    const auto result = InitializeIfNecessary();
+    if (result)
+    {
+        if (s_targetFrameRate_validity)
+        {
+            o_frameRate = s_targetFrameRate;
+        }
+        return s_targetFrameRate_validity;
+    }
+    else
+    {
+        return result;
+    }
+}
+
+eae6320::cResult eae6320::UserSettings::GetBackgroundFrameRate(uint16_t& o_frameRate)
+{
+    const auto result = InitializeIfNecessary();
+    if (result)
+    {
+        if (s_backgroundFrameRate_validity)
+        {
+            o_frameRate = s_backgroundFrameRate;
+        }
+        return s_backgroundFrameRate_validity;
+    }
+    else
+    {
+        return result;
+    }
+}
+
+eae6320::cResult eae6320::UserSettings::GetShouldAlignFramesWithVerticalBlanks(bool& o_shouldAlignFramesWithVerticalBlanks)
+{
+    const auto result = InitializeIfNecessary();
+    if (result)
+    {
+        if (s_shouldAlignFramesWithVerticalBlanks_validity)
+        {
+            o_shouldAlignFramesWithVerticalBlanks = s_shouldAlignFramesWithVerticalBlanks;
+        }
+        return s_shouldAlignFramesWithVerticalBlanks_validity;
+    }
+    else
+    {
+        return result;
+    }
+}
+
 // Helper Function Definitions
 //============================
 
@@ -309,6 +404,181 @@ namespace
             }
             lua_pop(&io_luaState, 1);
         }
+        // Benchmarks
+        {
+            const auto key_runBenchmarks = "runBenchmarks";
+
+            lua_pushstring(&io_luaState, key_runBenchmarks);
+            lua_gettable(&io_luaState, -2);
+            if (lua_isboolean(&io_luaState, -1))
+            {
+                s_shouldRunBenchmarks = lua_toboolean(&io_luaState, -1) != 0;
+                s_shouldRunBenchmarks_validity = eae6320::Results::success;
+                if (s_shouldRunBenchmarks)
+                {
+                    eae6320::Logging::OutputMessage("User settings requested that the benchmarks be run");
+                }
+            }
+            else if (lua_isnil(&io_luaState, -1))
+            {
+                // The benchmarks are optional and aren't run by default
+                s_shouldRunBenchmarks = false;
+                s_shouldRunBenchmarks_validity = eae6320::Results::success;
+            }
+            else
+            {
+                s_shouldRunBenchmarks_validity = eae6320::Results::invalidFile;
+                eae6320::Logging::OutputMessage("The user settings file %s specifies a %s for %s instead of a boolean",
+                    s_userSettingsFileName, luaL_typename(&io_luaState, -1), key_runBenchmarks);
+            }
+            lua_pop(&io_luaState, 1);
+        }
+        // Frame Count To Render
+        {
+            const auto key_frameCount = "frameCountToRender";
+
+            lua_pushstring(&io_luaState, key_frameCount);
+            lua_gettable(&io_luaState, -2);
+            if (lua_isinteger(&io_luaState, -1))
+            {
+                const auto luaInteger = lua_tointeger(&io_luaState, -1);
+                constexpr lua_Integer maxFrameCount = UINT32_MAX;
+                if ((luaInteger >= 0) && (luaInteger <= maxFrameCount))
+                {
+                    s_frameCountToRender = static_cast<uint32_t>(luaInteger);
+                    s_frameCountToRender_validity = eae6320::Results::success;
+                    if (s_frameCountToRender > 0)
+                    {
+                        eae6320::Logging::OutputMessage("User settings defined a frame count to render of %u", s_frameCountToRender);
+                    }
+                }
+                else
+                {
+                    s_frameCountToRender_validity = eae6320::Results::invalidFile;
+                    eae6320::Logging::OutputMessage("The user settings file %s specifies a frame count to render (%lli)"
+                        " that is negative or bigger than the maximum (%u)",
+                        s_userSettingsFileName, static_cast<long long>(luaInteger), UINT32_MAX);
+                }
+            }
+            else if (lua_isnil(&io_luaState, -1))
+            {
+                // By default frames are rendered until the application exits
+                s_frameCountToRender = 0;
+                s_frameCountToRender_validity = eae6320::Results::success;
+            }
+            else
+            {
+                s_frameCountToRender_validity = eae6320::Results::invalidFile;
+                eae6320::Logging::OutputMessage("The user settings file %s specifies a %s for %s instead of an integer",
+                    s_userSettingsFileName, luaL_typename(&io_luaState, -1), key_frameCount);
+            }
+            lua_pop(&io_luaState, 1);
+        }
+        // Target Frame Rate
+        {
+            const auto key_frameRate = "targetFrameRate";
+
+            lua_pushstring(&io_luaState, key_frameRate);
+            lua_gettable(&io_luaState, -2);
+            if (lua_isinteger(&io_luaState, -1))
+            {
+                const auto luaInteger = lua_tointeger(&io_luaState, -1);
+                constexpr lua_Integer maxFrameRate = UINT16_MAX;
+                if ((luaInteger >= 0) && (luaInteger <= maxFrameRate))
+                {
+                    s_targetFrameRate = static_cast<uint16_t>(luaInteger);
+                    s_targetFrameRate_validity = eae6320::Results::success;
+                    eae6320::Logging::OutputMessage("User settings defined a target frame rate of %u", s_targetFrameRate);
+                }
+                else
+                {
+                    s_targetFrameRate_validity = eae6320::Results::invalidFile;
+                    eae6320::Logging::OutputMessage("The user settings file %s specifies a target frame rate (%lli)"
+                        " that is negative or bigger than the maximum (%u)",
+                        s_userSettingsFileName, static_cast<long long>(luaInteger), UINT16_MAX);
+                }
+            }
+            else if (lua_isnil(&io_luaState, -1))
+            {
+                // By default frames aren't limited
+                s_targetFrameRate = 0;
+                s_targetFrameRate_validity = eae6320::Results::success;
+            }
+            else
+            {
+                s_targetFrameRate_validity = eae6320::Results::invalidFile;
+                eae6320::Logging::OutputMessage("The user settings file %s specifies a %s for %s instead of an integer",
+                    s_userSettingsFileName, luaL_typename(&io_luaState, -1), key_frameRate);
+            }
+            lua_pop(&io_luaState, 1);
+        }
+        // Background Frame Rate
+        {
+            const auto key_frameRate = "backgroundFrameRate";
+
+            lua_pushstring(&io_luaState, key_frameRate);
+            lua_gettable(&io_luaState, -2);
+            if (lua_isinteger(&io_luaState, -1))
+            {
+                const auto luaInteger = lua_tointeger(&io_luaState, -1);
+                constexpr lua_Integer maxFrameRate = UINT16_MAX;
+                if ((luaInteger >= 0) && (luaInteger <= maxFrameRate))
+                {
+                    s_backgroundFrameRate = static_cast<uint16_t>(luaInteger);
+                    s_backgroundFrameRate_validity = eae6320::Results::success;
+                    eae6320::Logging::OutputMessage("User settings defined a background frame rate of %u", s_backgroundFrameRate);
+                }
+                else
+                {
+                    s_backgroundFrameRate_validity = eae6320::Results::invalidFile;
+                    eae6320::Logging::OutputMessage("The user settings file %s specifies a background frame rate (%lli)"
+                        " that is negative or bigger than the maximum (%u)",
+                        s_userSettingsFileName, static_cast<long long>(luaInteger), UINT16_MAX);
+                }
+            }
+            else if (lua_isnil(&io_luaState, -1))
+            {
+                // By default being in the background doesn't change the frame rate
+                s_backgroundFrameRate = 0;
+                s_backgroundFrameRate_validity = eae6320::Results::success;
+            }
+            else
+            {
+                s_backgroundFrameRate_validity = eae6320::Results::invalidFile;
+                eae6320::Logging::OutputMessage("The user settings file %s specifies a %s for %s instead of an integer",
+                    s_userSettingsFileName, luaL_typename(&io_luaState, -1), key_frameRate);
+            }
+            lua_pop(&io_luaState, 1);
+        }
+        // Vertical Blank Alignment
+        {
+            const auto key_alignFrames = "alignFramesWithVerticalBlanks";
+
+            lua_pushstring(&io_luaState, key_alignFrames);
+            lua_gettable(&io_luaState, -2);
+            if (lua_isboolean(&io_luaState, -1))
+            {
+                s_shouldAlignFramesWithVerticalBlanks = lua_toboolean(&io_luaState, -1) != 0;
+                s_shouldAlignFramesWithVerticalBlanks_validity = eae6320::Results::success;
+                if (s_shouldAlignFramesWithVerticalBlanks)
+                {
+                    eae6320::Logging::OutputMessage("User settings requested that frames be aligned with vertical blanks");
+                }
+            }
+            else if (lua_isnil(&io_luaState, -1))
+            {
+                // By default buffer swaps don't wait for vertical blanks
+                s_shouldAlignFramesWithVerticalBlanks = false;
+                s_shouldAlignFramesWithVerticalBlanks_validity = eae6320::Results::success;
+            }
+            else
+            {
+                s_shouldAlignFramesWithVerticalBlanks_validity = eae6320::Results::invalidFile;
+                eae6320::Logging::OutputMessage("The user settings file %s specifies a %s for %s instead of a boolean",
+                    s_userSettingsFileName, luaL_typename(&io_luaState, -1), key_alignFrames);
+            }
+            lua_pop(&io_luaState, 1);
+        }
 
         return result;
     }
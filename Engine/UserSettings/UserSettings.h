@@ -21,6 +21,20 @@ namespace eae6320
     {
         cResult GetDesiredInitialResolutionWidth(uint16_t& o_width);
         cResult GetDesiredInitialResolutionHeight(uint16_t& o_height);
+        // The math benchmarks (see Benchmark.h) are run when the application starts if this is true
+        cResult GetShouldRunBenchmarks(bool& o_shouldRunBenchmarks);
+        // A headless application exits after rendering this many frames
+        // (zero means that it keeps rendering until it is told to exit)
+        cResult GetFrameCountToRender(uint32_t& o_frameCount);
+        // The application loop sleeps instead of running more frames per second than this
+        // (zero means that frames aren't limited)
+        cResult GetTargetFrameRate(uint16_t& o_frameRate);
+        // The frame rate while the application's window is minimized or doesn't have focus
+        // (zero means that it isn't changed)
+        cResult GetBackgroundFrameRate(uint16_t& o_frameRate);
+        // If this is true buffer swaps wait for vertical blanks
+        // and the application loop times its frames so that they are ready just before the vertical blank that they are displayed at
+        cResult GetShouldAlignFramesWithVerticalBlanks(bool& o_shouldAlignFramesWithVerticalBlanks);
     }
 }
 
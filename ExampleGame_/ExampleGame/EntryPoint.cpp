@@ -1,21 +1,36 @@
 /*
     WinMain() is the entry point of a Windows program
     (instead of the familiar main() in a console program)
+
+    A Linux build is headless and uses the familiar main()
 */
 
 // Include Files
 //==============
 
 #include "cExampleGame.h"
+#if defined( EAE6320_PLATFORM_WINDOWS )
 #define _CRTDBG_MAP_ALLOC
 #include <crtdbg.h>
+#endif
 
 // Entry Point
 //============
 
+#if defined( EAE6320_PLATFORM_WINDOWS )
+
 int WINAPI WinMain(_In_ const HINSTANCE i_thisInstanceOfTheApplication, _In_opt_ HINSTANCE, _In_ char* i_commandLineArguments, _In_ const int i_initialWindowDisplayState )
 {
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
     //_crtBreakAlloc = 305;
     return eae6320::Application::Run<eae6320::cExampleGame>( i_thisInstanceOfTheApplication, i_commandLineArguments, i_initialWindowDisplayState );
 }
+
+#elif defined( EAE6320_PLATFORM_LINUX )
+
+int main( int i_argumentCount, char** i_arguments )
+{
+    return eae6320::Application::Run<eae6320::cExampleGame>( i_argumentCount, i_arguments );
+}
+
+#endif
@@ -9,11 +9,16 @@
 #include <Engine/Camera/cbCamera.h>
 #include <Engine/Gameobject/cGameobject2D.h>
 #include <Engine/Gameobject/cGameobject3D.h>
+#include <Engine/Gameobject/cStaticBatch.h>
 #include <Engine/Graphics/Graphics.h>
+#include <Engine/Graphics/sEntitiesToRender.h>
 #include <Engine/Logging/Logging.h>
+#include <Engine/Physics/cSnapshotHistory.h>
+#include <Engine/Physics/cWorld.h>
 #include <Engine/Platform/Platform.h>
 #include <Engine/UserInput/UserInput.h>
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -21,13 +26,63 @@ namespace
 {
     std::vector<eae6320::Gameobject::cGameobject2D*> s_2D_GameObject;
     std::vector<eae6320::Gameobject::cGameobject3D*> s_3D_GameObject;
+    std::vector<eae6320::Gameobject::cStaticBatch*> s_staticBatches;
+    // The rigid bodies of every 3D gameobject that moves
+    eae6320::Physics::cWorld s_physicsWorld;
+    // A snapshot of the physics world is saved before every physics tick
+    // so that the simulation can be rewound
+    // (this is about two seconds of ticks)
+    constexpr size_t s_snapshotHistoryCapacity = 128;
+    eae6320::Physics::cSnapshotHistory s_snapshotHistory(s_snapshotHistoryCapacity);
+    uint64_t s_simulationUpdateIndex = 0;
+    auto s_isRewinding = false;
+    // Physics ticks in its own fixed increment of time,
+    // independently of the application's simulation updates
+    constexpr auto s_secondCountPerPhysicsTick = 1.0f / 60.0f;
+    eae6320::Application::tTickGroupId s_tickGroupId_physics = 0;
+    // This is set once physics has ticked
+    auto s_secondCountPerSimulationUpdate = 0.0f;
+    // The number of updates that are simulated twice to check that the physics is deterministic
+    constexpr unsigned int s_determinismCheckUpdateCount = 60;
+    // While this is set the checksum of the physics world is logged at the start of every physics tick
+    // so that the logs of different runs can be compared to find the first tick where they diverged
+    auto s_shouldLogPhysicsChecksums = false;
+    // Whether the rendered gameobjects are interpolated between the last two simulation updates
+    // or extrapolated from the last one
+    auto s_shouldInterpolate = true;
     auto s_isPaused = false;
     auto currentElapsedTime = 0.0f;
     size_t s_2D_GameObject_Size = 0;
     size_t s_3D_GameObject_Size = 0;
+    size_t s_staticBatches_Size = 0;
+    // The length of the spatial chunks that static geometry is batched into
+    constexpr auto s_staticBatchChunkSize = 32.0f;
     std::string s_executableDirectory = "";
     auto s_wasExecutableDirectorySearched = false;
     auto s_takeNextFrameScreenShot = false;
+    // The cull stage prepares what will be rendered for every frame in flight
+    // (a frame is submitted from its own copy while the next frame is updated and culled)
+    struct sFrameToRender
+    {
+        eae6320::Graphics::sEntitiesToRender entitiesToRender;
+        uint64_t tickCount_systemTime = 0;
+        bool takeScreenShot = false;
+    };
+    sFrameToRender s_framesToRender[eae6320::Application::cFramePipeline::maxFrameCountInFlight];
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    // Physics and the cameras don't touch any of the same data,
+    // and so their tick groups are independent and can tick in parallel
+    void TickPhysics(void* const io_userData, const float i_elapsedSecondCount_sinceLastTick);
+    void TickCameras(void* const io_userData, const float i_elapsedSecondCount_sinceLastTick);
+    // The cull stage runs after the update stage,
+    // and the next frame isn't updated until it has finished
+    void CullFrame(void* const io_exampleGame, const uint64_t i_frameIndex);
 }
 
 // Inherited Implementation
@@ -75,6 +130,69 @@ void eae6320::cExampleGame::UpdateBasedOnInput()
     {
         s_takeNextFrameScreenShot = true;
     }
+
+    // Is the user pressing the I key?
+    if (UserInput::IsKeyPressedOnce(UserInput::KeyCodes::I))
+    {
+        s_shouldInterpolate = !s_shouldInterpolate;
+    }
+
+    // Is the user pressing the F5 key?
+    if (UserInput::IsKeyPressedOnce(UserInput::KeyCodes::F5) && (s_secondCountPerSimulationUpdate > 0.0f))
+    {
+        // Simulate the same updates twice from the current state and compare the results after every update
+        // (the world is then put back the way it was)
+        Physics::cSnapshot snapshot_current, snapshot_result;
+        s_physicsWorld.SaveSnapshot(snapshot_current);
+        uint32_t checksums[2][s_determinismCheckUpdateCount];
+        for (auto& checksums_pass : checksums)
+        {
+            if (!s_physicsWorld.LoadSnapshot(snapshot_current))
+            {
+                return;
+            }
+            for (auto& checksum : checksums_pass)
+            {
+                s_physicsWorld.Update(s_secondCountPerSimulationUpdate);
+                s_physicsWorld.SaveSnapshot(snapshot_result);
+                checksum = snapshot_result.CalculateChecksum();
+            }
+        }
+        if (s_physicsWorld.LoadSnapshot(snapshot_current))
+        {
+            s_physicsWorld.UpdateTransforms();
+        }
+        // Every update's checksum is logged so that the check can also be compared with other runs
+        Logging::OutputMessage("The physics determinism check started with checksum 0x%08x", snapshot_current.CalculateChecksum());
+        unsigned int updateIndex_firstDifferent = s_determinismCheckUpdateCount;
+        for (unsigned int i = 0; i < s_determinismCheckUpdateCount; ++i)
+        {
+            Logging::OutputMessage("Determinism check update %u ended with checksums 0x%08x and 0x%08x", i + 1, checksums[0][i], checksums[1][i]);
+            if ((checksums[0][i] != checksums[1][i]) && (updateIndex_firstDifferent == s_determinismCheckUpdateCount))
+            {
+                updateIndex_firstDifferent = i;
+            }
+        }
+        if (updateIndex_firstDifferent == s_determinismCheckUpdateCount)
+        {
+            Logging::OutputMessage("The physics simulation is deterministic (%u updates ended with checksum 0x%08x)",
+                s_determinismCheckUpdateCount, checksums[0][s_determinismCheckUpdateCount - 1]);
+        }
+        else
+        {
+            Logging::OutputError("The physics simulation isn't deterministic (update %u of %u ended with checksums 0x%08x and 0x%08x)",
+                updateIndex_firstDifferent + 1, s_determinismCheckUpdateCount,
+                checksums[0][updateIndex_firstDifferent], checksums[1][updateIndex_firstDifferent]);
+        }
+    }
+
+    // Is the user pressing the F6 key?
+    if (UserInput::IsKeyPressedOnce(UserInput::KeyCodes::F6))
+    {
+        s_shouldLogPhysicsChecksums = !s_shouldLogPhysicsChecksums;
+        Logging::OutputMessage(s_shouldLogPhysicsChecksums ? "Started logging the physics checksum of every tick"
+            : "Stopped logging the physics checksum of every tick");
+    }
 }
 
 void eae6320::cExampleGame::UpdateBasedOnTime(const float i_elapsedSecondCount_sinceLastUpdate)
@@ -82,12 +200,9 @@ void eae6320::cExampleGame::UpdateBasedOnTime(const float i_elapsedSecondCount_s
     currentElapsedTime += i_elapsedSecondCount_sinceLastUpdate;
     if (currentElapsedTime > 1.0f)
     {
+        // (there are no 2D gameobjects if the headless application was run without its assets)
+        for (auto* const gameObject2D : s_2D_GameObject)
         {
-            auto const& gameObject2D = s_2D_GameObject[0];
-            gameObject2D->m_useAlternateTexture = !gameObject2D->m_useAlternateTexture;
-        }
-        {
-            auto const& gameObject2D = s_2D_GameObject[1];
             gameObject2D->m_useAlternateTexture = !gameObject2D->m_useAlternateTexture;
         }
         currentElapsedTime = 0.0f;
@@ -96,58 +211,30 @@ void eae6320::cExampleGame::UpdateBasedOnTime(const float i_elapsedSecondCount_s
 
 void eae6320::cExampleGame::UpdateSimulationBasedOnInput()
 {
-    // Change current camera
+    // Is the user holding the BACKSPACE key?
+    // (the physics world is rewound one update at a time instead of being simulated)
     {
-        Camera::ChangeCurrentCamera();
+        s_isRewinding = UserInput::IsKeyPressed(UserInput::KeyCodes::BACK_SPACE);
     }
 
-    //Update current camera
-    {
-        Camera::GetCurrentCamera()->UpdateOrientation();
-        Camera::GetCurrentCamera()->UpdatePosition();
-    }
-
-    // Update 3D Gameobjects
-    {
-        for (size_t i = 0; i < s_3D_GameObject_Size; i++)
-        {
-            s_3D_GameObject[i]->UpdateBasedOnSimulationInput();
-        }
-    }
-}
-void eae6320::cExampleGame::UpdateSimulationBasedOnTime(const float i_elapsedSecondCount_sinceLastUpdate)
-{
-
-    //Update current camera
+    // Change current camera
+    // (the current camera is updated every frame by its own tick group)
     {
-        Camera::GetCurrentCamera()->UpdateOrientation(i_elapsedSecondCount_sinceLastUpdate);
-        Camera::GetCurrentCamera()->UpdatePosition(i_elapsedSecondCount_sinceLastUpdate);
+        Camera::ChangeCurrentCamera();
     }
 
     // Update 3D Gameobjects
+    // (every controller component is updated in one pass)
     {
-        for (size_t i = 0; i < s_3D_GameObject_Size; i++)
-        {
-            s_3D_GameObject[i]->UpdateBasedOnSimulationTime(i_elapsedSecondCount_sinceLastUpdate);
-        }
+        Gameobject::cGameobject3D::s_registry.UpdateControllers();
     }
 }
 
-void eae6320::cExampleGame::SubmitDataToBeRendered(const float i_elapsedSecondCount_systemTime, const float i_elapsedSecondCount_sinceLastSimulationUpdate)
+void eae6320::cExampleGame::SubmitDataToBeRendered(const float, const float)
 {
-    // Predict Camera
-    {
-        Camera::GetCurrentCamera()->PredictOrientation(i_elapsedSecondCount_sinceLastSimulationUpdate);
-        Camera::GetCurrentCamera()->PredictPosition(i_elapsedSecondCount_sinceLastSimulationUpdate);
-    }
-
-    // Predict 3D Gameobjects
-    {
-        for (size_t i = 0; i < s_3D_GameObject_Size; i++)
-        {
-            s_3D_GameObject[i]->PredictSimulationBasedOnElapsedTime(i_elapsedSecondCount_sinceLastSimulationUpdate);
-        }
-    }
+    // Everything that this submits was copied by the cull stage
+    // (the next frame could already be updating the gameobjects and the cameras)
+    const auto& frameToRender = s_framesToRender[GetIndexOfFrameBeingSubmitted() % Application::cFramePipeline::maxFrameCountInFlight];
 
     // Submit Clear Color
     {
@@ -166,16 +253,17 @@ void eae6320::cExampleGame::SubmitDataToBeRendered(const float i_elapsedSecondCo
         Graphics::SubmitClearDepth();
     }
 
-    // Submit Current Camera
+    // Submit 3D Gameobjects
+    // (the camera that they were culled with is submitted with them)
     {
-        Graphics::SubmitCamera(Camera::GetCurrentCamera());
+        Graphics::SubmitEntities(frameToRender.entitiesToRender);
     }
 
-    // Submit 3D Gameobjects
+    // Submit Static Batches
     {
-        for (size_t i = 0; i < s_3D_GameObject_Size; i++)
+        for (size_t i = 0; i < s_staticBatches_Size; i++)
         {
-            Graphics::SubmitGameobject3D(s_3D_GameObject[i]);
+            Graphics::SubmitStaticBatch(s_staticBatches[i]);
         }
     }
 
@@ -189,15 +277,13 @@ void eae6320::cExampleGame::SubmitDataToBeRendered(const float i_elapsedSecondCo
 
     // Generate and submit screenshot name if requested
     {
-        if (s_takeNextFrameScreenShot)
+        if (frameToRender.takeScreenShot)
         {
-            s_takeNextFrameScreenShot = false;
-
             constexpr char* const screenShotPrefix = "Screenshot_";
             constexpr char* const screenShotExt = ".png";
 
             std::stringstream screenShotFileName;
-            screenShotFileName << screenShotPrefix << GetCurrentSystemTime() << screenShotExt;
+            screenShotFileName << screenShotPrefix << frameToRender.tickCount_systemTime << screenShotExt;
 
             const std::string exeDir = GetExecutableDirectory();
 
@@ -236,38 +322,65 @@ eae6320::cResult eae6320::cExampleGame::Initialize()
     {
         AddNewCamera(reinterpret_cast<Camera::cbCamera*>(Camera::cFirstPersonCamera::Initialize(Math::sVector(0.0f, 0.0f, 10.0f))));
     }
-    // Creating all 3D gameobjects
+    // Add the tick groups
     {
         {
-            Gameobject::cGameobject3D* gameobject3D;
-            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d1_path", gameobject3D, Math::sVector(0.0f, 0.0f, 0.0f), "data/Meshes/ball.bmf", "data/Materials/ball.bmaf", Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER))))
+            Application::cTickScheduler::sTickGroupDescription description;
+            description.name = "Physics";
+            description.tickFunction = TickPhysics;
+            description.secondCount_perTick = s_secondCountPerPhysicsTick;
+            if (!((result = GetTickScheduler().AddTickGroup(description, s_tickGroupId_physics))))
             {
                 EAE6320_ASSERT(false);
                 goto OnExit;
             }
-            s_3D_GameObject.push_back(gameobject3D);
         }
         {
-            Gameobject::cGameobject3D* gameobject3D;
-            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d2_path", gameobject3D, Math::sVector(0.0f, -2.0f, 0.0f), "data/Meshes/floor.bmf", "data/Materials/floor.bmaf", Gameplay::NO_CONTROLLER))))
+            Application::cTickScheduler::sTickGroupDescription description;
+            description.name = "Cameras";
+            description.tickFunction = TickCameras;
+            Application::tTickGroupId tickGroupId_cameras;
+            if (!((result = GetTickScheduler().AddTickGroup(description, tickGroupId_cameras))))
             {
                 EAE6320_ASSERT(false);
                 goto OnExit;
             }
-            s_3D_GameObject.push_back(gameobject3D);
         }
+    }
+    // Add the cull stage
+    {
+        Application::cFramePipeline::sStageDescription description;
+        description.name = "Cull";
+        description.stageFunction = CullFrame;
+        description.userData = this;
+        description.stagesToFinishFirst = Application::cFramePipeline::GetStageBit(GetUpdateFrameStageId());
+        Application::tFrameStageId frameStageId_cull;
+        if (!((result = GetFramePipeline().AddStage(description, frameStageId_cull))))
         {
-            Gameobject::cGameobject3D* gameobject3D;
-            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d4_path", gameobject3D, Math::sVector(0.0f, -2.0f, 4.0f), "data/Meshes/capsule.bmf", "data/Materials/capsule2.bmaf", Gameplay::NO_CONTROLLER))))
-            {
-                EAE6320_ASSERT(false);
-                goto OnExit;
-            }
-            s_3D_GameObject.push_back(gameobject3D);
+            EAE6320_ASSERT(false);
+            goto OnExit;
         }
+        if (!((result = GetFramePipeline().AddDependencyOnPreviousFrame(GetUpdateFrameStageId(), frameStageId_cull))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
+#if defined(EAE6320_PLATFORM_NULL)
+    // Nothing is rendered by the headless application,
+    // and so it can run without the assets that are built by the Windows tool chain
+    // (the frame loop and the physics still run, but the scene is empty)
+    if (!Platform::DoesFileExist("data/Meshes/ball.bmf"))
+    {
+        Logging::OutputMessage("The built assets weren't found in the working directory, and so the scene will be empty");
+        goto OnExit;
+    }
+#endif
+    // Creating all 3D gameobjects
+    {
         {
             Gameobject::cGameobject3D* gameobject3D;
-            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d3_path", gameobject3D, Math::sVector(2.0f, -2.0f, 0.0f), "data/Meshes/capsule.bmf", "data/Materials/capsule.bmaf", Gameplay::NO_CONTROLLER))))
+            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d1_path", gameobject3D, Math::sVector(0.0f, 0.0f, 0.0f), "data/Meshes/ball.bmf", "data/Materials/ball.bmaf", Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER, Physics::ShapeTypes::SPHERE, s_physicsWorld))))
             {
                 EAE6320_ASSERT(false);
                 goto OnExit;
@@ -277,7 +390,7 @@ eae6320::cResult eae6320::cExampleGame::Initialize()
 
         /*{
             Gameobject::cGameobject3D* gameobject3D;
-            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d3_path", gameobject3D, Math::sVector(0.0f, 0.0f, -10.0f), "data/Meshes/dino.bmf", "data/Materials/dino.bmaf", Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER))))
+            if (!((result = Gameobject::cGameobject3D::Load("fake_go3d3_path", gameobject3D, Math::sVector(0.0f, 0.0f, -10.0f), "data/Meshes/dino.bmf", "data/Materials/dino.bmaf", Gameplay::DEFAULT_GAMEOBJECT_CONTROLLER, Physics::ShapeTypes::BOX, s_physicsWorld))))
             {
                 EAE6320_ASSERT(false);
                 goto OnExit;
@@ -285,6 +398,36 @@ eae6320::cResult eae6320::cExampleGame::Initialize()
             s_3D_GameObject.push_back(gameobject3D);
         }*/
     }
+    // Creating all static geometry
+    // (gameobjects that never move are merged into batches instead of being drawn individually)
+    {
+        Gameobject::cStaticBatch::sInstance staticInstances[3];
+        {
+            auto& staticInstance = staticInstances[0];
+            staticInstance.meshPath = "data/Meshes/floor.bmf";
+            staticInstance.materialPath = "data/Materials/floor.bmaf";
+            staticInstance.position = Math::sVector(0.0f, -2.0f, 0.0f);
+        }
+        {
+            auto& staticInstance = staticInstances[1];
+            staticInstance.meshPath = "data/Meshes/capsule.bmf";
+            staticInstance.materialPath = "data/Materials/capsule2.bmaf";
+            staticInstance.shapeType = Physics::ShapeTypes::CAPSULE;
+            staticInstance.position = Math::sVector(0.0f, -2.0f, 4.0f);
+        }
+        {
+            auto& staticInstance = staticInstances[2];
+            staticInstance.meshPath = "data/Meshes/capsule.bmf";
+            staticInstance.materialPath = "data/Materials/capsule.bmaf";
+            staticInstance.shapeType = Physics::ShapeTypes::CAPSULE;
+            staticInstance.position = Math::sVector(2.0f, -2.0f, 0.0f);
+        }
+        if (!((result = Gameobject::cStaticBatch::Build(staticInstances, sizeof(staticInstances) / sizeof(staticInstances[0]), s_staticBatchChunkSize, s_staticBatches, &s_physicsWorld))))
+        {
+            EAE6320_ASSERT(false);
+            goto OnExit;
+        }
+    }
     // Creating all 2D gameobjects
     {
         {
@@ -310,6 +453,7 @@ eae6320::cResult eae6320::cExampleGame::Initialize()
 OnExit:
     s_2D_GameObject_Size = s_2D_GameObject.size();
     s_3D_GameObject_Size = s_3D_GameObject.size();
+    s_staticBatches_Size = s_staticBatches.size();
     return result;
 }
 
@@ -329,6 +473,15 @@ eae6320::cResult eae6320::cExampleGame::CleanUp()
         s_2D_GameObject.clear();
     }
 
+    // Clean up what was prepared to be rendered
+    {
+        for (auto& frameToRender : s_framesToRender)
+        {
+            frameToRender.entitiesToRender.CleanUp();
+            frameToRender.takeScreenShot = false;
+        }
+    }
+
     // Clean up 3d gameobject
     {
         for (size_t i = 0; i < s_3D_GameObject_Size; i++)
@@ -336,14 +489,31 @@ eae6320::cResult eae6320::cExampleGame::CleanUp()
             s_3D_GameObject[i]->DecrementReferenceCount();
         }
         s_3D_GameObject.clear();
+        s_physicsWorld.Clear();
+        s_snapshotHistory.Clear();
+    }
+
+    // Clean up static batches
+    {
+        for (size_t i = 0; i < s_staticBatches_Size; i++)
+        {
+            s_staticBatches[i]->DecrementReferenceCount();
+        }
+        s_staticBatches.clear();
     }
 
     // Reset all globals
     {
         s_isPaused = false;
+        s_simulationUpdateIndex = 0;
+        s_isRewinding = false;
+        s_secondCountPerSimulationUpdate = 0.0f;
+        s_tickGroupId_physics = 0;
+        s_shouldInterpolate = true;
         currentElapsedTime = 0.0f;
         s_2D_GameObject_Size = 0;
         s_3D_GameObject_Size = 0;
+        s_staticBatches_Size = 0;
         s_executableDirectory = "";
         s_wasExecutableDirectorySearched = false;
         s_takeNextFrameScreenShot = false;
@@ -351,3 +521,100 @@ eae6320::cResult eae6320::cExampleGame::CleanUp()
 
     return Results::success;
 }
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    void TickPhysics(void* const, const float i_elapsedSecondCount_sinceLastTick)
+    {
+        // Rewind to the previous tick's snapshot
+        // (until the oldest one that is still saved is reached)
+        if (s_isRewinding)
+        {
+            if ((s_simulationUpdateIndex > 0) && s_snapshotHistory.Find(s_simulationUpdateIndex - 1)
+                && s_snapshotHistory.RollBack(s_simulationUpdateIndex - 1, s_physicsWorld))
+            {
+                --s_simulationUpdateIndex;
+                s_physicsWorld.UpdateTransforms();
+            }
+            return;
+        }
+
+        // Update 3D Gameobjects
+        // (the collisions between them and with static geometry are resolved,
+        // and then all of their bodies are integrated at once and copied into their transforms)
+        {
+            s_secondCountPerSimulationUpdate = i_elapsedSecondCount_sinceLastTick;
+            s_snapshotHistory.Save(s_simulationUpdateIndex, s_physicsWorld);
+            if (s_shouldLogPhysicsChecksums)
+            {
+                if (const auto* const snapshot = s_snapshotHistory.Find(s_simulationUpdateIndex))
+                {
+                    eae6320::Logging::OutputMessage("Physics tick %llu started with checksum 0x%08x",
+                        static_cast<unsigned long long>(s_simulationUpdateIndex), snapshot->CalculateChecksum());
+                }
+            }
+            s_physicsWorld.Update(i_elapsedSecondCount_sinceLastTick);
+            ++s_simulationUpdateIndex;
+        }
+    }
+
+    void TickCameras(void* const, const float i_elapsedSecondCount_sinceLastTick)
+    {
+        // Update current camera
+        // (its input is read every frame too so that it responds as quickly as possible)
+        {
+            auto* const camera = eae6320::Camera::GetCurrentCamera();
+            camera->UpdateOrientation();
+            camera->UpdatePosition();
+            camera->UpdateOrientation(i_elapsedSecondCount_sinceLastTick);
+            camera->UpdatePosition(i_elapsedSecondCount_sinceLastTick);
+        }
+    }
+
+    void CullFrame(void* const io_exampleGame, const uint64_t i_frameIndex)
+    {
+        using namespace eae6320;
+
+        const auto* const exampleGame = static_cast<cExampleGame*>(io_exampleGame);
+        EAE6320_ASSERT(exampleGame);
+        auto& frameToRender = s_framesToRender[i_frameIndex % Application::cFramePipeline::maxFrameCountInFlight];
+
+        // Predict Camera
+        // (the cameras tick every frame and so there is no time to predict)
+        auto* const camera = Camera::GetCurrentCamera();
+        {
+            camera->PredictOrientation(0.0f);
+            camera->PredictPosition(0.0f);
+        }
+
+        // Predict 3D Gameobjects
+        // (from the physics tick group's most recent tick rather than the application's most recent simulation update)
+        const auto secondCount_sinceLastPhysicsTick = exampleGame->GetTickScheduler().GetSecondCountSinceLastTick(s_tickGroupId_physics);
+        if (s_shouldInterpolate)
+        {
+            // Every body in the physics world is blended in a single pass
+            const auto t = (s_secondCountPerSimulationUpdate > 0.0f) ?
+                std::min(secondCount_sinceLastPhysicsTick / s_secondCountPerSimulationUpdate, 1.0f) : 1.0f;
+            s_physicsWorld.InterpolateTransforms(t);
+        }
+        else
+        {
+            Gameobject::cGameobject3D::s_registry.PredictTransforms(secondCount_sinceLastPhysicsTick);
+        }
+        // Anything attached to a moving entity follows where that entity is rendered
+        Gameobject::cGameobject3D::s_registry.UpdateTransformHierarchy();
+        // The bounds of every rendered entity are updated so that the ones outside of the camera's view can be culled
+        Gameobject::cGameobject3D::s_registry.UpdateSpatialIndex();
+
+        // Copy the 3D gameobjects that the camera can see
+        Graphics::CullEntities(Gameobject::cGameobject3D::s_registry, *camera, frameToRender.entitiesToRender);
+
+        // A screenshot is taken of the first frame that is culled after it was requested
+        frameToRender.takeScreenShot = s_takeNextFrameScreenShot;
+        frameToRender.tickCount_systemTime = exampleGame->GetCurrentSystemTime();
+        s_takeNextFrameScreenShot = false;
+    }
+}
@@ -63,9 +63,9 @@ namespace eae6320
         // If you want to try creating your own a convenient website that will help is: http://icoconvert.com/
         const WORD* GetLargeIconId() const override { static constexpr WORD iconId_large = IDI_EAEALIEN; return &iconId_large; }
         const WORD* GetSmallIconId() const override { static constexpr WORD iconId_small = IDI_EAEALIEN; return &iconId_small; }
+#endif
         // Get the working directory of this application
         const char* GetExecutableDirectory() const override;
-#endif
 
         // Run
         //----
@@ -73,8 +73,10 @@ namespace eae6320
         void UpdateBasedOnInput() override;
         void UpdateBasedOnTime(const float i_elapsedSecondCount_sinceLastUpdate) override;
         void UpdateSimulationBasedOnInput() override;
-        void UpdateSimulationBasedOnTime(const float i_elapsedSecondCount_sinceLastUpdate) override;
         void SubmitDataToBeRendered(const float i_elapsedSecondCount_systemTime, const float i_elapsedSecondCount_sinceLastSimulationUpdate) override;
+        // What will be rendered is prepared for every frame by a cull stage,
+        // and so submitting a frame doesn't read anything that the next frame's update changes
+        bool CanUpdateOverlapPreviousSubmission() const override { return true; }
 
         // Initialization / Clean Up
         //--------------------------
@@ -5,7 +5,6 @@
 
 #include <Engine/UserInput/UserInput.h>
 #include <Engine/Transform/sTransform.h>
-#include <Engine/Transform/sPredictionTransform.h>
 
 // Static Data Initialization
 //===========================
@@ -18,17 +17,13 @@ namespace
 // Interface
 //==========
 
-void eae6320::Gameplay::DefaultController::UpdatePosition(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform)
+void eae6320::Gameplay::DefaultController::InitializeRigidBodyState(Physics::sRigidBodyState& io_rigidBodyState) const
 {
-    m_rigidBodyState.UpdatePosition(i_elapsedSecondCount_sinceLastUpdate, io_transform);
+    io_rigidBodyState.angularSpeed = 1.0f;
+    io_rigidBodyState.angularVelocity_axis_local = Math::sVector(0.0f, 1.0f, 0.0f);
 }
 
-void eae6320::Gameplay::DefaultController::UpdateOrientation(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform)
-{
-    m_rigidBodyState.UpdateOrientation(i_elapsedSecondCount_sinceLastUpdate, io_transform);
-}
-
-void eae6320::Gameplay::DefaultController::UpdatePosition(const Transform::sTransform& i_transform)
+void eae6320::Gameplay::DefaultController::UpdatePosition(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState)
 {
     const auto isUpPressed = UserInput::IsKeyPressed(UserInput::KeyCodes::UP);
     const auto isDownPressed = UserInput::IsKeyPressed(UserInput::KeyCodes::DOWN);
@@ -42,12 +37,12 @@ void eae6320::Gameplay::DefaultController::UpdatePosition(const Transform::sTran
         if (isUpPressed)
         {
             isThereInput = true;
-            m_rigidBodyState.velocity += Math::sVector::up;
+            io_rigidBodyState.velocity += Math::sVector::up;
         }
         if (isDownPressed)
         {
             isThereInput = true;
-            m_rigidBodyState.velocity -= Math::sVector::up;
+            io_rigidBodyState.velocity -= Math::sVector::up;
         }
     }
     if (!(isRightPressed && isLeftPressed))
@@ -55,34 +50,25 @@ void eae6320::Gameplay::DefaultController::UpdatePosition(const Transform::sTran
         if (isRightPressed)
         {
             isThereInput = true;
-            m_rigidBodyState.velocity += Math::sVector::right;
+            io_rigidBodyState.velocity += Math::sVector::right;
         }
         if (isLeftPressed)
         {
             isThereInput = true;
-            m_rigidBodyState.velocity -= Math::sVector::right;
+            io_rigidBodyState.velocity -= Math::sVector::right;
         }
     }
     if (isThereInput)
     {
-        m_rigidBodyState.velocity.Normalize();
-        m_rigidBodyState.velocity *= s_velocityMagnitude;    
+        io_rigidBodyState.velocity.Normalize();
+        io_rigidBodyState.velocity *= s_velocityMagnitude;    
     }
     else
     {
-        m_rigidBodyState.velocity = Math::sVector::zero;
+        io_rigidBodyState.velocity = Math::sVector::zero;
     }
 }
-void eae6320::Gameplay::DefaultController::UpdateOrientation(const Transform::sTransform& i_transform)
+void eae6320::Gameplay::DefaultController::UpdateOrientation(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState)
 {
     // No input based orientation update
 }
-
-void eae6320::Gameplay::DefaultController::UpdatePosition(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform)
-{
-    io_predictionTransform.position = m_rigidBodyState.PredictFuturePosition(i_elapsedSecondCount_sinceLastSimulationUpdate, io_predictionTransform);
-}
-void eae6320::Gameplay::DefaultController::UpdateOrientation(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform)
-{
-    io_predictionTransform.orientation = m_rigidBodyState.PredictFutureOrientation(i_elapsedSecondCount_sinceLastSimulationUpdate, io_predictionTransform);
-}
\ No newline at end of file
@@ -21,26 +21,14 @@ namespace eae6320
         public:
             static DefaultController* Initialize() { return new DefaultController(); }
         private:
-            DefaultController()
-            {
-                m_rigidBodyState.angularSpeed = 1.0f;
-                m_rigidBodyState.angularVelocity_axis_local = Math::sVector(0.0f, 1.0f, 0.0f);
-            }
-
-            //Data
-            //====
-
-            Physics::sRigidBodyState m_rigidBodyState;
+            DefaultController() = default;
 
             // Interface
             //==========
 
-            void UpdatePosition(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform) override;
-            void UpdateOrientation(const float i_elapsedSecondCount_sinceLastUpdate, Transform::sTransform& io_transform) override;
-            void UpdatePosition(const Transform::sTransform& i_transform) override;
-            void UpdateOrientation(const Transform::sTransform& i_transform) override;
-            void UpdatePosition(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform) override;
-            void UpdateOrientation(const float i_elapsedSecondCount_sinceLastSimulationUpdate, Transform::sPredictionTransform& io_predictionTransform) override;
+            void InitializeRigidBodyState(Physics::sRigidBodyState& io_rigidBodyState) const override;
+            void UpdatePosition(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState) override;
+            void UpdateOrientation(const Transform::sTransform& i_transform, Physics::sRigidBodyState& io_rigidBodyState) override;
         };
     }
 }
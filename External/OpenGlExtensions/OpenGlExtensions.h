@@ -65,10 +65,12 @@ extern PFNGLUNIFORM4FVPROC glUniform4fv;
 extern PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
 extern PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
 extern PFNGLUSEPROGRAMPROC glUseProgram;
+extern PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
 extern PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
 #if defined( EAE6320_PLATFORM_WINDOWS )
     extern PFNWGLCHOOSEPIXELFORMATARBPROC wglChoosePixelFormatARB;
     extern PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB;
+    extern PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT;
 #endif
 
 // Initialization
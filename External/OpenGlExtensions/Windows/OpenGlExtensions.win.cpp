@@ -61,9 +61,11 @@ PFNGLUNIFORM3FVPROC glUniform3fv = nullptr;
 PFNGLUNIFORM4FVPROC glUniform4fv = nullptr;
 PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding = nullptr;
 PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv = nullptr;
+PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer = nullptr;
 PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer = nullptr;
 PFNWGLCHOOSEPIXELFORMATARBPROC wglChoosePixelFormatARB = nullptr;
 PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB = nullptr;
+PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT = nullptr;
 
 // Initialization
 //---------------
@@ -138,9 +140,11 @@ eae6320::cResult eae6320::OpenGlExtensions::Load(std::string* const o_errorMessa
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC);
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC);
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(glUseProgram, PFNGLUSEPROGRAMPROC);
+    EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC);
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC);
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(wglChoosePixelFormatARB, PFNWGLCHOOSEPIXELFORMATARBPROC);
     EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(wglCreateContextAttribsARB, PFNWGLCREATECONTEXTATTRIBSARBPROC);
+    EAE6320_OPENGLEXTENSIONS_LOADFUNCTION(wglSwapIntervalEXT, PFNWGLSWAPINTERVALEXTPROC);
 
 #undef EAE6320_OPENGLEXTENSIONS_LOADFUNCTION
 
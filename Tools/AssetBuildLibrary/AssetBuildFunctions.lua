@@ -357,6 +357,9 @@ NewAssetTypeInfo( "meshes",
 		RegisterRequiredAssets = function()
 			local path_vertexLayoutShader = "Shaders/Vertex/vertexInputLayout_mesh.tusl"
 			RegisterAssetToBeBuilt( path_vertexLayoutShader, "shaders", { "vertex" } )
+			-- Any mesh could have a skeleton
+			local path_vertexLayoutShader_skinned = "Shaders/Vertex/vertexInputLayout_skinnedMesh.tusl"
+			RegisterAssetToBeBuilt( path_vertexLayoutShader_skinned, "shaders", { "vertex" } )
 		end,
 	}
 )
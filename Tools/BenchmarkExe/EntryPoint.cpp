@@ -0,0 +1,140 @@
+/*
+The main() function runs the engine's benchmarks (see Benchmark.h) without starting a game,
+as well as the benchmark of the Maya mesh exporter's vertex deduplication (see ExporterBenchmark.h)
+
+The names of the benchmarks to run can be given on the command line
+(math, broadphase, spatialIndex, simulation, jobSystem, and exporter);
+if there aren't any then all of them are run.
+The results are written to the log file in the working directory,
+and the program fails if any benchmark found an error bigger than its tolerance.
+
+Nothing here needs a window or a graphics device,
+and so it can also be built on Linux (see README.md)
+*/
+
+// Include Files
+//==============
+
+#include "ExporterBenchmark.h"
+
+#include <Engine/Benchmark/Benchmark.h>
+#include <Engine/Concurrency/Jobs.h>
+#include <Engine/Logging/Logging.h>
+#include <Engine/Results/Results.h>
+#include <Engine/Time/Time.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    struct sBenchmark
+    {
+        const char* name;
+        eae6320::cResult (*run)();
+    };
+    constexpr sBenchmark s_benchmarks[] =
+    {
+        { "math", eae6320::Benchmark::RunMathBenchmarks },
+        { "broadphase", eae6320::Benchmark::RunBroadphaseBenchmarks },
+        { "spatialIndex", eae6320::Benchmark::RunSpatialIndexBenchmarks },
+        { "simulation", eae6320::Benchmark::RunSimulationBenchmarks },
+        { "jobSystem", eae6320::Benchmark::RunJobSystemBenchmarks },
+        { "exporter", eae6320::Benchmark::RunExporterBenchmarks },
+    };
+    constexpr auto s_benchmarkCount = sizeof(s_benchmarks) / sizeof(s_benchmarks[0]);
+}
+
+// Entry Point
+//============
+
+int main(const int i_argumentCount, char** i_arguments)
+{
+    using namespace eae6320;
+
+    // Find the benchmarks to run
+    bool shouldRun[s_benchmarkCount] = {};
+    for (int i = 1; i < i_argumentCount; ++i)
+    {
+        auto wasFound = false;
+        for (size_t j = 0; j < s_benchmarkCount; ++j)
+        {
+            if (std::strcmp(i_arguments[i], s_benchmarks[j].name) == 0)
+            {
+                shouldRun[j] = true;
+                wasFound = true;
+            }
+        }
+        if (!wasFound)
+        {
+            std::fprintf(stderr, "\"%s\" isn't a benchmark (the benchmarks are math, broadphase, spatialIndex, simulation, jobSystem, and exporter)\n",
+                i_arguments[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (i_argumentCount < 2)
+    {
+        for (auto& shouldRunBenchmark : shouldRun)
+        {
+            shouldRunBenchmark = true;
+        }
+    }
+
+    // Initialize the systems that the benchmarks use
+    // (logging first so that it's always available)
+    if (!Logging::Initialize())
+    {
+        std::fprintf(stderr, "Logging couldn't be initialized\n");
+        return EXIT_FAILURE;
+    }
+    auto result = Results::success;
+    if (!((result = Time::Initialize())))
+    {
+        std::fprintf(stderr, "Time couldn't be initialized\n");
+        goto OnExit;
+    }
+    // Nothing else is running, and so the job system gets every logical processor
+    // (this thread and one fewer worker threads)
+    if (!((result = Concurrency::Jobs::Initialize())))
+    {
+        std::fprintf(stderr, "The job system couldn't be initialized\n");
+        goto OnExit;
+    }
+
+    // Run the benchmarks
+    for (size_t i = 0; i < s_benchmarkCount; ++i)
+    {
+        if (shouldRun[i])
+        {
+            std::printf("Running the %s benchmarks...\n", s_benchmarks[i].name);
+            std::fflush(stdout);
+            const auto result_benchmark = s_benchmarks[i].run();
+            std::printf("The %s benchmarks %s\n", s_benchmarks[i].name, result_benchmark ? "passed" : "FAILED");
+            if (!result_benchmark && result)
+            {
+                result = result_benchmark;
+            }
+        }
+    }
+
+OnExit:
+
+    if (Concurrency::Jobs::IsInitialized() && !Concurrency::Jobs::CleanUp())
+    {
+        result = Results::Failure;
+    }
+    if (!Time::CleanUp())
+    {
+        result = Results::Failure;
+    }
+    if (!Logging::CleanUp())
+    {
+        result = Results::Failure;
+    }
+    std::printf("The results were written to the log\n");
+    return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
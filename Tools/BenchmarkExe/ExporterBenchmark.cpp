@@ -0,0 +1,380 @@
+// Include Files
+//==============
+
+#include "ExporterBenchmark.h"
+
+#include <Engine/Logging/Logging.h>
+#include <Engine/Time/Time.h>
+#include <Tools/MayaMeshExporter/VertexDeduplication.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Static Data Initialization
+//===========================
+
+namespace
+{
+    // Each scene has this many triangles split evenly between this many meshes
+    // (a single big mesh only has two shards, and so it can't use more than two threads)
+    struct sSceneDescription
+    {
+        size_t triangleCount;
+        unsigned int meshCount;
+    };
+    constexpr sSceneDescription s_scenes[] =
+    {
+        { 65536, 16 },
+        { 1048576, 1 },
+        { 1048576, 16 },
+    };
+    // Each deduplication is run this many times and the fastest run is reported
+    // (the biggest scenes take seconds with the baseline, and so there is no separate warm-up run)
+    constexpr unsigned int s_runCount = 3;
+}
+
+// Helper Function Declarations
+//=============================
+
+namespace
+{
+    using eae6320::MayaMeshExporter::sShard;
+    using eae6320::MayaMeshExporter::sTriangle;
+    using eae6320::MayaMeshExporter::sVertexKey;
+    using eae6320::MayaMeshExporter::vertexCountPerTriangle;
+
+    // Every mesh is a square grid of quads
+    std::vector<sShard> MakeScene(const sSceneDescription& i_description);
+
+    // This is how the exporter used to find the unique vertices,
+    // and it returns the number of unique vertices
+    size_t DeduplicateWithStringKeys(const std::vector<sShard>& i_shards);
+    std::string MakeStringKey(const sVertexKey& i_key, const size_t i_shadingGroup);
+
+    // Each run gets its own copy of the shards (which isn't timed)
+    template <typename tFunction>
+    double MeasureFastestMilliseconds(const std::vector<sShard>& i_shards, const tFunction& i_function);
+    void OutputTiming(const char* const i_name, const size_t i_triangleCount, const double i_milliseconds);
+
+    // Returns whether every deduplicated triangle still refers to the same corners as the original triangle
+    bool AreTheSameTriangles(const sShard& i_original, const sShard& i_deduplicated);
+    // Returns whether two deduplications gave exactly the same results
+    bool AreIdentical(const std::vector<sShard>& i_lhs, const std::vector<sShard>& i_rhs);
+}
+
+// Interface
+//==========
+
+eae6320::cResult eae6320::Benchmark::RunExporterBenchmarks()
+{
+    Logging::OutputMessage("Running the exporter benchmarks");
+
+    auto areAllCorrect = true;
+    for (const auto& sceneDescription : s_scenes)
+    {
+        const auto shards_original = MakeScene(sceneDescription);
+        size_t triangleCount = 0;
+        for (const auto& shard : shards_original)
+        {
+            triangleCount += shard.triangles.size();
+        }
+        Logging::OutputMessage("The scene has %u triangles in %u %s and %u shards",
+            static_cast<unsigned int>(triangleCount), sceneDescription.meshCount, (sceneDescription.meshCount == 1) ? "mesh" : "meshes",
+            static_cast<unsigned int>(shards_original.size()));
+
+        // Timing
+        size_t vertexCount_baseline = 0;
+        OutputTiming("String keys in a std::map (baseline)", triangleCount,
+            MeasureFastestMilliseconds(shards_original, [&vertexCount_baseline](std::vector<sShard>& io_shards)
+            {
+                vertexCount_baseline = DeduplicateWithStringKeys(io_shards);
+            }));
+        std::vector<sShard> shards_serial, shards_parallel;
+        OutputTiming("DeduplicateShard() on a single thread", triangleCount,
+            MeasureFastestMilliseconds(shards_original, [&shards_serial](std::vector<sShard>& io_shards)
+            {
+                for (auto& shard : io_shards)
+                {
+                    MayaMeshExporter::DeduplicateShard(shard);
+                }
+                std::sort(io_shards.begin(), io_shards.end(), sShard::CompareShards);
+                shards_serial.swap(io_shards);
+            }));
+        unsigned int threadCount = 0;
+        const auto milliseconds_parallel = MeasureFastestMilliseconds(shards_original,
+            [&shards_parallel, &threadCount](std::vector<sShard>& io_shards)
+            {
+                threadCount = MayaMeshExporter::DeduplicateAllShards(io_shards);
+                shards_parallel.swap(io_shards);
+            });
+        const auto name_parallel = "DeduplicateAllShards() on " + std::to_string(threadCount) + ((threadCount == 1) ? " thread" : " threads");
+        OutputTiming(name_parallel.c_str(), triangleCount, milliseconds_parallel);
+
+        // Correctness
+        {
+            size_t vertexCount = 0;
+            for (const auto& shard : shards_parallel)
+            {
+                vertexCount += shard.uniqueVertexKeys.size();
+            }
+            if (vertexCount != vertexCount_baseline)
+            {
+                Logging::OutputError("Deduplication found %u unique vertices but the baseline found %u",
+                    static_cast<unsigned int>(vertexCount), static_cast<unsigned int>(vertexCount_baseline));
+                areAllCorrect = false;
+            }
+        }
+        {
+            // The deduplicated shards are sorted, and so the original ones are sorted the same way to compare them
+            auto shards_original_sorted = shards_original;
+            std::sort(shards_original_sorted.begin(), shards_original_sorted.end(), sShard::CompareShards);
+            auto areAllTheSameTriangles = shards_original_sorted.size() == shards_parallel.size();
+            for (size_t i = 0; areAllTheSameTriangles && (i < shards_parallel.size()); ++i)
+            {
+                areAllTheSameTriangles = AreTheSameTriangles(shards_original_sorted[i], shards_parallel[i]);
+            }
+            if (!areAllTheSameTriangles)
+            {
+                Logging::OutputError("The deduplicated triangles don't refer to the same corners as the original triangles");
+                areAllCorrect = false;
+            }
+        }
+        if (!AreIdentical(shards_serial, shards_parallel))
+        {
+            Logging::OutputError("Deduplicating on multiple threads didn't give the same results as deduplicating on a single thread");
+            areAllCorrect = false;
+        }
+    }
+
+    if (areAllCorrect)
+    {
+        Logging::OutputMessage("The exporter benchmarks finished and every deduplication was correct");
+        return Results::success;
+    }
+    else
+    {
+        Logging::OutputError("The exporter benchmarks finished but some deduplications were wrong");
+        return Results::Failure;
+    }
+}
+
+// Helper Function Definitions
+//============================
+
+namespace
+{
+    std::vector<sShard> MakeScene(const sSceneDescription& i_description)
+    {
+        const auto triangleCountPerMesh = i_description.triangleCount / i_description.meshCount;
+        // Every quad is two triangles
+        const auto quadCountPerSide = std::max<int32_t>(static_cast<int32_t>(std::sqrt(static_cast<double>(triangleCountPerMesh / 2))), 2);
+        const auto positionCountPerSide = quadCountPerSide + 1;
+        const auto seam = quadCountPerSide / 2;
+
+        std::vector<sShard> shards;
+        for (uint32_t meshIndex = 0; meshIndex < i_description.meshCount; ++meshIndex)
+        {
+            // The bottom half of the mesh uses one shading group and the top half uses another
+            sShard shards_mesh[2];
+            for (size_t shadingGroup = 0; shadingGroup < 2; ++shadingGroup)
+            {
+                shards_mesh[shadingGroup].shadingGroup = shadingGroup;
+                shards_mesh[shadingGroup].meshIndex = meshIndex;
+                shards_mesh[shadingGroup].triangles.reserve(static_cast<size_t>(quadCountPerSide * quadCountPerSide));
+            }
+            for (int32_t y = 0; y < quadCountPerSide; ++y)
+            {
+                for (int32_t x = 0; x < quadCountPerSide; ++x)
+                {
+                    // The corners of the quad in counter-clockwise order
+                    sVertexKey corners[4];
+                    const int32_t cornerOffsets[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        const auto cornerX = x + cornerOffsets[i][0];
+                        const auto cornerY = y + cornerOffsets[i][1];
+                        const auto positionIndex = (cornerY * positionCountPerSide) + cornerX;
+                        // The quads to the right of the seam use their own texture coordinates for the positions on the seam
+                        const auto texcoordIndex = ((cornerX == seam) && (x >= seam)) ?
+                            ((positionCountPerSide * positionCountPerSide) + cornerY) : positionIndex;
+                        corners[i] = eae6320::MayaMeshExporter::CreateUniqueVertexKey(positionIndex, positionIndex, texcoordIndex,
+                            texcoordIndex, -1, meshIndex);
+                    }
+                    auto& shard = shards_mesh[(y < (quadCountPerSide / 2)) ? 0 : 1];
+                    sTriangle triangle;
+                    triangle.vertexKeys[0] = corners[0];
+                    triangle.vertexKeys[1] = corners[1];
+                    triangle.vertexKeys[2] = corners[2];
+                    shard.triangles.push_back(triangle);
+                    triangle.vertexKeys[1] = corners[2];
+                    triangle.vertexKeys[2] = corners[3];
+                    shard.triangles.push_back(triangle);
+                }
+            }
+            for (auto& shard : shards_mesh)
+            {
+                shards.push_back(std::move(shard));
+            }
+        }
+        return shards;
+    }
+
+    size_t DeduplicateWithStringKeys(const std::vector<sShard>& i_shards)
+    {
+        struct sTriangle_string
+        {
+            std::string vertexKeys[vertexCountPerTriangle];
+            size_t shadingGroup;
+        };
+
+        std::map<std::string, uint32_t> uniqueVertices;
+        std::vector<sTriangle_string> triangles;
+        for (const auto& shard : i_shards)
+        {
+            for (const auto& triangle : shard.triangles)
+            {
+                sTriangle_string triangle_string;
+                triangle_string.shadingGroup = shard.shadingGroup;
+                for (size_t i = 0; i < vertexCountPerTriangle; ++i)
+                {
+                    triangle_string.vertexKeys[i] = MakeStringKey(triangle.vertexKeys[i], shard.shadingGroup);
+                    uniqueVertices.insert(std::make_pair(triangle_string.vertexKeys[i], 0u));
+                }
+                triangles.push_back(std::move(triangle_string));
+            }
+        }
+        // The triangles were sorted by shading group and then by their keys
+        std::sort(triangles.begin(), triangles.end(), [](const sTriangle_string& i_lhs, const sTriangle_string& i_rhs)
+        {
+            if (i_lhs.shadingGroup != i_rhs.shadingGroup)
+            {
+                return i_lhs.shadingGroup < i_rhs.shadingGroup;
+            }
+            for (size_t i = 0; i < vertexCountPerTriangle; ++i)
+            {
+                if (i_lhs.vertexKeys[i] != i_rhs.vertexKeys[i])
+                {
+                    return i_lhs.vertexKeys[i] < i_rhs.vertexKeys[i];
+                }
+            }
+            return false;
+        });
+        // Every unique vertex was given an index in the order of its key,
+        // and then every corner of every triangle looked up its vertex's index
+        {
+            uint32_t vertexIndex = 0;
+            for (auto& uniqueVertex : uniqueVertices)
+            {
+                uniqueVertex.second = vertexIndex++;
+            }
+            std::vector<uint32_t> indices;
+            indices.reserve(triangles.size() * vertexCountPerTriangle);
+            for (const auto& triangle : triangles)
+            {
+                for (const auto& vertexKey : triangle.vertexKeys)
+                {
+                    indices.push_back(uniqueVertices.find(vertexKey)->second);
+                }
+            }
+        }
+        return uniqueVertices.size();
+    }
+
+    std::string MakeStringKey(const sVertexKey& i_key, const size_t i_shadingGroup)
+    {
+        // The key was made of the indices, the shading group, and the name of the mesh's transform
+        std::ostringstream vertexKey;
+        vertexKey << i_key.positionIndex << "_" << i_key.normalIndex << "_" << i_key.tangentIndex
+            << "_" << i_key.texcoordIndex << "_" << i_key.vertexColorIndex << "_" << i_shadingGroup
+            << "_" << "|mesh" << i_key.meshIndex;
+        return vertexKey.str();
+    }
+
+    template <typename tFunction>
+    double MeasureFastestMilliseconds(const std::vector<sShard>& i_shards, const tFunction& i_function)
+    {
+        auto tickCount_fastest = std::numeric_limits<uint64_t>::max();
+        for (unsigned int i = 0; i < s_runCount; ++i)
+        {
+            auto shards = i_shards;
+            const auto tickCount_start = eae6320::Time::GetCurrentSystemTimeTickCount();
+            i_function(shards);
+            const auto tickCount_end = eae6320::Time::GetCurrentSystemTimeTickCount();
+            tickCount_fastest = std::min(tickCount_fastest, tickCount_end - tickCount_start);
+        }
+        return eae6320::Time::ConvertTicksToSeconds(tickCount_fastest) * 1.0e3;
+    }
+
+    void OutputTiming(const char* const i_name, const size_t i_triangleCount, const double i_milliseconds)
+    {
+        eae6320::Logging::OutputMessage("Benchmark: %-40s %7u triangles: %9.2f ms %9.2f million triangles/s",
+            i_name, static_cast<unsigned int>(i_triangleCount),
+            i_milliseconds, (i_milliseconds > 0.0) ? (static_cast<double>(i_triangleCount) * 1.0e-3 / i_milliseconds) : 0.0);
+    }
+
+    bool AreTheSameTriangles(const sShard& i_original, const sShard& i_deduplicated)
+    {
+        using tCorners = std::array<sVertexKey, vertexCountPerTriangle>;
+        if (i_original.triangles.size() != i_deduplicated.triangles.size())
+        {
+            return false;
+        }
+        std::vector<tCorners> corners_original, corners_deduplicated;
+        for (const auto& triangle : i_original.triangles)
+        {
+            corners_original.push_back(tCorners{ { triangle.vertexKeys[0], triangle.vertexKeys[1], triangle.vertexKeys[2] } });
+        }
+        for (const auto& triangle : i_deduplicated.triangles)
+        {
+            tCorners corners;
+            for (size_t i = 0; i < vertexCountPerTriangle; ++i)
+            {
+                const auto vertexIndex = triangle.vertexIndices[i];
+                if (vertexIndex >= i_deduplicated.uniqueVertexKeys.size())
+                {
+                    return false;
+                }
+                corners[i] = i_deduplicated.uniqueVertexKeys[vertexIndex];
+            }
+            corners_deduplicated.push_back(corners);
+        }
+        // The triangles are in a different order after deduplication
+        std::sort(corners_original.begin(), corners_original.end());
+        std::sort(corners_deduplicated.begin(), corners_deduplicated.end());
+        return corners_original == corners_deduplicated;
+    }
+
+    bool AreIdentical(const std::vector<sShard>& i_lhs, const std::vector<sShard>& i_rhs)
+    {
+        if (i_lhs.size() != i_rhs.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < i_lhs.size(); ++i)
+        {
+            const auto& lhs = i_lhs[i];
+            const auto& rhs = i_rhs[i];
+            if ((lhs.shadingGroup != rhs.shadingGroup) || (lhs.meshIndex != rhs.meshIndex)
+                || (lhs.uniqueVertexKeys != rhs.uniqueVertexKeys) || (lhs.triangles.size() != rhs.triangles.size()))
+            {
+                return false;
+            }
+            for (size_t j = 0; j < lhs.triangles.size(); ++j)
+            {
+                if (!std::equal(std::begin(lhs.triangles[j].vertexIndices), std::end(lhs.triangles[j].vertexIndices),
+                    std::begin(rhs.triangles[j].vertexIndices)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,40 @@
+/*
+    This file benchmarks the vertex deduplication of the Maya mesh exporter
+    (see Tools/MayaMeshExporter/VertexDeduplication.h) without needing Maya
+
+    Scenes of grid meshes are made up with the same kind of indices that Maya gives the exporter:
+    Positions and normals are shared by neighboring triangles,
+    and texture coordinates are split along a seam so that some positions become more than one vertex.
+    Each mesh is split into two shading groups.
+
+    Every scene is deduplicated the way that the exporter used to
+    (with string keys in a std::map, which is reproduced here as the baseline),
+    with DeduplicateShard() one shard at a time on a single thread,
+    and with DeduplicateAllShards() on as many threads as are useful.
+    The results are checked to have the same unique vertices as the baseline
+    and to still refer to the same corners for every triangle,
+    and the multi-threaded results must be identical to the single-threaded ones.
+*/
+
+#ifndef EAE6320_BENCHMARKEXE_EXPORTERBENCHMARK_H
+#define EAE6320_BENCHMARKEXE_EXPORTERBENCHMARK_H
+
+// Include Files
+//==============
+
+#include <Engine/Results/Results.h>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace Benchmark
+    {
+        // The results are written to the log,
+        // and a failure is returned if any deduplication gave the wrong results
+        cResult RunExporterBenchmarks();
+    }
+}
+
+#endif    // EAE6320_BENCHMARKEXE_EXPORTERBENCHMARK_H
@@ -0,0 +1,194 @@
+// Include Files
+//==============
+
+#include "VertexDeduplication.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+// Interface
+//==========
+
+// Vertex Keys
+//------------
+
+bool eae6320::MayaMeshExporter::sVertexKey::operator ==(const sVertexKey& i_rhs) const
+{
+    return (positionIndex == i_rhs.positionIndex) && (normalIndex == i_rhs.normalIndex) && (tangentIndex == i_rhs.tangentIndex)
+        && (texcoordIndex == i_rhs.texcoordIndex) && (vertexColorIndex == i_rhs.vertexColorIndex) && (meshIndex == i_rhs.meshIndex);
+}
+
+bool eae6320::MayaMeshExporter::sVertexKey::operator <(const sVertexKey& i_rhs) const
+{
+    if (meshIndex != i_rhs.meshIndex) return meshIndex < i_rhs.meshIndex;
+    if (positionIndex != i_rhs.positionIndex) return positionIndex < i_rhs.positionIndex;
+    if (normalIndex != i_rhs.normalIndex) return normalIndex < i_rhs.normalIndex;
+    if (tangentIndex != i_rhs.tangentIndex) return tangentIndex < i_rhs.tangentIndex;
+    if (texcoordIndex != i_rhs.texcoordIndex) return texcoordIndex < i_rhs.texcoordIndex;
+    return vertexColorIndex < i_rhs.vertexColorIndex;
+}
+
+size_t eae6320::MayaMeshExporter::sVertexKeyHasher::operator()(const sVertexKey& i_key) const
+{
+    // Each field is mixed in with a multiply-xorshift step
+    // (the indices are usually small and sequential, and so they must be spread across all of the bits)
+    uint64_t hash = 0x9e3779b97f4a7c15ull;
+    const uint32_t fields[] = { static_cast<uint32_t>(i_key.positionIndex), static_cast<uint32_t>(i_key.normalIndex),
+        static_cast<uint32_t>(i_key.tangentIndex), static_cast<uint32_t>(i_key.texcoordIndex),
+        static_cast<uint32_t>(i_key.vertexColorIndex), i_key.meshIndex };
+    for (const auto field : fields)
+    {
+        hash = (hash ^ field) * 0xff51afd7ed558ccdull;
+        hash ^= hash >> 32;
+    }
+    return static_cast<size_t>(hash);
+}
+
+eae6320::MayaMeshExporter::sVertexKey eae6320::MayaMeshExporter::CreateUniqueVertexKey(const int i_positionIndex, const int i_normalIndex, const int i_tangentIndex,
+    const int i_texcoordIndex, const int i_vertexColorIndex, const uint32_t i_meshIndex)
+{
+    sVertexKey vertexKey;
+    vertexKey.positionIndex = i_positionIndex;
+    vertexKey.normalIndex = i_normalIndex;
+    vertexKey.tangentIndex = i_tangentIndex;
+    vertexKey.texcoordIndex = i_texcoordIndex;
+    vertexKey.vertexColorIndex = i_vertexColorIndex;
+    vertexKey.meshIndex = i_meshIndex;
+    return vertexKey;
+}
+
+// Sorting
+//--------
+
+bool eae6320::MayaMeshExporter::sTriangle::CompareTriangles(const sTriangle& i_lhs, const sTriangle& i_rhs)
+{
+    for (size_t i = 0; i < vertexCountPerTriangle; ++i)
+    {
+        if (i_lhs.vertexIndices[i] != i_rhs.vertexIndices[i])
+        {
+            return i_lhs.vertexIndices[i] < i_rhs.vertexIndices[i];
+        }
+    }
+    // If there are two identical triangles it means that i_lhs isn't less than i_rhs
+    return false;
+}
+
+bool eae6320::MayaMeshExporter::sShard::CompareShards(const sShard& i_lhs, const sShard& i_rhs)
+{
+    if (i_lhs.shadingGroup != i_rhs.shadingGroup)
+    {
+        return i_lhs.shadingGroup < i_rhs.shadingGroup;
+    }
+    return i_lhs.meshIndex < i_rhs.meshIndex;
+}
+
+// Deduplication
+//--------------
+
+void eae6320::MayaMeshExporter::DeduplicateShard(sShard& io_shard)
+{
+    auto& triangles = io_shard.triangles;
+    auto& uniqueVertexKeys = io_shard.uniqueVertexKeys;
+
+    // Assign an index to every unique key in the order that they are found
+    std::vector<uint32_t> triangleVertexIndices(triangles.size() * vertexCountPerTriangle);
+    {
+        std::unordered_map<sVertexKey, uint32_t, sVertexKeyHasher> map_vertexKeysToIndices;
+        // A closed mesh typically has about half as many vertices as triangles
+        map_vertexKeysToIndices.reserve(triangles.size());
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            for (size_t j = 0; j < vertexCountPerTriangle; ++j)
+            {
+                const auto& vertexKey = triangles[i].vertexKeys[j];
+                const auto newIndex = static_cast<uint32_t>(uniqueVertexKeys.size());
+                const auto insertion = map_vertexKeysToIndices.insert(std::make_pair(vertexKey, newIndex));
+                if (insertion.second)
+                {
+                    uniqueVertexKeys.push_back(vertexKey);
+                }
+                triangleVertexIndices[(i * vertexCountPerTriangle) + j] = insertion.first->second;
+            }
+        }
+    }
+
+    // Sort the unique vertices by key
+    // (the order doesn't matter, but it's nice to have the exported files be deterministic)
+    {
+        const auto vertexCount = uniqueVertexKeys.size();
+        std::vector<uint32_t> sortedOrder(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            sortedOrder[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(sortedOrder.begin(), sortedOrder.end(), [&uniqueVertexKeys](const uint32_t i_lhs, const uint32_t i_rhs)
+        {
+            return uniqueVertexKeys[i_lhs] < uniqueVertexKeys[i_rhs];
+        });
+        std::vector<uint32_t> map_foundIndicesToSortedIndices(vertexCount);
+        std::vector<sVertexKey> sortedVertexKeys(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            map_foundIndicesToSortedIndices[sortedOrder[i]] = static_cast<uint32_t>(i);
+            sortedVertexKeys[i] = uniqueVertexKeys[sortedOrder[i]];
+        }
+        uniqueVertexKeys.swap(sortedVertexKeys);
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            for (size_t j = 0; j < vertexCountPerTriangle; ++j)
+            {
+                triangles[i].vertexIndices[j] = map_foundIndicesToSortedIndices[triangleVertexIndices[(i * vertexCountPerTriangle) + j]];
+            }
+        }
+    }
+
+    std::sort(triangles.begin(), triangles.end(), sTriangle::CompareTriangles);
+}
+
+unsigned int eae6320::MayaMeshExporter::DeduplicateAllShards(std::vector<sShard>& io_shards)
+{
+    const auto shardCount = io_shards.size();
+    const auto threadCount = static_cast<unsigned int>(
+        std::max<size_t>(std::min<size_t>(std::thread::hardware_concurrency(), shardCount), 1));
+
+    // Each thread keeps taking the next shard until there are none left
+    // (the biggest shards are processed first so that a single large mesh isn't left until the end)
+    std::vector<size_t> shardOrder(shardCount);
+    for (size_t i = 0; i < shardCount; ++i)
+    {
+        shardOrder[i] = i;
+    }
+    std::sort(shardOrder.begin(), shardOrder.end(), [&io_shards](const size_t i_lhs, const size_t i_rhs)
+    {
+        return io_shards[i_lhs].triangles.size() > io_shards[i_rhs].triangles.size();
+    });
+    std::atomic<size_t> nextShard(0);
+    const auto DeduplicateShards = [&io_shards, &shardOrder, &nextShard, shardCount]()
+    {
+        for (auto i = nextShard++; i < shardCount; i = nextShard++)
+        {
+            DeduplicateShard(io_shards[shardOrder[i]]);
+        }
+    };
+    {
+        // The calling thread does its share of the work too
+        std::vector<std::thread> threads;
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(DeduplicateShards);
+        }
+        DeduplicateShards();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Sort the shards by shading group
+    std::sort(io_shards.begin(), io_shards.end(), sShard::CompareShards);
+
+    return threadCount;
+}
@@ -0,0 +1,96 @@
+/*
+    This file contains the part of the Maya mesh exporter that finds the unique vertices of the exported triangles
+
+    Every corner of a triangle is identified by a key made of the indices of its data in its mesh's arrays,
+    and corners with the same key become the same vertex.
+    Vertices from different meshes or different shading groups can never be the same vertex,
+    and so the triangles are split into a shard for every combination of mesh and shading group
+    and every shard is deduplicated independently on its own thread.
+
+    Nothing here uses the Maya API,
+    and so deduplication can also be benchmarked without Maya (see Tools/BenchmarkExe/ExporterBenchmark.h)
+*/
+
+#ifndef EAE6320_MAYAMESHEXPORTER_VERTEXDEDUPLICATION_H
+#define EAE6320_MAYAMESHEXPORTER_VERTEXDEDUPLICATION_H
+
+// Include Files
+//==============
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Interface
+//==========
+
+namespace eae6320
+{
+    namespace MayaMeshExporter
+    {
+        constexpr size_t vertexCountPerTriangle = 3;
+
+        // This unique key is calculated in order to decide whether a new vertex should be created or not.
+        // It is made entirely of integers so that it can be hashed and compared cheaply
+        // (the indices are into the arrays of the mesh that the vertex belongs to, and -1 means "none")
+        struct sVertexKey
+        {
+            int32_t positionIndex;
+            int32_t normalIndex;
+            int32_t tangentIndex;
+            int32_t texcoordIndex;
+            int32_t vertexColorIndex;
+            // Every processed DAG node is assigned its own index
+            // so that identical indices in two different meshes are never treated as the same vertex
+            uint32_t meshIndex;
+
+            bool operator ==(const sVertexKey& i_rhs) const;
+            bool operator <(const sVertexKey& i_rhs) const;
+        };
+
+        struct sVertexKeyHasher
+        {
+            size_t operator()(const sVertexKey& i_key) const;
+        };
+
+        struct sTriangle
+        {
+            // Before deduplication a triangle refers to its vertices by key,
+            // and afterwards by their index in its shard's unique vertices
+            union
+            {
+                sVertexKey vertexKeys[vertexCountPerTriangle];
+                uint32_t vertexIndices[vertexCountPerTriangle];
+            };
+
+            // All of the triangles that are compared are in the same shading group,
+            // and so the order doesn't matter,
+            // but it's nice to have the exported files be deterministic
+            static bool CompareTriangles(const sTriangle& i_lhs, const sTriangle& i_rhs);
+        };
+
+        struct sShard
+        {
+            size_t shadingGroup;
+            uint32_t meshIndex;
+            std::vector<sTriangle> triangles;
+            // These are filled in by deduplication
+            std::vector<sVertexKey> uniqueVertexKeys;
+
+            // Sort the shards by shading group
+            // (so that a single draw call can work with a single contiguous block of vertex and index data)
+            static bool CompareShards(const sShard& i_lhs, const sShard& i_rhs);
+        };
+
+        sVertexKey CreateUniqueVertexKey(const int i_positionIndex, const int i_normalIndex, const int i_tangentIndex,
+            const int i_texcoordIndex, const int i_vertexColorIndex, const uint32_t i_meshIndex);
+        // Fills in the shard's unique vertices (sorted by key)
+        // and changes its triangles to refer to them by index (sorted by those indices)
+        void DeduplicateShard(sShard& io_shard);
+        // Deduplicates every shard on as many threads as are useful and then sorts the shards,
+        // and the number of threads that were used is returned
+        unsigned int DeduplicateAllShards(std::vector<sShard>& io_shards);
+    }
+}
+
+#endif    // EAE6320_MAYAMESHEXPORTER_VERTEXDEDUPLICATION_H
@@ -9,3 +9,4 @@
 
 #pragma comment( lib, "Foundation.lib" )
 #pragma comment( lib, "OpenMaya.lib" )
+#pragma comment( lib, "OpenMayaAnim.lib" )
@@ -2,31 +2,57 @@
 //==============
 
 #include "cMayaMeshExporter.h"
+#include "VertexDeduplication.h"
 
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <cstdint>
 #include <fstream>
 #include <map>
+#include <maya/MColorArray.h>
 #include <maya/MDagPath.h>
+#include <maya/MDagPathArray.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
 #include <maya/MFloatVector.h>
 #include <maya/MFloatVectorArray.h>
 #include <maya/MFnMesh.h>
+#include <maya/MFnSingleIndexedComponent.h>
+#include <maya/MFnSkinCluster.h>
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItDag.h>
+#include <maya/MItDependencyGraph.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MItSelectionList.h>
+#include <maya/MMatrix.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MPoint.h>
 #include <maya/MPointArray.h>
+#include <maya/MQuaternion.h>
 #include <maya/MSelectionList.h>
+#include <maya/MTransformationMatrix.h>
+#include <maya/MVector.h>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+// The vertex keys and their deduplication don't use Maya (see VertexDeduplication.h)
+namespace
+{
+    using eae6320::MayaMeshExporter::CreateUniqueVertexKey;
+    using eae6320::MayaMeshExporter::DeduplicateAllShards;
+    using eae6320::MayaMeshExporter::sShard;
+    using eae6320::MayaMeshExporter::sTriangle;
+    using eae6320::MayaMeshExporter::sVertexKey;
+    using eae6320::MayaMeshExporter::vertexCountPerTriangle;
+}
+
 // Vertex Definition
 //==================
 
@@ -68,29 +94,31 @@ namespace
         }
     };
 
+    // The joints that influence a single vertex of a skinned mesh
+    // (only the four most influential joints are kept and their weights are re-normalized)
+    struct sJointInfluences
+    {
+        int32_t jointIndices[4] = { 0, 0, 0, 0 };
+        float weights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+
     // This stores any information associated with a vertex that is necessary to export the mesh.
     // Most of the information is in the sVertex_maya itself,
     // but there are a few other things needed during processing that shouldn't be exported.
     struct sVertexInfo
     {
         const sVertex_maya vertex;
+        // This is only exported if the mesh is skinned
+        const sJointInfluences jointInfluences;
 
         // A Maya "shading group" is similar to what we call a "material" in our class
         const size_t shadingGroup;
-        // This unique key is calculated in order to decide whether a new vertex should be created or not,
-        // and that calculated key is assigned to the vertex so that it can be sorted uniquely
-        const std::string uniqueKey;
 
-        sVertexInfo(const MPoint& i_position, const MFloatVector& i_normal,
-            const MFloatVector& i_tangent, const MFloatVector& i_bitangent,
-            const float i_texcoordU, const float i_texcoordV,
-            const MColor& i_vertexColor,
-            const size_t i_shadingGroup,
-            const std::string& i_uniqueKey)
+        sVertexInfo(const sVertex_maya& i_vertex, const sJointInfluences& i_jointInfluences, const size_t i_shadingGroup)
             :
-            vertex(i_position, i_normal, i_tangent, i_bitangent, i_texcoordU, i_texcoordV, i_vertexColor),
-            shadingGroup(i_shadingGroup),
-            uniqueKey(i_uniqueKey)
+            vertex(i_vertex),
+            jointInfluences(i_jointInfluences),
+            shadingGroup(i_shadingGroup)
         {
 
         }
@@ -102,36 +130,43 @@ namespace
 
 namespace
 {
-    constexpr size_t s_vertexCountPerTriangle = 3;
+    // The data of a single mesh that is needed to create its vertices.
+    // It is copied out of Maya while the mesh is processed
+    // so that vertices can be created later without calling into the Maya API (which isn't thread-safe);
+    // the Maya array classes are plain containers and are only read from after this point
+    struct sMeshArrays
+    {
+        MPointArray positions;
+        MFloatVectorArray normals;
+        MFloatVectorArray tangents, bitangents;
+        MFloatArray texcoordUs, texcoordVs;
+        MColorArray vertexColors;
+        // If the mesh is skinned there is an entry for every position
+        // (the joint indices are into sSkeleton::joints)
+        std::vector<sJointInfluences> jointInfluences;
+    };
 
-    struct sTriangle
+    // Every joint that influences any of the exported meshes
+    struct sSkeleton
     {
-        std::string vertexKeys[s_vertexCountPerTriangle];
-        size_t shadingGroup;
+        // The joints are found in whatever order the skin clusters list them
+        std::vector<MDagPath> joints;
+        std::map<std::string, int32_t> map_jointPathsToIndices;
 
-        static bool CompareTriangles(const sTriangle& i_lhs, const sTriangle& i_rhs)
+        // The exported joints are re-ordered so that every parent comes before its children
+        struct sExportedJoint
         {
-            // Sort the triangles by shading group
-            // (so that a single draw call can work with a single contiguous block of vertex and index data)
-            if (i_lhs.shadingGroup != i_rhs.shadingGroup)
-            {
-                return i_lhs.shadingGroup < i_rhs.shadingGroup;
-            }
-            else
-            {
-                // If two triangles use the same shading group the order doesn't matter,
-                // but it's nice to have the exported files be deterministic
-                for (size_t i = 0; i < s_vertexCountPerTriangle; ++i)
-                {
-                    if (i_lhs.vertexKeys[i] != i_rhs.vertexKeys[i])
-                    {
-                        return i_lhs.vertexKeys[i] < i_rhs.vertexKeys[i];
-                    }
-                }
-            }
-            // If there are two identical triangles it means that i_lhs isn't less than i_rhs
-            return false;
-        }
+            MString name;
+            // The parent is the closest ancestor in the DAG that is also a joint of the skeleton
+            // (or -1 if there isn't one)
+            int32_t parentIndex = -1;
+            // The bind pose is relative to the parent
+            MQuaternion rotation;
+            MVector translation;
+        };
+        std::vector<sExportedJoint> exportedJoints;
+        // This maps the index of a joint in the joints vector to its index in the exportedJoints vector
+        std::vector<int32_t> exportedJointIndices;
     };
 
     struct sMaterialInfo
@@ -150,6 +185,14 @@ namespace
             size_t first = SIZE_MAX, last = 0;
         } indexRange;
     };
+
+    // The time spent in each step of an export is reported
+    // so that the performance of exporting large scenes can be measured
+    using tClock = std::chrono::steady_clock;
+    double GetElapsedMilliseconds(const tClock::time_point i_startTime)
+    {
+        return std::chrono::duration<double, std::milli>(tClock::now() - i_startTime).count();
+    }
 }
 
 // Helper Function Declarations
@@ -157,21 +200,24 @@ namespace
 
 namespace
 {
-    std::string CreateUniqueVertexKey(const int i_positionIndex, const int i_normalIndex, const int i_tangentIndex,
-        const int i_texcoordIndex, const int i_vertexColorIndex, const size_t i_shadingGroupIndex, const char* i_transformName);
-    MStatus FillVertexAndIndexArrays(const std::map<std::string, sVertexInfo>& i_uniqueVertices, const std::vector<MObject>& i_shadingGroups,
-        std::vector<sTriangle>& io_triangles,
+    sVertex_maya CreateVertex(const sVertexKey& i_key, const sMeshArrays& i_mesh);
+    sJointInfluences CreateJointInfluences(const sVertexKey& i_key, const sMeshArrays& i_mesh, const sSkeleton& i_skeleton);
+    MStatus ExportSkeleton(const std::vector<std::unique_ptr<sMeshArrays>>& i_meshes, sSkeleton& io_skeleton);
+    MStatus FillVertexAndIndexArrays(const std::vector<sShard>& i_shards, const std::vector<std::unique_ptr<sMeshArrays>>& i_meshes,
+        const std::vector<MObject>& i_shadingGroups, const sSkeleton& i_skeleton,
         std::vector<sVertexInfo>& o_vertexArray, std::vector<size_t>& o_indexArray,
         std::vector<sMaterialInfo>& o_materialInfo);
-    MStatus ProcessAllMeshes(std::map<std::string, sVertexInfo>& o_uniqueVertices, std::vector<sTriangle>& o_triangles,
-        std::vector<MObject>& o_shadingGroups);
-    MStatus ProcessSelectedMeshes(std::map<std::string, sVertexInfo>& o_uniqueVertices, std::vector<sTriangle>& o_triangles,
-        std::vector<MObject>& o_shadingGroups);
+    MStatus GatherJointInfluences(const MDagPath& i_dagPath, const MFnMesh& i_mesh, sMeshArrays& io_meshArrays, sSkeleton& io_skeleton);
+    MStatus ProcessAllMeshes(std::vector<std::unique_ptr<sMeshArrays>>& o_meshes, std::vector<sShard>& o_shards,
+        std::vector<MObject>& o_shadingGroups, sSkeleton& io_skeleton);
+    MStatus ProcessSelectedMeshes(std::vector<std::unique_ptr<sMeshArrays>>& o_meshes, std::vector<sShard>& o_shards,
+        std::vector<MObject>& o_shadingGroups, sSkeleton& io_skeleton);
     MStatus ProcessSingleDagNode(const MDagPath& i_dagPath,
-        std::map<std::string, sVertexInfo>& io_uniqueVertices, std::vector<sTriangle>& io_triangles,
-        std::vector<MObject>& io_shadingGroups, std::map<std::string, size_t>& io_map_shadingGroupNamesToIndices);
+        std::vector<std::unique_ptr<sMeshArrays>>& io_meshes, std::vector<sShard>& io_shards,
+        std::vector<MObject>& io_shadingGroups, std::map<std::string, size_t>& io_map_shadingGroupNamesToIndices,
+        sSkeleton& io_skeleton);
     MStatus WriteMeshToFile(const MString& i_fileName, const std::vector<sVertexInfo>& i_vertexArray, const std::vector<size_t>& i_indexArray,
-        const std::vector<sMaterialInfo>& i_materialInfo);
+        const std::vector<sMaterialInfo>& i_materialInfo, const sSkeleton& i_skeleton);
 }
 
 // Inherited Interface
@@ -185,16 +231,21 @@ MStatus eae6320::cMayaMeshExporter::writer(const MFileObject& i_file, const MStr
     std::vector<sVertexInfo> vertexArray;
     std::vector<size_t> indexArray;
     std::vector<sMaterialInfo> materialInfo;
+    sSkeleton skeleton;
+    double elapsedMilliseconds_gather, elapsedMilliseconds_deduplicate, elapsedMilliseconds_write;
+    unsigned int threadCount;
+    size_t meshCount;
     {
-        // Gather the vertex and triangle information
-        std::map<std::string, sVertexInfo> uniqueVertices;
-        std::vector<sTriangle> triangles;
+        // Gather the mesh and triangle information
+        std::vector<std::unique_ptr<sMeshArrays>> meshes;
+        std::vector<sShard> shards;
         std::vector<MObject> shadingGroups;
         {
+            const auto startTime = tClock::now();
             // The user decides whether to export the entire scene or just a selection
             if (i_mode == kExportAccessMode)
             {
-                status = ProcessAllMeshes(uniqueVertices, triangles, shadingGroups);
+                status = ProcessAllMeshes(meshes, shards, shadingGroups, skeleton);
                 if (!status)
                 {
                     return status;
@@ -202,7 +253,7 @@ MStatus eae6320::cMayaMeshExporter::writer(const MFileObject& i_file, const MStr
             }
             else if (i_mode == kExportActiveAccessMode)
             {
-                status = ProcessSelectedMeshes(uniqueVertices, triangles, shadingGroups);
+                status = ProcessSelectedMeshes(meshes, shards, shadingGroups, skeleton);
                 if (!status)
                 {
                     return status;
@@ -213,19 +264,53 @@ MStatus eae6320::cMayaMeshExporter::writer(const MFileObject& i_file, const MStr
                 MGlobal::displayError("Unexpected file access mode");
                 return MStatus::kFailure;
             }
+            status = ExportSkeleton(meshes, skeleton);
+            if (!status)
+            {
+                return status;
+            }
+            elapsedMilliseconds_gather = GetElapsedMilliseconds(startTime);
         }
-        // Convert the mesh information to vertex and index arrays
-        status = FillVertexAndIndexArrays(uniqueVertices, shadingGroups, triangles, vertexArray, indexArray, materialInfo);
-        if (!status)
+        meshCount = meshes.size();
+        // Find the unique vertices and convert the mesh information to vertex and index arrays
         {
-            return status;
+            const auto startTime = tClock::now();
+            threadCount = DeduplicateAllShards(shards);
+            status = FillVertexAndIndexArrays(shards, meshes, shadingGroups, skeleton, vertexArray, indexArray, materialInfo);
+            if (!status)
+            {
+                return status;
+            }
+            elapsedMilliseconds_deduplicate = GetElapsedMilliseconds(startTime);
         }
     }
     // Write the mesh data to the requested file
     {
+        const auto startTime = tClock::now();
         const auto filePath = i_file.fullName();
-        return WriteMeshToFile(filePath, vertexArray, indexArray, materialInfo);
+        status = WriteMeshToFile(filePath, vertexArray, indexArray, materialInfo, skeleton);
+        if (!status)
+        {
+            return status;
+        }
+        elapsedMilliseconds_write = GetElapsedMilliseconds(startTime);
+    }
+    // Report how long the export took
+    {
+        std::ostringstream message;
+        message.precision(1);
+        message << std::fixed << "Exported " << vertexArray.size() << " vertices and " << (indexArray.size() / vertexCountPerTriangle)
+            << " triangles from " << meshCount << " meshes (gathering: " << elapsedMilliseconds_gather
+            << " ms, deduplicating: " << elapsedMilliseconds_deduplicate << " ms on " << threadCount
+            << " threads, writing: " << elapsedMilliseconds_write << " ms)";
+        if (!skeleton.exportedJoints.empty())
+        {
+            message << " with a skeleton of " << skeleton.exportedJoints.size() << " joints";
+        }
+        MGlobal::displayInfo(message.str().c_str());
     }
+
+    return MStatus::kSuccess;
 }
 
 // Helper Function Definitions
@@ -233,21 +318,110 @@ MStatus eae6320::cMayaMeshExporter::writer(const MFileObject& i_file, const MStr
 
 namespace
 {
-    std::string CreateUniqueVertexKey(const int i_positionIndex, const int i_normalIndex, const int i_tangentIndex,
-        const int i_texcoordIndex, const int i_vertexColorIndex, const size_t i_shadingGroupIndex, const char* i_transformName)
+    sVertex_maya CreateVertex(const sVertexKey& i_key, const sMeshArrays& i_mesh)
+    {
+        // The indices in the key were validated when the key was created
+        const auto hasTangents = i_key.tangentIndex >= 0;
+        const auto hasTexcoords = i_key.texcoordIndex >= 0;
+        const auto hasVertexColor = i_key.vertexColorIndex >= 0;
+        return sVertex_maya(i_mesh.positions[i_key.positionIndex], i_mesh.normals[i_key.normalIndex],
+            hasTangents ? i_mesh.tangents[i_key.tangentIndex] : MFloatVector(0.0f, 0.0f, 0.0f),
+            hasTangents ? i_mesh.bitangents[i_key.tangentIndex] : MFloatVector(0.0f, 0.0f, 0.0f),
+            hasTexcoords ? i_mesh.texcoordUs[i_key.texcoordIndex] : 0.0f,
+            hasTexcoords ? i_mesh.texcoordVs[i_key.texcoordIndex] : 0.0f,
+            hasVertexColor ? i_mesh.vertexColors[i_key.vertexColorIndex] : MColor(1.0f, 1.0f, 1.0f, 1.0f));
+    }
+
+    sJointInfluences CreateJointInfluences(const sVertexKey& i_key, const sMeshArrays& i_mesh, const sSkeleton& i_skeleton)
+    {
+        sJointInfluences jointInfluences;
+        if (!i_mesh.jointInfluences.empty())
+        {
+            jointInfluences = i_mesh.jointInfluences[i_key.positionIndex];
+            for (auto& jointIndex : jointInfluences.jointIndices)
+            {
+                jointIndex = i_skeleton.exportedJointIndices[jointIndex];
+            }
+        }
+        return jointInfluences;
+    }
+
+    MStatus ExportSkeleton(const std::vector<std::unique_ptr<sMeshArrays>>& i_meshes, sSkeleton& io_skeleton)
     {
-        std::ostringstream vertexKey;
-        vertexKey << i_positionIndex << "_" << i_normalIndex << "_" << i_tangentIndex
-            << "_" << i_texcoordIndex << "_" << i_vertexColorIndex << "_" << i_shadingGroupIndex;
-        if (i_transformName)
+        const auto jointCount = io_skeleton.joints.size();
+        if (jointCount == 0)
+        {
+            return MStatus::kSuccess;
+        }
+        // The engine stores a single skeleton for the whole mesh,
+        // and so a mix of skinned and rigid meshes can't be exported together
+        for (const auto& mesh : i_meshes)
+        {
+            if (mesh->jointInfluences.empty())
+            {
+                MGlobal::displayError("Some of the exported meshes are skinned and some aren't; either all of them or none of them must be skinned");
+                return MStatus::kFailure;
+            }
+        }
+        if (jointCount > 256)
+        {
+            MGlobal::displayError(MString("The exported meshes are influenced by ") + static_cast<unsigned int>(jointCount) + " joints but only 256 are supported");
+            return MStatus::kFailure;
+        }
+
+        // An ancestor always has a shorter DAG path than its descendants,
+        // and so sorting by path length puts every parent before its children
+        std::vector<int32_t> jointOrder(jointCount);
+        for (size_t i = 0; i < jointCount; ++i)
         {
-            vertexKey << "_" << i_transformName;
+            jointOrder[i] = static_cast<int32_t>(i);
         }
-        return vertexKey.str();
+        std::stable_sort(jointOrder.begin(), jointOrder.end(), [&io_skeleton](const int32_t i_lhs, const int32_t i_rhs)
+        {
+            return io_skeleton.joints[i_lhs].length() < io_skeleton.joints[i_rhs].length();
+        });
+        io_skeleton.exportedJointIndices.resize(jointCount);
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            io_skeleton.exportedJointIndices[jointOrder[i]] = static_cast<int32_t>(i);
+        }
+
+        // The bind pose is whatever pose the joints are currently in
+        // (the scene should be put into its bind pose before exporting),
+        // and it is in world space to match the exported vertex positions
+        io_skeleton.exportedJoints.resize(jointCount);
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            const auto& jointPath = io_skeleton.joints[jointOrder[i]];
+            auto& exportedJoint = io_skeleton.exportedJoints[i];
+            exportedJoint.name = jointPath.partialPathName();
+            MMatrix transform_jointToParent = jointPath.inclusiveMatrix();
+            {
+                auto ancestorPath = jointPath;
+                while (ancestorPath.length() > 1)
+                {
+                    ancestorPath.pop();
+                    const auto mapLookUp = io_skeleton.map_jointPathsToIndices.find(ancestorPath.fullPathName().asChar());
+                    if (mapLookUp != io_skeleton.map_jointPathsToIndices.end())
+                    {
+                        exportedJoint.parentIndex = io_skeleton.exportedJointIndices[mapLookUp->second];
+                        // (Maya uses row vectors, and so the parent's inverse goes on the right)
+                        transform_jointToParent = transform_jointToParent * ancestorPath.inclusiveMatrix().inverse();
+                        break;
+                    }
+                }
+            }
+            // Any scale is ignored (the engine's joints can only be rotated and translated)
+            const MTransformationMatrix transform(transform_jointToParent);
+            exportedJoint.rotation = transform.rotation();
+            exportedJoint.translation = transform.getTranslation(MSpace::kTransform);
+        }
+
+        return MStatus::kSuccess;
     }
 
-    MStatus FillVertexAndIndexArrays(const std::map<std::string, sVertexInfo>& i_uniqueVertices, const std::vector<MObject>& i_shadingGroups,
-        std::vector<sTriangle>& io_triangles,
+    MStatus FillVertexAndIndexArrays(const std::vector<sShard>& i_shards, const std::vector<std::unique_ptr<sMeshArrays>>& i_meshes,
+        const std::vector<MObject>& i_shadingGroups, const sSkeleton& i_skeleton,
         std::vector<sVertexInfo>& o_vertexArray, std::vector<size_t>& o_indexArray,
         std::vector<sMaterialInfo>& o_materialInfo)
     {
@@ -307,71 +481,48 @@ namespace
             }
         }
 
-        // Fill the vertex buffer with the vertices
-        // and create a map from the unique key to the assigned index in the vertex buffer
-        std::map<std::string, size_t> vertexKeyToIndexMap;
+        // The shards are already sorted by shading group,
+        // and so appending them in order keeps every shading group's vertices and indices contiguous
         {
-            // Create a reverse map with a custom sorting order for the vertices
-            struct CompareVertices
+            size_t vertexCount = 0, indexCount = 0;
+            for (const auto& shard : i_shards)
             {
-                bool operator()(const sVertexInfo& i_lhs, const sVertexInfo& i_rhs) const
-                {
-                    // Sort the vertices by shading group
-                    // (so that a single draw call can work with a single contiguous block of vertex data)
-                    if (i_lhs.shadingGroup != i_rhs.shadingGroup)
-                    {
-                        return i_lhs.shadingGroup < i_rhs.shadingGroup;
-                    }
-                    else
-                    {
-                        // If two vertices use the same shading group the order doesn't matter
-                        return i_lhs.uniqueKey < i_rhs.uniqueKey;
-                    }
-                }
-            };
-            std::map<sVertexInfo, std::string, CompareVertices> sortedVertices;
-            for (auto i = as_const(i_uniqueVertices).begin(); i != i_uniqueVertices.end(); ++i)
-            {
-                sortedVertices.insert(make_pair(i->second, i->first));
+                vertexCount += shard.uniqueVertexKeys.size();
+                indexCount += shard.triangles.size() * vertexCountPerTriangle;
             }
-            // Assign the sorted vertices to the buffer
-            size_t vertexIndex = 0;
-            for (auto i = sortedVertices.begin(); i != sortedVertices.end(); ++i, ++vertexIndex)
+            o_vertexArray.reserve(vertexCount);
+            o_indexArray.reserve(indexCount);
+        }
+        for (const auto& shard : i_shards)
+        {
+            const auto& mesh = *i_meshes[shard.meshIndex];
+            const auto firstVertexIndex = o_vertexArray.size();
+
+            // Fill the vertex buffer with the vertices
+            for (const auto& vertexKey : shard.uniqueVertexKeys)
             {
-                const auto& vertex = i->first;
-                o_vertexArray.push_back(vertex);
-                vertexKeyToIndexMap.insert(make_pair(i->second, vertexIndex));
+                const auto vertexIndex = o_vertexArray.size();
+                o_vertexArray.push_back(sVertexInfo(CreateVertex(vertexKey, mesh), CreateJointInfluences(vertexKey, mesh, i_skeleton), shard.shadingGroup));
                 // Update the vertex range for the shading group that this material uses
-                if (vertex.shadingGroup < o_materialInfo.size())
+                if (shard.shadingGroup < o_materialInfo.size())
                 {
-                    auto& materialInfo = o_materialInfo[vertex.shadingGroup];
+                    auto& materialInfo = o_materialInfo[shard.shadingGroup];
                     materialInfo.vertexRange.first = std::min(vertexIndex, materialInfo.vertexRange.first);
                     materialInfo.vertexRange.last = std::max(vertexIndex, materialInfo.vertexRange.last);
                 }
             }
-        }
 
-        // Fill the index buffer with the indices
-        {
-            // Sort the triangles by shading group
-            sort(io_triangles.begin(), io_triangles.end(), sTriangle::CompareTriangles);
-            // Assign the triangle indices to the index buffer
-            const auto triangleCount = io_triangles.size();
-            const auto indexCount = triangleCount * s_vertexCountPerTriangle;
-            o_indexArray.resize(indexCount);
-            for (size_t i = 0; i < triangleCount; ++i)
+            // Fill the index buffer with the indices
+            for (const auto& triangle : shard.triangles)
             {
-                const auto& triangle = io_triangles[i];
-                for (size_t j = 0; j < s_vertexCountPerTriangle; ++j)
+                for (size_t j = 0; j < vertexCountPerTriangle; ++j)
                 {
-                    const auto& vertexKey = triangle.vertexKeys[j];
-                    const auto triangleIndex = vertexKeyToIndexMap.find(vertexKey)->second;
-                    const auto indexBufferIndex = (i * s_vertexCountPerTriangle) + j;
-                    o_indexArray[indexBufferIndex] = triangleIndex;
+                    const auto indexBufferIndex = o_indexArray.size();
+                    o_indexArray.push_back(firstVertexIndex + triangle.vertexIndices[j]);
                     // Update the index range for the shading group that this material uses
-                    if (triangle.shadingGroup < o_materialInfo.size())
+                    if (shard.shadingGroup < o_materialInfo.size())
                     {
-                        auto& materialInfo = o_materialInfo[triangle.shadingGroup];
+                        auto& materialInfo = o_materialInfo[shard.shadingGroup];
                         materialInfo.indexRange.first = std::min(indexBufferIndex, materialInfo.indexRange.first);
                         materialInfo.indexRange.last = std::max(indexBufferIndex, materialInfo.indexRange.last);
                     }
@@ -382,15 +533,116 @@ namespace
         return MStatus::kSuccess;
     }
 
-    MStatus ProcessAllMeshes(std::map<std::string, sVertexInfo>& o_uniqueVertices, std::vector<sTriangle>& o_triangles,
-        std::vector<MObject>& o_shadingGroups)
+    MStatus GatherJointInfluences(const MDagPath& i_dagPath, const MFnMesh& i_mesh, sMeshArrays& io_meshArrays, sSkeleton& io_skeleton)
+    {
+        // A mesh is skinned if there is a skin cluster upstream of it
+        MObject skinClusterObject;
+        {
+            auto meshObject = i_dagPath.node();
+            MStatus status;
+            MItDependencyGraph i(meshObject, MFn::kSkinClusterFilter, MItDependencyGraph::kUpstream, MItDependencyGraph::kDepthFirst,
+                MItDependencyGraph::kNodeLevel, &status);
+            if (!status)
+            {
+                MGlobal::displayError(status.errorString());
+                return status;
+            }
+            if (i.isDone())
+            {
+                return MStatus::kSuccess;
+            }
+            skinClusterObject = i.currentItem();
+        }
+        MFnSkinCluster skinCluster(skinClusterObject);
+
+        // Find (or add) each influence in the skeleton
+        std::vector<int32_t> jointIndices;
+        {
+            MDagPathArray influences;
+            MStatus status;
+            const auto influenceCount = skinCluster.influenceObjects(influences, &status);
+            if (!status)
+            {
+                MGlobal::displayError(status.errorString());
+                return status;
+            }
+            jointIndices.resize(influenceCount);
+            for (unsigned int i = 0; i < influenceCount; ++i)
+            {
+                const std::string influencePath = influences[i].fullPathName().asChar();
+                const auto newIndex = static_cast<int32_t>(io_skeleton.joints.size());
+                const auto insertion = io_skeleton.map_jointPathsToIndices.insert(std::make_pair(influencePath, newIndex));
+                if (insertion.second)
+                {
+                    io_skeleton.joints.push_back(influences[i]);
+                }
+                jointIndices[i] = insertion.first->second;
+            }
+        }
+
+        // Get the weights of every vertex
+        MDoubleArray weights;
+        unsigned int influenceCount = 0;
+        const auto vertexCount = i_mesh.numVertices();
+        {
+            MFnSingleIndexedComponent allVertices;
+            const auto components = allVertices.create(MFn::kMeshVertComponent);
+            allVertices.setCompleteData(vertexCount);
+            const auto status = skinCluster.getWeights(i_dagPath, components, weights, influenceCount);
+            if (!status)
+            {
+                MGlobal::displayError(status.errorString());
+                return status;
+            }
+            if ((influenceCount != jointIndices.size()) || (weights.length() != (static_cast<unsigned int>(vertexCount) * influenceCount)))
+            {
+                MGlobal::displayError(MString("The skin cluster of ") + i_dagPath.partialPathName() + " returned an unexpected number of weights");
+                return MStatus::kFailure;
+            }
+        }
+
+        // Keep the four largest weights of every vertex
+        io_meshArrays.jointInfluences.resize(static_cast<size_t>(vertexCount));
+        std::vector<std::pair<double, int32_t>> vertexWeights(influenceCount);
+        for (int i = 0; i < vertexCount; ++i)
+        {
+            for (unsigned int j = 0; j < influenceCount; ++j)
+            {
+                vertexWeights[j] = std::make_pair(weights[(static_cast<unsigned int>(i) * influenceCount) + j], jointIndices[j]);
+            }
+            const auto keptInfluenceCount = std::min(influenceCount, 4u);
+            std::partial_sort(vertexWeights.begin(), vertexWeights.begin() + keptInfluenceCount, vertexWeights.end(),
+                [](const std::pair<double, int32_t>& i_lhs, const std::pair<double, int32_t>& i_rhs) { return i_lhs.first > i_rhs.first; });
+            double totalWeight = 0.0;
+            for (unsigned int j = 0; j < keptInfluenceCount; ++j)
+            {
+                totalWeight += vertexWeights[j].first;
+            }
+            if (totalWeight <= 0.0)
+            {
+                MGlobal::displayError(MString("Vertex ") + i + " of " + i_dagPath.partialPathName() + " isn't influenced by any joint");
+                return MStatus::kFailure;
+            }
+            auto& jointInfluences = io_meshArrays.jointInfluences[static_cast<size_t>(i)];
+            for (unsigned int j = 0; j < keptInfluenceCount; ++j)
+            {
+                jointInfluences.jointIndices[j] = vertexWeights[j].second;
+                jointInfluences.weights[j] = static_cast<float>(vertexWeights[j].first / totalWeight);
+            }
+        }
+
+        return MStatus::kSuccess;
+    }
+
+    MStatus ProcessAllMeshes(std::vector<std::unique_ptr<sMeshArrays>>& o_meshes, std::vector<sShard>& o_shards,
+        std::vector<MObject>& o_shadingGroups, sSkeleton& io_skeleton)
     {
         std::map<std::string, size_t> map_shadingGroupNamesToIndices;
         for (MItDag i(MItDag::kDepthFirst, MFn::kMesh); !i.isDone(); i.next())
         {
             MDagPath dagPath;
             i.getPath(dagPath);
-            const auto status = ProcessSingleDagNode(dagPath, o_uniqueVertices, o_triangles, o_shadingGroups, map_shadingGroupNamesToIndices);
+            const auto status = ProcessSingleDagNode(dagPath, o_meshes, o_shards, o_shadingGroups, map_shadingGroupNamesToIndices, io_skeleton);
             if (!status)
             {
                 return status;
@@ -400,8 +652,8 @@ namespace
         return MStatus::kSuccess;
     }
 
-    MStatus ProcessSelectedMeshes(std::map<std::string, sVertexInfo>& o_uniqueVertices, std::vector<sTriangle>& o_triangles,
-        std::vector<MObject>& o_shadingGroups)
+    MStatus ProcessSelectedMeshes(std::vector<std::unique_ptr<sMeshArrays>>& o_meshes, std::vector<sShard>& o_shards,
+        std::vector<MObject>& o_shadingGroups, sSkeleton& io_skeleton)
     {
         // Iterate through each selected mesh
         MSelectionList selectionList;
@@ -413,7 +665,7 @@ namespace
             {
                 MDagPath dagPath;
                 i.getDagPath(dagPath);
-                const auto status = ProcessSingleDagNode(dagPath, o_uniqueVertices, o_triangles, o_shadingGroups, map_shadingGroupNamesToIndices);
+                const auto status = ProcessSingleDagNode(dagPath, o_meshes, o_shards, o_shadingGroups, map_shadingGroupNamesToIndices, io_skeleton);
                 if (!status)
                 {
                     return status;
@@ -430,8 +682,9 @@ namespace
     }
 
     MStatus ProcessSingleDagNode(const MDagPath& i_dagPath,
-        std::map<std::string, sVertexInfo>& io_uniqueVertices, std::vector<sTriangle>& io_triangles,
-        std::vector<MObject>& io_shadingGroups, std::map<std::string, size_t>& io_map_shadingGroupNamesToIndices)
+        std::vector<std::unique_ptr<sMeshArrays>>& io_meshes, std::vector<sShard>& io_shards,
+        std::vector<MObject>& io_shadingGroups, std::map<std::string, size_t>& io_map_shadingGroupNamesToIndices,
+        sSkeleton& io_skeleton)
     {
         // Get the mesh from the DAG path
         MFnMesh mesh(i_dagPath);
@@ -440,8 +693,18 @@ namespace
             return MStatus::kSuccess;
         }
 
+        // Each processed DAG node gets its own copy of the mesh data
+        // (this is necessary because uniqueness is otherwise determined by indices within a given mesh.
+        // If the actual data (like the position coordinates) was used instead then this could be ignored
+        // and two identical vertices from two completely different meshes could be saved as a single one.
+        // This should happen rarely in practice, but a production-quality exporter
+        // should probably be more strict about testing equivalence to try and save as much memory as possible.)
+        const auto meshIndex = static_cast<uint32_t>(io_meshes.size());
+        io_meshes.push_back(std::unique_ptr<sMeshArrays>(new sMeshArrays));
+        auto& meshArrays = *io_meshes.back();
+
         // Get a list of the positions
-        MPointArray positions;
+        auto& positions = meshArrays.positions;
         {
             const auto status = mesh.getPoints(positions, MSpace::kWorld);
             if (!status)
@@ -451,8 +714,17 @@ namespace
             }
         }
 
+        // Get the joints that influence each position (if the mesh is skinned)
+        {
+            const auto status = GatherJointInfluences(i_dagPath, mesh, meshArrays, io_skeleton);
+            if (!status)
+            {
+                return status;
+            }
+        }
+
         // Get a list of the normals
-        MFloatVectorArray normals;
+        auto& normals = meshArrays.normals;
         {
             const auto status = mesh.getNormals(normals, MSpace::kWorld);
             if (!status)
@@ -463,7 +735,8 @@ namespace
         }
 
         // Get a list of tangents and bitangents
-        MFloatVectorArray tangents, bitangents;
+        auto& tangents = meshArrays.tangents;
+        auto& bitangents = meshArrays.bitangents;
         {
             constexpr MString* const useDefaultUvSet = nullptr;    // If more than one UV set exists this code will use the "default" one (as chosen by Maya)
             {
@@ -489,7 +762,8 @@ namespace
         }
 
         // Get a list of the texture coordinates
-        MFloatArray texcoordUs, texcoordVs;
+        auto& texcoordUs = meshArrays.texcoordUs;
+        auto& texcoordVs = meshArrays.texcoordVs;
         {
             MStatus status;
             const auto uvSetCount = mesh.numUVSets(&status);
@@ -514,7 +788,7 @@ namespace
         }
 
         // Get a list of the vertex colors
-        MColorArray vertexColors;
+        auto& vertexColors = meshArrays.vertexColors;
         {
             MStatus status;
             const auto colorSetCount = mesh.numColorSets(&status);
@@ -626,27 +900,44 @@ namespace
             }
         }
 
-        // Gather vertex and triangle information
+        // Gather triangle information
+        // (the vertices themselves are only identified by their keys here;
+        // finding the unique ones happens later for every shard at once)
         {
-            // Use the name of the transform to ensure uniqueness
-            // (This is necessary because uniqueness is otherwise determined by indices within a given mesh.
-            // If the actual data (like the position coordinates) was used instead then this could be ignored
-            // and two identical vertices from two completely different meshes could be saved as a single one.
-            // This should happen rarely in practice, but a production-quality exporter
-            // should probably be more strict about testing equivalence to try and save as much memory as possible.)
-            const auto* const transformName = MFnDependencyNode(mesh.parent(instanceId)).name().asChar();
+            // Each shading group that this mesh uses gets its own shard
+            std::unordered_map<size_t, size_t> map_shadingGroupsToShardIndices;
 
             MPointArray trianglePositions;
             MIntArray positionIndices;
+            // This is re-used for every polygon to avoid allocating memory;
+            // polygons only have a handful of vertices and so a linear search is fast
+            std::vector<std::pair<int, sVertexKey>> indexToKeyMap;
             size_t polygonIndex = 0;
             for (MItMeshPolygon i(mesh.object()); !i.isDone(); i.next(), ++polygonIndex)
             {
                 if (i.hasValidTriangulation())
                 {
                     const auto shadingGroup = polygonShadingGroupIndices[polygonIndex];
+                    // (an index is stored rather than a pointer because adding a shard can move the others)
+                    size_t shardIndex;
+                    {
+                        const auto mapLookUp = map_shadingGroupsToShardIndices.find(shadingGroup);
+                        if (mapLookUp != map_shadingGroupsToShardIndices.end())
+                        {
+                            shardIndex = mapLookUp->second;
+                        }
+                        else
+                        {
+                            shardIndex = io_shards.size();
+                            map_shadingGroupsToShardIndices.insert(std::make_pair(shadingGroup, shardIndex));
+                            io_shards.push_back(sShard());
+                            io_shards.back().shadingGroup = shadingGroup;
+                            io_shards.back().meshIndex = meshIndex;
+                        }
+                    }
 
-                    // Store information for each vertex in the polygon
-                    std::map<int, const std::string> indexToKeyMap;
+                    // Store the key for each vertex in the polygon
+                    indexToKeyMap.clear();
                     {
                         MIntArray vertices;
                         const auto status = i.getVertices(vertices);
@@ -657,7 +948,6 @@ namespace
                                 const auto positionIndex = vertices[j];
                                 const auto normalIndex = i.normalIndex(j);
                                 auto texcoordIndex = -1;
-                                struct { float u, v; } texcoord = { 0.0f, 0.0f };
                                 {
                                     int potentialTexcoordIndex;
                                     constexpr MString* const useDefaultUvSet = nullptr;
@@ -667,13 +957,9 @@ namespace
                                         && (static_cast<unsigned int>(potentialTexcoordIndex) < texcoordVs.length()))
                                     {
                                         texcoordIndex = potentialTexcoordIndex;
-                                        texcoord.u = texcoordUs[texcoordIndex];
-                                        texcoord.v = texcoordVs[texcoordIndex];
                                     }
                                 }
                                 auto tangentIndex = -1;
-                                MFloatVector tangent(0.0f, 0.0f, 0.0f);
-                                MFloatVector bitangent(0.0f, 0.0f, 0.0f);
                                 {
                                     MStatus status;
                                     const auto potentialTangentIndex = i.tangentIndex(j, &status);
@@ -682,12 +968,9 @@ namespace
                                         && (static_cast<unsigned int>(potentialTangentIndex) < bitangents.length()))
                                     {
                                         tangentIndex = potentialTangentIndex;
-                                        tangent = tangents[tangentIndex];
-                                        bitangent = bitangents[tangentIndex];
                                     }
                                 }
                                 auto vertexColorIndex = -1;
-                                MColor vertexColor(1.0f, 1.0f, 1.0f, 1.0f);
                                 {
                                     int potentialColorIndex;
                                     constexpr MString* const useDefaultColorSet = nullptr;
@@ -696,19 +979,10 @@ namespace
                                         && (static_cast<unsigned int>(potentialColorIndex) < vertexColors.length()))
                                     {
                                         vertexColorIndex = potentialColorIndex;
-                                        vertexColor = vertexColors[vertexColorIndex];
                                     }
                                 }
-                                const auto vertexKey = CreateUniqueVertexKey(positionIndex, normalIndex, tangentIndex,
-                                    texcoordIndex, vertexColorIndex, shadingGroup, transformName);
-                                indexToKeyMap.insert(make_pair(positionIndex, vertexKey));
-                                io_uniqueVertices.insert(make_pair(vertexKey,
-                                    sVertexInfo(positions[positionIndex], normals[normalIndex],
-                                        tangent, bitangent,
-                                        texcoord.u, texcoord.v,
-                                        vertexColor,
-                                        shadingGroup, vertexKey)
-                                ));
+                                indexToKeyMap.push_back(std::make_pair(positionIndex, CreateUniqueVertexKey(positionIndex, normalIndex, tangentIndex,
+                                    texcoordIndex, vertexColorIndex, meshIndex)));
                             }
                         }
                         else
@@ -724,13 +998,14 @@ namespace
                         for (auto j = 0; j < triangleCount; ++j)
                         {
                             i.getTriangle(j, trianglePositions, positionIndices);
-                            if (static_cast<size_t>(positionIndices.length()) == s_vertexCountPerTriangle)
+                            if (static_cast<size_t>(positionIndices.length()) == vertexCountPerTriangle)
                             {
                                 sTriangle triangle;
-                                for (unsigned int k = 0; k < static_cast<unsigned int>(s_vertexCountPerTriangle); ++k)
+                                for (unsigned int k = 0; k < static_cast<unsigned int>(vertexCountPerTriangle); ++k)
                                 {
                                     const auto positionIndex = positionIndices[k];
-                                    const auto mapLookUp = indexToKeyMap.find(positionIndex);
+                                    const auto mapLookUp = std::find_if(indexToKeyMap.begin(), indexToKeyMap.end(),
+                                        [positionIndex](const std::pair<int, sVertexKey>& i_entry) { return i_entry.first == positionIndex; });
                                     if (mapLookUp != indexToKeyMap.end())
                                     {
                                         triangle.vertexKeys[k] = mapLookUp->second;
@@ -741,8 +1016,7 @@ namespace
                                         return MStatus::kFailure;
                                     }
                                 }
-                                triangle.shadingGroup = shadingGroup;
-                                io_triangles.push_back(triangle);
+                                io_shards[shardIndex].triangles.push_back(triangle);
                             }
                             else
                             {
@@ -765,7 +1039,7 @@ namespace
     }
 
     MStatus WriteMeshToFile(const MString& i_fileName, const std::vector<sVertexInfo>& i_vertexArray, const std::vector<size_t>& i_indexArray,
-        const std::vector<sMaterialInfo>& i_materialInfo)
+        const std::vector<sMaterialInfo>& i_materialInfo, const sSkeleton& i_skeleton)
     {
         // Maya's coordinate system is right=handed and UVs have (0,0) at the lower left corner.
         // For our class my advice is to keep things the Maya way in your engine (which matches the default OpenGL behavior),
@@ -864,8 +1138,34 @@ namespace
                     i_vertexArray[i].vertex.bty << "," <<
                     i_vertexArray[i].vertex.btz <<
                     // closing bitangent table
-                    "},\n"
+                    "},\n";
+
+                if (!i_skeleton.exportedJoints.empty())
+                {
+                    const auto& jointInfluences = i_vertexArray[i].jointInfluences;
+                    fout <<
+                        "\t\t\tjoints = "
+                        // Opening joints table
+                        "{" <<
+                        jointInfluences.jointIndices[0] << "," <<
+                        jointInfluences.jointIndices[1] << "," <<
+                        jointInfluences.jointIndices[2] << "," <<
+                        jointInfluences.jointIndices[3] <<
+                        // closing joints table
+                        "},\n"
+
+                        "\t\t\tweights = "
+                        // Opening weights table
+                        "{" <<
+                        jointInfluences.weights[0] << "," <<
+                        jointInfluences.weights[1] << "," <<
+                        jointInfluences.weights[2] << "," <<
+                        jointInfluences.weights[3] <<
+                        // closing weights table
+                        "},\n";
+                }
 
+                fout <<
                     // closing per-vertex data table                
                     "\t\t},\n";
             }
@@ -897,8 +1197,37 @@ namespace
 
             fout <<
                 // Closing indices Table
-                "\t},\n"
+                "\t},\n";
 
+            if (!i_skeleton.exportedJoints.empty())
+            {
+                fout <<
+                    "\t-- This table contains the joints of the skeleton in their bind pose\n"
+                    "\t-- (each parent comes before its children and a root joint's parent is -1)\n"
+                    "\t-- Total number of joints: " << i_skeleton.exportedJoints.size() << "\n"
+                    "\tskeleton =\n"
+
+                    // Opening skeleton table
+                    "\t{\n";
+
+                for (size_t i = 0; i < i_skeleton.exportedJoints.size(); ++i)
+                {
+                    const auto& joint = i_skeleton.exportedJoints[i];
+                    fout <<
+                        "\t\t{-- " << i << ": " << joint.name.asChar() << "\n"
+                        "\t\t\tparent = " << joint.parentIndex << ",\n"
+                        // The rotation is stored as w, x, y, z
+                        "\t\t\trotation = {" << joint.rotation.w << "," << joint.rotation.x << "," << joint.rotation.y << "," << joint.rotation.z << "},\n"
+                        "\t\t\ttranslation = {" << joint.translation.x << "," << joint.translation.y << "," << joint.translation.z << "},\n"
+                        "\t\t},\n";
+                }
+
+                fout <<
+                    // Closing skeleton table
+                    "\t},\n";
+            }
+
+            fout <<
                 // Closing base table
                 "}\n";
 
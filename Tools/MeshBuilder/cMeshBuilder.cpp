@@ -7,10 +7,19 @@
 #include <Engine/Graphics/MeshHelperStructs.h>
 #include <Engine/Graphics/VertexFormats.h>
 #include <Engine/Math/Half.h>
+#include <Engine/Math/Functions.h>
+#include <Engine/Math/Hash.h>
+#include <Engine/Math/sVector.h>
+#include <Engine/Math/TangentFrame.h>
 #include <External/Lua/Includes.h>
 #include <Tools/AssetBuildLibrary/Functions.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <fstream>
+#include <utility>
+#include <vector>
 
 
 // Helper Function Declarations
@@ -27,12 +36,20 @@ namespace
     eae6320::cResult LoadPositionTable(lua_State& io_luaState, sMeshData& io_meshData, const int i_index);
     eae6320::cResult LoadNormalTable(lua_State& io_luaState, sMeshData& io_meshData, const int i_index);
     eae6320::cResult LoadColorTable(lua_State& io_luaState, sMeshData& io_meshData, const int i_index);
-    eae6320::cResult LoadUVTable(lua_State& io_luaState, sMeshData& io_meshData, const int i_index);
+    // The texture coordinates are loaded as floats
+    // and then all of the vertices' are converted to halves at once
+    eae6320::cResult LoadUVTable(lua_State& io_luaState, float* const o_uv);
+    eae6320::cResult LoadSkinningTables(lua_State& io_luaState, sMeshData& io_meshData, const int i_index);
+    eae6320::cResult LoadSkeletonTable(lua_State& io_luaState, sMeshData& io_meshData);
+    // Loads an array of exactly i_count numbers from the given key of the table at the top of the stack
+    // (o_isMissing is set if the key doesn't exist, which isn't an error)
+    eae6320::cResult LoadNumberArray(lua_State& io_luaState, const char* const i_key, const int i_count, double* const o_values, bool& o_isMissing);
+    eae6320::cResult GenerateTangentFrames(sMeshData& io_meshData);
+    void WriteTangentFrame(const eae6320::Graphics::VertexFormats::sMesh& i_vertex, const eae6320::Math::sVector& i_tangent, const eae6320::Math::sVector& i_normal,
+        const uint8_t i_handedness, eae6320::Graphics::VertexFormats::sMesh& o_vertex);
     uint8_t RoundColorChannel(const float i_value);
-
-    uint32_t originalNumberOfVertices = 0;
-    const uint8_t paddingValue = 0xdd;
-    uint8_t paddingRequired = 0;
+    // The quantized weights always add up to exactly 255
+    void QuantizeJointWeights(const double* const i_weights, uint8_t* const o_weights);
 }
 
 // Inherited Implementation
@@ -147,72 +164,72 @@ eae6320::cResult cMeshBuilder::Build(const std::vector<std::string>&)
 
     lua_pop(luaState, 1);
 
+    if (!((result = GenerateTangentFrames(*newMeshDataExtractedFromFile))))
+    {
+        OutputErrorMessageWithFileInfo(m_path_source, "Failed to generate tangent frames");
+        goto OnExit;
+    }
+
     // Write the mesh data to a file
     {
-        originalNumberOfVertices = newMeshDataExtractedFromFile->numberOfVertices;
-        if (newMeshDataExtractedFromFile->type == Graphics::IndexDataTypes::BIT_32)
+        using namespace Graphics::BinaryMeshFile;
+
+        // Lay out the file
+        sHeader header;
+        header.vertexSize = sizeof(Graphics::VertexFormats::sMesh);
+        header.numberOfVertices = newMeshDataExtractedFromFile->numberOfVertices;
+        header.numberOfIndices = newMeshDataExtractedFromFile->numberOfIndices;
+        header.indexType = newMeshDataExtractedFromFile->type;
+        const uint64_t indexDataSize = static_cast<uint64_t>(header.numberOfIndices) * ((header.indexType == Graphics::IndexDataTypes::BIT_16) ? sizeof(uint16_t) : sizeof(uint32_t));
+        const uint64_t vertexDataSize = static_cast<uint64_t>(header.numberOfVertices) * sizeof(Graphics::VertexFormats::sMesh);
+        const auto offsetToIndexData = Math::RoundUpToMultiplePowerOf2(static_cast<uint64_t>(sizeof(sHeader)), static_cast<uint64_t>(sectionAlignment));
+        const auto offsetToVertexData = Math::RoundUpToMultiplePowerOf2(offsetToIndexData + indexDataSize, static_cast<uint64_t>(sectionAlignment));
+        auto fileSize = offsetToVertexData + vertexDataSize;
+        // The skinning and joint sections only exist if the mesh has a skeleton
+        header.numberOfJoints = newMeshDataExtractedFromFile->numberOfJoints;
+        const uint64_t skinningDataSize = (header.numberOfJoints > 0) ? static_cast<uint64_t>(header.numberOfVertices) * sizeof(Graphics::VertexFormats::sSkinning) : 0;
+        const uint64_t jointDataSize = static_cast<uint64_t>(header.numberOfJoints) * sizeof(Graphics::HelperStructs::sJoint);
+        uint64_t offsetToSkinningData = 0;
+        uint64_t offsetToJointData = 0;
+        if (header.numberOfJoints > 0)
         {
-            newMeshDataExtractedFromFile->numberOfVertices |= (INT32_MAX + 1u);
+            offsetToSkinningData = Math::RoundUpToMultiplePowerOf2(fileSize, static_cast<uint64_t>(sectionAlignment));
+            offsetToJointData = Math::RoundUpToMultiplePowerOf2(offsetToSkinningData + skinningDataSize, static_cast<uint64_t>(sectionAlignment));
+            fileSize = offsetToJointData + jointDataSize;
         }
-        // Write vertex count
+        if (fileSize > UINT32_MAX)
         {
-            const auto byteCountToWrite = sizeof(newMeshDataExtractedFromFile->numberOfVertices);
-            fout.write(reinterpret_cast<const char*>(&newMeshDataExtractedFromFile->numberOfVertices), byteCountToWrite);
-            if (!fout.good())
-            {
-                result = Results::fileWriteFail;
-                OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for vertex count", byteCountToWrite);
-                goto OnExit;
-            }
+            result = Results::Failure;
+            OutputErrorMessageWithFileInfo(m_path_source, "The mesh is too big (%llu bytes) to be stored in a single file",
+                static_cast<unsigned long long>(fileSize));
+            goto OnExit;
         }
-        // Write index count
+        header.offsetToIndexData = static_cast<uint32_t>(offsetToIndexData);
+        header.offsetToVertexData = static_cast<uint32_t>(offsetToVertexData);
+        header.offsetToSkinningData = static_cast<uint32_t>(offsetToSkinningData);
+        header.offsetToJointData = static_cast<uint32_t>(offsetToJointData);
+        header.fileSize = static_cast<uint32_t>(fileSize);
+
+        // The whole file is assembled in memory (with any gaps already filled with padding)
+        // so that the checksum can be calculated before anything is written
+        std::vector<uint8_t> fileData(static_cast<size_t>(fileSize), paddingValue);
+        memcpy(&fileData[header.offsetToIndexData], newMeshDataExtractedFromFile->indexData, static_cast<size_t>(indexDataSize));
+        memcpy(&fileData[header.offsetToVertexData], newMeshDataExtractedFromFile->vertexData, static_cast<size_t>(vertexDataSize));
+        if (header.numberOfJoints > 0)
         {
-            const auto byteCountToWrite = sizeof(newMeshDataExtractedFromFile->numberOfIndices);
-            fout.write(reinterpret_cast<const char*>(&newMeshDataExtractedFromFile->numberOfIndices), byteCountToWrite);
-            if (!fout.good())
-            {
-                result = Results::fileWriteFail;
-                OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for index count", byteCountToWrite);
-                goto OnExit;
-            }
+            memcpy(&fileData[header.offsetToSkinningData], newMeshDataExtractedFromFile->skinningData, static_cast<size_t>(skinningDataSize));
+            memcpy(&fileData[header.offsetToJointData], newMeshDataExtractedFromFile->jointData, static_cast<size_t>(jointDataSize));
         }
-        // Write index data
-        {
-            const auto byteCountToWrite = (newMeshDataExtractedFromFile->type == Graphics::IndexDataTypes::BIT_16) ? newMeshDataExtractedFromFile->numberOfIndices * sizeof(uint16_t) : newMeshDataExtractedFromFile->numberOfIndices * sizeof(uint32_t);
-            fout.write(reinterpret_cast<const char*>(newMeshDataExtractedFromFile->indexData), byteCountToWrite);
-            if (!fout.good())
-            {
-                result = Results::fileWriteFail;
-                OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for index data", byteCountToWrite);
-                goto OnExit;
-            }
+        header.checksum = Math::CalculateXxHash32(&fileData[sizeof(sHeader)], fileData.size() - sizeof(sHeader));
+        memcpy(&fileData[0], &header, sizeof(header));
 
-            // Calculate and add required padding to align vertex data
-            paddingRequired = byteCountToWrite % alignof(Graphics::VertexFormats::sMesh);
-            if (paddingRequired > 0)
-            {
-                for (uint8_t i = 0; i < paddingRequired; i++)
-                {
-                    fout.write(reinterpret_cast<const char*>(&paddingValue), 1u);
-                    if (!fout.good())
-                    {
-                        result = Results::fileWriteFail;
-                        OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for padding", 1u);
-                        goto OnExit;
-                    }
-                }
-            }
-        }
-        // Write vertex data
+        const auto byteCountToWrite = fileData.size();
+        fout.write(reinterpret_cast<const char*>(&fileData[0]), byteCountToWrite);
+        if (!fout.good())
         {
-            const auto byteCountToWrite = originalNumberOfVertices * sizeof(Graphics::VertexFormats::sMesh);
-            fout.write(reinterpret_cast<const char*>(newMeshDataExtractedFromFile->vertexData), byteCountToWrite);
-            if (!fout.good())
-            {
-                result = Results::fileWriteFail;
-                OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for vertex data", byteCountToWrite);
-                goto OnExit;
-            }
+            result = Results::fileWriteFail;
+            OutputErrorMessageWithFileInfo(m_path_target, "Failed to write %zu bytes for the mesh", byteCountToWrite);
+            goto OnExit;
         }
     }
 
@@ -266,12 +283,19 @@ namespace
         {
             return result;
         }
+        if (!((result = LoadSkeletonTable(io_luaState, io_meshData))))
+        {
+            return result;
+        }
         return result;
     }
 
     eae6320::cResult LoadVerticesTable(lua_State& io_luaState, sMeshData& io_meshData)
     {
         auto result = eae6320::Results::success;
+        // Every vertex's u and v are stored next to each other
+        std::vector<float> texcoords;
+        std::vector<uint16_t> texcoords_half;
         constexpr auto* const key = "vertices";
         lua_pushstring(&io_luaState, key);
         lua_gettable(&io_luaState, -2);
@@ -290,6 +314,7 @@ namespace
                 io_meshData.vertexData = reinterpret_cast<eae6320::Graphics::VertexFormats::sMesh*>(malloc(io_meshData.numberOfVertices * sizeof(eae6320::Graphics::VertexFormats::sMesh)));
                 io_meshData.type = (io_meshData.numberOfVertices > UINT16_MAX) ? eae6320::Graphics::IndexDataTypes::BIT_32 :
                     eae6320::Graphics::IndexDataTypes::BIT_16;
+                texcoords.resize(static_cast<size_t>(io_meshData.numberOfVertices) * 2);
 
                 // Remember that Lua arrays are 1-based and not 0-based!
                 for (auto i = 1; i <= vertexCount; ++i)
@@ -321,7 +346,12 @@ namespace
                             lua_pop(&io_luaState, 1);
                             goto OnExit;
                         }
-                        if (!((result = LoadUVTable(io_luaState, io_meshData, arrayIndex))))
+                        if (!((result = LoadUVTable(io_luaState, &texcoords[static_cast<size_t>(arrayIndex) * 2]))))
+                        {
+                            lua_pop(&io_luaState, 1);
+                            goto OnExit;
+                        }
+                        if (!((result = LoadSkinningTables(io_luaState, io_meshData, arrayIndex))))
                         {
                             lua_pop(&io_luaState, 1);
                             goto OnExit;
@@ -336,6 +366,16 @@ namespace
                         goto OnExit;
                     }
                 }
+                // Convert the texture coordinates of every vertex
+                {
+                    texcoords_half.resize(texcoords.size());
+                    eae6320::Math::MakeHalvesFromFloats(texcoords.data(), texcoords.size(), texcoords_half.data());
+                    for (uint32_t i = 0; i < io_meshData.numberOfVertices; ++i)
+                    {
+                        io_meshData.vertexData[i].u = texcoords_half[(static_cast<size_t>(i) * 2) + 0];
+                        io_meshData.vertexData[i].v = texcoords_half[(static_cast<size_t>(i) * 2) + 1];
+                    }
+                }
             }
             else
             {
@@ -650,8 +690,7 @@ namespace
         return result;
     }
 
-    eae6320::cResult LoadUVTable(lua_State& io_luaState, sMeshData& io_meshData, const int i_index)
-
+    eae6320::cResult LoadUVTable(lua_State& io_luaState, float* const o_uv)
     {
         auto result = eae6320::Results::success;
         constexpr auto* const key = "uv";
@@ -693,11 +732,11 @@ namespace
                         goto OnExit;
                     }
                 }
-                io_meshData.vertexData[i_index].u = eae6320::Math::MakeHalfFromFloat(uv[0]);
+                o_uv[0] = uv[0];
 #if defined( EAE6320_PLATFORM_D3D )
-                io_meshData.vertexData[i_index].v = eae6320::Math::MakeHalfFromFloat(1.0f - uv[1]);
+                o_uv[1] = 1.0f - uv[1];
 #elif defined( EAE6320_PLATFORM_GL )
-                io_meshData.vertexData[i_index].v = eae6320::Math::MakeHalfFromFloat(uv[1]);
+                o_uv[1] = uv[1];
 #endif
             }
             else
@@ -720,10 +759,496 @@ namespace
         return result;
     }
 
+    eae6320::cResult LoadSkinningTables(lua_State& io_luaState, sMeshData& io_meshData, const int i_index)
+    {
+        // Joints and weights are optional,
+        // but if any vertex has them then every vertex must
+        auto result = eae6320::Results::success;
+        double joints[4], weights[4];
+        bool areJointsMissing, areWeightsMissing;
+        if (!((result = LoadNumberArray(io_luaState, "joints", 4, joints, areJointsMissing))))
+        {
+            return result;
+        }
+        if (!((result = LoadNumberArray(io_luaState, "weights", 4, weights, areWeightsMissing))))
+        {
+            return result;
+        }
+        if (areJointsMissing != areWeightsMissing)
+        {
+            OutputErrorMessageWithFileInfo(__FILE__, "Vertex %d must have both joints and weights or neither", i_index + 1);
+            return eae6320::Results::invalidFile;
+        }
+        const auto hasSkinning = !areJointsMissing;
+        if (i_index == 0)
+        {
+            if (hasSkinning)
+            {
+                io_meshData.skinningData = reinterpret_cast<eae6320::Graphics::VertexFormats::sSkinning*>(malloc(io_meshData.numberOfVertices * sizeof(eae6320::Graphics::VertexFormats::sSkinning)));
+                if (!io_meshData.skinningData)
+                {
+                    OutputErrorMessageWithFileInfo(__FILE__, "Failed to allocate memory for the skinning data");
+                    return eae6320::Results::outOfMemory;
+                }
+            }
+        }
+        else if (hasSkinning != (io_meshData.skinningData != nullptr))
+        {
+            OutputErrorMessageWithFileInfo(__FILE__, "Vertex %d %s joints and weights but the first vertex %s", i_index + 1,
+                hasSkinning ? "has" : "doesn't have", hasSkinning ? "doesn't" : "does");
+            return eae6320::Results::invalidFile;
+        }
+        if (hasSkinning)
+        {
+            auto& skinning = io_meshData.skinningData[i_index];
+            for (auto i = 0; i < 4; ++i)
+            {
+                if ((joints[i] < 0.0) || (joints[i] >= eae6320::Graphics::BinaryMeshFile::maxJointCount) || (joints[i] != std::floor(joints[i])))
+                {
+                    OutputErrorMessageWithFileInfo(__FILE__, "Joint index %g of vertex %d isn't an integer between 0 and %u", joints[i], i_index + 1,
+                        eae6320::Graphics::BinaryMeshFile::maxJointCount - 1);
+                    return eae6320::Results::invalidFile;
+                }
+                if (weights[i] < 0.0)
+                {
+                    OutputErrorMessageWithFileInfo(__FILE__, "Joint weight %g of vertex %d is negative", weights[i], i_index + 1);
+                    return eae6320::Results::invalidFile;
+                }
+                skinning.jointIndices[i] = static_cast<uint8_t>(joints[i]);
+            }
+            if ((weights[0] + weights[1] + weights[2] + weights[3]) <= 0.0)
+            {
+                OutputErrorMessageWithFileInfo(__FILE__, "Vertex %d isn't influenced by any joint (its weights add up to 0)", i_index + 1);
+                return eae6320::Results::invalidFile;
+            }
+            QuantizeJointWeights(weights, skinning.jointWeights);
+        }
+        return result;
+    }
+
+    eae6320::cResult LoadSkeletonTable(lua_State& io_luaState, sMeshData& io_meshData)
+    {
+        // The skeleton is optional,
+        // but a mesh has one if and only if its vertices have joints and weights
+        auto result = eae6320::Results::success;
+        constexpr auto* const key = "skeleton";
+        lua_pushstring(&io_luaState, key);
+        lua_gettable(&io_luaState, -2);
+        if (lua_isnil(&io_luaState, -1))
+        {
+            if (io_meshData.skinningData)
+            {
+                result = eae6320::Results::invalidFile;
+                OutputErrorMessageWithFileInfo(__FILE__, "The vertices have joints and weights but there is no \"%s\"", key);
+            }
+            goto OnExit;
+        }
+        if (lua_istable(&io_luaState, -1))
+        {
+            const auto jointCount = luaL_len(&io_luaState, -1);
+            if ((jointCount < 1) || (jointCount > eae6320::Graphics::BinaryMeshFile::maxJointCount))
+            {
+                result = eae6320::Results::invalidFile;
+                OutputErrorMessageWithFileInfo(__FILE__, "There are %d joints instead of between 1 and %u", static_cast<int>(jointCount),
+                    eae6320::Graphics::BinaryMeshFile::maxJointCount);
+                goto OnExit;
+            }
+            if (!io_meshData.skinningData)
+            {
+                result = eae6320::Results::invalidFile;
+                OutputErrorMessageWithFileInfo(__FILE__, "There is a \"%s\" but the vertices don't have joints and weights", key);
+                goto OnExit;
+            }
+            io_meshData.numberOfJoints = static_cast<uint32_t>(jointCount);
+            io_meshData.jointData = reinterpret_cast<sJoint*>(malloc(io_meshData.numberOfJoints * sizeof(sJoint)));
+            if (!io_meshData.jointData)
+            {
+                result = eae6320::Results::outOfMemory;
+                OutputErrorMessageWithFileInfo(__FILE__, "Failed to allocate memory for the joint data");
+                goto OnExit;
+            }
+            for (auto i = 1; i <= jointCount; ++i)
+            {
+                lua_pushinteger(&io_luaState, i);
+                lua_gettable(&io_luaState, -2);
+                if (!lua_istable(&io_luaState, -1))
+                {
+                    result = eae6320::Results::invalidFile;
+                    OutputErrorMessageWithFileInfo(__FILE__, "Joint %d must be a table (instead of a %s)", i, luaL_typename(&io_luaState, -1));
+                    lua_pop(&io_luaState, 1);
+                    goto OnExit;
+                }
+                auto& joint = io_meshData.jointData[i - 1];
+                joint = sJoint();
+                double parent, rotation[4], translation[3];
+                bool isParentMissing, isRotationMissing, isTranslationMissing;
+                if (!((result = LoadNumberArray(io_luaState, "parent", 1, &parent, isParentMissing)))
+                    || !((result = LoadNumberArray(io_luaState, "rotation", 4, rotation, isRotationMissing)))
+                    || !((result = LoadNumberArray(io_luaState, "translation", 3, translation, isTranslationMissing))))
+                {
+                    lua_pop(&io_luaState, 1);
+                    goto OnExit;
+                }
+                lua_pop(&io_luaState, 1);
+                // Joints are referred to by 0-based indices (the same as in the built file, unlike the Lua array itself),
+                // and a root joint has a parent of -1 (or no parent at all)
+                if (!isParentMissing)
+                {
+                    const auto jointIndex = i - 1;
+                    if ((parent < -1.0) || (parent >= jointIndex) || (parent != std::floor(parent)))
+                    {
+                        result = eae6320::Results::invalidFile;
+                        OutputErrorMessageWithFileInfo(__FILE__, "The parent of joint %d must be -1 or a joint that comes before it (instead of %g)", jointIndex, parent);
+                        goto OnExit;
+                    }
+                    joint.parentIndex = static_cast<int32_t>(parent);
+                }
+                if (!isRotationMissing)
+                {
+                    const auto length = std::sqrt((rotation[0] * rotation[0]) + (rotation[1] * rotation[1]) + (rotation[2] * rotation[2]) + (rotation[3] * rotation[3]));
+                    if (length <= 0.0)
+                    {
+                        result = eae6320::Results::invalidFile;
+                        OutputErrorMessageWithFileInfo(__FILE__, "The rotation of joint %d isn't a valid quaternion", i);
+                        goto OnExit;
+                    }
+                    for (auto j = 0; j < 4; ++j)
+                    {
+                        joint.rotation[j] = static_cast<float>(rotation[j] / length);
+                    }
+                }
+                if (!isTranslationMissing)
+                {
+                    for (auto j = 0; j < 3; ++j)
+                    {
+                        joint.translation[j] = static_cast<float>(translation[j]);
+                    }
+                }
+            }
+            // Every joint that influences a vertex must exist
+            for (uint32_t i = 0; i < io_meshData.numberOfVertices; ++i)
+            {
+                for (auto j = 0; j < 4; ++j)
+                {
+                    const auto& skinning = io_meshData.skinningData[i];
+                    if ((skinning.jointWeights[j] > 0) && (skinning.jointIndices[j] >= io_meshData.numberOfJoints))
+                    {
+                        result = eae6320::Results::invalidFile;
+                        OutputErrorMessageWithFileInfo(__FILE__, "Vertex %u is influenced by joint %u but there are only %u joints", i + 1,
+                            skinning.jointIndices[j], io_meshData.numberOfJoints);
+                        goto OnExit;
+                    }
+                }
+            }
+            // The index of a joint with no weight doesn't matter
+            // but it must still be valid so that the GPU doesn't read outside of the matrix palette
+            for (uint32_t i = 0; i < io_meshData.numberOfVertices; ++i)
+            {
+                for (auto& jointIndex : io_meshData.skinningData[i].jointIndices)
+                {
+                    if (jointIndex >= io_meshData.numberOfJoints)
+                    {
+                        jointIndex = 0;
+                    }
+                }
+            }
+        }
+        else
+        {
+            result = eae6320::Results::invalidFile;
+            OutputErrorMessageWithFileInfo(__FILE__, "The value at \"%s\" must be a table (instead of a %s)", key, luaL_typename(&io_luaState, -1));
+            goto OnExit;
+        }
+    OnExit:
+        // Pop the skeleton table
+        lua_pop(&io_luaState, 1);
+
+        return result;
+    }
+
+    eae6320::cResult LoadNumberArray(lua_State& io_luaState, const char* const i_key, const int i_count, double* const o_values, bool& o_isMissing)
+    {
+        auto result = eae6320::Results::success;
+        o_isMissing = false;
+        lua_pushstring(&io_luaState, i_key);
+        lua_gettable(&io_luaState, -2);
+        if (lua_isnil(&io_luaState, -1))
+        {
+            o_isMissing = true;
+            goto OnExit;
+        }
+        // A single number doesn't have to be in a table
+        if ((i_count == 1) && lua_isnumber(&io_luaState, -1))
+        {
+            o_values[0] = lua_tonumber(&io_luaState, -1);
+            goto OnExit;
+        }
+        if (lua_istable(&io_luaState, -1))
+        {
+            const auto valueCount = luaL_len(&io_luaState, -1);
+            if (valueCount != i_count)
+            {
+                result = eae6320::Results::invalidFile;
+                OutputErrorMessageWithFileInfo(__FILE__, "There are %d values for \"%s\" instead of %d", static_cast<int>(valueCount), i_key, i_count);
+                goto OnExit;
+            }
+            for (auto i = 1; i <= i_count; ++i)
+            {
+                lua_pushinteger(&io_luaState, i);
+                lua_gettable(&io_luaState, -2);
+                if (!lua_isnumber(&io_luaState, -1))
+                {
+                    result = eae6320::Results::invalidFile;
+                    OutputErrorMessageWithFileInfo(__FILE__, "Value %d of \"%s\" isn't a number!", i, i_key);
+                    lua_pop(&io_luaState, 1);
+                    goto OnExit;
+                }
+                o_values[i - 1] = lua_tonumber(&io_luaState, -1);
+                lua_pop(&io_luaState, 1);
+            }
+        }
+        else
+        {
+            result = eae6320::Results::invalidFile;
+            OutputErrorMessageWithFileInfo(__FILE__, "The value at \"%s\" must be a table (instead of a %s)", i_key, luaL_typename(&io_luaState, -1));
+            goto OnExit;
+        }
+    OnExit:
+        // Pop the value
+        lua_pop(&io_luaState, 1);
+
+        return result;
+    }
+
+    eae6320::cResult GenerateTangentFrames(sMeshData& io_meshData)
+    {
+        // This follows the same rules as MikkTSpace so that normal maps baked by other tools match:
+        //    * Each triangle's tangent and bitangent are projected onto the plane of each corner's vertex normal
+        //        and weighted by the angle of that corner
+        //    * A vertex is never shared by triangles with different handedness
+        //        (it is split instead)
+        // The tangent frames use the texture coordinates in the same convention as the source file on every platform
+        // so that the same normal maps can be used everywhere
+
+        const auto vertexCount = io_meshData.numberOfVertices;
+        const auto indexCount = io_meshData.numberOfIndices;
+        auto* const vertexData = io_meshData.vertexData;
+
+        std::vector<uint32_t> indices(indexCount);
+        for (uint32_t i = 0; i < indexCount; ++i)
+        {
+            indices[i] = (io_meshData.type == eae6320::Graphics::IndexDataTypes::BIT_16) ?
+                static_cast<uint32_t>(reinterpret_cast<const uint16_t*>(io_meshData.indexData)[i]) :
+                reinterpret_cast<const uint32_t*>(io_meshData.indexData)[i];
+            if (indices[i] >= vertexCount)
+            {
+                OutputErrorMessageWithFileInfo(__FILE__, "Index #%u refers to vertex %u but there are only %u vertices", i, indices[i], vertexCount);
+                return eae6320::Results::invalidFile;
+            }
+        }
+
+        std::vector<eae6320::Math::sVector> positions(vertexCount), normals(vertexCount);
+        std::vector<float> us(vertexCount), vs(vertexCount);
+        {
+            std::vector<uint16_t> us_half(vertexCount), vs_half(vertexCount);
+            for (uint32_t i = 0; i < vertexCount; ++i)
+            {
+                const auto& vertex = vertexData[i];
+                positions[i] = eae6320::Math::sVector(vertex.x, vertex.y, vertex.z);
+                normals[i] = eae6320::Math::sVector(vertex.nx, vertex.ny, vertex.nz).GetNormalized();
+                us_half[i] = vertex.u;
+                vs_half[i] = vertex.v;
+            }
+            eae6320::Math::MakeFloatsFromHalves(us_half.data(), vertexCount, us.data());
+            eae6320::Math::MakeFloatsFromHalves(vs_half.data(), vertexCount, vs.data());
+#if defined( EAE6320_PLATFORM_D3D )
+            for (auto& v : vs)
+            {
+                v = 1.0f - v;
+            }
+#endif
+        }
+
+        // The tangents are accumulated separately for each handedness
+        struct sAccumulatedTangent
+        {
+            eae6320::Math::sVector tangent;
+            bool isUsed = false;
+        };
+        std::vector<sAccumulatedTangent> accumulatedTangents[2] = { std::vector<sAccumulatedTangent>(vertexCount), std::vector<sAccumulatedTangent>(vertexCount) };
+        // Corners of triangles whose texture coordinates are degenerate don't have a handedness of their own
+        // and will use whichever tangent frame their vertex ends up with
+        constexpr uint8_t noHandedness = 2;
+        std::vector<uint8_t> cornerHandedness(indexCount, noHandedness);
+        for (uint32_t i = 0; i < indexCount; i += 3)
+        {
+            const uint32_t triangle[] = { indices[i], indices[i + 1], indices[i + 2] };
+            const auto edge1 = positions[triangle[1]] - positions[triangle[0]];
+            const auto edge2 = positions[triangle[2]] - positions[triangle[0]];
+            const auto du1 = us[triangle[1]] - us[triangle[0]], dv1 = vs[triangle[1]] - vs[triangle[0]];
+            const auto du2 = us[triangle[2]] - us[triangle[0]], dv2 = vs[triangle[2]] - vs[triangle[0]];
+            // (Only the directions are needed, and so rather than dividing by the determinant only its sign is used)
+            const auto determinant = (du1 * dv2) - (du2 * dv1);
+            if (determinant == 0.0f)
+            {
+                continue;
+            }
+            const auto orientation = (determinant > 0.0f) ? 1.0f : -1.0f;
+            const auto triangleTangent = ((edge1 * dv2) - (edge2 * dv1)) * orientation;
+            const auto triangleBitangent = ((edge2 * du1) - (edge1 * du2)) * orientation;
+
+            for (uint32_t j = 0; j < 3; ++j)
+            {
+                const auto vertexIndex = triangle[j];
+                const auto& normal = normals[vertexIndex];
+                auto tangent = triangleTangent - (normal * Dot(normal, triangleTangent));
+                if (tangent.Normalize() == 0.0f)
+                {
+                    continue;
+                }
+                const auto handedness = static_cast<uint8_t>((Dot(Cross(normal, tangent), triangleBitangent) < 0.0f) ? 1 : 0);
+                // The weight is the angle of the triangle at this corner
+                auto toNext = positions[triangle[(j + 1) % 3]] - positions[vertexIndex];
+                auto toPrevious = positions[triangle[(j + 2) % 3]] - positions[vertexIndex];
+                toNext.Normalize();
+                toPrevious.Normalize();
+                const auto angle = std::acos(std::min(std::max(Dot(toNext, toPrevious), -1.0f), 1.0f));
+
+                auto& accumulatedTangent = accumulatedTangents[handedness][vertexIndex];
+                accumulatedTangent.tangent += tangent * angle;
+                accumulatedTangent.isUsed = true;
+                cornerHandedness[i + j] = handedness;
+            }
+        }
+
+        // A vertex that is used with both handednesses is split,
+        // and the corners with the second handedness are moved to the new vertex
+        std::vector<uint32_t> splitVertexIndices(vertexCount, UINT32_MAX);
+        uint32_t newVertexCount = vertexCount;
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            if (accumulatedTangents[0][i].isUsed && accumulatedTangents[1][i].isUsed)
+            {
+                splitVertexIndices[i] = newVertexCount++;
+            }
+        }
+        if (newVertexCount > static_cast<uint32_t>(INT32_MAX))
+        {
+            OutputErrorMessageWithFileInfo(__FILE__, "Splitting vertices with different tangent handedness resulted in too many vertices");
+            return eae6320::Results::invalidFile;
+        }
+        if (newVertexCount != vertexCount)
+        {
+            for (uint32_t i = 0; i < indexCount; ++i)
+            {
+                if ((cornerHandedness[i] == 1) && (splitVertexIndices[indices[i]] != UINT32_MAX))
+                {
+                    indices[i] = splitVertexIndices[indices[i]];
+                }
+            }
+        }
+
+        sMeshData newMeshData((newVertexCount > UINT16_MAX) ? eae6320::Graphics::IndexDataTypes::BIT_32 : eae6320::Graphics::IndexDataTypes::BIT_16,
+            newVertexCount, indexCount);
+        if (!newMeshData.vertexData || !newMeshData.indexData)
+        {
+            OutputErrorMessageWithFileInfo(__FILE__, "Failed to allocate memory for the mesh data with tangent frames");
+            return eae6320::Results::outOfMemory;
+        }
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            // A vertex that was split keeps the first handedness
+            const uint8_t handedness = (!accumulatedTangents[0][i].isUsed && accumulatedTangents[1][i].isUsed) ? 1 : 0;
+            WriteTangentFrame(vertexData[i], accumulatedTangents[handedness][i].tangent, normals[i], handedness, newMeshData.vertexData[i]);
+            if (splitVertexIndices[i] != UINT32_MAX)
+            {
+                WriteTangentFrame(vertexData[i], accumulatedTangents[1][i].tangent, normals[i], 1, newMeshData.vertexData[splitVertexIndices[i]]);
+            }
+        }
+        if (io_meshData.skinningData)
+        {
+            // A vertex that was split is influenced by the same joints
+            newMeshData.skinningData = reinterpret_cast<eae6320::Graphics::VertexFormats::sSkinning*>(malloc(newVertexCount * sizeof(eae6320::Graphics::VertexFormats::sSkinning)));
+            if (!newMeshData.skinningData)
+            {
+                OutputErrorMessageWithFileInfo(__FILE__, "Failed to allocate memory for the skinning data with tangent frames");
+                return eae6320::Results::outOfMemory;
+            }
+            for (uint32_t i = 0; i < vertexCount; ++i)
+            {
+                newMeshData.skinningData[i] = io_meshData.skinningData[i];
+                if (splitVertexIndices[i] != UINT32_MAX)
+                {
+                    newMeshData.skinningData[splitVertexIndices[i]] = io_meshData.skinningData[i];
+                }
+            }
+        }
+        for (uint32_t i = 0; i < indexCount; ++i)
+        {
+            if (newMeshData.type == eae6320::Graphics::IndexDataTypes::BIT_16)
+            {
+                reinterpret_cast<uint16_t*>(newMeshData.indexData)[i] = static_cast<uint16_t>(indices[i]);
+            }
+            else
+            {
+                reinterpret_cast<uint32_t*>(newMeshData.indexData)[i] = indices[i];
+            }
+        }
+
+        // Swap the new data in (the old data will be freed when newMeshData goes out of scope)
+        std::swap(io_meshData.vertexData, newMeshData.vertexData);
+        std::swap(io_meshData.indexData, newMeshData.indexData);
+        if (newMeshData.skinningData)
+        {
+            std::swap(io_meshData.skinningData, newMeshData.skinningData);
+        }
+        std::swap(io_meshData.numberOfVertices, newMeshData.numberOfVertices);
+        std::swap(io_meshData.type, newMeshData.type);
+
+        return eae6320::Results::success;
+    }
+
+    void WriteTangentFrame(const eae6320::Graphics::VertexFormats::sMesh& i_vertex, const eae6320::Math::sVector& i_tangent, const eae6320::Math::sVector& i_normal,
+        const uint8_t i_handedness, eae6320::Graphics::VertexFormats::sMesh& o_vertex)
+    {
+        o_vertex = i_vertex;
+        // If no triangle gave this vertex a tangent
+        // an arbitrary one perpendicular to the normal will be chosen
+        const auto bitangent = Cross(i_normal, i_tangent) * ((i_handedness == 1) ? -1.0f : 1.0f);
+        int16_t packedTangentFrame[4];
+        eae6320::Math::PackTangentFrame(i_tangent, bitangent, i_normal, packedTangentFrame);
+        o_vertex.qx = packedTangentFrame[0];
+        o_vertex.qy = packedTangentFrame[1];
+        o_vertex.qz = packedTangentFrame[2];
+        o_vertex.qw = packedTangentFrame[3];
+    }
+
     uint8_t RoundColorChannel(const float i_value)
     {
         if (i_value < 0.0f)return 0;
         if (i_value > 1.0f)return UCHAR_MAX;
         return static_cast<uint8_t>(round(i_value * UCHAR_MAX));
     }
+
+    void QuantizeJointWeights(const double* const i_weights, uint8_t* const o_weights)
+    {
+        // Each weight is rounded down and then the remaining units are given to the weights that lost the most
+        // so that the quantized weights still add up to exactly 1 (i.e. 255)
+        const auto totalWeight = i_weights[0] + i_weights[1] + i_weights[2] + i_weights[3];
+        double remainders[4];
+        auto quantizedTotal = 0;
+        for (auto i = 0; i < 4; ++i)
+        {
+            const auto scaledWeight = (i_weights[i] / totalWeight) * UCHAR_MAX;
+            o_weights[i] = static_cast<uint8_t>(std::floor(scaledWeight));
+            remainders[i] = scaledWeight - o_weights[i];
+            quantizedTotal += o_weights[i];
+        }
+        for (; quantizedTotal < UCHAR_MAX; ++quantizedTotal)
+        {
+            const auto largestRemainder = std::max_element(remainders, remainders + 4) - remainders;
+            ++o_weights[largestRemainder];
+            remainders[largestRemainder] = -1.0;
+        }
+    }
 }
\ No newline at end of file